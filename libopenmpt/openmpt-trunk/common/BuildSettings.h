@@ -489,6 +489,16 @@
 #endif // arch
 #endif // ENABLE_ASM
 
+// Mixer interpolation kernels using compiler intrinsics. These instruction sets are part of
+// the baseline of the respective architectures, so no runtime check is required.
+#if !defined(NO_MIXER_SIMD)
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define ENABLE_NEON_MIXER
+#elif defined(__SSE2__) || (MPT_COMPILER_MSVC && defined(_M_X64))
+#define ENABLE_SSE2_MIXER
+#endif
+#endif // !NO_MIXER_SIMD
+
 #if !defined(ENABLE_MMX) && !defined(NO_REVERB)
 #define NO_REVERB // reverb requires mmx
 #endif
@@ -63,6 +63,10 @@ typedef void (*ModPlugMixerProc)(int*, unsigned long, unsigned long);
  * file, and [size] should be the size of that block.
  * Return the loaded mod file on success, or NULL on failure. */
 ModPlugFile* ModPlug_Load(const void* data, int size);
+/* Same as ModPlug_Load, but subsong lengths and seek positions are cached in [cachefile]
+ * (which should be unique per module, e.g. named after a hash of the data) and
+ * reused on later loads. [cachefile] may be NULL. */
+ModPlugFile* ModPlug_LoadWithLengthCache(const void* data, int size, const char* cachefile);
 /* Unload a mod file. */
 void ModPlug_Unload(ModPlugFile* file);
 
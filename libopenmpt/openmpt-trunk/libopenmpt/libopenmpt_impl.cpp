@@ -15,6 +15,7 @@
 #include "libopenmpt_impl.hpp"
 
 #include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <istream>
 #include <iterator>
@@ -22,6 +23,7 @@
 #include <ostream>
 
 #include <cmath>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 
@@ -425,6 +427,158 @@ void module_impl::init_subsongs( subsongs_type & subsongs ) const {
 bool module_impl::has_subsongs_inited() const {
 	return !m_subsongs.empty();
 }
+
+// Subsong lengths and seek maps only depend on the module data, the mixing rate and the tempo factor,
+// so they can be kept on disk (keyed by the caller, usually by a hash of the module) and reused on later loads.
+// The cache is a plain host-endian dump, it is only meant to be read back by the same build on the same device.
+static const char subsongs_cache_magic[8] = { 'O', 'M', 'P', 'T', 'L', 'E', 'N', '1' };
+template <typename T>
+static void write_cache_value( std::ostream & s, const T & value ) {
+	s.write( reinterpret_cast<const char *>( &value ), sizeof( T ) );
+}
+template <typename T>
+static bool read_cache_value( std::istream & s, T & value ) {
+	s.read( reinterpret_cast<char *>( &value ), sizeof( T ) );
+	return s.good();
+}
+bool module_impl::read_subsongs_cache() {
+	std::ifstream s( m_ctl_load_subsongs_cache_file.c_str(), std::ios::in | std::ios::binary );
+	if ( !s ) {
+		return false;
+	}
+	char magic[8];
+	s.read( magic, sizeof( magic ) );
+	if ( !s.good() || std::memcmp( magic, subsongs_cache_magic, sizeof( magic ) ) != 0 ) {
+		return false;
+	}
+	std::uint64_t file_size = 0;
+	std::int32_t samplerate = 0;
+	std::uint32_t tempo_factor = 0;
+	std::uint32_t num_subsongs = 0;
+	if ( !read_cache_value( s, file_size ) || !read_cache_value( s, samplerate ) || !read_cache_value( s, tempo_factor ) || !read_cache_value( s, num_subsongs ) ) {
+		return false;
+	}
+	if ( file_size != m_file_size || samplerate != static_cast<std::int32_t>( m_sndFile->m_MixerSettings.gdwMixingFreq ) || tempo_factor != m_sndFile->m_nTempoFactor ) {
+		return false;
+	}
+	if ( num_subsongs == 0 || num_subsongs > 0x10000u ) {
+		return false;
+	}
+	subsongs_type subsongs;
+	for ( std::uint32_t i = 0; i < num_subsongs; ++i ) {
+		double duration = 0.0;
+		std::int32_t start_row = 0, start_order = 0, sequence = 0;
+		if ( !read_cache_value( s, duration ) || !read_cache_value( s, start_row ) || !read_cache_value( s, start_order ) || !read_cache_value( s, sequence ) ) {
+			return false;
+		}
+		if ( sequence < 0 || sequence >= m_sndFile->Order.GetNumSequences() ) {
+			return false;
+		}
+		subsongs.push_back( subsong_data( duration, start_row, start_order, sequence ) );
+	}
+	m_subsongs = subsongs;
+	// Seek maps are optional, they are only present once a seek happened.
+	std::uint32_t num_maps = 0;
+	if ( !read_cache_value( s, samplerate ) || !read_cache_value( s, tempo_factor ) || !read_cache_value( s, num_maps ) || num_maps != num_subsongs ) {
+		return true;
+	}
+	std::vector<seek_map_type> seek_maps( num_maps );
+	for ( std::uint32_t i = 0; i < num_maps; ++i ) {
+		std::uint32_t num_rows = 0;
+		if ( !read_cache_value( s, num_rows ) || num_rows > 0x1000000u ) {
+			return true;
+		}
+		seek_maps[i].resize( num_rows );
+		for ( std::uint32_t r = 0; r < num_rows; ++r ) {
+			if ( !read_cache_value( s, seek_maps[i][r].time ) || !read_cache_value( s, seek_maps[i][r].order ) || !read_cache_value( s, seek_maps[i][r].row ) ) {
+				return true;
+			}
+		}
+	}
+	m_seek_maps.swap( seek_maps );
+	m_seek_maps_samplerate = samplerate;
+	m_seek_maps_tempo_factor = tempo_factor;
+	return true;
+}
+void module_impl::write_subsongs_cache() const {
+	if ( m_ctl_load_subsongs_cache_file.empty() || !has_subsongs_inited() ) {
+		return;
+	}
+	// Write to a temporary file first, another instance may be loading the same module.
+	const std::string tmp_filename = m_ctl_load_subsongs_cache_file + ".tmp";
+	{
+		std::ofstream s( tmp_filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+		if ( !s ) {
+			return;
+		}
+		s.write( subsongs_cache_magic, sizeof( subsongs_cache_magic ) );
+		write_cache_value( s, m_file_size );
+		write_cache_value( s, m_subsongs_samplerate );
+		write_cache_value( s, m_subsongs_tempo_factor );
+		write_cache_value( s, static_cast<std::uint32_t>( m_subsongs.size() ) );
+		for ( subsongs_type::const_iterator i = m_subsongs.begin(); i != m_subsongs.end(); ++i ) {
+			write_cache_value( s, i->duration );
+			write_cache_value( s, i->start_row );
+			write_cache_value( s, i->start_order );
+			write_cache_value( s, i->sequence );
+		}
+		if ( !m_seek_maps.empty() ) {
+			write_cache_value( s, m_seek_maps_samplerate );
+			write_cache_value( s, m_seek_maps_tempo_factor );
+			write_cache_value( s, static_cast<std::uint32_t>( m_seek_maps.size() ) );
+			for ( std::vector<seek_map_type>::const_iterator m = m_seek_maps.begin(); m != m_seek_maps.end(); ++m ) {
+				write_cache_value( s, static_cast<std::uint32_t>( m->size() ) );
+				for ( seek_map_type::const_iterator r = m->begin(); r != m->end(); ++r ) {
+					write_cache_value( s, r->time );
+					write_cache_value( s, r->order );
+					write_cache_value( s, r->row );
+				}
+			}
+		}
+		s.flush();
+		if ( !s.good() ) {
+			s.close();
+			std::remove( tmp_filename.c_str() );
+			return;
+		}
+	}
+	if ( std::rename( tmp_filename.c_str(), m_ctl_load_subsongs_cache_file.c_str() ) != 0 ) {
+		std::remove( tmp_filename.c_str() );
+	}
+}
+bool module_impl::seek_row_time_less( const seek_row & r, double seconds ) {
+	return r.time < seconds;
+}
+// Returns the times at which a time seek in the given subsong would stop on each row,
+// building it with a single walk through the subsong on first use.
+const module_impl::seek_map_type * module_impl::get_seek_map( std::size_t subsong_index ) {
+	if ( !has_subsongs_inited() || subsong_index >= m_subsongs.size() ) {
+		return 0;
+	}
+	const std::int32_t samplerate = static_cast<std::int32_t>( m_sndFile->m_MixerSettings.gdwMixingFreq );
+	if ( m_seek_maps.size() != m_subsongs.size() || m_seek_maps_samplerate != samplerate || m_seek_maps_tempo_factor != m_sndFile->m_nTempoFactor ) {
+		m_seek_maps.assign( m_subsongs.size(), seek_map_type() );
+		m_seek_maps_samplerate = samplerate;
+		m_seek_maps_tempo_factor = m_sndFile->m_nTempoFactor;
+	}
+	seek_map_type & seek_map = m_seek_maps[subsong_index];
+	if ( seek_map.empty() ) {
+		const subsong_data & subsong = m_subsongs[subsong_index];
+		std::vector<GetLengthRowTime> row_times;
+		m_sndFile->GetLength( eNoAdjust, GetLengthTarget( std::numeric_limits<double>::max() ).StartPos( static_cast<SEQUENCEINDEX>( subsong.sequence ), static_cast<ORDERINDEX>( subsong.start_order ), static_cast<ROWINDEX>( subsong.start_row ) ), &row_times );
+		seek_map.reserve( row_times.size() );
+		for ( std::vector<GetLengthRowTime>::const_iterator i = row_times.begin(); i != row_times.end(); ++i ) {
+			seek_row r;
+			r.time = i->time;
+			r.order = i->order;
+			r.row = i->row;
+			seek_map.push_back( r );
+		}
+		// Only flagged here, this runs while seeking: the cache file is written when the module is destroyed.
+		m_subsongs_cache_dirty = true;
+	}
+	return seek_map.empty() ? 0 : &seek_map;
+}
 void module_impl::ctor( const std::map< std::string, std::string > & ctls ) {
 	m_sndFile = mpt::make_unique<CSoundFile>();
 	m_loaded = false;
@@ -439,6 +593,12 @@ void module_impl::ctor( const std::map< std::string, std::string > & ctls ) {
 	m_ctl_load_skip_plugins = false;
 	m_ctl_load_skip_subsongs_init = false;
 	m_ctl_seek_sync_samples = false;
+	m_seek_maps_samplerate = 0;
+	m_seek_maps_tempo_factor = 0;
+	m_subsongs_samplerate = 0;
+	m_subsongs_tempo_factor = 0;
+	m_file_size = 0;
+	m_subsongs_cache_dirty = false;
 	// init member variables that correspond to ctls
 	for ( std::map< std::string, std::string >::const_iterator i = ctls.begin(); i != ctls.end(); ++i ) {
 		ctl_set( i->first, i->second, false );
@@ -462,7 +622,14 @@ void module_impl::load( const FileReader & file, const std::map< std::string, st
 			throw openmpt::exception("error loading file");
 		}
 		if ( !m_ctl_load_skip_subsongs_init ) {
-			init_subsongs( m_subsongs );
+			m_file_size = file.GetLength();
+			m_subsongs_samplerate = static_cast<std::int32_t>( m_sndFile->m_MixerSettings.gdwMixingFreq );
+			m_subsongs_tempo_factor = m_sndFile->m_nTempoFactor;
+			const bool use_cache = !m_ctl_load_subsongs_cache_file.empty() && !m_ctl_load_skip_patterns;
+			if ( !use_cache || !read_subsongs_cache() ) {
+				init_subsongs( m_subsongs );
+				m_subsongs_cache_dirty = use_cache;
+			}
 		}
 		m_loaded = true;
 	}
@@ -650,6 +817,13 @@ module_impl::module_impl( const void * data, std::size_t size, std::shared_ptr<l
 	apply_libopenmpt_defaults();
 }
 module_impl::~module_impl() {
+	if ( m_subsongs_cache_dirty ) {
+		try {
+			write_subsongs_cache();
+		} catch ( ... ) {
+			// a missing cache entry only costs a rescan on next load
+		}
+	}
 	m_sndFile->Destroy();
 }
 
@@ -856,7 +1030,19 @@ double module_impl::set_position_seconds( double seconds ) {
 	} else {
 		subsong = &subsongs[m_current_subsong];
 	}
-	GetLengthType t = m_sndFile->GetLength( eNoAdjust, GetLengthTarget( seconds ).StartPos( static_cast<SEQUENCEINDEX>( subsong->sequence ), static_cast<ORDERINDEX>( subsong->start_order ), static_cast<ROWINDEX>( subsong->start_row ) ) ).back();
+	GetLengthType t;
+	const seek_map_type * seek_map = has_subsongs_inited() ? get_seek_map( subsong - &subsongs[0] ) : 0;
+	seek_map_type::const_iterator seek_pos;
+	if ( seek_map ) {
+		// First row at which a time seek would stop, see GetLength(). Times never decrease within a subsong.
+		seek_pos = std::lower_bound( seek_map->begin(), seek_map->end(), seconds, seek_row_time_less );
+	}
+	if ( seek_map && seek_pos != seek_map->end() ) {
+		t.lastOrder = static_cast<ORDERINDEX>( seek_pos->order );
+		t.lastRow = static_cast<ROWINDEX>( seek_pos->row );
+	} else {
+		t = m_sndFile->GetLength( eNoAdjust, GetLengthTarget( seconds ).StartPos( static_cast<SEQUENCEINDEX>( subsong->sequence ), static_cast<ORDERINDEX>( subsong->start_order ), static_cast<ROWINDEX>( subsong->start_row ) ) ).back();
+	}
 	m_sndFile->m_PlayState.m_nCurrentOrder = t.lastOrder;
 	m_sndFile->SetCurrentOrder( t.lastOrder );
 	m_sndFile->m_PlayState.m_nNextRow = t.lastRow;
@@ -1289,6 +1475,7 @@ std::vector<std::string> module_impl::get_ctls() const {
 	retval.push_back( "load.skip_patterns" );
 	retval.push_back( "load.skip_plugins" );
 	retval.push_back( "load.skip_subsongs_init" );
+	retval.push_back( "load.subsongs_cache_file" );
 	retval.push_back( "seek.sync_samples" );
 	retval.push_back( "subsong" );
 	retval.push_back( "play.tempo_factor" );
@@ -1318,6 +1505,8 @@ std::string module_impl::ctl_get( std::string ctl, bool throw_if_unknown ) const
 		return mpt::ToString( m_ctl_load_skip_plugins );
 	} else if ( ctl == "load.skip_subsongs_init" ) {
 		return mpt::ToString( m_ctl_load_skip_subsongs_init );
+	} else if ( ctl == "load.subsongs_cache_file" ) {
+		return m_ctl_load_subsongs_cache_file;
 	} else if ( ctl == "seek.sync_samples" ) {
 		return mpt::ToString( m_ctl_seek_sync_samples );
 	} else if ( ctl == "subsong" ) {
@@ -1364,6 +1553,8 @@ void module_impl::ctl_set( std::string ctl, const std::string & value, bool thro
 		m_ctl_load_skip_plugins = ConvertStrTo<bool>( value );
 	} else if ( ctl == "load.skip_subsongs_init" ) {
 		m_ctl_load_skip_subsongs_init = ConvertStrTo<bool>( value );
+	} else if ( ctl == "load.subsongs_cache_file" ) {
+		m_ctl_load_subsongs_cache_file = value;
 	} else if ( ctl == "seek.sync_samples" ) {
 		m_ctl_seek_sync_samples = ConvertStrTo<bool>( value );
 	} else if ( ctl == "subsong" ) {
@@ -74,6 +74,12 @@ protected:
 		subsong_data( double duration, std::int32_t start_row, std::int32_t start_order, std::int32_t sequence );
 	}; // struct subsong_data
 	typedef std::vector<subsong_data> subsongs_type;
+	struct seek_row {
+		double time;
+		std::int32_t order;
+		std::int32_t row;
+	}; // struct seek_row
+	typedef std::vector<seek_row> seek_map_type;
 	static const std::int32_t all_subsongs = -1;
 	std::shared_ptr<log_interface> m_Log;
 	std::unique_ptr<log_forwarder> m_LogForwarder;
@@ -83,11 +89,19 @@ protected:
 	bool m_loaded;
 	std::unique_ptr<OpenMPT::Dither> m_Dither;
 	subsongs_type m_subsongs;
+	std::vector<seek_map_type> m_seek_maps;
+	std::int32_t m_seek_maps_samplerate;
+	std::uint32_t m_seek_maps_tempo_factor;
+	std::int32_t m_subsongs_samplerate;
+	std::uint32_t m_subsongs_tempo_factor;
+	std::uint64_t m_file_size;
+	bool m_subsongs_cache_dirty;
 	float m_Gain;
 	bool m_ctl_load_skip_samples;
 	bool m_ctl_load_skip_patterns;
 	bool m_ctl_load_skip_plugins;
 	bool m_ctl_load_skip_subsongs_init;
+	std::string m_ctl_load_subsongs_cache_file;
 	bool m_ctl_seek_sync_samples;
 	std::vector<std::string> m_loaderMessages;
 public:
@@ -100,6 +114,10 @@ protected:
 	subsongs_type get_subsongs() const;
 	void init_subsongs( subsongs_type & subsongs ) const;
 	bool has_subsongs_inited() const;
+	bool read_subsongs_cache();
+	void write_subsongs_cache() const;
+	const seek_map_type * get_seek_map( std::size_t subsong_index );
+	static bool seek_row_time_less( const seek_row & r, double seconds );
 	void ctor( const std::map< std::string, std::string > & ctls );
 	void load( const OpenMPT::FileReader & file, const std::map< std::string, std::string > & ctls );
 	bool is_loaded() const;
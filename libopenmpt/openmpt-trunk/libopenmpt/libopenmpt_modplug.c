@@ -92,14 +92,25 @@ static int32_t modplugresamplingmode_to_filterlength(int mode)
 }
 
 LIBOPENMPT_MODPLUG_API ModPlugFile* ModPlug_Load(const void* data, int size)
+{
+	return ModPlug_LoadWithLengthCache(data,size,NULL);
+}
+
+LIBOPENMPT_MODPLUG_API ModPlugFile* ModPlug_LoadWithLengthCache(const void* data, int size, const char* cachefile)
 {
 	ModPlugFile* file = (ModPlugFile*)malloc(sizeof(ModPlugFile));
 	const char* name = NULL;
 	const char* message = NULL;
+	openmpt_module_initial_ctl ctls[2];
 	if(!file) return NULL;
 	memset(file,0,sizeof(ModPlugFile));
 	memcpy(&file->settings,&globalsettings,sizeof(ModPlug_Settings));
-	file->mod = openmpt_module_create_from_memory(data,size,NULL,NULL,NULL);
+	memset(ctls,0,sizeof(ctls));
+	if(cachefile){
+		ctls[0].ctl = "load.subsongs_cache_file";
+		ctls[0].value = cachefile;
+	}
+	file->mod = openmpt_module_create_from_memory(data,size,NULL,NULL,ctls);
 	if(!file->mod){
 		free(file);
 		return NULL;
@@ -613,6 +624,7 @@ LIBOPENMPT_MODPLUG_API char ModPlug_ExportIT(ModPlugFile* file, const char* file
 #ifdef _MSC_VER
 #ifdef _M_IX86
 #pragma comment(linker, "/EXPORT:ModPlug_Load=_ModPlug_Load")
+#pragma comment(linker, "/EXPORT:ModPlug_LoadWithLengthCache=_ModPlug_LoadWithLengthCache")
 #pragma comment(linker, "/EXPORT:ModPlug_Unload=_ModPlug_Unload")
 #pragma comment(linker, "/EXPORT:ModPlug_Read=_ModPlug_Read")
 #pragma comment(linker, "/EXPORT:ModPlug_GetName=_ModPlug_GetName")
@@ -646,6 +658,7 @@ LIBOPENMPT_MODPLUG_API char ModPlug_ExportIT(ModPlugFile* file, const char* file
 #pragma comment(linker, "/EXPORT:ModPlug_ExportIT=_ModPlug_ExportIT")
 #else /* !_M_IX86 */
 #pragma comment(linker, "/EXPORT:ModPlug_Load")
+#pragma comment(linker, "/EXPORT:ModPlug_LoadWithLengthCache")
 #pragma comment(linker, "/EXPORT:ModPlug_Unload")
 #pragma comment(linker, "/EXPORT:ModPlug_Read")
 #pragma comment(linker, "/EXPORT:ModPlug_GetName")
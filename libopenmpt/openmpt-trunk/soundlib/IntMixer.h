@@ -14,6 +14,14 @@
 #include "Resampler.h"
 #include "MixerInterface.h"
 
+#if defined(ENABLE_NEON_MIXER)
+#include <arm_neon.h>
+#include <cstring>
+#elif defined(ENABLE_SSE2_MIXER)
+#include <emmintrin.h>
+#include <cstring>
+#endif
+
 OPENMPT_NAMESPACE_BEGIN
 
 template<int channelsOut, int channelsIn, typename out, typename in, size_t mixPrecision>
@@ -39,6 +47,148 @@ typedef IntToIntTraits<2, 2, mixsample_t, int8,  16> Int8SToIntS;
 typedef IntToIntTraits<2, 2, mixsample_t, int16, 16> Int16SToIntS;
 
 
+//////////////////////////////////////////////////////////////////////////
+// 4-tap convolution kernel shared by the cubic and 8-tap interpolators:
+// vol[i] = sum(lut[t] * inBuffer[t * numChannelsIn + i], t = 0..3) for each input channel.
+// Sums wrap around in 32 bits exactly like the scalar version.
+
+template<class Traits>
+struct Convolve4Tap
+{
+	static MPT_FORCEINLINE void Run(typename Traits::output_t * const MPT_RESTRICT vol, const typename Traits::input_t * const MPT_RESTRICT inBuffer, const int16 * const MPT_RESTRICT lut)
+	{
+		for(int i = 0; i < Traits::numChannelsIn; i++)
+		{
+			vol[i] =
+				  lut[0] * Traits::Convert(inBuffer[i])
+				+ lut[1] * Traits::Convert(inBuffer[i + Traits::numChannelsIn])
+				+ lut[2] * Traits::Convert(inBuffer[i + 2 * Traits::numChannelsIn])
+				+ lut[3] * Traits::Convert(inBuffer[i + 3 * Traits::numChannelsIn]);
+		}
+	}
+};
+
+// 8-bit samples are scaled by 256 (see IntToIntTraits::Convert), which still fits into 16 bits.
+// The loads below read exactly the 4 sample frames used by the scalar version.
+
+#if defined(ENABLE_NEON_MIXER)
+
+template<>
+struct Convolve4Tap<Int16MToIntS>
+{
+	static MPT_FORCEINLINE void Run(int32 * const MPT_RESTRICT vol, const int16 * const MPT_RESTRICT inBuffer, const int16 * const MPT_RESTRICT lut)
+	{
+		int32x4_t prod = vmull_s16(vld1_s16(inBuffer), vld1_s16(lut));
+		int32x2_t sum = vpadd_s32(vget_low_s32(prod), vget_high_s32(prod));
+		vol[0] = vget_lane_s32(vpadd_s32(sum, sum), 0);
+	}
+};
+
+template<>
+struct Convolve4Tap<Int8MToIntS>
+{
+	static MPT_FORCEINLINE void Run(int32 * const MPT_RESTRICT vol, const int8 * const MPT_RESTRICT inBuffer, const int16 * const MPT_RESTRICT lut)
+	{
+		int32 in4;
+		std::memcpy(&in4, inBuffer, 4);
+		int16x4_t in = vget_low_s16(vshll_n_s8(vreinterpret_s8_s32(vdup_n_s32(in4)), 8));
+		int32x4_t prod = vmull_s16(in, vld1_s16(lut));
+		int32x2_t sum = vpadd_s32(vget_low_s32(prod), vget_high_s32(prod));
+		vol[0] = vget_lane_s32(vpadd_s32(sum, sum), 0);
+	}
+};
+
+// Stereo: multiply LRLR.. frames with duplicated coefficients c0 c0 c1 c1 / c2 c2 c3 c3
+template<>
+struct Convolve4Tap<Int16SToIntS>
+{
+	static MPT_FORCEINLINE void Run(int32 * const MPT_RESTRICT vol, const int16 * const MPT_RESTRICT inBuffer, const int16 * const MPT_RESTRICT lut)
+	{
+		int16x4_t coef = vld1_s16(lut);
+		int16x4x2_t coef2 = vzip_s16(coef, coef);
+		int16x8_t in = vld1q_s16(inBuffer);
+		int32x4_t prod = vmull_s16(vget_low_s16(in), coef2.val[0]);
+		prod = vmlal_s16(prod, vget_high_s16(in), coef2.val[1]);
+		vst1_s32(vol, vadd_s32(vget_low_s32(prod), vget_high_s32(prod)));
+	}
+};
+
+template<>
+struct Convolve4Tap<Int8SToIntS>
+{
+	static MPT_FORCEINLINE void Run(int32 * const MPT_RESTRICT vol, const int8 * const MPT_RESTRICT inBuffer, const int16 * const MPT_RESTRICT lut)
+	{
+		int16x4_t coef = vld1_s16(lut);
+		int16x4x2_t coef2 = vzip_s16(coef, coef);
+		int16x8_t in = vshll_n_s8(vld1_s8(inBuffer), 8);
+		int32x4_t prod = vmull_s16(vget_low_s16(in), coef2.val[0]);
+		prod = vmlal_s16(prod, vget_high_s16(in), coef2.val[1]);
+		vst1_s32(vol, vadd_s32(vget_low_s32(prod), vget_high_s32(prod)));
+	}
+};
+
+#elif defined(ENABLE_SSE2_MIXER)
+
+static MPT_FORCEINLINE int32 Convolve4TapMonoSSE2(__m128i in, const int16 * const MPT_RESTRICT lut)
+{
+	__m128i prod = _mm_madd_epi16(in, _mm_loadl_epi64(reinterpret_cast<const __m128i *>(lut)));	// c0*s0+c1*s1, c2*s2+c3*s3
+	prod = _mm_add_epi32(prod, _mm_shuffle_epi32(prod, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_cvtsi128_si32(prod);
+}
+
+// Stereo: reorder LRLR.. frames into L0 L1 R0 R1 L2 L3 R2 R3 so that madd sums pairs of the same channel
+static MPT_FORCEINLINE void Convolve4TapStereoSSE2(int32 * const MPT_RESTRICT vol, __m128i in, const int16 * const MPT_RESTRICT lut)
+{
+	__m128i coef = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(lut));
+	coef = _mm_unpacklo_epi32(coef, coef);	// c0 c1 c0 c1 c2 c3 c2 c3
+	in = _mm_shufflelo_epi16(in, _MM_SHUFFLE(3, 1, 2, 0));
+	in = _mm_shufflehi_epi16(in, _MM_SHUFFLE(3, 1, 2, 0));
+	__m128i prod = _mm_madd_epi16(in, coef);
+	prod = _mm_add_epi32(prod, _mm_unpackhi_epi64(prod, prod));
+	_mm_storel_epi64(reinterpret_cast<__m128i *>(vol), prod);
+}
+
+template<>
+struct Convolve4Tap<Int16MToIntS>
+{
+	static MPT_FORCEINLINE void Run(int32 * const MPT_RESTRICT vol, const int16 * const MPT_RESTRICT inBuffer, const int16 * const MPT_RESTRICT lut)
+	{
+		vol[0] = Convolve4TapMonoSSE2(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(inBuffer)), lut);
+	}
+};
+
+template<>
+struct Convolve4Tap<Int8MToIntS>
+{
+	static MPT_FORCEINLINE void Run(int32 * const MPT_RESTRICT vol, const int8 * const MPT_RESTRICT inBuffer, const int16 * const MPT_RESTRICT lut)
+	{
+		int32 in4;
+		std::memcpy(&in4, inBuffer, 4);
+		vol[0] = Convolve4TapMonoSSE2(_mm_unpacklo_epi8(_mm_setzero_si128(), _mm_cvtsi32_si128(in4)), lut);
+	}
+};
+
+template<>
+struct Convolve4Tap<Int16SToIntS>
+{
+	static MPT_FORCEINLINE void Run(int32 * const MPT_RESTRICT vol, const int16 * const MPT_RESTRICT inBuffer, const int16 * const MPT_RESTRICT lut)
+	{
+		Convolve4TapStereoSSE2(vol, _mm_loadu_si128(reinterpret_cast<const __m128i *>(inBuffer)), lut);
+	}
+};
+
+template<>
+struct Convolve4Tap<Int8SToIntS>
+{
+	static MPT_FORCEINLINE void Run(int32 * const MPT_RESTRICT vol, const int8 * const MPT_RESTRICT inBuffer, const int16 * const MPT_RESTRICT lut)
+	{
+		Convolve4TapStereoSSE2(vol, _mm_unpacklo_epi8(_mm_setzero_si128(), _mm_loadl_epi64(reinterpret_cast<const __m128i *>(inBuffer))), lut);
+	}
+};
+
+#endif // ENABLE_NEON_MIXER / ENABLE_SSE2_MIXER
+
+
 //////////////////////////////////////////////////////////////////////////
 // Interpolation templates
 
@@ -76,13 +226,11 @@ struct FastSincInterpolation
 		static_assert(Traits::numChannelsIn <= Traits::numChannelsOut, "Too many input channels");
 		const int16 *lut = CResampler::FastSincTable + ((posLo >> 6) & 0x3FC);
 
+		typename Traits::output_t vol[Traits::numChannelsIn];
+		Convolve4Tap<Traits>::Run(vol, inBuffer - Traits::numChannelsIn, lut);
 		for(int i = 0; i < Traits::numChannelsIn; i++)
 		{
-			outSample[i] =
-				 (lut[0] * Traits::Convert(inBuffer[i - Traits::numChannelsIn])
-				+ lut[1] * Traits::Convert(inBuffer[i])
-				+ lut[2] * Traits::Convert(inBuffer[i + Traits::numChannelsIn])
-				+ lut[3] * Traits::Convert(inBuffer[i + 2 * Traits::numChannelsIn])) >> 14;
+			outSample[i] = vol[i] >> 14;
 		}
 	}
 };
@@ -112,17 +260,12 @@ struct PolyphaseInterpolation
 		static_assert(Traits::numChannelsIn <= Traits::numChannelsOut, "Too many input channels");
 		const SINC_TYPE *lut = sinc + ((posLo >> (16 - SINC_PHASES_BITS)) & SINC_MASK) * SINC_WIDTH;
 
+		typename Traits::output_t vol1[Traits::numChannelsIn], vol2[Traits::numChannelsIn];
+		Convolve4Tap<Traits>::Run(vol1, inBuffer - 3 * Traits::numChannelsIn, lut);
+		Convolve4Tap<Traits>::Run(vol2, inBuffer + Traits::numChannelsIn, lut + 4);
 		for(int i = 0; i < Traits::numChannelsIn; i++)
 		{
-			outSample[i] =
-				 (lut[0] * Traits::Convert(inBuffer[i - 3 * Traits::numChannelsIn])
-				+ lut[1] * Traits::Convert(inBuffer[i - 2 * Traits::numChannelsIn])
-				+ lut[2] * Traits::Convert(inBuffer[i - Traits::numChannelsIn])
-				+ lut[3] * Traits::Convert(inBuffer[i])
-				+ lut[4] * Traits::Convert(inBuffer[i + Traits::numChannelsIn])
-				+ lut[5] * Traits::Convert(inBuffer[i + 2 * Traits::numChannelsIn])
-				+ lut[6] * Traits::Convert(inBuffer[i + 3 * Traits::numChannelsIn])
-				+ lut[7] * Traits::Convert(inBuffer[i + 4 * Traits::numChannelsIn])) >> SINC_QUANTSHIFT;
+			outSample[i] = (vol1[i] + vol2[i]) >> SINC_QUANTSHIFT;
 		}
 	}
 };
@@ -145,19 +288,12 @@ struct FIRFilterInterpolation
 		static_assert(Traits::numChannelsIn <= Traits::numChannelsOut, "Too many input channels");
 		const int16 * const lut = WFIRlut + (((posLo + WFIR_FRACHALVE) >> WFIR_FRACSHIFT) & WFIR_FRACMASK);
 
+		typename Traits::output_t vol1[Traits::numChannelsIn], vol2[Traits::numChannelsIn];
+		Convolve4Tap<Traits>::Run(vol1, inBuffer - 3 * Traits::numChannelsIn, lut);
+		Convolve4Tap<Traits>::Run(vol2, inBuffer + Traits::numChannelsIn, lut + 4);
 		for(int i = 0; i < Traits::numChannelsIn; i++)
 		{
-			typename Traits::output_t vol1 =
-				  (lut[0] * Traits::Convert(inBuffer[i - 3 * Traits::numChannelsIn]))
-				+ (lut[1] * Traits::Convert(inBuffer[i - 2 * Traits::numChannelsIn]))
-				+ (lut[2] * Traits::Convert(inBuffer[i - Traits::numChannelsIn]))
-				+ (lut[3] * Traits::Convert(inBuffer[i]));
-			typename Traits::output_t vol2 =
-				  (lut[4] * Traits::Convert(inBuffer[i + 1 * Traits::numChannelsIn]))
-				+ (lut[5] * Traits::Convert(inBuffer[i + 2 * Traits::numChannelsIn]))
-				+ (lut[6] * Traits::Convert(inBuffer[i + 3 * Traits::numChannelsIn]))
-				+ (lut[7] * Traits::Convert(inBuffer[i + 4 * Traits::numChannelsIn]));
-			outSample[i] = ((vol1 >> 1) + (vol2 >> 1)) >> (WFIR_16BITSHIFT - 1);
+			outSample[i] = ((vol1[i] >> 1) + (vol2[i] >> 1)) >> (WFIR_16BITSHIFT - 1);
 		}
 	}
 };
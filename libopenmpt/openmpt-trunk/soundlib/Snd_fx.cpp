@@ -234,9 +234,10 @@ public:
 // Get mod length in various cases. Parameters:
 // [in]  adjustMode: See enmGetLengthResetMode for possible adjust modes.
 // [in]  target: Time or position target which should be reached, or no target to get length of the first sub song. Use GetLengthTarget::StartPos to also specify a position from where the seeking should begin.
+// [out] rowTimes: If not null, receives the elapsed time and position at the top of every row parsed before the first sub song ends. Parsing stops there.
 // [out] See definition of type GetLengthType for the returned values.
-std::vector<GetLengthType> CSoundFile::GetLength(enmGetLengthResetMode adjustMode, GetLengthTarget target)
-//--------------------------------------------------------------------------------------------------------
+std::vector<GetLengthType> CSoundFile::GetLength(enmGetLengthResetMode adjustMode, GetLengthTarget target, std::vector<GetLengthRowTime> *rowTimes)
+//------------------------------------------------------------------------------------------------------------------------------------------------
 {
 	std::vector<GetLengthType> results;
 	GetLengthType retval;
@@ -301,6 +302,15 @@ std::vector<GetLengthType> CSoundFile::GetLength(enmGetLengthResetMode adjustMod
 
 	for (;;)
 	{
+		if(rowTimes != nullptr)
+		{
+			// A time seek would stop at the first of these entries whose time is not below its target.
+			if(!results.empty())
+				break;
+			const GetLengthRowTime rowTime = { memory.elapsedTime, memory.state.m_nRow, memory.state.m_nCurrentOrder };
+			rowTimes->push_back(rowTime);
+		}
+
 		// Time target reached.
 		if(target.mode == GetLengthTarget::SeekSeconds && memory.elapsedTime >= target.time)
 		{
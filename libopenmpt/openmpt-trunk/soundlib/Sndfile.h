@@ -111,6 +111,15 @@ struct GetLengthType
 };
 
 
+// Elapsed time at the start of a parsed row, as recorded by GetLength()
+struct GetLengthRowTime
+{
+	double time;		// elapsed time in seconds when this row is reached
+	ROWINDEX row;
+	ORDERINDEX order;
+};
+
+
 // Target seek mode for GetLength()
 struct GetLengthTarget
 {
@@ -625,7 +634,7 @@ public:
 
 	//Get modlength in various cases: total length, length to
 	//specific order&row etc. Return value is in seconds.
-	std::vector<GetLengthType> GetLength(enmGetLengthResetMode adjustMode, GetLengthTarget target = GetLengthTarget());
+	std::vector<GetLengthType> GetLength(enmGetLengthResetMode adjustMode, GetLengthTarget target = GetLengthTarget(), std::vector<GetLengthRowTime> *rowTimes = nullptr);
 
 	void InitializeVisitedRows() { visitedSongRows.Initialize(true); }
 
@@ -45,6 +45,7 @@ private:
     const  char  *m_error;
     bool          m_status;
     bool          m_locked;
+    bool          m_silent;
 
 public:
     ReSID  (sidbuilder *builder);
@@ -63,6 +64,12 @@ public:
     void          filter  (bool enable);
     void          voice   (uint_least8_t num, bool mute) {;}
 
+    // Seeking support
+    void          silent    (bool enable) { m_silent = enable; }
+    int           stateSize (void);
+    void          saveState (uint8_t *state);
+    void          loadState (const uint8_t *state);
+
     operator bool () { return m_status; }
     static   int  devices (char *error);
 
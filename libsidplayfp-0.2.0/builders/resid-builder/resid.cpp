@@ -45,7 +45,8 @@ ReSID::ReSID (sidbuilder *builder)
  m_sid(*(new RESID_NS::SID)),
 #endif
  m_status(true),
- m_locked(false)
+ m_locked(false),
+ m_silent(false)
 {
     char *p = m_credit;
     m_error = "N/A";
@@ -146,6 +147,7 @@ void ReSID::bias (const float dac_bias)
 void ReSID::reset (uint8_t volume)
 {
     m_accessClk = 0;
+    m_bufferpos = 0;
     m_sid.reset ();
     m_sid.write (0x18, volume);
 }
@@ -166,7 +168,39 @@ void ReSID::clock()
 {
     RESID_NS::cycle_count cycles = m_context->getTime(m_accessClk, m_phase);
     m_accessClk += cycles;
-    m_bufferpos += m_sid.clock(cycles, (short *) m_buffer + m_bufferpos, OUTPUTBUFFERSIZE - m_bufferpos, 1);
+    // When seeking the samples are only counted, not computed
+    short *buf = m_silent ? NULL : (short *) m_buffer + m_bufferpos;
+    m_bufferpos += m_sid.clock(cycles, buf, OUTPUTBUFFERSIZE - m_bufferpos, 1);
+}
+
+// A snapshot is the complete reSID engine, plus the samples
+// generated but not yet taken by the mixer.
+int ReSID::stateSize (void)
+{
+    return sizeof (m_accessClk) + sizeof (m_bufferpos)
+         + sizeof (short) * OUTPUTBUFFERSIZE + m_sid.snapshot_size ();
+}
+
+void ReSID::saveState (uint8_t *state)
+{
+    memcpy (state, &m_accessClk, sizeof (m_accessClk));
+    state += sizeof (m_accessClk);
+    memcpy (state, &m_bufferpos, sizeof (m_bufferpos));
+    state += sizeof (m_bufferpos);
+    memcpy (state, m_buffer, sizeof (short) * OUTPUTBUFFERSIZE);
+    state += sizeof (short) * OUTPUTBUFFERSIZE;
+    m_sid.save_snapshot ((char *) state);
+}
+
+void ReSID::loadState (const uint8_t *state)
+{
+    memcpy (&m_accessClk, state, sizeof (m_accessClk));
+    state += sizeof (m_accessClk);
+    memcpy (&m_bufferpos, state, sizeof (m_bufferpos));
+    state += sizeof (m_bufferpos);
+    memcpy (m_buffer, state, sizeof (short) * OUTPUTBUFFERSIZE);
+    state += sizeof (short) * OUTPUTBUFFERSIZE;
+    m_sid.load_snapshot ((const char *) state);
 }
 
 void ReSID::filter (bool enable)
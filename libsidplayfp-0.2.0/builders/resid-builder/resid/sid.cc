@@ -21,6 +21,7 @@
 
 #include "sid.h"
 #include <math.h>
+#include <string.h>
 
 #ifndef round
 #define round(x) (x>=0.0?floor(x+0.5):ceil(x-0.5))
@@ -390,6 +391,81 @@ void SID::write_state(const State& state)
 }
 
 
+// ----------------------------------------------------------------------------
+// Snapshot size: the voices, the filters, the bus and the resampler state,
+// followed by the ring buffer samples the resampler still reads.
+// ----------------------------------------------------------------------------
+int SID::snapshot_size()
+{
+  int size = sizeof(voice) + sizeof(filter) + sizeof(extfilt) +
+    sizeof(bus_value) + sizeof(bus_value_ttl) +
+    sizeof(write_pipeline) + sizeof(write_address) +
+    sizeof(sample_offset) + sizeof(sample_index) +
+    sizeof(sample_prev) + sizeof(sample_now);
+
+  if (sample) {
+    size += (fir_N + 1)*sizeof(short);
+  }
+  return size;
+}
+
+
+// ----------------------------------------------------------------------------
+// Save snapshot.
+// The voices and filters hold no pointers other than to the voices of this
+// SID and to the static model tables, so they are copied as they are.
+// ----------------------------------------------------------------------------
+void SID::save_snapshot(char* buf)
+{
+  memcpy(buf, voice, sizeof(voice)); buf += sizeof(voice);
+  memcpy(buf, &filter, sizeof(filter)); buf += sizeof(filter);
+  memcpy(buf, &extfilt, sizeof(extfilt)); buf += sizeof(extfilt);
+  memcpy(buf, &bus_value, sizeof(bus_value)); buf += sizeof(bus_value);
+  memcpy(buf, &bus_value_ttl, sizeof(bus_value_ttl)); buf += sizeof(bus_value_ttl);
+  memcpy(buf, &write_pipeline, sizeof(write_pipeline)); buf += sizeof(write_pipeline);
+  memcpy(buf, &write_address, sizeof(write_address)); buf += sizeof(write_address);
+  memcpy(buf, &sample_offset, sizeof(sample_offset)); buf += sizeof(sample_offset);
+  memcpy(buf, &sample_index, sizeof(sample_index)); buf += sizeof(sample_index);
+  memcpy(buf, &sample_prev, sizeof(sample_prev)); buf += sizeof(sample_prev);
+  memcpy(buf, &sample_now, sizeof(sample_now)); buf += sizeof(sample_now);
+
+  if (sample) {
+    // The convolutions read the fir_N + 1 samples before sample_index.
+    short* ring = (short*)buf;
+    for (int i = 0; i <= fir_N; i++) {
+      ring[i] = sample[(sample_index - fir_N - 1 + i) & RINGMASK];
+    }
+  }
+}
+
+
+// ----------------------------------------------------------------------------
+// Load snapshot.
+// ----------------------------------------------------------------------------
+void SID::load_snapshot(const char* buf)
+{
+  memcpy(voice, buf, sizeof(voice)); buf += sizeof(voice);
+  memcpy(&filter, buf, sizeof(filter)); buf += sizeof(filter);
+  memcpy(&extfilt, buf, sizeof(extfilt)); buf += sizeof(extfilt);
+  memcpy(&bus_value, buf, sizeof(bus_value)); buf += sizeof(bus_value);
+  memcpy(&bus_value_ttl, buf, sizeof(bus_value_ttl)); buf += sizeof(bus_value_ttl);
+  memcpy(&write_pipeline, buf, sizeof(write_pipeline)); buf += sizeof(write_pipeline);
+  memcpy(&write_address, buf, sizeof(write_address)); buf += sizeof(write_address);
+  memcpy(&sample_offset, buf, sizeof(sample_offset)); buf += sizeof(sample_offset);
+  memcpy(&sample_index, buf, sizeof(sample_index)); buf += sizeof(sample_index);
+  memcpy(&sample_prev, buf, sizeof(sample_prev)); buf += sizeof(sample_prev);
+  memcpy(&sample_now, buf, sizeof(sample_now)); buf += sizeof(sample_now);
+
+  if (sample) {
+    const short* ring = (const short*)buf;
+    for (int i = 0; i <= fir_N; i++) {
+      int j = (sample_index - fir_N - 1 + i) & RINGMASK;
+      sample[j] = sample[j + RINGSIZE] = ring[i];
+    }
+  }
+}
+
+
 // ----------------------------------------------------------------------------
 // Mask for voices routed into the filter / audio output stage.
 // Used to physically connect/disconnect EXT IN, and for test purposed
@@ -730,6 +806,8 @@ void SID::clock(cycle_count delta_t)
 //   bufindex = 0;
 // }
 // 
+// With a NULL buf the chip and the resampler are clocked exactly as when
+// sampling and the samples are counted, but no output is computed.
 // ----------------------------------------------------------------------------
 int SID::clock(cycle_count& delta_t, short* buf, int n, int interleave)
 {
@@ -771,7 +849,9 @@ int SID::clock_fast(cycle_count& delta_t, short* buf, int n,
     }
 
     sample_offset = (next_sample_offset & FIXP_MASK) - (1 << (FIXP_SHIFT - 1));
-    buf[s*interleave] = output();
+    if (buf) {
+      buf[s*interleave] = output();
+    }
   }
 
   return s;
@@ -815,8 +895,10 @@ int SID::clock_interpolate(cycle_count& delta_t, short* buf, int n,
 
     sample_offset = next_sample_offset & FIXP_MASK;
 
-    buf[s*interleave] =
-      sample_prev + (sample_offset*(sample_now - sample_prev) >> FIXP_SHIFT);
+    if (buf) {
+      buf[s*interleave] =
+        sample_prev + (sample_offset*(sample_now - sample_prev) >> FIXP_SHIFT);
+    }
   }
 
   return s;
@@ -885,6 +967,10 @@ int SID::clock_resample(cycle_count& delta_t, short* buf, int n,
 
     sample_offset = next_sample_offset & FIXP_MASK;
 
+    if (!buf) {
+      continue;
+    }
+
     int fir_offset = sample_offset*fir_RES >> FIXP_SHIFT;
     int fir_offset_rmd = sample_offset*fir_RES & FIXP_MASK;
     short* fir_start = fir + fir_offset*fir_N;
@@ -962,6 +1048,10 @@ int SID::clock_resample_fastmem(cycle_count& delta_t, short* buf, int n,
 
     sample_offset = next_sample_offset & FIXP_MASK;
 
+    if (!buf) {
+      continue;
+    }
+
     int fir_offset = sample_offset*fir_RES >> FIXP_SHIFT;
     short* fir_start = fir + fir_offset*fir_N;
     short* sample_start = sample + sample_index - fir_N + RINGSIZE;
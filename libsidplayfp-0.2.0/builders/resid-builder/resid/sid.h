@@ -88,6 +88,14 @@ public:
   State read_state();
   void write_state(const State& state);
 
+  // Complete snapshot, including the filter integrators, the external
+  // filter and the resampler history which are not part of State.
+  // A snapshot can only be restored into the SID it was taken from, with
+  // the same chip model and sampling parameters.
+  int snapshot_size();
+  void save_snapshot(char* buf);
+  void load_snapshot(const char* buf);
+
   // 16-bit input (EXT IN).
   void input(short sample);
 
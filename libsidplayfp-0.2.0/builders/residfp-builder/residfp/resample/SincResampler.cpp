@@ -32,13 +32,111 @@
 #include <assert.h>
 #include <string.h>
 
-#ifdef HAVE_MMINTRIN_H
-#  include <mmintrin.h>
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#  define RESIDFP_X86_SIMD
+#  include <immintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#  define RESIDFP_NEON_SIMD
+#  include <arm_neon.h>
 #endif
 
 namespace reSIDfp
 {
 
+/*
+ * Dot product kernels for convolve(). They return the raw sum, the
+ * rounding is left to the caller. All of them give the same result
+ * as the scalar version; the sample ring and the FIR rows have no
+ * particular alignment so unaligned loads are used throughout.
+ */
+typedef int (*ConvolveKernel)(const short* a, const short* b, const int bLength);
+
+static int convolveScalar(const short* a, const short* b, const int bLength) {
+	int out = 0;
+	for (int i = 0; i < bLength; i++) {
+		out += *a++ * *b++;
+	}
+	return out;
+}
+
+#ifdef RESIDFP_X86_SIMD
+__attribute__((target("sse2")))
+static int convolveSSE2(const short* a, const short* b, const int bLength) {
+	__m128i acc = _mm_setzero_si128();
+
+	const int n = bLength / 8;
+	for (int i = 0; i < n; i++) {
+		const __m128i va = _mm_loadu_si128((const __m128i*) a);
+		const __m128i vb = _mm_loadu_si128((const __m128i*) b);
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(va, vb));
+		a += 8;
+		b += 8;
+	}
+	acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+	acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+
+	return _mm_cvtsi128_si32(acc) + convolveScalar(a, b, bLength & 7);
+}
+
+__attribute__((target("avx2")))
+static int convolveAVX2(const short* a, const short* b, const int bLength) {
+	__m256i acc = _mm256_setzero_si256();
+
+	const int n = bLength / 16;
+	for (int i = 0; i < n; i++) {
+		const __m256i va = _mm256_loadu_si256((const __m256i*) a);
+		const __m256i vb = _mm256_loadu_si256((const __m256i*) b);
+		acc = _mm256_add_epi32(acc, _mm256_madd_epi16(va, vb));
+		a += 16;
+		b += 16;
+	}
+	__m128i sum = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+
+	return _mm_cvtsi128_si32(sum) + convolveScalar(a, b, bLength & 15);
+}
+#endif
+
+#ifdef RESIDFP_NEON_SIMD
+static int convolveNEON(const short* a, const short* b, const int bLength) {
+	int32x4_t acc = vdupq_n_s32(0);
+
+	const int n = bLength / 8;
+	for (int i = 0; i < n; i++) {
+		const int16x8_t va = vld1q_s16(a);
+		const int16x8_t vb = vld1q_s16(b);
+		acc = vmlal_s16(acc, vget_low_s16(va), vget_low_s16(vb));
+		acc = vmlal_s16(acc, vget_high_s16(va), vget_high_s16(vb));
+		a += 8;
+		b += 8;
+	}
+	int32x2_t sum = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+	sum = vpadd_s32(sum, sum);
+
+	return vget_lane_s32(sum, 0) + convolveScalar(a, b, bLength & 7);
+}
+#endif
+
+/*
+ * Pick the widest kernel the CPU runs. NEON is part of every ARM
+ * target we build for, x86 is probed at runtime.
+ */
+static ConvolveKernel selectConvolveKernel() {
+#if defined(RESIDFP_X86_SIMD)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return convolveAVX2;
+	if (__builtin_cpu_supports("sse2"))
+		return convolveSSE2;
+#elif defined(RESIDFP_NEON_SIMD)
+	return convolveNEON;
+#endif
+	return convolveScalar;
+}
+
+static const ConvolveKernel convolveKernel = selectConvolveKernel();
+
 std::map<std::string, array<short> > SincResampler::FIR_CACHE;
 
 const float SincResampler::I0E = 1e-6;
@@ -58,29 +156,7 @@ float SincResampler::I0(const float x) {
 }
 
 int SincResampler::convolve(const short* a, const short* b, const int bLength) {
-#ifdef HAVE_MMINTRIN_H
-	__m64 acc = _mm_setzero_si64();
-
-	const int n = bLength/4;
-	for (int i=0; i < n; i++) {
-		const __m64 tmp = _mm_madd_pi16(*(__m64*)a, *(__m64*)b);
-		acc = _mm_add_pi16(acc, tmp);
-		a+=4;
-		b+=4;
-	}
-	int out = _mm_cvtsi64_si32(acc)+_mm_cvtsi64_si32(_mm_srli_si64(acc, 32));
-	_mm_empty();
-
-	const int m = bLength & 3;
-	for (int i=0; i < m; i++) {
-		out += *a++ * *b++;
-	}
-#else
-	int out = 0;
-	for (int i = 0; i < bLength; i++) {
-		out += *a++ * *b++;
-	}
-#endif
+	const int out = convolveKernel(a, b, bLength);
 	return (out + (1 << 14)) >> 15;
 }
 
@@ -60,6 +60,24 @@ public:
         lp = 0x10;
         MOS6526::reset ();
     }
+
+    // Seeking support
+    struct State: public MOS6526::State
+    {
+        uint8_t lp;
+    };
+
+    void saveState (State &state) const
+    {
+        MOS6526::saveState (state);
+        state.lp = lp;
+    }
+
+    void loadState (const State &state)
+    {
+        MOS6526::loadState (state);
+        lp = state.lp;
+    }
 };
 
 /* CIA 2 specifics:
@@ -95,6 +95,21 @@ public:
         const sampling_method_t method, const bool fast) {
         m_sid->sampling(systemclock, freq, method, fast);
     }
+    void silent(bool enable) {
+        m_sid->silent(enable);
+    }
+    int stateSize(void) {
+        return m_sid->stateSize();
+    }
+    void saveState(uint8_t *state) {
+        m_sid->saveState(state);
+    }
+    void loadState(const uint8_t *state) {
+        m_sid->loadState(state);
+    }
+    // The xSID channels themselves
+    using XSID::saveState;
+    using XSID::loadState;
 
     // Xsid specific
     void emulation (sidemu *sid) {
@@ -169,6 +169,9 @@ int Player::config (const sid2_config_t &cfg)
         goto Player_configure_error;
     }
 
+    // Snapshots depend on the configuration
+    keyframesClear ();
+
     // Check for base sampling frequency
     if (cfg.frequency < 4000)
     {   // Rev 1.6 (saw) - Added descriptive error
@@ -198,6 +201,7 @@ int Player::config (const sid2_config_t &cfg)
             // Determine clock speed
             cpuFreq = clockSpeed (cfg.clockSpeed, cfg.clockDefault,
                                   cfg.clockForced);
+            m_cpuFreq = cpuFreq;
             // Setup fake cia
             sid6526.clock ((uint_least16_t)(cpuFreq / VIC_FREQ_PAL + 0.5));
             if (m_tuneInfo.songSpeed  == SIDTUNE_SPEED_CIA_1A ||
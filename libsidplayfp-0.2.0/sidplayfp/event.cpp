@@ -100,6 +100,51 @@ void EventScheduler::reset (void)
     event ();
 }
 
+// Events belong to the components, so they are saved by
+// address.  The state is only valid for the same machine.
+void EventScheduler::saveState (State &state) const
+{
+    state.clk          = m_clk;
+    state.events       = m_events;
+    state.eventsFuture = m_events_future;
+    state.count        = 0;
+    for (Event *e = m_next; e != this; e = e->m_next)
+    {
+        if (state.count == EVENT_CONTEXT_MAX_PENDING_EVENTS)
+            break;
+        state.event[state.count]    = e;
+        state.eventClk[state.count] = e->m_clk;
+        state.count++;
+    }
+}
+
+void EventScheduler::loadState (const State &state)
+{   // Drop the pending events, then relink the saved ones
+    Event *e = m_next;
+    while (e->m_pending)
+    {
+        e->m_pending = false;
+        e = e->m_next;
+    }
+
+    Event *prev = this;
+    for (uint i = 0; i < state.count; i++)
+    {
+        e            = state.event[i];
+        e->m_clk     = state.eventClk[i];
+        e->m_pending = true;
+        e->m_context = this;
+        e->m_prev    = prev;
+        prev->m_next = e;
+        prev         = e;
+    }
+    prev->m_next    = this;
+    m_prev          = prev;
+    m_clk           = state.clk;
+    m_events        = state.events;
+    m_events_future = state.eventsFuture;
+}
+
 // Add event to ordered pending queue
 void EventScheduler::schedule (Event &event, event_clock_t cycles,
                                event_phase_t phase)
@@ -106,9 +106,23 @@ protected:
         m_events--;
     }
 
+public:
+    // Seeking support: the clock and the pending events, in order
+    struct State
+    {
+        event_clock_t clk;
+        uint          events;
+        uint          eventsFuture;
+        uint          count;
+        Event        *event[EVENT_CONTEXT_MAX_PENDING_EVENTS];
+        event_clock_t eventClk[EVENT_CONTEXT_MAX_PENDING_EVENTS];
+    };
+
 public:
     EventScheduler (const char * const name);
     void reset     (void);
+    void saveState (State &state) const;
+    void loadState (const State &state);
 
     void clock (void)
     {
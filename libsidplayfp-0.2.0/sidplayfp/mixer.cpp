@@ -64,9 +64,23 @@ SIDPLAY2_NAMESPACE_START
 
 void Player::mixerReset (void)
 {
+    m_samplePos = 0;
     m_mixerEvent.schedule(context(), MIXER_EVENT_RATE, EVENT_CLOCK_PHI1);
 }
 
+uint_least32_t Player::msToSamples (uint_least32_t ms) const
+{
+    return (uint_least32_t) ((float64_t) ms * m_cfg.frequency / 1000.0);
+}
+
+/* when seeking, the SIDs stop only counting their samples this many
+ * samples (two mixer events) before the target. */
+uint_least32_t Player::seekMargin (void) const
+{
+    return (uint_least32_t) (2.0 * MIXER_EVENT_RATE * m_cfg.frequency / m_cpuFreq)
+         + 2 * m_fastForwardFactor;
+}
+
 void Player::mixer (void)
 {
     short *buf = m_sampleBuffer + m_sampleIndex;
@@ -84,16 +98,39 @@ void Player::mixer (void)
     int samples = chip1->bufferpos();
     /* NB: if chip2 exists, its bufferpos is identical to chip1's. */
 
+    if (m_seek.silent) {
+        /* seeking: the SIDs only counted their samples, skip them all. */
+        m_samplePos += samples;
+        chip1->bufferpos(0);
+        if (buf2 != NULL)
+            chip2->bufferpos(0);
+        if (m_samplePos >= m_seek.stop)
+            m_running = false;
+        m_mixerEvent.schedule(context(), MIXER_EVENT_RATE, EVENT_CLOCK_PHI1);
+        return;
+    }
+
     int i = 0;
     while (i < samples) {
         /* Handle whatever output the sid has generated so far */
-        if (m_sampleIndex >= m_sampleCount) {
+        if (m_sampleBuffer == NULL) {
+            /* seeking: drop the samples up to the target. */
+            if (m_samplePos >= m_seek.stop) {
+                m_running = false;
+                break;
+            }
+        } else if (m_sampleIndex >= m_sampleCount) {
             m_running = false;
             break;
         }
         /* Are there enough samples to generate the next one? */
         if (i + m_fastForwardFactor >= samples)
             break;
+        if (m_sampleBuffer == NULL) {
+            i += m_fastForwardFactor;
+            m_samplePos += m_fastForwardFactor;
+            continue;
+        }
 
         /* This is a crude boxcar low-pass filter to
          * reduce aliasing during fast forward, something I commonly do. */
@@ -107,6 +144,7 @@ void Player::mixer (void)
         }
         /* increment i to mark we ate some samples, finish the boxcar thing. */
         i += j;
+        m_samplePos += j;
         sample1 = sample1 * m_leftVolume / VOLUME_MAX;
         sample1 /= j;
         sample2 = sample2 * m_rightVolume / VOLUME_MAX;
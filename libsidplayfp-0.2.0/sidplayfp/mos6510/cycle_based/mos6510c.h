@@ -323,9 +323,51 @@ protected:
     inline void Perform_ADC   (void);
     inline void Perform_SBC   (void);
 
+public:
+    // Seeking support: registers and position in the current
+    // instruction.  Debug output isn't part of the state.
+    struct State
+    {
+        bool           aec;
+        bool           blocked;
+        event_clock_t  stealingClk;
+
+        struct ProcessorCycle      *procCycle;
+        struct ProcessorOperations *instrCurrent;
+        uint_least16_t instrStartPC;
+        uint_least8_t  instrOpcode;
+        int_least8_t   lastAddrCycle;
+        int_least8_t   cycleCount;
+
+        uint_least16_t Cycle_EffectiveAddress;
+        uint8_t        Cycle_Data;
+        uint_least16_t Cycle_Pointer;
+
+        uint8_t        Register_Accumulator;
+        uint8_t        Register_X;
+        uint8_t        Register_Y;
+        uint_least32_t Register_ProgramCounter;
+        uint8_t        Register_Status;
+        uint_least8_t  Register_c_Flag;
+        uint_least8_t  Register_n_Flag;
+        uint_least8_t  Register_v_Flag;
+        uint_least8_t  Register_z_Flag;
+        uint_least16_t Register_StackPointer;
+        uint_least16_t Instr_Operand;
+
+        uint_least8_t  pending;
+        uint_least8_t  irqs;
+        event_clock_t  nmiClk;
+        event_clock_t  irqClk;
+        bool           irqRequest;
+        bool           irqLatch;
+    };
+
 public:
     MOS6510 (EventContext *context);
     virtual ~MOS6510 ();
+    void         saveState (State &state) const;
+    void         loadState (const State &state);
     virtual void reset     (void);
     virtual void credits   (char *str);
     virtual void DumpState (void);
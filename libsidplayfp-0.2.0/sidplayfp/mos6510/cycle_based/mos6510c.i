@@ -2490,6 +2490,82 @@ void MOS6510::reset (void)
 //    filepos = 0;
 }
 
+//-------------------------------------------------------------------------//
+// Save/Restore CPU State (Seeking)                                        //
+void MOS6510::saveState (State &state) const
+{
+    state.aec                     = aec;
+    state.blocked                 = m_blocked;
+    state.stealingClk             = m_stealingClk;
+
+    state.procCycle               = procCycle;
+    state.instrCurrent            = instrCurrent;
+    state.instrStartPC            = instrStartPC;
+    state.instrOpcode             = instrOpcode;
+    state.lastAddrCycle           = lastAddrCycle;
+    state.cycleCount              = cycleCount;
+
+    state.Cycle_EffectiveAddress  = Cycle_EffectiveAddress;
+    state.Cycle_Data              = Cycle_Data;
+    state.Cycle_Pointer           = Cycle_Pointer;
+
+    state.Register_Accumulator    = Register_Accumulator;
+    state.Register_X              = Register_X;
+    state.Register_Y              = Register_Y;
+    state.Register_ProgramCounter = Register_ProgramCounter;
+    state.Register_Status         = Register_Status;
+    state.Register_c_Flag         = Register_c_Flag;
+    state.Register_n_Flag         = Register_n_Flag;
+    state.Register_v_Flag         = Register_v_Flag;
+    state.Register_z_Flag         = Register_z_Flag;
+    state.Register_StackPointer   = Register_StackPointer;
+    state.Instr_Operand           = Instr_Operand;
+
+    state.pending                 = interrupts.pending;
+    state.irqs                    = interrupts.irqs;
+    state.nmiClk                  = interrupts.nmiClk;
+    state.irqClk                  = interrupts.irqClk;
+    state.irqRequest              = interrupts.irqRequest;
+    state.irqLatch                = interrupts.irqLatch;
+}
+
+void MOS6510::loadState (const State &state)
+{
+    aec                     = state.aec;
+    m_blocked               = state.blocked;
+    m_stealingClk           = state.stealingClk;
+
+    procCycle               = state.procCycle;
+    instrCurrent            = state.instrCurrent;
+    instrStartPC            = state.instrStartPC;
+    instrOpcode             = state.instrOpcode;
+    lastAddrCycle           = state.lastAddrCycle;
+    cycleCount              = state.cycleCount;
+
+    Cycle_EffectiveAddress  = state.Cycle_EffectiveAddress;
+    Cycle_Data              = state.Cycle_Data;
+    Cycle_Pointer           = state.Cycle_Pointer;
+
+    Register_Accumulator    = state.Register_Accumulator;
+    Register_X              = state.Register_X;
+    Register_Y              = state.Register_Y;
+    Register_ProgramCounter = state.Register_ProgramCounter;
+    Register_Status         = state.Register_Status;
+    Register_c_Flag         = state.Register_c_Flag;
+    Register_n_Flag         = state.Register_n_Flag;
+    Register_v_Flag         = state.Register_v_Flag;
+    Register_z_Flag         = state.Register_z_Flag;
+    Register_StackPointer   = state.Register_StackPointer;
+    Instr_Operand           = state.Instr_Operand;
+
+    interrupts.pending      = state.pending;
+    interrupts.irqs         = state.irqs;
+    interrupts.nmiClk       = state.nmiClk;
+    interrupts.irqClk       = state.irqClk;
+    interrupts.irqRequest   = state.irqRequest;
+    interrupts.irqLatch     = state.irqLatch;
+}
+
 //-------------------------------------------------------------------------//
 // Module Credits                                                          //
 void MOS6510::credits (char *sbuffer)
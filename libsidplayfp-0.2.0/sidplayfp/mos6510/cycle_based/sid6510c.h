@@ -96,8 +96,20 @@ private:
     event_clock_t m_delayClk;
     bool          m_framelock;
 
+public:
+    // Seeking support
+    struct State: public MOS6510::State
+    {
+        bool          sleeping;
+        sid2_env_t    mode;
+        event_clock_t delayClk;
+        bool          framelock;
+    };
+
 public:
     SID6510 (EventContext *context);
+    void saveState (State &state) const;
+    void loadState (const State &state);
 
     // Standard Functions
     void reset (void);
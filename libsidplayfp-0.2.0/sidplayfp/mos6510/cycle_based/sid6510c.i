@@ -245,6 +245,24 @@ void SID6510::reset ()
     MOS6510::reset ();
 }
 
+void SID6510::saveState (State &state) const
+{
+    MOS6510::saveState (state);
+    state.sleeping  = m_sleeping;
+    state.mode      = m_mode;
+    state.delayClk  = m_delayClk;
+    state.framelock = m_framelock;
+}
+
+void SID6510::loadState (const State &state)
+{
+    MOS6510::loadState (state);
+    m_sleeping  = state.sleeping;
+    m_mode      = state.mode;
+    m_delayClk  = state.delayClk;
+    m_framelock = state.framelock;
+}
+
 // Send CPU is about to sleep.  Only a reset or
 // interrupt will wake up the processor
 void SID6510::sleep ()
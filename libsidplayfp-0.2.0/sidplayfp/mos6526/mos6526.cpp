@@ -349,6 +349,65 @@ void MOS6526::reset (void)
     m_todEvent.schedule (event_context, 0, m_phase);
 }
 
+// The timer events are part of the scheduler state
+void MOS6526::saveState (State &state) const
+{
+    memcpy (state.regs, regs, sizeof (regs));
+    state.cnt_high     = cnt_high;
+    state.ta_pulse     = ta_pulse;
+    state.tb_pulse     = tb_pulse;
+    state.cra          = cra;
+    state.crb          = crb;
+    state.ta           = ta;
+    state.ta_latch     = ta_latch;
+    state.tb           = tb;
+    state.tb_latch     = tb_latch;
+    state.ta_underflow = ta_underflow;
+    state.tb_underflow = tb_underflow;
+    state.sdr_out      = sdr_out;
+    state.sdr_buffered = sdr_buffered;
+    state.sdr_count    = sdr_count;
+    state.icr          = icr;
+    state.idr          = idr;
+    state.accessClk    = m_accessClk;
+    state.todlatched   = m_todlatched;
+    state.todstopped   = m_todstopped;
+    memcpy (state.todclock, m_todclock, sizeof (m_todclock));
+    memcpy (state.todalarm, m_todalarm, sizeof (m_todalarm));
+    memcpy (state.todlatch, m_todlatch, sizeof (m_todlatch));
+    state.todCycles    = m_todCycles;
+    state.todPeriod    = m_todPeriod;
+}
+
+void MOS6526::loadState (const State &state)
+{
+    memcpy (regs, state.regs, sizeof (regs));
+    cnt_high     = state.cnt_high;
+    ta_pulse     = state.ta_pulse;
+    tb_pulse     = state.tb_pulse;
+    cra          = state.cra;
+    crb          = state.crb;
+    ta           = state.ta;
+    ta_latch     = state.ta_latch;
+    tb           = state.tb;
+    tb_latch     = state.tb_latch;
+    ta_underflow = state.ta_underflow;
+    tb_underflow = state.tb_underflow;
+    sdr_out      = state.sdr_out;
+    sdr_buffered = state.sdr_buffered;
+    sdr_count    = state.sdr_count;
+    icr          = state.icr;
+    idr          = state.idr;
+    m_accessClk  = state.accessClk;
+    m_todlatched = state.todlatched;
+    m_todstopped = state.todstopped;
+    memcpy (m_todclock, state.todclock, sizeof (m_todclock));
+    memcpy (m_todalarm, state.todalarm, sizeof (m_todalarm));
+    memcpy (m_todlatch, state.todlatch, sizeof (m_todlatch));
+    m_todCycles  = state.todCycles;
+    m_todPeriod  = state.todPeriod;
+}
+
 uint8_t MOS6526::read (uint_least8_t addr)
 {
 addr &= 0x0f;
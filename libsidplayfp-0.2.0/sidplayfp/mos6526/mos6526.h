@@ -182,6 +182,28 @@ protected:
     virtual void portA () {}
     virtual void portB () {}
 
+public:
+    // Seeking support
+    struct State
+    {
+        uint8_t        regs[0x10];
+        bool           cnt_high, ta_pulse, tb_pulse;
+        uint8_t        cra, crb;
+        uint_least16_t ta, ta_latch, tb, tb_latch;
+        bool           ta_underflow, tb_underflow;
+        uint8_t        sdr_out;
+        bool           sdr_buffered;
+        int            sdr_count;
+        uint8_t        icr, idr;
+        event_clock_t  accessClk;
+        bool           todlatched, todstopped;
+        uint8_t        todclock[4], todalarm[4], todlatch[4];
+        event_clock_t  todCycles, todPeriod;
+    };
+
+    void saveState (State &state) const;
+    void loadState (const State &state);
+
 public:
     // Component Standard Calls
     virtual void reset (void);
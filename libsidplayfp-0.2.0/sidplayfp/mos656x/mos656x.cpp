@@ -79,6 +79,51 @@ void MOS656X::reset ()
     schedule (event_context, 0, m_phase);
 }
 
+// The chip geometry comes from the configuration
+void MOS656X::saveState (State &state) const
+{
+    memcpy (state.regs, regs, sizeof (regs));
+    state.icr               = icr;
+    state.idr               = idr;
+    state.ctrl1             = ctrl1;
+    state.raster_irq        = raster_irq;
+    state.raster_x          = raster_x;
+    state.raster_y          = raster_y;
+    state.y_scroll          = y_scroll;
+    state.bad_lines_enabled = bad_lines_enabled;
+    state.bad_line          = bad_line;
+    state.vblanking         = vblanking;
+    state.lp_triggered      = lp_triggered;
+    state.lpx               = lpx;
+    state.lpy               = lpy;
+    state.sprite_dma        = sprite_dma;
+    state.sprite_expand_y   = sprite_expand_y;
+    memcpy (state.sprite_mc_base, sprite_mc_base, sizeof (sprite_mc_base));
+    state.rasterClk         = m_rasterClk;
+}
+
+void MOS656X::loadState (const State &state)
+{
+    memcpy (regs, state.regs, sizeof (regs));
+    icr               = state.icr;
+    idr               = state.idr;
+    ctrl1             = state.ctrl1;
+    raster_irq        = state.raster_irq;
+    raster_x          = state.raster_x;
+    raster_y          = state.raster_y;
+    y_scroll          = state.y_scroll;
+    bad_lines_enabled = state.bad_lines_enabled;
+    bad_line          = state.bad_line;
+    vblanking         = state.vblanking;
+    lp_triggered      = state.lp_triggered;
+    lpx               = state.lpx;
+    lpy               = state.lpy;
+    sprite_dma        = state.sprite_dma;
+    sprite_expand_y   = state.sprite_expand_y;
+    memcpy (sprite_mc_base, state.sprite_mc_base, sizeof (sprite_mc_base));
+    m_rasterClk       = state.rasterClk;
+}
+
 void MOS656X::chip (mos656x_model_t model)
 {
     switch (model)
@@ -61,6 +61,25 @@ protected:
     virtual void interrupt (bool state) = 0;
     virtual void addrctrl  (bool state) = 0;
 
+public:
+    // Seeking support
+    struct State
+    {
+        uint8_t        regs[0x40];
+        uint8_t        icr, idr, ctrl1;
+        uint_least16_t raster_irq, raster_x, raster_y, y_scroll;
+        bool           bad_lines_enabled, bad_line;
+        bool           vblanking;
+        bool           lp_triggered;
+        uint8_t        lpx, lpy;
+        uint8_t        sprite_dma, sprite_expand_y;
+        uint8_t        sprite_mc_base[8];
+        event_clock_t  rasterClk;
+    };
+
+    void    saveState (State &state) const;
+    void    loadState (const State &state);
+
 public:
     void    chip  (mos656x_model_t model);
     void    lightpen ();
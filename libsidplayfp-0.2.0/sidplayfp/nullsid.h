@@ -36,6 +36,9 @@ public:
     // Standard SID functions
     void    clock() { return; }
     void    voice (uint_least8_t, bool) { ; }
+
+    // Nothing to snapshot
+    int     stateSize (void) { return 0; }
 };
 
 #endif // _nullsid_h_
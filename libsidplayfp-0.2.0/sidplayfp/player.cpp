@@ -379,13 +379,18 @@ Player::Player (void)
  m_running           (false),
  m_sid2crc           (0xffffffff),
  m_sid2crcCount      (0),
- m_sampleCount       (0)
+ m_sampleCount       (0),
+ m_samplePos         (0),
+ m_cpuFreq           (CLOCK_FREQ_PAL)
 {
     srand ((uint) ::time(NULL));
     m_rand = (uint_least32_t) rand ();
 
     // Set the ICs to use this environment
     cpu.setEnvironment (this);
+    m_seek.count  = 0;
+    m_seek.silent = false;
+    keyframesClear ();
 
     {
         // SID Initialise
@@ -449,6 +454,7 @@ Player::Player (void)
 
 Player::~Player ()
 {
+   keyframesClear ();
    if (m_ram == m_rom)
       delete [] m_ram;
    else
@@ -543,6 +549,7 @@ int Player::initialise ()
 
 int Player::load (SidTune *tune)
 {
+    keyframesClear ();
     m_tune = tune;
     if (!tune)
     {   // Unload tune
@@ -600,6 +607,10 @@ uint_least32_t Player::play (short *buffer, uint_least32_t count)
     if (!m_tune)
         return 0;
 
+    // Snapshot the player for seeking
+    if (m_samplePos >= m_seek.next)
+        keyframeAdd ();
+
     // Setup Sample Information
     m_sampleIndex  = 0;
     m_sampleCount  = count;
@@ -631,6 +642,243 @@ void Player::stop (void)
     }
 }
 
+// Seek to a position in ms.  The closest keyframe before the
+// target is restored (or the song restarted if there is none)
+// and the emulation is then run without output up to the exact
+// target sample.
+int Player::seek (uint_least32_t ms)
+{
+    if (!m_tune || m_running)
+        return -1;
+
+    uint_least32_t target = msToSamples (ms);
+    int best = -1;
+    for (int i = 0; i < m_seek.count; i++)
+    {
+        if (m_seek.keyframe[i].pos <= target)
+            best = i;
+    }
+
+    if (target < m_samplePos)
+    {   // Going backwards
+        if (best >= 0)
+            loadState (m_seek.keyframe[best].state);
+        else if (initialise () < 0)
+            return -1;
+    }
+    else if ((best >= 0) && (m_seek.keyframe[best].pos > m_samplePos))
+        loadState (m_seek.keyframe[best].state);
+
+    return skip (target);
+}
+
+int Player::skip (uint_least32_t target)
+{
+    const uint_least32_t margin = seekMargin ();
+
+    // A NULL sample buffer tells the mixer to drop the output
+    m_sampleIndex  = 0;
+    m_sampleCount  = 0;
+    m_sampleBuffer = NULL;
+    m_playerState  = sid2_playing;
+
+    while (m_samplePos < target)
+    {   // Leave keyframes behind for later seeks
+        if (m_samplePos >= m_seek.next)
+            keyframeAdd ();
+
+        // Far from the target the SIDs only count their samples,
+        // the last mixer events generate and drop them one by one
+        // so that playing resumes on the exact sample.
+        m_seek.silent = (target - m_samplePos > margin);
+        m_seek.stop   = target;
+        if (m_seek.silent)
+        {
+            m_seek.stop = target - margin;
+            if (m_seek.next < m_seek.stop)
+                m_seek.stop = m_seek.next;
+        }
+        for (int i = 0; i < SID2_MAX_SIDS; i++)
+            sid[i]->silent (m_seek.silent);
+
+        m_running = true;
+        while (m_running)
+            m_scheduler.clock ();
+        if (m_playerState != sid2_playing)
+            break;
+    }
+
+    m_seek.silent = false;
+    for (int i = 0; i < SID2_MAX_SIDS; i++)
+        sid[i]->silent (false);
+
+    if (m_playerState == sid2_stopped)
+    {
+        initialise ();
+        return -1;
+    }
+    return 0;
+}
+
+void Player::keyframeAdd (void)
+{
+    if (!m_seek.count)
+    {
+        m_seek.size     = stateSize ();
+        m_seek.interval = msToSamples (SID2_KEYFRAME_INTERVAL);
+        if (!m_seek.interval)
+            m_seek.interval = 1;
+    }
+
+    if (m_seek.size < 0)
+    {   // Emulation can't be snapshot, seeking restarts the song
+        m_seek.next = (uint_least32_t) -1;
+        return;
+    }
+
+    if (m_seek.count == SID2_MAX_KEYFRAMES)
+    {   // Keep every other keyframe and double the interval
+        int count = 0;
+        for (int i = 0; i < m_seek.count; i++)
+        {
+            if (i & 1)
+                delete [] m_seek.keyframe[i].state;
+            else
+                m_seek.keyframe[count++] = m_seek.keyframe[i];
+        }
+        m_seek.count     = count;
+        m_seek.interval *= 2;
+    }
+
+#ifdef HAVE_EXCEPTIONS
+    uint8_t *state = new(std::nothrow) uint8_t[m_seek.size];
+#else
+    uint8_t *state = new uint8_t[m_seek.size];
+#endif
+    if (!state)
+    {
+        m_seek.next = (uint_least32_t) -1;
+        return;
+    }
+
+    saveState (state);
+    m_seek.keyframe[m_seek.count].pos   = m_samplePos;
+    m_seek.keyframe[m_seek.count].state = state;
+    m_seek.count++;
+    m_seek.next = m_samplePos + m_seek.interval;
+}
+
+void Player::keyframesClear (void)
+{
+    for (int i = 0; i < m_seek.count; i++)
+        delete [] m_seek.keyframe[i].state;
+    m_seek.count    = 0;
+    m_seek.size     = 0;
+    m_seek.interval = 0;
+    m_seek.next     = 0;
+    m_seek.stop     = 0;
+}
+
+int Player::stateSize (void)
+{
+    int size = sizeof (State) + 0x10000;
+    if (m_rom != m_ram)
+        size += 0x10000;
+
+    for (int i = 0; i < SID2_MAX_SIDS; i++)
+    {
+        int sidSize = sid[i]->stateSize ();
+        if (sidSize < 0)
+            return -1;
+        size += sidSize;
+    }
+    return size;
+}
+
+// Only the emulation is saved: the configuration, the sample
+// buffer and the volume, mute and fast forward settings are
+// left as they are when a snapshot is restored.
+void Player::saveState (uint8_t *state)
+{
+    State s;
+    m_scheduler.saveState (s.scheduler);
+    cpu.saveState     (s.cpu);
+    xsid.saveState    (s.xsid);
+    cia.saveState     (s.cia);
+    cia2.saveState    (s.cia2);
+    sid6526.saveState (s.sid6526);
+    vic.saveState     (s.vic);
+    rtc.saveState     (s.rtc);
+    s.samplePos    = m_samplePos;
+    s.rand         = m_rand;
+    s.sid2crc      = m_sid2crc;
+    s.sid2crcCount = m_sid2crcCount;
+    s.pr_out       = m_port.pr_out;
+    s.ddr          = m_port.ddr;
+    s.pr_in        = m_port.pr_in;
+    s.playBank     = m_playBank;
+    s.isKernal     = isKernal;
+    s.isBasic      = isBasic;
+    s.isIO         = isIO;
+    s.isChar       = isChar;
+
+    memcpy (state, &s, sizeof (s));
+    state += sizeof (s);
+    memcpy (state, m_ram, 0x10000);
+    state += 0x10000;
+    if (m_rom != m_ram)
+    {
+        memcpy (state, m_rom, 0x10000);
+        state += 0x10000;
+    }
+
+    for (int i = 0; i < SID2_MAX_SIDS; i++)
+    {
+        sid[i]->saveState (state);
+        state += sid[i]->stateSize ();
+    }
+}
+
+void Player::loadState (const uint8_t *state)
+{
+    State s;
+    memcpy (&s, state, sizeof (s));
+    state += sizeof (s);
+    memcpy (m_ram, state, 0x10000);
+    state += 0x10000;
+    if (m_rom != m_ram)
+    {
+        memcpy (m_rom, state, 0x10000);
+        state += 0x10000;
+    }
+
+    for (int i = 0; i < SID2_MAX_SIDS; i++)
+    {
+        sid[i]->loadState (state);
+        state += sid[i]->stateSize ();
+    }
+
+    m_scheduler.loadState (s.scheduler);
+    cpu.loadState     (s.cpu);
+    xsid.loadState    (s.xsid);
+    cia.loadState     (s.cia);
+    cia2.loadState    (s.cia2);
+    sid6526.loadState (s.sid6526);
+    vic.loadState     (s.vic);
+    rtc.loadState     (s.rtc);
+    m_samplePos    = s.samplePos;
+    m_rand         = s.rand;
+    m_sid2crc      = s.sid2crc;
+    m_sid2crcCount = s.sid2crcCount;
+    m_port.pr_out  = s.pr_out;
+    m_port.ddr     = s.ddr;
+    m_port.pr_in   = s.pr_in;
+    m_playBank     = s.playBank;
+    isKernal       = s.isKernal;
+    isBasic        = s.isBasic;
+    isIO           = s.isIO;
+    isChar         = s.isChar;
+}
 
 //-------------------------------------------------------------------------
 // Temporary hack till real bank switching code added
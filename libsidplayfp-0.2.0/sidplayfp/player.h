@@ -210,6 +210,8 @@
 #define  SID2_MAX_SIDS 2
 #define  SID2_TIME_BASE 10
 #define  SID2_MAPPER_SIZE 32
+#define  SID2_MAX_KEYFRAMES 32
+#define  SID2_KEYFRAME_INTERVAL 5000 // ms
 
 SIDPLAY2_NAMESPACE_START
 
@@ -296,6 +298,28 @@ private:
             m_period = (event_clock_t) (period / 10.0 * (float64_t) (1 << 7));
             reset ();
         }   
+
+        // Seeking support
+        struct State
+        {
+            event_clock_t seconds;
+            event_clock_t period;
+            event_clock_t clk;
+        };
+
+        void saveState (State &state) const
+        {
+            state.seconds = m_seconds;
+            state.period  = m_period;
+            state.clk     = m_clk;
+        }
+
+        void loadState (const State &state)
+        {
+            m_seconds = state.seconds;
+            m_period  = state.period;
+            m_clk     = state.clk;
+        }
     } rtc;
 
     // User Configuration Settings
@@ -327,6 +351,28 @@ private:
     event_clock_t  m_rtcClock;
     event_clock_t  m_rtcPeriod;
 
+    // Seeking - chip samples mixed or skipped since the song
+    // started and snapshots of the player taken along the way
+    uint_least32_t m_samplePos;
+    float64_t      m_cpuFreq;
+
+    struct Keyframe
+    {
+        uint_least32_t pos;
+        uint8_t       *state;
+    };
+
+    struct SeekState
+    {
+        Keyframe       keyframe[SID2_MAX_KEYFRAMES];
+        int            count;
+        int            size;     // -1 when not supported
+        uint_least32_t interval; // In samples
+        uint_least32_t next;
+        uint_least32_t stop;     // Skipping stops here
+        bool           silent;   // SIDs only count their samples
+    } m_seek;
+
     // C64 environment settings
     struct
     {
@@ -337,6 +383,33 @@ private:
 
     uint8_t m_playBank;
 
+    // Snapshot of the machine, followed by the memory and the SIDs.
+    // Events are saved by address, so a snapshot is only valid
+    // until the player is reconfigured.
+    struct State
+    {
+        EventScheduler::State scheduler;
+        SID6510::State        cpu;
+        XSID::State           xsid;
+        c64cia1::State        cia;
+        MOS6526::State        cia2;
+        SID6526::State        sid6526;
+        MOS656X::State        vic;
+        EventRTC::State       rtc;
+        uint_least32_t        samplePos;
+        int                   rand;
+        uint_least32_t        sid2crc;
+        uint_least32_t        sid2crcCount;
+        uint8_t               pr_out;
+        uint8_t               ddr;
+        uint8_t               pr_in;
+        uint8_t               playBank;
+        bool                  isKernal;
+        bool                  isBasic;
+        bool                  isIO;
+        bool                  isChar;
+    };
+
     // temp stuff -------------
     bool   isKernal;
     bool   isBasic;
@@ -356,6 +429,14 @@ private:
     void      mixer          (void);
     void      mixerReset     (void);
     void      mileageCorrect (void);
+    uint_least32_t msToSamples (uint_least32_t ms) const;
+    uint_least32_t seekMargin (void) const;
+    int       skip           (uint_least32_t ticks);
+    void      keyframeAdd    (void);
+    void      keyframesClear (void);
+    int       stateSize      (void);
+    void      saveState      (uint8_t *state);
+    void      loadState      (const uint8_t *state);
     int       sidCreate      (sidbuilder *builder, sid2_model_t model,
                               sid2_model_t defaultModel);
     void      sidSamples     (bool enable);
@@ -430,6 +511,7 @@ public:
     uint_least32_t mileage      (void) const { return m_mileage + time(); }
     void           pause        (void);
     uint_least32_t play         (short *buffer, uint_least32_t samples);
+    int            seek         (uint_least32_t ms);
     sid2_player_t  state        (void) const { return m_playerState; }
     void           stop         (void);
     uint_least32_t time         (void) const {return rtc.getTime (); }
@@ -71,6 +71,7 @@
  *
  ***************************************************************************/
 
+#include <string.h>
 #include <time.h>
 #if defined(HAVE_CONFIG_H) || defined(_WIN32)
 #  include "config.h"
@@ -111,6 +112,28 @@ void SID6526::reset (bool seed)
     cancel ();
 }
 
+void SID6526::saveState (State &state) const
+{
+    state.accessClk = m_accessClk;
+    memcpy (state.regs, regs, sizeof (regs));
+    state.cra       = cra;
+    state.ta_latch  = ta_latch;
+    state.ta        = ta;
+    state.rnd       = rnd;
+    state.locked    = locked;
+}
+
+void SID6526::loadState (const State &state)
+{
+    m_accessClk = state.accessClk;
+    memcpy (regs, state.regs, sizeof (regs));
+    cra         = state.cra;
+    ta_latch    = state.ta_latch;
+    ta          = state.ta;
+    rnd         = state.rnd;
+    locked      = state.locked;
+}
+
 uint8_t SID6526::read (uint_least8_t addr)
 {
     if (addr > 0x0f)
@@ -63,8 +63,23 @@ private:
     uint_least16_t m_count;
     bool locked; // Prevent code changing CIA.
 
+public:
+    // Seeking support
+    struct State
+    {
+        event_clock_t  accessClk;
+        uint8_t        regs[0x10];
+        uint8_t        cra;
+        uint_least16_t ta_latch;
+        uint_least16_t ta;
+        uint_least32_t rnd;
+        bool           locked;
+    };
+
 public:
     SID6526 (c64env *env);
+    void    saveState (State &state) const;
+    void    loadState (const State &state);
 
     //Common:
     void    reset (void) { reset (false); }
@@ -57,6 +57,15 @@ public:
 
     virtual void sampling(float systemfreq, float outputfreq,
     const sampling_method_t method, const bool fast) { return; }
+
+    // Seeking support.  When silent the emulation is clocked exactly
+    // as when sampling and bufferpos() still counts the samples, but
+    // their data isn't computed.  stateSize() returns -1 if snapshots
+    // of the chip are not supported.
+    virtual void silent    (bool enable) { return; }
+    virtual int  stateSize (void) { return -1; }
+    virtual void saveState (uint8_t *state) { return; }
+    virtual void loadState (const uint8_t *state) { return; }
 };
 
 class sidbuilder
@@ -122,6 +122,9 @@ void sidplay2::pause (void)
 uint_least32_t sidplay2::play (short *buffer, uint_least32_t count)
 {   return sidplayer.play (buffer, count); }
 
+int sidplay2::seek (uint_least32_t ms)
+{   return sidplayer.seek (ms); }
+
 int sidplay2::load (SidTune *tune)
 {   return sidplayer.load (tune); }
 
@@ -51,6 +51,7 @@ public:
     int            load         (SidTune *tune);
     void           pause        (void);
     uint_least32_t play         (short *buffer, uint_least32_t count);
+    int            seek         (uint_least32_t ms);
     sid2_player_t  state        (void) const;
     void           stop         (void);
     void           debug        (bool enable, FILE *out);
@@ -139,6 +139,56 @@ void channel::reset ()
     m_galwayEvent.cancel ();
 }
 
+void channel::saveState (State &state) const
+{
+    memcpy (state.reg, reg, sizeof (reg));
+    state.mode          = mode;
+    state.active        = active;
+    state.address       = address;
+    state.cycleCount    = cycleCount;
+    state.volShift      = volShift;
+    state.sampleLimit   = sampleLimit;
+    state.sample        = sample;
+    state.samRepeat     = samRepeat;
+    state.samScale      = samScale;
+    state.samOrder      = samOrder;
+    state.samNibble     = samNibble;
+    state.samEndAddr    = samEndAddr;
+    state.samRepeatAddr = samRepeatAddr;
+    state.samPeriod     = samPeriod;
+    state.galTones      = galTones;
+    state.galInitLength = galInitLength;
+    state.galLength     = galLength;
+    state.galVolume     = galVolume;
+    state.galLoopWait   = galLoopWait;
+    state.galNullWait   = galNullWait;
+}
+
+void channel::loadState (const State &state)
+{
+    memcpy (reg, state.reg, sizeof (reg));
+    mode          = state.mode;
+    active        = state.active;
+    address       = state.address;
+    cycleCount    = state.cycleCount;
+    volShift      = state.volShift;
+    sampleLimit   = state.sampleLimit;
+    sample        = state.sample;
+    samRepeat     = state.samRepeat;
+    samScale      = state.samScale;
+    samOrder      = state.samOrder;
+    samNibble     = state.samNibble;
+    samEndAddr    = state.samEndAddr;
+    samRepeatAddr = state.samRepeatAddr;
+    samPeriod     = state.samPeriod;
+    galTones      = state.galTones;
+    galInitLength = state.galInitLength;
+    galLength     = state.galLength;
+    galVolume     = state.galVolume;
+    galLoopWait   = state.galLoopWait;
+    galNullWait   = state.galNullWait;
+}
+
 void channel::free ()
 {
     active      = false;
@@ -451,6 +501,26 @@ void XSID::reset (uint8_t)
     wasRunning = false;
 }
 
+void XSID::saveState (State &state) const
+{
+    ch4.saveState (state.ch4);
+    ch5.saveState (state.ch5);
+    state.suppressed   = suppressed;
+    state.sidData0x18  = sidData0x18;
+    state.sampleOffset = sampleOffset;
+    state.wasRunning   = wasRunning;
+}
+
+void XSID::loadState (const State &state)
+{
+    ch4.loadState (state.ch4);
+    ch5.loadState (state.ch5);
+    suppressed   = state.suppressed;
+    sidData0x18  = state.sidData0x18;
+    sampleOffset = state.sampleOffset;
+    wasRunning   = state.wasRunning;
+}
+
 void XSID::event (void)
 {
     if (ch4 || ch5)
@@ -140,7 +140,7 @@ private:
     EventCallback<channel> m_galwayEvent;
 
     uint8_t  reg[0x10];
-    enum    {FM_NONE = 0, FM_HUELS, FM_GALWAY} mode;
+    enum     fm_mode_t {FM_NONE = 0, FM_HUELS, FM_GALWAY} mode;
     bool     active;
     uint_least16_t address;
     uint_least16_t cycleCount; // Counts to zero and triggers!
@@ -170,8 +170,36 @@ private:
     event_clock_t cycles;
     event_clock_t outputs;
 
+    // Seeking support
+    struct State
+    {
+        uint8_t        reg[0x10];
+        fm_mode_t      mode;
+        bool           active;
+        uint_least16_t address;
+        uint_least16_t cycleCount;
+        uint_least8_t  volShift;
+        uint_least8_t  sampleLimit;
+        int8_t         sample;
+        uint_least8_t  samRepeat;
+        uint_least8_t  samScale;
+        uint_least8_t  samOrder;
+        uint_least8_t  samNibble;
+        uint_least16_t samEndAddr;
+        uint_least16_t samRepeatAddr;
+        uint_least16_t samPeriod;
+        uint_least8_t  galTones;
+        uint_least8_t  galInitLength;
+        uint_least8_t  galLength;
+        uint_least8_t  galVolume;
+        uint_least8_t  galLoopWait;
+        uint_least8_t  galNullWait;
+    };
+
 private:
     channel (const char * const name, EventContext *context, XSID *xsid);
+    void saveState   (State &state) const;
+    void loadState   (const State &state);
     void free        (void);
     void silence     (void);
     void sampleInit  (void);
@@ -231,8 +259,22 @@ private:
     virtual uint8_t readMemByte  (uint_least16_t addr) = 0;
     virtual void    writeMemByte (uint8_t data) = 0;
 
+public:
+    // Seeking support, the muting is left to the user
+    struct State
+    {
+        channel::State ch4;
+        channel::State ch5;
+        bool           suppressed;
+        uint8_t        sidData0x18;
+        int8_t         sampleOffset;
+        bool           wasRunning;
+    };
+
 public:
     XSID (EventContext *context);
+    void    saveState (State &state) const;
+    void    loadState (const State &state);
 
     // Standard calls
     void    reset () { sidemu::reset (); }
@@ -58,6 +58,33 @@ struct InstrumentCache
 };
 static struct InstrumentCache *instrument_cache[INSTRUMENT_HASH_SIZE];
 
+/* Decoded instruments kept across songs.  The in-song cache above is
+   flushed by free_instruments(); this one keeps the master copy of each
+   instrument (which owns the sample data) and hands out copies whose
+   samples point to the same data with data_alloced cleared.  Entries are
+   only evicted from free_instruments(), when no copy is in use anymore. */
+struct PersistentInstrument
+{
+    char *key;
+    Instrument *ip;
+    int32 size;
+    uint32 last_used;
+    struct PersistentInstrument *next;
+};
+static struct PersistentInstrument *persistent_cache;
+static int32 persistent_cache_used;
+static uint32 persistent_cache_clock;
+/* settings the decoded data depends on, the cache is flushed when they change */
+struct PersistentCacheSettings
+{
+    int32 rate, control_ratio;
+    int antialiasing, fast_decay, surround_chorus, reverb_control,
+	modulation_envelope, resampler;
+    int32 modify_release;
+};
+static struct PersistentCacheSettings persistent_cache_settings;
+int32 instrument_cache_size = 64 * 1024 * 1024;
+
 /* Some functions get aggravated if not even the standard banks are
    available. */
 static ToneBank standard_tonebank, standard_drumset;
@@ -299,6 +326,131 @@ static void store_instrument_cache(Instrument *ip,
     p->ip = ip;
 }
 
+static void current_persistent_cache_settings(struct PersistentCacheSettings *st)
+{
+    memset(st, 0, sizeof(*st));
+    st->rate = play_mode->rate;
+    st->control_ratio = control_ratio;
+    st->antialiasing = antialiasing_allowed;
+    st->fast_decay = fast_decay;
+    st->surround_chorus = opt_surround_chorus;
+    st->reverb_control = opt_reverb_control;
+    st->modulation_envelope = opt_modulation_envelope;
+    st->resampler = get_current_resampler();
+    st->modify_release = modify_release;
+}
+
+static void free_persistent_entry(struct PersistentInstrument *p)
+{
+    persistent_cache_used -= p->size;
+    if(p->ip->type == INST_SF2)
+	free(p->ip->instname);
+    free_instrument(p->ip);
+    free(p->key);
+    free(p);
+}
+
+static void free_persistent_instruments(void)
+{
+    struct PersistentInstrument *p, *next;
+
+    for(p = persistent_cache; p != NULL; p = next)
+    {
+	next = p->next;
+	free_persistent_entry(p);
+    }
+    persistent_cache = NULL;
+    persistent_cache_used = 0;
+}
+
+/* Entries decoded with other settings are kept until the next trim,
+   copies of them may still be in use. */
+static int persistent_cache_valid(void)
+{
+    struct PersistentCacheSettings st;
+
+    current_persistent_cache_settings(&st);
+    if(persistent_cache == NULL)
+	memcpy(&persistent_cache_settings, &st, sizeof(st));
+    return memcmp(&st, &persistent_cache_settings, sizeof(st)) == 0;
+}
+
+/* Evict least recently used entries until the cache fits in its budget. */
+static void trim_persistent_instruments(void)
+{
+    if(!persistent_cache_valid())
+	free_persistent_instruments();
+    while(persistent_cache != NULL && persistent_cache_used > instrument_cache_size)
+    {
+	struct PersistentInstrument **pp, **oldest;
+
+	oldest = &persistent_cache;
+	for(pp = &persistent_cache; *pp != NULL; pp = &(*pp)->next)
+	    if((*pp)->last_used < (*oldest)->last_used)
+		oldest = pp;
+	{
+	    struct PersistentInstrument *p = *oldest;
+	    *oldest = p->next;
+	    free_persistent_entry(p);
+	}
+    }
+}
+
+static Instrument *copy_persistent_instrument(const Instrument *src)
+{
+    Instrument *ip;
+    int i;
+
+    ip = (Instrument *)safe_malloc(sizeof(Instrument));
+    memcpy(ip, src, sizeof(Instrument));
+    ip->sample = (Sample *)safe_malloc(sizeof(Sample) * src->samples);
+    memcpy(ip->sample, src->sample, sizeof(Sample) * src->samples);
+    for(i = 0; i < ip->samples; i++)
+	ip->sample[i].data_alloced = 0;
+    return ip;
+}
+
+/* Return a copy of the cached instrument for key, or NULL. */
+Instrument *search_persistent_instrument(const char *key)
+{
+    struct PersistentInstrument *p;
+
+    if(!persistent_cache_valid())
+	return NULL;
+    for(p = persistent_cache; p != NULL; p = p->next)
+	if(strcmp(p->key, key) == 0)
+	{
+	    p->last_used = ++persistent_cache_clock;
+	    return copy_persistent_instrument(p->ip);
+	}
+    return NULL;
+}
+
+/* Take ownership of a freshly loaded instrument, return the copy to use. */
+Instrument *store_persistent_instrument(const char *key, Instrument *ip)
+{
+    struct PersistentInstrument *p;
+    int i;
+
+    if(instrument_cache_size <= 0 || !persistent_cache_valid())
+	return ip;
+    p = (struct PersistentInstrument *)safe_malloc(sizeof(struct PersistentInstrument));
+    p->key = safe_strdup(key);
+    p->ip = ip;
+    /* soundfont names point to the soundfont record, freed after each song */
+    if(ip->type == INST_SF2)
+	ip->instname = (ip->instname != NULL) ? safe_strdup(ip->instname) : NULL;
+    p->size = sizeof(Instrument) + sizeof(Sample) * ip->samples;
+    for(i = 0; i < ip->samples; i++)
+	if(ip->sample[i].data_alloced)
+	    p->size += (ip->sample[i].data_length >> FRACTION_BITS) * sizeof(tim_sample_t);
+    p->last_used = ++persistent_cache_clock;
+    p->next = persistent_cache;
+    persistent_cache = p;
+    persistent_cache_used += p->size;
+    return copy_persistent_instrument(ip);
+}
+
 static int32 adjust_tune_freq(int32 val, float tune)
 {
 	if (! tune)
@@ -624,6 +776,8 @@ static Instrument *load_gus_instrument(char *name,
 	uint8 tmp[1024], fractions;
 	Sample *sp;
 	int i, j, noluck = 0;
+	int persistent = 0;
+	char persistent_key[1024];
 	
 	if (! name)
 		return 0;
@@ -656,11 +810,25 @@ static Instrument *load_gus_instrument(char *name,
 			&& tone->trempitchnum == 0 && tone->tremfcnum == 0
 			&& tone->modpitchnum == 0 && tone->modfcnum == 0
 			&& tone->fcnum == 0 && tone->resonum == 0)
+	{
 		if ((ip = search_instrument_cache(name, panning, amp, note_to_use,
 				strip_loop, strip_envelope, strip_tail)) != NULL) {
 			ctl->cmsg(CMSG_INFO, VERB_DEBUG, " * Cached");
 			return ip;
 		}
+		/* bank instruments only: the default instrument has no bank
+		   and outlives free_instruments(0) */
+		persistent = 1;
+		snprintf(persistent_key, sizeof(persistent_key),
+				"gus:%s:%d:%d:%d:%d:%d:%d", name, panning, amp,
+				note_to_use, strip_loop, strip_envelope, strip_tail);
+		if ((ip = search_persistent_instrument(persistent_key)) != NULL) {
+			ctl->cmsg(CMSG_INFO, VERB_DEBUG, " * Cached");
+			store_instrument_cache(ip, name, panning, amp, note_to_use,
+					strip_loop, strip_envelope, strip_tail);
+			return ip;
+		}
+	}
 	/* Open patch file */
 	if (! (tf = open_file_r(name, 2, OF_NORMAL))) {
 #ifdef PATCH_EXT_LIST
@@ -1010,6 +1178,8 @@ fail:
 		}
 	}
 	close_file(tf);
+	if (persistent)
+		ip = store_persistent_instrument(persistent_key, ip);
 	store_instrument_cache(ip, name, panning, amp, note_to_use,
 			strip_loop, strip_envelope, strip_tail);
 	return ip;
@@ -1547,6 +1717,9 @@ void free_instruments(int reload_default_inst)
 	default_entry->next = NULL;
 	instrument_cache[default_entry_addr] = default_entry;
     }
+
+    /* no copy of a persistent instrument is left in use */
+    trim_persistent_instruments();
 }
 
 void free_special_patch(int id)
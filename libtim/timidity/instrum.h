@@ -238,6 +238,9 @@ extern void copy_tone_bank_element(ToneBankElement *elm, const ToneBankElement *
 extern void free_tone_bank_element(ToneBankElement *elm);
 extern void free_tone_bank(void);
 extern void free_instrument(Instrument *ip);
+extern int32 instrument_cache_size;
+extern Instrument *search_persistent_instrument(const char *key);
+extern Instrument *store_persistent_instrument(const char *key, Instrument *ip);
 extern void squash_sample_16to8(Sample *sp);
 
 extern char *default_instrument_name;
@@ -441,10 +441,31 @@ static Instrument *try_load_soundfont(SFInsts *rec, int order, int bank,
 	InstList *ip;
 	Instrument *inst = NULL;
 	int addr;
+	char key[1024];
+
+	if (rec->fname == NULL)
+		return NULL;
+	addr = INSTHASH(bank, preset, keynote);
+	for (ip = rec->instlist[addr]; ip; ip = ip->next) {
+		if (ip->pat.bank == bank && ip->pat.preset == preset &&
+		    (keynote < 0 || ip->pat.keynote == keynote) &&
+		    (order < 0 || ip->order == order))
+			break;
+	}
+	if (ip == NULL || ip->samples == 0)
+		return NULL;
+
+	/* decoded samples may still be there from a previous song */
+	snprintf(key, sizeof(key), "sf2:%s:%d:%d:%d:%d:%d:%d:%d:%g",
+		 rec->fname, ip->pat.bank, ip->pat.preset, ip->pat.keynote,
+		 ip->pr_idx, ip->order, rec->def_cutoff_allowed,
+		 rec->def_resonance_allowed, (double)rec->amptune);
+	if ((inst = search_persistent_instrument(key)) != NULL) {
+		ctl->cmsg(CMSG_INFO, VERB_DEBUG, " * Cached");
+		return inst;
+	}
 
 	if (rec->tf == NULL) {
-		if (rec->fname == NULL)
-			return NULL;
 		if ((rec->tf = open_file(rec->fname, 1, OF_VERBOSE)) == NULL) {
 			ctl->cmsg(CMSG_ERROR, VERB_NORMAL,
 				  "Can't open soundfont file %s",
@@ -457,22 +478,15 @@ static Instrument *try_load_soundfont(SFInsts *rec, int order, int bank,
 				rec->tf->url = url_cache_open(rec->tf->url, 1);
 	}
 
-	addr = INSTHASH(bank, preset, keynote);
-	for (ip = rec->instlist[addr]; ip; ip = ip->next) {
-		if (ip->pat.bank == bank && ip->pat.preset == preset &&
-		    (keynote < 0 || ip->pat.keynote == keynote) &&
-		    (order < 0 || ip->order == order))
-			break;
-	}
-
-	if (ip && ip->samples)
-		inst = load_from_file(rec, ip);
+	inst = load_from_file(rec, ip);
 
 	if (opt_sf_close_each_file) {
 		close_file(rec->tf);
 		rec->tf = NULL;
 	}
 
+	if (inst != NULL)
+		inst = store_persistent_instrument(key, inst);
 	return inst;
 }
 
@@ -280,6 +280,59 @@ void XSFPlayer_2SF::GenerateSamples(std::vector<uint8_t> &buf, unsigned offset,
 	}
 }
 
+// The region list is gathered on every call, the sound cores get reallocated when the emulator is initialized.
+bool XSFPlayer_2SF::SaveState(std::vector<uint8_t> &state)
+{
+	if (!sndifwork.xfs_load)
+		return false;
+
+	NDS_StateRegions regions;
+	NDS_GetStateRegions(regions);
+	size_t size = 3 * sizeof(uint32_t) + sndifwork.bufferbytes;
+	for (auto &region : regions)
+		size += region.size;
+
+	state.resize(size);
+	uint8_t *ptr = &state[0];
+	for (auto &region : regions)
+	{
+		memcpy(ptr, region.ptr, region.size);
+		ptr += region.size;
+	}
+	uint32_t work[3] = { sndifwork.filled, sndifwork.used, sndifwork.cycles };
+	memcpy(ptr, work, sizeof(work));
+	memcpy(ptr + sizeof(work), &sndifwork.buf[0], sndifwork.bufferbytes);
+	return true;
+}
+
+bool XSFPlayer_2SF::LoadState(const std::vector<uint8_t> &state)
+{
+	if (!sndifwork.xfs_load)
+		return false;
+
+	NDS_StateRegions regions;
+	NDS_GetStateRegions(regions);
+	size_t size = 3 * sizeof(uint32_t) + sndifwork.bufferbytes;
+	for (auto &region : regions)
+		size += region.size;
+	if (state.size() != size)
+		return false;
+
+	const uint8_t *ptr = &state[0];
+	for (auto &region : regions)
+	{
+		memcpy(region.ptr, ptr, region.size);
+		ptr += region.size;
+	}
+	uint32_t work[3];
+	memcpy(work, ptr, sizeof(work));
+	memcpy(&sndifwork.buf[0], ptr + sizeof(work), sndifwork.bufferbytes);
+	sndifwork.filled = work[0];
+	sndifwork.used = work[1];
+	sndifwork.cycles = work[2];
+	return true;
+}
+
 void XSFPlayer_2SF::Terminate()
 {
 	MMU_unsetRom();
@@ -27,6 +27,8 @@ class XSFPlayer_2SF : public XSFPlayer
 	bool Map2SF(XSFFile *xSFToLoad);
 	bool RecursiveLoad2SF(XSFFile *xSFToLoad, int level);
 	bool Load2SF(XSFFile *xSFToLoad);
+	bool SaveState(std::vector<uint8_t> &state);
+	bool LoadState(const std::vector<uint8_t> &state);
 public:
 	XSFPlayer_2SF(const std::string &filename);
 #ifdef _WIN32
@@ -738,6 +738,47 @@ void MMU_DeInit()
 	mc_free(&MMU.fw);
 }
 
+void MMU_GetStateRegions(NDS_StateRegions &regions)
+{
+	// the BIOS and the cart are left out, they don't change after loading
+	regions.push_back({ MMU.ARM9_ITCM, sizeof(MMU.ARM9_ITCM) });
+	regions.push_back({ MMU.ARM9_DTCM, sizeof(MMU.ARM9_DTCM) });
+	regions.push_back({ MMU.MAIN_MEM, _MMU_MAIN_MEM_MASK + 1 });
+	regions.push_back({ MMU.ARM9_REG, 0x10000 });
+	regions.push_back({ MMU.ARM9_VMEM, sizeof(MMU.ARM9_VMEM) });
+	regions.push_back({ MMU.ARM9_LCD, sizeof(MMU.ARM9_LCD) });
+	regions.push_back({ MMU.ARM9_OAM, sizeof(MMU.ARM9_OAM) });
+	regions.push_back({ MMU.ExtPal, sizeof(MMU.ExtPal) });
+	regions.push_back({ MMU.ObjExtPal, sizeof(MMU.ObjExtPal) });
+	regions.push_back({ &MMU.texInfo, sizeof(MMU.texInfo) });
+	regions.push_back({ MMU.ARM7_ERAM, sizeof(MMU.ARM7_ERAM) });
+	regions.push_back({ MMU.ARM7_REG, sizeof(MMU.ARM7_REG) });
+	regions.push_back({ MMU.ARM7_WIRAM, sizeof(MMU.ARM7_WIRAM) });
+	regions.push_back({ MMU.VRAM_MAP, sizeof(MMU.VRAM_MAP) });
+	regions.push_back({ MMU.LCD_VRAM_ADDR, sizeof(MMU.LCD_VRAM_ADDR) });
+	regions.push_back({ MMU.LCDCenable, sizeof(MMU.LCDCenable) });
+	regions.push_back({ MMU.SWIRAM, sizeof(MMU.SWIRAM) });
+	regions.push_back({ MMU.UNUSED_RAM, sizeof(MMU.UNUSED_RAM) });
+	regions.push_back({ MMU.MORE_UNUSED_RAM, sizeof(MMU.MORE_UNUSED_RAM) });
+	// everything from the RW mode up to the firmware, which owns a heap buffer
+	regions.push_back({ &MMU.ARM9_RW_MODE, offsetof(MMU_struct, fw) - offsetof(MMU_struct, ARM9_RW_MODE) });
+	regions.push_back({ MMU.dscard, sizeof(MMU.dscard) });
+
+	regions.push_back({ MMU_new.dma, sizeof(MMU_new.dma) });
+	regions.push_back({ &MMU_new.gxstat, sizeof(MMU_new.gxstat) });
+	regions.push_back({ &MMU_new.sqrt, sizeof(MMU_new.sqrt) });
+	regions.push_back({ &MMU_new.div, sizeof(MMU_new.div) });
+	regions.push_back({ &MMU_new.dsi_tsc, sizeof(MMU_new.dsi_tsc) });
+	regions.push_back({ &MMU_timing, sizeof(MMU_timing) });
+	regions.push_back({ ipc_fifo, sizeof(ipc_fifo) });
+
+	regions.push_back({ vram_lcdc_map, sizeof(vram_lcdc_map) });
+	regions.push_back({ vram_arm9_map, sizeof(vram_arm9_map) });
+	regions.push_back({ vram_arm7_map, sizeof(vram_arm7_map) });
+	regions.push_back({ &vramConfiguration, sizeof(vramConfiguration) });
+	regions.push_back({ &partie, sizeof(partie) });
+}
+
 void MMU_Reset()
 {
 	memset(MMU.ARM9_DTCM, 0, sizeof(MMU.ARM9_DTCM));
@@ -1191,6 +1191,21 @@ void NDS_Reset()
 	SPU_ReInit();
 }
 
+void NDS_GetStateRegions(NDS_StateRegions &regions)
+{
+	regions.push_back({ &nds, sizeof(nds) });
+	regions.push_back({ &nds_timer, sizeof(nds_timer) });
+	regions.push_back({ &nds_arm9_timer, sizeof(nds_arm9_timer) });
+	regions.push_back({ &nds_arm7_timer, sizeof(nds_arm7_timer) });
+	regions.push_back({ &sequencer, sizeof(sequencer) });
+	regions.push_back({ &NDS_ARM7, sizeof(NDS_ARM7) });
+	regions.push_back({ &NDS_ARM9, sizeof(NDS_ARM9) });
+	regions.push_back({ &cp15, sizeof(cp15) });
+
+	MMU_GetStateRegions(regions);
+	SPU_GetStateRegions(regions);
+}
+
 // these templates needed to be instantiated manually
 template void NDS_exec<false>(int32_t nb);
 template void NDS_exec<true>(int32_t nb);
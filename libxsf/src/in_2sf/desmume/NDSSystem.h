@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include <cstring>
 #include "armcpu.h"
 #include "MMU.h"
@@ -174,6 +175,18 @@ int NDS_Init ();
 
 void NDS_DeInit();
 
+// memory that holds the emulation state, used by the 2SF player to keep save states for seeking
+struct NDS_StateRegion
+{
+	void *ptr;
+	size_t size;
+};
+typedef std::vector<NDS_StateRegion> NDS_StateRegions;
+
+void NDS_GetStateRegions(NDS_StateRegions &regions);
+void MMU_GetStateRegions(NDS_StateRegions &regions);
+void SPU_GetStateRegions(NDS_StateRegions &regions);
+
 bool NDS_SetROM(uint8_t * rom, uint32_t mask);
 
 struct RomBanner
@@ -274,6 +274,25 @@ void SPU_DeInit()
 	SPU_user.reset();
 }
 
+static void SPU_GetCoreStateRegions(SPU_struct *spu, NDS_StateRegions &regions)
+{
+	// the mixing buffers are refilled on every pass, only the channel and register state carries over
+	regions.push_back({ &spu->bufpos, sizeof(spu->bufpos) });
+	regions.push_back({ &spu->buflength, sizeof(spu->buflength) });
+	regions.push_back({ &spu->lastdata, sizeof(spu->lastdata) });
+	regions.push_back({ spu->channels, sizeof(spu->channels) });
+	regions.push_back({ &spu->regs, sizeof(spu->regs) });
+}
+
+void SPU_GetStateRegions(NDS_StateRegions &regions)
+{
+	if (SPU_core)
+		SPU_GetCoreStateRegions(SPU_core.get(), regions);
+	if (SPU_user)
+		SPU_GetCoreStateRegions(SPU_user.get(), regions);
+	regions.push_back({ &samples, sizeof(samples) });
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 void SPU_struct::ShutUp()
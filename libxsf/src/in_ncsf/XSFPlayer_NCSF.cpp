@@ -181,6 +181,26 @@ void XSFPlayer_NCSF::GenerateSamples(std::vector<uint8_t> &buf, unsigned offset,
 	}
 }
 
+// The player only points to itself and to the SDAT, which stays the same until the next Load, so its state can be copied as is.
+bool XSFPlayer_NCSF::SaveState(std::vector<uint8_t> &state)
+{
+	state.resize(sizeof(Player) + 2 * sizeof(double));
+	memcpy(&state[0], static_cast<void *>(&this->player), sizeof(Player));
+	memcpy(&state[sizeof(Player)], &this->secondsIntoPlayback, sizeof(double));
+	memcpy(&state[sizeof(Player) + sizeof(double)], &this->secondsUntilNextClock, sizeof(double));
+	return true;
+}
+
+bool XSFPlayer_NCSF::LoadState(const std::vector<uint8_t> &state)
+{
+	if (state.size() != sizeof(Player) + 2 * sizeof(double))
+		return false;
+	memcpy(static_cast<void *>(&this->player), &state[0], sizeof(Player));
+	memcpy(&this->secondsIntoPlayback, &state[sizeof(Player)], sizeof(double));
+	memcpy(&this->secondsUntilNextClock, &state[sizeof(Player) + sizeof(double)], sizeof(double));
+	return true;
+}
+
 void XSFPlayer_NCSF::Terminate()
 {
 	this->player.Stop(true);
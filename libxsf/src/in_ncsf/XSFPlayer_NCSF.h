@@ -30,6 +30,8 @@ class XSFPlayer_NCSF : public XSFPlayer
 	bool MapNCSF(XSFFile *xSFToLoad);
 	bool RecursiveLoadNCSF(XSFFile *xSFToLoad, int level);
 	bool LoadNCSF();
+	bool SaveState(std::vector<uint8_t> &state);
+	bool LoadState(const std::vector<uint8_t> &state);
 public:
 	XSFPlayer_NCSF(const std::string &filename);
 	~XSFPlayer_NCSF();
@@ -6,6 +6,7 @@
  * Partially based on the vio*sf framework
  */
 
+#include <algorithm>
 #include <cstring>
 #include "XSFPlayer.h"
 #include "XSFConfig.h"
@@ -14,14 +15,16 @@
 extern XSFConfig *xSFConfig;
 
 XSFPlayer::XSFPlayer() : xSF(), sampleRate(0), detectedSilenceSample(0), detectedSilenceSec(0), skipSilenceOnStartSec(5), lengthSample(0), fadeSample(0), currentSample(0),
-	prevSampleL(CHECK_SILENCE_BIAS), prevSampleR(CHECK_SILENCE_BIAS), lengthInMS(-1), fadeInMS(-1), volume(1.0), ignoreVolume(false), uses32BitSamplesClampedTo16Bit(false)
+	prevSampleL(CHECK_SILENCE_BIAS), prevSampleR(CHECK_SILENCE_BIAS), lengthInMS(-1), fadeInMS(-1), volume(1.0), ignoreVolume(false), uses32BitSamplesClampedTo16Bit(false),
+	keyframes(), keyframeInterval(0), nextKeyframeSample(0), keyframesSupported(true)
 {
 }
 
 XSFPlayer::XSFPlayer(const XSFPlayer &xSFPlayer) : xSF(new XSFFile()), sampleRate(xSFPlayer.sampleRate), detectedSilenceSample(xSFPlayer.detectedSilenceSample), detectedSilenceSec(xSFPlayer.detectedSilenceSec),
 	skipSilenceOnStartSec(xSFPlayer.skipSilenceOnStartSec), lengthSample(xSFPlayer.lengthSample), fadeSample(xSFPlayer.fadeSample), currentSample(xSFPlayer.currentSample), prevSampleL(xSFPlayer.prevSampleL),
 	prevSampleR(xSFPlayer.prevSampleR), lengthInMS(xSFPlayer.lengthInMS), fadeInMS(xSFPlayer.fadeInMS), volume(xSFPlayer.volume), ignoreVolume(xSFPlayer.ignoreVolume),
-	uses32BitSamplesClampedTo16Bit(xSFPlayer.uses32BitSamplesClampedTo16Bit)
+	uses32BitSamplesClampedTo16Bit(xSFPlayer.uses32BitSamplesClampedTo16Bit), keyframes(), keyframeInterval(xSFPlayer.keyframeInterval), nextKeyframeSample(0),
+	keyframesSupported(xSFPlayer.keyframesSupported)
 {
 	*this->xSF = *xSFPlayer.xSF;
 }
@@ -47,6 +50,9 @@ XSFPlayer &XSFPlayer::operator=(const XSFPlayer &xSFPlayer)
 		this->volume = xSFPlayer.volume;
 		this->ignoreVolume = xSFPlayer.ignoreVolume;
 		this->uses32BitSamplesClampedTo16Bit = xSFPlayer.uses32BitSamplesClampedTo16Bit;
+		// The keyframes hold the state of the other player's emulator
+		this->keyframesSupported = xSFPlayer.keyframesSupported;
+		this->ClearKeyframes();
 	}
 	return *this;
 }
@@ -56,6 +62,8 @@ bool XSFPlayer::FillBuffer(std::vector<uint8_t> &buf, unsigned &samplesWritten)
 	bool endFlag = false;
 	unsigned detectSilence = xSFConfig->GetDetectSilenceSec();
 	unsigned pos = 0, bufsize = buf.size() >> 2;
+	if (this->keyframesSupported && this->currentSample >= this->nextKeyframeSample)
+		this->AddKeyframe();
 	auto trueBuffer = std::vector<uint8_t>(bufsize << (this->uses32BitSamplesClampedTo16Bit ? 3 : 2));
 	auto longBuffer = std::vector<uint8_t>(bufsize << 3);
 	auto bufLong = reinterpret_cast<int32_t *>(&longBuffer[0]);
@@ -221,6 +229,7 @@ bool XSFPlayer::Load()
 	this->lengthSample = static_cast<uint64_t>(this->lengthInMS) * this->sampleRate / 1000;
 	this->fadeSample = static_cast<uint64_t>(this->fadeInMS) * this->sampleRate / 1000;
 	this->volume = this->xSF->GetVolume(xSFConfig->GetVolumeType(), xSFConfig->GetPeakType());
+	this->ClearKeyframes();
 	return true;
 }
 
@@ -230,3 +239,76 @@ void XSFPlayer::SeekTop()
 	this->currentSample = this->detectedSilenceSec = this->detectedSilenceSample = 0;
 	this->prevSampleL = this->prevSampleR = CHECK_SILENCE_BIAS;
 }
+
+void XSFPlayer::AddKeyframe()
+{
+	if (!this->keyframes.empty() && (this->keyframes.size() >= MAX_KEYFRAMES || this->keyframes.size() * this->keyframes[0].state.size() >= MAX_KEYFRAME_BYTES))
+	{
+		// Keep every other keyframe and double the distance between them
+		for (size_t i = 1, count = this->keyframes.size(); 2 * i < count; ++i)
+			this->keyframes[i] = std::move(this->keyframes[2 * i]);
+		this->keyframes.resize((this->keyframes.size() + 1) / 2);
+		this->keyframeInterval *= 2;
+	}
+
+	Keyframe keyframe;
+	if (!this->SaveState(keyframe.state))
+	{
+		this->keyframesSupported = false;
+		this->keyframes.clear();
+		return;
+	}
+	keyframe.sample = this->currentSample;
+	keyframe.detectedSilenceSample = this->detectedSilenceSample;
+	keyframe.detectedSilenceSec = this->detectedSilenceSec;
+	keyframe.skipSilenceOnStartSec = this->skipSilenceOnStartSec;
+	keyframe.prevSampleL = this->prevSampleL;
+	keyframe.prevSampleR = this->prevSampleR;
+	this->keyframes.push_back(std::move(keyframe));
+	this->nextKeyframeSample = this->currentSample + this->keyframeInterval;
+}
+
+bool XSFPlayer::SeekToKeyframe(unsigned sample)
+{
+	auto keyframe = std::find_if(this->keyframes.rbegin(), this->keyframes.rend(), [&](const Keyframe &k) { return k.sample <= sample; });
+	if (keyframe == this->keyframes.rend())
+		return false;
+	// When seeking forward, the keyframe only helps if it is past the current position
+	if (sample >= this->currentSample && keyframe->sample <= this->currentSample)
+		return false;
+
+	if (!this->LoadState(keyframe->state))
+	{
+		this->keyframesSupported = false;
+		this->keyframes.clear();
+		return false;
+	}
+	this->currentSample = keyframe->sample;
+	this->detectedSilenceSample = keyframe->detectedSilenceSample;
+	this->detectedSilenceSec = keyframe->detectedSilenceSec;
+	this->skipSilenceOnStartSec = keyframe->skipSilenceOnStartSec;
+	this->prevSampleL = keyframe->prevSampleL;
+	this->prevSampleR = keyframe->prevSampleR;
+	return true;
+}
+
+void XSFPlayer::SkipSamples(std::vector<uint8_t> &buf, unsigned samples)
+{
+	unsigned bufsize = buf.size() >> (this->uses32BitSamplesClampedTo16Bit ? 3 : 2);
+	while (samples)
+	{
+		if (this->keyframesSupported && this->currentSample >= this->nextKeyframeSample)
+			this->AddKeyframe();
+		unsigned count = std::min(samples, bufsize);
+		this->GenerateSamples(buf, 0, count);
+		this->currentSample += count;
+		samples -= count;
+	}
+}
+
+void XSFPlayer::ClearKeyframes()
+{
+	this->keyframes.clear();
+	this->keyframeInterval = KEYFRAME_INTERVAL_SEC * this->sampleRate;
+	this->nextKeyframeSample = 0;
+}
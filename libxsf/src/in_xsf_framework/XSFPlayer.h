@@ -9,6 +9,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include "XSFFile.h"
 
 // This is a base class, a player for a specific type of xSF should inherit from this.
@@ -24,8 +25,29 @@ protected:
 	double volume;
 	bool ignoreVolume, uses32BitSamplesClampedTo16Bit;
 
+	// Keyframes are save states of the emulator taken while playing, seeking restores the nearest one instead of emulating from the start.
+	static const unsigned KEYFRAME_INTERVAL_SEC = 5;
+	static const unsigned MAX_KEYFRAMES = 32;
+	static const size_t MAX_KEYFRAME_BYTES = 32 * 1024 * 1024;
+
+	struct Keyframe
+	{
+		unsigned sample, detectedSilenceSample, detectedSilenceSec, skipSilenceOnStartSec;
+		uint32_t prevSampleL, prevSampleR;
+		std::vector<uint8_t> state;
+	};
+	std::vector<Keyframe> keyframes;
+	unsigned keyframeInterval, nextKeyframeSample;
+	bool keyframesSupported;
+
 	XSFPlayer();
 	XSFPlayer(const XSFPlayer &xSFPLayer);
+
+	// These should be overridden by players that are able to save and restore the state of their emulator.
+	// Only 2SF and NCSF do: GSF and SNSF keep seeking by replaying from the start (modizer only builds the 2SF/NCSF players).
+	virtual bool SaveState(std::vector<uint8_t> &) { return false; }
+	virtual bool LoadState(const std::vector<uint8_t> &) { return false; }
+	void AddKeyframe();
 public:
     unsigned sampleRate, detectedSilenceSample, detectedSilenceSec, skipSilenceOnStartSec, lengthSample, fadeSample;
     int lengthInMS, fadeInMS;
@@ -48,6 +70,9 @@ public:
 	bool FillBuffer(std::vector<uint8_t> &buf, unsigned &samplesWritten);
 	virtual void GenerateSamples(std::vector<uint8_t> &buf, unsigned offset, unsigned samples) = 0;
 	void SeekTop();
+	bool SeekToKeyframe(unsigned sample);
+	void SkipSamples(std::vector<uint8_t> &buf, unsigned samples);
+	void ClearKeyframes();
 	
 	virtual void Terminate() = 0;
 };
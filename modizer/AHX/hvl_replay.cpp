@@ -574,12 +574,9 @@ struct hvl_tune *hvl_load_ahx( uint8 *buf, uint32 buflen, uint32 defstereo, uint
 
 struct hvl_tune *hvl_LoadTune( TEXT *name, uint32 freq, uint32 defstereo )
 {
-  struct hvl_tune *ht;
-  uint8  *buf, *bptr;
-  TEXT   *nptr;
-  uint32  buflen, i, j, posn, insn, ssn, chnn, hs, trkl, trkn;
+  uint8  *buf;
+  uint32  buflen;
   FILE *fh;
-  struct  hvl_plsentry *ple;
 
   fh = fopen( name, "rb" );
   if( !fh )
@@ -608,7 +605,26 @@ struct hvl_tune *hvl_LoadTune( TEXT *name, uint32 freq, uint32 defstereo )
     return NULL;
   }
   fclose( fh );
-  
+
+  return hvl_LoadTuneMemory( buf, buflen, freq, defstereo );
+}
+
+// buf is malloc'ed by the caller and owned by the loader, which frees it
+struct hvl_tune *hvl_LoadTuneMemory( uint8 *buf, uint32 buflen, uint32 freq, uint32 defstereo )
+{
+  struct hvl_tune *ht;
+  uint8  *bptr;
+  TEXT   *nptr;
+  uint32  i, j, posn, insn, ssn, chnn, hs, trkl, trkn;
+  struct  hvl_plsentry *ple;
+
+  if( buflen < 16 )
+  {
+    free( buf );
+    printf( "Invalid file.\n" );
+    return NULL;
+  }
+
   if( ( buf[0] == 'T' ) &&
       ( buf[1] == 'H' ) &&
       ( buf[2] == 'X' ) &&
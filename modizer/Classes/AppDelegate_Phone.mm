@@ -28,12 +28,7 @@ char homedirectory[512];
 char bundledirectory[512];
 
 
-extern "C" {
-
 #include <pthread.h>
-pthread_mutex_t uade_mutex;
-}
-pthread_mutex_t db_mutex;
 pthread_mutex_t download_mutex;
 pthread_mutex_t play_mutex;
 BOOL is_ios7,is_retina;
@@ -181,14 +176,6 @@ BOOL is_ios7,is_retina;
         [[UIApplication sharedApplication] setStatusBarStyle:UIStatusBarStyleDefault animated:YES];
     }
     
-	if (pthread_mutex_init(&uade_mutex,NULL)) {
-		printf("cannot create uade mutex");
-		return NO;
-	}
-	if (pthread_mutex_init(&db_mutex,NULL)) {
-		printf("cannot create db mutex");
-		return NO;
-	}
 	if (pthread_mutex_init(&download_mutex,NULL)) {
 		printf("cannot create download mutex");
 		return NO;
@@ -9,6 +9,9 @@
 #ifndef st_DBHelper_h_
 #define st_DBHelper_h_
 
+#include "sqlite3.h"
+#import "RootViewControllerStruct.h"
+
 typedef struct {
 	NSString *mPlaylistFilename;
 	NSString *mPlaylistFilepath;
@@ -20,17 +23,35 @@ typedef struct {
 
 namespace DBHelper 
 {
+	//Long-lived connections, one per database file. lockDB returns the connection with its
+	//(recursive) lock held, or NULL if the file cannot be opened; unlockDB(NULL) is a no-op.
+	sqlite3 *lockDB(NSString *pathToDB);
+	void unlockDB(sqlite3 *db);
+	//Prepared statement cached on a locked connection, returned reset with bindings cleared.
+	//Do not finalize it.
+	sqlite3_stmt *getStatement(sqlite3 *db,const char *sql);
+	//Close the connection & hold its lock while the database file is moved or replaced.
+	void suspendDB(NSString *pathToDB);
+	void resumeDB(NSString *pathToDB);
+	
 	void getFileStatsDBmod(NSString *name,NSString *fullpath,short int *playcount,signed char *rating,int *song_length=NULL,char *channels_nb=NULL,int *songs=NULL);    
 	void getFilesStatsDBmod(NSMutableArray *names,NSMutableArray *fullpaths,short int *playcountArray,signed char *ratingArray,int *song_lengthA=NULL,char *channels_nbA=NULL,int *songsA=NULL);
     int deleteStatsDirDB(NSString *fullpath);
     int deleteStatsFileDB(NSString *fullpath);
 	void getFilesStatsDBmod(t_plPlaylist_entry *playlist,int nb_entries);
+	//fill stats of entries whose rating is -1, one query for the whole list
+	void getFilesStatsDBmod(t_local_browse_entry *entries,int nb_entries);
+	void getFilesStatsDBmod(t_playlist_entry *entries,int nb_entries);
     
 	NSString *getLocalPathFromFullPath(NSString *fullPath);
 	NSString *getFullPathFromLocalPath(NSString *localPath);
     void updateFileStatsAvgRatingDBmod(NSString *fullpath);
 	void updateFileStatsDBmod(NSString*name,NSString *fullpath,short int playcount,signed char rating);
 	void updateFileStatsDBmod(NSString*name,NSString *fullpath,short int playcount,signed char rating,int song_length,char channels_nb,int songs);
+	//set length, channels & songs only, play_count & rating of an existing entry are kept
+	void updateFileLengthDBmod(NSString*name,NSString *fullpath,int song_length,char channels_nb,int songs);
+	//per track length (ms, stored in s) in the user songlength table, keyed by file md5
+	void setSongLengthFromMD5(const char *md5,int track_nb,int slength);
 	
 	int getNbFormatEntries();
 	int getNbAuthorEntries();
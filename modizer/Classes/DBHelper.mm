@@ -11,64 +11,242 @@
 #include "ModizerConstants.h"
 #include "sqlite3.h"
 #include <pthread.h>
-extern pthread_mutex_t db_mutex;
+
+#define DB_MAX_CONNECTIONS 4
+#define DB_MAX_STATEMENTS 32
+
+typedef struct {
+	char *sql;
+	sqlite3_stmt *stmt;
+	int in_use;
+} t_dbStatement;
+
+typedef struct {
+	char *path;
+	sqlite3 *db;
+	pthread_mutex_t mutex;
+	int lock_depth;
+	t_dbStatement stmts[DB_MAX_STATEMENTS];
+	int stmts_next;
+	sqlite3_stmt **uncached;
+	int uncached_nb,uncached_max;
+} t_dbConnection;
+
+static t_dbConnection db_connections[DB_MAX_CONNECTIONS];
+static int db_connections_nb;
+static pthread_mutex_t db_connections_mutex=PTHREAD_MUTEX_INITIALIZER;
+
+static t_dbConnection *getConnection(const char *path) {
+	t_dbConnection *cnx=NULL;
+	
+	pthread_mutex_lock(&db_connections_mutex);
+	for (int i=0;i<db_connections_nb;i++) {
+		if (strcmp(db_connections[i].path,path)==0) {
+			cnx=&(db_connections[i]);
+			break;
+		}
+	}
+	if ((!cnx)&&(db_connections_nb<DB_MAX_CONNECTIONS)) {
+		pthread_mutexattr_t attr;
+		cnx=&(db_connections[db_connections_nb]);
+		memset(cnx,0,sizeof(t_dbConnection));
+		cnx->path=strdup(path);
+		pthread_mutexattr_init(&attr);
+		pthread_mutexattr_settype(&attr,PTHREAD_MUTEX_RECURSIVE);
+		pthread_mutex_init(&(cnx->mutex),&attr);
+		pthread_mutexattr_destroy(&attr);
+		db_connections_nb++;
+	}
+	pthread_mutex_unlock(&db_connections_mutex);
+	if (!cnx) NSLog(@"DBHelper: too many database files opened, cannot open %s",path);
+	return cnx;
+}
+
+static t_dbConnection *getConnection(sqlite3 *db) {
+	t_dbConnection *cnx=NULL;
+	
+	pthread_mutex_lock(&db_connections_mutex);
+	for (int i=0;i<db_connections_nb;i++) {
+		if (db_connections[i].db==db) {
+			cnx=&(db_connections[i]);
+			break;
+		}
+	}
+	pthread_mutex_unlock(&db_connections_mutex);
+	return cnx;
+}
+
+//statements handed out while the connection is locked stay valid until the last unlockDB
+static void releaseStatements(t_dbConnection *cnx) {
+	for (int i=0;i<DB_MAX_STATEMENTS;i++) {
+		//make sure no statement left half-stepped keeps a read transaction open
+		if (cnx->stmts[i].stmt) sqlite3_reset(cnx->stmts[i].stmt);
+		cnx->stmts[i].in_use=0;
+	}
+	for (int i=0;i<cnx->uncached_nb;i++) sqlite3_finalize(cnx->uncached[i]);
+	cnx->uncached_nb=0;
+}
+
+static void closeConnection(t_dbConnection *cnx) {
+	releaseStatements(cnx);
+	for (int i=0;i<DB_MAX_STATEMENTS;i++) {
+		if (cnx->stmts[i].stmt) sqlite3_finalize(cnx->stmts[i].stmt);
+		if (cnx->stmts[i].sql) free(cnx->stmts[i].sql);
+		cnx->stmts[i].stmt=NULL;
+		cnx->stmts[i].sql=NULL;
+	}
+	cnx->stmts_next=0;
+	if (cnx->db) sqlite3_close(cnx->db);
+	cnx->db=NULL;
+}
+
+sqlite3 *DBHelper::lockDB(NSString *pathToDB) {
+	t_dbConnection *cnx;
+	int err;
+	
+	if (pathToDB==nil) return NULL;
+	cnx=getConnection([pathToDB UTF8String]);
+	if (!cnx) return NULL;
+	
+	pthread_mutex_lock(&(cnx->mutex));
+	if (!cnx->db) {
+		if (sqlite3_open(cnx->path, &(cnx->db)) != SQLITE_OK) {
+			NSLog(@"ErrSQL : cannot open %s",cnx->path);
+			sqlite3_close(cnx->db);
+			cnx->db=NULL;
+			pthread_mutex_unlock(&(cnx->mutex));
+			return NULL;
+		}
+		sqlite3_busy_timeout(cnx->db,1000);
+		err=sqlite3_exec(cnx->db, "PRAGMA journal_mode=WAL; PRAGMA synchronous = 1;", 0, 0, 0);
+		if (err==SQLITE_OK){
+		} else NSLog(@"ErrSQL : %d",err);
+	}
+	cnx->lock_depth++;
+	return cnx->db;
+}
+
+void DBHelper::unlockDB(sqlite3 *db) {
+	t_dbConnection *cnx;
+	
+	if (db==NULL) return;
+	cnx=getConnection(db);
+	if (!cnx) return;
+	
+	cnx->lock_depth--;
+	if (cnx->lock_depth==0) releaseStatements(cnx);
+	pthread_mutex_unlock(&(cnx->mutex));
+}
+
+sqlite3_stmt *DBHelper::getStatement(sqlite3 *db,const char *sql) {
+	t_dbConnection *cnx;
+	t_dbStatement *entry;
+	sqlite3_stmt *stmt;
+	int err;
+	
+	cnx=getConnection(db);
+	if (!cnx) return NULL;
+	
+	entry=NULL;
+	for (int i=0;i<DB_MAX_STATEMENTS;i++) {
+		if (cnx->stmts[i].sql&&(strcmp(cnx->stmts[i].sql,sql)==0)) {
+			entry=&(cnx->stmts[i]);
+			break;
+		}
+	}
+	//a statement still being stepped by a caller (nested query) is not shared
+	if (entry&&!(entry->in_use&&sqlite3_stmt_busy(entry->stmt))) {
+		stmt=entry->stmt;
+		sqlite3_reset(stmt);
+		sqlite3_clear_bindings(stmt);
+		entry->in_use=1;
+		return stmt;
+	}
+	
+	err=sqlite3_prepare_v2(db, sql, -1, &stmt, NULL);
+	if (err!=SQLITE_OK) {
+		NSLog(@"ErrSQL : %d",err);
+		return NULL;
+	}
+	//slots are filled in order, the oldest one not handed out under the current lock is recycled
+	if (!entry) {
+		for (int i=0;i<DB_MAX_STATEMENTS;i++) {
+			t_dbStatement *slot=&(cnx->stmts[(cnx->stmts_next+i)%DB_MAX_STATEMENTS]);
+			if (!slot->in_use) {
+				entry=slot;
+				cnx->stmts_next=(cnx->stmts_next+i+1)%DB_MAX_STATEMENTS;
+				break;
+			}
+		}
+	} else entry=NULL; //same query already being stepped by the caller
+	if (entry) {
+		if (entry->stmt) sqlite3_finalize(entry->stmt);
+		if (entry->sql) free(entry->sql);
+		entry->sql=strdup(sql);
+		entry->stmt=stmt;
+		entry->in_use=1;
+		return stmt;
+	}
+	//no free slot : the statement lives until the connection is unlocked
+	if (cnx->uncached_nb==cnx->uncached_max) {
+		sqlite3_stmt **uncached=(sqlite3_stmt **)realloc(cnx->uncached,(cnx->uncached_max+DB_MAX_STATEMENTS)*sizeof(sqlite3_stmt*));
+		if (!uncached) {
+			sqlite3_finalize(stmt);
+			return NULL;
+		}
+		cnx->uncached=uncached;
+		cnx->uncached_max+=DB_MAX_STATEMENTS;
+	}
+	cnx->uncached[cnx->uncached_nb++]=stmt;
+	return stmt;
+}
+
+void DBHelper::suspendDB(NSString *pathToDB) {
+	t_dbConnection *cnx=getConnection([pathToDB UTF8String]);
+	if (!cnx) return;
+	pthread_mutex_lock(&(cnx->mutex));
+	closeConnection(cnx);
+}
+
+void DBHelper::resumeDB(NSString *pathToDB) {
+	t_dbConnection *cnx=getConnection([pathToDB UTF8String]);
+	if (!cnx) return;
+	pthread_mutex_unlock(&(cnx->mutex));
+}
 
 NSString *DBHelper::getFullPathFromLocalPath(NSString *localPath) {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
-	int err;	
 	NSString *result=nil;
     if (localPath==nil) return nil;
 	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024],sqltmp[512];
-		int adjusted=0;
+	if ((db=DBHelper::lockDB(pathToDB))){
 		sqlite3_stmt *stmt;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-		
-		sprintf(sqltmp,"%s",[localPath cStringUsingEncoding:NSUTF8StringEncoding]);
-//		printf("%s\n",sqltmp);
 		
-		if (adjusted) sprintf(sqlStatement,"SELECT fullpath FROM mod_file WHERE localpath like \"%s\"",sqltmp);
-		else sprintf(sqlStatement,"SELECT fullpath FROM mod_file WHERE localpath = \"%s\"",sqltmp);
-		
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
+		stmt=DBHelper::getStatement(db,"SELECT fullpath FROM mod_file WHERE localpath = ?");
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, [localPath cStringUsingEncoding:NSUTF8StringEncoding], -1, SQLITE_TRANSIENT);
 			while (sqlite3_step(stmt) == SQLITE_ROW) {
 				result=[NSString stringWithUTF8String:(const char*)sqlite3_column_text(stmt, 0)];
 			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);
+		}
 	}
-	sqlite3_close(db);
+	DBHelper::unlockDB(db);
 	
-	pthread_mutex_unlock(&db_mutex);
 	return result;
 }
 
 NSString *DBHelper::getLocalPathFromFullPath(NSString *fullPath) {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
-	int err;	
 	NSString *result=nil;
     
     if (fullPath==nil) return nil;
 	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024],sqltmp[512];
+	if ((db=DBHelper::lockDB(pathToDB))){
+		char sqltmp[512];
 		int adjusted=0;
 		sqlite3_stmt *stmt;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
 		
 		sprintf(sqltmp,"%s",[fullPath cStringUsingEncoding:NSNonLossyASCIIStringEncoding]);
 		
@@ -83,20 +261,18 @@ NSString *DBHelper::getLocalPathFromFullPath(NSString *fullPath) {
 				adjusted=1;
 			}
 		}
-		if (adjusted) sprintf(sqlStatement,"SELECT localpath FROM mod_file WHERE fullpath like \"%s\"",sqltmp);
-		else sprintf(sqlStatement,"SELECT localpath FROM mod_file WHERE fullpath = \"%s\"",sqltmp);
+		if (adjusted) stmt=DBHelper::getStatement(db,"SELECT localpath FROM mod_file WHERE fullpath like ?");
+		else stmt=DBHelper::getStatement(db,"SELECT localpath FROM mod_file WHERE fullpath = ?");
 		
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, sqltmp, -1, SQLITE_TRANSIENT);
 			while (sqlite3_step(stmt) == SQLITE_ROW) {
 				result=[NSString stringWithUTF8String:(const char*)sqlite3_column_text(stmt, 0)];
 			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);
+		}
 	}
-	sqlite3_close(db);
+	DBHelper::unlockDB(db);
 	
-	pthread_mutex_unlock(&db_mutex);
 	return result;
 }
 
@@ -106,7 +282,6 @@ NSString *DBHelper::getLocalPathFromFullPath(NSString *fullPath) {
 void DBHelper::getFileStatsDBmod(NSString *name,NSString *fullpath,short int *playcount,signed char *rating,int *song_length,char *channels_nb,int *songs) {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
-	int err;
     
     if (name==nil) return;
 	
@@ -116,19 +291,13 @@ void DBHelper::getFileStatsDBmod(NSString *name,NSString *fullpath,short int *pl
 	if (channels_nb) *channels_nb=0;
 	if (songs) *songs=0;
 	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
+	if ((db=DBHelper::lockDB(pathToDB))){
 		sqlite3_stmt *stmt;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
 		
-		sprintf(sqlStatement,"SELECT play_count,rating,length,channels,songs FROM user_stats WHERE name=\"%s\" and fullpath=\"%s\"",[name UTF8String],[fullpath UTF8String]);
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
+		stmt=DBHelper::getStatement(db,"SELECT play_count,rating,length,channels,songs FROM user_stats WHERE name=? and fullpath=?");
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, [name UTF8String], -1, SQLITE_TRANSIENT);
+			sqlite3_bind_text(stmt, 2, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
 			while (sqlite3_step(stmt) == SQLITE_ROW) {
 				if (playcount) *playcount=(short int)sqlite3_column_int(stmt, 0);
 				if (rating) {
@@ -140,20 +309,94 @@ void DBHelper::getFileStatsDBmod(NSString *name,NSString *fullpath,short int *pl
 				if (channels_nb) *channels_nb=(char)sqlite3_column_int(stmt, 3);
 				if (songs) *songs=(int)sqlite3_column_int(stmt, 4);
 			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);
+		}
 		
 	}
-	sqlite3_close(db);
-	
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 
-void DBHelper::getFilesStatsDBmod(NSMutableArray *names,NSMutableArray *fullpaths,short int *playcountArray,signed char *ratingArray,int *song_lengthA,char *channels_nbA,int *songsA) {
+//Batched lookup: keys are loaded in a temp table & joined against user_stats,
+//store() gets called for each matching row with the entry index as column 0,
+//followed by play_count,rating,length,channels,songs
+typedef void (*t_statsKeyFn)(void *ctx,int idx,NSString **name,NSString **fullpath);
+typedef void (*t_statsStoreFn)(void *ctx,int idx,sqlite3_stmt *stmt);
+
+static void getFilesStatsBatch(void *ctx,int nb_entries,t_statsKeyFn key,t_statsStoreFn store) {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
 	int err;
-    
+	
+	if ((db=DBHelper::lockDB(pathToDB))){
+		sqlite3_stmt *stmt;
+		NSString *name,*fullpath;
+		
+		err=sqlite3_exec(db, "CREATE TEMP TABLE IF NOT EXISTS stats_lookup (idx INTEGER PRIMARY KEY,name TEXT,fullpath TEXT)", NULL, NULL, NULL);
+		if (err!=SQLITE_OK) {
+			NSLog(@"ErrSQL : %d",err);
+			DBHelper::unlockDB(db);
+			return;
+		}
+		
+		//savepoint rather than BEGIN/COMMIT : nests inside a transaction the caller may have opened
+		sqlite3_exec(db, "SAVEPOINT stats_lookup", NULL, NULL, NULL);
+		sqlite3_exec(db, "DELETE FROM temp.stats_lookup", NULL, NULL, NULL);
+		stmt=DBHelper::getStatement(db,"INSERT INTO temp.stats_lookup (idx,name,fullpath) VALUES (?,?,?)");
+		if (stmt) {
+			for (int i=0;i<nb_entries;i++) {
+				name=fullpath=nil;
+				key(ctx,i,&name,&fullpath);
+				if (name==nil) continue;
+				sqlite3_reset(stmt);
+				sqlite3_bind_int(stmt, 1, i);
+				sqlite3_bind_text(stmt, 2, [name UTF8String], -1, SQLITE_TRANSIENT);
+				sqlite3_bind_text(stmt, 3, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
+				sqlite3_step(stmt);
+			}
+		}
+		sqlite3_exec(db, "RELEASE stats_lookup", NULL, NULL, NULL);
+		
+		stmt=DBHelper::getStatement(db,"SELECT l.idx,s.play_count,s.rating,s.length,s.channels,s.songs FROM temp.stats_lookup l,user_stats s WHERE s.name=l.name AND s.fullpath=l.fullpath");
+		if (stmt){
+			while (sqlite3_step(stmt) == SQLITE_ROW) {
+				store(ctx,sqlite3_column_int(stmt, 0),stmt);
+			}
+		}
+	}
+	DBHelper::unlockDB(db);
+}
+
+static signed char clampRating(int rating) {
+	if (rating<0) return 0;
+	if (rating>5) return 5;
+	return rating;
+}
+
+typedef struct {
+	NSMutableArray *names,*fullpaths;
+	short int *playcountArray;
+	signed char *ratingArray;
+	int *song_lengthA;
+	char *channels_nbA;
+	int *songsA;
+} t_statsArrays;
+
+static void statsArraysKey(void *ctx,int idx,NSString **name,NSString **fullpath) {
+	t_statsArrays *arrays=(t_statsArrays*)ctx;
+	*name=[arrays->names objectAtIndex:idx];
+	*fullpath=[arrays->fullpaths objectAtIndex:idx];
+}
+
+static void statsArraysStore(void *ctx,int idx,sqlite3_stmt *stmt) {
+	t_statsArrays *arrays=(t_statsArrays*)ctx;
+	if (arrays->playcountArray) arrays->playcountArray[idx]=(short int)sqlite3_column_int(stmt, 1);
+	if (arrays->ratingArray) arrays->ratingArray[idx]=clampRating(sqlite3_column_int(stmt, 2));
+	if (arrays->song_lengthA) arrays->song_lengthA[idx]=(int)sqlite3_column_int(stmt, 3);
+	if (arrays->channels_nbA) arrays->channels_nbA[idx]=(char)sqlite3_column_int(stmt, 4);
+	if (arrays->songsA) arrays->songsA[idx]=(int)sqlite3_column_int(stmt, 5);
+}
+
+void DBHelper::getFilesStatsDBmod(NSMutableArray *names,NSMutableArray *fullpaths,short int *playcountArray,signed char *ratingArray,int *song_lengthA,char *channels_nbA,int *songsA) {
+	t_statsArrays arrays;
     
     if (names==nil) return ;
     if ([names count]==0) return ;
@@ -166,68 +409,35 @@ void DBHelper::getFilesStatsDBmod(NSMutableArray *names,NSMutableArray *fullpath
 	if (channels_nbA) memset(channels_nbA,0,sizeof(char)*nb_entries);
 	if (songsA) memset(songsA,0,sizeof(int)*nb_entries);
 	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
-		sqlite3_stmt *stmt;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-		
-		for (int i=0;i<nb_entries;i++) {
-			sprintf(sqlStatement,"SELECT play_count,rating,length,channels_nb,songs FROM user_stats WHERE name=\"%s\" and fullpath=\"%s\"",[[names objectAtIndex:i] UTF8String],[[fullpaths objectAtIndex:i] UTF8String]);
-			err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-			if (err==SQLITE_OK){
-				while (sqlite3_step(stmt) == SQLITE_ROW) {
-					if (playcountArray) playcountArray[i]=(short int)sqlite3_column_int(stmt, 0);
-					if (ratingArray) {
-                        ratingArray[i]=(signed char)sqlite3_column_int(stmt, 1);
-                        if (ratingArray[i]<0) ratingArray[i]=0;
-                        if (ratingArray[i]>5) ratingArray[i]=5;
-                    }
-					if (song_lengthA) song_lengthA[i]=(int)sqlite3_column_int(stmt, 2);
-					if (channels_nbA) channels_nbA[i]=(char)sqlite3_column_int(stmt, 3);
-					if (songsA) songsA[i]=(int)sqlite3_column_int(stmt, 4);
-				}
-				sqlite3_finalize(stmt);
-			} else {
-				NSLog(@"ErrSQL : %d",err);
-				break;
-			}
-		}
-		
-	}
-	sqlite3_close(db);
-	
-	pthread_mutex_unlock(&db_mutex);
+	arrays.names=names;
+	arrays.fullpaths=fullpaths;
+	arrays.playcountArray=playcountArray;
+	arrays.ratingArray=ratingArray;
+	arrays.song_lengthA=song_lengthA;
+	arrays.channels_nbA=channels_nbA;
+	arrays.songsA=songsA;
+	getFilesStatsBatch(&arrays,nb_entries,statsArraysKey,statsArraysStore);
 }
 
 int DBHelper::deleteStatsFileDB(NSString *fullpath) {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
-	int err,ret;
+	int ret;
     
     if (fullpath==nil) return -1;
     
-	pthread_mutex_lock(&db_mutex);
 	ret=1;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
+	if ((db=DBHelper::lockDB(pathToDB))){
+		sqlite3_stmt *stmt;
 		
-		sprintf(sqlStatement,"DELETE FROM user_stats WHERE fullpath=\"%s\"",[fullpath UTF8String]);
-		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
-		if (err==SQLITE_OK){
-		} else {ret=0;NSLog(@"ErrSQL : %d",err);}
+		stmt=DBHelper::getStatement(db,"DELETE FROM user_stats WHERE fullpath=?");
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
+			if (sqlite3_step(stmt)!=SQLITE_DONE) {ret=0;NSLog(@"ErrSQL : %s",sqlite3_errmsg(db));}
+		} else ret=0;
 		
 	}
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return ret;
 }
 int DBHelper::deleteStatsDirDB(NSString *fullpath) {
@@ -237,14 +447,9 @@ int DBHelper::deleteStatsDirDB(NSString *fullpath) {
     
     if (fullpath==nil) return -1;
     
-	pthread_mutex_lock(&db_mutex);
 	ret=1;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
 		
 		sprintf(sqlStatement,"DELETE FROM user_stats WHERE fullpath like \"%s%%\"",[fullpath UTF8String]);
 		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
@@ -252,17 +457,24 @@ int DBHelper::deleteStatsDirDB(NSString *fullpath) {
 		} else {ret=0;NSLog(@"ErrSQL : %d",err);}
 		
 	}
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return ret;
 }
 
 
+static void plPlaylistKey(void *ctx,int idx,NSString **name,NSString **fullpath) {
+	t_plPlaylist_entry *playlist=(t_plPlaylist_entry*)ctx;
+	*name=playlist[idx].mPlaylistFilename;
+	*fullpath=playlist[idx].mPlaylistFilepath;
+}
+
+static void plPlaylistStore(void *ctx,int idx,sqlite3_stmt *stmt) {
+	t_plPlaylist_entry *playlist=(t_plPlaylist_entry*)ctx;
+	playlist[idx].mPlaylistCount=sqlite3_column_int(stmt, 1);
+	playlist[idx].mPlaylistRating=clampRating(sqlite3_column_int(stmt, 2));
+}
+
 void DBHelper::getFilesStatsDBmod(t_plPlaylist_entry *playlist,int nb_entries) {
-	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
-	sqlite3 *db;
-	int err;
-    
     if (playlist==NULL) return;
     if (nb_entries==0) return;
 	
@@ -271,193 +483,132 @@ void DBHelper::getFilesStatsDBmod(t_plPlaylist_entry *playlist,int nb_entries) {
 		playlist[i].mPlaylistCount=0;
 	}
 	
-	pthread_mutex_lock(&db_mutex);
+	getFilesStatsBatch(playlist,nb_entries,plPlaylistKey,plPlaylistStore);
+}
+
+static void localEntryKey(void *ctx,int idx,NSString **name,NSString **fullpath) {
+	t_local_browse_entry *entries=(t_local_browse_entry*)ctx;
+	if (entries[idx].rating!=-1) return;
+	*name=entries[idx].label;
+	*fullpath=entries[idx].fullpath;
+}
+
+static void localEntryStore(void *ctx,int idx,sqlite3_stmt *stmt) {
+	t_local_browse_entry *entries=(t_local_browse_entry*)ctx;
+	entries[idx].playcount=(short int)sqlite3_column_int(stmt, 1);
+	entries[idx].rating=clampRating(sqlite3_column_int(stmt, 2));
+	entries[idx].song_length=(int)sqlite3_column_int(stmt, 3);
+	entries[idx].channels_nb=(char)sqlite3_column_int(stmt, 4);
+	entries[idx].songs=(int)sqlite3_column_int(stmt, 5);
+}
+
+void DBHelper::getFilesStatsDBmod(t_local_browse_entry *entries,int nb_entries) {
+	if (entries==NULL) return;
+	if (nb_entries==0) return;
 	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
-		sqlite3_stmt *stmt;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-		
-		for (int i=0;i<nb_entries;i++) {
-			sprintf(sqlStatement,"SELECT play_count,rating FROM user_stats WHERE name=\"%s\" and fullpath=\"%s\"",[playlist[i].mPlaylistFilename UTF8String],[playlist[i].mPlaylistFilepath UTF8String]);
-			err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-			if (err==SQLITE_OK){
-				while (sqlite3_step(stmt) == SQLITE_ROW) {
-					playlist[i].mPlaylistRating=sqlite3_column_int(stmt, 1);
-					playlist[i].mPlaylistCount=sqlite3_column_int(stmt, 0);
-					if (playlist[i].mPlaylistRating<0) playlist[i].mPlaylistRating=0;
-					else if (playlist[i].mPlaylistRating>5) playlist[i].mPlaylistRating=5;
-				}
-				sqlite3_finalize(stmt);
-			} else {
-				NSLog(@"ErrSQL : %d",err);
-				break;
-			}
+	getFilesStatsBatch(entries,nb_entries,localEntryKey,localEntryStore);
+	//entries without stats yet
+	for (int i=0;i<nb_entries;i++) {
+		if (entries[i].rating==-1) {
+			entries[i].playcount=0;
+			entries[i].rating=0;
+			entries[i].song_length=0;
+			entries[i].channels_nb=0;
+			entries[i].songs=0;
 		}
-		
 	}
-	sqlite3_close(db);
-	
-	pthread_mutex_unlock(&db_mutex);
 }
 
-int DBHelper::getNbFormatEntries() {
-	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
-	sqlite3 *db;
-	int err;	
-	int ret_int=0;
-	
-	pthread_mutex_lock(&db_mutex);
+static void playlistEntryKey(void *ctx,int idx,NSString **name,NSString **fullpath) {
+	t_playlist_entry *entries=(t_playlist_entry*)ctx;
+	if (entries[idx].ratings!=-1) return;
+	*name=entries[idx].label;
+	*fullpath=entries[idx].fullpath;
+}
+
+static void playlistEntryStore(void *ctx,int idx,sqlite3_stmt *stmt) {
+	t_playlist_entry *entries=(t_playlist_entry*)ctx;
+	entries[idx].playcounts=(short int)sqlite3_column_int(stmt, 1);
+	entries[idx].ratings=clampRating(sqlite3_column_int(stmt, 2));
+	entries[idx].song_length=(int)sqlite3_column_int(stmt, 3);
+	entries[idx].channels_nb=(char)sqlite3_column_int(stmt, 4);
+	entries[idx].songs=(int)sqlite3_column_int(stmt, 5);
+}
+
+void DBHelper::getFilesStatsDBmod(t_playlist_entry *entries,int nb_entries) {
+	if (entries==NULL) return;
+	if (nb_entries==0) return;
 	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
-		sqlite3_stmt *stmt;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-		
-		sprintf(sqlStatement,"SELECT count(1) FROM mod_type");
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
-			while (sqlite3_step(stmt) == SQLITE_ROW) {
-				ret_int=sqlite3_column_int(stmt, 0);
-			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);
-		
+	getFilesStatsBatch(entries,nb_entries,playlistEntryKey,playlistEntryStore);
+	//entries without stats yet
+	for (int i=0;i<nb_entries;i++) {
+		if (entries[i].ratings==-1) {
+			entries[i].playcounts=0;
+			entries[i].ratings=0;
+			entries[i].song_length=0;
+			entries[i].channels_nb=0;
+			entries[i].songs=0;
+		}
 	}
-	sqlite3_close(db);
-	
-	pthread_mutex_unlock(&db_mutex);
-	return ret_int;
 }
-int DBHelper::getNbAuthorEntries() {
-	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
+
+static int getCount(NSString *pathToDB,const char *sql) {
 	sqlite3 *db;
-	int err;	
 	int ret_int=0;
 	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
+	if ((db=DBHelper::lockDB(pathToDB))){
 		sqlite3_stmt *stmt;
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
-		sprintf(sqlStatement,"SELECT count(1) FROM mod_author");
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
+		stmt=DBHelper::getStatement(db,sql);
+		if (stmt){
 			while (sqlite3_step(stmt) == SQLITE_ROW) {
 				ret_int=sqlite3_column_int(stmt, 0);
 			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);
-		
+		}
 	}
-	sqlite3_close(db);
-	
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return ret_int;
 }
-int DBHelper::getNbHVSCFilesEntries() {
-	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
+
+void DBHelper::setSongLengthFromMD5(const char *md5,int track_nb,int slength) {
+	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
-	int err;	
-	int ret_int=0;
 	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
+	if ((db=DBHelper::lockDB(pathToDB))){
 		sqlite3_stmt *stmt;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
 		
-		sprintf(sqlStatement,"SELECT count(1) FROM hvsc_file");
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
-			while (sqlite3_step(stmt) == SQLITE_ROW) {
-				ret_int=sqlite3_column_int(stmt, 0);
-			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);
+		stmt=DBHelper::getStatement(db,"DELETE FROM songlength_user WHERE id_md5=? AND track_nb=?");
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, md5, -1, SQLITE_TRANSIENT);
+			sqlite3_bind_int(stmt, 2, track_nb);
+			if (sqlite3_step(stmt)!=SQLITE_DONE) NSLog(@"ErrSQL : %s setSongLengthFromMD51",sqlite3_errmsg(db));
+		}
 		
+		stmt=DBHelper::getStatement(db,"INSERT INTO songlength_user (id_md5,track_nb,song_length) VALUES (?,?,?)");
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, md5, -1, SQLITE_TRANSIENT);
+			sqlite3_bind_int(stmt, 2, track_nb);
+			sqlite3_bind_int(stmt, 3, slength/1000);
+			if (sqlite3_step(stmt)!=SQLITE_DONE) NSLog(@"ErrSQL : %s setSongLengthFromMD52",sqlite3_errmsg(db));
+		}
 	}
-	sqlite3_close(db);
-	
-	pthread_mutex_unlock(&db_mutex);
-	return ret_int;
+	DBHelper::unlockDB(db);
+}
+
+int DBHelper::getNbFormatEntries() {
+	return getCount([[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN],"SELECT count(1) FROM mod_type");
+}
+int DBHelper::getNbAuthorEntries() {
+	return getCount([[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN],"SELECT count(1) FROM mod_author");
+}
+int DBHelper::getNbHVSCFilesEntries() {
+	return getCount([[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN],"SELECT count(1) FROM hvsc_file");
 }
 int DBHelper::getNbASMAFilesEntries() {
-	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
-	sqlite3 *db;
-	int err;
-	int ret_int=0;
-	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
-		sqlite3_stmt *stmt;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-		
-		sprintf(sqlStatement,"SELECT count(1) FROM asma_file");
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
-			while (sqlite3_step(stmt) == SQLITE_ROW) {
-				ret_int=sqlite3_column_int(stmt, 0);
-			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);
-		
-	}
-	sqlite3_close(db);
-	
-	pthread_mutex_unlock(&db_mutex);
-	return ret_int;
+	return getCount([[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN],"SELECT count(1) FROM asma_file");
 }
 int DBHelper::getNbMODLANDFilesEntries() {
-	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
-	sqlite3 *db;
-	int err;	
-	int ret_int=0;
-	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
-		sqlite3_stmt *stmt;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-		
-		sprintf(sqlStatement,"SELECT count(1) FROM mod_file");
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
-			while (sqlite3_step(stmt) == SQLITE_ROW) {
-				ret_int=sqlite3_column_int(stmt, 0);
-			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);
-		
-	}
-	sqlite3_close(db);
-	
-	pthread_mutex_unlock(&db_mutex);
-	return ret_int;
+	return getCount([[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN],"SELECT count(1) FROM mod_file");
 }
 
 void DBHelper::updateFileStatsAvgRatingDBmod(NSString *fullpath) {
@@ -474,17 +625,11 @@ void DBHelper::updateFileStatsAvgRatingDBmod(NSString *fullpath) {
     entries_nb=0;
     playcount=0;
     
-    pthread_mutex_lock(&db_mutex);
-    
     //1st get all related entries (archive entries & subsongs)
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         sprintf(sqlStatement,"SELECT fullpath,play_count,rating,length,channels,songs FROM user_stats WHERE fullpath like \"%s%%\"",[fullpath UTF8String]);
         
         //printf("req: %s\n",sqlStatement);
@@ -520,86 +665,118 @@ void DBHelper::updateFileStatsAvgRatingDBmod(NSString *fullpath) {
         
     //2nd update rating based on average
     
-    sprintf(sqlStatement,"DELETE FROM user_stats WHERE fullpath=\"%s\"",[fullpath UTF8String]);
-    err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
-    if (err==SQLITE_OK){
-    } else NSLog(@"ErrSQL : %d",err);
+    stmt=DBHelper::getStatement(db,"DELETE FROM user_stats WHERE fullpath=?");
+    if (stmt){
+        sqlite3_bind_text(stmt, 1, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
+        if (sqlite3_step(stmt)!=SQLITE_DONE) NSLog(@"ErrSQL : %s",sqlite3_errmsg(db));
+    }
         
-    sprintf(sqlStatement,"INSERT INTO user_stats (name,fullpath,play_count,rating) SELECT \"%s\",\"%s\",%d,%d",[[fullpath lastPathComponent] UTF8String],[fullpath UTF8String],playcount,avg_rating);
-    err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
-    if (err==SQLITE_OK){
-    } else NSLog(@"ErrSQL : %d",err);
+    stmt=DBHelper::getStatement(db,"INSERT INTO user_stats (name,fullpath,play_count,rating) VALUES (?,?,?,?)");
+    if (stmt){
+        sqlite3_bind_text(stmt, 1, [[fullpath lastPathComponent] UTF8String], -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 2, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int(stmt, 3, playcount);
+        sqlite3_bind_int(stmt, 4, avg_rating);
+        if (sqlite3_step(stmt)!=SQLITE_DONE) NSLog(@"ErrSQL : %s",sqlite3_errmsg(db));
+    }
         
     }
-    sqlite3_close(db);
-    
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     
 }
 
 void DBHelper::updateFileStatsDBmod(NSString*name,NSString *fullpath,short int playcount,signed char rating) {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
-	int err;	
 	
     if (name==nil) return;
     
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
+	if ((db=DBHelper::lockDB(pathToDB))){
+		sqlite3_stmt *stmt;
 		
-		sprintf(sqlStatement,"DELETE FROM user_stats WHERE name=\"%s\" and fullpath=\"%s\"",[name UTF8String],[fullpath UTF8String]);
-		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
-		if (err==SQLITE_OK){
-		} else NSLog(@"ErrSQL : %d",err);
-			
-			sprintf(sqlStatement,"INSERT INTO user_stats (name,fullpath,play_count,rating) SELECT \"%s\",\"%s\",%d,%d",[name UTF8String],[fullpath UTF8String],playcount,rating);
-			err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
-			if (err==SQLITE_OK){
-			} else NSLog(@"ErrSQL : %d",err);
-				
-				}
-	sqlite3_close(db);
-	
-	pthread_mutex_unlock(&db_mutex);
+		stmt=DBHelper::getStatement(db,"DELETE FROM user_stats WHERE name=? and fullpath=?");
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, [name UTF8String], -1, SQLITE_TRANSIENT);
+			sqlite3_bind_text(stmt, 2, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
+			if (sqlite3_step(stmt)!=SQLITE_DONE) NSLog(@"ErrSQL : %s",sqlite3_errmsg(db));
+		}
+		
+		stmt=DBHelper::getStatement(db,"INSERT INTO user_stats (name,fullpath,play_count,rating) VALUES (?,?,?,?)");
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, [name UTF8String], -1, SQLITE_TRANSIENT);
+			sqlite3_bind_text(stmt, 2, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
+			sqlite3_bind_int(stmt, 3, playcount);
+			sqlite3_bind_int(stmt, 4, rating);
+			if (sqlite3_step(stmt)!=SQLITE_DONE) NSLog(@"ErrSQL : %s",sqlite3_errmsg(db));
+		}
+	}
+	DBHelper::unlockDB(db);
 }
 
-void DBHelper::updateFileStatsDBmod(NSString*name,NSString *fullpath,short int playcount,signed char rating,int song_length,char channels_nb,int songs) {
+void DBHelper::updateFileLengthDBmod(NSString*name,NSString *fullpath,int song_length,char channels_nb,int songs) {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
-	int err;
     
     if (name==nil) return;
     
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
+	//update & insert are done under the same lock, a concurrent play_count/rating update cannot be lost
+	if ((db=DBHelper::lockDB(pathToDB))){
+		sqlite3_stmt *stmt;
+		int updated=0;
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
-		sprintf(sqlStatement,"DELETE FROM user_stats WHERE name=\"%s\" and fullpath=\"%s\"",[name UTF8String],[fullpath UTF8String]);
-		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
-		if (err==SQLITE_OK){
-		} else NSLog(@"ErrSQL : %d",err);
-        
-		sprintf(sqlStatement,"INSERT INTO user_stats (name,fullpath,play_count,rating,length,channels,songs) SELECT \"%s\",\"%s\",%d,%d,%d,%d,%d",[name UTF8String],[fullpath UTF8String],playcount,rating,song_length,channels_nb,songs);
-		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
-		if (err==SQLITE_OK){
-		} else NSLog(@"ErrSQL : %d",err);
+		stmt=DBHelper::getStatement(db,"UPDATE user_stats SET length=?,channels=?,songs=? WHERE name=? and fullpath=?");
+		if (stmt){
+			sqlite3_bind_int(stmt, 1, song_length);
+			sqlite3_bind_int(stmt, 2, channels_nb);
+			sqlite3_bind_int(stmt, 3, songs);
+			sqlite3_bind_text(stmt, 4, [name UTF8String], -1, SQLITE_TRANSIENT);
+			sqlite3_bind_text(stmt, 5, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
+			if (sqlite3_step(stmt)!=SQLITE_DONE) NSLog(@"ErrSQL : %s",sqlite3_errmsg(db));
+			else updated=sqlite3_changes(db);
+		}
 		
+		if (!updated) {
+			stmt=DBHelper::getStatement(db,"INSERT INTO user_stats (name,fullpath,play_count,rating,length,channels,songs) VALUES (?,?,0,0,?,?,?)");
+			if (stmt){
+				sqlite3_bind_text(stmt, 1, [name UTF8String], -1, SQLITE_TRANSIENT);
+				sqlite3_bind_text(stmt, 2, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
+				sqlite3_bind_int(stmt, 3, song_length);
+				sqlite3_bind_int(stmt, 4, channels_nb);
+				sqlite3_bind_int(stmt, 5, songs);
+				if (sqlite3_step(stmt)!=SQLITE_DONE) NSLog(@"ErrSQL : %s",sqlite3_errmsg(db));
+			}
+		}
 	}
-	sqlite3_close(db);
-	
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 
-
-
+void DBHelper::updateFileStatsDBmod(NSString*name,NSString *fullpath,short int playcount,signed char rating,int song_length,char channels_nb,int songs) {
+	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
+	sqlite3 *db;
+    
+    if (name==nil) return;
+    
+	if ((db=DBHelper::lockDB(pathToDB))){
+		sqlite3_stmt *stmt;
+		
+		stmt=DBHelper::getStatement(db,"DELETE FROM user_stats WHERE name=? and fullpath=?");
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, [name UTF8String], -1, SQLITE_TRANSIENT);
+			sqlite3_bind_text(stmt, 2, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
+			if (sqlite3_step(stmt)!=SQLITE_DONE) NSLog(@"ErrSQL : %s",sqlite3_errmsg(db));
+		}
+		
+		stmt=DBHelper::getStatement(db,"INSERT INTO user_stats (name,fullpath,play_count,rating,length,channels,songs) VALUES (?,?,?,?,?,?,?)");
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, [name UTF8String], -1, SQLITE_TRANSIENT);
+			sqlite3_bind_text(stmt, 2, [fullpath UTF8String], -1, SQLITE_TRANSIENT);
+			sqlite3_bind_int(stmt, 3, playcount);
+			sqlite3_bind_int(stmt, 4, rating);
+			sqlite3_bind_int(stmt, 5, song_length);
+			sqlite3_bind_int(stmt, 6, channels_nb);
+			sqlite3_bind_int(stmt, 7, songs);
+			if (sqlite3_step(stmt)!=SQLITE_DONE) NSLog(@"ErrSQL : %s",sqlite3_errmsg(db));
+		}
+	}
+	DBHelper::unlockDB(db);
+}
@@ -74,6 +74,9 @@ class CGLString;
     
     int mOnlyCurrentEntry;
     int mOnlyCurrentSubEntry;
+    //gapless : next playlist entry pre-rolled by the player
+    int mPrerollRequested,mPrerollPos;
+    NSString *mPrerollFilepath;
 
 	int oglViewFullscreen,oglViewFullscreenChanged;
 	int orientationHV;
@@ -208,6 +211,8 @@ class CGLString;
 
 -(BOOL)play_curEntry;
 -(void)play_nextEntry;
+-(void)play_prerollNextEntry;
+-(void)play_prerolledEntry;
 -(void)play_prevEntry;
 
 -(void)play_restart;
@@ -216,6 +221,7 @@ class CGLString;
 -(void)play_listmodules:(NSArray *)array start_index:(int)index path:(NSArray *)arrayFilepaths;
 
 -(BOOL)play_module:(NSString *)filePath fname:(NSString *)fileName;
+-(void)play_updateEntryInfos:(NSString *)filePath fname:(NSString *)fileName;
 
 -(void) updateInfos: (NSTimer *) theTimer;
 -(int) add_to_playlist:(NSString*)filePath fileName:(NSString*)fileName forcenoplay:(int)forcenoplay;
@@ -36,6 +36,7 @@ static int *fft_freqAvgCount;
 
 #include "TextureUtils.h"
 #include "DBHelper.h"
+#include "SongLengthScanner.h"
 
 #define DEBUG_INFOS 0
 #define DEBUG_NO_SETTINGS 0
@@ -1168,6 +1169,17 @@ static float movePinchScale,movePinchScaleOld;
 		else labelSeeking.text=NSLocalizedString(@"Seeking",@"");
 	} else labelSeeking.hidden=TRUE;
 	
+	//gapless : player switched to the pre-rolled entry on its own, follow it
+	if ([mplayer isPrerollStarted]) {
+		[self play_prerolledEntry];
+		return;
+	}
+	//gapless : pre-roll next entry when the current one is about to end
+	if ((mPrerollRequested==0)&&mIsPlaying&&(mPaused==0)&&([mplayer getSongLength]>0)&&
+		([mplayer getSongLength]-[mplayer getCurrentTime]<PREROLL_START_MARGIN_FROM_END)) {
+		[self play_prerollNextEntry];
+	}
+	
 	if (/*(mPaused==0)&&*/(mplayer.bGlobalAudioPause==2)&&[mplayer isEndReached]) {//mod ended
 		//have to update the pause button
 		mSendStatTimer=0;
@@ -1666,6 +1678,76 @@ int qsort_ComparePlEntriesRev(const void *entryA, const void *entryB) {
 	}
 }
 
+-(void)play_prerollNextEntry {
+	int next_pos;
+	NSString *filePath;
+	
+	//only when play_nextEntry would be called at the end of the current entry
+	if ((mLoopMode==2)||(mplayer.mLoopMode==1)||mShuffle) return;
+	if ([mplayer isArchive]) return;
+	//remaining subsongs : wait for the last one
+	if ([mplayer isMultiSongs]&&(mOnlyCurrentSubEntry==0)&&(mplayer.mod_currentsub<mplayer.mod_maxsub)) return;
+	mPrerollRequested=1;
+	
+	if (mPlaylist_pos<mPlaylist_size-1) next_pos=mPlaylist_pos+1;
+	else if (mLoopMode==1) next_pos=0;
+	else return;
+	
+	filePath=mPlaylist[next_pos].mPlaylistFilepath;
+	//archive entry or subsong : go through play_module
+	if (([filePath rangeOfString:@"@"].location!=NSNotFound)||([filePath rangeOfString:@"?"].location!=NSNotFound)) return;
+	
+	mPrerollPos=next_pos;
+	[mPrerollFilepath release];
+	mPrerollFilepath=[filePath retain];
+	[mplayer PrerollModule:filePath];
+}
+
+-(void)play_prerolledEntry {
+	int pos=mPrerollPos;
+	NSString *filePath,*fileName;
+	
+	mPrerollRequested=0;
+	//playlist could have been edited meanwhile
+	if ((pos>=mPlaylist_size)||(![mPlaylist[pos].mPlaylistFilepath isEqualToString:mPrerollFilepath])) {
+		for (pos=0;pos<mPlaylist_size;pos++) if ([mPlaylist[pos].mPlaylistFilepath isEqualToString:mPrerollFilepath]) break;
+		if (pos>=mPlaylist_size) {
+			[self play_nextEntry];
+			return;
+		}
+	}
+	mPlaylist_pos=pos;
+	fileName=mPlaylist[mPlaylist_pos].mPlaylistFilename;
+	filePath=mPlaylist[mPlaylist_pos].mPlaylistFilepath;
+	mPlaylist[mPlaylist_pos].mPlaylistCount++;
+	
+	mSendStatTimer=0;
+	mShouldUpdateInfos=1;
+	mOnlyCurrentEntry=0;
+	mOnlyCurrentSubEntry=0;
+	
+	[self checkForCover:filePath];
+	mPlaylist[mPlaylist_pos].cover_flag=-1;
+	
+	if ([mplayer isMultiSongs]) btnShowSubSong.hidden=false;
+	else btnShowSubSong.hidden=true;
+	btnShowArcList.hidden=true;
+	
+	startChan=0;
+	sliderProgressModule.value=0;
+	[self checkGLViewCanDisplay];
+	
+	self.pauseBarSub.hidden=YES;
+	self.playBarSub.hidden=YES;
+	self.pauseBar.hidden=YES;
+	self.playBar.hidden=YES;
+	if ([mplayer isMultiSongs]) self.pauseBarSub.hidden=NO;
+	else self.pauseBar.hidden=NO;
+	[self updateBarPos];
+	
+	[self play_updateEntryInfos:filePath fname:fileName];
+}
+
 -(void)play_randomEntry {
 	
 }
@@ -1797,6 +1879,7 @@ int qsort_ComparePlEntriesRev(const void *entryA, const void *entryB) {
 	int add_entries_nb=[fileNames count];
     
     coverflow_needredraw=1;
+    SongLengthScanner::queueFiles(fileNames,filePaths);
     
     //    [self openPopup:@"Playlist updated"];
 	if (mPlaylist_size+add_entries_nb>=MAX_PL_ENTRIES) {
@@ -1895,6 +1978,7 @@ int qsort_ComparePlEntriesRev(const void *entryA, const void *entryB) {
 		return 0;
 	}
     coverflow_needredraw=1;
+    SongLengthScanner::queueFile(fileName,filePath);
     
 	if (mPlaylist_size) { //already in a playlist : append to it
 		if (settings[GLOB_EnqueueMode].detail.mdz_switch.switch_value==0) {
@@ -2293,12 +2377,12 @@ int qsort_ComparePlEntriesRev(const void *entryA, const void *entryB) {
 }
 
 -(BOOL)play_module:(NSString *)filePath fname:(NSString *)fileName {
-	short int playcount=0;
 	int retcode;
     NSString *filePathTmp;
 	
 	mSendStatTimer=0;
     shouldRestart=0;
+    mPrerollRequested=0;
     
     if (!filePath) return FALSE;
     if (!fileName) return FALSE;
@@ -2484,6 +2568,16 @@ int qsort_ComparePlEntriesRev(const void *entryA, const void *entryB) {
     
     
     
+    [self play_updateEntryInfos:filePath fname:fileName];
+    
+	//Activate timer for play infos
+	repeatingTimer = [NSTimer scheduledTimerWithTimeInterval: 0.1f target:self selector:@selector(updateInfos:) userInfo:nil repeats: YES]; //10 times/second
+	
+	return TRUE;
+}
+
+-(void)play_updateEntryInfos:(NSString *)filePath fname:(NSString *)fileName {
+	short int playcount=0;
 	//Update song info if required
     labelModuleName.hidden=NO;
     if (settings[GLOB_TitleFilename].detail.mdz_boolswitch.switch_value) labelModuleName.text=[NSString stringWithString:fileName];
@@ -2659,17 +2753,12 @@ int qsort_ComparePlEntriesRev(const void *entryA, const void *entryB) {
                                  nil];
 
     
-	//Activate timer for play infos
-	repeatingTimer = [NSTimer scheduledTimerWithTimeInterval: 0.1f target:self selector:@selector(updateInfos:) userInfo:nil repeats: YES]; //10 times/second
-    
     if (nowplayingPL) {
         NSIndexPath *myindex=[[[NSIndexPath alloc] initWithIndex:0] autorelease];
         [nowplayingPL.tableView reloadData];
         nowplayingPL.currentPlayedEntry=mPlaylist_pos;
         [nowplayingPL.tableView selectRowAtIndexPath:[myindex indexPathByAddingIndex:mPlaylist_pos+1] animated:YES scrollPosition:UITableViewScrollPositionMiddle];
     }
-	
-	return TRUE;
 }
 
 
@@ -4741,6 +4830,7 @@ void fxRadial(int fxtype,int _ww,int _hh,short int *spectrumDataL,short int *spe
     }
     
 	if (locationLastUpdate) [locationLastUpdate release];
+	if (mPrerollFilepath) [mPrerollFilepath release];
 	
 	[repeatingTimer invalidate];
 	repeatingTimer = nil; // ensures we never invalidate an already invalid Timer
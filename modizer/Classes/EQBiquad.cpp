@@ -0,0 +1,122 @@
+//
+//  EQBiquad.cpp
+//  modizer
+//
+//  10 bands peaking equalizer, cascaded biquads processed per stereo frame.
+//  Coefficients follow the RBJ audio EQ cookbook peaking filter, as NVDSP did.
+//
+
+#include "EQBiquad.hpp"
+
+#include <math.h>
+#include <string.h>
+
+//left & right channels are filtered together in one 2 lanes vector
+typedef float eq_v2f __attribute__((vector_size(8)));
+
+#define EQ_DENORMAL_LIMIT 1e-15f
+
+EQBiquad::EQBiquad(float sr) {
+    samplingRate=sr;
+    coefs_seq=active_seq=0;
+    activeNb=0;
+    for (int i=0;i<EQUALIZER_NB_BANDS;i++) {
+        bandFreq[i]=1000.0f;
+        bandQ[i]=2.0f;
+        bandG[i]=0.0f;
+        pendingCoefs[i].b0=1.0f;
+        pendingCoefs[i].a1=pendingCoefs[i].b2=pendingCoefs[i].a2=0.0f;
+        activeCoefs[i]=pendingCoefs[i];
+    }
+    reset();
+}
+
+void EQBiquad::setBand(int band,float centerFrequency,float Q,float G) {
+    if ((band<0)||(band>=EQUALIZER_NB_BANDS)) return;
+    bandFreq[band]=centerFrequency;
+    bandQ[band]=Q;
+    bandG[band]=G;
+    if ((centerFrequency==0.0f)||(Q==0.0f)) return;
+
+    float omega=2*M_PI*centerFrequency/samplingRate;
+    float alpha=sinf(omega)/(2*Q);
+    float A=powf(10.0f,G/40.0f);
+    float a0=1+alpha/A;
+    t_eqCoefs c;
+    c.b0=(1+alpha*A)/a0;
+    c.a1=(-2*cosf(omega))/a0;
+    c.b2=(1-alpha*A)/a0;
+    c.a2=(1-alpha/A)/a0;
+
+    //seqlock : the audio thread ignores the pending set while coefs_seq is odd or changes under it
+    __atomic_store_n(&coefs_seq,coefs_seq+1,__ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    pendingCoefs[band]=c;
+    __atomic_store_n(&coefs_seq,coefs_seq+1,__ATOMIC_RELEASE);
+}
+
+void EQBiquad::fetchCoefs() {
+    unsigned int seq=__atomic_load_n(&coefs_seq,__ATOMIC_ACQUIRE);
+    if ((seq==active_seq)||(seq&1)) return;
+
+    t_eqCoefs c[EQUALIZER_NB_BANDS];
+    memcpy(c,pendingCoefs,sizeof(c));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&coefs_seq,__ATOMIC_RELAXED)!=seq) return; //updated meanwhile, retry next buffer
+
+    active_seq=seq;
+    activeNb=0;
+    for (int i=0;i<EQUALIZER_NB_BANDS;i++) {
+        activeCoefs[i]=c[i];
+        //a 0dB band is an identity filter (b0=1, b2=a2) : skip it
+        if ((c[i].b0==1.0f)&&(c[i].b2==c[i].a2)) {
+            z1[i][0]=z1[i][1]=z2[i][0]=z2[i][1]=0;
+        } else activeBand[activeNb++]=i;
+    }
+}
+
+void EQBiquad::reset() {
+    memset(z1,0,sizeof(z1));
+    memset(z2,0,sizeof(z2));
+}
+
+void EQBiquad::process(float *data,int numFrames) {
+    eq_v2f b0[EQUALIZER_NB_BANDS],a1[EQUALIZER_NB_BANDS],b2[EQUALIZER_NB_BANDS],a2[EQUALIZER_NB_BANDS];
+    eq_v2f s1[EQUALIZER_NB_BANDS],s2[EQUALIZER_NB_BANDS];
+    int nb;
+
+    fetchCoefs();
+    nb=activeNb;
+    if (!nb) return;
+
+    for (int j=0;j<nb;j++) {
+        const t_eqCoefs &c=activeCoefs[activeBand[j]];
+        b0[j]=(eq_v2f){c.b0,c.b0};
+        a1[j]=(eq_v2f){c.a1,c.a1};
+        b2[j]=(eq_v2f){c.b2,c.b2};
+        a2[j]=(eq_v2f){c.a2,c.a2};
+        s1[j]=(eq_v2f){z1[activeBand[j]][0],z1[activeBand[j]][1]};
+        s2[j]=(eq_v2f){z2[activeBand[j]][0],z2[activeBand[j]][1]};
+    }
+
+    for (int i=0;i<numFrames;i++) {
+        eq_v2f x;
+        memcpy(&x,data+i*2,sizeof(x));
+        for (int j=0;j<nb;j++) {
+            eq_v2f y=b0[j]*x+s1[j];
+            //b1==a1 : b1*x-a1*y = a1*(x-y)
+            s1[j]=a1[j]*(x-y)+s2[j];
+            s2[j]=b2[j]*x-a2[j]*y;
+            x=y;
+        }
+        memcpy(data+i*2,&x,sizeof(x));
+    }
+
+    for (int j=0;j<nb;j++) {
+        for (int ch=0;ch<2;ch++) {
+            //flush state decaying into denormals (silence), they are very slow to process
+            z1[activeBand[j]][ch]=(fabsf(s1[j][ch])<EQ_DENORMAL_LIMIT?0:s1[j][ch]);
+            z2[activeBand[j]][ch]=(fabsf(s2[j][ch])<EQ_DENORMAL_LIMIT?0:s2[j][ch]);
+        }
+    }
+}
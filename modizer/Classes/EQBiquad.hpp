@@ -0,0 +1,55 @@
+//
+//  EQBiquad.hpp
+//  modizer
+//
+//  10 bands peaking equalizer, cascaded biquads processed per stereo frame.
+//
+
+#ifndef EQBiquad_hpp
+#define EQBiquad_hpp
+
+#include "ModizerConstants.h"
+
+class EQBiquad {
+public:
+    EQBiquad(float samplingRate);
+
+    //UI side : parameters are kept here and coefficients recomputed only for the changed band
+    void setBand(int band,float centerFrequency,float Q,float G);
+    void setCenterFrequency(int band,float centerFrequency) { setBand(band,centerFrequency,bandQ[band],bandG[band]); }
+    void setQ(int band,float Q) { setBand(band,bandFreq[band],Q,bandG[band]); }
+    void setG(int band,float G) { setBand(band,bandFreq[band],bandQ[band],G); }
+    float getCenterFrequency(int band) const { return bandFreq[band]; }
+    float getQ(int band) const { return bandQ[band]; }
+    float getG(int band) const { return bandG[band]; }
+
+    //audio side : filters interleaved stereo float data in place
+    void process(float *data,int numFrames);
+    void reset();
+
+private:
+    struct t_eqCoefs {
+        //peaking filter has b1==a1 once normalized, so only 4 coefficients are needed
+        float b0,a1,b2,a2;
+    };
+
+    void fetchCoefs();
+
+    float samplingRate;
+    float bandFreq[EQUALIZER_NB_BANDS],bandQ[EQUALIZER_NB_BANDS],bandG[EQUALIZER_NB_BANDS];
+
+    //written by the UI thread, published through coefs_seq (odd while an update is in progress)
+    t_eqCoefs pendingCoefs[EQUALIZER_NB_BANDS];
+    unsigned int coefs_seq;
+
+    //audio thread copy, only bands with a non 0dB gain are processed
+    t_eqCoefs activeCoefs[EQUALIZER_NB_BANDS];
+    int activeBand[EQUALIZER_NB_BANDS];
+    int activeNb;
+    unsigned int active_seq;
+
+    //transposed direct form II state, [band][left/right]
+    float z1[EQUALIZER_NB_BANDS][2],z2[EQUALIZER_NB_BANDS][2];
+};
+
+#endif /* EQBiquad_hpp */
@@ -14,14 +14,10 @@ extern BOOL is_ios7;
 /*
  */
 
-//NVDSP
-#import "Novocaine.h"
-#import "NVDSP.h"
-#import "NVPeakingEQFilter.h"
-#import "NVSoundLevelMeter.h"
-#import "NVClippingDetection.h"
-
-extern NVPeakingEQFilter *nvdsp_PEQ[10];
+//Equalizer
+#include "EQBiquad.hpp"
+
+extern EQBiquad *eq_biquad;
 extern BOOL nvdsp_EQ;
 
 
@@ -53,11 +49,12 @@ extern BOOL nvdsp_EQ;
     float delta=slider.value-eqGlobalGainLastValue;
     eqGlobalGainLastValue=slider.value;
     for (int i=0;i<EQUALIZER_NB_BANDS;i++) {
-        nvdsp_PEQ[i].G+=delta;
-        if (nvdsp_PEQ[i].G>12) nvdsp_PEQ[i].G=12;
-        if (nvdsp_PEQ[i].G<-12) nvdsp_PEQ[i].G=-12;
+        float G=eq_biquad->getG(i)+delta;
+        if (G>12) G=12;
+        if (G<-12) G=-12;
+        eq_biquad->setG(i,G);
         slider=(UISlider*)[self.view viewWithTag:i+1];
-        slider.value=nvdsp_PEQ[i].G;
+        slider.value=G;
     }
 }
 
@@ -68,8 +65,8 @@ extern BOOL nvdsp_EQ;
 
 - (void)sliderChanged:(id)sender {
     UISlider *slider=(UISlider *)sender;
-    nvdsp_PEQ[slider.tag-1].G=slider.value;
-    eqLabelValue[slider.tag-1].text=[NSString stringWithFormat:@"%.1fdB",nvdsp_PEQ[slider.tag-1].G];
+    eq_biquad->setG(slider.tag-1,slider.value);
+    eqLabelValue[slider.tag-1].text=[NSString stringWithFormat:@"%.1fdB",eq_biquad->getG(slider.tag-1)];
 }
 
 + (void) restoreEQSettings {
@@ -80,15 +77,15 @@ extern BOOL nvdsp_EQ;
     for (int i=0;i<EQUALIZER_NB_BANDS;i++) {
         str=[NSString stringWithFormat:@"eq_centerFrequencies_%d",i];
         valNb=[prefs objectForKey:str];
-        if (valNb!=nil) nvdsp_PEQ[i].centerFrequency=[valNb floatValue];
+        if (valNb!=nil) eq_biquad->setCenterFrequency(i,[valNb floatValue]);
         
         str=[NSString stringWithFormat:@"eq_Q_%d",i];
         valNb=[prefs objectForKey:str];
-        if (valNb!=nil) nvdsp_PEQ[i].Q=[valNb floatValue];
+        if (valNb!=nil) eq_biquad->setQ(i,[valNb floatValue]);
         
         str=[NSString stringWithFormat:@"eq_G_%d",i];
         valNb=[prefs objectForKey:str];
-        if (valNb!=nil) nvdsp_PEQ[i].G=[valNb floatValue];
+        if (valNb!=nil) eq_biquad->setG(i,[valNb floatValue]);
     }
     
     valNb=[prefs objectForKey:@"nvdsp_EQ"];
@@ -102,15 +99,15 @@ extern BOOL nvdsp_EQ;
     
 	for (int i=0;i<EQUALIZER_NB_BANDS;i++) {
         str=[NSString stringWithFormat:@"eq_centerFrequencies_%d",i];
-        valNb=[[NSNumber alloc] initWithFloat:nvdsp_PEQ[i].centerFrequency];
+        valNb=[[NSNumber alloc] initWithFloat:eq_biquad->getCenterFrequency(i)];
         [prefs setObject:valNb forKey:str];[valNb autorelease];
     
         str=[NSString stringWithFormat:@"eq_Q_%d",i];
-        valNb=[[NSNumber alloc] initWithFloat:nvdsp_PEQ[i].Q];
+        valNb=[[NSNumber alloc] initWithFloat:eq_biquad->getQ(i)];
         [prefs setObject:valNb forKey:str];[valNb autorelease];
     
         str=[NSString stringWithFormat:@"eq_G_%d",i];
-        valNb=[[NSNumber alloc] initWithFloat:nvdsp_PEQ[i].G];
+        valNb=[[NSNumber alloc] initWithFloat:eq_biquad->getG(i)];
         [prefs setObject:valNb forKey:str];[valNb autorelease];
     }
     
@@ -266,13 +263,13 @@ extern BOOL nvdsp_EQ;
     [self recomputeFrames];
     
     for (int i=0;i<EQUALIZER_NB_BANDS;i++) {
-        eqSlider[i].value=nvdsp_PEQ[i].G;
-        if (nvdsp_PEQ[i].centerFrequency>=1000) {
-            eqLabelFreq[i].text=[NSString stringWithFormat:@"%.0fKhz",nvdsp_PEQ[i].centerFrequency/1000];
+        eqSlider[i].value=eq_biquad->getG(i);
+        if (eq_biquad->getCenterFrequency(i)>=1000) {
+            eqLabelFreq[i].text=[NSString stringWithFormat:@"%.0fKhz",eq_biquad->getCenterFrequency(i)/1000];
         } else {
-            eqLabelFreq[i].text=[NSString stringWithFormat:@"%.0fHz",nvdsp_PEQ[i].centerFrequency];
+            eqLabelFreq[i].text=[NSString stringWithFormat:@"%.0fHz",eq_biquad->getCenterFrequency(i)];
         }
-        eqLabelValue[i].text=[NSString stringWithFormat:@"%.1fdB",nvdsp_PEQ[i].G];
+        eqLabelValue[i].text=[NSString stringWithFormat:@"%.1fdB",eq_biquad->getG(i)];
         
     }
 }
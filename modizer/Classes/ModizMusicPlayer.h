@@ -261,6 +261,7 @@ static const char *mmp_player_name[]={
 -(void) Seek:(int)seek_time;
 
 -(int) getSongLengthfromMD5:(int)track_nb;
+-(int) getSongLengthfromMD5:(int)track_nb md5:(const char*)md5;
 -(void) setSongLengthfromMD5:(int)track_nb songlength:(int)slength;
 
 -(ModPlug_Settings*) getMPSettings;
@@ -273,6 +274,9 @@ static const char *mmp_player_name[]={
 -(void) PlaySeek:(int)startPos subsong:(int)subsong;
 -(int) isAcceptedFile:(NSString*)_filePath;
 -(int) LoadModule:(NSString*)_filePath defaultMODPLAYER:(int)defaultMODPLAYER defaultSAPPLAYER:(int)defaultSAPPLAYER defaultVGMPLAYER:(int)defaultVGMPLAYER slowDevice:(int)slowDevice archiveMode:(int)archiveMode archiveIndex:(int)archiveIndex singleSubMode:(int)singleSubMode singleArcMode:(int)singleArcMode;
+//gapless playback
+-(void) PrerollModule:(NSString*)_filePath;
+-(BOOL) isPrerollStarted;
 
 -(float) getIphoneVolume;
 -(void) setIphoneVolume:(float) vol;
@@ -385,6 +389,10 @@ static const char *mmp_player_name[]={
 -(int) mmp_asapLoad:(NSString*)filePath;
 -(int) mmp_adplugLoad:(NSString*)filePath;
 -(int) mmp_gmeLoad:(NSString*)filePath;
+-(int) mmp_prerollLoad:(NSString*)filePath playerType:(int)playerType;
+-(void) mmp_prerollFree;
+-(void) mmp_prerollCancel;
+-(int) mmp_prerollSwitch:(short int*)dst frame:(int)frame;
 -(int) mmp_2sfLoad:(NSString*)filePath;
 
 
@@ -7,12 +7,13 @@
 //
 
 #include <pthread.h>
+#include <sys/time.h>
 #include <sqlite3.h>
 #include <sys/xattr.h>
 
 #include "fex.h"
+#include "DBHelper.h"
 
-extern pthread_mutex_t db_mutex;
 extern pthread_mutex_t play_mutex;
 
 int iModuleLength;
@@ -24,21 +25,11 @@ int mod_total_length;
 
 #import "ModizMusicPlayer.h"
 
-//NVDSP
-#import "Novocaine.h"
-#import "NVDSP.h"
-#import "NVPeakingEQFilter.h"
-#import "NVSoundLevelMeter.h"
-#import "NVClippingDetection.h"
-NVClippingDetection *nvdsp_CDT;
-float nvdsp_sr = 44100;
+//Equalizer
+#include "EQBiquad.hpp"
+EQBiquad *eq_biquad;
 // define center frequencies of the bands
-float nvdsp_centerFrequencies[10];
-// define Q factor of the bands
-float nvdsp_QFactor = 2.0f;
-// define initial gain
-float nvdsp_initialGain = 0.0f;
-NVPeakingEQFilter *nvdsp_PEQ[EQUALIZER_NB_BANDS];
+static const float eq_centerFrequencies[EQUALIZER_NB_BANDS]={60.0f,170.0f,310.0f,600.0f,1000.0f,3000.0f,6000.0f,12000.0f,14000.0f,16000.0f};
 BOOL nvdsp_EQ;
 float nvdsp_outData[SOUND_BUFFER_SIZE_SAMPLE*2];
 
@@ -64,6 +55,7 @@ static char **sidtune_title,**sidtune_name;
 static char gmetype[64];
 
 static uint32 ao_type;
+static void *ao_ctx;
 volatile int mSlowDevice;
 static volatile int moveToPrevSubSong,moveToNextSubSong,mod_wantedcurrentsub,mChangeOfSong,mNewModuleLength,moveToSubSong,moveToSubSongIndex;
 static int sampleVolume,mInterruptShoudlRestart;
@@ -99,6 +91,22 @@ static int mdz_IsArchive,mdz_ArchiveFilesCnt,mdz_currentArchiveIndex;
 static int mdz_defaultMODPLAYER,mdz_defaultSAPPLAYER,mdz_defaultVGMPLAYER;
 static char **mdz_ArchiveFilesList;
 //static char **mdz_ArchiveFilesListAlias;
+static int mdz_ArchiveInMemory; //entries are decompressed on demand instead of being extracted to tmp/tmpArchive
+static char mdz_ArchivePath[1024];
+//table of contents (playable entries) of the current archive, cached on disk so that packs are scanned only once
+typedef struct {
+    char *name;
+    fex_pos_t pos;
+} mdz_ArchiveTocEntry;
+static mdz_ArchiveTocEntry *mdz_ArchiveToc;
+static int mdz_ArchiveTocCnt,mdz_ArchiveTocAuxCnt;
+static char mdz_ArchiveTocPath[1024];
+//current archive stays opened between entries: the last decoded 7z solid block is kept
+//and solid rar extraction resumes from the previous entry instead of the archive start
+static fex_t *mdz_ArchiveFex;
+static char mdz_ArchiveFexPath[1024];
+static unsigned long long mdz_ArchiveFexSize;
+static NSTimeInterval mdz_ArchiveFexDate;
 
 static NSFileManager *mFileMngr;
 
@@ -182,12 +190,12 @@ static gme_effects_t gme_fx;
 static struct {
     uint32 sig;
     const char *name;
-    int32 (*start)(uint8 *, uint32, int32, int32);
-    int32 (*gen)(int16 *, uint32);
-    int32 (*stop)(void);
-    int32 (*command)(int32, int32);
+    void *(*start)(uint8 *, uint32, int32, int32);
+    int32 (*gen)(void *, int16 *, uint32);
+    int32 (*stop)(void *);
+    int32 (*command)(void *, int32, int32);
     uint32 rate;
-    int32 (*fillinfo)(ao_display_info *);
+    int32 (*fillinfo)(void *, ao_display_info *);
 } ao_types[] = {
     { 0x50534601, "Sony PlayStation (.psf)", psf_start, psf_gen, psf_stop, psf_command, 60, psf_fill_info },
     { 0x53505500, "Sony PlayStation (.spu)", spu_start, spu_gen, spu_stop, spu_command, 60, spu_fill_info },
@@ -549,8 +557,14 @@ extern "C" {
 #include "md5.h"
     
     
-    void uade_dummy_wait() {
-        [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_UADE_MS];
+    //uadecore <-> frontend transport (unixatomic.c) : per ring, one semaphore signaled when data is
+    //written (reader waits on it) and one signaled when data is read (writer waits on it)
+    static dispatch_semaphore_t uade_ipc_sem[2][2];
+    void uade_ipc_wait(int fd,int space) {
+        dispatch_semaphore_wait(uade_ipc_sem[fd][space],dispatch_time(DISPATCH_TIME_NOW,(int64_t)SOUND_RING_WAIT_TIME_MS*NSEC_PER_MSEC));
+    }
+    void uade_ipc_signal(int fd,int space) {
+        dispatch_semaphore_signal(uade_ipc_sem[fd][space]);
     }
     
     int uade_main (int argc, char **argv);
@@ -573,12 +587,85 @@ static 	int buffer_ana_subofs;
 static short int **buffer_ana;
 static volatile int uadeThread_running,timThread_running;
 static volatile int buffer_ana_gen_ofs,buffer_ana_play_ofs;
-static volatile int *buffer_ana_flag;
+static int *buffer_ana_flag;
+static dispatch_semaphore_t buffer_ana_freed;
+static volatile int buffer_ana_waiters;
 static volatile int bGlobalIsPlaying,bGlobalShouldEnd,bGlobalSeekProgress,bGlobalEndReached,bGlobalSoundGenInProgress,bGlobalSoundHasStarted;
 static volatile int mNeedSeek,mNeedSeekTime;
 
-// String holding the relative path to the source directory
-static const char *pathdir;
+/* buffer_ana is a single producer (sound generation) / single consumer (AudioQueue callback) ring.
+ * A slot flag is published with release semantics once samples and per slot metadata
+ * (genPattern, genRow, genVolData, tim_notes...) are written, and read with acquire semantics,
+ * so the consumer always sees a complete slot. More than one thread can wait for a free slot
+ * (UADE core and frontend, generation thread) : each waiter registers itself in buffer_ana_waiters,
+ * and freeing a slot signals the semaphore once per registered waiter, so that all of them wake up
+ * and check the slot again. The release side (AudioQueue callback) takes no lock. */
+static inline int ringSlotFilled(int ofs) {
+    return __atomic_load_n(&buffer_ana_flag[ofs],__ATOMIC_ACQUIRE);
+}
+static inline void ringPublishSlot(int ofs,int flags) {
+    __atomic_store_n(&buffer_ana_flag[ofs],flags,__ATOMIC_RELEASE);
+}
+static inline void ringReleaseSlot(int ofs) {
+    __atomic_store_n(&buffer_ana_flag[ofs],0,__ATOMIC_SEQ_CST);
+    //the flag store is ordered before the waiter count read : a waiter registered
+    //after this point sees the free slot and does not block
+    int waiters=__atomic_load_n(&buffer_ana_waiters,__ATOMIC_SEQ_CST);
+    for (int i=0;i<waiters;i++) dispatch_semaphore_signal(buffer_ana_freed);
+}
+static inline void ringWaitFreeSlot(void) {
+    __atomic_fetch_add(&buffer_ana_waiters,1,__ATOMIC_SEQ_CST);
+    //timeout so that callers can still check for stop/end requests
+    if (__atomic_load_n(&buffer_ana_flag[buffer_ana_gen_ofs],__ATOMIC_SEQ_CST))
+        dispatch_semaphore_wait(buffer_ana_freed,dispatch_time(DISPATCH_TIME_NOW,(int64_t)SOUND_RING_WAIT_TIME_MS*NSEC_PER_MSEC));
+    __atomic_fetch_sub(&buffer_ana_waiters,1,__ATOMIC_SEQ_CST);
+}
+
+/* Gapless playback : the next playlist entry is opened, started and rendered ahead on its own
+ * engine instance while the current one plays (GME & AOSDK only, the other engines keep a single
+ * global state). When the current entry ends, the generation thread swaps the engines and completes
+ * the slot with the frames rendered ahead, so the ring switches source on the exact sample.
+ * mmp_preroll is filled on preroll_queue with preroll_mutex held, the generation thread only
+ * try-locks it. preroll_serial is bumped on Stop so that a late pre-roll request is dropped, and
+ * an entry loaded for an older serial is released by preroll_queue itself, never switched to. */
+#define PREROLL_NONE 0
+#define PREROLL_READY 1
+static struct {
+    int state,serial;
+    unsigned int play_type;
+    Music_Emu *gme_emu;
+    int *gme_scanned_length,gme_scanned_length_nb;
+    uint32 ao_type;
+    void *ao_ctx;
+    unsigned char *ao_buffer;
+    ao_display_info ao_info;
+    int datasize,numChannels,length,total_length;
+    int subsongs,minsub,maxsub;
+    char name[256],filename[512],gmetype[64],md5[33];
+    char message[8192+MAX_STIL_DATA_LENGTH];
+    short int *data; //first frames of the entry, rendered ahead
+    int data_len;
+} mmp_preroll;
+static pthread_mutex_t preroll_mutex=PTHREAD_MUTEX_INITIALIZER;
+static dispatch_queue_t preroll_queue;
+static volatile int preroll_serial,mPrerollStarted;
+//frames rendered ahead which still have to be played after a switch
+static short int *preroll_drain_data;
+static int preroll_drain_len,preroll_drain_ofs;
+
+static int prerollDrain(short int *dst,int frames) {
+    int n=preroll_drain_len-preroll_drain_ofs;
+    if (n<=0) return 0;
+    if (n>frames) n=frames;
+    memcpy(dst,preroll_drain_data+preroll_drain_ofs*2,n*2*2);
+    preroll_drain_ofs+=n;
+    return n;
+}
+
+// String holding the relative path to the source directory. Read by ao_get_lib while an engine
+// starts, on the thread which loads it: per thread so that a pre-roll does not change the one
+// of a load running on the main thread.
+static __thread const char *pathdir;
 
 static int tim_open_output(void) {
     return 0;
@@ -593,8 +680,8 @@ static int tim_output_data(char *buf, int32 nbytes) {
         g_playing=0;
         return 0;
     }
-    while (buffer_ana_flag[buffer_ana_gen_ofs]) {
-        [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
+    while (ringSlotFilled(buffer_ana_gen_ofs)) {
+        ringWaitFreeSlot();
         if (bGlobalShouldEnd||(!bGlobalIsPlaying)) {
             g_playing=0;
             return 0;
@@ -657,13 +744,12 @@ static int tim_output_data(char *buf, int32 nbytes) {
         tim_voicenb[buffer_ana_gen_ofs]=voices;
         
         
-        buffer_ana_flag[buffer_ana_gen_ofs]=1;
-        
+        int slot_flags=1;
         if ((mNeedSeek==2)&&(tim_pending_seek==-1)) {
             mNeedSeek=3;
-            buffer_ana_flag[buffer_ana_gen_ofs]|=2;
+            slot_flags|=2;
         }
-        
+        ringPublishSlot(buffer_ana_gen_ofs,slot_flags);
         
         buffer_ana_gen_ofs++;
         if (buffer_ana_gen_ofs==SOUND_BUFFER_NB) buffer_ana_gen_ofs=0;
@@ -671,8 +757,8 @@ static int tim_output_data(char *buf, int32 nbytes) {
         if (nbytes>=SOUND_BUFFER_SIZE_SAMPLE*2*2) {
             NSLog(@"*****************\n*****************\n***************");
         } else if (nbytes) {
-            while (buffer_ana_flag[buffer_ana_gen_ofs]) {
-                [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
+            while (ringSlotFilled(buffer_ana_gen_ofs)) {
+                ringWaitFreeSlot();
                 if (bGlobalShouldEnd||(!bGlobalIsPlaying)) {
                     g_playing=0;
                     return 0;
@@ -790,6 +876,19 @@ static void md5_from_buffer(char *dest, size_t destlen,char * buf, size_t bufsiz
     }
 }
 
+//GME tracks without length tag : lengths found by the background scanner (ms, <=0 if unknown)
+static int *gme_scanned_length;
+static int gme_scanned_length_nb;
+
+static int gmeScannedTrackLength(const int *scanned_length,int scanned_length_nb,int play_length,int track) {
+    if (play_length>0) return play_length;
+    if ((track>=0)&&(track<scanned_length_nb)&&(scanned_length[track]>0)) return scanned_length[track];
+    return optGENDefaultLength;
+}
+static int gmeTrackLength(int play_length,int track) {
+    return gmeScannedTrackLength(gme_scanned_length,gme_scanned_length_nb,play_length,track);
+}
+
 static void writeLEword(unsigned char ptr[2], int someWord)
 {
     ptr[0] = (someWord & 0xFF);
@@ -1092,6 +1191,14 @@ void propertyListenerCallback (void                   *inUserData,
         
         
         buffer_ana_flag=(int*)malloc(SOUND_BUFFER_NB*sizeof(int));
+        buffer_ana_freed=dispatch_semaphore_create(0);
+        preroll_queue=dispatch_queue_create("modizer.preroll", DISPATCH_QUEUE_SERIAL);
+        mmp_preroll.data=(short int *)malloc(SOUND_PREROLL_BUFFER_NB*SOUND_BUFFER_SIZE_SAMPLE*2*2);
+        preroll_drain_data=(short int *)malloc(SOUND_PREROLL_BUFFER_NB*SOUND_BUFFER_SIZE_SAMPLE*2*2);
+        for (int i=0;i<2;i++) {
+            uade_ipc_sem[i][0]=dispatch_semaphore_create(0);
+            uade_ipc_sem[i][1]=dispatch_semaphore_create(0);
+        }
         buffer_ana=(short int**)malloc(SOUND_BUFFER_NB*sizeof(unsigned short int *));
         buffer_ana_cpy=(short int**)malloc(SOUND_BUFFER_NB*sizeof(unsigned short int *));
         buffer_ana_subofs=0;
@@ -1119,6 +1226,7 @@ void propertyListenerCallback (void                   *inUserData,
 //        mdz_ArchiveFilesListAlias=NULL;
         mdz_ArchiveFilesCnt=0;
         mdz_IsArchive=0;
+        mdz_ArchiveInMemory=0;
         mdz_currentArchiveIndex=0;
         //Timidity
         
@@ -1232,39 +1340,12 @@ void propertyListenerCallback (void                   *inUserData,
         //
         
         
-        // NVDSP
+        // Equalizer, Q factor 2 and flat gain by default
         //
         nvdsp_EQ=0;
-        nvdsp_sr = PLAYBACK_FREQ;
-        //clipping util
-        nvdsp_CDT = [[NVClippingDetection alloc] init];
-        
-        // define center frequencies of the bands
-        nvdsp_centerFrequencies[0] = 60.0f;
-        nvdsp_centerFrequencies[1] = 170.0f;
-        nvdsp_centerFrequencies[2] = 310.0f;
-        nvdsp_centerFrequencies[3] = 600.0f;
-        nvdsp_centerFrequencies[4] = 1000.0f;
-        nvdsp_centerFrequencies[5] = 3000.0f;
-        nvdsp_centerFrequencies[6] = 6000.0f;
-        nvdsp_centerFrequencies[7] = 12000.0f;
-        nvdsp_centerFrequencies[8] = 14000.0f;
-        nvdsp_centerFrequencies[9] = 16000.0f;
-        
-        // define Q factor of the bands
-        nvdsp_QFactor = 2.0f;
-        
-        // define initial gain
-        nvdsp_initialGain = 0.0f;
-        
-        // init PeakingFilters
-        // You'll later need to be able to set the gain for these (as the sliders change)
-        // So define them somewhere global using NVPeakingEQFilter *PEQ[10];
-        for (int i = 0; i < 10; i++) {
-            nvdsp_PEQ[i] = [[NVPeakingEQFilter alloc] initWithSamplingRate:nvdsp_sr];
-            nvdsp_PEQ[i].Q = nvdsp_QFactor;
-            nvdsp_PEQ[i].centerFrequency = nvdsp_centerFrequencies[i];
-            nvdsp_PEQ[i].G = nvdsp_initialGain;
+        eq_biquad=new EQBiquad(PLAYBACK_FREQ);
+        for (int i = 0; i < EQUALIZER_NB_BANDS; i++) {
+            eq_biquad->setBand(i,eq_centerFrequencies[i],2.0f,0.0f);
         }
         
         //restore EQ settings
@@ -1286,7 +1367,18 @@ void propertyListenerCallback (void                   *inUserData,
     }
     free(buffer_ana_cpy);
     free(buffer_ana);
-    free((void*)buffer_ana_flag);
+    free(buffer_ana_flag);
+    dispatch_release(buffer_ana_freed);
+    //a cancelled pre-roll may still be loading: let it end before its buffers go away
+    dispatch_sync(preroll_queue, ^{});
+    [self mmp_prerollFree];
+    dispatch_release(preroll_queue);
+    free(mmp_preroll.data);
+    free(preroll_drain_data);
+    for (int i=0;i<2;i++) {
+        dispatch_release(uade_ipc_sem[i][0]);
+        dispatch_release(uade_ipc_sem[i][1]);
+    }
     free(playRow);
     free(playPattern);
     free(playVolData);
@@ -1296,6 +1388,9 @@ void propertyListenerCallback (void                   *inUserData,
     free(genVolData);
     //free(genOffset);
     
+    delete eq_biquad;
+    eq_biquad=NULL;
+    
     if (duh_player) {
         free(duh_player);duh_player=NULL;
     }
@@ -1391,6 +1486,8 @@ void propertyListenerCallback (void                   *inUserData,
         memset(tim_notes_cpy[i],0,DEFAULT_VOICES*4);
         tim_voicenb[i]=tim_voicenb_cpy[i]=0;
     }
+    //drop wakeups left by waiters which timed out
+    while (dispatch_semaphore_wait(buffer_ana_freed,DISPATCH_TIME_NOW)==0);
     
     sampleVolume=0;
     for (i=0; i<SOUND_BUFFER_NB; i++) {
@@ -1438,21 +1535,65 @@ void propertyListenerCallback (void                   *inUserData,
     AudioQueueReset( mAudioQueue );
     mQueueIsBeingStopped = FALSE;
 }
+
+/* Output post processing works on a float bus (nvdsp_outData, samples in [-1,1[) :
+ * postMixBuffer applies panning, mono downmix and volume ramp in a single pass,
+ * the EQ filters the bus in place and postOutputBuffer limits and converts to int16
+ * once, straight into the AudioQueue buffer.
+ * Loops are kept branch free so that the compiler can vectorize them. */
+static int postMixBuffer(const short int * __restrict src,short int * __restrict ana_cpy,float * __restrict bus,int volume,int panning,int mono) {
+    //panning keeps l+r unchanged, so mono downmix can be done after it
+    const float p=(float)panning/256.0f;
+    const float a=(mono?0.5f:1.0f),b=(mono?0.5f:0.0f);
+    for (int i=0;i<SOUND_BUFFER_SIZE_SAMPLE;i++) {
+        float l=src[i*2];
+        float r=src[i*2+1];
+        float m=(r-l)*p;
+        l+=m;
+        r-=m;
+        ana_cpy[i*2]=(short int)l;
+        ana_cpy[i*2+1]=(short int)r;
+        //volume ramp from 0 to 256, one step per frame
+        float g=fminf((float)(volume+i),256.0f)*(1.0f/(256.0f*32768.0f));
+        bus[i*2]=(l*a+r*b)*g;
+        bus[i*2+1]=(l*b+r*a)*g;
+    }
+    volume+=SOUND_BUFFER_SIZE_SAMPLE;
+    return (volume>256?256:volume);
+}
+static void postOutputBuffer(const float * __restrict bus,short int * __restrict out,int limit) {
+    float gain=32768.0f;
+    if (limit) {
+        //lower gain by 0.9 steps until the EQ output does not clip, found from the peak in one scan
+        float peak=0;
+        for (int i=0;i<SOUND_BUFFER_SIZE_SAMPLE*2;i++) peak=fmaxf(peak,fabsf(bus[i]));
+        while (peak>=1.0f) {
+            peak*=0.9f;
+            gain*=0.9f;
+        }
+    }
+    for (int i=0;i<SOUND_BUFFER_SIZE_SAMPLE*2;i++) {
+        float v=bus[i]*gain;
+        out[i]=(short int)fminf(fmaxf(v,-32768.0f),32767.0f);
+    }
+}
 -(void) iPhoneDrv_Update:(AudioQueueBufferRef) mBuffer {
     /* the real processing takes place in FillAudioBuffer */
     [self iPhoneDrv_FillAudioBuffer:mBuffer];
 }
 -(BOOL) iPhoneDrv_FillAudioBuffer:(AudioQueueBufferRef) mBuffer {
     int skip_queue=0;
+    int post_filled=0;
     mBuffer->mAudioDataByteSize = SOUND_BUFFER_SIZE_SAMPLE*2*2;
     if (bGlobalAudioPause==2) {
         memset(mBuffer->mAudioData, 0, SOUND_BUFFER_SIZE_SAMPLE*2*2);
         if (bGlobalAudioPause==2) skip_queue=1;//return 0;  //End of song
     } else {
         //consume another buffer
-        if (buffer_ana_flag[buffer_ana_play_ofs]) {
+        int slot_flags=ringSlotFilled(buffer_ana_play_ofs);
+        if (slot_flags) {
             bGlobalSoundHasStarted++;
-            if (buffer_ana_flag[buffer_ana_play_ofs]&2) { //changed currentTime
+            if (slot_flags&2) { //changed currentTime
                 iCurrentTime=mNeedSeekTime;
                 mNeedSeek=0;
                 bGlobalSeekProgress=0;
@@ -1482,91 +1623,45 @@ void propertyListenerCallback (void                   *inUserData,
              }
              }*/
             
-            /* Panning effect. Turns stereo into mono in a specific degree */
-            if (mPanning) {
-                int i, l, r, m;
-                short int *sm=buffer_ana[buffer_ana_play_ofs];
-                for (i = 0; i < SOUND_BUFFER_SIZE_SAMPLE; i += 1) {
-                    l = 32768+sm[0];
-                    r = 32768+sm[1];
-                    m = (r - l) * mPanningValue;
-                    sm[0] = (((l << 8) + m) >> 8)-32768;
-                    sm[1] = (((r << 8) - m) >> 8)-32768;
-                    sm += 2;
-                }
-            }
-            
-            
-            if (sampleVolume<256) {
-                if (optForceMono) {
-                    for (int i=0;i<SOUND_BUFFER_SIZE_SAMPLE;i++) {
-                        int val=((short int *)mBuffer->mAudioData)[i*2+1]=((buffer_ana[buffer_ana_play_ofs][i*2]+buffer_ana[buffer_ana_play_ofs][i*2+1])/2)*sampleVolume/256;
-                        ((short int *)mBuffer->mAudioData)[i*2]=val;
-                        ((short int *)mBuffer->mAudioData)[i*2+1]=val;
-                        if (sampleVolume<256) sampleVolume++;
-                    }
-                } else for (int i=0;i<SOUND_BUFFER_SIZE_SAMPLE;i++) {
-                    ((short int *)mBuffer->mAudioData)[i*2]=buffer_ana[buffer_ana_play_ofs][i*2]*sampleVolume/256;
-                    ((short int *)mBuffer->mAudioData)[i*2+1]=buffer_ana[buffer_ana_play_ofs][i*2+1]*sampleVolume/256;
-                    if (sampleVolume<256) sampleVolume++;
-                }
-            }
-            else {
-                if (optForceMono) {
-                    for (int i=0;i<SOUND_BUFFER_SIZE_SAMPLE;i++) {
-                        int val=((short int *)mBuffer->mAudioData)[i*2+1]=((buffer_ana[buffer_ana_play_ofs][i*2]+buffer_ana[buffer_ana_play_ofs][i*2+1])/2)*sampleVolume/256;
-                        ((short int *)mBuffer->mAudioData)[i*2]=val;
-                        ((short int *)mBuffer->mAudioData)[i*2+1]=val;
-                    }
-                } else memcpy((char*)mBuffer->mAudioData,buffer_ana[buffer_ana_play_ofs],SOUND_BUFFER_SIZE_SAMPLE*2*2);
-            }
-            memcpy(buffer_ana_cpy[buffer_ana_play_ofs],buffer_ana[buffer_ana_play_ofs],SOUND_BUFFER_SIZE_SAMPLE*2*2);
+            /* Panning (turns stereo into mono in a specific degree), mono downmix & volume ramp */
+            sampleVolume=postMixBuffer(buffer_ana[buffer_ana_play_ofs],buffer_ana_cpy[buffer_ana_play_ofs],nvdsp_outData,
+                                       sampleVolume,(mPanning?mPanningValue:0),optForceMono);
+            post_filled=1;
             
-            if (buffer_ana_flag[buffer_ana_play_ofs]&4) { //end reached
+            if (slot_flags&4) { //end reached
                 //iCurrentTime=0;
                 bGlobalAudioPause=2;
             }
             
-            if (buffer_ana_flag[buffer_ana_play_ofs]&8) { //end reached but continue to play
+            if (slot_flags&8) { //end reached but continue to play
                 iCurrentTime=0;
                 iModuleLength=mNewModuleLength;
                 mChangeOfSong=0;
                 mod_message_updated=1;
             }
             
+            if (slot_flags&16) { //next playlist entry started gaplessly
+                mPrerollStarted=1;
+            }
+            
             
-            buffer_ana_flag[buffer_ana_play_ofs]=0;
+            ringReleaseSlot(buffer_ana_play_ofs);
             buffer_ana_play_ofs++;
             if (buffer_ana_play_ofs==SOUND_BUFFER_NB) buffer_ana_play_ofs=0;
+        } else if (nvdsp_EQ) {
+            //keep the EQ filters running on silence
+            memset(nvdsp_outData,0,SOUND_BUFFER_SIZE_SAMPLE*2*sizeof(float));
+            post_filled=1;
         } else {
             memset((char*)mBuffer->mAudioData,0,SOUND_BUFFER_SIZE_SAMPLE*2*2);  //WARNING : not fast enough!!
         }
     }
     if (!skip_queue) {
-        if (nvdsp_EQ) {
-            for (int i=0;i<SOUND_BUFFER_SIZE_SAMPLE;i++) {
-                nvdsp_outData[i*2]=(float)(((short int *)mBuffer->mAudioData)[i*2])/32768.0;
-                nvdsp_outData[i*2+1]=(float)(((short int *)mBuffer->mAudioData)[i*2+1])/32768.0;
-            }
-            
-            // apply the filter
-            for (int i = 0; i < 10; i++) {
-                [nvdsp_PEQ[i] filterData:nvdsp_outData numFrames:SOUND_BUFFER_SIZE_SAMPLE numChannels:2];
-            }
-            [nvdsp_CDT counterClipping:nvdsp_outData numFrames:SOUND_BUFFER_SIZE_SAMPLE numChannels:2];
-            
-            // measure output level
-            //        outputLevelBuffer = [outPutWatcher getdBLevel:outData numFrames:numFrames numChannels:numChannels];
-            
-            
-            for (int i=0;i<SOUND_BUFFER_SIZE_SAMPLE;i++) {
-                ((short int *)mBuffer->mAudioData)[i*2]=nvdsp_outData[i*2]*32767.0;
-                ((short int *)mBuffer->mAudioData)[i*2+1]=nvdsp_outData[i*2+1]*32767.0;
-            }
-            
+        if (post_filled) {
+            if (nvdsp_EQ) eq_biquad->process(nvdsp_outData,SOUND_BUFFER_SIZE_SAMPLE);
+            postOutputBuffer(nvdsp_outData,(short int *)mBuffer->mAudioData,nvdsp_EQ);
         }
         
-        
         AudioQueueEnqueueBuffer( mAudioQueue, mBuffer, 0, NULL);
         if (bGlobalAudioPause==2) {
             AudioQueueStop( mAudioQueue, FALSE );
@@ -1586,8 +1681,8 @@ void mdx_update(unsigned char *data,int len,int end_reached) {
         return;
     }
     
-    while (buffer_ana_flag[buffer_ana_gen_ofs]) {
-        [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
+    while (ringSlotFilled(buffer_ana_gen_ofs)) {
+        ringWaitFreeSlot();
         if (bGlobalShouldEnd||(!bGlobalIsPlaying)) {
             mdx_stop();
             return;
@@ -1624,14 +1719,13 @@ void mdx_update(unsigned char *data,int len,int end_reached) {
         buffer_ana_subofs=0;
         
         
+        int slot_flags=1;
         if (mNeedSeek==2) {
             mNeedSeek=3;
-            buffer_ana_flag[buffer_ana_gen_ofs]=3;
-        } else buffer_ana_flag[buffer_ana_gen_ofs]=1;
-        
-        if (end_reached) {
-            buffer_ana_flag[buffer_ana_gen_ofs]|=4;
+            slot_flags=3;
         }
+        if (end_reached) slot_flags|=4;
+        ringPublishSlot(buffer_ana_gen_ofs,slot_flags);
         
         if (mNeedSeek==1) { //ask for seeking
             mNeedSeek=2;  //taken into account
@@ -1647,8 +1741,8 @@ void mdx_update(unsigned char *data,int len,int end_reached) {
             NSLog(@"*****************\n*****************\n***************");
         } else if (len) {
             
-            while (buffer_ana_flag[buffer_ana_gen_ofs]) {
-                [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
+            while (ringSlotFilled(buffer_ana_gen_ofs)) {
+                ringWaitFreeSlot();
                 if (bGlobalShouldEnd||(!bGlobalIsPlaying)) {
                     mdx_stop();
                     return;
@@ -1674,8 +1768,8 @@ void gsf_update(unsigned char* pSound,int lBytes) {
         g_playing=0;
         return;
     }
-    while (buffer_ana_flag[buffer_ana_gen_ofs]) {
-        [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
+    while (ringSlotFilled(buffer_ana_gen_ofs)) {
+        ringWaitFreeSlot();
         if (bGlobalShouldEnd||(!bGlobalIsPlaying)) {
             g_playing=0;
             return;
@@ -1727,12 +1821,12 @@ void gsf_update(unsigned char* pSound,int lBytes) {
         lBytes-=to_fill;
         buffer_ana_subofs=0;
         
-        buffer_ana_flag[buffer_ana_gen_ofs]=1;
-        
+        int slot_flags=1;
         if ((mNeedSeek==2)&&(seek_needed==-1)) {
             mNeedSeek=3;
-            buffer_ana_flag[buffer_ana_gen_ofs]|=2;
+            slot_flags|=2;
         }
+        ringPublishSlot(buffer_ana_gen_ofs,slot_flags);
         
         buffer_ana_gen_ofs++;
         if (buffer_ana_gen_ofs==SOUND_BUFFER_NB) buffer_ana_gen_ofs=0;
@@ -1740,8 +1834,8 @@ void gsf_update(unsigned char* pSound,int lBytes) {
         if (lBytes>=SOUND_BUFFER_SIZE_SAMPLE*2*2) {
             NSLog(@"*****************\n*****************\n***************");
         } else if (lBytes) {
-            while (buffer_ana_flag[buffer_ana_gen_ofs]) {
-                [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
+            while (ringSlotFilled(buffer_ana_gen_ofs)) {
+                ringWaitFreeSlot();
                 if (bGlobalShouldEnd||(!bGlobalIsPlaying)) {
                     g_playing=0;
                     return;
@@ -1787,8 +1881,8 @@ void sexyd_update(unsigned char* pSound,long lBytes) {
         return;
     }
     
-    while (buffer_ana_flag[buffer_ana_gen_ofs]) {
-        [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
+    while (ringSlotFilled(buffer_ana_gen_ofs)) {
+        ringWaitFreeSlot();
         if (bGlobalShouldEnd||(!bGlobalIsPlaying)) {
             sexy_stop();
             return;
@@ -1808,8 +1902,8 @@ void sexyd_update(unsigned char* pSound,long lBytes) {
         
         if (mNeedSeek==2) {
             mNeedSeek=3;
-            buffer_ana_flag[buffer_ana_gen_ofs]=3;
-        } else buffer_ana_flag[buffer_ana_gen_ofs]=1;
+            ringPublishSlot(buffer_ana_gen_ofs,3);
+        } else ringPublishSlot(buffer_ana_gen_ofs,1);
         
         if (mNeedSeek==1) { //ask for seeking
             mNeedSeek=2;  //taken into account
@@ -1825,8 +1919,8 @@ void sexyd_update(unsigned char* pSound,long lBytes) {
             //NSLog(@"*****************\n*****************\n***************");
         } else if (lBytes) {
             
-            while (buffer_ana_flag[buffer_ana_gen_ofs]) {
-                [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
+            while (ringSlotFilled(buffer_ana_gen_ofs)) {
+                ringWaitFreeSlot();
                 if (bGlobalShouldEnd||(!bGlobalIsPlaying)) {
                     sexy_stop();
                     return;
@@ -1888,8 +1982,8 @@ void sexyd_update(unsigned char* pSound,long lBytes) {
 //invoked by secondary UADE thread, in charge of receiving sound data
 int uade_audio_play(char *pSound,int lBytes,int song_end) {
     do {
-        while (buffer_ana_flag[buffer_ana_gen_ofs]) {
-            [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
+        while (ringSlotFilled(buffer_ana_gen_ofs)) {
+            ringWaitFreeSlot();
             if (bGlobalShouldEnd||(!bGlobalIsPlaying)) {
                 return 0;
             }
@@ -1902,7 +1996,7 @@ int uade_audio_play(char *pSound,int lBytes,int song_end) {
             lBytes=0;
             if (song_end) {
                 memset( (char*)(buffer_ana[buffer_ana_gen_ofs])+buffer_ana_subofs,0,SOUND_BUFFER_SIZE_SAMPLE*2*2-buffer_ana_subofs);
-                buffer_ana_flag[buffer_ana_gen_ofs]=1|4;
+                ringPublishSlot(buffer_ana_gen_ofs,1|4);
                 buffer_ana_gen_ofs++;
                 if (buffer_ana_gen_ofs==SOUND_BUFFER_NB) buffer_ana_gen_ofs=0;
             }
@@ -1912,10 +2006,7 @@ int uade_audio_play(char *pSound,int lBytes,int song_end) {
             pSound+=to_fill;
             buffer_ana_subofs=0;
             
-            buffer_ana_flag[buffer_ana_gen_ofs]=1;
-            if (song_end) {
-                buffer_ana_flag[buffer_ana_gen_ofs]=1|4;
-            }
+            ringPublishSlot(buffer_ana_gen_ofs,(song_end?1|4:1));
             
             buffer_ana_gen_ofs++;
             if (buffer_ana_gen_ofs==SOUND_BUFFER_NB) buffer_ana_gen_ofs=0;
@@ -1935,10 +2026,13 @@ int uade_audio_play(char *pSound,int lBytes,int song_end) {
     char formatName[128];
     char moduleName[128];
     
-    uint8_t space[UADE_MAX_MESSAGE_SIZE];
-    struct uade_msg *um = (struct uade_msg *) space;
+    //messages are received alternately in 2 buffers : sample data is played from where
+    //it was received, while the following messages go to the other buffer
+    uint8_t space[2][UADE_MAX_MESSAGE_SIZE];
+    int space_idx=0;
+    struct uade_msg *um = (struct uade_msg *) space[0];
     
-    uint8_t sampledata[UADE_MAX_MESSAGE_SIZE];
+    uint8_t *sampledata=((struct uade_msg *) space[1])->data;
     int left = 0;
     int what_was_left = 0;
     
@@ -2139,7 +2233,7 @@ int uade_audio_play(char *pSound,int lBytes,int song_end) {
             }
             
             /* receive state */
-            if (uade_receive_message(um, sizeof(space), ipc) <= 0) {
+            if (uade_receive_message(um, sizeof(space[0]), ipc) <= 0) {
                 printf("\nCan not receive events from uade\n");
                 return 0;
             }
@@ -2158,9 +2252,10 @@ int uade_audio_play(char *pSound,int lBytes,int song_end) {
                      }*/
                     
                     assert (left == um->size);
-                    assert (sizeof sampledata >= um->size);
                     
-                    memcpy(sampledata, um->data, um->size);
+                    sampledata=um->data;
+                    space_idx^=1;
+                    um=(struct uade_msg *) space[space_idx];
                     
                     what_was_left = left;
                     
@@ -2427,7 +2522,15 @@ long src_callback_mpg123(void *cb_data, float **data) {
     
     
     while (1) {
-        [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
+        if (bGlobalIsPlaying && !bGlobalEndReached && mPlayType) {
+            //only block when the ring is full, until the output callback frees a buffer.
+            //Timidity, GSF, SexyPSF, UADE & MDX fill the ring from their own play loop
+            //and wait there : don't compete with them for the wakeups
+            if ((mPlayType!=MMP_TIMIDITY)&&(mPlayType!=MMP_GSF)&&(mPlayType!=MMP_SEXYPSF)
+                &&(mPlayType!=MMP_UADE)&&(mPlayType!=MMP_MDXPDX)) {
+                if (ringSlotFilled(buffer_ana_gen_ofs)) ringWaitFreeSlot();
+            }
+        } else [NSThread sleepForTimeInterval:DEFAULT_WAIT_TIME_MS];
         if (bGlobalIsPlaying) {
             bGlobalSoundGenInProgress=1;
             if ( !bGlobalEndReached && mPlayType) {
@@ -2519,7 +2622,9 @@ long src_callback_mpg123(void *cb_data, float **data) {
                     mQueueIsBeingStopped = FALSE;
                     bGlobalAudioPause=2;
                     bGlobalEndReached=1;
-                } else if (buffer_ana_flag[buffer_ana_gen_ofs]==0) {
+                } else if (!ringSlotFilled(buffer_ana_gen_ofs)) {
+                    //seek & subsong changes drop what is left from a gapless switch
+                    if ((mNeedSeek==1)||moveToNextSubSong||moveToPrevSubSong||moveToSubSong) preroll_drain_len=0;
                     if (mNeedSeek==1) { //SEEK
                         mNeedSeek=2;  //taken into account
                         if (mPlayType==MMP_GME) {   //GME
@@ -2546,8 +2651,17 @@ long src_callback_mpg123(void *cb_data, float **data) {
                             bGlobalSeekProgress=-1;
                             mNeedSeekTime=hvl_Seek(hvl_song,mNeedSeekTime);
                         }
-                        if (mPlayType==MMP_SIDPLAY) { //SID : not supported
-                            mNeedSeek=0;
+                        if (mPlayType==MMP_SIDPLAY) { //SID
+                            if (mSidEngineType==1) mNeedSeek=0; //sidplay1 : not supported
+                            else {
+                                bGlobalSeekProgress=-1;
+                                if (mSidEmuEngine->seek(mNeedSeekTime)<0) {
+                                    //seek failed : the tune restarted or did not move, resync the time with the engine
+                                    mNeedSeek=0;
+                                    bGlobalSeekProgress=0;
+                                    iCurrentTime=mSidEmuEngine->time()*1000/mSidEmuEngine->timebase();
+                                }
+                            }
                         }
                         if (mPlayType==MMP_STSOUND) {//STSOUND
                             if (ymMusicIsSeekable(ymMusic)==YMTRUE) {
@@ -2591,21 +2705,14 @@ long src_callback_mpg123(void *cb_data, float **data) {
                             
                             int seekSample=(double)mNeedSeekTime*(double)(xSFPlayer->GetSampleRate())/1000.0f;
                             bGlobalSeekProgress=-1;
-                            if (xSFPlayer->currentSample >seekSample) {
+                            //restore the closest keyframe, only restart from the beginning if there is none
+                            if ((!xSFPlayer->SeekToKeyframe(seekSample))&&(xSFPlayer->currentSample >seekSample)) {
                                 xSFPlayer->Terminate();
                                 xSFPlayer->Load();
                                 xSFPlayer->SeekTop();
                             }
                             
-                            while (seekSample - xSFPlayer->currentSample > SOUND_BUFFER_SIZE_SAMPLE) {
-                                xSFPlayer->GenerateSamples(xsfSampleBuffer, 0, SOUND_BUFFER_SIZE_SAMPLE);
-                                xSFPlayer->currentSample += SOUND_BUFFER_SIZE_SAMPLE;
-                            }
-                            if (seekSample - xSFPlayer->currentSample > 0)
-                            {
-                                xSFPlayer->GenerateSamples(xsfSampleBuffer, 0, seekSample - xSFPlayer->currentSample);
-                                xSFPlayer->currentSample = seekSample;
-                            }
+                            if (seekSample > xSFPlayer->currentSample) xSFPlayer->SkipSamples(xsfSampleBuffer, seekSample - xSFPlayer->currentSample);
                             
                             //mNeedSeek=0;
                         }
@@ -2653,8 +2760,7 @@ long src_callback_mpg123(void *cb_data, float **data) {
                                 sprintf(mod_name," %s",mod_filename);
                                 if (gme_track_info( gme_emu, &gme_info, mod_currentsub )==0) {
                                     strcpy(gmetype,gme_info->system);
-                                    iModuleLength=gme_info->play_length;
-                                    if (iModuleLength<=0) iModuleLength=optGENDefaultLength;
+                                    iModuleLength=gmeTrackLength(gme_info->play_length,mod_currentsub);
                                     
                                     sprintf(mod_message,"Song:%s\nGame:%s\nAuthor:%s\nDumper:%s\nCopyright:%s\nTracks:%d\n%s",
                                             (gme_info->song?gme_info->song:" "),
@@ -2761,8 +2867,7 @@ long src_callback_mpg123(void *cb_data, float **data) {
                             sprintf(mod_name," %s",mod_filename);
                             if (gme_track_info( gme_emu, &gme_info, mod_currentsub )==0) {
                                 strcpy(gmetype,gme_info->system);
-                                iModuleLength=gme_info->play_length;
-                                if (iModuleLength<=0) iModuleLength=optGENDefaultLength;
+                                iModuleLength=gmeTrackLength(gme_info->play_length,mod_currentsub);
                                 
                                 sprintf(mod_message,"Song:%s\nGame:%s\nAuthor:%s\nDumper:%s\nCopyright:%s\nTracks:%d\n%s",
                                         (gme_info->song?gme_info->song:" "),
@@ -2869,8 +2974,7 @@ long src_callback_mpg123(void *cb_data, float **data) {
                                 gme_start_track(gme_emu,mod_currentsub);
                                 sprintf(mod_name," %s",mod_filename);
                                 if (gme_track_info( gme_emu, &gme_info, mod_currentsub )==0) {
-                                    iModuleLength=gme_info->play_length;
-                                    if (iModuleLength<=0) iModuleLength=optGENDefaultLength;
+                                    iModuleLength=gmeTrackLength(gme_info->play_length,mod_currentsub);
                                     strcpy(gmetype,gme_info->system);
                                     sprintf(mod_message,"Song:%s\nGame:%s\nAuthor:%s\nDumper:%s\nCopyright:%s\nTracks:%d\n%s",
                                             (gme_info->song?gme_info->song:" "),
@@ -2987,8 +3091,7 @@ long src_callback_mpg123(void *cb_data, float **data) {
                                     sprintf(mod_name," %s",mod_filename);
                                     if (gme_track_info( gme_emu, &gme_info, mod_currentsub )==0) {
                                         mChangeOfSong=1;
-                                        mNewModuleLength=gme_info->play_length;
-                                        if (mNewModuleLength<=0) mNewModuleLength=optGENDefaultLength;
+                                        mNewModuleLength=gmeTrackLength(gme_info->play_length,mod_currentsub);
                                         strcpy(gmetype,gme_info->system);
                                         
                                         sprintf(mod_message,"Song:%s\nGame:%s\nAuthor:%s\nDumper:%s\nCopyright:%s\nTracks:%d\n%s",
@@ -3053,13 +3156,16 @@ long src_callback_mpg123(void *cb_data, float **data) {
                                 }
                                 
                             } else {
-                                gme_play( gme_emu, SOUND_BUFFER_SIZE_SAMPLE*2, buffer_ana[buffer_ana_gen_ofs] );
+                                //after a gapless switch, frames rendered ahead come first
+                                int pre=prerollDrain(buffer_ana[buffer_ana_gen_ofs],SOUND_BUFFER_SIZE_SAMPLE);
+                                if (pre<SOUND_BUFFER_SIZE_SAMPLE) gme_play( gme_emu, (SOUND_BUFFER_SIZE_SAMPLE-pre)*2, buffer_ana[buffer_ana_gen_ofs]+pre*2 );
                             }
                             nbBytes=SOUND_BUFFER_SIZE_SAMPLE*2*2;
                         }
                     }
                     if (mPlayType==MMP_AOSDK) { //AOSDK
-                        if ((*ao_types[ao_type].gen)((int16*)(buffer_ana[buffer_ana_gen_ofs]), SOUND_BUFFER_SIZE_SAMPLE)==AO_FAIL) {
+                        int pre=prerollDrain(buffer_ana[buffer_ana_gen_ofs],SOUND_BUFFER_SIZE_SAMPLE);
+                        if ((pre<SOUND_BUFFER_SIZE_SAMPLE)&&((*ao_types[ao_type].gen)(ao_ctx,(int16*)(buffer_ana[buffer_ana_gen_ofs]+pre*2), SOUND_BUFFER_SIZE_SAMPLE-pre)==AO_FAIL)) {
                             nbBytes=0;
                             /*if ((*ao_types[ao_type].gen)((int16*)(&(buffer_ana[buffer_ana_gen_ofs][SOUND_BUFFER_SIZE_SAMPLE])), SOUND_BUFFER_SIZE_SAMPLE)==AO_FAIL) nbBytes=0;
                              else {
@@ -3067,7 +3173,8 @@ long src_callback_mpg123(void *cb_data, float **data) {
                              else nbBytes=0;
                              }*/
                         } else {
-                            if ((iModuleLength==-1)||(iCurrentTime<iModuleLength)) nbBytes=SOUND_BUFFER_SIZE_SAMPLE*2*2;
+                            //until a gapless switch is played, iCurrentTime still refers to the previous entry
+                            if (mChangeOfSong||(iModuleLength==-1)||(iCurrentTime<iModuleLength)) nbBytes=SOUND_BUFFER_SIZE_SAMPLE*2*2;
                             else nbBytes=0;
                         }
                         //                        nbBytes=SOUND_BUFFER_SIZE_SAMPLE*2*2;
@@ -3380,12 +3487,21 @@ long src_callback_mpg123(void *cb_data, float **data) {
                         } else nbBytes=0;
                     }
                     
-                    buffer_ana_flag[buffer_ana_gen_ofs]=1;
+                    int slot_flags=1;
                     if (mNeedSeek==2) {  //ask for a currentime update when this buffer will be played
-                        buffer_ana_flag[buffer_ana_gen_ofs]=buffer_ana_flag[buffer_ana_gen_ofs]|2;
+                        slot_flags|=2;
                         mNeedSeek=3;  //to avoid taking into account another time
                     }
                     
+                    if ((nbBytes<SOUND_BUFFER_SIZE_SAMPLE*2*2)&&(mChangeOfSong==0)&&((mPlayType==MMP_GME)||(mPlayType==MMP_AOSDK))) {
+                        //gapless : the pre-rolled next entry completes this buffer
+                        if ([self mmp_prerollSwitch:buffer_ana[buffer_ana_gen_ofs] frame:nbBytes/4]) {
+                            nbBytes=SOUND_BUFFER_SIZE_SAMPLE*2*2;
+                            mChangeOfSong=1;
+                            slot_flags|=16;
+                        }
+                    }
+                    
                     if (nbBytes<SOUND_BUFFER_SIZE_SAMPLE*2*2) {
                         short int *dest=buffer_ana[buffer_ana_gen_ofs];
                         short int lv,rv;
@@ -3402,13 +3518,14 @@ long src_callback_mpg123(void *cb_data, float **data) {
                             *dest++=lv;
                             *dest++=rv;
                         }
-                        buffer_ana_flag[buffer_ana_gen_ofs]=buffer_ana_flag[buffer_ana_gen_ofs]|4; //end reached
+                        slot_flags|=4; //end reached
                         bGlobalEndReached=1;
                     }
                     if (mChangeOfSong==1) {
-                        buffer_ana_flag[buffer_ana_gen_ofs]=buffer_ana_flag[buffer_ana_gen_ofs]|8; //end reached but continue
+                        slot_flags|=8; //end reached but continue
                         mChangeOfSong=2;
                     }
+                    ringPublishSlot(buffer_ana_gen_ofs,slot_flags);
                     buffer_ana_gen_ofs++;
                     if (buffer_ana_gen_ofs==SOUND_BUFFER_NB) buffer_ana_gen_ofs=0;
                 }
@@ -3428,10 +3545,172 @@ long src_callback_mpg123(void *cb_data, float **data) {
 
 //*****************************************
 //Archive management
+#define FEX_EXTRACT_BUFFER_SIZE (64*1024)
+#define FEX_TOC_MAGIC "MDZTOC01"
+
+static void fex_freeToc(void) {
+    for (int i=0;i<mdz_ArchiveTocCnt;i++) free(mdz_ArchiveToc[i].name);
+    free(mdz_ArchiveToc);
+    mdz_ArchiveToc=NULL;
+    mdz_ArchiveTocCnt=mdz_ArchiveTocAuxCnt=0;
+    mdz_ArchiveTocPath[0]=0;
+}
+
+static int fex_addTocEntry(const char *name,fex_pos_t pos) {
+    mdz_ArchiveTocEntry *toc=(mdz_ArchiveTocEntry*)realloc(mdz_ArchiveToc,(mdz_ArchiveTocCnt+1)*sizeof(mdz_ArchiveTocEntry));
+    if (!toc) return -1;
+    mdz_ArchiveToc=toc;
+    toc[mdz_ArchiveTocCnt].name=(char*)malloc(strlen(name)+1);
+    if (!toc[mdz_ArchiveTocCnt].name) return -1;
+    strcpy(toc[mdz_ArchiveTocCnt].name,name);
+    toc[mdz_ArchiveTocCnt].pos=pos;
+    mdz_ArchiveTocCnt++;
+    return 0;
+}
+
+//disk caches (openmpt lengths, archive TOCs): entries are touched on use & the oldest ones dropped past maxFiles
+static void mdz_cacheTrim(NSString *cacheDir,NSUInteger maxFiles) {
+    NSFileManager *fm=[[NSFileManager alloc] init];
+    NSArray *files=[fm contentsOfDirectoryAtURL:[NSURL fileURLWithPath:cacheDir]
+                     includingPropertiesForKeys:[NSArray arrayWithObject:NSURLContentModificationDateKey]
+                                        options:NSDirectoryEnumerationSkipsHiddenFiles error:nil];
+    if ([files count]>maxFiles) {
+        NSArray *sorted=[files sortedArrayUsingComparator:^NSComparisonResult(NSURL *a,NSURL *b) {
+            NSDate *da=nil,*db=nil;
+            [a getResourceValue:&da forKey:NSURLContentModificationDateKey error:nil];
+            [b getResourceValue:&db forKey:NSURLContentModificationDateKey error:nil];
+            return [da compare:db];
+        }];
+        for (NSUInteger i=0;i<[sorted count]-maxFiles;i++) [fm removeItemAtURL:[sorted objectAtIndex:i] error:nil];
+    }
+    [fm release];
+}
+
+//trim cacheDir in the background once every trimEvery calls
+static void mdz_cacheTrimEvery(NSString *cacheDir,NSUInteger maxFiles,int *counter,int trimEvery) {
+    if ((__atomic_fetch_add(counter,1,__ATOMIC_RELAXED)%trimEvery)!=0) return;
+    NSString *dir=[cacheDir retain];
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND,0), ^{
+        mdz_cacheTrim(dir,maxFiles);
+        [dir release];
+    });
+}
+
+#define FEX_TOC_MAX_FILES 1000
+#define FEX_TOC_TRIM_EVERY 32
+
+//cache file of an archive: depends on its path, size, date & on the app version (supported formats)
+static NSString *fex_tocCachePath(const char *archivePath) {
+    NSDictionary *attr=[mFileMngr attributesOfItemAtPath:[NSString stringWithUTF8String:archivePath] error:nil];
+    if (!attr) return nil;
+    NSString *key=[NSString stringWithFormat:@"%s:%llu:%.0f:%@",archivePath,[attr fileSize],[[attr fileModificationDate] timeIntervalSince1970],
+                   [[NSBundle mainBundle] objectForInfoDictionaryKey:@"CFBundleVersion"]];
+    char toc_md5[33];
+    md5_from_buffer(toc_md5,33,(char*)[key UTF8String],strlen([key UTF8String]));
+    toc_md5[32]=0;
+    NSString *tocPath=[NSHomeDirectory() stringByAppendingPathComponent:@"Library/Caches/fex"];
+    [mFileMngr createDirectoryAtPath:tocPath withIntermediateDirectories:TRUE attributes:nil error:nil];
+    return [tocPath stringByAppendingPathComponent:[NSString stringWithFormat:@"%s.toc",toc_md5]];
+}
+
+static int fex_readToc(const char *archivePath) {
+    char magic[8];
+    int32_t cnt,aux_cnt,len;
+    uint64_t pos;
+    int ok;
+    if (mdz_ArchiveToc&&(strcmp(mdz_ArchiveTocPath,archivePath)==0)) return 0;
+    fex_freeToc();
+    NSString *tocPath=fex_tocCachePath(archivePath);
+    if (!tocPath) return -1;
+    static int fex_tocOpens=0;
+    mdz_cacheTrimEvery([tocPath stringByDeletingLastPathComponent],FEX_TOC_MAX_FILES,&fex_tocOpens,FEX_TOC_TRIM_EVERY);
+    FILE *f=fopen([tocPath fileSystemRepresentation],"rb");
+    if (!f) return -1;
+    utimes([tocPath fileSystemRepresentation],NULL); //keep recently opened archives out of the trim
+    ok=(fread(magic,1,8,f)==8)&&(memcmp(magic,FEX_TOC_MAGIC,8)==0)&&
+        (fread(&cnt,4,1,f)==1)&&(fread(&aux_cnt,4,1,f)==1)&&(cnt>0);
+    for (int i=0;ok&&(i<cnt);i++) {
+        char name[1024];
+        ok=(fread(&pos,8,1,f)==1)&&(fread(&len,4,1,f)==1)&&(len>0)&&(len<(int)sizeof(name))&&
+            (fread(name,1,len,f)==(size_t)len);
+        if (ok) {
+            name[len]=0;
+            ok=(fex_addTocEntry(name,pos)==0);
+        }
+    }
+    fclose(f);
+    if (!ok) {
+        fex_freeToc();
+        return -1;
+    }
+    mdz_ArchiveTocAuxCnt=aux_cnt;
+    snprintf(mdz_ArchiveTocPath,sizeof(mdz_ArchiveTocPath),"%s",archivePath);
+    return 0;
+}
+
+static void fex_writeToc(const char *archivePath) {
+    NSString *tocPath=fex_tocCachePath(archivePath);
+    if (!tocPath) return;
+    NSString *tmpPath=[tocPath stringByAppendingString:@".tmp"];
+    FILE *f=fopen([tmpPath fileSystemRepresentation],"wb");
+    if (!f) return;
+    int32_t cnt=mdz_ArchiveTocCnt,aux_cnt=mdz_ArchiveTocAuxCnt;
+    int ok=(fwrite(FEX_TOC_MAGIC,1,8,f)==8)&&(fwrite(&cnt,4,1,f)==1)&&(fwrite(&aux_cnt,4,1,f)==1);
+    for (int i=0;ok&&(i<cnt);i++) {
+        uint64_t pos=mdz_ArchiveToc[i].pos;
+        int32_t len=(int32_t)strlen(mdz_ArchiveToc[i].name);
+        ok=(fwrite(&pos,8,1,f)==1)&&(fwrite(&len,4,1,f)==1)&&(fwrite(mdz_ArchiveToc[i].name,1,len,f)==(size_t)len);
+    }
+    fclose(f);
+    //renamed once complete, a partial file is never read back
+    if (ok) ok=(rename([tmpPath fileSystemRepresentation],[tocPath fileSystemRepresentation])==0);
+    if (!ok) unlink([tmpPath fileSystemRepresentation]);
+}
+
+static void fex_closeCached(void) {
+    if (mdz_ArchiveFex) fex_close(mdz_ArchiveFex);
+    mdz_ArchiveFex=NULL;
+    mdz_ArchiveFexPath[0]=0;
+}
+
+static fex_t *fex_openCached(const char *archivePath) {
+    fex_type_t type;
+    NSDictionary *attr=[mFileMngr attributesOfItemAtPath:[NSString stringWithUTF8String:archivePath] error:nil];
+    unsigned long long arc_size=[attr fileSize];
+    NSTimeInterval arc_date=[[attr fileModificationDate] timeIntervalSince1970];
+    //same archive, not replaced in the meantime
+    if (mdz_ArchiveFex&&(strcmp(mdz_ArchiveFexPath,archivePath)==0)&&
+        (mdz_ArchiveFexSize==arc_size)&&(mdz_ArchiveFexDate==arc_date)) return mdz_ArchiveFex;
+    fex_closeCached();
+    if (fex_identify_file( &type, archivePath )||(type==NULL)) return NULL;
+    if (fex_open_type( &mdz_ArchiveFex, archivePath, type )) {
+        NSLog(@"cannot fex open : %s",archivePath);
+        mdz_ArchiveFex=NULL;
+        return NULL;
+    }
+    snprintf(mdz_ArchiveFexPath,sizeof(mdz_ArchiveFexPath),"%s",archivePath);
+    mdz_ArchiveFexSize=arc_size;
+    mdz_ArchiveFexDate=arc_date;
+    return mdz_ArchiveFex;
+}
+
+//copy current archive entry to f, going through buf (FEX_EXTRACT_BUFFER_SIZE bytes)
+static int fex_extractEntryToFile(fex_t *fex,FILE *f,char *buf) {
+    uint64_t remaining;
+    if (fex_stat(fex)) return -1;
+    remaining=fex_size(fex);
+    while (remaining) {
+        long chunk=(remaining>FEX_EXTRACT_BUFFER_SIZE?FEX_EXTRACT_BUFFER_SIZE:(long)remaining);
+        if (fex_read(fex,buf,chunk)) return -1;
+        if (fwrite(buf,1,chunk,f)!=(size_t)chunk) return -1;
+        remaining-=chunk;
+    }
+    return 0;
+}
+
 -(void) fex_extractToPath:(const char *)archivePath path:(const char *)extractPath {
     fex_type_t type;
     fex_t* fex;
-    int arc_size;
     FILE *f;
     NSString *extractFilename,*extractPathFile;
     NSError *err;
@@ -3447,17 +3726,16 @@ long src_callback_mpg123(void *cb_data, float **data) {
         } else{
             mdz_ArchiveFilesList=(char**)malloc(mdz_ArchiveFilesCnt*sizeof(char*)); //TODO: free
 //            mdz_ArchiveFilesListAlias=(char**)malloc(mdz_ArchiveFilesCnt*sizeof(char*)); //TODO: free
+            char *archive_data=(char*)malloc(FEX_EXTRACT_BUFFER_SIZE); //reused for every entry
             idx=0;
             while ( !fex_done( fex ) ) {
                 
                 if ([self isAcceptedFile:[NSString stringWithFormat:@"%s",fex_name(fex)] no_aux_file:0]) {
                     
-                    fex_stat(fex);
-                    arc_size=fex_size(fex);
                     extractFilename=[NSString stringWithFormat:@"%s/%s",extractPath,fex_name(fex)];
                     extractPathFile=[extractFilename stringByDeletingLastPathComponent];
                     
-                    //NSLog(@"file : %s, size : %dKo, output %@",fex_name(fex),arc_size/1024,extractFilename);
+                    //NSLog(@"file : %s, output %@",fex_name(fex),extractFilename);
                     
                     
                     //1st create path if not existing yet
@@ -3469,20 +3747,9 @@ long src_callback_mpg123(void *cb_data, float **data) {
                     if (!f) {
                         NSLog(@"Cannot open %@ to extract %@",extractFilename,archivePath);
                     } else {
-                        char *archive_data;
-                        archive_data=(char*)malloc(512*1024*1024); //buffer
-                        while (arc_size) {
-                            if (arc_size>512*1024*1024) {
-                                fex_read( fex, archive_data, 512*1024*1024);
-                                fwrite(archive_data,512*1024*1024,1,f);
-                                arc_size-=512*1024*1024;
-                            } else {
-                                fex_read( fex, archive_data, arc_size );
-                                fwrite(archive_data,arc_size,1,f);
-                                arc_size=0;
-                            }
+                        if (fex_extractEntryToFile(fex,f,archive_data)) {
+                            NSLog(@"Error while extracting %@ from %s",extractFilename,archivePath);
                         }
-                        free(archive_data);
                         fclose(f);
                         
                         NSString *tmp_filename=[NSString stringWithFormat:@"%s",fex_name(fex)];
@@ -3533,6 +3800,7 @@ long src_callback_mpg123(void *cb_data, float **data) {
                     }
                 }
             }
+            free(archive_data);
             fex_close( fex );
         }
         fex = NULL;
@@ -3542,34 +3810,34 @@ long src_callback_mpg123(void *cb_data, float **data) {
 }
 
 -(void) fex_extractSingleFileToPath:(const char *)archivePath path:(const char *)extractPath file_index:(int)index {
-    fex_type_t type;
     fex_t* fex;
-    int arc_size;
     FILE *f;
     NSString *extractFilename,*extractPathFile;
     NSError *err;
     int idx;
-    /* Determine file's type */
-    if (fex_identify_file( &type, archivePath )) {
-        NSLog(@"fex cannot determine type of %s",archivePath);
-    }
     /* Only open files that fex can handle */
-    if ( type != NULL ) {
-        if (fex_open_type( &fex, archivePath, type )) {
-            NSLog(@"cannot fex open : %s / type : %d",archivePath,type);
+    fex=fex_openCached(archivePath);
+    if ( fex != NULL ) {
+        if (fex_rewind( fex )) {
+            NSLog(@"cannot fex rewind : %s",archivePath);
+            fex_closeCached();
         } else{
             mdz_ArchiveFilesList=(char**)malloc(mdz_ArchiveFilesCnt*sizeof(char*)); //TODO: free
 //            mdz_ArchiveFilesListAlias=(char**)malloc(mdz_ArchiveFilesCnt*sizeof(char*)); //TODO: free
+            char *archive_data=(char*)malloc(FEX_EXTRACT_BUFFER_SIZE); //reused for every entry
             idx=0;
+            //position known from the table of contents: no walk through the previous entries
+            if ((fex_readToc(archivePath)==0)&&(index>=0)&&(index<mdz_ArchiveTocCnt)) {
+                if (fex_seek_arc(fex,mdz_ArchiveToc[index].pos)==NULL) idx=index;
+                else fex_rewind( fex );
+            }
             while ( !fex_done( fex ) ) {
                 
                 if ([self isAcceptedFile:[NSString stringWithFormat:@"%s",fex_name(fex)] no_aux_file:1]) {
                     if (index==idx) {
-                        fex_stat(fex);
-                        arc_size=fex_size(fex);
                         extractFilename=[NSString stringWithFormat:@"%s/%s",extractPath,fex_name(fex)];
                         extractPathFile=[extractFilename stringByDeletingLastPathComponent];
-                        //NSLog(@"file : %s, size : %dKo, output %@",fex_name(fex),arc_size/1024,extractFilename);
+                        //NSLog(@"file : %s, output %@",fex_name(fex),extractFilename);
                         
                         
                         //1st create path if not existing yet
@@ -3580,20 +3848,9 @@ long src_callback_mpg123(void *cb_data, float **data) {
                         if (!f) {
                             NSLog(@"Cannot open %@ to extract %@",extractFilename,archivePath);
                         } else {
-                            char *archive_data;
-                            archive_data=(char*)malloc(32*1024*1024); //buffer
-                            while (arc_size) {
-                                if (arc_size>32*1024*1024) {
-                                    fex_read( fex, archive_data, 32*1024*1024);
-                                    fwrite(archive_data,32*1024*1024,1,f);
-                                    arc_size-=32*1024*1024;
-                                } else {
-                                    fex_read( fex, archive_data, arc_size );
-                                    fwrite(archive_data,arc_size,1,f);
-                                    arc_size=0;
-                                }
+                            if (fex_extractEntryToFile(fex,f,archive_data)) {
+                                NSLog(@"Error while extracting %@ from %s",extractFilename,archivePath);
                             }
-                            free(archive_data);
                             fclose(f);
                             NSString *tmp_filename=[NSString stringWithFormat:@"%s",fex_name(fex)];
                             
@@ -3615,7 +3872,7 @@ long src_callback_mpg123(void *cb_data, float **data) {
                     }
                 }
             }
-            fex_close( fex );
+            free(archive_data);
         }
         fex = NULL;
     } else {
@@ -3623,9 +3880,57 @@ long src_callback_mpg123(void *cb_data, float **data) {
     }
 }
 
--(void) fex_scanarchive:(const char *)path {
+//returns how many entries rely on other files of the archive (psflib, pdx, m3u, samples, covers, ...)
+-(int) fex_scanarchive:(const char *)path {
+    fex_t* fex;
+    int aux_cnt=0,complete=1;
+    
+    fex_freeToc(); //reloaded from the cache file, which is matched against the archive date & size
+    if (fex_readToc(path)==0) {
+        mdz_IsArchive=1;
+        mdz_ArchiveFilesCnt=mdz_ArchiveTocCnt;
+        return mdz_ArchiveTocAuxCnt;
+    }
+    fex=fex_openCached(path);
+    if (fex==NULL) return 0;
+    if (fex_rewind( fex )) {
+        fex_closeCached();
+        return 0;
+    }
+    mdz_IsArchive=1;
+    mdz_ArchiveFilesCnt=0;
+    while ( !fex_done( fex ) ) {
+        int pl_type=[self isAcceptedFile:[NSString stringWithFormat:@"%s",fex_name(fex)] no_aux_file:1];
+        if (pl_type) {
+            mdz_ArchiveFilesCnt++;
+            //NSLog(@"file : %s",fex_name(fex));
+            //GME only looks for an optional m3u, counted below if present
+            if ((!mSingleFileType)&&(pl_type!=MMP_GME)) aux_cnt++;
+            if (fex_addTocEntry(fex_name(fex),fex_tell_arc(fex))) complete=0;
+        } else if ([self isAcceptedFile:[NSString stringWithFormat:@"%s",fex_name(fex)] no_aux_file:0]) aux_cnt++;
+        if (fex_next( fex )) {
+            NSLog(@"Error during fex scanning");
+            complete=0;
+            break;
+        }
+    }
+    //only a full scan is kept
+    if (complete&&mdz_ArchiveFilesCnt) {
+        mdz_ArchiveTocAuxCnt=aux_cnt;
+        snprintf(mdz_ArchiveTocPath,sizeof(mdz_ArchiveTocPath),"%s",path);
+        fex_writeToc(path);
+    } else fex_freeToc();
+    return aux_cnt;
+}
+
+-(NSString*) fex_getfilename:(const char *)path index:(int)idx {
     fex_type_t type;
     fex_t* fex;
+    if ((fex_readToc(path)==0)&&(idx>=0)&&(idx<mdz_ArchiveTocCnt)) {
+        NSString *result=[NSString stringWithFormat:@"%s",mdz_ArchiveToc[idx].name];
+        [self isAcceptedFile:result no_aux_file:1]; //updates mSingleFileType, as the scan below
+        return result;
+    }
     /* Determine file's type */
     if (fex_identify_file( &type, path )) {
         NSLog(@"fex cannot determine type of %s",path);
@@ -3635,12 +3940,14 @@ long src_callback_mpg123(void *cb_data, float **data) {
         if (fex_open_type( &fex, path, type )) {
             NSLog(@"cannot fex open : %s / type : %d",path,type);
         } else{
-            mdz_IsArchive=1;
-            mdz_ArchiveFilesCnt=0;
             while ( !fex_done( fex ) ) {
                 if ([self isAcceptedFile:[NSString stringWithFormat:@"%s",fex_name(fex)] no_aux_file:1]) {
-                    mdz_ArchiveFilesCnt++;
-                    //NSLog(@"file : %s",fex_name(fex));
+                    if (!idx) {
+                        NSString *result=[NSString stringWithFormat:@"%s",fex_name(fex)];
+                        fex_close( fex );
+                        return result;
+                    }
+                    idx--;
                 }
                 if (fex_next( fex )) {
                     NSLog(@"Error during fex scanning");
@@ -3653,163 +3960,226 @@ long src_callback_mpg123(void *cb_data, float **data) {
     } else {
         //NSLog( @"Skipping unsupported archive: %s\n", path );
     }
+    return nil;
+}
+//decompress a single entry to memory (to be freed by caller), nothing is written to disk
+static char *fex_readEntryToMemory(const char *archivePath,const char *entryName,long *size) {
+    fex_t* fex;
+    char *data=NULL;
+    int found=0;
+    *size=0;
+    fex=fex_openCached(archivePath);
+    if (fex==NULL) return NULL;
+    //jump to the entry when its position is known, otherwise walk the archive
+    if (strcmp(mdz_ArchiveTocPath,archivePath)==0) {
+        for (int i=0;i<mdz_ArchiveTocCnt;i++)
+            if (strcmp(mdz_ArchiveToc[i].name,entryName)==0) {
+                found=((fex_seek_arc(fex,mdz_ArchiveToc[i].pos)==NULL)&&!fex_done(fex)&&(strcmp(fex_name(fex),entryName)==0));
+                break;
+            }
+    }
+    if ((!found)&&(fex_rewind( fex )==NULL)) {
+        while ( !fex_done( fex ) ) {
+            if (strcmp(fex_name(fex),entryName)==0) {
+                found=1;
+                break;
+            }
+            if (fex_next( fex )) {
+                NSLog(@"Error during fex scanning");
+                break;
+            }
+        }
+    }
+    if (found&&(fex_stat(fex)==NULL)) {
+        long datasize=(long)fex_size(fex);
+        data=(char*)malloc(datasize?datasize:1);
+        if (data&&fex_read(fex,data,datasize)) {
+            NSLog(@"Error while reading %s from %s",entryName,archivePath);
+            free(data);
+            data=NULL;
+        }
+        if (data) *size=datasize;
+    }
+    //decoder state is unknown after an error, start again from a fresh handle next time
+    if (data==NULL) fex_closeCached();
+    return data;
 }
 
--(NSString*) fex_getfilename:(const char *)path index:(int)idx {
+//fill mdz_ArchiveFilesList with entries names only, all of them or the index-th playable one if index>=0
+-(void) fex_listToArray:(const char *)archivePath file_index:(int)index {
     fex_type_t type;
     fex_t* fex;
+    int idx,cnt;
+    if (fex_readToc(archivePath)==0) {
+        mdz_ArchiveFilesList=(char**)malloc(mdz_ArchiveTocCnt*sizeof(char*));
+        cnt=0;
+        for (idx=0;idx<mdz_ArchiveTocCnt;idx++) {
+            if ((index>=0)&&(index!=idx)) continue;
+            mdz_ArchiveFilesList[cnt]=(char*)malloc(strlen(mdz_ArchiveToc[idx].name)+1);
+            strcpy(mdz_ArchiveFilesList[cnt],mdz_ArchiveToc[idx].name);
+            cnt++;
+        }
+        mdz_ArchiveFilesCnt=cnt;
+        return;
+    }
     /* Determine file's type */
-    if (fex_identify_file( &type, path )) {
-        NSLog(@"fex cannot determine type of %s",path);
+    if (fex_identify_file( &type, archivePath )) {
+        NSLog(@"fex cannot determine type of %s",archivePath);
     }
     /* Only open files that fex can handle */
     if ( type != NULL ) {
-        if (fex_open_type( &fex, path, type )) {
-            NSLog(@"cannot fex open : %s / type : %d",path,type);
+        if (fex_open_type( &fex, archivePath, type )) {
+            NSLog(@"cannot fex open : %s / type : %d",archivePath,type);
         } else{
-            while ( !fex_done( fex ) ) {
+            mdz_ArchiveFilesList=(char**)malloc(mdz_ArchiveFilesCnt*sizeof(char*));
+            idx=cnt=0;
+            while ( !fex_done( fex )&&(cnt<mdz_ArchiveFilesCnt) ) {
                 if ([self isAcceptedFile:[NSString stringWithFormat:@"%s",fex_name(fex)] no_aux_file:1]) {
-                    if (!idx) {
-                        NSString *result=[NSString stringWithFormat:@"%s",fex_name(fex)];
-                        fex_close( fex );
-                        return result;
+                    if ((index<0)||(index==idx)) {
+                        mdz_ArchiveFilesList[cnt]=(char*)malloc(strlen(fex_name(fex))+1);
+                        strcpy(mdz_ArchiveFilesList[cnt],fex_name(fex));
+                        cnt++;
                     }
-                    idx--;
+                    idx++;
                 }
                 if (fex_next( fex )) {
                     NSLog(@"Error during fex scanning");
                     break;
                 }
             }
+            mdz_ArchiveFilesCnt=cnt;
             fex_close( fex );
         }
         fex = NULL;
+    }
+}
+
+//whole file content (to be freed by caller). Entries of an archive kept in memory are decompressed from it.
+-(char*) mdz_readFile:(NSString*)filePath size:(long*)size {
+    *size=0;
+    if (mdz_ArchiveInMemory) {
+        NSString *tmpArchivePath=[NSString stringWithFormat:@"%@/tmp/tmpArchive/",NSHomeDirectory()];
+        if ([filePath hasPrefix:tmpArchivePath]&&![mFileMngr fileExistsAtPath:filePath]) {
+            return fex_readEntryToMemory(mdz_ArchivePath,[[filePath substringFromIndex:[tmpArchivePath length]] UTF8String],size);
+        }
+    }
+    FILE *f=fopen([filePath UTF8String],"rb");
+    if (f==NULL) return NULL;
+    fseek(f,0L,SEEK_END);
+    long datasize=ftell(f);
+    if (datasize<0) {
+        fclose(f);
+        return NULL;
+    }
+    rewind(f);
+    char *data=(char*)malloc(datasize?datasize:1);
+    if (data&&(fread(data,1,datasize,f)!=(size_t)datasize)) {  //short read
+        free(data);
+        data=NULL;
+    }
+    if (data) *size=datasize;
+    fclose(f);
+    return data;
+}
+
+//players only able to open a path get the entry extracted to tmp/tmpArchive, once
+-(void) mdz_extractArchiveEntry:(NSString*)filePath {
+    NSError *err;
+    long datasize;
+    if (!mdz_ArchiveInMemory) return;
+    if ([mFileMngr fileExistsAtPath:filePath]) return;
+    char *data=[self mdz_readFile:filePath size:&datasize];
+    if (data==NULL) return;
+    [mFileMngr createDirectoryAtPath:[filePath stringByDeletingLastPathComponent] withIntermediateDirectories:TRUE attributes:nil error:&err];
+    [self addSkipBackupAttributeToItemAtPath:[NSString stringWithFormat:@"%@/tmp/tmpArchive",NSHomeDirectory()]];
+    FILE *f=fopen([filePath fileSystemRepresentation],"wb");
+    if (!f) {
+        NSLog(@"Cannot open %@ to extract %s",filePath,mdz_ArchivePath);
     } else {
-        //NSLog( @"Skipping unsupported archive: %s\n", path );
+        if (fwrite(data,1,datasize,f)!=(size_t)datasize) NSLog(@"Error while extracting %@ from %s",filePath,mdz_ArchivePath);
+        fclose(f);
     }
-    return nil;
+    free(data);
 }
 //*****************************************
 //File loading & general functions
 -(int) getSongLengthfromMD5:(int)track_nb {
+    return [self getSongLengthfromMD5:track_nb md5:song_md5];
+}
+-(int) getSongLengthfromMD5:(int)track_nb md5:(const char*)md5 {
     NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
     sqlite3 *db;
-    int err;
     int songlength=-1;
     
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-        char sqlStatement[1024];
+    if ((db=DBHelper::lockDB(pathToDB))){
         sqlite3_stmt *stmt;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
-        sprintf(sqlStatement,"SELECT song_length FROM songlength WHERE id_md5=\"%s\" AND track_nb=%d",song_md5,track_nb);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        stmt=DBHelper::getStatement(db,"SELECT song_length FROM songlength WHERE id_md5=? AND track_nb=?");
+        if (stmt){
+            sqlite3_bind_text(stmt, 1, md5, -1, SQLITE_STATIC);
+            sqlite3_bind_int(stmt, 2, track_nb);
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 songlength=sqlite3_column_int(stmt, 0)*1000;
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d getSongLengthfromMD51",err);
+        } else NSLog(@"ErrSQL : getSongLengthfromMD51");
         
     };
-    sqlite3_close(db);
+    DBHelper::unlockDB(db);
     
     if (songlength==-1) {
         //Try in user DB
         pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
         
-        if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-            char sqlStatement[1024];
+        if ((db=DBHelper::lockDB(pathToDB))){
             sqlite3_stmt *stmt;
             
-            sprintf(sqlStatement,"SELECT song_length FROM songlength_user WHERE id_md5=\"%s\" AND track_nb=%d",song_md5,track_nb);
-            err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-            if (err==SQLITE_OK){
+            stmt=DBHelper::getStatement(db,"SELECT song_length FROM songlength_user WHERE id_md5=? AND track_nb=?");
+            if (stmt){
+                sqlite3_bind_text(stmt, 1, md5, -1, SQLITE_STATIC);
+                sqlite3_bind_int(stmt, 2, track_nb);
                 while (sqlite3_step(stmt) == SQLITE_ROW) {
                     songlength=sqlite3_column_int(stmt, 0)*1000;
                 }
-                sqlite3_finalize(stmt);
-            } else NSLog(@"ErrSQL : %d getSongLengthfromMD52",err);
+            } else NSLog(@"ErrSQL : getSongLengthfromMD52");
             
         };
-        sqlite3_close(db);
+        DBHelper::unlockDB(db);
     }
     
-    pthread_mutex_unlock(&db_mutex);
     return songlength;
 }
 -(void) setSongLengthfromMD5:(int)track_nb songlength:(int)slength {
-    NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
-    sqlite3 *db;
-    int err;
-    
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-        char sqlStatement[1024];
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
-        sprintf(sqlStatement,"DELETE FROM songlength_user WHERE id_md5=\"%s\" AND track_nb=%d",song_md5,track_nb);
-        err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d setSongLengthfromMD51",err);
-        
-        sprintf(sqlStatement,"INSERT INTO songlength_user (id_md5,track_nb,song_length) VALUES (\"%s\",%d,%d)",song_md5,track_nb,slength/1000);
-        err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d setSongLengthfromMD52",err);
-        
-    };
-    sqlite3_close(db);
-    
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::setSongLengthFromMD5(song_md5,track_nb,slength);
 }
--(void) getStilInfo:(char*)fullPath {
+-(void) getStilInfoFromTable:(const char*)table pathTable:(const char*)path_table collection:(const char*)collection fullPath:(char*)fullPath {
     NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
     sqlite3 *db;
-    int err;
     
     strcpy(stil_info,"");
-    pthread_mutex_lock(&db_mutex);
     
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-        char sqlStatement[1024];
+    if ((db=DBHelper::lockDB(pathToDB))){
+        char sqlStatement[256];
         char tmppath[256];
         sqlite3_stmt *stmt;
-        char *realPath=strstr(fullPath,"/HVSC");
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
+        char *realPath=strstr(fullPath,collection);
         
         if (!realPath) {
             //try to find realPath with md5
-            sprintf(sqlStatement,"SELECT filepath FROM hvsc_path WHERE id_md5=\"%s\"",song_md5);
-            err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-            if (err==SQLITE_OK){
+            sprintf(sqlStatement,"SELECT filepath FROM %s WHERE id_md5=?",path_table);
+            stmt=DBHelper::getStatement(db,sqlStatement);
+            if (stmt){
+                sqlite3_bind_text(stmt, 1, song_md5, -1, SQLITE_STATIC);
                 while (sqlite3_step(stmt) == SQLITE_ROW) {
                     strcpy(tmppath,(const char*)sqlite3_column_text(stmt, 0));
                     realPath=tmppath;
                 }
-                sqlite3_finalize(stmt);
-            } else NSLog(@"ErrSQL : %d",err);
-        } else realPath+=5;
+            }
+        } else realPath+=strlen(collection);
         if (realPath) {
-            sprintf(sqlStatement,"SELECT stil_info FROM stil WHERE fullpath=\"%s\"",realPath);
-            err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-            if (err==SQLITE_OK){
+            sprintf(sqlStatement,"SELECT stil_info FROM %s WHERE fullpath=?",table);
+            stmt=DBHelper::getStatement(db,sqlStatement);
+            if (stmt){
+                sqlite3_bind_text(stmt, 1, realPath, -1, SQLITE_TRANSIENT);
                 while (sqlite3_step(stmt) == SQLITE_ROW) {
                     strcpy(stil_info,(const char*)sqlite3_column_text(stmt, 0));
                     while ((realPath=strstr(stil_info,"\\n"))) {
@@ -3818,64 +4188,17 @@ long src_callback_mpg123(void *cb_data, float **data) {
                         memmove(realPath,realPath+1,strlen(realPath));
                     }
                 }
-                sqlite3_finalize(stmt);
-            } else NSLog(@"ErrSQL : %d",err);
+            }
         }
     };
-    sqlite3_close(db);
-    
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
+}
+-(void) getStilInfo:(char*)fullPath {
+    [self getStilInfoFromTable:"stil" pathTable:"hvsc_path" collection:"/HVSC" fullPath:fullPath];
 }
 
 -(void) getStilAsmaInfo:(char*)fullPath {
-    NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
-    sqlite3 *db;
-    int err;
-    
-    strcpy(stil_info,"");
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-        char sqlStatement[1024];
-        char tmppath[256];
-        sqlite3_stmt *stmt;
-        char *realPath=strstr(fullPath,"/ASMA");
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
-        if (!realPath) {
-            //try to find realPath with md5
-            sprintf(sqlStatement,"SELECT filepath FROM asma_path WHERE id_md5=\"%s\"",song_md5);
-            err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-            if (err==SQLITE_OK){
-                while (sqlite3_step(stmt) == SQLITE_ROW) {
-                    strcpy(tmppath,(const char*)sqlite3_column_text(stmt, 0));
-                    realPath=tmppath;
-                }
-                sqlite3_finalize(stmt);
-            } else NSLog(@"ErrSQL : %d",err);
-        } else realPath+=5;
-        if (realPath) {
-            sprintf(sqlStatement,"SELECT stil_info FROM stil_asma WHERE fullpath=\"%s\"",realPath);
-            err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-            if (err==SQLITE_OK){
-                while (sqlite3_step(stmt) == SQLITE_ROW) {
-                    strcpy(stil_info,(const char*)sqlite3_column_text(stmt, 0));
-                    while ((realPath=strstr(stil_info,"\\n"))) {
-                        *realPath='\n';
-                        realPath++;
-                        memmove(realPath,realPath+1,strlen(realPath));
-                    }
-                }
-                sqlite3_finalize(stmt);
-            } else NSLog(@"ErrSQL : %d",err);
-        }
-    };
-    sqlite3_close(db);
-    
-    pthread_mutex_unlock(&db_mutex);
+    [self getStilInfoFromTable:"stil_asma" pathTable:"asma_path" collection:"/ASMA" fullPath:fullPath];
 }
 
 
@@ -4569,20 +4892,21 @@ long src_callback_mpg123(void *cb_data, float **data) {
 -(int) mmp_stsoundLoad:(NSString*)filePath {  //STSOUND
     mPlayType=MMP_STSOUND;
     
-    FILE *f=fopen([filePath UTF8String],"rb");
-    if (f==NULL) {
+    long datasize;
+    char *data=[self mdz_readFile:filePath size:&datasize];
+    if (data==NULL) {
         NSLog(@"STSOUND Cannot open file %@",filePath);
         mPlayType=0;
         return -1;
     }
-    
-    fseek(f,0L,SEEK_END);
-    mp_datasize=ftell(f);
-    fclose(f);
+    mp_datasize=datasize;
     
     ymMusic = ymMusicCreate();
     
-    if (!ymMusicLoad(ymMusic,[filePath UTF8String])) {
+    //the player keeps its own (depacked) copy
+    ymbool loaded=ymMusicLoadMemory(ymMusic,data,(ymu32)datasize);
+    free(data);
+    if (!loaded) {
         NSLog(@"STSOUND ymMusicLoad error");
         mPlayType=0;
         ymMusicDestroy(ymMusic);
@@ -5133,23 +5457,22 @@ long src_callback_mpg123(void *cb_data, float **data) {
 -(int) mmp_hvlLoad:(NSString*)filePath {  //HVL
     mPlayType=MMP_HVL;
     
-    FILE *f=fopen([filePath UTF8String],"rb");
-    if (f==NULL) {
+    long datasize;
+    char *data=[self mdz_readFile:filePath size:&datasize];
+    if (data==NULL) {
         NSLog(@"HVL Cannot open file %@",filePath);
         mPlayType=0;
         return -1;
     }
-    
-    fseek(f,0L,SEEK_END);
-    mp_datasize=ftell(f);
-    fclose(f);
+    mp_datasize=datasize;
     
     if (mHVLinit==0) {
         hvl_InitReplayer();
         mHVLinit=1;
     }
     
-    hvl_song=hvl_LoadTune((TEXT*)[filePath UTF8String],PLAYBACK_FREQ,1);
+    //the loader takes ownership of data
+    hvl_song=hvl_LoadTuneMemory((uint8*)data,(uint32)datasize,PLAYBACK_FREQ,1);
     
     if (hvl_song==NULL) {
         NSLog(@"HVL loadTune error");
@@ -5437,7 +5760,8 @@ long src_callback_mpg123(void *cb_data, float **data) {
         return -1;
     }
     
-    if ((*ao_types[ao_type].start)(ao_buffer, mp_datasize, (mLoopMode==1),optGENDefaultLength) != AO_SUCCESS) {
+    ao_ctx=(*ao_types[ao_type].start)(ao_buffer, mp_datasize, (mLoopMode==1),optGENDefaultLength);
+    if (ao_ctx==NULL) {
         free(ao_buffer);
         if (aopsf2_missing_psflib) {
             /*UIAlertView *alertMissingLib=[[[UIAlertView alloc] initWithTitle:@"Warning" message:[NSString stringWithFormat:@"Missing file required for playback: %s.",aopsf2_psflib_str] delegate:self cancelButtonTitle:@"Close" otherButtonTitles:nil] autorelease];
@@ -5453,7 +5777,7 @@ long src_callback_mpg123(void *cb_data, float **data) {
         }
     }
     
-    (*ao_types[ao_type].fillinfo)(&ao_info);
+    (*ao_types[ao_type].fillinfo)(ao_ctx,&ao_info);
     
     iModuleLength=ao_info.length_ms+ao_info.fade_ms;
     if (iModuleLength==0) iModuleLength=optGENDefaultLength;
@@ -5485,24 +5809,45 @@ long src_callback_mpg123(void *cb_data, float **data) {
 -(int) mmp_xmpLoad:(NSString*)filePath {  //XMP
     mPlayType=MMP_XMP;
     
-    FILE *f=fopen([filePath UTF8String],"rb");
-    if (f==NULL) {
-        NSLog(@"XMP Cannot open file %@",filePath);
-        mPlayType=0;
-        return -1;
+    long datasize;
+    char *xmp_data=NULL;
+    if (mdz_ArchiveInMemory&&![mFileMngr fileExistsAtPath:filePath]) {
+        //entry of an archive kept in memory
+        xmp_data=[self mdz_readFile:filePath size:&datasize];
+        if (xmp_data==NULL) {
+            NSLog(@"XMP Cannot open file %@",filePath);
+            mPlayType=0;
+            return -1;
+        }
+        mp_datasize=datasize;
+    } else {
+        FILE *f=fopen([filePath UTF8String],"rb");
+        if (f==NULL) {
+            NSLog(@"XMP Cannot open file %@",filePath);
+            mPlayType=0;
+            return -1;
+        }
+        
+        fseek(f,0L,SEEK_END);
+        mp_datasize=ftell(f);
+        fclose(f);
     }
     
-    fseek(f,0L,SEEK_END);
-    mp_datasize=ftell(f);
-    fclose(f);
-    
     xmp_ctx = xmp_create_context();
     if (xmp_ctx==NULL) {
         NSLog(@"XMP: Cannot create context");
+        free(xmp_data);
         return 1;
     }
     
-    if (xmp_load_module(xmp_ctx, (char*)[filePath UTF8String]) < 0) {
+    int xmp_err=(xmp_data?xmp_load_module_from_memory(xmp_ctx, xmp_data, datasize):xmp_load_module(xmp_ctx, (char*)[filePath UTF8String]));
+    if ((xmp_err<0)&&xmp_data) {
+        //packed modules are only depacked when loaded from a file
+        [self mdz_extractArchiveEntry:filePath];
+        xmp_err=xmp_load_module(xmp_ctx, (char*)[filePath UTF8String]);
+    }
+    free(xmp_data);
+    if (xmp_err < 0) {
         NSLog(@"XMP: error loading %s\n", [filePath UTF8String]);
         xmp_free_context(xmp_ctx);
         return 2;
@@ -5558,31 +5903,41 @@ long src_callback_mpg123(void *cb_data, float **data) {
     return 0;
 }
 
+//openmpt length cache, trimmed with mdz_cacheTrim
+#define MP_CACHE_MAX_FILES 2000
+#define MP_CACHE_TRIM_EVERY 32
+
 -(int) mmp_openmptLoad:(NSString*)filePath {  //MODPLUG
     const char *modName;
     char *modMessage;
     mPlayType=MMP_OPENMPT;
     
-    FILE *f=fopen([filePath UTF8String],"rb");
-    if (f==NULL) {
+    long datasize;
+    mp_data=[self mdz_readFile:filePath size:&datasize];
+    if (mp_data==NULL) {
         NSLog(@"MODPLUG Cannot open file %@",filePath);
         mPlayType=0;
         return -1;
     }
-    
-    fseek(f,0L,SEEK_END);
-    mp_datasize=ftell(f);
-    rewind(f);
-    mp_data=(char*)malloc(mp_datasize);
-    fread(mp_data,mp_datasize,sizeof(char),f);
-    fclose(f);
+    mp_datasize=datasize;
     
     [self getMPSettings];
     if (mLoopMode==1) mp_settings.mLoopCount=-1; //Should be like "infinite"
     else mp_settings.mLoopCount=0;
     [self updateMPSettings];
-    
-    mp_file=ModPlug_Load(mp_data,mp_datasize);
+
+    //subsongs length & seek positions are cached per module: walking the song is only done once
+    char mp_md5[33];
+    md5_from_buffer(mp_md5,33,mp_data,mp_datasize);
+    mp_md5[32]=0;
+    NSString *mpCachePath=[NSHomeDirectory() stringByAppendingPathComponent:@"Library/Caches/openmpt"];
+    [mFileMngr createDirectoryAtPath:mpCachePath withIntermediateDirectories:TRUE attributes:nil error:nil];
+    static int mp_cacheLoads=0;
+    mdz_cacheTrimEvery(mpCachePath,MP_CACHE_MAX_FILES,&mp_cacheLoads,MP_CACHE_TRIM_EVERY);
+    mpCachePath=[mpCachePath stringByAppendingPathComponent:[NSString stringWithFormat:@"%s.len",mp_md5]];
+    utimes([mpCachePath fileSystemRepresentation],NULL); //keep recently played entries out of the trim
+
+    mp_file=ModPlug_LoadWithLengthCache(mp_data,mp_datasize,[mpCachePath fileSystemRepresentation]);
     if (mp_file==NULL) {
         free(mp_data); /* ? */
         NSLog(@"ModPlug_load error");
@@ -5645,11 +6000,14 @@ long src_callback_mpg123(void *cb_data, float **data) {
     opt_reverb_control=tim_reverb;
     //set_current_resampler (RESAMPLE_LINEAR); //resample : MOVE TO SETTINGS
     
+    //decoded instruments are kept from one midi file to the next, up to this amount of sample data
     if (mSlowDevice) {
         ios_play_mode.rate=22050;
+        instrument_cache_size=16*1024*1024;
     } else {
+        instrument_cache_size=64*1024*1024;
     }
-    
+
     FILE *f=fopen([filePath UTF8String],"rb");
     if (f==NULL) {
         NSLog(@"timidity Cannot open file %@",filePath);
@@ -5719,9 +6077,9 @@ long src_callback_mpg123(void *cb_data, float **data) {
     }
     
     
-    vgmFile = open_stdio_streamfile([filePath UTF8String]);
+    vgmFile = open_mmap_streamfile([filePath UTF8String]);
     if (!vgmFile) {
-        NSLog(@"Error open_stdio_streamfile %@",filePath);
+        NSLog(@"Error open_mmap_streamfile %@",filePath);
         mPlayType=0;
         src_delete(src_state);
         return -1;
@@ -6476,8 +6834,8 @@ long src_callback_mpg123(void *cb_data, float **data) {
 }
 -(int) mmp_asapLoad:(NSString*)filePath { //ASAP
     mPlayType=MMP_ASAP;
-    FILE *f;
     int song,duration;
+    long datasize;
     
     //		if (ASAP_IsOurFile([filePath UTF8String])==0) {
     //			NSLog(@"Incompatible with ASAP: %@",filePath);
@@ -6485,19 +6843,14 @@ long src_callback_mpg123(void *cb_data, float **data) {
     //			return -1;
     //		}
     
-    f = fopen([filePath UTF8String], "rb");
-    if (f == NULL) {
+    ASAP_module=(unsigned char*)[self mdz_readFile:filePath size:&datasize];
+    if (ASAP_module == NULL) {
         NSLog(@"ASAP Cannot open file %@",filePath);
         mPlayType=0;
         return -1;
     }
-    fseek(f,0L,SEEK_END);
-    ASAP_module_len=ftell(f);
+    ASAP_module_len=datasize;
     mp_datasize=ASAP_module_len;
-    ASAP_module=(unsigned char*)malloc(ASAP_module_len);
-    fseek(f,0,SEEK_SET);
-    fread(ASAP_module, 1, ASAP_module_len, f);
-    fclose(f);
     
     if (!ASAP_Load(asap, [filePath UTF8String], ASAP_module, ASAP_module_len)) {
         NSLog(@"Cannot ASAP_Load file %@",filePath);
@@ -6629,19 +6982,39 @@ long src_callback_mpg123(void *cb_data, float **data) {
     
     gSpcSlowAPU=1;
     
-    FILE *f=fopen([filePath UTF8String],"rb");
-    if (f==NULL) {
+    long datasize;
+    char *tmp_data=[self mdz_readFile:filePath size:&datasize];
+    if (tmp_data==NULL) {
         NSLog(@"Cannot open file %@",filePath);
         mPlayType=0;
         return -1;
     }
-    fseek(f,0L,SEEK_END);
-    mp_datasize=ftell(f);
-    fclose(f);
+    mp_datasize=datasize;
+    md5_from_buffer(song_md5,33,tmp_data,mp_datasize);
+    song_md5[32]=0;
     
     // Open music file in new emulator
     gme_emu=NULL;
-    err=gme_open_file( [filePath UTF8String], &gme_emu, sample_rate );
+    gme_type_t file_type=NULL;
+    if ((datasize>=2)&&((unsigned char)tmp_data[0]==0x1F)&&((unsigned char)tmp_data[1]==0x8B)) {
+        //gzipped (vgz, ...), inflated by the gme file reader
+        [self mdz_extractArchiveEntry:filePath];
+        err=gme_open_file( [filePath UTF8String], &gme_emu, sample_rate );
+    } else {
+        //same type detection as gme_open_file: extension first, then header
+        file_type=gme_identify_extension( [filePath UTF8String] );
+        if ((!file_type)&&(datasize>=4)) file_type=gme_identify_extension( gme_identify_header( tmp_data ) );
+        if (!file_type) err="wrong file type";
+    }
+    if (file_type) {
+        gme_emu=gme_new_emu( file_type, sample_rate );
+        if (!gme_emu) err="out of memory";
+        else if ((err=gme_load_data( gme_emu, tmp_data, datasize ))) {
+            gme_delete( gme_emu );
+            gme_emu=NULL;
+        }
+    }
+    free(tmp_data);
     if (err) {
         NSLog(@"gme_open_file error: %s",err);
         return -1;
@@ -6678,6 +7051,11 @@ long src_callback_mpg123(void *cb_data, float **data) {
         mod_maxsub=mod_subsongs-1;
         mod_currentsub=track;
         
+        free(gme_scanned_length);
+        gme_scanned_length=(int*)calloc(mod_subsongs,sizeof(int));
+        gme_scanned_length_nb=(gme_scanned_length?mod_subsongs:0);
+        for (int i=0;i<gme_scanned_length_nb;i++) gme_scanned_length[i]=[self getSongLengthfromMD5:i-mod_minsub+1];
+        
         // Start track
         err=gme_start_track( gme_emu, track );
         if (err) {
@@ -6703,8 +7081,8 @@ long src_callback_mpg123(void *cb_data, float **data) {
                 NSString *fileName;
                 NSMutableArray *tmp_path;
                 int gme_subsong_length=gme_info->play_length;
-                if (gme_info->play_length<=0) gme_info->play_length=optGENDefaultLength;
-                mod_total_length+=gme_info->play_length;
+                if (gme_subsong_length<=0) gme_subsong_length=gmeTrackLength(gme_info->play_length,i);
+                mod_total_length+=gme_subsong_length;
                 
                 channels_nb=gme_voice_count( gme_emu );
                 
@@ -6743,16 +7121,10 @@ long src_callback_mpg123(void *cb_data, float **data) {
         
         sprintf(mod_name," %s",mod_filename);
         if (gme_track_info( gme_emu, &gme_info, mod_currentsub )==0) {
-            iModuleLength=gme_info->play_length;
+            //no length tag (NSF,...) : length found by the background scanner if any
+            iModuleLength=gmeTrackLength(gme_info->play_length,mod_currentsub);
             strcpy(gmetype,gme_info->system);
             
-            if (strcmp(gmetype,"NSF")==0) {//NSF
-                //check length in database
-                //iModuleLength=[self getSongLengthfromMD5:mod_currentsub-mod_minsub+1];
-            }
-            
-            if (iModuleLength<=0) iModuleLength=optGENDefaultLength;
-            
             sprintf(mod_message,"Song:%s\nGame:%s\nAuthor:%s\nDumper:%s\nCopyright:%s\nTracks:%d\n%s",
                     (gme_info->song?gme_info->song:" "),
                     (gme_info->game?gme_info->game:" "),
@@ -6789,6 +7161,257 @@ long src_callback_mpg123(void *cb_data, float **data) {
     }
 }
 
+//Open, start & render ahead the next playlist entry into mmp_preroll (preroll_queue, preroll_mutex held)
+-(int) mmp_prerollLoad:(NSString*)filePath playerType:(int)playerType {
+    FILE *f=fopen([filePath UTF8String],"rb");
+    if (f==NULL) {
+        NSLog(@"Preroll cannot open file %@",filePath);
+        return -1;
+    }
+    fseek(f,0L,SEEK_END);
+    int datasize=ftell(f);
+    fseek(f,0,SEEK_SET);
+    unsigned char *data=(unsigned char*)malloc(datasize);
+    if ((data==NULL)||(datasize<4)) {
+        free(data);
+        fclose(f);
+        return -1;
+    }
+    fread(data,1,datasize,f);
+    fclose(f);
+
+    mmp_preroll.play_type=playerType;
+    mmp_preroll.datasize=datasize;
+    mmp_preroll.gme_emu=NULL;
+    mmp_preroll.gme_scanned_length=NULL;
+    mmp_preroll.gme_scanned_length_nb=0;
+    mmp_preroll.ao_ctx=NULL;
+    mmp_preroll.ao_buffer=NULL;
+    mmp_preroll.subsongs=1;
+    mmp_preroll.minsub=mmp_preroll.maxsub=0;
+    mmp_preroll.gmetype[0]=0;
+    md5_from_buffer(mmp_preroll.md5,33,(char*)data,datasize);
+    mmp_preroll.md5[32]=0;
+    sprintf(mmp_preroll.filename,"%s",[[[filePath lastPathComponent] stringByDeletingPathExtension] UTF8String]);
+    sprintf(mmp_preroll.name," %s",mmp_preroll.filename);
+
+    if (playerType==MMP_GME) {
+        Music_Emu *emu=NULL;
+        gme_err_t err;
+        free(data);
+
+        gSpcSlowAPU=1;
+        err=gme_open_file( [filePath UTF8String], &emu, PLAYBACK_FREQ );
+        if (err) {
+            NSLog(@"Preroll gme_open_file error: %s",err);
+            return -1;
+        }
+        gme_set_user_data( emu, my_data );
+        gme_set_user_cleanup( emu, my_cleanup );
+
+        //is a m3u available ?
+        NSString *tmpStr=[NSString stringWithFormat:@"%@.m3u",[filePath stringByDeletingPathExtension]];
+        err=gme_load_m3u(emu,[tmpStr UTF8String] );
+        if (err) {
+            NSString *tmpStr=[NSString stringWithFormat:@"%@.M3U",[filePath stringByDeletingPathExtension]];
+            err=gme_load_m3u(emu,[tmpStr UTF8String] );
+        }
+
+        //same settings as mmp_gmeLoad, without touching the ones of the playing emulator
+        gme_equalizer_t eq;
+        gme_equalizer( emu, &eq );
+        eq.treble=gme_eq.treble;
+        eq.bass=gme_eq.bass;
+        gme_set_equalizer( emu, &eq );
+        gme_set_effects( emu, &gme_fx);
+        gme_ignore_silence(emu,optGMEIgnoreSilence);
+
+        mmp_preroll.subsongs=gme_track_count( emu );
+        mmp_preroll.maxsub=mmp_preroll.subsongs-1;
+        mmp_preroll.gme_scanned_length=(int*)calloc(mmp_preroll.subsongs,sizeof(int));
+        mmp_preroll.gme_scanned_length_nb=(mmp_preroll.gme_scanned_length?mmp_preroll.subsongs:0);
+        for (int i=0;i<mmp_preroll.gme_scanned_length_nb;i++) mmp_preroll.gme_scanned_length[i]=[self getSongLengthfromMD5:i+1 md5:mmp_preroll.md5];
+
+        //this is where GME skips the initial silence
+        err=gme_start_track( emu, 0 );
+        if (err) {
+            NSLog(@"Preroll gme_start_track error: %s",err);
+            gme_delete( emu );
+            free(mmp_preroll.gme_scanned_length);
+            mmp_preroll.gme_scanned_length=NULL;
+            return -1;
+        }
+
+        mmp_preroll.total_length=0;
+        for (int i=0;i<mmp_preroll.subsongs;i++) {
+            gme_info_t *info;
+            if (gme_track_info( emu, &info, i )==0) {
+                mmp_preroll.total_length+=gmeScannedTrackLength(mmp_preroll.gme_scanned_length,mmp_preroll.gme_scanned_length_nb,info->play_length,i);
+                gme_free_info(info);
+            }
+        }
+
+        gme_info_t *info;
+        if (gme_track_info( emu, &info, 0 )==0) {
+            mmp_preroll.length=gmeScannedTrackLength(mmp_preroll.gme_scanned_length,mmp_preroll.gme_scanned_length_nb,info->play_length,0);
+            strcpy(mmp_preroll.gmetype,info->system);
+
+            sprintf(mmp_preroll.message,"Song:%s\nGame:%s\nAuthor:%s\nDumper:%s\nCopyright:%s\nTracks:%d\n%s",
+                    (info->song?info->song:" "),
+                    (info->game?info->game:" "),
+                    (info->author?info->author:" "),
+                    (info->dumper?info->dumper:" "),
+                    (info->copyright?info->copyright:" "),
+                    gme_track_count( emu ),
+                    (info->comment?info->comment:" "));
+
+            if (info->song){
+                if (info->song[0]) sprintf(mmp_preroll.name," %s",info->song);
+            }
+            gme_free_info(info);
+        } else {
+            strcpy(mmp_preroll.gmetype,"N/A");
+            strcpy(mmp_preroll.message,"N/A\n");
+            mmp_preroll.length=optGENDefaultLength;
+        }
+        if (mmp_preroll.length>optGMEFadeOut) gme_set_fade( emu, mmp_preroll.length-optGMEFadeOut,optGMEFadeOut ); //Fade 1s before end
+        mmp_preroll.numChannels=gme_voice_count( emu );
+
+        for (int i=0;i<SOUND_PREROLL_BUFFER_NB;i++) gme_play( emu, SOUND_BUFFER_SIZE_SAMPLE*2, mmp_preroll.data+i*SOUND_BUFFER_SIZE_SAMPLE*2 );
+        mmp_preroll.gme_emu=emu;
+    }
+    if (playerType==MMP_AOSDK) {
+        uint32 type=0;
+        uint32 filesig=data[0]<<24 | data[1]<<16 | data[2]<<8 | data[3];
+        while (ao_types[type].sig != 0xffffffff) {
+            if (filesig == ao_types[type].sig) break;
+            else type++;
+        }
+        if (ao_types[type].sig == 0xffffffff) {
+            free(data);
+            return -1;
+        }
+
+        //libs are looked up next to the file
+        pathdir=[[filePath stringByDeletingLastPathComponent] UTF8String];
+        void *ctx=(*ao_types[type].start)(data, datasize, 0, optGENDefaultLength);
+        if (ctx==NULL) {
+            NSLog(@"Preroll: engine rejected file %@",filePath);
+            free(data);
+            return -1;
+        }
+        (*ao_types[type].fillinfo)(ctx,&mmp_preroll.ao_info);
+
+        mmp_preroll.length=mmp_preroll.ao_info.length_ms+mmp_preroll.ao_info.fade_ms;
+        if (mmp_preroll.length==0) mmp_preroll.length=optGENDefaultLength;
+        mmp_preroll.total_length=mmp_preroll.length;
+        mmp_preroll.numChannels=24;
+        if (mmp_preroll.ao_info.info[1][0]&&strcmp(mmp_preroll.ao_info.info[1],"n/a")) sprintf(mmp_preroll.name," %s",mmp_preroll.ao_info.info[1]);
+        sprintf(mmp_preroll.message,"%s%s\n%s%s\n%s%s\n%s%s\n%s%s\n%s%s\n%s%s\n",
+                mmp_preroll.ao_info.title[2],mmp_preroll.ao_info.info[2],
+                mmp_preroll.ao_info.title[3],mmp_preroll.ao_info.info[3],
+                mmp_preroll.ao_info.title[4],mmp_preroll.ao_info.info[4],
+                mmp_preroll.ao_info.title[5],mmp_preroll.ao_info.info[5],
+                mmp_preroll.ao_info.title[6],mmp_preroll.ao_info.info[6],
+                mmp_preroll.ao_info.title[7],mmp_preroll.ao_info.info[7],
+                mmp_preroll.ao_info.title[8],mmp_preroll.ao_info.info[8]);
+
+        for (int i=0;i<SOUND_PREROLL_BUFFER_NB;i++) (*ao_types[type].gen)(ctx,(int16*)(mmp_preroll.data+i*SOUND_BUFFER_SIZE_SAMPLE*2), SOUND_BUFFER_SIZE_SAMPLE);
+        mmp_preroll.ao_type=type;
+        mmp_preroll.ao_ctx=ctx;
+        mmp_preroll.ao_buffer=data;
+    }
+    mmp_preroll.data_len=SOUND_PREROLL_BUFFER_NB*SOUND_BUFFER_SIZE_SAMPLE;
+    return 0;
+}
+-(void) mmp_prerollFree {
+    if (mmp_preroll.state==PREROLL_NONE) return;
+    if (mmp_preroll.play_type==MMP_GME) {
+        gme_delete( mmp_preroll.gme_emu );
+        free(mmp_preroll.gme_scanned_length);
+    }
+    if (mmp_preroll.play_type==MMP_AOSDK) {
+        (*ao_types[mmp_preroll.ao_type].stop)(mmp_preroll.ao_ctx);
+        free(mmp_preroll.ao_buffer);
+    }
+    mmp_preroll.gme_emu=NULL;
+    mmp_preroll.gme_scanned_length=NULL;
+    mmp_preroll.ao_ctx=NULL;
+    mmp_preroll.ao_buffer=NULL;
+    mmp_preroll.state=PREROLL_NONE;
+}
+//Drop the pre-rolled entry, and any request still queued. Never waits for a pre-roll load in
+//progress: it will see the new serial and release what it loaded on preroll_queue.
+-(void) mmp_prerollCancel {
+    __atomic_fetch_add(&preroll_serial,1,__ATOMIC_SEQ_CST);
+    if (pthread_mutex_trylock(&preroll_mutex)==0) {
+        [self mmp_prerollFree];
+        pthread_mutex_unlock(&preroll_mutex);
+    } else dispatch_async(preroll_queue, ^{
+        pthread_mutex_lock(&preroll_mutex);
+        if (mmp_preroll.serial!=preroll_serial) [self mmp_prerollFree];
+        pthread_mutex_unlock(&preroll_mutex);
+    });
+    preroll_drain_len=preroll_drain_ofs=0;
+    mPrerollStarted=0;
+}
+//Called by the generation thread when the current GME/AOSDK entry ended after 'frame' frames of 'dst' :
+//swap in the pre-rolled engine and complete the slot with its first frames. Returns 0 if nothing is ready.
+-(int) mmp_prerollSwitch:(short int*)dst frame:(int)frame {
+    if (pthread_mutex_trylock(&preroll_mutex)) return 0;
+    if ((mmp_preroll.state!=PREROLL_READY)||(mmp_preroll.serial!=preroll_serial)) {
+        pthread_mutex_unlock(&preroll_mutex);
+        return 0;
+    }
+    //release the entry which just ended
+    if (mPlayType==MMP_GME) {
+        gme_delete( gme_emu );
+        free(gme_scanned_length);
+    }
+    if (mPlayType==MMP_AOSDK) {
+        (*ao_types[ao_type].stop)(ao_ctx);
+        free(ao_buffer);
+    }
+    gme_emu=mmp_preroll.gme_emu;
+    gme_scanned_length=mmp_preroll.gme_scanned_length;
+    gme_scanned_length_nb=mmp_preroll.gme_scanned_length_nb;
+    ao_type=mmp_preroll.ao_type;
+    ao_ctx=mmp_preroll.ao_ctx;
+    ao_buffer=mmp_preroll.ao_buffer;
+    ao_info=mmp_preroll.ao_info;
+    mPlayType=mmp_preroll.play_type;
+    mp_datasize=mmp_preroll.datasize;
+    numChannels=mmp_preroll.numChannels;
+    mod_subsongs=mmp_preroll.subsongs;
+    mod_minsub=mod_currentsub=mmp_preroll.minsub;
+    mod_maxsub=mmp_preroll.maxsub;
+    mod_total_length=mmp_preroll.total_length;
+    mSingleSubMode=0;
+    strcpy(mod_filename,mmp_preroll.filename);
+    strcpy(mod_name,mmp_preroll.name);
+    strcpy(mod_message,mmp_preroll.message);
+    strcpy(gmetype,mmp_preroll.gmetype);
+    strcpy(song_md5,mmp_preroll.md5);
+    mNewModuleLength=mmp_preroll.length;
+
+    //frames rendered ahead move to the drain buffer, so that the next pre-roll can reuse the other one
+    short int *tmp=preroll_drain_data;
+    preroll_drain_data=mmp_preroll.data;
+    mmp_preroll.data=tmp;
+    preroll_drain_len=mmp_preroll.data_len;
+    preroll_drain_ofs=0;
+
+    mmp_preroll.gme_emu=NULL;
+    mmp_preroll.gme_scanned_length=NULL;
+    mmp_preroll.ao_ctx=NULL;
+    mmp_preroll.ao_buffer=NULL;
+    mmp_preroll.state=PREROLL_NONE;
+    pthread_mutex_unlock(&preroll_mutex);
+
+    prerollDrain(dst+frame*2,SOUND_BUFFER_SIZE_SAMPLE-frame);
+    return 1;
+}
+
 static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
     
     const char **pa = (const char**)e1;
@@ -6835,6 +7458,7 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
     mplayer_error_msg[0]=0;
     mSingleSubMode=singleSubMode;
     
+    [self mmp_prerollCancel];
     [self iPhoneDrv_LittlePlayStart];
     
     if (archiveMode==0) {
@@ -6850,6 +7474,7 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
         filePath=[NSHomeDirectory() stringByAppendingPathComponent:_filePath];
         
         mdz_IsArchive=0;
+        mdz_ArchiveInMemory=0;
         mdz_defaultMODPLAYER=defaultMODPLAYER;
         mdz_defaultSAPPLAYER=defaultSAPPLAYER;
         mdz_defaultVGMPLAYER=defaultVGMPLAYER;
@@ -6889,6 +7514,8 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
             if ([extension caseInsensitiveCompare:[filetype_extLHA_ARCHIVE objectAtIndex:i]]==NSOrderedSame) {found=2;break;}
             if ([file_no_ext caseInsensitiveCompare:[filetype_extLHA_ARCHIVE objectAtIndex:i]]==NSOrderedSame) {found=2;break;}
         }
+        //decoded solid block is only kept while playing from the same archive
+        if (found!=1) fex_closeCached();
         if (found) { //archived file
             mdz_IsArchive=0;
             mdz_ArchiveFilesCnt=0;
@@ -6896,7 +7523,7 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
             strcpy(archive_filename,mod_filename);
             
             if (found==1) { //FEX
-                [self fex_scanarchive:[filePath UTF8String]];
+                int aux_cnt=[self fex_scanarchive:[filePath UTF8String]];
                 if (mdz_ArchiveFilesCnt) {
                     FILE *f;
                     f = fopen([filePath UTF8String], "rb");
@@ -6913,27 +7540,37 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
                     NSString *tmpArchivePath=[NSString stringWithFormat:@"%@/tmp/tmpArchive",NSHomeDirectory()];
                     [mFileMngr removeItemAtPath:tmpArchivePath error:&err];
                     
-                    //extract to tmp dir
-                    [mFileMngr createDirectoryAtPath:tmpArchivePath withIntermediateDirectories:TRUE attributes:nil error:&err];
-                    [self addSkipBackupAttributeToItemAtPath:tmpArchivePath];
+                    if (aux_cnt==0) {
+                        //self contained entries: decompressed in memory when played, nothing extracted
+                        mdz_ArchiveInMemory=1;
+                        snprintf(mdz_ArchivePath,sizeof(mdz_ArchivePath),"%s",[filePath UTF8String]);
+                        if (singleArcMode&&(archiveIndex>=0)&&(archiveIndex<mdz_ArchiveFilesCnt)) {
+                            [self fex_listToArray:[filePath UTF8String] file_index:archiveIndex];
+                        } else [self fex_listToArray:[filePath UTF8String] file_index:-1];
+                        if (mdz_ArchiveFilesCnt==0) return -1;
+                    } else {
+                        //extract to tmp dir
+                        [mFileMngr createDirectoryAtPath:tmpArchivePath withIntermediateDirectories:TRUE attributes:nil error:&err];
+                        [self addSkipBackupAttributeToItemAtPath:tmpArchivePath];
                     
-                    if (found==1) { //FEX
+                        if (found==1) { //FEX
                         
-                        //update singlefiletype flag
-                        //[self isAcceptedFile:[NSString stringWithFormat:@"Documents/tmpArchive/%s",mdz_ArchiveFilesList[mdz_currentArchiveIndex] no_aux_file:1];
-                        if (singleArcMode&&(archiveIndex>=0)&&(archiveIndex<mdz_ArchiveFilesCnt)){
-                            NSString *tmpstr=[self fex_getfilename:[filePath UTF8String] index:archiveIndex];
-                            //NSLog(@"yo:%@",tmpstr);
-                        }
+                            //update singlefiletype flag
+                            //[self isAcceptedFile:[NSString stringWithFormat:@"Documents/tmpArchive/%s",mdz_ArchiveFilesList[mdz_currentArchiveIndex] no_aux_file:1];
+                            if (singleArcMode&&(archiveIndex>=0)&&(archiveIndex<mdz_ArchiveFilesCnt)){
+                                NSString *tmpstr=[self fex_getfilename:[filePath UTF8String] index:archiveIndex];
+                                //NSLog(@"yo:%@",tmpstr);
+                            }
                         
-                        if (mSingleFileType&&singleArcMode&&(archiveIndex>=0)&&(archiveIndex<mdz_ArchiveFilesCnt)) {
-                            mdz_ArchiveFilesCnt=1;
-                            [self fex_extractSingleFileToPath:[filePath UTF8String] path:[tmpArchivePath UTF8String] file_index:archiveIndex];
-                        } else {
+                            if (mSingleFileType&&singleArcMode&&(archiveIndex>=0)&&(archiveIndex<mdz_ArchiveFilesCnt)) {
+                                mdz_ArchiveFilesCnt=1;
+                                [self fex_extractSingleFileToPath:[filePath UTF8String] path:[tmpArchivePath UTF8String] file_index:archiveIndex];
+                            } else {
                             
-                            [self fex_extractToPath:[filePath UTF8String] path:[tmpArchivePath UTF8String]];
+                                [self fex_extractToPath:[filePath UTF8String] path:[tmpArchivePath UTF8String]];
+                            }
+                        } else {
                         }
-                    } else {
                     }
                     mdz_currentArchiveIndex=0;
                     
@@ -7377,6 +8014,8 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
         int pl_idx=[((NSNumber*)[available_player objectAtIndex:i]) intValue];
         int successful_loading=0;
         //NSLog(@"pl_idx: %d",i);
+        //archive kept in memory: only these players load from a buffer, others need the entry on disk
+        if ((pl_idx!=MMP_OPENMPT)&&(pl_idx!=MMP_GME)&&(pl_idx!=MMP_ASAP)&&(pl_idx!=MMP_XMP)&&(pl_idx!=MMP_HVL)&&(pl_idx!=MMP_STSOUND)) [self mdz_extractArchiveEntry:filePath];
         switch (pl_idx) {
             case MMP_TIMIDITY:
                 if ([self mmp_timidityLoad:filePath]==0) return 0; //SUCCESSFULLY LOADED
@@ -7453,6 +8092,78 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
     return 1;  //Could not find a lib to load module
 }
 //*****************************************
+//Gapless playback
+-(void) PrerollModule:(NSString*)_filePath {
+    NSArray *filetype_extGME=[SUPPORTED_FILETYPE_GME componentsSeparatedByString:@","];
+    NSArray *filetype_extAOSDK=[SUPPORTED_FILETYPE_AOSDK componentsSeparatedByString:@","];
+    NSArray *filetype_extVGM=[SUPPORTED_FILETYPE_VGM componentsSeparatedByString:@","];
+    NSArray *filetype_extASAP=[SUPPORTED_FILETYPE_ASAP componentsSeparatedByString:@","];
+    int playerType=MMP_NONE;
+
+    //engines are swapped by the generation thread, so both have to be instance based
+    if ((mPlayType!=MMP_GME)&&(mPlayType!=MMP_AOSDK)) return;
+    //slow device mode renders GME at half rate, infinite loop never reaches the end
+    if (mSlowDevice||(mLoopMode==1)) return;
+
+    NSMutableArray *temparray_filepath=[NSMutableArray arrayWithArray:[[_filePath lastPathComponent] componentsSeparatedByString:@"."]];
+    NSString *extension = (NSString *)[temparray_filepath lastObject];
+    [temparray_filepath removeLastObject];
+    NSString *file_no_ext=[temparray_filepath componentsJoinedByString:@"."];
+
+    //same player choice as LoadModule
+    for (int i=0;i<[filetype_extAOSDK count];i++) {
+        if (([extension caseInsensitiveCompare:[filetype_extAOSDK objectAtIndex:i]]==NSOrderedSame)||
+            ([file_no_ext caseInsensitiveCompare:[filetype_extAOSDK objectAtIndex:i]]==NSOrderedSame)) {
+            playerType=MMP_AOSDK;
+            break;
+        }
+    }
+    for (int i=0;i<[filetype_extGME count];i++) {
+        NSString *ext=nil;
+        if ([extension caseInsensitiveCompare:[filetype_extGME objectAtIndex:i]]==NSOrderedSame) ext=extension;
+        else if ([file_no_ext caseInsensitiveCompare:[filetype_extGME objectAtIndex:i]]==NSOrderedSame) ext=file_no_ext;
+        if (ext) {
+            bool is_vgm=false;
+            for (int j=0;j<[filetype_extVGM count];j++)
+                if ([ext caseInsensitiveCompare:[filetype_extVGM objectAtIndex:j]]==NSOrderedSame) {
+                    is_vgm=true;
+                    break;
+                }
+            bool is_sap=false;
+            for (int j=0;j<[filetype_extASAP count];j++)
+                if ([ext caseInsensitiveCompare:[filetype_extASAP objectAtIndex:j]]==NSOrderedSame) {
+                    is_sap=true;
+                    break;
+                }
+            if ((is_vgm && (mdz_defaultVGMPLAYER!=DEFAULT_VGMGME)) ||
+                (is_sap && (mdz_defaultSAPPLAYER!=DEFAULT_SAPGME)) ) break;
+            playerType=MMP_GME;
+            break;
+        }
+    }
+    if (playerType==MMP_NONE) return;
+
+    int serial=preroll_serial;
+    NSString *filePath=[[NSHomeDirectory() stringByAppendingPathComponent:_filePath] retain];
+    dispatch_async(preroll_queue, ^{
+        pthread_mutex_lock(&preroll_mutex);
+        if ((serial==preroll_serial)&&(mmp_preroll.state==PREROLL_NONE)) {
+            if ([self mmp_prerollLoad:filePath playerType:playerType]==0) {
+                mmp_preroll.serial=serial;
+                mmp_preroll.state=PREROLL_READY;
+                //cancelled while loading
+                if (serial!=preroll_serial) [self mmp_prerollFree];
+            }
+        }
+        pthread_mutex_unlock(&preroll_mutex);
+        [filePath release];
+    });
+}
+//TRUE once, when the pre-rolled entry started playing in place of the previous one
+-(BOOL) isPrerollStarted {
+    return (__atomic_exchange_n(&mPrerollStarted,0,__ATOMIC_ACQ_REL)?YES:NO);
+}
+//*****************************************
 //Playback commands
 -(void) selectPrevArcEntry {
     if (mdz_IsArchive&&mdz_ArchiveFilesCnt) {
@@ -7529,8 +8240,7 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
                 mod_currentsub=subsong;
                 sprintf(mod_name," %s",mod_filename);
                 if (gme_track_info( gme_emu, &gme_info, mod_currentsub )==0) {
-                    iModuleLength=gme_info->play_length;
-                    if (iModuleLength<=0) iModuleLength=optGENDefaultLength;
+                    iModuleLength=gmeTrackLength(gme_info->play_length,mod_currentsub);
                     strcpy(gmetype,gme_info->system);
                     sprintf(mod_message,"Song:%s\nGame:%s\nAuthor:%s\nDumper:%s\nCopyright:%s\nTracks:%d\n%s",
                             (gme_info->song?gme_info->song:" "),
@@ -7703,9 +8413,14 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
     bGlobalSeekProgress=0;
     bGlobalAudioPause=0;
     
+    [self mmp_prerollCancel];
+    
     if (mPlayType==MMP_GME) {
         gme_delete( gme_emu );
         gme_emu=NULL;
+        free(gme_scanned_length);
+        gme_scanned_length=NULL;
+        gme_scanned_length_nb=0;
     }
     if (mPlayType==MMP_XMP) {
         xmp_end_player(xmp_ctx);
@@ -7729,7 +8444,8 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
         adplugDB=NULL;
     }
     if (mPlayType==MMP_AOSDK) {
-        (*ao_types[ao_type].stop)();
+        (*ao_types[ao_type].stop)(ao_ctx);
+        ao_ctx=NULL;
         if (ao_buffer) free(ao_buffer);
     }
     if (mPlayType==MMP_SEXYPSF) { //SexyPSF
@@ -7932,8 +8648,7 @@ static int mdz_ArchiveFiles_compare(const void *e1, const void *e2) {
     if ((subsong<mod_minsub)||(subsong>mod_maxsub)) return @"";
     if (mPlayType==MMP_GME) {
         if (gme_track_info( gme_emu, &gme_info, subsong )==0) {
-            int sublen=gme_info->play_length;
-            if (sublen<=0) sublen=optGENDefaultLength;
+            int sublen=gmeTrackLength(gme_info->play_length,subsong);
             
             result=nil;
             if (gme_info->song){
@@ -8358,7 +9073,7 @@ extern "C" void adjust_amplification(void);
     mLoopMode=val;
 }
 -(void) Seek:(int) seek_time {
-    if ((mPlayType==MMP_AOSDK)||(mPlayType==MMP_UADE)||(mPlayType==MMP_SIDPLAY)
+    if ((mPlayType==MMP_AOSDK)||(mPlayType==MMP_UADE)||((mPlayType==MMP_SIDPLAY)&&(mSidEngineType==1))
         ||(mPlayType==MMP_MDXPDX)||(mPlayType==MMP_GSF)||(mPlayType==MMP_PMDMINI)||(mPlayType==MMP_LAZYUSF)||mNeedSeek) return;
     
     if (mPlayType==MMP_STSOUND) {
@@ -17,6 +17,7 @@
 
 #define DEFAULT_WAIT_TIME_MS  0.001   //in s
 #define DEFAULT_WAIT_TIME_UADE_MS  0.001   //in s
+#define SOUND_RING_WAIT_TIME_MS  10   //in ms, max wait for a free audio buffer
 
 //#define STATISTICS_URL @"http://localhost:8081"
 #define STATISTICS_URL @"https://modizerdb.appspot.com"
@@ -44,6 +45,7 @@
 #define SOUND_BUFFER_SIZE_SAMPLE 1024
 //PLAYBACK_FREQ/30
 #define SOUND_BUFFER_NB 24 //64
+#define SOUND_PREROLL_BUFFER_NB 4 //buffers rendered ahead when the next entry is pre-rolled
 #define MIDIFX_OFS 12 //32
 
 #define SOUND_MAXMOD_CHANNELS 256
@@ -58,6 +60,7 @@
 #define SND_THREAD_PRIO 0.9f
 
 #define SEEK_START_MARGIN_FROM_END 2000
+#define PREROLL_START_MARGIN_FROM_END 10000 //in ms, next playlist entry is pre-rolled from there
 
 /*#define GME_DEFAULT_LENGTH 150000
 #define SID_DEFAULT_LENGTH 150000
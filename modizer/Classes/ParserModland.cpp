@@ -9,202 +9,318 @@
 #include "ParserModland.hpp"
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "fex.h"
 
+#define MODLAND_MAX_NODES 6
+
+/*
+    all labels point inside the memory mapped allmods.txt (not 0 terminated),
+    so parsing does not need any per line allocation
+ */
+typedef struct {
+    const char *str;
+    int len;
+} label_t;
+
 typedef struct {
     int file_size;
     int format_id;
-    int node1_id;
-    int node2_id;
-    int node3_id;
-    int node4_id;
-    int node5_id;
-    int node6_id;
-    char *filename;
-    void *next_entry;
+    int nb_nodes;
+    int node_id[MODLAND_MAX_NODES];
+    label_t filename;
 } file_entry_t;
 
 typedef struct {
-    int format_id;
-    char *format_name;
-    void *next_entry;
-} format_entry_t;
+    label_t label;
+    unsigned int hash;
+} node_entry_t;
 
+/*
+    string interning: open addressing hash table of indexes in entries[],
+    entries are appended in parsing order and sorted once parsing is done
+ */
 typedef struct {
-    int format_id;
-    char *format_name;
-    void *next_entry;
-} node_entry_t;
+    node_entry_t *entries;
+    int count,alloc;
+    int *table;   //-1: empty slot
+    unsigned int table_mask;
+} node_set_t;
 
 file_entry_t *files_array;
 int files_array_count;
+static int files_array_alloc;
+
+node_set_t formats_set;
+node_set_t nodes_set;
+
+static char *allmods_data;
+static size_t allmods_size;
+
+static unsigned int labelHash(const char *str,int len) {
+    //FNV-1a
+    unsigned int h=2166136261u;
+    for (int i=0;i<len;i++) {
+        h^=(unsigned char)str[i];
+        h*=16777619u;
+    }
+    return h;
+}
+
+static int labelCmp(const label_t *a,const label_t *b) {
+    int len=(a->len<b->len?a->len:b->len);
+    int res=memcmp(a->str,b->str,len);
+    if (res) return res;
+    return a->len-b->len;
+}
 
-format_entry_t *formats_array;
-int formats_array_count;
+static void nodeSetFree(node_set_t *set) {
+    free(set->entries);
+    free(set->table);
+    memset(set,0,sizeof(node_set_t));
+}
 
-node_entry_t *nodes_array;
-int nodes_array_count;
-node_entry_t *nodes_index_label[26*2+10+1];
-node_entry_t *nodes_index_label_prev[26*2+10+1];
+static int nodeSetInit(node_set_t *set,int table_size) {
+    memset(set,0,sizeof(node_set_t));
+    set->table=(int*)malloc(table_size*sizeof(int));
+    if (!set->table) return -1;
+    memset(set->table,0xFF,table_size*sizeof(int));
+    set->table_mask=table_size-1;
+    return 0;
+}
+
+static int nodeSetGrow(node_set_t *set) {
+    int table_size=(set->table_mask+1)*2;
+    int *table=(int*)malloc(table_size*sizeof(int));
+    if (!table) return -1;
+    memset(table,0xFF,table_size*sizeof(int));
+    for (int i=0;i<set->count;i++) {
+        unsigned int slot=set->entries[i].hash&(table_size-1);
+        while (table[slot]>=0) slot=(slot+1)&(table_size-1);
+        table[slot]=i;
+    }
+    free(set->table);
+    set->table=table;
+    set->table_mask=table_size-1;
+    return 0;
+}
 
 /*
     check if node already exists, create a new one if not
+    return node index, <0 on error
  */
-int parseAddNode(char *node_label) {
+static int nodeSetAdd(node_set_t *set,const char *str,int len) {
     //null or empty string: nothing to do
-    if (!node_label) return -1;
-    if (node_label[0]==0) return -2;
-    
-    //precompute index entry
-    char c=node_label[0];
-    if ((c>='a')&&(c<='z')) c=c-'a'+11+26;
-    else if ((c>='A')&&(c<='Z')) c=c-'A'+11;
-    else if ((c>='0')&&(c<='9')) c=c-'0'+1;
-    else c=0;
-    
-    //existing array, search if & where to insert
-    if (nodes_array) {
-        //first node already exists
-        node_entry_t *p=nodes_array;
-        node_entry_t *prev_p=NULL;
-        
-        //try fast search
-        if (nodes_index_label_prev[c]) p=nodes_index_label_prev[c];
-        
-        while (p) {
-            if (strcmp(node_label,p->format_name)<0) {
-                prev_p=p;
-                p=(node_entry_t*)p->next_entry;
-            } else if (strcmp(node_label,p->format_name)==0) {
-                //duplicate
-                return 0;
-            } else {
-                //new entry
-                node_entry_t *new_entry;
-                new_entry=(node_entry_t*)malloc(sizeof(node_entry_t));
-                new_entry->format_name=(char*)malloc(strlen(node_label)+1);
-                strcpy(new_entry->format_name,node_label);
-                new_entry->next_entry=p;
-                if (prev_p) prev_p->next_entry=new_entry;
-                else {
-                    //special case: insert at 1st place
-                    nodes_array=new_entry;
-                }
-                
-                if (nodes_index_label[c]==NULL) {
-                    nodes_index_label[c]=new_entry;
-                    nodes_index_label_prev[c]=prev_p;
-                }/* else if (
-                
-                nodes_array_count++;*/
-                return nodes_array_count;
-            }
-        }
-        
-    } else {
-        //first node
-        nodes_array=(node_entry_t*)malloc(sizeof(node_entry_t));
-        nodes_array->format_name=(char*)malloc(strlen(node_label)+1);
-        strcpy(nodes_array->format_name,node_label);
-        nodes_array_count=1;
-        
-        nodes_index_label[c]=nodes_array;
-        nodes_index_label_prev[c]=NULL;
+    if (!str) return -1;
+    if (len==0) return -2;
+
+    unsigned int h=labelHash(str,len);
+    unsigned int slot=h&set->table_mask;
+    int idx;
+    while ((idx=set->table[slot])>=0) {
+        node_entry_t *e=&(set->entries[idx]);
+        if ((e->hash==h)&&(e->label.len==len)&&(memcmp(e->label.str,str,len)==0)) return idx; //duplicate
+        slot=(slot+1)&set->table_mask;
+    }
+
+    //new entry
+    if (set->count==set->alloc) {
+        int alloc=(set->alloc?set->alloc*2:1024);
+        node_entry_t *entries=(node_entry_t*)realloc(set->entries,alloc*sizeof(node_entry_t));
+        if (!entries) return -3;
+        set->entries=entries;
+        set->alloc=alloc;
+    }
+    idx=set->count++;
+    set->entries[idx].label.str=str;
+    set->entries[idx].label.len=len;
+    set->entries[idx].hash=h;
+    set->table[slot]=idx;
+
+    //keep load factor under 50%
+    if ((unsigned int)set->count*2>set->table_mask) {
+        if (nodeSetGrow(set)) return -3;
+    }
+    return idx;
+}
+
+static node_entry_t *sort_entries;
+static int sortEntriesCmp(const void *a,const void *b) {
+    return labelCmp(&(sort_entries[*(const int*)a].label),&(sort_entries[*(const int*)b].label));
+}
+
+/*
+    sort entries by label, return the remapping table old index -> sorted index
+ */
+static int *nodeSetSort(node_set_t *set) {
+    int *order=(int*)malloc((set->count+1)*sizeof(int));
+    int *remap=(int*)malloc((set->count+1)*sizeof(int));
+    node_entry_t *sorted=(node_entry_t*)malloc((set->count+1)*sizeof(node_entry_t));
+    if ((!order)||(!remap)||(!sorted)) {
+        free(order);free(remap);free(sorted);
+        return NULL;
+    }
+    for (int i=0;i<set->count;i++) order[i]=i;
+    sort_entries=set->entries;
+    qsort(order,set->count,sizeof(int),sortEntriesCmp);
+    for (int i=0;i<set->count;i++) {
+        remap[order[i]]=i;
+        sorted[i]=set->entries[order[i]];
+    }
+    free(order);
+    free(set->entries);
+    set->entries=sorted;
+    set->alloc=set->count+1;
+
+    //hash table still refers to parsing order
+    memset(set->table,0xFF,(set->table_mask+1)*sizeof(int));
+    for (int i=0;i<set->count;i++) {
+        unsigned int slot=set->entries[i].hash&set->table_mask;
+        while (set->table[slot]>=0) slot=(slot+1)&set->table_mask;
+        set->table[slot]=i;
     }
-    return nodes_array_count;
+    return remap;
+}
+
+void parseModlandFree() {
+    free(files_array);
+    files_array=NULL;
+    files_array_count=files_array_alloc=0;
+    nodeSetFree(&formats_set);
+    nodeSetFree(&nodes_set);
+    if (allmods_data) munmap(allmods_data,allmods_size);
+    allmods_data=NULL;
+    allmods_size=0;
 }
 
 int parseModland(const char *filepath) {
-    FILE *f;
-    
-    //reset entries counters
-    files_array_count=0;
-    formats_array_count=0;
-    nodes_array_count=0;
-    memset(nodes_index_label,0,sizeof(node_entry_t)*(26*2+10+1));
-    
-    f=fopen(filepath,"rt");
-    if (f) {
-        char buffer[256];
-        file_entry_t *current_file_entry;
-        files_array=NULL;
-        
-        while (fgets(buffer,256,f)) {
-            //parse a line
-            //---------------
-            //format: <filesize:digit><spaces><filepath>
-            //sample: 1023	Ad Lib/AdLib Tracker 2 (v9 - v11)/Brendan Bailey/thee chiptune.a2m
-            
-            if (files_array==NULL) {
-                //first entry
-                current_file_entry=(file_entry_t*)malloc(sizeof(file_entry_t));
-                current_file_entry->next_entry=NULL;
-                files_array=current_file_entry;
-            } else {
-                current_file_entry->next_entry=(file_entry_t*)malloc(sizeof(file_entry_t));
-                current_file_entry=(file_entry_t*)current_file_entry->next_entry;
-                current_file_entry->next_entry=NULL;
-            }
+    int fd;
+    struct stat st;
 
-            int i=0;
-            
-            //get filesize
-            int file_size=0;
-            while (buffer[i]) {
-                if (buffer[i]=='\t') break;
-                file_size=file_size*10+(buffer[i]-'0');
-                i++;
-            }
-            if (buffer[i]) i++;
-            else {
-                printf("parsing issue after file size\n");
-                break;
+    //reset entries
+    parseModlandFree();
+
+    fd=open(filepath,O_RDONLY);
+    if (fd<0) return -1;
+    if ((fstat(fd,&st)<0)||(st.st_size==0)) {
+        close(fd);
+        return -1;
+    }
+    allmods_size=st.st_size;
+    allmods_data=(char*)mmap(NULL,allmods_size,PROT_READ,MAP_PRIVATE,fd,0);
+    close(fd);
+    if (allmods_data==MAP_FAILED) {
+        allmods_data=NULL;
+        allmods_size=0;
+        return -1;
+    }
+    madvise(allmods_data,allmods_size,MADV_SEQUENTIAL);
+
+    //rough estimate: 1 file per 60 bytes, 1 node per 10 files
+    files_array_alloc=(int)(allmods_size/60)+1024;
+    files_array=(file_entry_t*)malloc(files_array_alloc*sizeof(file_entry_t));
+    if ((!files_array)||nodeSetInit(&formats_set,1024)||nodeSetInit(&nodes_set,65536)) {
+        parseModlandFree();
+        return -2;
+    }
+
+    const char *p=allmods_data;
+    const char *end=allmods_data+allmods_size;
+    while (p<end) {
+        //parse a line
+        //---------------
+        //format: <filesize:digit><tab><filepath>
+        //sample: 1023	Ad Lib/AdLib Tracker 2 (v9 - v11)/Brendan Bailey/thee chiptune.a2m
+        const char *eol=(const char*)memchr(p,'\n',end-p);
+        if (!eol) eol=end;
+        const char *line_end=eol;
+        if ((line_end>p)&&(line_end[-1]=='\r')) line_end--;
+
+        if (line_end==p) {
+            //empty line
+            p=eol+1;
+            continue;
+        }
+
+        //get filesize
+        int file_size=0;
+        while ((p<line_end)&&(*p!='\t')) {
+            file_size=file_size*10+(*p-'0');
+            p++;
+        }
+        if (p==line_end) {
+            printf("parsing issue after file size\n");
+            parseModlandFree();
+            return -3;
+        }
+        p++;
+
+        if (files_array_count==files_array_alloc) {
+            int alloc=files_array_alloc*2;
+            file_entry_t *files=(file_entry_t*)realloc(files_array,alloc*sizeof(file_entry_t));
+            if (!files) {
+                parseModlandFree();
+                return -2;
             }
-            
-            current_file_entry->file_size=file_size;
-            
-            //get nodes & path
-            char filepath[256];
-            int j=0;
-            int k=0;
-            while (buffer[i]) {
-                if (buffer[i]!='\n') {
-                    if (buffer[i]=='/') {
-                        //new path component
-                        char node_label[256];
-                        memcpy(node_label,filepath+k,j-k);
-                        node_label[j-k]=0;
-                        
-                        if (k==0) {
-                            //got 1st node: format
-                            
-                        } else {
-                            //got 2ndary node: artist, subformat, albums, ...
-                            if (parseAddNode(node_label)<0) {
-                                printf("Issue when adding node: %s\n",node_label);
-                            }
-                        }
-                        k=j+1;
-                    }
-                    filepath[j++]=buffer[i++];
+            files_array=files;
+            files_array_alloc=alloc;
+        }
+        file_entry_t *current_file_entry=&(files_array[files_array_count]);
+        current_file_entry->file_size=file_size;
+        current_file_entry->format_id=-1;
+        current_file_entry->nb_nodes=0;
+
+        //get nodes & path
+        const char *k=p;
+        while (p<line_end) {
+            if (*p=='/') {
+                //new path component
+                if (p==k) {
+                    //empty component, ignore
+                } else if (current_file_entry->format_id<0) {
+                    //got 1st node: format
+                    current_file_entry->format_id=nodeSetAdd(&formats_set,k,(int)(p-k));
                 } else {
-                    filepath[j]=0;
-                    break;
+                    //got 2ndary node: artist, subformat, albums, ...
+                    int node_id=nodeSetAdd(&nodes_set,k,(int)(p-k));
+                    if (node_id<0) {
+                        printf("Issue when adding node: %.*s\n",(int)(p-k),k);
+                    } else if (current_file_entry->nb_nodes<MODLAND_MAX_NODES) {
+                        current_file_entry->node_id[current_file_entry->nb_nodes++]=node_id;
+                    }
                 }
+                k=p+1;
             }
-            filepath[j]=0;
-            current_file_entry->filename=(char*)malloc(j-k+1);
-            memcpy(current_file_entry->filename,(const char*)&(filepath[k]),j-k);
-            
-//            printf("%d - %s\n",line,current_file_entry->file_size/1024,current_file_entry->filename);
-            
-            files_array_count++;
-            printf("files: %d * nodes: %d\n",files_array_count,nodes_array_count);
+            p++;
         }
-        printf("files: %d * nodes: %d\n",files_array_count,nodes_array_count);
+        current_file_entry->filename.str=k;
+        current_file_entry->filename.len=(int)(line_end-k);
+
+        files_array_count++;
+        p=eol+1;
     }
-    fclose(f);
-    
+
+    //final sort, then remap ids stored in file entries
+    int *formats_remap=nodeSetSort(&formats_set);
+    int *nodes_remap=nodeSetSort(&nodes_set);
+    if ((!formats_remap)||(!nodes_remap)) {
+        free(formats_remap);
+        free(nodes_remap);
+        parseModlandFree();
+        return -2;
+    }
+    for (int i=0;i<files_array_count;i++) {
+        file_entry_t *e=&(files_array[i]);
+        if (e->format_id>=0) e->format_id=formats_remap[e->format_id];
+        for (int j=0;j<e->nb_nodes;j++) e->node_id[j]=nodes_remap[e->node_id[j]];
+    }
+    free(formats_remap);
+    free(nodes_remap);
+
+    printf("files: %d * formats: %d * nodes: %d\n",files_array_count,formats_set.count,nodes_set.count);
     return 0;
 }
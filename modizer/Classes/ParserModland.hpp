@@ -11,6 +11,9 @@
 
 #include <stdio.h>
 
+//Development helper parsing modland's allmods.txt listing. The app does not call it (the call in
+//AppDelegate_Phone is commented out) : the MODLAND catalog ships prebuilt in the bundled database.
 int parseModland(const char *filepath);
+void parseModlandFree();
 
 #endif /* ParserModland_hpp */
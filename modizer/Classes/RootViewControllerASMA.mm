@@ -24,7 +24,6 @@ extern BOOL is_ios7;
 #include "unzip.h"
 
 #include <pthread.h>
-extern pthread_mutex_t db_mutex;
 //static int shouldFillKeys;
 static int local_flag;
 static volatile int mPopupAnimation=0;
@@ -391,7 +390,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
         }
         return;
     }
-    pthread_mutex_lock(&db_mutex);
     if (dbASMA_nb_entries) {
         for (int i=0;i<dbASMA_nb_entries;i++) {
             if (dbASMA_entries_data[i].label) [dbASMA_entries_data[i].label release];
@@ -404,15 +402,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
         free(dbASMA_entries_data);dbASMA_entries_data=NULL;
         dbASMA_nb_entries=0;
     }
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         //1st : count how many entries we'll have
         if (mSearch) sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir1) FROM asma_file WHERE dir1 LIKE \"%%%s%%\"",[mSearchText UTF8String]);
         else sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir1) FROM asma_file");
@@ -466,8 +460,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
             } else NSLog(@"ErrSQL : %d",err);
         }
     };
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     
 }
 -(void) fillKeysWithASMADB_Dir2:(NSString*)dir1 {
@@ -515,7 +508,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
         }
         return;
     }
-    pthread_mutex_lock(&db_mutex);
     if (dbASMA_nb_entries) {
         for (int i=0;i<dbASMA_nb_entries;i++) {
             if (dbASMA_entries_data[i].label) [dbASMA_entries_data[i].label release];
@@ -529,15 +521,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
         dbASMA_nb_entries=0;
     }
     dbASMA_hasFiles=0;
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         //1st : count how many entries we'll have
         if (mSearch) sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir2) FROM asma_file WHERE dir1=\"%s\" AND dir2 is not null AND dir2 LIKE \"%%%s%%\"\
                              UNION SELECT COUNT(filename) FROM asma_file WHERE dir1=\"%s\" AND dir2 is null AND filename LIKE \"%%%s%%\"",[dir1 UTF8String],[mSearchText UTF8String],[dir1 UTF8String],[mSearchText UTF8String]);
@@ -609,8 +597,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
             
         }
     };
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithASMADB_Dir3:(NSString*)dir1 dir2:(NSString*)dir2 {
     NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -657,7 +644,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
         }
         return;
     }
-    pthread_mutex_lock(&db_mutex);
     if (dbASMA_nb_entries) {
         for (int i=0;i<dbASMA_nb_entries;i++) {
             if (dbASMA_entries_data[i].label) [dbASMA_entries_data[i].label release];
@@ -671,15 +657,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
         dbASMA_nb_entries=0;
     }
     dbASMA_hasFiles=0;
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         //1st : count how many entries we'll have
         if (mSearch) sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir3) FROM asma_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3 is not null AND dir3 LIKE \"%%%s%%\"\
                              UNION SELECT COUNT(filename) FROM asma_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3 is null AND filename LIKE \"%%%s%%\"",[dir1 UTF8String],[dir2 UTF8String],[mSearchText UTF8String],[dir1 UTF8String],[dir2 UTF8String],[mSearchText UTF8String]);
@@ -752,8 +734,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
             
         }
     };
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
 }
 
 -(void) fillKeysWithASMADB_AllDirs:(NSString*)dir1 dir2:(NSString*)dir2 dir3:(NSString*)dir3 {
@@ -801,7 +782,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
         }
         return;
     }
-    pthread_mutex_lock(&db_mutex);
     if (dbASMA_nb_entries) {
         for (int i=0;i<dbASMA_nb_entries;i++) {
             if (dbASMA_entries_data[i].label) [dbASMA_entries_data[i].label release];
@@ -815,15 +795,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
         dbASMA_nb_entries=0;
     }
     dbASMA_hasFiles=0;
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         //1st : count how many entries we'll have
         if (mSearch) sprintf(sqlStatement,"SELECT COUNT(filename) FROM asma_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3=\"%s\" AND filename LIKE \"%%%s%%\"",[dir1 UTF8String],[dir2 UTF8String],[dir3 UTF8String],[mSearchText UTF8String]);
         else sprintf(sqlStatement,"SELECT COUNT(filename) FROM asma_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3=\"%s\"",[dir1 UTF8String],[dir2 UTF8String],[dir3 UTF8String]);
@@ -888,26 +864,19 @@ extern volatile t_settings settings[MAX_SETTINGS];
             
         }
     };
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
 }
 
 -(NSString*) getCompletePath:(int)id_mod {
     NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
     sqlite3 *db;
     NSString *fullpath=nil;
-    
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         sprintf(sqlStatement,"select fullpath from mod_file where id=%d",id_mod);
         err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
         if (err==SQLITE_OK){
@@ -918,26 +887,19 @@ extern volatile t_settings settings[MAX_SETTINGS];
         } else NSLog(@"ErrSQL : %d",err);
     }
     
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     return fullpath;
 }
 -(NSString*) getCompleteLocalPath:(int)id_mod {
     NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
     sqlite3 *db;
     NSString *localpath=nil;
-    
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         sprintf(sqlStatement,"select localpath from mod_file where id=%d",id_mod);
         err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
         if (err==SQLITE_OK){
@@ -948,26 +910,19 @@ extern volatile t_settings settings[MAX_SETTINGS];
         } else NSLog(@"ErrSQL : %d",err);
     }
     
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     return localpath;
 }
 -(int) getFileSize:(NSString*)fileName {
     NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
     sqlite3 *db;
     int iFileSize;
-    
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         sprintf(sqlStatement,"select filesize from mod_file where filename=\"%s\"",[fileName UTF8String]);
         err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
         if (err==SQLITE_OK){
@@ -977,24 +932,18 @@ extern volatile t_settings settings[MAX_SETTINGS];
             sqlite3_finalize(stmt);
         } else NSLog(@"ErrSQL : %d",err);
     };
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     return iFileSize;
 }
 -(NSString *) getModFilename:(int)idmod {
     NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
     sqlite3 *db;
     NSString *fileName;
-    pthread_mutex_lock(&db_mutex);
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         sprintf(sqlStatement,"select filename from mod_file where id=%d",idmod);
         err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
         if (err==SQLITE_OK){
@@ -1004,8 +953,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
             sqlite3_finalize(stmt);
         } else NSLog(@"ErrSQL : %d",err);
     };
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     return fileName;
 }
 
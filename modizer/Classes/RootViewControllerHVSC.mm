@@ -25,7 +25,6 @@ extern BOOL is_ios7;
 #include "unzip.h"
 
 #include <pthread.h>
-extern pthread_mutex_t db_mutex;
 //static int shouldFillKeys;
 static int local_flag;
 static volatile int mPopupAnimation=0;
@@ -397,7 +396,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (dbHVSC_nb_entries) {
 		for (int i=0;i<dbHVSC_nb_entries;i++) {
 			if (dbHVSC_entries_data[i].label) [dbHVSC_entries_data[i].label release];
@@ -412,15 +410,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		free(dbHVSC_entries_data);dbHVSC_entries_data=NULL;
 		dbHVSC_nb_entries=0;
 	}
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir1) FROM hvsc_file WHERE dir1 LIKE \"%%%s%%\"",[mSearchText UTF8String]);
 		else sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir1) FROM hvsc_file");
@@ -474,8 +468,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			} else NSLog(@"ErrSQL : %d",err);
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	
 }
 -(void) fillKeysWithHVSCDB_Dir2:(NSString*)dir1 {
@@ -525,7 +518,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (dbHVSC_nb_entries) {
 		for (int i=0;i<dbHVSC_nb_entries;i++) {
 			if (dbHVSC_entries_data[i].label) [dbHVSC_entries_data[i].label release];
@@ -540,15 +532,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		free(dbHVSC_entries_data);dbHVSC_entries_data=NULL;
 		dbHVSC_nb_entries=0;
 	}
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir2) FROM hvsc_file WHERE dir1=\"%s\" AND dir2 LIKE \"%%%s%%\"",[dir1 UTF8String],[mSearchText UTF8String]);
 		else sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir2) FROM hvsc_file WHERE dir1=\"%s\"",[dir1 UTF8String]);
@@ -602,8 +590,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			} else NSLog(@"ErrSQL : %d",err);
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithHVSCDB_Dir3:(NSString*)dir1 dir2:(NSString*)dir2 {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -652,7 +639,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (dbHVSC_nb_entries) {
 		for (int i=0;i<dbHVSC_nb_entries;i++) {
 			if (dbHVSC_entries_data[i].label) [dbHVSC_entries_data[i].label release];
@@ -668,15 +654,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		dbHVSC_nb_entries=0;
 	}
 	dbHVSC_hasFiles=0;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir3) FROM hvsc_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3 is not null AND dir3 LIKE \"%%%s%%\"\
 							 UNION SELECT COUNT(filename) FROM hvsc_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3 is null AND filename LIKE \"%%%s%%\"",[dir1 UTF8String],[dir2 UTF8String],[mSearchText UTF8String],[dir1 UTF8String],[dir2 UTF8String],[mSearchText UTF8String]);
@@ -749,8 +731,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithHVSCDB_Dir4:(NSString*)dir1 dir2:(NSString*)dir2 dir3:(NSString*)dir3 {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -800,7 +781,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (dbHVSC_nb_entries) {
 		for (int i=0;i<dbHVSC_nb_entries;i++) {
 			if (dbHVSC_entries_data[i].label) [dbHVSC_entries_data[i].label release];
@@ -816,15 +796,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		dbHVSC_nb_entries=0;
 	}
 	dbHVSC_hasFiles=0;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir4) FROM hvsc_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3=\"%s\" AND dir4 is not null AND dir4 LIKE \"%%%s%%\"\
 							 UNION SELECT COUNT(filename) FROM hvsc_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3=\"%s\" AND dir4 is null AND filename LIKE \"%%%s%%\"",[dir1 UTF8String],[dir2 UTF8String],[dir3 UTF8String],[mSearchText UTF8String],[dir1 UTF8String],[dir2 UTF8String],[dir3 UTF8String],[mSearchText UTF8String]);
@@ -897,8 +873,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithHVSCDB_Dir5:(NSString*)dir1 dir2:(NSString*)dir2 dir3:(NSString*)dir3 dir4:(NSString*)dir4 {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -948,7 +923,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (dbHVSC_nb_entries) {
 		for (int i=0;i<dbHVSC_nb_entries;i++) {
 			if (dbHVSC_entries_data[i].label) [dbHVSC_entries_data[i].label release];
@@ -964,15 +938,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		dbHVSC_nb_entries=0;
 	}
 	dbHVSC_hasFiles=0;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT COUNT(DISTINCT dir5) FROM hvsc_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3=\"%s\" AND dir4=\"%s\" AND dir5 is not null AND dir5 LIKE \"%%%s%%\"\
 							 UNION SELECT COUNT(filename) FROM hvsc_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3=\"%s\" AND dir4=\"%s\" AND dir5 is null AND filename LIKE \"%%%s%%\"",[dir1 UTF8String],[dir2 UTF8String],[dir3 UTF8String],[dir4 UTF8String],[mSearchText UTF8String],[dir1 UTF8String],[dir2 UTF8String],[dir3 UTF8String],[dir4 UTF8String],[mSearchText UTF8String]);
@@ -1046,8 +1016,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithHVSCDB_AllDirs:(NSString*)dir1 dir2:(NSString*)dir2 dir3:(NSString*)dir3 dir4:(NSString*)dir4 dir5:(NSString*)dir5 {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -1096,7 +1065,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (dbHVSC_nb_entries) {
 		for (int i=0;i<dbHVSC_nb_entries;i++) {
 			if (dbHVSC_entries_data[i].label) [dbHVSC_entries_data[i].label release];
@@ -1112,15 +1080,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		dbHVSC_nb_entries=0;
 	}
 	dbHVSC_hasFiles=0;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT COUNT(filename) FROM hvsc_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3=\"%s\" AND dir4=\"%s\" AND dir5=\"%s\" AND filename LIKE \"%%%s%%\"",[dir1 UTF8String],[dir2 UTF8String],[dir3 UTF8String],[dir4 UTF8String],[dir5 UTF8String],[mSearchText UTF8String]);
 		else sprintf(sqlStatement,"SELECT COUNT(filename) FROM hvsc_file WHERE dir1=\"%s\" AND dir2=\"%s\" AND dir3=\"%s\" AND dir4=\"%s\" AND dir5=\"%s\"",[dir1 UTF8String],[dir2 UTF8String],[dir3 UTF8String],[dir4 UTF8String],[dir5 UTF8String]);
@@ -1187,26 +1151,19 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 
 -(NSString*) getCompletePath:(int)id_mod {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
 	NSString *fullpath=nil;
-	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-		
 		sprintf(sqlStatement,"select fullpath from mod_file where id=%d",id_mod);
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
 		if (err==SQLITE_OK){
@@ -1217,26 +1174,19 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		} else NSLog(@"ErrSQL : %d",err);		
 	}
 	
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return fullpath;
 }
 -(NSString*) getCompleteLocalPath:(int)id_mod {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
 	NSString *localpath=nil;
-	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		
 		sprintf(sqlStatement,"select localpath from mod_file where id=%d",id_mod);
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
@@ -1248,26 +1198,19 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		} else NSLog(@"ErrSQL : %d",err);		
 	}
 	
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return localpath;
 }
 -(int) getFileSize:(NSString*)fileName {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
 	int iFileSize;
-	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;		
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"select filesize from mod_file where filename=\"%s\"",[fileName UTF8String]);
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
 		if (err==SQLITE_OK){
@@ -1277,24 +1220,18 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			sqlite3_finalize(stmt);
 		} else NSLog(@"ErrSQL : %d",err);
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return iFileSize;
 }
 -(NSString *) getModFilename:(int)idmod {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
 	NSString *fileName;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;		
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"select filename from mod_file where id=%d",idmod);
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
 		if (err==SQLITE_OK){
@@ -1304,8 +1241,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			sqlite3_finalize(stmt);
 		} else NSLog(@"ErrSQL : %d",err);
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return fileName;
 }
 
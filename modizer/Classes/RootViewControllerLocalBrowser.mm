@@ -24,7 +24,6 @@ NSString *cutpaste_filesrcpath=nil;
 #include "unzip.h"
 
 #include <pthread.h>
-extern pthread_mutex_t db_mutex;
 pthread_mutex_t db_mutexHVSCSTIL;
 //static int shouldFillKeys;
 static int local_flag;
@@ -35,6 +34,7 @@ static volatile int mPopupAnimation=0;
 #import "DetailViewControllerIphone.h"
 #import "QuartzCore/CAAnimation.h"
 #import "SettingsGenViewController.h"
+#include "SongLengthScanner.h"
 extern volatile t_settings settings[MAX_SETTINGS];
 
 @implementation RootViewControllerLocalBrowser
@@ -83,20 +83,15 @@ static char **browser_sidtune_title,**browser_sidtune_name;
 -(void) getDBVersion:(int*)major minor:(int*)minor {
     NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
     sqlite3 *db;
-    pthread_mutex_lock(&db_mutex);
     
     *major=0;
     *minor=0;
     
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         sprintf(sqlStatement,"SELECT major,minor FROM version");
         
         err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
@@ -107,10 +102,9 @@ static char **browser_sidtune_title,**browser_sidtune_name;
             }
             sqlite3_finalize(stmt);
         } else NSLog(@"ErrSQL : %d",err);
-        sqlite3_close(db);
+        DBHelper::unlockDB(db);
     }
     
-    pthread_mutex_unlock(&db_mutex);
 }
 
 void mymkdir(char *filePath);
@@ -125,7 +119,7 @@ int do_extract(unzFile uf,char *pathToExtract,NSString *pathBase);
     NSError *error;
     NSFileManager *fileManager=[[NSFileManager alloc] init];
     
-    pthread_mutex_lock(&db_mutex);
+    DBHelper::suspendDB(pathToDB);
     
     if (mUpdateToNewDB) {
         [fileManager moveItemAtPath:pathToDB toPath:pathToOldDB error:&error];
@@ -139,7 +133,7 @@ int do_extract(unzFile uf,char *pathToExtract,NSString *pathBase);
     if (mUpdateToNewDB) {
         sqlite3 *db,*dbold;
         
-        if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+        if ((db=DBHelper::lockDB(pathToDB))){
             if (sqlite3_open([pathToOldDB UTF8String], &dbold) == SQLITE_OK){
                 char sqlStatementR[1024];
                 char sqlStatementR2[1024];
@@ -147,10 +141,6 @@ int do_extract(unzFile uf,char *pathToExtract,NSString *pathBase);
                 sqlite3_stmt *stmt,*stmt2;
                 int err;
                 
-                err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-                if (err==SQLITE_OK){
-                } else NSLog(@"ErrSQL : %d",err);
-                
                 //Migrate DB user data : song length, ratings, playlists, ...
                 sprintf(sqlStatementR,"SELECT name,fullpath,play_count,rating FROM user_stats");
                 err=sqlite3_prepare_v2(dbold, sqlStatementR, -1, &stmt, NULL);
@@ -226,14 +216,14 @@ int do_extract(unzFile uf,char *pathToExtract,NSString *pathBase);
                 //remove old DB
                 [fileManager removeItemAtPath:pathToOldDB error:&error];
             }
-            sqlite3_close(db);
+            DBHelper::unlockDB(db);
         };
     }
     
     /*	rar_main(argc,argv);
      free(argv_buffer);
      free(argv);*/
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::resumeDB(pathToDB);
     //	[self recreateDBIndexes];
     
     //[unrarPath release];
@@ -316,7 +306,10 @@ int do_extract(unzFile uf,char *pathToExtract,NSString *pathBase);
     // The writable database does not exist, so copy the default to the appropriate location.
     
     if (forceInit||(success&&(!wrongversion))) {//remove existing file
+        NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
+        DBHelper::suspendDB(pathToDB);
         success = [fileManager removeItemAtPath:writableDBPath error:&error];
+        DBHelper::resumeDB(pathToDB);
     }
     [fileManager release];
     
@@ -657,16 +650,12 @@ int do_extract(unzFile uf,char *pathToExtract,NSString *pathBase);
     strcpy(browser_stil_info,"");
     pthread_mutex_lock(&db_mutexHVSCSTIL);
     
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         char tmppath[256];
         sqlite3_stmt *stmt;
         char *realPath=strstr(fullPath,"/HVSC");
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
         if (!realPath) {
             //try to find realPath with md5
             sprintf(sqlStatement,"SELECT filepath FROM hvsc_path WHERE id_md5=\"%s\"",browser_song_md5);
@@ -695,7 +684,7 @@ int do_extract(unzFile uf,char *pathToExtract,NSString *pathBase);
             } else NSLog(@"ErrSQL : %d",err);
         }
     };
-    sqlite3_close(db);
+    DBHelper::unlockDB(db);
     
     pthread_mutex_unlock(&db_mutexHVSCSTIL);
 }
@@ -934,12 +923,7 @@ static void md5_from_buffer(char *dest, size_t destlen,char * buf, size_t bufsiz
         return;
     }
     
-    pthread_mutex_lock(&db_mutex);
-    if (sqlite3_open([pathToDB UTF8String], &db) != SQLITE_OK) db=NULL;
-    
-    err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-    if (err==SQLITE_OK){
-    } else NSLog(@"ErrSQL : %d",err);
+    db=DBHelper::lockDB(pathToDB);
     
     [filetype_ext addObjectsFromArray:filetype_extMDX];
     [filetype_ext addObjectsFromArray:filetype_extPMD];
@@ -1837,8 +1821,7 @@ static void md5_from_buffer(char *dest, size_t destlen,char * buf, size_t bufsiz
     }
     
     if (db) {
-        sqlite3_close(db);
-        pthread_mutex_unlock(&db_mutex);
+        DBHelper::unlockDB(db);
     }
     
     
@@ -2529,14 +2512,13 @@ static void md5_from_buffer(char *dest, size_t destlen,char * buf, size_t bufsiz
             
             
             if (cur_local_entries[section][indexPath.row].rating==-1) {
-                DBHelper::getFileStatsDBmod(
-                                            cur_local_entries[section][indexPath.row].label,
-                                            cur_local_entries[section][indexPath.row].fullpath,
-                                            &cur_local_entries[section][indexPath.row].playcount,
-                                            &cur_local_entries[section][indexPath.row].rating,
-                                            &cur_local_entries[section][indexPath.row].song_length,
-                                            &cur_local_entries[section][indexPath.row].channels_nb,
-                                            &cur_local_entries[section][indexPath.row].songs);
+                //fetch all missing stats of the directory at once
+                if (search_local) DBHelper::getFilesStatsDBmod(search_local_entries_data,search_local_nb_entries);
+                else {
+                    DBHelper::getFilesStatsDBmod(local_entries_data,local_nb_entries);
+                    //files never played : get their length in the background
+                    SongLengthScanner::queueFiles(local_entries_data,local_nb_entries);
+                }
             }
             if (cur_local_entries[section][indexPath.row].rating>=0) bottomImageView.image=[UIImage imageNamed:ratingImg[cur_local_entries[section][indexPath.row].rating]];
             
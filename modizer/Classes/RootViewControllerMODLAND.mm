@@ -19,7 +19,6 @@ extern BOOL is_ios7;
 #include <sys/sysctl.h>
 
 #include <pthread.h>
-extern pthread_mutex_t db_mutex;
 //static int shouldFillKeys;
 static int local_flag;
 static volatile int mPopupAnimation=0;
@@ -398,7 +397,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		return;
 	}
 	
-	pthread_mutex_lock(&db_mutex);
 	
 	if (db_nb_entries) {
 		for (int i=0;i<db_nb_entries;i++) {
@@ -407,15 +405,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		free(db_entries_data);db_entries_data=NULL;
 		db_nb_entries=0;
 	}
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have
 		if (mSearch) sprintf(sqlStatement,"SELECT count(1) FROM mod_type t,mod_type_author ta\
 							 WHERE ta.id_author=%d AND ta.id_type=t.id AND t.filetype like \"%%%s%%\"",authorID,[mSearchText UTF8String]);
@@ -471,8 +465,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			} else NSLog(@"ErrSQL : %d",err);
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithDB_fileType{
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -513,7 +506,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (db_nb_entries) {
 		for (int i=0;i<db_nb_entries;i++) {
 			[db_entries_data[i].label release];
@@ -521,15 +513,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		free(db_entries_data);db_entries_data=NULL;
 		db_nb_entries=0;
 	}
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT COUNT(1) FROM mod_type WHERE filetype LIKE \"%%%s%%\"",[mSearchText UTF8String]);
 		else  sprintf(sqlStatement,"SELECT COUNT(1) FROM mod_type");
@@ -583,8 +571,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			} else NSLog(@"ErrSQL : %d",err);
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithDB_fileAuthor{
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -624,7 +611,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (db_nb_entries) {
 		for (int i=0;i<db_nb_entries;i++) {
 			[db_entries_data[i].label release];
@@ -632,15 +618,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		free(db_entries_data);db_entries_data=NULL;
 		db_nb_entries=0;
 	}
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT count(1) FROM mod_author WHERE author LIKE \"%%%s%%\"",[mSearchText UTF8String]);
 		else sprintf(sqlStatement,"SELECT count(1) FROM mod_author");
@@ -698,8 +680,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			} else NSLog(@"ErrSQL : %d",err);
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithDB_fileAuthor:(int)filetypeID{
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -742,7 +723,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (db_nb_entries) {
 		for (int i=0;i<db_nb_entries;i++) {
 			[db_entries_data[i].label release];
@@ -750,15 +730,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		free(db_entries_data);db_entries_data=NULL;
 		db_nb_entries=0;
 	}
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT COUNT(1) FROM mod_author a,mod_type_author m WHERE m.id_type=%d AND m.id_author=a.id AND a.author LIKE \"%%%s%%\"",filetypeID,[mSearchText UTF8String]);
 		else sprintf(sqlStatement,"SELECT COUNT(1) FROM mod_type_author m WHERE m.id_type=%d",filetypeID);
@@ -815,8 +791,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			} else NSLog(@"ErrSQL : %d",err);
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);		
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithDB_albumORfilename:(int)authorID {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -862,7 +837,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (db_nb_entries) {
 		for (int i=0;i<db_nb_entries;i++) {
 			[db_entries_data[i].label release];
@@ -870,15 +844,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		free(db_entries_data);db_entries_data=NULL;
 		db_nb_entries=0;
 	}
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT count(1),0 FROM mod_file WHERE id_author=%d AND id_album is null AND filename like \"%%%s%%\" \
 							 UNION SELECT count(1),1 FROM mod_author_album m,mod_album a WHERE m.id_author=%d AND m.id_album=a.id AND a.album like \"%%%s%%\"  AND m.id_author=a.id_author",authorID,[mSearchText UTF8String],authorID,[mSearchText UTF8String]);
@@ -956,8 +926,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithDB_albumORfilename:(int)filetypeID fileAuthorID:(int)authorID {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -1001,7 +970,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (db_nb_entries) {
 		for (int i=0;i<db_nb_entries;i++) {
 			[db_entries_data[i].label release];
@@ -1009,15 +977,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		free(db_entries_data);db_entries_data=NULL;
 		db_nb_entries=0;
 	}
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT count(1),0 FROM mod_file \
 							 WHERE id_author=%d AND id_type=%d id_album is null AND filename like \"%%%s%%\" \
@@ -1102,8 +1066,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			} else NSLog(@"ErrSQL : %d",err);
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithDB_filename:(int)authorID fileAlbumID:(int)albumID {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -1148,7 +1111,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (db_nb_entries) {
 		for (int i=0;i<db_nb_entries;i++) {
 			[db_entries_data[i].label release];
@@ -1156,15 +1118,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		free(db_entries_data);db_entries_data=NULL;
 		db_nb_entries=0;
 	}
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT count(1) FROM mod_file WHERE id_author=%d AND id_album=%d AND filename LIKE \"%%%s%%\" ORDER BY filename",authorID,albumID,[mSearchText UTF8String]);
 		else sprintf(sqlStatement,"SELECT count(1) FROM mod_file WHERE id_author=%d AND id_album=%d ORDER BY filename",authorID,albumID);
@@ -1220,8 +1178,7 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			} else NSLog(@"ErrSQL : %d",err);
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) fillKeysWithDB_filename:(int)filetypeID fileAuthorID:(int)authorID fileAlbumID:(int)albumID {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
@@ -1266,7 +1223,6 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		}
 		return;
 	}
-	pthread_mutex_lock(&db_mutex);
 	if (db_nb_entries) {
 		for (int i=0;i<db_nb_entries;i++) {
 			[db_entries_data[i].label release];
@@ -1274,15 +1230,11 @@ extern volatile t_settings settings[MAX_SETTINGS];
 		free(db_entries_data);db_entries_data=NULL;
 		db_nb_entries=0;
 	}
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//1st : count how many entries we'll have		
 		if (mSearch) sprintf(sqlStatement,"SELECT count(1) FROM mod_file WHERE id_type=%d AND id_author=%d AND id_album=%d AND filename like \"%%%s%%\"",filetypeID,authorID,albumID,[mSearchText UTF8String]);
 		else sprintf(sqlStatement,"SELECT count(1) FROM mod_file WHERE id_type=%d AND id_author=%d AND id_album=%d",filetypeID,authorID,albumID);
@@ -1344,10 +1296,8 @@ extern volatile t_settings settings[MAX_SETTINGS];
 			
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
-	
-	
+	DBHelper::unlockDB(db);
+
 	
 }
 
@@ -1355,118 +1305,79 @@ extern volatile t_settings settings[MAX_SETTINGS];
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
 	NSString *fullpath=nil;
-	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
+
+	if ((db=DBHelper::lockDB(pathToDB))){
 		sqlite3_stmt *stmt;
-		int err;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
         
 		
-		sprintf(sqlStatement,"select fullpath from mod_file where id=%d",id_mod);
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
+		stmt=DBHelper::getStatement(db,"select fullpath from mod_file where id=?");
+		if (stmt){
+			sqlite3_bind_int(stmt, 1, id_mod);
 			while (sqlite3_step(stmt) == SQLITE_ROW) {
 				fullpath=[NSString stringWithUTF8String:(const char*)sqlite3_column_text(stmt, 0)];
 			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);		
+		}
 	}
 	
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return fullpath;
 }
 -(NSString*) getCompleteLocalPath:(int)id_mod {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
 	NSString *localpath=nil;
-	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
+
+	if ((db=DBHelper::lockDB(pathToDB))){
 		sqlite3_stmt *stmt;
-		int err;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
         
 		
-		sprintf(sqlStatement,"select localpath from mod_file where id=%d",id_mod);
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
+		stmt=DBHelper::getStatement(db,"select localpath from mod_file where id=?");
+		if (stmt){
+			sqlite3_bind_int(stmt, 1, id_mod);
 			while (sqlite3_step(stmt) == SQLITE_ROW) {
 				localpath=[NSString  stringWithUTF8String:(const char*)sqlite3_column_text(stmt, 0)];
 			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);		
+		}
 	}
 	
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return localpath;
 }
 -(int) getFileSize:(NSString*)fileName {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
 	int iFileSize;
-	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
+
+	if ((db=DBHelper::lockDB(pathToDB))){
 		sqlite3_stmt *stmt;
-		int err;		
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
-		sprintf(sqlStatement,"select filesize from mod_file where filename=\"%s\"",[fileName UTF8String]);
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
+		stmt=DBHelper::getStatement(db,"select filesize from mod_file where filename=?");
+		if (stmt){
+			sqlite3_bind_text(stmt, 1, [fileName UTF8String], -1, SQLITE_TRANSIENT);
 			while (sqlite3_step(stmt) == SQLITE_ROW) {
 				iFileSize=(int)sqlite3_column_int(stmt, 0);
 			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);
+		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return iFileSize;
 }
 -(NSString *) getModFilename:(int)idmod {
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
 	NSString *fileName;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-		char sqlStatement[1024];
+	if ((db=DBHelper::lockDB(pathToDB))){
 		sqlite3_stmt *stmt;
-		int err;		
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
-		sprintf(sqlStatement,"select filename from mod_file where id=%d",idmod);
-		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-		if (err==SQLITE_OK){
+		stmt=DBHelper::getStatement(db,"select filename from mod_file where id=?");
+		if (stmt){
+			sqlite3_bind_int(stmt, 1, idmod);
 			while (sqlite3_step(stmt) == SQLITE_ROW) {
 				fileName=[[NSString alloc] initWithUTF8String:(const char*)sqlite3_column_text(stmt, 0)];
 			}
-			sqlite3_finalize(stmt);
-		} else NSLog(@"ErrSQL : %d",err);
+		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return fileName;
 }
 
@@ -1579,29 +1490,20 @@ extern volatile t_settings settings[MAX_SETTINGS];
     NSString *documentsDirectory = [paths objectAtIndex:0];
     NSString *checkPath,*strFullPath;
     
-    pthread_mutex_lock(&db_mutex);
     strFullPath=nil;
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-        char sqlStatement[1024];
+    if ((db=DBHelper::lockDB(pathToDB))){
         sqlite3_stmt *stmt;
-        int err;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
         
-        sprintf(sqlStatement,"SELECT localpath FROM mod_file WHERE id=%d",id_mod);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        stmt=DBHelper::getStatement(db,"SELECT localpath FROM mod_file WHERE id=?");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_mod);
             
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strFullPath=[NSString stringWithUTF8String:(const char*)sqlite3_column_text(stmt, 0)];
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
+        }
     }
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     
     if (strFullPath) {
         checkPath = [documentsDirectory stringByAppendingPathComponent: [NSString stringWithFormat:@"%@/%@",MODLAND_BASEDIR,strFullPath]];
@@ -1618,30 +1520,20 @@ extern volatile t_settings settings[MAX_SETTINGS];
     NSArray *paths = NSSearchPathForDirectoriesInDomains(NSDocumentDirectory, NSUserDomainMask, YES);
     NSString *documentsDirectory = [paths objectAtIndex:0];
     NSString *checkPath,*strAuthor;
-    
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-        char sqlStatement[1024];
+
+    if ((db=DBHelper::lockDB(pathToDB))){
         sqlite3_stmt *stmt;
-        int err;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
         
-        sprintf(sqlStatement,"SELECT author FROM mod_author WHERE id=%d",id_author);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        stmt=DBHelper::getStatement(db,"SELECT author FROM mod_author WHERE id=?");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_author);
             
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strAuthor=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
+        }
     }
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     
     checkPath = [documentsDirectory stringByAppendingPathComponent: [NSString stringWithFormat:@"%@/%@",MODLAND_BASEDIR,strAuthor]];
     success = [fileManager fileExistsAtPath:checkPath];
@@ -1656,39 +1548,28 @@ extern volatile t_settings settings[MAX_SETTINGS];
     NSArray *paths = NSSearchPathForDirectoriesInDomains(NSDocumentDirectory, NSUserDomainMask, YES);
     NSString *documentsDirectory = [paths objectAtIndex:0];
     NSString *checkPath,*strType,*strAuthor;
-    
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-        char sqlStatement[1024];
+
+    if ((db=DBHelper::lockDB(pathToDB))){
         sqlite3_stmt *stmt;
-        int err;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
         
-        sprintf(sqlStatement,"SELECT author FROM mod_author WHERE id=%d",id_author);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        stmt=DBHelper::getStatement(db,"SELECT author FROM mod_author WHERE id=?");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_author);
             
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strAuthor=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
-        sprintf(sqlStatement,"SELECT filetype FROM mod_type WHERE id=%d",id_type);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        }
+        stmt=DBHelper::getStatement(db,"SELECT filetype FROM mod_type WHERE id=?");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_type);
             
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strType=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
+        }
     }
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     
     checkPath = [documentsDirectory stringByAppendingPathComponent: [NSString stringWithFormat:@"%@/%@/%@",MODLAND_BASEDIR,strAuthor,strType]];
     success = [fileManager fileExistsAtPath:checkPath];
@@ -1703,48 +1584,36 @@ extern volatile t_settings settings[MAX_SETTINGS];
     NSArray *paths = NSSearchPathForDirectoriesInDomains(NSDocumentDirectory, NSUserDomainMask, YES);
     NSString *documentsDirectory = [paths objectAtIndex:0];
     NSString *checkPath,*strType,*strAuthor,*strAlbum;
-    
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-        char sqlStatement[1024];
+
+    if ((db=DBHelper::lockDB(pathToDB))){
         sqlite3_stmt *stmt;
-        int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
-        sprintf(sqlStatement,"SELECT author FROM mod_author WHERE id=%d",id_author);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        stmt=DBHelper::getStatement(db,"SELECT author FROM mod_author WHERE id=?");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_author);
             
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strAuthor=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
-        sprintf(sqlStatement,"SELECT filetype FROM mod_type WHERE id=%d",id_type);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        }
+        stmt=DBHelper::getStatement(db,"SELECT filetype FROM mod_type WHERE id=?");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_type);
             
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strType=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
-        sprintf(sqlStatement,"SELECT album FROM mod_album WHERE id=%d",id_album);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        }
+        stmt=DBHelper::getStatement(db,"SELECT album FROM mod_album WHERE id=?");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_album);
             
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strAlbum=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
+        }
     }
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     
     checkPath = [documentsDirectory stringByAppendingPathComponent: [NSString stringWithFormat:@"%@/%@/%@/%@",MODLAND_BASEDIR,strAuthor,strType,strAlbum]];
     success = [fileManager fileExistsAtPath:checkPath];
@@ -1759,43 +1628,32 @@ extern volatile t_settings settings[MAX_SETTINGS];
     NSArray *paths = NSSearchPathForDirectoriesInDomains(NSDocumentDirectory, NSUserDomainMask, YES);
     NSString *documentsDirectory = [paths objectAtIndex:0];
     NSString *checkPath,*strType,*strAuthor;
-    
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-        char sqlStatement[1024];
+
+    if ((db=DBHelper::lockDB(pathToDB))){
         sqlite3_stmt *stmt;
-        int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
-        sprintf(sqlStatement,"SELECT filetype FROM mod_type WHERE id=%d",id_type);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        stmt=DBHelper::getStatement(db,"SELECT filetype FROM mod_type WHERE id=?");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_type);
             
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strType=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
+        }
         
-        sprintf(sqlStatement,"SELECT a.author FROM mod_type_author m,mod_author a WHERE m.id_type=%d AND m.id_author=a.id",id_type);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        stmt=DBHelper::getStatement(db,"SELECT a.author FROM mod_type_author m,mod_author a WHERE m.id_type=? AND m.id_author=a.id");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_type);
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strAuthor=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
                 checkPath = [documentsDirectory stringByAppendingPathComponent: [NSString stringWithFormat:@"%@/%@/%@",MODLAND_BASEDIR,strAuthor,strType]];
                 success = [fileManager fileExistsAtPath:checkPath];
                 if (success) break;
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
+        }
         
     }
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     
     if (success) return 1;
     return 0;
@@ -1808,51 +1666,40 @@ extern volatile t_settings settings[MAX_SETTINGS];
     NSArray *paths = NSSearchPathForDirectoriesInDomains(NSDocumentDirectory, NSUserDomainMask, YES);
     NSString *documentsDirectory = [paths objectAtIndex:0];
     NSString *checkPath,*strType,*strAuthor,*strAlbum;
-    
-    pthread_mutex_lock(&db_mutex);
-    
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
-        char sqlStatement[1024];
+
+    if ((db=DBHelper::lockDB(pathToDB))){
         sqlite3_stmt *stmt;
-        int err;
-        
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
         
-        sprintf(sqlStatement,"SELECT filetype FROM mod_type WHERE id=%d",id_type);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        stmt=DBHelper::getStatement(db,"SELECT filetype FROM mod_type WHERE id=?");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_type);
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strType=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
-        sprintf(sqlStatement,"SELECT album FROM mod_album WHERE id=%d",id_album);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        }
+        stmt=DBHelper::getStatement(db,"SELECT album FROM mod_album WHERE id=?");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_album);
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strAlbum=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
+        }
         
         
-        sprintf(sqlStatement,"SELECT a.author FROM mod_type_author_album m,mod_author a WHERE m.id_type=%d AND m.id_album=%d m.id_author=a.id",id_type,id_album);
-        err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
-        if (err==SQLITE_OK){
+        stmt=DBHelper::getStatement(db,"SELECT a.author FROM mod_type_author_album m,mod_author a WHERE m.id_type=? AND m.id_album=? m.id_author=a.id");
+        if (stmt){
+            sqlite3_bind_int(stmt, 1, id_type);
+            sqlite3_bind_int(stmt, 2, id_album);
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 strAuthor=[NSString stringWithFormat:@"%s",(char*)sqlite3_column_text(stmt, 0)];
                 checkPath = [documentsDirectory stringByAppendingPathComponent: [NSString stringWithFormat:@"%@/%@/%@/%@",MODLAND_BASEDIR,strAuthor,strType,strAlbum]];
                 success = [fileManager fileExistsAtPath:checkPath];
                 if (success) break;
             }
-            sqlite3_finalize(stmt);
-        } else NSLog(@"ErrSQL : %d",err);
+        }
         
     }
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     
     if (success) return 1;
     return 0;
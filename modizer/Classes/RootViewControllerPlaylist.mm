@@ -27,7 +27,6 @@ extern BOOL is_ios7;
 #include "unzip.h"
 
 #include <pthread.h>
-extern pthread_mutex_t db_mutex;
 static 	int	mValidatePlName,newPlaylist;
 //static int shouldFillKeys;
 static int local_flag;
@@ -628,16 +627,11 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 -(void) loadPlayListsListFromDB:(NSMutableArray*)entries list_id:(NSMutableArray*)list_id entries_details:(NSMutableArray*)details {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		
 		sprintf(sqlStatement,"SELECT id,name,num_files FROM playlists ORDER BY name");
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
@@ -651,24 +645,18 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 			sqlite3_finalize(stmt);
 		} else NSLog(@"ErrSQL : %d",err);
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(void) loadPlayListsFromDB:(NSString *)_id_playlist intoPlaylist:(t_playlist *)_playlist  {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
 	
-	pthread_mutex_lock(&db_mutex);
 	_playlist->nb_entries=0;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		
 		//Get playlist name
 		sprintf(sqlStatement,"SELECT id,name,num_files FROM playlists WHERE id=%s",[_id_playlist UTF8String]);
@@ -681,7 +669,7 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 			sqlite3_finalize(stmt);
 		} else NSLog(@"ErrSQL : %d",err);
 		
-		sprintf(sqlStatement,"SELECT p.name,p.fullpath,s.rating,s.play_count FROM playlists_entries p \
+		sprintf(sqlStatement,"SELECT p.name,p.fullpath,s.rating,s.play_count,s.length,s.channels,s.songs FROM playlists_entries p \
 				LEFT OUTER JOIN user_stats s ON p.fullpath=s.fullpath \
 				WHERE id_playlist=%s",[_id_playlist UTF8String]);
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
@@ -694,28 +682,25 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 				if (tmpsc>5) tmpsc=5;
 				_playlist->entries[_playlist->nb_entries].ratings=tmpsc;
 				_playlist->entries[_playlist->nb_entries].playcounts=(short int)sqlite3_column_int(stmt, 3);
+				_playlist->entries[_playlist->nb_entries].song_length=(int)sqlite3_column_int(stmt, 4);
+				_playlist->entries[_playlist->nb_entries].channels_nb=(char)sqlite3_column_int(stmt, 5);
+				_playlist->entries[_playlist->nb_entries].songs=(int)sqlite3_column_int(stmt, 6);
 				_playlist->nb_entries++;
 				if (_playlist->nb_entries==MAX_PL_ENTRIES) break;
 			}
 			sqlite3_finalize(stmt);
 		} else NSLog(@"ErrSQL : %d",err);
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 -(NSString *) initNewPlaylistDB:(NSString *)listName {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
 	NSString *id_playlist;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		int err;
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"INSERT INTO playlists (name,num_files) SELECT \"%s\",0",[listName UTF8String]);
 		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
 		if (err==SQLITE_OK){
@@ -724,8 +709,7 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 		//Get id
 		id_playlist=[[NSString alloc] initWithFormat:@"%lld",sqlite3_last_insert_rowid(db) ];
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return id_playlist;
 }
 -(NSString *) getPlaylistNameDB:(NSString*)id_playlist {
@@ -733,15 +717,10 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 	NSString *listName;
 	sqlite3 *db;
 	int err;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-		
 		//Get playlist name
 		sprintf(sqlStatement,"SELECT name FROM playlists WHERE id=%s",[id_playlist UTF8String]);
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
@@ -753,8 +732,7 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 		} else NSLog(@"ErrSQL : %d",err);
 		
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return listName;
 }
 -(bool) addToPlaylistDB:(NSString*)id_playlist label:(NSString *)label fullPath:(NSString *)fullPath {
@@ -762,14 +740,9 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 	sqlite3 *db;
 	int err;
 	bool result;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"INSERT INTO playlists_entries (id_playlist,name,fullpath) SELECT %s,\"%s\",\"%s\"",
 				[id_playlist UTF8String],[label UTF8String],[fullPath UTF8String]);
 		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
@@ -793,8 +766,7 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 			}
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return result;
 }
 -(bool) addListToPlaylistDB {
@@ -802,14 +774,9 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 	sqlite3 *db;
 	int err;
 	bool result;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		for (int i=0;i<playlist->nb_entries;i++) {
 			sprintf(sqlStatement,"INSERT INTO playlists_entries (id_playlist,name,fullpath) SELECT %s,\"%s\",\"%s\"",
 					[playlist->playlist_id UTF8String],[playlist->entries[i].label UTF8String],[playlist->entries[i].fullpath UTF8String]);
@@ -836,8 +803,7 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 			}
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return result;
 }
 -(bool) addListToPlaylistDB:(NSString*)id_playlist entries:(t_plPlaylist_entry*)pl_entries nb_entries:(int)nb_entries  {
@@ -845,14 +811,9 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 	sqlite3 *db;
 	int err;
 	bool result;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		for (int i=0;i<nb_entries;i++) {
 			sprintf(sqlStatement,"INSERT INTO playlists_entries (id_playlist,name,fullpath) SELECT %s,\"%s\",\"%s\"",
 					[id_playlist UTF8String],[pl_entries[i].mPlaylistFilename UTF8String],[pl_entries[i].mPlaylistFilepath UTF8String]);
@@ -879,8 +840,7 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 			}
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return result;
 }
 -(bool) removeFromPlaylistDB:(NSString*)id_playlist fullPath:(NSString*)fullpath {
@@ -888,14 +848,9 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 	sqlite3 *db;
 	int err;
 	bool result;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-		
 		sprintf(sqlStatement,"DELETE FROM playlists_entries WHERE id_playlist=\"%s\" AND fullpath=\"%s\"",
 				[id_playlist UTF8String],[fullpath UTF8String]);
 		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
@@ -906,22 +861,16 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 			result=FALSE;
 		}
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return result;
 }
 -(bool) replacePlaylistDBwithCurrent {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
 	int err;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"DELETE FROM playlists_entries WHERE id_playlist=%s",
 				[playlist->playlist_id UTF8String]);
 		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
@@ -953,39 +902,31 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 		} else NSLog(@"ErrSQL : %d",err);
 		
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return TRUE;
 }
 -(void) updatePlaylistNameDB:(NSString*)id_playlist playlist_name:(NSString *)playlist_name {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
 	int err;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"UPDATE playlists SET name=\"%s\" WHERE id=%s",[playlist_name UTF8String],[id_playlist UTF8String]);
 		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
 		if (err==SQLITE_OK){
 		} else NSLog(@"ErrSQL : %d",err);
 		
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 
 -(int) deletePlaylistDB:(NSString*)id_playlist {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
 	int err,ret;
-	pthread_mutex_lock(&db_mutex);
 	ret=1;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		
 		sprintf(sqlStatement,"DELETE FROM playlists_entries WHERE id_playlist=%s",[id_playlist UTF8String]);
@@ -999,8 +940,7 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 		} else {ret=0;NSLog(@"ErrSQL : %d",err);}
 		
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return ret;
 }
 
@@ -1090,13 +1030,8 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 		return;
 	}
 	
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) != SQLITE_OK) db=NULL;
+	db=DBHelper::lockDB(pathToDB);
     
-    err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-    if (err==SQLITE_OK){
-    } else NSLog(@"ErrSQL : %d",err);
-	
 	[filetype_ext addObjectsFromArray:filetype_extMDX];
     [filetype_ext addObjectsFromArray:filetype_extPMD];
 	[filetype_ext addObjectsFromArray:filetype_extSID];
@@ -1881,8 +1816,7 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
     }
     
     if (db) {
-        sqlite3_close(db);
-        pthread_mutex_unlock(&db_mutex);
+        DBHelper::unlockDB(db);
     }
     
     
@@ -1892,16 +1826,11 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
 -(void) loadFavoritesList{
     NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
     sqlite3 *db;
-    pthread_mutex_lock(&db_mutex);
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
             sprintf(sqlStatement,"SELECT name,fullpath,rating,play_count,length,channels,songs FROM user_stats WHERE rating>0 ORDER BY rating DESC,name");
             err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
             if (err==SQLITE_OK){
@@ -1919,8 +1848,7 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
                 sqlite3_finalize(stmt);
             } else NSLog(@"ErrSQL : %d",err);
     }
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
 }
 
 -(void) loadMostPlayedList{
@@ -1928,16 +1856,11 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
     sqlite3 *db;
     playlist->nb_entries=0;
     
-    pthread_mutex_lock(&db_mutex);
-    if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+    if ((db=DBHelper::lockDB(pathToDB))){
         char sqlStatement[1024];
         sqlite3_stmt *stmt;
         int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
             sprintf(sqlStatement,"SELECT name,fullpath,rating,play_count,length,channels,songs FROM user_stats WHERE play_count>0 ORDER BY play_count DESC,name");
             err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
             if (err==SQLITE_OK){
@@ -1955,8 +1878,7 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
                 sqlite3_finalize(stmt);
             } else NSLog(@"ErrSQL : %d",err);
     }
-    sqlite3_close(db);
-    pthread_mutex_unlock(&db_mutex);
+    DBHelper::unlockDB(db);
     
 }
 
@@ -2302,15 +2224,11 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
                 cell.accessoryType = UITableViewCellAccessoryNone;
                                 
                 if ((playlist->entries[row-2].ratings==-1)||(playlist->entries[row-2].playcounts==-1)) {
-                    DBHelper::getFileStatsDBmod(playlist->entries[row-2].label,
-                                                playlist->entries[row-2].fullpath,
-                                                &(playlist->entries[row-2].playcounts),
-                                                &(playlist->entries[row-2].ratings),
-                                                &(playlist->entries[row-2].song_length),
-                                                &(playlist->entries[row-2].channels_nb),
-                                                &(playlist->entries[row-2].songs));
+                    //fetch all missing stats of the list at once
+                    playlist->entries[row-2].ratings=-1;
+                    DBHelper::getFilesStatsDBmod(playlist->entries,playlist->nb_entries);
                     if (playlist->playlist_id==nil) {//current queue
-                        detailViewController.mPlaylist[row-2].mPlaylistRating=playlist->entries[row-2].ratings;
+                        for (int i=0;i<playlist->nb_entries;i++) detailViewController.mPlaylist[i].mPlaylistRating=playlist->entries[i].ratings;
                     }
                 }
 
@@ -2895,18 +2813,11 @@ int qsort_ComparePlaylistEntriesRev(const void *entryA, const void *entryB) {
             for (int i=0;i<detailViewController.mPlaylist_size;i++) {
                 playlist->entries[i].label=[[NSString alloc] initWithString:detailViewController.mPlaylist[i].mPlaylistFilename];
                 playlist->entries[i].fullpath=[[NSString alloc ] initWithString:detailViewController.mPlaylist[i].mPlaylistFilepath];
-                
-//                if ((playlist->entries[i].playcounts==-1)||(playlist->entries[i].ratings==-1))
-                    DBHelper::getFileStatsDBmod(detailViewController.mPlaylist[i].mPlaylistFilename,
-                                                detailViewController.mPlaylist[i].mPlaylistFilepath,
-                                                &(playlist->entries[i].playcounts),
-                                                &(detailViewController.mPlaylist[i].mPlaylistRating),
-                                                &(playlist->entries[i].song_length),
-                                                &(playlist->entries[i].channels_nb),
-                                                &(playlist->entries[i].songs));                
-                playlist->entries[i].ratings=detailViewController.mPlaylist[i].mPlaylistRating;
+                playlist->entries[i].ratings=-1;
             }
             playlist->nb_entries=detailViewController.mPlaylist_size;
+            DBHelper::getFilesStatsDBmod(playlist->entries,playlist->nb_entries);
+            for (int i=0;i<playlist->nb_entries;i++) detailViewController.mPlaylist[i].mPlaylistRating=playlist->entries[i].ratings;
             playlist->playlist_name=[[NSString alloc] initWithFormat:NSLocalizedString(@"Now playing",@"")];
             playlist->playlist_id=nil;
             
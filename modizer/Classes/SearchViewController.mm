@@ -18,7 +18,6 @@ static int lastSelectedSearch;
 extern BOOL is_ios7;
 
 #include <pthread.h>
-extern pthread_mutex_t db_mutex;
 
 #import "SearchViewController.h"
 #import <QuartzCore/CAGradientLayer.h>
@@ -320,17 +319,12 @@ static NSFileManager *mFileMngr;
 		}
 		playlist_entries_count=0;
 	}
-	pthread_mutex_lock(&db_mutex);
 	playlist_entries_idx=0;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"SELECT p.name,p.id,pe.name,pe.fullpath FROM playlists_entries pe,playlists p \
 				WHERE pe.id_playlist=p.id \
 				AND pe.name LIKE \"%%%s%%\" ORDER BY pe.name COLLATE NOCASE",[mSearchText UTF8String]);
@@ -373,8 +367,7 @@ static NSFileManager *mFileMngr;
 		}
 		
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return 0;
 }
 
@@ -394,17 +387,12 @@ static NSFileManager *mFileMngr;
 		db_entries=NULL;
 		db_entries_count=0;
 	}
-	pthread_mutex_lock(&db_mutex);
 	db_entries_idx=0;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
 				
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		db_entries_count=MAX_SEARCH_RESULT;
 		if (db_entries_count) {
 			db_entries=(t_db_browse_entryS*)malloc(db_entries_count*sizeof(t_db_browse_entryS));
@@ -462,8 +450,7 @@ static NSFileManager *mFileMngr;
 		
 		
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return 0;
 }
 
@@ -487,17 +474,12 @@ static NSFileManager *mFileMngr;
 		dbASMA_entries=NULL;
 		dbASMA_entries_count=0;
 	}
-	pthread_mutex_lock(&db_mutex);
 	db_entries_idx=0;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
         
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-		
 		dbASMA_entries_count=MAX_SEARCH_RESULT;
 		if (dbASMA_entries_count) {
 			dbASMA_entries=(t_dbASMA_browse_entryS*)malloc(dbASMA_entries_count*sizeof(t_dbASMA_browse_entryS));
@@ -549,8 +531,7 @@ static NSFileManager *mFileMngr;
 		}
 		
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return 0;
 }
 
@@ -575,17 +556,12 @@ static NSFileManager *mFileMngr;
 		dbHVSC_entries=NULL;
 		dbHVSC_entries_count=0;
 	}
-	pthread_mutex_lock(&db_mutex);
 	db_entries_idx=0;
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		dbHVSC_entries_count=MAX_SEARCH_RESULT;
 		if (dbHVSC_entries_count) {
 			dbHVSC_entries=(t_dbHVSC_browse_entryS*)malloc(dbHVSC_entries_count*sizeof(t_dbHVSC_browse_entryS));
@@ -637,8 +613,7 @@ static NSFileManager *mFileMngr;
 		}
 		
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return 0;
 }
 
@@ -1028,18 +1003,12 @@ static NSFileManager *mFileMngr;
 	NSString *pathToDB=[[[NSBundle mainBundle] resourcePath] stringByAppendingPathComponent:DATABASENAME_MAIN];
 	sqlite3 *db;
 	NSString *localpath=nil;
-	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;		
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"select localpath from mod_file where id=%d",id_mod);
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
 		if (err==SQLITE_OK){
@@ -1050,8 +1019,7 @@ static NSFileManager *mFileMngr;
 		} else NSLog(@"ErrSQL : %d",err);		
 	}
 	
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	return localpath;
 }
 
@@ -1063,18 +1031,12 @@ static NSFileManager *mFileMngr;
 	NSArray *paths = NSSearchPathForDirectoriesInDomains(NSDocumentDirectory, NSUserDomainMask, YES);
 	NSString *documentsDirectory = [paths objectAtIndex:0];
 	NSString *checkPath,*strFullPath;
-	
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"SELECT localpath FROM mod_file WHERE id=%d",id_mod);
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
 		if (err==SQLITE_OK){
@@ -1085,8 +1047,7 @@ static NSFileManager *mFileMngr;
 			sqlite3_finalize(stmt);
 		} else NSLog(@"ErrSQL : %d",err);
 	}
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 	
 	checkPath = [documentsDirectory stringByAppendingPathComponent: [NSString stringWithFormat:@"%@/%@",MODLAND_BASEDIR,strFullPath]];
 	success = [fileManager fileExistsAtPath:checkPath];
@@ -1329,16 +1290,11 @@ static NSFileManager *mFileMngr;
 -(void) loadPlayListsFromDB:(NSString *)_id_playlist intoPlaylist:(t_playlistS *)_playlist  {
 	NSString *pathToDB=[NSString stringWithFormat:@"%@/%@",[NSHomeDirectory() stringByAppendingPathComponent:  @"Documents"],DATABASENAME_USER];
 	sqlite3 *db;
-	pthread_mutex_lock(&db_mutex);
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[1024];
 		sqlite3_stmt *stmt;
 		int err;
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//Get playlist name
 		sprintf(sqlStatement,"SELECT id,name,num_files FROM playlists WHERE id=%s",[_id_playlist UTF8String]);
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
@@ -1364,8 +1320,7 @@ static NSFileManager *mFileMngr;
 			sqlite3_finalize(stmt);
 		} else NSLog(@"ErrSQL : %d",err);
 	};
-	sqlite3_close(db);
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
 }
 
 -(void) doPrimAction:(NSIndexPath *)indexPath {
@@ -9,7 +9,6 @@
 #import "SettingsMaintenanceViewController.h"
 
 #include <pthread.h>
-extern pthread_mutex_t db_mutex;
 
 extern BOOL is_ios7;
 
@@ -141,19 +140,15 @@ extern BOOL is_ios7;
 	sqlite3 *db;
 	int err;
 	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[256];
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"UPDATE user_stats SET rating=NULL");
 		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
 		if (err==SQLITE_OK){
 		} else NSLog(@"ErrSQL : %d",err);
 	};
-	sqlite3_close(db);
+	DBHelper::unlockDB(db);
 
     UIAlertView *alert = [[[UIAlertView alloc] initWithTitle: @"Info" message:NSLocalizedString(@"Ratings reseted",@"") delegate:self cancelButtonTitle:@"Close" otherButtonTitles:nil] autorelease];
     [alert show];
@@ -168,19 +163,15 @@ extern BOOL is_ios7;
 	sqlite3 *db;
 	int err;
 	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[256];
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		sprintf(sqlStatement,"UPDATE user_stats SET play_count=0");
 		err=sqlite3_exec(db, sqlStatement, NULL, NULL, NULL);
 		if (err==SQLITE_OK){
 		} else NSLog(@"ErrSQL : %d",err);
 	};
-	sqlite3_close(db);
+	DBHelper::unlockDB(db);
     
     UIAlertView *alert = [[[UIAlertView alloc] initWithTitle: @"Info" message:NSLocalizedString(@"Played Counters reseted",@"") delegate:self cancelButtonTitle:@"Close" otherButtonTitles:nil] autorelease];
     [alert show];
@@ -196,18 +187,12 @@ extern BOOL is_ios7;
 	int err;
 	BOOL success;
 	NSFileManager *fileManager = [[NSFileManager alloc] init];
-    
-	pthread_mutex_lock(&db_mutex);
-	
-	if (sqlite3_open([pathToDB UTF8String], &db) == SQLITE_OK){
+
+	if ((db=DBHelper::lockDB(pathToDB))){
 		char sqlStatement[256];
 		char sqlStatement2[256];
 		sqlite3_stmt *stmt;
 		
-        err=sqlite3_exec(db, "PRAGMA journal_mode=WAL; PRAGMA cache_size = 1;PRAGMA synchronous = 1;PRAGMA locking_mode = EXCLUSIVE;", 0, 0, 0);
-        if (err==SQLITE_OK){
-        } else NSLog(@"ErrSQL : %d",err);
-        
 		//First check that user_stats entries still exist
 		sprintf(sqlStatement,"SELECT fullpath FROM user_stats");
 		err=sqlite3_prepare_v2(db, sqlStatement, -1, &stmt, NULL);
@@ -253,10 +238,8 @@ extern BOOL is_ios7;
 			NSLog(@"Issue during VACUUM");
 		}
 	};
-	sqlite3_close(db);
-	
-	
-	pthread_mutex_unlock(&db_mutex);
+	DBHelper::unlockDB(db);
+
     [fileManager release];
 	
     UIAlertView *alert = [[[UIAlertView alloc] initWithTitle: @"Info" message:NSLocalizedString(@"Database cleaned",@"") delegate:self cancelButtonTitle:@"Close" otherButtonTitles:nil] autorelease];
@@ -0,0 +1,26 @@
+/*
+ *  SongLengthScanner.h
+ *  modizer
+ *
+ *  Finds the length of files which were never played, in the background.
+ *
+ */
+#ifndef st_SongLengthScanner_h_
+#define st_SongLengthScanner_h_
+
+#import "RootViewControllerStruct.h"
+
+//user_stats length of a file already scanned without finding its end (looping or unreadable),
+//the displayed length stays empty and the file is not scanned again
+#define SCAN_LENGTH_UNKNOWN -1
+
+namespace SongLengthScanner
+{
+	//fullpath is relative to the home directory ("Documents/..."), same keys as user_stats.
+	//Files already having a length or already scanned, subsong (?) or archive (@) entries are ignored.
+	void queueFile(NSString *name,NSString *fullpath);
+	void queueFiles(NSArray *names,NSArray *fullpaths);
+	void queueFiles(t_local_browse_entry *entries,int nb_entries);
+}
+
+#endif
@@ -0,0 +1,253 @@
+/*
+ *  SongLengthScanner.mm
+ *  modizer
+ *
+ *  Lengths are taken from the engine scan when it has one (libxmp, openmpt, GME tags incl. VGM header),
+ *  otherwise GME tracks are rendered silently until the emulator stops or goes silent.
+ *  Results are stored like after a real playback : songlength_user (md5/track) & user_stats (name/fullpath).
+ *
+ *  Only GME, ModPlug (openmpt) & libxmp files are scanned. SID files keep the HVSC songlength DB :
+ *  sidplay tunes loop forever, so a silent render can't find an end. VGM files only get the length
+ *  of their header through GME : VGMPlay keeps its state in globals shared with the player.
+ *
+ */
+#include "SongLengthScanner.h"
+
+#include "DBHelper.h"
+#include "ModizerConstants.h"
+#import "gme.h"
+#import "../../libopenmpt/openmpt-trunk/include/modplug/include/libmodplug/modplug.h"
+
+extern "C" {
+#include "xmp.h"
+#include "md5.h"
+}
+
+#define SCAN_NB_WORKERS 2
+#define SCAN_SAMPLE_RATE (PLAYBACK_FREQ/2)
+#define SCAN_BUFFER_SIZE 4096       //stereo samples
+#define SCAN_SILENCE_THRESHOLD 8    //same as GME silence detection
+#define SCAN_MAX_LENGTH (15*60*1000)  //ms, longer tracks are considered looping
+
+static dispatch_queue_t scan_queues[SCAN_NB_WORKERS];
+static int scan_queue_next;
+static NSMutableSet *scan_pending;
+
+static void scanInit() {
+	static dispatch_once_t once;
+	dispatch_once(&once, ^{
+		for (int i=0;i<SCAN_NB_WORKERS;i++) {
+			scan_queues[i]=dispatch_queue_create("modizer.songlength", DISPATCH_QUEUE_SERIAL);
+			dispatch_set_target_queue(scan_queues[i],dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0));
+		}
+		scan_pending=[[NSMutableSet alloc] init];
+	});
+}
+
+static char *loadFile(const char *path,long *size) {
+	FILE *f=fopen(path,"rb");
+	char *data;
+
+	if (!f) return NULL;
+	fseek(f,0L,SEEK_END);
+	*size=ftell(f);
+	if (*size<=0) {  //ftell failure or empty file
+		fclose(f);
+		return NULL;
+	}
+	fseek(f,0L,SEEK_SET);
+	data=(char*)malloc(*size);
+	if (data&&(fread(data,1,*size,f)!=(size_t)*size)) {
+		free(data);
+		data=NULL;
+	}
+	fclose(f);
+	return data;
+}
+
+static void md5FromBuffer(char *dest,const char *buf,long size) {
+	unsigned char md5[16];
+	MD5_CTX ctx;
+	MD5Init(&ctx);
+	MD5Update(&ctx,(const unsigned char*)buf,size);
+	MD5Final(md5,&ctx);
+	for (int i=0;i<16;i++) sprintf(dest+i*2,"%.2x",md5[i]);
+}
+
+static void storeFileLength(NSString *name,NSString *fullpath,int song_length,int channels_nb,int songs) {
+	DBHelper::updateFileLengthDBmod(name,fullpath,song_length,channels_nb,songs);
+}
+
+//render the current track without output, returns the time of the last audible sample or 0 if it never ends
+static int gmeRenderLength(gme_t *emu) {
+	short buffer[SCAN_BUFFER_SIZE*2];
+	long played=0,last_sound=0;
+
+	while (!gme_track_ended(emu)) {
+		if (gme_play(emu,SCAN_BUFFER_SIZE*2,buffer)) return 0;
+		for (int i=SCAN_BUFFER_SIZE*2-1;i>=0;i--) {
+			if ((unsigned)(buffer[i]+SCAN_SILENCE_THRESHOLD)>(unsigned)SCAN_SILENCE_THRESHOLD*2) {
+				last_sound=played+i/2+1;
+				break;
+			}
+		}
+		played+=SCAN_BUFFER_SIZE;
+		if (played*1000/SCAN_SAMPLE_RATE>SCAN_MAX_LENGTH) return 0;
+	}
+	return (int)(last_sound*1000/SCAN_SAMPLE_RATE);
+}
+
+static int scanGME(const char *path,const char *md5,NSString *name,NSString *fullpath) {
+	gme_t *emu;
+	gme_info_t *info;
+	int subsongs,total_length,channels;
+
+	if (gme_open_file(path,&emu,SCAN_SAMPLE_RATE)) return -1;
+	//same m3u lookup as the player, it changes the track list & lengths
+	NSString *m3uPath=[NSString stringWithFormat:@"%@.m3u",[[NSString stringWithUTF8String:path] stringByDeletingPathExtension]];
+	if (gme_load_m3u(emu,[m3uPath UTF8String])) {
+		m3uPath=[NSString stringWithFormat:@"%@.M3U",[[NSString stringWithUTF8String:path] stringByDeletingPathExtension]];
+		gme_load_m3u(emu,[m3uPath UTF8String]);
+	}
+	gme_ignore_silence(emu,0);
+
+	subsongs=gme_track_count(emu);
+	channels=gme_voice_count(emu);
+	total_length=0;
+	for (int i=0;i<subsongs;i++) {
+		NSString *subName;
+		int length;
+
+		if (gme_track_info(emu,&info,i)) continue;
+		length=info->play_length;
+		if (length<=0) {
+			if (info->loop_length>0) length=(info->intro_length>0?info->intro_length:0)+2*info->loop_length;
+			else if (gme_start_track(emu,i)==0) length=gmeRenderLength(emu);
+			if (length>0) DBHelper::setSongLengthFromMD5(md5,i+1,length);
+		}
+
+		subName=nil;
+		if (info->song && info->song[0]) subName=[NSString stringWithFormat:@"%.3d-%s",i,info->song];
+		else if (info->game && info->game[0]) subName=[NSString stringWithFormat:@"%.3d-%s",i,info->game];
+		else subName=[NSString stringWithFormat:@"%.3d",i];
+		gme_free_info(info);
+
+		if (length>0) storeFileLength(subName,[NSString stringWithFormat:@"%@?%d",fullpath,i],length,channels,subsongs);
+		total_length+=length;
+	}
+	gme_delete(emu);
+
+	//looping tracks only : remember it was scanned
+	storeFileLength(name,fullpath,(total_length>0?total_length:SCAN_LENGTH_UNKNOWN),channels,subsongs);
+	return 0;
+}
+
+static int scanXMP(const char *path,const char *md5,NSString *name,NSString *fullpath) {
+	xmp_context ctx;
+	struct xmp_module_info mi;
+	int length;
+
+	if ((ctx=xmp_create_context())==NULL) return -1;
+	//sequences duration are computed at load time
+	if (xmp_load_module(ctx,(char*)path)<0) {
+		xmp_free_context(ctx);
+		return -1;
+	}
+	xmp_get_module_info(ctx,&mi);
+	length=mi.seq_data[0].duration;
+	if (length>0) DBHelper::setSongLengthFromMD5(md5,1,length);
+	storeFileLength(name,fullpath,(length>0?length:SCAN_LENGTH_UNKNOWN),mi.mod->chn,1);
+	xmp_release_module(ctx);
+	xmp_free_context(ctx);
+	return 0;
+}
+
+static int scanModPlug(const char *data,long size,const char *md5,NSString *name,NSString *fullpath) {
+	ModPlugFile *mpf;
+	int length;
+
+	if ((mpf=ModPlug_Load(data,size))==NULL) return -1;
+	length=ModPlug_GetLength(mpf);
+	if (length>0) DBHelper::setSongLengthFromMD5(md5,1,length);
+	storeFileLength(name,fullpath,(length>0?length:SCAN_LENGTH_UNKNOWN),ModPlug_NumChannels(mpf),1);
+	ModPlug_Unload(mpf);
+	return 0;
+}
+
+static void scanFile(NSString *name,NSString *fullpath) {
+	NSString *extension=[[fullpath pathExtension] uppercaseString];
+	NSString *file_no_ext=[[[fullpath lastPathComponent] componentsSeparatedByString:@"."] firstObject];
+	NSArray *filetype_extGME=[SUPPORTED_FILETYPE_GME componentsSeparatedByString:@","];
+	NSArray *filetype_extMODPLUG=[SUPPORTED_FILETYPE_MODPLUG componentsSeparatedByString:@","];
+	NSArray *filetype_extXMP=[SUPPORTED_FILETYPE_XMP componentsSeparatedByString:@","];
+	const char *path=[[NSHomeDirectory() stringByAppendingPathComponent:fullpath] fileSystemRepresentation];
+	char md5[33];
+	char *data;
+	long size;
+	int song_length,res;
+
+	file_no_ext=[file_no_ext uppercaseString];
+	//SID lengths come from the HVSC songlength DB, other engines cannot run outside of the player
+	if (([filetype_extGME indexOfObject:extension]==NSNotFound)&&([filetype_extGME indexOfObject:file_no_ext]==NSNotFound)&&
+		([filetype_extMODPLUG indexOfObject:extension]==NSNotFound)&&([filetype_extMODPLUG indexOfObject:file_no_ext]==NSNotFound)&&
+		([filetype_extXMP indexOfObject:extension]==NSNotFound)&&([filetype_extXMP indexOfObject:file_no_ext]==NSNotFound)) return;
+
+	//already known (played or scanned)
+	DBHelper::getFileStatsDBmod(name,fullpath,NULL,NULL,&song_length);
+	if ((song_length>0)||(song_length==SCAN_LENGTH_UNKNOWN)) return;
+
+	if ((data=loadFile(path,&size))==NULL) return;
+	md5FromBuffer(md5,data,size);
+
+	if (([filetype_extGME indexOfObject:extension]!=NSNotFound)||([filetype_extGME indexOfObject:file_no_ext]!=NSNotFound)) {
+		res=scanGME(path,md5,name,fullpath);
+	} else if (([filetype_extMODPLUG indexOfObject:extension]!=NSNotFound)||([filetype_extMODPLUG indexOfObject:file_no_ext]!=NSNotFound)) {
+		if ((res=scanModPlug(data,size,md5,name,fullpath))<0) res=scanXMP(path,md5,name,fullpath);
+	} else {
+		if ((res=scanXMP(path,md5,name,fullpath))<0) res=scanModPlug(data,size,md5,name,fullpath);
+	}
+	//not loadable by the scanners either : don't try again on every browse
+	if (res<0) storeFileLength(name,fullpath,SCAN_LENGTH_UNKNOWN,0,0);
+	free(data);
+}
+
+void SongLengthScanner::queueFile(NSString *name,NSString *fullpath) {
+	int worker;
+
+	if ((name==nil)||(fullpath==nil)) return;
+	if ([fullpath rangeOfString:@"?"].location!=NSNotFound) return;
+	if ([fullpath rangeOfString:@"@"].location!=NSNotFound) return;
+
+	scanInit();
+	@synchronized(scan_pending) {
+		if ([scan_pending containsObject:fullpath]) return;
+		[scan_pending addObject:fullpath];
+	}
+
+	worker=(__atomic_fetch_add(&scan_queue_next,1,__ATOMIC_RELAXED)&0x7fffffff)%SCAN_NB_WORKERS;
+	name=[name copy];
+	fullpath=[fullpath copy];
+	dispatch_async(scan_queues[worker], ^{
+		NSAutoreleasePool *pool=[[NSAutoreleasePool alloc] init];
+		scanFile(name,fullpath);
+		[pool release];
+		@synchronized(scan_pending) {
+			[scan_pending removeObject:fullpath];
+		}
+		[name release];
+		[fullpath release];
+	});
+}
+
+void SongLengthScanner::queueFiles(NSArray *names,NSArray *fullpaths) {
+	for (int i=0;i<[names count];i++) {
+		queueFile([names objectAtIndex:i],[fullpaths objectAtIndex:i]);
+	}
+}
+
+void SongLengthScanner::queueFiles(t_local_browse_entry *entries,int nb_entries) {
+	if (entries==NULL) return;
+	for (int i=0;i<nb_entries;i++) {
+		if ((entries[i].type==1)&&(entries[i].song_length==0)) queueFile(entries[i].label,entries[i].fullpath);
+	}
+}
@@ -90,9 +90,6 @@ static const t_double DRTimes[64]={100000/*infinity*/,100000/*infinity*/,118200.
 					14800.0,12700.0,11100.0,8900.0,7400.0,6300.0,5500.0,4400.0,3700.0,3200.0,2800.0,2200.0,1800.0,1600.0,1400.0,1100.0,
 					920.0,790.0,690.0,550.0,460.0,390.0,340.0,270.0,230.0,200.0,170.0,140.0,110.0,98.0,85.0,68.0,57.0,49.0,43.0,34.0,
 					28.0,25.0,22.0,18.0,14.0,12.0,11.0,8.5,7.1,6.1,5.4,4.3,3.6,3.1};
-static UINT32 FNS_Table[0x400];
-static INT32 EG_TABLE[0x400];
-
 typedef enum {ATTACK,DECAY1,DECAY2,RELEASE} _STATE;
 struct _EG
 {
@@ -179,7 +176,8 @@ struct _AICA
 	unsigned char *AICARAM;
 	UINT32 AICARAM_LENGTH;
 	char Master;
-	void (*IntARMCB)(int irq);
+	void (*IntARMCB)(void *param, int irq);
+	void *IntARMCBParam;
 
 	INT32 *buffertmpl, *buffertmpr;
 
@@ -204,20 +202,17 @@ struct _AICA
 
 	int ARTABLE[64], DRTABLE[64];
 
+	UINT32 FNS_Table[0x400];
+	INT32 EG_TABLE[0x400];
+	struct _LFOTABLES LFOTABLES;
+
+	INT16 *bufferl, *bufferr;
+
 	struct _AICADSP DSP;
 };
 
-static struct _AICA *AllocedAICA;
-
 static const float SDLT[16]={-1000000.0,-42.0,-39.0,-36.0,-33.0,-30.0,-27.0,-24.0,-21.0,-18.0,-15.0,-12.0,-9.0,-6.0,-3.0,0.0};
 
-static INT16 *bufferl;
-static INT16 *bufferr;
-
-static int length;
-
-static signed short *RBUFDST;	//this points to where the sample will be stored in the RingBuf
-
 static unsigned char DecodeSCI(struct _AICA *AICA, unsigned char irq)
 {
 	unsigned char SCI=0;
@@ -236,9 +231,9 @@ static void ResetInterrupts(struct _AICA *AICA)
 #if 0
 	UINT32 reset = AICA->udata.data[0xa4/2];
 	if (reset & 0x40)
-		AICA->IntARMCB(-AICA->IrqTimA);
+		AICA->IntARMCB(AICA->IntARMCBParam, -AICA->IrqTimA);
 	if (reset & 0x180)
-		AICA->IntARMCB(-AICA->IrqTimBC);
+		AICA->IntARMCB(AICA->IntARMCBParam, -AICA->IrqTimBC);
 #endif
 }
 
@@ -249,7 +244,7 @@ static void CheckPendingIRQ(struct _AICA *AICA)
 	if(AICA->MidiW!=AICA->MidiR)
 	{
 		AICA->IRQL = AICA->IrqMidi;
-		AICA->IntARMCB(1);
+		AICA->IntARMCB(AICA->IntARMCBParam, 1);
 		return;
 	}
 	if(!pend)
@@ -258,21 +253,21 @@ static void CheckPendingIRQ(struct _AICA *AICA)
 		if(en&0x40)
 		{
 			AICA->IRQL = AICA->IrqTimA;
-			AICA->IntARMCB(1);
+			AICA->IntARMCB(AICA->IntARMCBParam, 1);
 			return;
 		}
 	if(pend&0x80)
 		if(en&0x80)
 		{
 			AICA->IRQL = AICA->IrqTimBC;
-			AICA->IntARMCB(1);
+			AICA->IntARMCB(AICA->IntARMCBParam, 1);
 			return;
 		}
 	if(pend&0x100)
 		if(en&0x100)
 		{
 			AICA->IRQL = AICA->IrqTimBC;
-			AICA->IntARMCB(1);
+			AICA->IntARMCB(AICA->IntARMCBParam, 1);
 			return;
 		}
 }
@@ -369,12 +364,12 @@ INLINE static int EG_Update(struct _SLOT *slot)
 	return (slot->EG.volume>>EG_SHIFT)<<(SHIFT-10);
 }
 
-static UINT32 AICA_Step(struct _SLOT *slot)
+static UINT32 AICA_Step(struct _AICA *AICA, struct _SLOT *slot)
 {
 	int octave=OCT(slot);
 	UINT32 Fn;
 
-	Fn=(FNS_Table[FNS(slot)]);	//24.8
+	Fn=(AICA->FNS_Table[FNS(slot)]);	//24.8
 	if(octave&8)
 		Fn>>=(16-octave);
 	else
@@ -384,12 +379,12 @@ static UINT32 AICA_Step(struct _SLOT *slot)
 }
 
 
-static void Compute_LFO(struct _SLOT *slot)
+static void Compute_LFO(struct _AICA *AICA, struct _SLOT *slot)
 {
 	if(PLFOS(slot)!=0)
-		AICALFO_ComputeStep(&(slot->PLFO),LFOF(slot),PLFOWS(slot),PLFOS(slot),0);
+		AICALFO_ComputeStep(&AICA->LFOTABLES,&(slot->PLFO),LFOF(slot),PLFOWS(slot),PLFOS(slot),0);
 	if(ALFOS(slot)!=0)
-		AICALFO_ComputeStep(&(slot->ALFO),LFOF(slot),ALFOWS(slot),ALFOS(slot),1);
+		AICALFO_ComputeStep(&AICA->LFOTABLES,&(slot->ALFO),LFOF(slot),ALFOWS(slot),ALFOS(slot),1);
 }
 
 #define ADPCMSHIFT	8
@@ -427,11 +422,11 @@ static void AICA_StartSlot(struct _AICA *AICA, struct _SLOT *slot)
 	slot->cur_addr=0; slot->nxt_addr=1<<SHIFT; slot->prv_addr=-1;
 	start_offset = SA(slot);	// AICA can play 16-bit samples from any boundry
 	slot->base=&AICA->AICARAM[start_offset];
-	slot->step=AICA_Step(slot);
+	slot->step=AICA_Step(AICA, slot);
 	Compute_EG(AICA,slot);
 	slot->EG.state=ATTACK;
 	slot->EG.volume=0x17f<<EG_SHIFT;
-	Compute_LFO(slot);
+	Compute_LFO(AICA, slot);
 
 	if (PCMS(slot) >= 2)
 	{
@@ -511,7 +506,7 @@ static void AICA_Init(struct _AICA *AICA, const struct AICAinterface *intf)
 
 		if (intf->region)
 		{
-			AICA->AICARAM = &dc_ram[0];
+			AICA->AICARAM = intf->region[0];
 			AICA->AICARAM_LENGTH = 2*1024*1024;
 			AICA->DSP.AICARAM = (UINT16 *)AICA->AICARAM;
 			AICA->DSP.AICARAM_LENGTH =  (2*1024*1024)/2;
@@ -522,14 +517,14 @@ static void AICA_Init(struct _AICA *AICA, const struct AICAinterface *intf)
 	{
 		float fcent=(t_double) 1200.0*log_base_2((t_double)(((t_double) 1024.0+(t_double)i)/(t_double)1024.0));
 		fcent=(t_double) 44100.0*pow(2.0,fcent/1200.0);
-		FNS_Table[i]=(float) (1<<SHIFT) *fcent;
+		AICA->FNS_Table[i]=(float) (1<<SHIFT) *fcent;
 	}
 
 	for(i=0;i<0x400;++i)
 	{
 		float envDB=((float)(3*(i-0x3ff)))/32.0;
 		float scale=(float)(1<<SHIFT);
-		EG_TABLE[i]=(INT32)(pow(10.0,envDB/20.0)*scale);
+		AICA->EG_TABLE[i]=(INT32)(pow(10.0,envDB/20.0)*scale);
 	}
 
 	for(i=0;i<0x20000;++i)
@@ -614,7 +609,7 @@ static void AICA_Init(struct _AICA *AICA, const struct AICAinterface *intf)
 		AICA->Slots[i].mslc=0;
 	}
 
-	AICALFO_Init();
+	AICALFO_Init(&AICA->LFOTABLES);
 	AICA->buffertmpl=(signed int*) malloc(44100*sizeof(signed int));
 	AICA->buffertmpr=(signed int*) malloc(44100*sizeof(signed int));
 	memset(AICA->buffertmpl,0,44100*sizeof(signed int));
@@ -668,7 +663,7 @@ static void AICA_UpdateSlotReg(struct _AICA *AICA,int s,int r)
 			break;
 		case 0x18:
 		case 0x19:
-			slot->step=AICA_Step(slot);
+			slot->step=AICA_Step(AICA, slot);
 			break;
 		case 0x14:
 		case 0x15:
@@ -677,7 +672,7 @@ static void AICA_UpdateSlotReg(struct _AICA *AICA,int s,int r)
 			break;
 		case 0x1c:
 		case 0x1d:
-			Compute_LFO(slot);
+			Compute_LFO(AICA, slot);
 			break;
 		case 0x24:
 //			printf("[%02d]: %x to DISDL/DIPAN (PC=%x)\n", s, slot->udata.data[0x24/2], arm7_get_register(15));
@@ -706,7 +701,7 @@ static void AICA_UpdateReg(struct _AICA *AICA, int reg)
 			break;
 		case 0x8:
 		case 0x9:
-			AICA_MidiIn(0, AICA->udata.data[0x8/2]&0xff, 0);
+			AICA_MidiIn(AICA, 0, AICA->udata.data[0x8/2]&0xff, 0);
 			break;
 		case 0x12:
 		case 0x13:
@@ -794,7 +789,7 @@ static void AICA_UpdateRegR(struct _AICA *AICA, int reg)
 				unsigned short v=AICA->udata.data[0x8/2];
 				v&=0xff00;
 				v|=AICA->MidiStack[AICA->MidiR];
-				AICA->IntARMCB(0);	// cancel the IRQ
+				AICA->IntARMCB(AICA->IntARMCBParam, 0);	// cancel the IRQ
 				if(AICA->MidiR!=AICA->MidiW)
 				{
 					++AICA->MidiR;
@@ -860,7 +855,7 @@ static void AICA_w16(struct _AICA *AICA,unsigned int addr,unsigned short val)
 
 			if (val)
 			{
-				AICA->IntARMCB(0);
+				AICA->IntARMCB(AICA->IntARMCBParam, 0);
 			}
 		}
 	}
@@ -1104,7 +1099,7 @@ static INLINE INT32 AICA_UpdateSlot(struct _AICA *AICA, struct _SLOT *slot)
 	if(slot->EG.state==ATTACK)
 		sample=(sample*EG_Update(slot))>>SHIFT;
 	else
-		sample=(sample*EG_TABLE[EG_Update(slot)>>(SHIFT-10)])>>SHIFT;
+		sample=(sample*AICA->EG_TABLE[EG_Update(slot)>>(SHIFT-10)])>>SHIFT;
 		
 	if(slot->mslc) 
 	{
@@ -1271,7 +1266,7 @@ static INLINE INT32 AICA_UpdateSlot22khz(struct _AICA *AICA, struct _SLOT *slot)
 	if(slot->EG.state==ATTACK)
 		sample=(sample*EG_Update(slot))>>SHIFT;
 	else
-		sample=(sample*EG_TABLE[EG_Update(slot)>>(SHIFT-10)])>>SHIFT;
+		sample=(sample*AICA->EG_TABLE[EG_Update(slot)>>(SHIFT-10)])>>SHIFT;
     
 	if(slot->mslc) 
 	{
@@ -1303,8 +1298,8 @@ static void AICA_DoMasterSamples(struct _AICA *AICA, int nsamples)
 	INT16 *bufr,*bufl;
 	int sl, s, i;
 
-	bufr=bufferr;
-	bufl=bufferl;
+	bufr=AICA->bufferr;
+	bufl=AICA->bufferl;
 
 	for(s=0;s<nsamples;++s)
 	{
@@ -1319,8 +1314,6 @@ static void AICA_DoMasterSamples(struct _AICA *AICA, int nsamples)
 			{
                 struct _SLOT *slot=AICA->Slots+sl;
                 slot->mslc = (MSLC(AICA)==sl);
-                RBUFDST=AICA->RINGBUF+AICA->BUFPTR;
-                
 				unsigned int Enc;
 				signed int sample;
 
@@ -1367,8 +1360,8 @@ static void AICA_DoMasterSamples22khz(struct _AICA *AICA, int nsamples)
 	INT16 *bufr,*bufl;
 	int sl, s, i;
     
-	bufr=bufferr;
-	bufl=bufferl;
+	bufr=AICA->bufferr;
+	bufl=AICA->bufferl;
     
 	for(s=0;s<nsamples;++s)
 	{
@@ -1382,8 +1375,6 @@ static void AICA_DoMasterSamples22khz(struct _AICA *AICA, int nsamples)
 			{
                 struct _SLOT *slot=AICA->Slots+sl;
                 slot->mslc = (MSLC(AICA)==sl);
-                RBUFDST=AICA->RINGBUF+AICA->BUFPTR;
-                
 				unsigned int Enc;
 				signed int sample;
                 
@@ -1438,19 +1429,17 @@ int AICA_IRQCB(void *param)
 
 void AICA_Update(void *param, INT16 **inputs, INT16 **buf, int samples)
 {
-	struct _AICA *AICA = AllocedAICA;
-	bufferl = buf[0];
-	bufferr = buf[1];
-	length = samples;
+	struct _AICA *AICA = param;
+	AICA->bufferl = buf[0];
+	AICA->bufferr = buf[1];
 	AICA_DoMasterSamples(AICA, samples);
 }
 
 void AICA_Update22khz(void *param, INT16 **inputs, INT16 **buf, int samples)
 {
-	struct _AICA *AICA = AllocedAICA;
-	bufferl = buf[0];
-	bufferr = buf[1];
-	length = samples;
+	struct _AICA *AICA = param;
+	AICA->bufferl = buf[0];
+	AICA->bufferr = buf[1];
 	AICA_DoMasterSamples22khz(AICA, samples);
 }
 
@@ -1471,23 +1460,26 @@ void *aica_start(const void *config)
 	// set up the IRQ callbacks
 	{
 		AICA->IntARMCB = intf->irq_callback[0];
+		AICA->IntARMCBParam = intf->irq_param[0];
 
 //		AICA->stream = stream_create(0, 2, 44100, AICA, AICA_Update);
 	}
 
-	AllocedAICA = AICA;
-
 	return AICA;
 }
 
-void aica_stop(void)
+void aica_stop(void *chip)
 {
-	free(AllocedAICA);
+	struct _AICA *AICA = chip;
+
+	free(AICA->buffertmpl);
+	free(AICA->buffertmpr);
+	free(AICA);
 }
 
-void AICA_set_ram_base(int which, void *base)
+void AICA_set_ram_base(void *chip, int which, void *base)
 {
-	struct _AICA *AICA = AllocedAICA;
+	struct _AICA *AICA = chip;
 	if (AICA)
 	{
 		AICA->AICARAM = base;
@@ -1497,7 +1489,7 @@ void AICA_set_ram_base(int which, void *base)
 
 READ16_HANDLER( AICA_0_r )
 {
-	struct _AICA *AICA = AllocedAICA;
+	struct _AICA *AICA = chip;
 	UINT16 res = AICA_r16(AICA, offset*2);
 
 //	printf("Read AICA @ %x => %x (PC=%x, R5=%x)\n", offset*2, res, arm7_get_register(15), arm7_get_register(5));
@@ -1509,7 +1501,7 @@ extern UINT32* stv_scu;
 
 WRITE16_HANDLER( AICA_0_w )
 {
-	struct _AICA *AICA = AllocedAICA;
+	struct _AICA *AICA = chip;
 	UINT16 tmp;
 
 	tmp = AICA_r16(AICA, offset*2);
@@ -1519,14 +1511,14 @@ WRITE16_HANDLER( AICA_0_w )
 
 WRITE16_HANDLER( AICA_MidiIn )
 {
-	struct _AICA *AICA = AllocedAICA; 
+	struct _AICA *AICA = chip; 
 	AICA->MidiStack[AICA->MidiW++]=data;
 	AICA->MidiW &= 15;
 }
 
 READ16_HANDLER( AICA_MidiOutR )
 {
-	struct _AICA *AICA = AllocedAICA; 
+	struct _AICA *AICA = chip; 
 	unsigned char val;
 
 	val=AICA->MidiStack[AICA->MidiR++];
@@ -20,16 +20,17 @@ struct AICAinterface
 {
 	int num;
 	void *region[MAX_AICA];
-	int mixing_level[MAX_AICA];			/* volume */
-	void (*irq_callback[MAX_AICA])(int state);	/* irq callback */
+	int mixing_level[MAX_AICA];			/* volume */
+	void (*irq_callback[MAX_AICA])(void *param, int state);	/* irq callback */
+	void *irq_param[MAX_AICA];			/* handed back to irq_callback */
 };
 
 int AICA_sh_start(struct AICAinterface *intf);
 void AICA_sh_stop(void);
 void scsp_stop(void);
 
-#define READ16_HANDLER(name)	data16_t name(offs_t offset, data16_t mem_mask)
-#define WRITE16_HANDLER(name)	void     name(offs_t offset, data16_t data, data16_t mem_mask)
+#define READ16_HANDLER(name)	data16_t name(void *chip, offs_t offset, data16_t mem_mask)
+#define WRITE16_HANDLER(name)	void     name(void *chip, offs_t offset, data16_t data, data16_t mem_mask)
 
 // AICA register access
 READ16_HANDLER( AICA_0_r );
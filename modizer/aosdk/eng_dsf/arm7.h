@@ -9,6 +9,8 @@
 
 #include "cpuintrf.h"
 
+struct dc_hw;
+
   //--------------------------------------------------------------------------
   // definitions and macros
 
@@ -115,41 +117,41 @@ struct sARM7
   UINT32 kod;
   /** Cycle counter. */
   int cykle;
-  };
-  //--------------------------------------------------------------------------
+  /** Cycles it took for current instruction to complete. */
+  int cykle_kod;
 
-  //--------------------------------------------------------------------------
-  /** ARM7 state. */
-extern struct sARM7 ARM7;
+  /** Memory map the core is attached to (handed to dc_read/dc_write). */
+  struct dc_hw *dc;
+  };
   //--------------------------------------------------------------------------
 
   //--------------------------------------------------------------------------
   // public procedures
 
   /** ARM7 emulator init. */
-void ARM7_Init (void);
+void ARM7_Init (struct sARM7 *cpu);
 
   /** Power-ON reset. */
-void ARM7_HardReset (void);
+void ARM7_HardReset (struct sARM7 *cpu);
   /** Hardware reset via /RESET line. */
-void ARM7_SoftReset (void);
+void ARM7_SoftReset (struct sARM7 *cpu);
 
   /** CPSR update, possibly changing operating mode. */
-void ARM7_SetCPSR (ARM7_REG sr);
+void ARM7_SetCPSR (struct sARM7 *cpu, ARM7_REG sr);
 
   /** Sets FIQ line state. */
-void ARM7_SetFIQ (int stan);
+void ARM7_SetFIQ (struct sARM7 *cpu, int stan);
   /** Sets IRQ line state. */
-void ARM7_SetIRQ (int stan);
+void ARM7_SetIRQ (struct sARM7 *cpu, int stan);
 
   /** Tests for pending interrupts, switches to one if possible. */
-void ARM7_CheckIRQ (void);
+void ARM7_CheckIRQ (struct sARM7 *cpu);
 
   /** Single step. */
-void ARM7_Step (void);
+void ARM7_Step (struct sARM7 *cpu);
   /** Runs emulation for at least n cycles, returns actual amount of cycles
  burned - normal interpreter. */
-int ARM7_Execute (int n);
+int ARM7_Execute (struct sARM7 *cpu, int n);
   //--------------------------------------------------------------------------
 
 enum
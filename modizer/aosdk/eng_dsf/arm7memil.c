@@ -1,53 +1,53 @@
 // memory inline functions shared by ARM and THUMB modes
 
-void dc_write8(int addr, uint8 data);
-void dc_write16(int addr, uint16 data);
-void dc_write32(int addr, uint32 data);
-uint8 dc_read8(int addr);
-uint16 dc_read16(int addr);
-uint32 dc_read32(int addr);
+void dc_write8(struct dc_hw *hw, int addr, uint8 data);
+void dc_write16(struct dc_hw *hw, int addr, uint16 data);
+void dc_write32(struct dc_hw *hw, int addr, uint32 data);
+uint8 dc_read8(struct dc_hw *hw, int addr);
+uint16 dc_read16(struct dc_hw *hw, int addr);
+uint32 dc_read32(struct dc_hw *hw, int addr);
 
 
-static INLINE void arm7_write_32(UINT32 addr, UINT32 data )
+static INLINE void arm7_write_32(struct sARM7 *cpu, UINT32 addr, UINT32 data )
 {
 	addr &= ~3;
-	dc_write32(addr,data);
+	dc_write32(cpu->dc, addr,data);
 }
 
 
-static INLINE void arm7_write_16(UINT32 addr, UINT16 data)
+static INLINE void arm7_write_16(struct sARM7 *cpu, UINT32 addr, UINT16 data)
 {
 	addr &= ~1;
-	dc_write16(addr,data);
+	dc_write16(cpu->dc, addr,data);
 }
 
-static INLINE void arm7_write_8(UINT32 addr, UINT8 data)
+static INLINE void arm7_write_8(struct sARM7 *cpu, UINT32 addr, UINT8 data)
 {
-	dc_write8(addr,data);
+	dc_write8(cpu->dc, addr,data);
 }
 
-static INLINE UINT32 arm7_read_32(UINT32 addr)
+static INLINE UINT32 arm7_read_32(struct sARM7 *cpu, UINT32 addr)
 {
     UINT32 result;
     int k = (addr & 3) << 3;
 
     if (k)
     {
-        result = dc_read32 (addr & ~3);
+        result = dc_read32(cpu->dc, addr & ~3);
         result = (result >> k) | (result << (32 - k));
     }
     else
     {
-    	result = dc_read32(addr);
+    	result = dc_read32(cpu->dc, addr);
     }
     return result;
 }
 
-static INLINE UINT16 arm7_read_16(UINT32 addr)
+static INLINE UINT16 arm7_read_16(struct sARM7 *cpu, UINT32 addr)
 {
 	UINT16 result;
 
-	result = dc_read16(addr & ~1);
+	result = dc_read16(cpu->dc, addr & ~1);
 
 	if (addr & 1)
 	{
@@ -57,8 +57,8 @@ static INLINE UINT16 arm7_read_16(UINT32 addr)
 	return result;
 }
 
-static INLINE UINT8 arm7_read_8(UINT32 addr)
+static INLINE UINT8 arm7_read_8(struct sARM7 *cpu, UINT32 addr)
 {
-    return dc_read8(addr);
+    return dc_read8(cpu->dc, addr);
 }
 
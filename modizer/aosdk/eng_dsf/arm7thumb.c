@@ -48,7 +48,7 @@ static const int thumbCycles[256] =
 #define SIGN_BIT                ((UINT32)(1<<31))
 
 #define HandleThumbALUAddFlags(rd, rn, op2) \
-    ARM7_SetCPSR( \
+    ARM7_SetCPSR(cpu, \
       ((GET_CPSR &~ (ARM7_CPSR_N | ARM7_CPSR_Z | ARM7_CPSR_V | ARM7_CPSR_C)) \
       | (((!THUMB_SIGN_BITS_DIFFER(rn, op2)) && THUMB_SIGN_BITS_DIFFER(rn, rd)) \
           << V_BIT) \
@@ -57,7 +57,7 @@ static const int thumbCycles[256] =
   	R15 += 2;
 
 #define HandleThumbALUSubFlags(rd, rn, op2) \
-    ARM7_SetCPSR( \
+    ARM7_SetCPSR(cpu, \
       ((GET_CPSR &~ (ARM7_CPSR_N | ARM7_CPSR_Z | ARM7_CPSR_V | ARM7_CPSR_C)) \
       | ((THUMB_SIGN_BITS_DIFFER(rn, op2) && THUMB_SIGN_BITS_DIFFER(rn, rd)) \
           << V_BIT) \
@@ -72,23 +72,23 @@ static const int thumbCycles[256] =
 #include "arm7memil.c"
 
 // public functions
-int ARM7i_Thumb_Step()
+int ARM7i_Thumb_Step(struct sARM7 *cpu)
 {
 	UINT32 readword;
 	UINT32 addr, insn;
 	UINT32 rm, rn, rs, rd, op2, imm, rrs, rrd;
 	INT32 offs;
-	UINT32 pc = ARM7.Rx[ARM7_PC];
+	UINT32 pc = cpu->Rx[ARM7_PC];
 	int cycles;
 
-	insn = arm7_read_16(pc & (~1));
+	insn = arm7_read_16(cpu, pc & (~1));
 
 	cycles = (3 - thumbCycles[insn >> 8]);
 
 	switch( ( insn & THUMB_INSN_TYPE ) >> THUMB_INSN_TYPE_SHIFT )
 	{
 		case 0x0: /* Logical shifting */
-			ARM7_SetCPSR(GET_CPSR &~ (ARM7_CPSR_N | ARM7_CPSR_Z));
+			ARM7_SetCPSR(cpu, GET_CPSR &~ (ARM7_CPSR_N | ARM7_CPSR_Z));
 			if( insn & THUMB_SHIFT_R ) /* Shift right */
 			{
 				rs = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
@@ -100,11 +100,11 @@ int ARM7i_Thumb_Step()
 					SET_REGISTER( rd, rrs >> offs );
 				if( rrs & ( 1 << (offs-1) ) )
 				{
-					ARM7_SetCPSR(GET_CPSR | ARM7_CPSR_C);
+					ARM7_SetCPSR(cpu, GET_CPSR | ARM7_CPSR_C);
 				}
 				else
 				{
-					ARM7_SetCPSR(GET_CPSR &~ ARM7_CPSR_C);
+					ARM7_SetCPSR(cpu, GET_CPSR &~ ARM7_CPSR_C);
 				}
 				}
 				else
@@ -112,15 +112,15 @@ int ARM7i_Thumb_Step()
 					SET_REGISTER( rd, 0 );
 					if( rrs & 0x80000000 )
 					{
-					        ARM7_SetCPSR( GET_CPSR | ARM7_CPSR_C );
+					        ARM7_SetCPSR( cpu, GET_CPSR | ARM7_CPSR_C );
 					}
 					else
 					{
-					        ARM7_SetCPSR( GET_CPSR &~ ARM7_CPSR_C );
+					        ARM7_SetCPSR( cpu, GET_CPSR &~ ARM7_CPSR_C );
 					}
 				}
-				ARM7_SetCPSR(GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-				ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+				ARM7_SetCPSR(cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+				ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 			        R15 += 2;
 			}
 			else /* Shift left */
@@ -134,19 +134,19 @@ int ARM7i_Thumb_Step()
 					SET_REGISTER( rd, rrs << offs );
 					if( rrs & ( 1 << ( 31 - ( offs - 1 ) ) ) )
 					{
-						ARM7_SetCPSR(GET_CPSR | ARM7_CPSR_C);
+						ARM7_SetCPSR(cpu, GET_CPSR | ARM7_CPSR_C);
 					}
 					else
 					{
-						ARM7_SetCPSR(GET_CPSR &~ ARM7_CPSR_C);
+						ARM7_SetCPSR(cpu, GET_CPSR &~ ARM7_CPSR_C);
 					}
 				}
 				else
 				{
 					SET_REGISTER( rd, rrs );
 				}
-				ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-				ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+				ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+				ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 				R15 += 2;
 			}
 			break;
@@ -207,11 +207,11 @@ int ARM7i_Thumb_Step()
 					{
 					        if( rrs >> 31 )
 					{
-						ARM7_SetCPSR(GET_CPSR | ARM7_CPSR_C);
+						ARM7_SetCPSR(cpu, GET_CPSR | ARM7_CPSR_C);
 					}
 					else
 					{
-						ARM7_SetCPSR(GET_CPSR &~ ARM7_CPSR_C);
+						ARM7_SetCPSR(cpu, GET_CPSR &~ ARM7_CPSR_C);
 					}
 					        SET_REGISTER( rd, ( rrs & 0x80000000 ) ? 0xFFFFFFFF : 0x00000000 );
 					}
@@ -219,16 +219,16 @@ int ARM7i_Thumb_Step()
 					{
 					        if( ( rrs >> ( offs - 1 ) ) & 1 )
 					        {
-					        ARM7_SetCPSR( GET_CPSR | ARM7_CPSR_C );
+					        ARM7_SetCPSR( cpu, GET_CPSR | ARM7_CPSR_C );
 					        }
 					        else
 					        {
-					        ARM7_SetCPSR( GET_CPSR &~ ARM7_CPSR_C );
+					        ARM7_SetCPSR( cpu, GET_CPSR &~ ARM7_CPSR_C );
 					        }
 					        SET_REGISTER( rd, ( rrs & 0x80000000 ) ? ( ( 0xFFFFFFFF << ( 32 - offs ) ) | ( rrs >> offs ) ) : ( rrs >> offs ) );
 					}
-					ARM7_SetCPSR(GET_CPSR &~ (ARM7_CPSR_N | ARM7_CPSR_Z));
-					ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+					ARM7_SetCPSR(cpu, GET_CPSR &~ (ARM7_CPSR_N | ARM7_CPSR_Z));
+					ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 					R15 += 2;
 				}
 
@@ -248,8 +248,8 @@ int ARM7i_Thumb_Step()
 				rd = ( insn & THUMB_INSN_IMM_RD ) >> THUMB_INSN_IMM_RD_SHIFT;
 				op2 = ( insn & THUMB_INSN_IMM );
 				SET_REGISTER( rd, op2 );
-				ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-				ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+				ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+				ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 				R15 += 2;
 			}
 			break;
@@ -283,16 +283,16 @@ int ARM7i_Thumb_Step()
 							rs = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 							rd = ( insn & THUMB_ADDSUB_RD ) >> THUMB_ADDSUB_RD_SHIFT;
 							SET_REGISTER( rd, GET_REGISTER(rd) & GET_REGISTER(rs) );
-							ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-							ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+							ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+							ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 							R15 += 2;
 							break;
 						case 0x1: /* EOR Rd, Rs */
 							rs = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 							rd = ( insn & THUMB_ADDSUB_RD ) >> THUMB_ADDSUB_RD_SHIFT;
 							SET_REGISTER( rd, GET_REGISTER(rd) ^ GET_REGISTER(rs) );
-							ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-							ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+							ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+							ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 							R15 += 2;
 							break;
 						case 0x2: /* LSL Rd, Rs */
@@ -307,11 +307,11 @@ int ARM7i_Thumb_Step()
 								        SET_REGISTER( rd, rrd << offs );
 								        if( rrd & ( 1 << ( 31 - ( offs - 1 ) ) ) )
 								        {
-									        ARM7_SetCPSR( GET_CPSR | ARM7_CPSR_C );
+									        ARM7_SetCPSR( cpu, GET_CPSR | ARM7_CPSR_C );
 								        }
 								        else
 								        {
-									        ARM7_SetCPSR( GET_CPSR &~ ARM7_CPSR_C );
+									        ARM7_SetCPSR( cpu, GET_CPSR &~ ARM7_CPSR_C );
 								        }
 								}
 								else if( offs == 32 )
@@ -319,21 +319,21 @@ int ARM7i_Thumb_Step()
 								        SET_REGISTER( rd, 0 );
 								        if( rrd & 1 )
 								        {
-									        ARM7_SetCPSR( GET_CPSR | ARM7_CPSR_C );
+									        ARM7_SetCPSR( cpu, GET_CPSR | ARM7_CPSR_C );
 								        }
 								        else
 								        {
-									        ARM7_SetCPSR( GET_CPSR &~ ARM7_CPSR_C );
+									        ARM7_SetCPSR( cpu, GET_CPSR &~ ARM7_CPSR_C );
 								        }
 								}
 								else
 								{
 								        SET_REGISTER( rd, 0 );
-								        ARM7_SetCPSR( GET_CPSR &~ ARM7_CPSR_C );
+								        ARM7_SetCPSR( cpu, GET_CPSR &~ ARM7_CPSR_C );
 								}
 							}
-							ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-							ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+							ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+							ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 							R15 += 2;
 							break;
 						case 0x3: /* LSR Rd, Rs */
@@ -348,11 +348,11 @@ int ARM7i_Thumb_Step()
 								        SET_REGISTER( rd, rrd >> offs );
 								        if( rrd & ( 1 << ( offs - 1 ) ) )
 								        {
-									        ARM7_SetCPSR( GET_CPSR | ARM7_CPSR_C );
+									        ARM7_SetCPSR( cpu, GET_CPSR | ARM7_CPSR_C );
 								        }
 								        else
 								        {
-									        ARM7_SetCPSR( GET_CPSR &~ ARM7_CPSR_C );
+									        ARM7_SetCPSR( cpu, GET_CPSR &~ ARM7_CPSR_C );
 								        }
 								}
 								else if( offs == 32 )
@@ -360,21 +360,21 @@ int ARM7i_Thumb_Step()
 								        SET_REGISTER( rd, 0 );
 								        if( rrd & 0x80000000 )
 								        {
-									        ARM7_SetCPSR( GET_CPSR | ARM7_CPSR_C );
+									        ARM7_SetCPSR( cpu, GET_CPSR | ARM7_CPSR_C );
 								        }
 								        else
 								        {
-									        ARM7_SetCPSR( GET_CPSR &~ ARM7_CPSR_C );
+									        ARM7_SetCPSR( cpu, GET_CPSR &~ ARM7_CPSR_C );
 								        }
 								}
 								else
 								{
 								        SET_REGISTER( rd, 0 );
-								        ARM7_SetCPSR( GET_CPSR &~ ARM7_CPSR_C );
+								        ARM7_SetCPSR( cpu, GET_CPSR &~ ARM7_CPSR_C );
 								}
 							}
-							ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-							ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+							ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+							ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 							R15 += 2;
 							break;
 						case 0x4: /* ASR Rd, Rs */
@@ -389,11 +389,11 @@ int ARM7i_Thumb_Step()
 									{
 										if (rrd>>31)
 										{
-											ARM7_SetCPSR(GET_CPSR | ARM7_CPSR_C);
+											ARM7_SetCPSR(cpu, GET_CPSR | ARM7_CPSR_C);
 										}
 										else
 										{
-											ARM7_SetCPSR(GET_CPSR &~ ARM7_CPSR_C);
+											ARM7_SetCPSR(cpu, GET_CPSR &~ ARM7_CPSR_C);
 										}
 										SET_REGISTER( rd, (GET_REGISTER(rd) & 0x80000000) ? 0xFFFFFFFF : 0x00000000 );
 									}
@@ -401,17 +401,17 @@ int ARM7i_Thumb_Step()
 									{
 										if ((rrd>>(rs-1))&1)
 										{
-											ARM7_SetCPSR(GET_CPSR | ARM7_CPSR_C);
+											ARM7_SetCPSR(cpu, GET_CPSR | ARM7_CPSR_C);
 										}
 										else
 										{
-											ARM7_SetCPSR(GET_CPSR &~ ARM7_CPSR_C);
+											ARM7_SetCPSR(cpu, GET_CPSR &~ ARM7_CPSR_C);
 										}
 										SET_REGISTER( rd, (rrd & 0x80000000) ? ((0xFFFFFFFF<<(32-rrs)) | (rrd>>rrs)) : (rrd>>rrs));
 									}
 								}
-								ARM7_SetCPSR(GET_CPSR &~ (ARM7_CPSR_N | ARM7_CPSR_Z));
-								ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+								ARM7_SetCPSR(cpu, GET_CPSR &~ (ARM7_CPSR_N | ARM7_CPSR_Z));
+								ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 								R15 += 2;
 							}
 							break;
@@ -439,21 +439,21 @@ int ARM7i_Thumb_Step()
 							SET_REGISTER( rd, ( rrd >> imm ) | ( rrd << ( 32 - imm ) ) );
 							if( rrd & ( 1 << ( imm - 1 ) ) )
 							{
-							        ARM7_SetCPSR( GET_CPSR | ARM7_CPSR_C );
+							        ARM7_SetCPSR( cpu, GET_CPSR | ARM7_CPSR_C );
 							}
 							else
 							{
-							        ARM7_SetCPSR( GET_CPSR &~ ARM7_CPSR_C );
+							        ARM7_SetCPSR( cpu, GET_CPSR &~ ARM7_CPSR_C );
 							}
-							ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-							ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+							ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+							ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 							R15 += 2;
 							break;
 						case 0x8: /* TST Rd, Rs */
 							rs = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 							rd = ( insn & THUMB_ADDSUB_RD ) >> THUMB_ADDSUB_RD_SHIFT;
-							ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-							ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) & GET_REGISTER(rs) ) );
+							ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+							ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) & GET_REGISTER(rs) ) );
 							R15 += 2;
 							break;
 						case 0x9: /* NEG Rd, Rs - todo: check me */
@@ -480,25 +480,25 @@ int ARM7i_Thumb_Step()
 							rs = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 							rd = ( insn & THUMB_ADDSUB_RD ) >> THUMB_ADDSUB_RD_SHIFT;
 							SET_REGISTER( rd, GET_REGISTER(rd) | GET_REGISTER(rs) );
-							ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-							ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+							ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+							ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 							R15 += 2;
 							break;
 						case 0xd: /* MUL Rd, Rs */
 							rs = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 							rd = ( insn & THUMB_ADDSUB_RD ) >> THUMB_ADDSUB_RD_SHIFT;
 							rn = GET_REGISTER(rd) * GET_REGISTER(rs);
-							ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+							ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
 							SET_REGISTER( rd, rn );
-							ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( rn ) );
+							ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( rn ) );
 							R15 += 2;
 							break;
 						case 0xe: /* BIC Rd, Rs */
 							rs = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 							rd = ( insn & THUMB_ADDSUB_RD ) >> THUMB_ADDSUB_RD_SHIFT;
 							SET_REGISTER( rd, GET_REGISTER(rd) & (~GET_REGISTER(rs)) );
-							ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-							ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+							ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+							ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 							R15 += 2;
 							break;
 						case 0xf: /* MVN Rd, Rs */
@@ -506,8 +506,8 @@ int ARM7i_Thumb_Step()
 							rd = ( insn & THUMB_ADDSUB_RD ) >> THUMB_ADDSUB_RD_SHIFT;
 							op2 = GET_REGISTER(rs);
 							SET_REGISTER( rd, ~op2 );
-							ARM7_SetCPSR( GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
-							ARM7_SetCPSR( GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
+							ARM7_SetCPSR( cpu, GET_CPSR &~ ( ARM7_CPSR_Z | ARM7_CPSR_N ) );
+							ARM7_SetCPSR( cpu, GET_CPSR | HandleALUNZFlags( GET_REGISTER(rd) ) );
 							R15 += 2;
 							break;
 						default:
@@ -662,7 +662,7 @@ int ARM7i_Thumb_Step()
 									}
 									else
 									{
-										ARM7_SetCPSR(GET_CPSR &~ ARM7_CPSR_T);
+										ARM7_SetCPSR(cpu, GET_CPSR &~ ARM7_CPSR_T);
 										if( addr & 2 )
 										{
 											addr += 2;
@@ -682,7 +682,7 @@ int ARM7i_Thumb_Step()
 									}
 									else
 									{
-										ARM7_SetCPSR(GET_CPSR &~ ARM7_CPSR_T);
+										ARM7_SetCPSR(cpu, GET_CPSR &~ ARM7_CPSR_T);
 										if( addr & 2 )
 										{
 											addr += 2;
@@ -704,7 +704,7 @@ int ARM7i_Thumb_Step()
 					break;
 				case 0x2:
 				case 0x3:
-					readword = arm7_read_32( ( R15 & ~2 ) + 4 + ( ( insn & THUMB_INSN_IMM ) << 2 ) );
+					readword = arm7_read_32( cpu, ( R15 & ~2 ) + 4 + ( ( insn & THUMB_INSN_IMM ) << 2 ) );
 					SET_REGISTER( ( insn & THUMB_INSN_IMM_RD ) >> THUMB_INSN_IMM_RD_SHIFT, readword );
 					R15 += 2;
 					break;
@@ -722,7 +722,7 @@ int ARM7i_Thumb_Step()
 					rn = ( insn & THUMB_GROUP5_RN ) >> THUMB_GROUP5_RN_SHIFT;
 					rd = ( insn & THUMB_GROUP5_RD ) >> THUMB_GROUP5_RD_SHIFT;
 					addr = GET_REGISTER(rn) + GET_REGISTER(rm);
-					arm7_write_32( addr, GET_REGISTER(rd) );
+					arm7_write_32( cpu, addr, GET_REGISTER(rd) );
 					R15 += 2;
 					break;
 				case 0x1: /* STRH Rd, [Rn, Rm] */
@@ -730,7 +730,7 @@ int ARM7i_Thumb_Step()
 					rn = ( insn & THUMB_GROUP5_RN ) >> THUMB_GROUP5_RN_SHIFT;
 					rd = ( insn & THUMB_GROUP5_RD ) >> THUMB_GROUP5_RD_SHIFT;
 					addr = GET_REGISTER(rn) + GET_REGISTER(rm);
-					arm7_write_16( addr, GET_REGISTER(rd) );
+					arm7_write_16( cpu, addr, GET_REGISTER(rd) );
 					R15 += 2;
 					break;
 				case 0x2: /* STRB Rd, [Rn, Rm] */
@@ -738,7 +738,7 @@ int ARM7i_Thumb_Step()
  					rn = ( insn & THUMB_GROUP5_RN ) >> THUMB_GROUP5_RN_SHIFT;
 					rd = ( insn & THUMB_GROUP5_RD ) >> THUMB_GROUP5_RD_SHIFT;
  					addr = GET_REGISTER(rn) + GET_REGISTER(rm);
- 					arm7_write_8( addr, GET_REGISTER(rd) );
+ 					arm7_write_8( cpu, addr, GET_REGISTER(rd) );
 					R15 += 2;
 					break;
 				case 0x3: /* LDSB Rd, [Rn, Rm] todo, add dasm */
@@ -746,7 +746,7 @@ int ARM7i_Thumb_Step()
 					rn = ( insn & THUMB_GROUP5_RN ) >> THUMB_GROUP5_RN_SHIFT;
 					rd = ( insn & THUMB_GROUP5_RD ) >> THUMB_GROUP5_RD_SHIFT;
 					addr = GET_REGISTER(rn) + GET_REGISTER(rm);
-					op2 = arm7_read_8( addr );
+					op2 = arm7_read_8( cpu, addr );
 					if( op2 & 0x00000080 )
 					{
 						op2 |= 0xffffff00;
@@ -759,7 +759,7 @@ int ARM7i_Thumb_Step()
 					rn = ( insn & THUMB_GROUP5_RN ) >> THUMB_GROUP5_RN_SHIFT;
 					rd = ( insn & THUMB_GROUP5_RD ) >> THUMB_GROUP5_RD_SHIFT;
 					addr = GET_REGISTER(rn) + GET_REGISTER(rm);
-					op2 = arm7_read_32( addr );
+					op2 = arm7_read_32( cpu, addr );
 					SET_REGISTER( rd, op2 );
 					R15 += 2;
 					break;
@@ -768,7 +768,7 @@ int ARM7i_Thumb_Step()
 					rn = ( insn & THUMB_GROUP5_RN ) >> THUMB_GROUP5_RN_SHIFT;
 					rd = ( insn & THUMB_GROUP5_RD ) >> THUMB_GROUP5_RD_SHIFT;
 					addr = GET_REGISTER(rn) + GET_REGISTER(rm);
-					op2 = arm7_read_16( addr );
+					op2 = arm7_read_16( cpu, addr );
 					SET_REGISTER( rd, op2 );
 					R15 += 2;
 					break;
@@ -778,7 +778,7 @@ int ARM7i_Thumb_Step()
 					rn = ( insn & THUMB_GROUP5_RN ) >> THUMB_GROUP5_RN_SHIFT;
 					rd = ( insn & THUMB_GROUP5_RD ) >> THUMB_GROUP5_RD_SHIFT;
 					addr = GET_REGISTER(rn) + GET_REGISTER(rm);
-					op2 = arm7_read_8( addr );
+					op2 = arm7_read_8( cpu, addr );
 					SET_REGISTER( rd, op2 );
 					R15 += 2;
 					break;
@@ -787,7 +787,7 @@ int ARM7i_Thumb_Step()
 					rn = ( insn & THUMB_GROUP5_RN ) >> THUMB_GROUP5_RN_SHIFT;
 					rd = ( insn & THUMB_GROUP5_RD ) >> THUMB_GROUP5_RD_SHIFT;
 					addr = GET_REGISTER(rn) + GET_REGISTER(rm);
-					op2 = arm7_read_16( addr );
+					op2 = arm7_read_16( cpu, addr );
 					if( op2 & 0x00008000 )
 					{
 						op2 |= 0xffff0000;
@@ -807,7 +807,7 @@ int ARM7i_Thumb_Step()
 				rn = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 				rd = insn & THUMB_ADDSUB_RD;
 				offs = ( ( insn & THUMB_LSOP_OFFS ) >> THUMB_LSOP_OFFS_SHIFT ) << 2;
-				SET_REGISTER( rd, arm7_read_32(GET_REGISTER(rn) + offs) ); // fix
+				SET_REGISTER( rd, arm7_read_32(cpu, GET_REGISTER(rn) + offs) ); // fix
 				R15 += 2;
 			}
 			else /* Store */
@@ -815,7 +815,7 @@ int ARM7i_Thumb_Step()
 				rn = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 				rd = insn & THUMB_ADDSUB_RD;
 				offs = ( ( insn & THUMB_LSOP_OFFS ) >> THUMB_LSOP_OFFS_SHIFT ) << 2;
-				arm7_write_32( GET_REGISTER(rn) + offs, GET_REGISTER(rd) );
+				arm7_write_32( cpu, GET_REGISTER(rn) + offs, GET_REGISTER(rd) );
 				R15 += 2;
 			}
 			break;
@@ -825,7 +825,7 @@ int ARM7i_Thumb_Step()
 				rn = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 				rd = insn & THUMB_ADDSUB_RD;
 				offs = ( insn & THUMB_LSOP_OFFS ) >> THUMB_LSOP_OFFS_SHIFT;
-				SET_REGISTER( rd, arm7_read_8( GET_REGISTER(rn) + offs ) );
+				SET_REGISTER( rd, arm7_read_8( cpu, GET_REGISTER(rn) + offs ) );
 				R15 += 2;
 			}
 			else /* Store */
@@ -833,7 +833,7 @@ int ARM7i_Thumb_Step()
 				rn = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 				rd = insn & THUMB_ADDSUB_RD;
 				offs = ( insn & THUMB_LSOP_OFFS ) >> THUMB_LSOP_OFFS_SHIFT;
-				arm7_write_8( GET_REGISTER(rn) + offs, GET_REGISTER(rd) );
+				arm7_write_8( cpu, GET_REGISTER(rn) + offs, GET_REGISTER(rd) );
 				R15 += 2;
 			}
 			break;
@@ -843,7 +843,7 @@ int ARM7i_Thumb_Step()
 				imm = ( insn & THUMB_HALFOP_OFFS ) >> THUMB_HALFOP_OFFS_SHIFT;
 				rs = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 				rd = ( insn & THUMB_ADDSUB_RD ) >> THUMB_ADDSUB_RD_SHIFT;
-				SET_REGISTER( rd, arm7_read_16( GET_REGISTER(rs) + ( imm << 1 ) ) );
+				SET_REGISTER( rd, arm7_read_16( cpu, GET_REGISTER(rs) + ( imm << 1 ) ) );
 				R15 += 2;
 			}
 			else /* Store */
@@ -851,7 +851,7 @@ int ARM7i_Thumb_Step()
 				imm = ( insn & THUMB_HALFOP_OFFS ) >> THUMB_HALFOP_OFFS_SHIFT;
 				rs = ( insn & THUMB_ADDSUB_RS ) >> THUMB_ADDSUB_RS_SHIFT;
 				rd = ( insn & THUMB_ADDSUB_RD ) >> THUMB_ADDSUB_RD_SHIFT;
-				arm7_write_16( GET_REGISTER(rs) + ( imm << 1 ), GET_REGISTER(rd) );
+				arm7_write_16( cpu, GET_REGISTER(rs) + ( imm << 1 ), GET_REGISTER(rd) );
 				R15 += 2;
 			}
 			break;
@@ -860,7 +860,7 @@ int ARM7i_Thumb_Step()
 			{
 				rd = ( insn & THUMB_STACKOP_RD ) >> THUMB_STACKOP_RD_SHIFT;
 				offs = (UINT8)( insn & THUMB_INSN_IMM );
-				readword = arm7_read_32( GET_REGISTER(13) + ( (UINT32)offs << 2 ) );
+				readword = arm7_read_32( cpu, GET_REGISTER(13) + ( (UINT32)offs << 2 ) );
 				SET_REGISTER( rd, readword );
 				R15 += 2;
 			}
@@ -868,7 +868,7 @@ int ARM7i_Thumb_Step()
 			{
 				rd = ( insn & THUMB_STACKOP_RD ) >> THUMB_STACKOP_RD_SHIFT;
 				offs = (UINT8)( insn & THUMB_INSN_IMM );
-				arm7_write_32( GET_REGISTER(13) + ( (UINT32)offs << 2 ), GET_REGISTER(rd) );
+				arm7_write_32( cpu, GET_REGISTER(13) + ( (UINT32)offs << 2 ), GET_REGISTER(rd) );
 				R15 += 2;
 			}
 			break;
@@ -903,20 +903,20 @@ int ARM7i_Thumb_Step()
 						if( insn & ( 1 << offs ) )
 						{
 							SET_REGISTER( 13, GET_REGISTER(13) - 4 );
-							arm7_write_32( GET_REGISTER(13), GET_REGISTER(offs) );
+							arm7_write_32( cpu, GET_REGISTER(13), GET_REGISTER(offs) );
 						}
 					}
 					R15 += 2;
 					break;
 				case 0x5: /* PUSH {Rlist}{LR} */
 					SET_REGISTER( 13, GET_REGISTER(13) - 4 );
-					arm7_write_32( GET_REGISTER(13), GET_REGISTER(14) );
+					arm7_write_32( cpu, GET_REGISTER(13), GET_REGISTER(14) );
 					for( offs = 7; offs >= 0; offs-- )
 					{
 						if( insn & ( 1 << offs ) )
 						{
 							SET_REGISTER( 13, GET_REGISTER(13) - 4 );
-							arm7_write_32( GET_REGISTER(13), GET_REGISTER(offs) );
+							arm7_write_32( cpu, GET_REGISTER(13), GET_REGISTER(offs) );
 						}
 					}
 					R15 += 2;
@@ -926,7 +926,7 @@ int ARM7i_Thumb_Step()
 					{
 						if( insn & ( 1 << offs ) )
 						{
-							SET_REGISTER( offs, arm7_read_32( GET_REGISTER(13) ) );
+							SET_REGISTER( offs, arm7_read_32( cpu, GET_REGISTER(13) ) );
 							SET_REGISTER( 13, GET_REGISTER(13) + 4 );
 						}
 					}
@@ -937,11 +937,11 @@ int ARM7i_Thumb_Step()
 					{
 						if( insn & ( 1 << offs ) )
 						{
-							SET_REGISTER( offs, arm7_read_32( GET_REGISTER(13) ) );
+							SET_REGISTER( offs, arm7_read_32( cpu, GET_REGISTER(13) ) );
 							SET_REGISTER( 13, GET_REGISTER(13) + 4 );
 						}
 					}
-					R15 = arm7_read_32( GET_REGISTER(13) ) & ~1;
+					R15 = arm7_read_32( cpu, GET_REGISTER(13) ) & ~1;
 					SET_REGISTER( 13, GET_REGISTER(13) + 4 );
 					break;
 				default:
@@ -958,7 +958,7 @@ int ARM7i_Thumb_Step()
 				{
 					if( insn & ( 1 << offs ) )
 					{
-						SET_REGISTER( offs, arm7_read_32( (GET_REGISTER(rd)&0xfffffffc) ) );
+						SET_REGISTER( offs, arm7_read_32( cpu, (GET_REGISTER(rd)&0xfffffffc) ) );
 						SET_REGISTER( rd, GET_REGISTER(rd) + 4 );
 					}
 				}
@@ -971,7 +971,7 @@ int ARM7i_Thumb_Step()
 				{
 					if( insn & ( 1 << offs ) )
 					{
-						arm7_write_32( (GET_REGISTER(rd)&0xfffffffc), GET_REGISTER(offs) );
+						arm7_write_32( cpu, (GET_REGISTER(rd)&0xfffffffc), GET_REGISTER(offs) );
 						SET_REGISTER( rd, GET_REGISTER(rd) + 4 );
 					}
 				}
@@ -102,16 +102,16 @@ enum
     COND_NV         /* never */
 };
 
-#define GET_CPSR	ARM7.Rx [ARM7_CPSR]
+#define GET_CPSR	cpu->Rx [ARM7_CPSR]
 
-#define GET_REGISTER(r) ARM7.Rx[(r)]
-#define SET_REGISTER(r, v) ARM7.Rx[(r)] = (v)
+#define GET_REGISTER(r) cpu->Rx[(r)]
+#define SET_REGISTER(r, v) cpu->Rx[(r)] = (v)
 
-#define R15 ARM7.Rx[ARM7_PC]
+#define R15 cpu->Rx[ARM7_PC]
 
 
 // public function
-int ARM7i_Thumb_Step(void);
+int ARM7i_Thumb_Step(struct sARM7 *cpu);
 
 #endif
 
@@ -12,15 +12,14 @@
 #include "arm7core.h"
 #endif
 
-uint8 dc_ram[8*1024*1024];
-
-
-static void aica_irq(int irq)
+static void aica_irq(void *param, int irq)
 {
+	struct dc_hw *hw = param;
+
 	if (irq > 0)
 	{
 		#if DK_CORE
-		ARM7_SetFIQ(TRUE);
+		ARM7_SetFIQ(&hw->cpu, TRUE);
 		#else
 		set_irq_line(ARM7_FIRQ_LINE, 1);
 		#endif
@@ -28,7 +27,7 @@ static void aica_irq(int irq)
 	else
 	{
 		#if DK_CORE
-		ARM7_SetFIQ(FALSE);
+		ARM7_SetFIQ(&hw->cpu, FALSE);
 		#else
 		set_irq_line(ARM7_FIRQ_LINE, 0);
 		#endif
@@ -40,24 +39,16 @@ static void aica_irq(int irq)
 #define MIXER(level,pan) ((level & 0xff) | ((pan & 0x03) << 8))
 #define YM3012_VOL(LVol,LPan,RVol,RPan) (MIXER(LVol,LPan)|(MIXER(RVol,RPan) << 16))
 
-static struct AICAinterface aica_interface =
-{
-	1,
-	{ dc_ram, },
-	{ YM3012_VOL(100, MIXER_PAN_LEFT, 100, MIXER_PAN_RIGHT) },
-	{ aica_irq, },
-};
-
-uint8 dc_read8(int addr)
+uint8 dc_read8(struct dc_hw *hw, int addr)
 {
 	if (addr < 0x800000)
 	{
-		return dc_ram[addr];
+		return hw->dc_ram[addr];
 	}
 
 	if ((addr >= 0x800000) && (addr <= 0x807fff))
 	{
-		int foo = AICA_0_r((addr-0x800000)/2, 0);
+		int foo = AICA_0_r(hw->aica, (addr-0x800000)/2, 0);
 
 		if (addr & 1)
 		{
@@ -73,48 +64,48 @@ uint8 dc_read8(int addr)
 	return -1;
 }
 
-uint16 dc_read16(int addr)
+uint16 dc_read16(struct dc_hw *hw, int addr)
 {
 	if (addr < 0x800000)
 	{
-		return dc_ram[addr] | (dc_ram[addr+1]<<8);
+		return hw->dc_ram[addr] | (hw->dc_ram[addr+1]<<8);
 	}
 
 	if ((addr >= 0x800000) && (addr <= 0x807fff))
 	{
-		return AICA_0_r((addr-0x800000)/2, 0);
+		return AICA_0_r(hw->aica, (addr-0x800000)/2, 0);
 	}
 
 	printf("R16 @ %x\n", addr);
 	return -1;
 }
 
-uint32 dc_read32(int addr)
+uint32 dc_read32(struct dc_hw *hw, int addr)
 {
 	if (addr < 0x800000)
 	{
 #ifdef LITTLE_ENDIAN
-		return *((uint32*)(dc_ram+addr));
+		return *((uint32*)(hw->dc_ram+addr));
 #else
-		return dc_ram[addr] | (dc_ram[addr+1]<<8) | (dc_ram[addr+2]<<16) | (dc_ram[addr+3]<<24);
+		return hw->dc_ram[addr] | (hw->dc_ram[addr+1]<<8) | (hw->dc_ram[addr+2]<<16) | (hw->dc_ram[addr+3]<<24);
 #endif
 	}
 
 	if ((addr >= 0x800000) && (addr <= 0x807fff))
 	{
 		addr &= 0x7fff;
-		return AICA_0_r(addr/2, 0) & 0xffff;
+		return AICA_0_r(hw->aica, addr/2, 0) & 0xffff;
 	}
 
 //	printf("R32 @ %x\n", addr);
 	return 0;
 }
 
-void dc_write8(int addr, uint8 data)
+void dc_write8(struct dc_hw *hw, int addr, uint8 data)
 {
 	if (addr < 0x800000)
 	{
-		dc_ram[addr] = data;
+		hw->dc_ram[addr] = data;
 		return;
 	}
 
@@ -122,49 +113,49 @@ void dc_write8(int addr, uint8 data)
 	{
 		addr -= 0x800000;
 		if ((addr & 1))
-			AICA_0_w(addr>>1, data<<8, 0x00ff);
+			AICA_0_w(hw->aica, addr>>1, data<<8, 0x00ff);
 		else
-			AICA_0_w(addr>>1, data, 0xff00);
+			AICA_0_w(hw->aica, addr>>1, data, 0xff00);
 		return;
 	}
 
 	printf("W8 %x @ %x\n", data, addr);
 }
 
-void dc_write16(int addr, uint16 data)
+void dc_write16(struct dc_hw *hw, int addr, uint16 data)
 {
 	if (addr < 0x800000)
 	{
-		dc_ram[addr] = data&0xff;
-		dc_ram[addr+1] = (data>>8) & 0xff;
+		hw->dc_ram[addr] = data&0xff;
+		hw->dc_ram[addr+1] = (data>>8) & 0xff;
 		return;
 	}
 
 	if ((addr >= 0x800000) && (addr <= 0x807fff))
 	{
-		AICA_0_w((addr-0x800000)/2, data, 0);
+		AICA_0_w(hw->aica, (addr-0x800000)/2, data, 0);
 		return;
 	}
 
 	printf("W16 %x @ %x\n", data, addr);
 }
 
-void dc_write32(int addr, uint32 data)
+void dc_write32(struct dc_hw *hw, int addr, uint32 data)
 {
 	if (addr < 0x800000)
 	{
-		dc_ram[addr] = data&0xff;
-		dc_ram[addr+1] = (data>>8) & 0xff;
-		dc_ram[addr+2] = (data>>16) & 0xff;
-		dc_ram[addr+3] = (data>>24) & 0xff;
+		hw->dc_ram[addr] = data&0xff;
+		hw->dc_ram[addr+1] = (data>>8) & 0xff;
+		hw->dc_ram[addr+2] = (data>>16) & 0xff;
+		hw->dc_ram[addr+3] = (data>>24) & 0xff;
 		return;
 	}
 
 	if ((addr >= 0x800000) && (addr <= 0x807fff))
 	{
 		addr -= 0x800000;
-		AICA_0_w((addr>>1), data&0xffff, 0x0000);
-		AICA_0_w((addr>>1)+1, data>>16, 0x0000);
+		AICA_0_w(hw->aica, (addr>>1), data&0xffff, 0x0000);
+		AICA_0_w(hw->aica, (addr>>1)+1, data>>16, 0x0000);
 		return;
 	}
 
@@ -172,10 +163,29 @@ void dc_write32(int addr, uint32 data)
 }
 
 void *aica_start(const void *config);
+void aica_stop(void *chip);
 
-void dc_hw_init(void)
+void dc_hw_init(struct dc_hw *hw)
 {
-	aica_interface.region[0] = dc_ram;
-	aica_start(&aica_interface);
+	struct AICAinterface aica_interface =
+	{
+		1,
+		{ hw->dc_ram, },
+		{ YM3012_VOL(100, MIXER_PAN_LEFT, 100, MIXER_PAN_RIGHT) },
+		{ aica_irq, },
+		{ hw, },
+	};
+
+	hw->cpu.dc = hw;
+	hw->aica = aica_start(&aica_interface);
+}
+
+void dc_hw_free(struct dc_hw *hw)
+{
+	if (hw->aica)
+	{
+		aica_stop(hw->aica);
+		hw->aica = NULL;
+	}
 }
 
@@ -1,9 +1,18 @@
 #ifndef _DC_HW_H_
 #define _DC_HW_H_
 
-extern uint8 dc_ram[8*1024*1024];
+#include "arm7.h"
 
-void dc_hw_init(void);
+// Dreamcast sound board: the ARM7, the AICA and the RAM they share
+struct dc_hw
+{
+	uint8 dc_ram[8*1024*1024];
+	struct sARM7 cpu;
+	void *aica;
+};
+
+void dc_hw_init(struct dc_hw *hw);
+void dc_hw_free(struct dc_hw *hw);
 
 #endif
 
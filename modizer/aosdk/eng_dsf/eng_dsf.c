@@ -31,16 +31,22 @@ unsigned char aosdk_dsf_22khz=1;
 #include "arm7core.h"
 #endif
 
-static corlett_t	*c = NULL;
-static char 		psfby[256];
-static uint32		decaybegin, decayend, total_samples;
+typedef struct
+{
+	corlett_t	*c;
+	char 		psfby[256];
+	uint32		decaybegin, decayend, total_samples;
+
+	struct dc_hw	hw;
+} dsf_synth_t;
 
-void *aica_start(const void *config);
 void AICA_Update(void *param, INT16 **inputs, INT16 **buf, int samples);
 void AICA_Update22khz(void *param, INT16 **inputs, INT16 **buf, int samples);
 
-int32 dsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultlength)
+void *dsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultlength)
 {
+	dsf_synth_t *s;
+	corlett_t *c;
 	uint8 *file, *lib_decoded, *lib_raw_file;
 	uint32 offset, plength, lengthMS, fadeMS;
 	uint64 file_len, lib_len, lib_raw_length;
@@ -48,14 +54,20 @@ int32 dsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 	char *libfile;
 	int i;
 
-	// clear Dreamcast work RAM before we start scribbling in it
-	memset(dc_ram, 0, 8*1024*1024);
+	// the Dreamcast work RAM is cleared before we start scribbling in it
+	s = calloc(1, sizeof(dsf_synth_t));
+	if (!s)
+	{
+		return NULL;
+	}
 
 	// Decode the current DSF
-	if (corlett_decode(buffer, length, &file, &file_len, &c) != AO_SUCCESS)
+	if (corlett_decode(buffer, length, &file, &file_len, &s->c) != AO_SUCCESS)
 	{
-		return AO_FAIL;
+		dsf_stop(s);
+		return NULL;
 	}
+	c = s->c;
 
 	#if DEBUG_LOADER
 	printf("%d bytes decoded\n", file_len);
@@ -73,14 +85,18 @@ int32 dsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 			#endif
 			if (ao_get_lib(libfile, &lib_raw_file, &tmp_length) != AO_SUCCESS)
 			{
-				return AO_FAIL;
+				free(file);
+				dsf_stop(s);
+				return NULL;
 			}
 			lib_raw_length = tmp_length;
 		
 			if (corlett_decode(lib_raw_file, lib_raw_length, &lib_decoded, &lib_len, &lib) != AO_SUCCESS)
 			{
 				free(lib_raw_file);
-				return AO_FAIL;
+				free(file);
+				dsf_stop(s);
+				return NULL;
 			}
 				
 			// Free up raw file
@@ -88,7 +104,7 @@ int32 dsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 
 			// patch the file into ram
 			offset = lib_decoded[0] | lib_decoded[1]<<8 | lib_decoded[2]<<16 | lib_decoded[3]<<24;
-			memcpy(&dc_ram[offset], lib_decoded+4, lib_len-4);
+			memcpy(&s->hw.dc_ram[offset], lib_decoded+4, lib_len-4);
 
 			// Dispose the corlett structure for the lib - we don't use it
 			free(lib);
@@ -97,18 +113,18 @@ int32 dsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 
 	// now patch the file into RAM over the libraries
 	offset = file[3]<<24 | file[2]<<16 | file[1]<<8 | file[0];
-	memcpy(&dc_ram[offset], file+4, file_len-4);
+	memcpy(&s->hw.dc_ram[offset], file+4, file_len-4);
 
 	free(file);
 	
 	// Finally, set psfby/ssfby tag
-	strcpy(psfby, "n/a");
+	strcpy(s->psfby, "n/a");
 	if (c)
 	{
 		for (i = 0; i < MAX_UNKNOWN_TAGS; i++)
 		{
 			if ((!strcasecmp(c->tag_name[i], "psfby")) || (!strcasecmp(c->tag_name[i], "ssfby")))
-				strcpy(psfby, c->tag_data[i]);
+				strcpy(s->psfby, c->tag_data[i]);
 		}
 	}
 
@@ -117,23 +133,28 @@ int32 dsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 		FILE *f;
 
 		f = fopen("dcram.bin", "wb");
-		fwrite(dc_ram, 2*1024*1024, 1, f);
+		fwrite(s->hw.dc_ram, 2*1024*1024, 1, f);
 		fclose(f);
 	}
 	#endif
 
 	#if DK_CORE
-	ARM7_Init();
+	ARM7_Init(&s->hw.cpu);
 	#else
 	arm7_init(0, 45000000, NULL, NULL);
 	arm7_reset();
 	#endif
-	dc_hw_init();
+	dc_hw_init(&s->hw);
+	if (!s->hw.aica)
+	{
+		dsf_stop(s);
+		return NULL;
+	}
 
 	// now figure out the time in samples for the length/fade
 	lengthMS = psfTimeToMS(c->inf_length);
 	fadeMS = psfTimeToMS(c->inf_fade);
-	total_samples = 0;
+	s->total_samples = 0;
     
 	if (lengthMS == 0) {
         lengthMS=defaultlength-10000;
@@ -148,22 +169,25 @@ int32 dsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 
 	if (lengthMS == ~0)
 	{
-		decaybegin = lengthMS;
+		s->decaybegin = lengthMS;
 	}
 	else
 	{
 		lengthMS = (lengthMS * 441) / 10;
 		fadeMS = (fadeMS * 441) / 10;
 
-		decaybegin = lengthMS;
-		decayend = lengthMS + fadeMS;
+		s->decaybegin = lengthMS;
+		s->decayend = lengthMS + fadeMS;
 	}
 
-	return AO_SUCCESS;
+	return s;
 }
 
-int32 dsf_gen(int16 *buffer, uint32 samples)
+int32 dsf_gen(void *handle, int16 *buffer, uint32 samples)
 {	
+	dsf_synth_t *s = handle;
+	uint32 total_samples = s->total_samples;
+	uint32 decaybegin = s->decaybegin, decayend = s->decayend;
 	int i;
 	int16 output[44100/30], output2[44100/30];
 	int16 *stereo[2];
@@ -178,13 +202,13 @@ int32 dsf_gen(int16 *buffer, uint32 samples)
         for (i = 0; i < samples; i+=cycle_ratio)
         {
 #if DK_CORE
-            ARM7_Execute((33000000 / 60 / 4) / 735 *cycle_ratio);
+            ARM7_Execute(&s->hw.cpu, (33000000 / 60 / 4) / 735 *cycle_ratio);
 #else
             arm7_execute((33000000 / 60 / 4) / 735 *cycle_ratio);
 #endif
             stereo[0] = &output[opos];
             stereo[1] = &output2[opos];
-            AICA_Update(NULL, NULL, stereo, cycle_ratio);
+            AICA_Update(s->hw.aica, NULL, stereo, cycle_ratio);
             opos+=cycle_ratio;
         }
         
@@ -224,13 +248,13 @@ int32 dsf_gen(int16 *buffer, uint32 samples)
         for (i = 0; i < samples; i+=(cycle_ratio<<1))
         {
 #if DK_CORE
-            ARM7_Execute((33000000 / 60 / 4) / 735 *cycle_ratio*2);
+            ARM7_Execute(&s->hw.cpu, (33000000 / 60 / 4) / 735 *cycle_ratio*2);
 #else
             arm7_execute((33000000 / 60 / 4) / 735 *cycle_ratio*2);
 #endif
             stereo[0] = &output[opos];
             stereo[1] = &output2[opos];
-            AICA_Update22khz(NULL, NULL, stereo, cycle_ratio);
+            AICA_Update22khz(s->hw.aica, NULL, stereo, cycle_ratio);
             opos+=(cycle_ratio<<1);
         }
         
@@ -274,16 +298,22 @@ int32 dsf_gen(int16 *buffer, uint32 samples)
 
         }
     }
+    s->total_samples = total_samples;
     if (shouldExit)return AO_FAIL;
 	return AO_SUCCESS;
 }
 
-int32 dsf_stop(void)
+int32 dsf_stop(void *handle)
 {
+	dsf_synth_t *s = handle;
+
+	dc_hw_free(&s->hw);
+	free(s->c);
+	free(s);
 	return AO_SUCCESS;
 }
 
-int32 dsf_command(int32 command, int32 parameter)
+int32 dsf_command(void *handle, int32 command, int32 parameter)
 {
 	switch (command)
 	{
@@ -294,8 +324,11 @@ int32 dsf_command(int32 command, int32 parameter)
 	return AO_FAIL;
 }
 
-int32 dsf_fill_info(ao_display_info *info)
+int32 dsf_fill_info(void *handle, ao_display_info *info)
 {
+	dsf_synth_t *s = handle;
+	corlett_t *c = s->c;
+
 	if (c == NULL)
 		return AO_FAIL;
 		
@@ -321,7 +354,7 @@ int32 dsf_fill_info(ao_display_info *info)
 	sprintf(info->info[7], "%s", c->inf_fade);
 
 	strcpy(info->title[8], "Ripper: ");
-	sprintf(info->info[8], "%s", psfby);
+	sprintf(info->info[8], "%s", s->psfby);
 	
 	info->length_ms=psfTimeToMS(c->inf_length);
 	info->fade_ms=psfTimeToMS(c->inf_fade);
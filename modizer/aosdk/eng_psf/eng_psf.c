@@ -44,31 +44,27 @@
 
 #define DEBUG_LOADER	(0)
 
-static corlett_t	*c = NULL;
-static char 		psfby[256];
-char			*spu_pOutput;
-int			psf_refresh  = -1;
-
-
-// main RAM
-extern uint32 psx_ram[((2*1024*1024)/4)+4];
-extern uint32 psx_scratch[0x400];
-extern uint32 initial_ram[((2*1024*1024)/4)+4];
-extern uint32 initial_scratch[0x400];
-static uint32 initialPC, initialGP, initialSP;
-
-extern void mips_init( void );
-extern void mips_reset( void *param );
-extern int mips_execute( int cycles );
-extern void mips_set_info(UINT32 state, union cpuinfo *info);
-extern void psx_hw_init(void);
-extern void psx_hw_slice(void);
-extern void psx_hw_sliceXX(void);
-extern void psx_hw_frame(void);
-extern void setlength(int32 stop, int32 fade);
-
-int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultlength)
+typedef struct
 {
+	corlett_t *c;
+	char psfby[256];
+	mips_cpu_context *cpu;		// CPU, hardware, RAM and SPU state
+	uint32 initialPC, initialGP, initialSP;
+} psf_synth_t;
+
+extern void mips_init( mips_cpu_context *cpu );
+extern void mips_reset( mips_cpu_context *cpu, void *param );
+extern int mips_execute( mips_cpu_context *cpu, int cycles );
+extern void mips_set_info(mips_cpu_context *cpu, UINT32 state, union cpuinfo *info);
+extern void psx_hw_init(mips_cpu_context *cpu);
+extern void psx_hw_slice(mips_cpu_context *cpu);
+extern void psx_hw_frame(mips_cpu_context *cpu);
+
+void *psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultlength)
+{
+	psf_synth_t *s;
+	mips_cpu_context *cpu;
+	corlett_t *c;
 	uint8 *file, *lib_decoded, *lib_raw_file, *alib_decoded;
 	uint32 offset, plength, PC, SP, GP, lengthMS, fadeMS;
 	uint64 file_len, lib_len, lib_raw_length, alib_len;
@@ -76,23 +72,38 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 	int i;
 	union cpuinfo mipsinfo;
 
-	// clear PSX work RAM before we start scribbling in it
-	memset(psx_ram, 0, 2*1024*1024);
+	// PSX work RAM starts out cleared
+	s = calloc(1, sizeof(psf_synth_t));
+	if (!s)
+	{
+		return NULL;
+	}
+	s->cpu = cpu = calloc(1, sizeof(mips_cpu_context));
+	if (!cpu)
+	{
+		psf_stop(s);
+		return NULL;
+	}
+	cpu->psf_refresh = -1;
 
 //	printf("Length = %d\n", length);
 
 	// Decode the current GSF
-	if (corlett_decode(buffer, length, &file, &file_len, &c) != AO_SUCCESS)
+	if (corlett_decode(buffer, length, &file, &file_len, &s->c) != AO_SUCCESS)
 	{
-		return AO_FAIL;
+		psf_stop(s);
+		return NULL;
 	}
+	c = s->c;
 
 //	printf("file_len %d reserve %d\n", file_len, c->res_size);
 
 	// check for PSX EXE signature
 	if (strncmp((char *)file, "PS-X EXE", 8))
 	{
-		return AO_FAIL;
+		free(file);
+		psf_stop(s);
+		return NULL;
 	}
 
 	#if DEBUG_LOADER
@@ -106,11 +117,11 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 
 	if (c->inf_refresh[0] == '5')
 	{
-		psf_refresh = 50;
+		cpu->psf_refresh = 50;
 	}
 	if (c->inf_refresh[0] == '6')
 	{
-		psf_refresh = 60;
+		cpu->psf_refresh = 60;
 	}
 
 	PC = file[0x10] | file[0x11]<<8 | file[0x12]<<16 | file[0x13]<<24;
@@ -131,14 +142,18 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 		#endif
 		if (ao_get_lib(c->lib, &lib_raw_file, &tmp_length) != AO_SUCCESS)
 		{
-			return AO_FAIL;
+			free(file);
+			psf_stop(s);
+			return NULL;
 		}
 		lib_raw_length = tmp_length;
 		
 		if (corlett_decode(lib_raw_file, lib_raw_length, &lib_decoded, &lib_len, &lib) != AO_SUCCESS)
 		{
 			free(lib_raw_file);
-			return AO_FAIL;
+			free(file);
+			psf_stop(s);
+			return NULL;
 		}
 				
 		// Free up raw file
@@ -148,7 +163,9 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 		{
 			printf("Major error!  PSF was OK, but referenced library is not!\n");
 			free(lib);
-			return AO_FAIL;
+			free(file);
+			psf_stop(s);
+			return NULL;
 		}
 
 		#if DEBUG_LOADER	
@@ -161,15 +178,15 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 		#endif
 
 		// if the original file had no refresh tag, give the lib a shot
-		if (psf_refresh == -1)
+		if (cpu->psf_refresh == -1)
 		{
 			if (lib->inf_refresh[0] == '5')
 			{
-				psf_refresh = 50;
+				cpu->psf_refresh = 50;
 			}
 			if (lib->inf_refresh[0] == '6')
 			{
-				psf_refresh = 60;
+				cpu->psf_refresh = 60;
 			}
 		}
 
@@ -188,7 +205,7 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 		#if DEBUG_LOADER
 		printf("library offset: %x plength: %d\n", offset, plength);
 		#endif
-		memcpy(&psx_ram[offset/4], lib_decoded+2048, plength);
+		memcpy(&cpu->psx_ram[offset/4], lib_decoded+2048, plength);
 		
 		// Dispose the corlett structure for the lib - we don't use it
 		free(lib);
@@ -204,7 +221,7 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 	{
 		plength = file_len-2048;
 	}
-	memcpy(&psx_ram[offset/4], file+2048, plength);
+	memcpy(&cpu->psx_ram[offset/4], file+2048, plength);
 
 	// load any auxiliary libraries now
 	for (i = 0; i < 8; i++)
@@ -219,14 +236,18 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 
 			if (ao_get_lib(c->libaux[i], &lib_raw_file, &tmp_length) != AO_SUCCESS)
 			{
-				return AO_FAIL;
+				free(file);
+				psf_stop(s);
+				return NULL;
 			}
 			lib_raw_length = tmp_length;
 		
 			if (corlett_decode(lib_raw_file, lib_raw_length, &alib_decoded, &alib_len, &lib) != AO_SUCCESS)
 			{
 				free(lib_raw_file);
-				return AO_FAIL;
+				free(file);
+				psf_stop(s);
+				return NULL;
 			}
 				
 			// Free up raw file
@@ -236,7 +257,9 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 			{
 				printf("Major error!  PSF was OK, but referenced library is not!\n");
 				free(lib);
-				return AO_FAIL;
+				free(file);
+				psf_stop(s);
+				return NULL;
 			}
 
 			#if DEBUG_LOADER	
@@ -251,7 +274,7 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 			offset = alib_decoded[0x18] | alib_decoded[0x19]<<8 | alib_decoded[0x1a]<<16 | alib_decoded[0x1b]<<24;
 			offset &= 0x3fffffff;	// kill any MIPS cache segment indicators
 			plength = alib_decoded[0x1c] | alib_decoded[0x1d]<<8 | alib_decoded[0x1e]<<16 | alib_decoded[0x1f]<<24;
-			memcpy(&psx_ram[offset/4], alib_decoded+2048, plength);
+			memcpy(&cpu->psx_ram[offset/4], alib_decoded+2048, plength);
 		
 			// Dispose the corlett structure for the lib - we don't use it
 			free(lib);
@@ -262,27 +285,27 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 //	free(lib_decoded);
 	
 	// Finally, set psfby tag
-	strcpy(psfby, "n/a");
+	strcpy(s->psfby, "n/a");
 	if (c)
 	{
 		int i;
 		for (i = 0; i < MAX_UNKNOWN_TAGS; i++)
 		{
 			if (!strcasecmp(c->tag_name[i], "psfby"))
-				strcpy(psfby, c->tag_data[i]);
+				strcpy(s->psfby, c->tag_data[i]);
 		}
 	}
 
-	mips_init();
-	mips_reset(NULL);
+	mips_init(cpu);
+	mips_reset(cpu, NULL);
 
 	// set the initial PC, SP, GP
 	#if DEBUG_LOADER	
 	printf("Initial PC %x, GP %x, SP %x\n", PC, GP, SP);
-	printf("Refresh = %d\n", psf_refresh);
+	printf("Refresh = %d\n", cpu->psf_refresh);
 	#endif
 	mipsinfo.i = PC;
-	mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 
 	// set some reasonable default for the stack
 	if (SP == 0)
@@ -291,25 +314,29 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 	}
 
 	mipsinfo.i = SP;
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
 
 	mipsinfo.i = GP;
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_R28, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R28, &mipsinfo);
 
 	#if DEBUG_LOADER && 1
 	{
 		FILE *f;
 
 		f = fopen("psxram.bin", "wb");
-		fwrite(psx_ram, 2*1024*1024, 1, f);
+		fwrite(cpu->psx_ram, 2*1024*1024, 1, f);
 		fclose(f);
 	}
 	#endif
 
-	psx_hw_init();
-	SPUinit();
-	SPUopen();
+	psx_hw_init(cpu);
+	if (SPUinit(cpu) < 0)
+	{
+		psf_stop(s);
+		return NULL;
+	}
+	SPUopen(cpu);
 
 	lengthMS = psfTimeToMS(c->inf_length);
 	fadeMS = psfTimeToMS(c->inf_fade);
@@ -328,7 +355,7 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 		lengthMS = ~0;
 	}
 
-	setlength(lengthMS, fadeMS);
+	setlength(cpu, lengthMS, fadeMS);
 
 	// patch illegal Chocobo Dungeon 2 code - CaitSith2 put a jump in the delay slot from a BNE
 	// and rely on Highly Experimental's buggy-ass CPU to rescue them.  Verified on real hardware
@@ -337,11 +364,11 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 	{
 		if (!strcmp(c->inf_game, "Chocobo Dungeon 2"))
 		{
-			if (psx_ram[0xbc090/4] == LE32(0x0802f040))
+			if (cpu->psx_ram[0xbc090/4] == LE32(0x0802f040))
 			{
-		 		psx_ram[0xbc090/4] = LE32(0);
-				psx_ram[0xbc094/4] = LE32(0x0802f040);
-				psx_ram[0xbc098/4] = LE32(0);
+		 		cpu->psx_ram[0xbc090/4] = LE32(0);
+				cpu->psx_ram[0xbc094/4] = LE32(0x0802f040);
+				cpu->psx_ram[0xbc098/4] = LE32(0);
 			}
 		}
 	}
@@ -349,86 +376,102 @@ int32 psf_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultl
 //	psx_ram[0x118b8/4] = LE32(0);	// crash 2 hack
 
 	// backup the initial state for restart
-	memcpy(initial_ram, psx_ram, 2*1024*1024);
-	memcpy(initial_scratch, psx_scratch, 0x400);
-	initialPC = PC;
-	initialGP = GP;
-	initialSP = SP;
+	memcpy(cpu->initial_ram, cpu->psx_ram, 2*1024*1024);
+	memcpy(cpu->initial_scratch, cpu->psx_scratch, 0x400);
+	s->initialPC = PC;
+	s->initialGP = GP;
+	s->initialSP = SP;
 
-	mips_execute(5000);
+	mips_execute(cpu, 5000);
 	
-	return AO_SUCCESS;
+	return s;
 }
 
-void spu_update(unsigned char* pSound,long lBytes)
+void spu_update(mips_cpu_context *cpu, unsigned char* pSound,long lBytes)
 {
-	if (spu_pOutput) memcpy(spu_pOutput, pSound, lBytes);
+	if (cpu->spu_pOutput) memcpy(cpu->spu_pOutput, pSound, lBytes);
 }
 
-int32 psf_gen(int16 *buffer, uint32 samples)
+int32 psf_gen(void *handle, int16 *buffer, uint32 samples)
 {	
+	psf_synth_t *s = handle;
 	int i;
 	i=0;
 	for (i = 0; i < samples; i++)
 	{
-		psx_hw_slice();
-		SPUasync(384);
+		psx_hw_slice(s->cpu);
+		SPUasync(s->cpu, 384);
 	}
 
-	spu_pOutput = (char *)buffer;
-	SPU_flushboot();
+	s->cpu->spu_pOutput = (char *)buffer;
+	SPU_flushboot(s->cpu);
 
-	psx_hw_frame();
+	psx_hw_frame(s->cpu);
 
 	return AO_SUCCESS;
 }
 
 
-int32 psf_gen_nooutput(int16 *buffer, uint32 samples)
+int32 psf_gen_nooutput(void *handle, int16 *buffer, uint32 samples)
 {	
+	psf_synth_t *s = handle;
 	int i;
 
 	
 	for (i = 0; i < samples; i++)
 	{
-		psx_hw_slice();
-		SPUasync(384);
+		psx_hw_slice(s->cpu);
+		SPUasync(s->cpu, 384);
 	}
 	
-	spu_pOutput = NULL;//(char *)buffer;
-	SPU_flushboot();
+	s->cpu->spu_pOutput = NULL;//(char *)buffer;
+	SPU_flushboot(s->cpu);
 	
-	psx_hw_frame();
+	psx_hw_frame(s->cpu);
 	
 	return AO_SUCCESS;
 }
 
-int32 psf_stop(void)
+int32 psf_stop(void *handle)
 {
-	SPUclose();
-	free(c);
+	psf_synth_t *s = handle;
+
+	if (s->cpu)
+	{
+		if (s->cpu->spu)
+		{
+			SPUclose(s->cpu);
+			SPUshutdown(s->cpu);
+		}
+		free(s->cpu);
+	}
+	free(s->c);
+	free(s);
 
 	return AO_SUCCESS;
 }
 
-int32 psf_command(int32 command, int32 parameter)
+int32 psf_command(void *handle, int32 command, int32 parameter)
 {
+	psf_synth_t *s = handle;
+	mips_cpu_context *cpu = s->cpu;
+	corlett_t *c = s->c;
 	union cpuinfo mipsinfo;
 	uint32 lengthMS, fadeMS;
 
 	switch (command)
 	{
 		case COMMAND_RESTART:
-			SPUclose();
+			SPUclose(cpu);
 
-			memcpy(psx_ram, initial_ram, 2*1024*1024);
-			memcpy(psx_scratch, initial_scratch, 0x400);
+			memcpy(cpu->psx_ram, cpu->initial_ram, 2*1024*1024);
+			memcpy(cpu->psx_scratch, cpu->initial_scratch, 0x400);
 
-			mips_init();
-			mips_reset(NULL);
-			psx_hw_init();
-			SPUinit();
-			SPUopen();
+			mips_init(cpu);
+			mips_reset(cpu, NULL);
+			psx_hw_init(cpu);
+			SPUinit(cpu);
+			SPUopen(cpu);
 
 			lengthMS = psfTimeToMS(c->inf_length);
 			fadeMS = psfTimeToMS(c->inf_fade);
@@ -437,17 +480,17 @@ int32 psf_command(int32 command, int32 parameter)
 			{
 				lengthMS = ~0;
 			}
-			setlength(lengthMS, fadeMS);
+			setlength(cpu, lengthMS, fadeMS);
 
-			mipsinfo.i = initialPC;
-			mips_set_info(CPUINFO_INT_PC, &mipsinfo);
-			mipsinfo.i = initialSP;
-			mips_set_info(CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
-			mips_set_info(CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
-			mipsinfo.i = initialGP;
-			mips_set_info(CPUINFO_INT_REGISTER + MIPS_R28, &mipsinfo);
+			mipsinfo.i = s->initialPC;
+			mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
+			mipsinfo.i = s->initialSP;
+			mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
+			mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
+			mipsinfo.i = s->initialGP;
+			mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R28, &mipsinfo);
 
-			mips_execute(5000);
+			mips_execute(cpu, 5000);
 
 			return AO_SUCCESS;
 		
@@ -455,8 +498,11 @@ int32 psf_command(int32 command, int32 parameter)
 	return AO_FAIL;
 }
 
-int32 psf_fill_info(ao_display_info *info)
+int32 psf_fill_info(void *handle, ao_display_info *info)
 {
+	psf_synth_t *s = handle;
+	corlett_t *c = s->c;
+
 	if (c == NULL)
 		return AO_FAIL;
 		
@@ -482,7 +528,7 @@ int32 psf_fill_info(ao_display_info *info)
 	sprintf(info->info[7], "%s", c->inf_fade);
 
 	strcpy(info->title[8], "Ripper: ");
-	sprintf(info->info[8], "%s", psfby);
+	sprintf(info->info[8], "%s", s->psfby);
 	
 	info->length_ms=psfTimeToMS(c->inf_length);
 	info->fade_ms=psfTimeToMS(c->inf_fade);
@@ -61,40 +61,32 @@
 #include "corlett.h"
 
 #define DEBUG_LOADER	(0)
-#define MAX_FS		(32)	// maximum # of filesystems (libs and subdirectories)
 
 // ELF relocation helpers
 #define ELF32_R_SYM(val)                ((val) >> 8)
 #define ELF32_R_TYPE(val)               ((val) & 0xff)
 
-int ao_song_done;
 int aopsf2_missing_psflib;
 char aopsf2_psflib_str[256];
 
-
-static corlett_t	*c = NULL;
-static char 		psfby[256];
-static char		*spu_pOutput;
-
-// main RAM
-extern uint32 psx_ram[(2*1024*1024)/4];
-extern uint32 initial_ram[(2*1024*1024)/4];
-static uint32 initialPC, initialSP;
-static uint32 loadAddr, lengthMS, fadeMS;
-
-static uint8 *filesys[MAX_FS];
-static uint8 *lib_raw_file;
-static uint32 fssize[MAX_FS];
-static int num_fs;
-
-extern void mips_init( void );
-extern void mips_reset( void *param );
-extern int mips_execute( int cycles );
-extern void mips_set_info(UINT32 state, union cpuinfo *info);
-extern void psx_hw_init(void);
-extern void ps2_hw_slice(void);
-extern void ps2_hw_frame(void);
-extern void setlength2(int32 stop, int32 fade);
+typedef struct
+{
+	corlett_t *c, *lib;
+	char psfby[256];
+	mips_cpu_context *cpu;		// IOP, hardware, RAM, SPU2 and filesystem state
+	uint32 initialPC, initialSP;
+	uint32 lengthMS, fadeMS;
+	uint8 *lib_raw_file;
+} psf2_synth_t;
+
+extern void mips_init( mips_cpu_context *cpu );
+extern void mips_reset( mips_cpu_context *cpu, void *param );
+extern int mips_execute( mips_cpu_context *cpu, int cycles );
+extern void mips_set_info(mips_cpu_context *cpu, UINT32 state, union cpuinfo *info);
+extern void psx_hw_init(mips_cpu_context *cpu);
+extern void ps2_hw_slice(mips_cpu_context *cpu);
+extern void ps2_hw_frame(mips_cpu_context *cpu);
+extern void setlength2(mips_cpu_context *cpu, int32 stop, int32 fade);
 
 static uint32 secname(uint8 *start, uint32 strndx, uint32 shoff, uint32 shentsize, uint32 name)
 {
@@ -130,22 +122,23 @@ static void do_iopmod(uint8 *start, uint32 offset)
 	#endif
 }
 
-uint32 psf2_load_elf(uint8 *start, uint32 len)
+uint32 psf2_load_elf(mips_cpu_context *cpu, uint8 *start, uint32 len)
 {
 	uint32 entry, phoff, shoff, phentsize, shentsize, phnum, shnum, shstrndx;
 	uint32 name, type, flags, addr, offset, size, shent;
 	uint32 totallen;
+	uint32 hi16offs = 0, hi16target = 0;
 	int i, rec;
 //	FILE *f;
 
-	if (loadAddr & 3)
+	if (cpu->loadAddr & 3)
 	{
-		loadAddr &= ~3;
-		loadAddr += 4;
+		cpu->loadAddr &= ~3;
+		cpu->loadAddr += 4;
 	}
 
 	#if DEBUG_LOADER
-	printf("psf2_load_elf: starting at %08x\n", loadAddr | 0x80000000);
+	printf("psf2_load_elf: starting at %08x\n", cpu->loadAddr | 0x80000000);
 	#endif
 
 	if ((start[0] != 0x7f) || (start[1] != 'E') || (start[2] != 'L') || (start[3] != 'F'))
@@ -188,7 +181,7 @@ uint32 psf2_load_elf(uint8 *start, uint32 len)
 				break;
 
 			case 1:			// PROGBITS: copy data to destination
-				memcpy(&psx_ram[(loadAddr + addr)/4], &start[offset], size);
+				memcpy(&cpu->psx_ram[(cpu->loadAddr + addr)/4], &start[offset], size);
 				totallen += size;
 				break;
 
@@ -199,7 +192,7 @@ uint32 psf2_load_elf(uint8 *start, uint32 len)
 				break;
 
 			case 8:			// NOBITS: BSS region, zero out destination
-				memset(&psx_ram[(loadAddr + addr)/4], 0, size);
+				memset(&cpu->psx_ram[(cpu->loadAddr + addr)/4], 0, size);
 				totallen += size;
 				break;
 
@@ -207,25 +200,24 @@ uint32 psf2_load_elf(uint8 *start, uint32 len)
 		  		for (rec = 0; rec < (size/8); rec++)
 				{
 					uint32 offs, info, target, temp, val, vallo;
-					static uint32 hi16offs = 0, hi16target = 0;
 
 					offs = start[offset+(rec*8)] | start[offset+1+(rec*8)]<<8 | start[offset+2+(rec*8)]<<16 | start[offset+3+(rec*8)]<<24;
 					info = start[offset+4+(rec*8)] | start[offset+5+(rec*8)]<<8 | start[offset+6+(rec*8)]<<16 | start[offset+7+(rec*8)]<<24;
-					target = LE32(psx_ram[(loadAddr+offs)/4]);
+					target = LE32(cpu->psx_ram[(cpu->loadAddr+offs)/4]);
 					
 //					printf("[%04d] offs %08x type %02x info %08x => %08x\n", rec, offs, ELF32_R_TYPE(info), ELF32_R_SYM(info), target);
 
 					switch (ELF32_R_TYPE(info))
 					{
 						case 2:	      	// R_MIPS_32
-							target += loadAddr;
+							target += cpu->loadAddr;
 //							target |= 0x80000000;
 							break;
 
 						case 4:		// R_MIPS_26
 							temp = (target & 0x03ffffff);
 							target &= 0xfc000000;
-							temp += (loadAddr>>2);
+							temp += (cpu->loadAddr>>2);
 							target |= temp;
 							break;
 
@@ -238,7 +230,7 @@ uint32 psf2_load_elf(uint8 *start, uint32 len)
 							vallo = ((target & 0xffff) ^ 0x8000) - 0x8000;
 
 							val = ((hi16target & 0xffff) << 16) +	vallo;
-							val += loadAddr;
+							val += cpu->loadAddr;
 //							val |= 0x80000000;
 
 							/* Account for the sign extension that will happen in the low bits.  */
@@ -247,10 +239,10 @@ uint32 psf2_load_elf(uint8 *start, uint32 len)
 							hi16target = (hi16target & ~0xffff) | val;
 
 							/* Ok, we're done with the HI16 relocs.  Now deal with the LO16.  */
-							val = loadAddr + vallo;
+							val = cpu->loadAddr + vallo;
 							target = (target & ~0xffff) | (val & 0xffff);
 
-							psx_ram[(loadAddr+hi16offs)/4] = LE32(hi16target);
+							cpu->psx_ram[(cpu->loadAddr+hi16offs)/4] = LE32(hi16target);
 							break;
 
 						default:
@@ -259,7 +251,7 @@ uint32 psf2_load_elf(uint8 *start, uint32 len)
 							break;
 					}
 
-					psx_ram[(loadAddr+offs)/4] = LE32(target);
+					cpu->psx_ram[(cpu->loadAddr+offs)/4] = LE32(target);
 				}						
 				break;
 
@@ -277,9 +269,9 @@ uint32 psf2_load_elf(uint8 *start, uint32 len)
 		shent += shentsize;
 	}	
 
-	entry += loadAddr;
+	entry += cpu->loadAddr;
 	entry |= 0x80000000;
-	loadAddr += totallen;
+	cpu->loadAddr += totallen;
 
 	#if DEBUG_LOADER
 	printf("psf2_load_elf: entry PC %08x\n", entry);
@@ -365,9 +357,9 @@ static uint32 load_file_ex(uint8 *top, uint8 *start, uint32 len, char *file, uin
 	return 0xffffffff;
 }
 
-static uint32 load_file(int fs, char *file, uint8 *buf, uint32 buflen)
+static uint32 load_file(mips_cpu_context *cpu, int fs, char *file, uint8 *buf, uint32 buflen)
 {
-	return load_file_ex(filesys[fs], filesys[fs], fssize[fs], file, buf, buflen);
+	return load_file_ex(cpu->filesys[fs], cpu->filesys[fs], cpu->fssize[fs], file, buf, buflen);
 }
 
 #if 0
@@ -444,14 +436,14 @@ static dump_files(int fs, uint8 *buf, uint32 buflen)
 #endif
 
 // find a file on our filesystems
-uint32 psf2_load_file(char *file, uint8 *buf, uint32 buflen)
+uint32 psf2_load_file(mips_cpu_context *cpu, char *file, uint8 *buf, uint32 buflen)
 {
 	int i;
 	uint32 flen;
 
-	for (i = 0; i < num_fs; i++)
+	for (i = 0; i < cpu->num_fs; i++)
 	{
-		flen = load_file(i, file, buf, buflen);
+		flen = load_file(cpu, i, file, buf, buflen);
 		if (flen != 0xffffffff)
 		{
 			return flen;
@@ -461,28 +453,42 @@ uint32 psf2_load_file(char *file, uint8 *buf, uint32 buflen)
 	return 0xffffffff;
 }
 
-int32 psf2_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultlength)
+void *psf2_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultlength)
 {
+	psf2_synth_t *s;
+	mips_cpu_context *cpu;
+	corlett_t *c;
 	uint8 *file, *lib_decoded;
 	uint32 irx_len;
 	uint64 file_len, lib_raw_length, lib_len;
 	uint8 *buf;
 	union cpuinfo mipsinfo;
-	corlett_t *lib;
 	
 	aopsf2_missing_psflib=0;
 
-	loadAddr = 0x23f00;	// this value makes allocations work out similarly to how they would 
-				// in Highly Experimental (as per Shadow Hearts' hard-coded assumptions)
+	// IOP work RAM starts out cleared
+	s = calloc(1, sizeof(psf2_synth_t));
+	if (!s)
+	{
+		return NULL;
+	}
+	s->cpu = cpu = calloc(1, sizeof(mips_cpu_context));
+	if (!cpu)
+	{
+		psf2_stop(s);
+		return NULL;
+	}
 
-	// clear IOP work RAM before we start scribbling in it
-	memset(psx_ram, 0, 2*1024*1024);
+	cpu->loadAddr = 0x23f00;	// this value makes allocations work out similarly to how they would 
+				// in Highly Experimental (as per Shadow Hearts' hard-coded assumptions)
 
 	// Decode the current PSF2
-	if (corlett_decode(buffer, length, &file, &file_len, &c) != AO_SUCCESS)
+	if (corlett_decode(buffer, length, &file, &file_len, &s->c) != AO_SUCCESS)
 	{
-		return AO_FAIL;
+		psf2_stop(s);
+		return NULL;
 	}
+	c = s->c;
 
 	if (file_len > 0) printf("ERROR: PSF2 can't have a program section!  ps %08x\n", (unsigned int)file_len);
 
@@ -490,9 +496,9 @@ int32 psf2_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultl
 	printf("FS section: size %x\n", c->res_size);
 	#endif
 
-	num_fs = 1;
-	filesys[0] = (uint8 *)c->res_section;
-	fssize[0] = c->res_size;
+	cpu->num_fs = 1;
+	cpu->filesys[0] = (uint8 *)c->res_section;
+	cpu->fssize[0] = c->res_size;
 
 	// Get the library file, if any
 	if (c->lib[0] != 0)
@@ -502,27 +508,28 @@ int32 psf2_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultl
 		#if DEBUG_LOADER	
 		printf("Loading library: %s\n", c->lib);
 		#endif
-		if (ao_get_lib(c->lib, &lib_raw_file, &tmp_length) != AO_SUCCESS)
+		if (ao_get_lib(c->lib, &s->lib_raw_file, &tmp_length) != AO_SUCCESS)
 		{
 			aopsf2_missing_psflib=1;
 			strcpy(aopsf2_psflib_str,c->lib);
-			return AO_FAIL;
+			psf2_stop(s);
+			return NULL;
 		}
 		lib_raw_length = tmp_length;
 
-		if (corlett_decode(lib_raw_file, lib_raw_length, &lib_decoded, &lib_len, &lib) != AO_SUCCESS)
+		if (corlett_decode(s->lib_raw_file, lib_raw_length, &lib_decoded, &lib_len, &s->lib) != AO_SUCCESS)
 		{
-			free(lib_raw_file);
-			return AO_FAIL;
+			psf2_stop(s);
+			return NULL;
 		}
 				
 		#if DEBUG_LOADER
-		printf("Lib FS section: size %x bytes\n", lib->res_size);
+		printf("Lib FS section: size %x bytes\n", s->lib->res_size);
 		#endif
 
-		num_fs++;
-		filesys[1] = (uint8 *)lib->res_section;
- 		fssize[1] = lib->res_size;
+		cpu->num_fs++;
+		cpu->filesys[1] = (uint8 *)s->lib->res_section;
+ 		cpu->fssize[1] = s->lib->res_size;
 	}
 
 	// dump all files
@@ -535,143 +542,164 @@ int32 psf2_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultl
 	#endif
 
 	// load psf2.irx, which kicks everything off
+	s->initialPC = 0xffffffff;
 	buf = (uint8 *)malloc(512*1024);
-	irx_len = psf2_load_file("psf2.irx", buf, 512*1024);
+	irx_len = buf ? psf2_load_file(cpu, "psf2.irx", buf, 512*1024) : 0xffffffff;
 
 	if (irx_len != 0xffffffff)
 	{
-		initialPC = psf2_load_elf(buf, irx_len);
-		initialSP = 0x801ffff0;
+		s->initialPC = psf2_load_elf(cpu, buf, irx_len);
+		s->initialSP = 0x801ffff0;
 	}
 	free(buf);
 
-	if (initialPC == 0xffffffff)
+	if (s->initialPC == 0xffffffff)
 	{
-		return AO_FAIL;
+		psf2_stop(s);
+		return NULL;
 	}
 
-	lengthMS = psfTimeToMS(c->inf_length);
-	fadeMS = psfTimeToMS(c->inf_fade);
+	s->lengthMS = psfTimeToMS(c->inf_length);
+	s->fadeMS = psfTimeToMS(c->inf_fade);
     
 	if (loop_infinite) {
-		lengthMS=0;
-		fadeMS=0;
+		s->lengthMS=0;
+		s->fadeMS=0;
+	}
+	if (s->lengthMS == 0) 
+	{
+		s->lengthMS = ~0;
 	}
-	if (lengthMS == 0) 
+
+	if (SPU2init(cpu) < 0)
 	{
-		lengthMS = ~0;
+		psf2_stop(s);
+		return NULL;
 	}
-	setlength2(lengthMS, fadeMS);
+	setlength2(cpu, s->lengthMS, s->fadeMS);
 
-	mips_init();
-	mips_reset(NULL);
+	mips_init(cpu);
+	mips_reset(cpu, NULL);
 
-	mipsinfo.i = initialPC;
-	mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+	mipsinfo.i = s->initialPC;
+	mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 
-	mipsinfo.i = initialSP;
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
+	mipsinfo.i = s->initialSP;
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
 
 	// set RA
 	mipsinfo.i = 0x80000000;
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 
 	// set A0 & A1 to point to "aofile:/"
 	mipsinfo.i = 2;	// argc
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
 
 	mipsinfo.i = 0x80000004;	// argv
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_R5, &mipsinfo);
-	psx_ram[1] = LE32(0x80000008);
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R5, &mipsinfo);
+	cpu->psx_ram[1] = LE32(0x80000008);
 	
-	buf = (uint8 *)&psx_ram[2];
+	buf = (uint8 *)&cpu->psx_ram[2];
 	strcpy((char *)buf, "aofile:/");		
 
-	psx_ram[0] = LE32(FUNCT_HLECALL);
+	cpu->psx_ram[0] = LE32(FUNCT_HLECALL);
 
 	// back up initial RAM image to quickly restart songs
-	memcpy(initial_ram, psx_ram, 2*1024*1024);
+	memcpy(cpu->initial_ram, cpu->psx_ram, 2*1024*1024);
 
-	psx_hw_init();
-	SPU2init();
-	SPU2open(NULL);
+	psx_hw_init(cpu);
+	SPU2open(cpu, NULL);
 
-	return AO_SUCCESS;
+	return s;
 }
 
-void ps2_update(unsigned char *pSound, long lBytes)
+void ps2_update(mips_cpu_context *cpu, unsigned char *pSound, long lBytes)
 {
-	memcpy(spu_pOutput, pSound, lBytes);	// (for direct 44.1kHz output)
+	memcpy(cpu->spu_pOutput, pSound, lBytes);	// (for direct 44.1kHz output)
 }
 
-int32 psf2_gen(int16 *buffer, uint32 samples)
+int32 psf2_gen(void *handle, int16 *buffer, uint32 samples)
 {	
+	psf2_synth_t *s = handle;
+	mips_cpu_context *cpu = s->cpu;
 	int i;
-	ao_song_done=0;
-	spu_pOutput = (char *)buffer;
+	cpu->ao_song_done=0;
+	cpu->spu_pOutput = (char *)buffer;
 
 	for (i = 0; i < samples; i++)
 	{
-		SPU2async(1);
-		ps2_hw_slice();
+		SPU2async(cpu, 1);
+		ps2_hw_slice(cpu);
 	}
-	ps2_hw_frame();
+	ps2_hw_frame(cpu);
 	
-	if (ao_song_done) return AO_FAIL;
+	if (cpu->ao_song_done) return AO_FAIL;
 	
 	return AO_SUCCESS;
 }
 
-int32 psf2_stop(void)
+int32 psf2_stop(void *handle)
 {
-	SPU2close();
-	if (c->lib[0] != 0)
+	psf2_synth_t *s = handle;
+
+	if (s->cpu)
 	{
-		free(lib_raw_file);
+		if (s->cpu->spu2)
+		{
+			SPU2close(s->cpu);
+			SPU2shutdown(s->cpu);
+		}
+		free(s->cpu);
 	}
-	free(c);
+	free(s->lib);
+	free(s->lib_raw_file);
+	free(s->c);
+	free(s);
 
 	return AO_SUCCESS;
 }
 
-int32 psf2_command(int32 command, int32 parameter)
+int32 psf2_command(void *handle, int32 command, int32 parameter)
 {
+	psf2_synth_t *s = handle;
+	mips_cpu_context *cpu = s->cpu;
+	corlett_t *c = s->c;
 	union cpuinfo mipsinfo;
 	uint32 lengthMS, fadeMS;
 
 	switch (command)
 	{
 		case COMMAND_RESTART:
-			SPU2close();
+			SPU2close(cpu);
 
-			memcpy(psx_ram, initial_ram, 2*1024*1024);
+			memcpy(cpu->psx_ram, cpu->initial_ram, 2*1024*1024);
 
-			mips_init();
-			mips_reset(NULL);
-			psx_hw_init();
-			SPU2init();
-			SPU2open(NULL);
+			mips_init(cpu);
+			mips_reset(cpu, NULL);
+			psx_hw_init(cpu);
+			SPU2init(cpu);
+			SPU2open(cpu, NULL);
 
-			mipsinfo.i = initialPC;
-			mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+			mipsinfo.i = s->initialPC;
+			mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 
-			mipsinfo.i = initialSP;
-			mips_set_info(CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
-			mips_set_info(CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
+			mipsinfo.i = s->initialSP;
+			mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
+			mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
 
 			// set RA
 			mipsinfo.i = 0x80000000;
-			mips_set_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+			mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 
 			// set A0 & A1 to point to "aofile:/"
 			mipsinfo.i = 2;	// argc
-			mips_set_info(CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
+			mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
 
 			mipsinfo.i = 0x80000004;	// argv
-			mips_set_info(CPUINFO_INT_REGISTER + MIPS_R5, &mipsinfo);
+			mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R5, &mipsinfo);
 
-			psx_hw_init();
+			psx_hw_init(cpu);
 
 			lengthMS = psfTimeToMS(c->inf_length);
 			fadeMS = psfTimeToMS(c->inf_fade);
@@ -679,7 +707,7 @@ int32 psf2_command(int32 command, int32 parameter)
 			{
 				lengthMS = ~0;
 			}
-			setlength2(lengthMS, fadeMS);
+			setlength2(cpu, lengthMS, fadeMS);
 
 			return AO_SUCCESS;
 		
@@ -687,8 +715,11 @@ int32 psf2_command(int32 command, int32 parameter)
 	return AO_FAIL;
 }
 
-int32 psf2_fill_info(ao_display_info *info)
+int32 psf2_fill_info(void *handle, ao_display_info *info)
 {
+	psf2_synth_t *s = handle;
+	corlett_t *c = s->c;
+
 	if (c == NULL)
 		return AO_FAIL;
 		
@@ -714,7 +745,7 @@ int32 psf2_fill_info(ao_display_info *info)
 	sprintf(info->info[7], "%s", c->inf_fade);
 
 	strcpy(info->title[8], "Ripper: ");
-	sprintf(info->info[8], "%s", psfby);
+	sprintf(info->info[8], "%s", s->psfby);
 	
 	info->length_ms=psfTimeToMS(c->inf_length);
 	info->fade_ms=psfTimeToMS(c->inf_fade);
@@ -722,12 +753,12 @@ int32 psf2_fill_info(ao_display_info *info)
 	return AO_SUCCESS;
 }
 
-uint32 psf2_get_loadaddr(void)
+uint32 psf2_get_loadaddr(mips_cpu_context *cpu)
 {
-	return loadAddr;
+	return cpu->loadAddr;
 }
 
-void psf2_set_loadaddr(uint32 new)
+void psf2_set_loadaddr(mips_cpu_context *cpu, uint32 new)
 {
-	loadAddr = new;
+	cpu->loadAddr = new;
 }
@@ -40,173 +40,189 @@
 #include "cpuintrf.h"
 #include "psx.h"
 
-uint16 SPUreadRegister(uint32 reg);
-void SPUwriteRegister(uint32 reg, uint16 val);
+uint16 SPUreadRegister(mips_cpu_context *cpu, uint32 reg);
+void SPUwriteRegister(mips_cpu_context *cpu, uint32 reg, uint16 val);
 
 
-extern int SPUinit(void);
-extern int SPUopen(void);
-extern int SPUclose(void);
-extern void SPUinjectRAMImage(unsigned short *source);
+extern int SPUinit(mips_cpu_context *cpu);
+extern int SPUopen(mips_cpu_context *cpu);
+extern int SPUclose(mips_cpu_context *cpu);
+extern int SPUshutdown(mips_cpu_context *cpu);
+extern void SPUinjectRAMImage(mips_cpu_context *cpu, unsigned short *source);
 
-static uint8 *start_of_file, *song_ptr;
-static uint32 cur_tick, cur_event, num_events, next_tick, end_tick;
-static int old_fmt;
-static char name[128], song[128], company[128];
+typedef struct
+{
+	mips_cpu_context *cpu;		// only the SPU and its IRQ/DMA hooks are used
+	uint8 *start_of_file, *song_ptr;
+	uint32 cur_tick, cur_event, num_events, next_tick, end_tick;
+	int old_fmt;
+	char name[128], song[128], company[128];
+} spu_synth_t;
 
-void setlength(signed int stop, signed int fade);
+void setlength(mips_cpu_context *cpu, signed int stop, signed int fade);
 
 
-int32 spu_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultlength)
+void *spu_start(uint8 *buffer, uint32 length, int32 loop_infinite,int32 defaultlength)
 {
+	spu_synth_t *s;
+	mips_cpu_context *cpu;
 	int i;
 	uint16 reg;
 
 	if (strncmp((char *)buffer, "SPU", 3))
 	{
-		return AO_FAIL;
+		return NULL;
 	}
 	
-	start_of_file = buffer;
+	s = calloc(1, sizeof(spu_synth_t));
+	if (!s)
+	{
+		return NULL;
+	}
+	s->cpu = cpu = calloc(1, sizeof(mips_cpu_context));
+	if (!cpu || SPUinit(cpu) < 0)
+	{
+		spu_stop(s);
+		return NULL;
+	}
+
+	s->start_of_file = buffer;
 
-	SPUinit();
-	SPUopen();
+	SPUopen(cpu);
 
-	if (loop_infinite) setlength(~0, 0);
-	else setlength(170000, 10000);
+	if (loop_infinite) setlength(cpu, ~0, 0);
+	else setlength(cpu, 170000, 10000);
 	
 	// upload the SPU RAM image
-	SPUinjectRAMImage((unsigned short *)&buffer[0]);
+	SPUinjectRAMImage(cpu, (unsigned short *)&buffer[0]);
 
 	// apply the register image	
 	for (i = 0; i < 512; i += 2)
 	{
 		reg = buffer[0x80000+i] | buffer[0x80000+i+1]<<8;
 
-		SPUwriteRegister((i/2)+0x1f801c00, reg);
+		SPUwriteRegister(cpu, (i/2)+0x1f801c00, reg);
 	}
 
-	old_fmt = 1;
+	s->old_fmt = 1;
 
 	if ((buffer[0x80200] != 0x44) || (buffer[0x80201] != 0xac) || (buffer[0x80202] != 0x00) || (buffer[0x80203] != 0x00))
 	{
-		old_fmt = 0;
+		s->old_fmt = 0;
 	}
 
-	if (old_fmt)
+	if (s->old_fmt)
 	{
-		num_events = buffer[0x80204] | buffer[0x80205]<<8 | buffer[0x80206]<<16 | buffer[0x80207]<<24;
+		s->num_events = buffer[0x80204] | buffer[0x80205]<<8 | buffer[0x80206]<<16 | buffer[0x80207]<<24;
 
-		if (((num_events * 12) + 0x80208) > length)
+		if (((s->num_events * 12) + 0x80208) > length)
 		{
-			old_fmt = 0;
+			s->old_fmt = 0;
 		}
 		else
 		{
-			cur_tick = 0;
+			s->cur_tick = 0;
 		}
 	}
 
-	if (!old_fmt)
+	if (!s->old_fmt)
 	{
-		end_tick = buffer[0x80200] | buffer[0x80201]<<8 | buffer[0x80202]<<16 | buffer[0x80203]<<24; 
-		cur_tick = buffer[0x80204] | buffer[0x80205]<<8 | buffer[0x80206]<<16 | buffer[0x80207]<<24; 
-		next_tick = cur_tick;
+		s->end_tick = buffer[0x80200] | buffer[0x80201]<<8 | buffer[0x80202]<<16 | buffer[0x80203]<<24; 
+		s->cur_tick = buffer[0x80204] | buffer[0x80205]<<8 | buffer[0x80206]<<16 | buffer[0x80207]<<24; 
+		s->next_tick = s->cur_tick;
 	}
 
-	song_ptr = &buffer[0x80208];
+	s->song_ptr = &buffer[0x80208];
 	
-	printf("%X\n",song_ptr);
+	printf("%X\n",s->song_ptr);
 	
-	cur_event = 0;
+	s->cur_event = 0;
 
-	strncpy((char *)&buffer[4], name, 128);
-	strncpy((char *)&buffer[0x44], song, 128);
-	strncpy((char *)&buffer[0x84], company, 128);
+	strncpy(s->name, (char *)&buffer[4], 128);
+	strncpy(s->song, (char *)&buffer[0x44], 128);
+	strncpy(s->company, (char *)&buffer[0x84], 128);
 
-	return AO_SUCCESS;
+	return s;
 }
 
-extern int SPUasync(uint32 cycles);
-extern void SPU_flushboot(void);
-
-extern char *spu_pOutput;	// this is a bit lame, but we'll deal
+extern int SPUasync(mips_cpu_context *cpu, uint32 cycles);
+extern void SPU_flushboot(mips_cpu_context *cpu);
 
 
-static void spu_tick(void)
+static void spu_tick(spu_synth_t *s)
 {
 	uint32 time, reg, size;
 	uint16 rdata;
 	uint8 opcode;
 
-	if (old_fmt)
+	if (s->old_fmt)
 	{
-		time = song_ptr[0] | song_ptr[1]<<8 | song_ptr[2]<<16 | song_ptr[3]<<24;
+		time = s->song_ptr[0] | s->song_ptr[1]<<8 | s->song_ptr[2]<<16 | s->song_ptr[3]<<24;
 
-		while ((time == cur_tick) && (cur_event < num_events))
+		while ((time == s->cur_tick) && (s->cur_event < s->num_events))
 		{
-			reg = song_ptr[4] | song_ptr[5]<<8 | song_ptr[6]<<16 | song_ptr[7]<<24;
-			rdata = song_ptr[8] | song_ptr[9]<<8;
+			reg = s->song_ptr[4] | s->song_ptr[5]<<8 | s->song_ptr[6]<<16 | s->song_ptr[7]<<24;
+			rdata = s->song_ptr[8] | s->song_ptr[9]<<8;
 
-			SPUwriteRegister(reg, rdata);
+			SPUwriteRegister(s->cpu, reg, rdata);
 
-			cur_event++;
-			song_ptr += 12;
+			s->cur_event++;
+			s->song_ptr += 12;
 
-			time = song_ptr[0] | song_ptr[1]<<8 | song_ptr[2]<<16 | song_ptr[3]<<24;
+			time = s->song_ptr[0] | s->song_ptr[1]<<8 | s->song_ptr[2]<<16 | s->song_ptr[3]<<24;
 		}
 	}
 	else
 	{
-		if (cur_tick < end_tick)
+		if (s->cur_tick < s->end_tick)
 		{
-			while (cur_tick == next_tick)
+			while (s->cur_tick == s->next_tick)
 			{
-				opcode = song_ptr[0];
-				song_ptr++;
+				opcode = s->song_ptr[0];
+				s->song_ptr++;
 
 				switch (opcode)
 				{
 					case 0:	// write register
-						reg = song_ptr[0] | song_ptr[1]<<8 | song_ptr[2]<<16 | song_ptr[3]<<24;
-						rdata = song_ptr[4] | song_ptr[5]<<8;
+						reg = s->song_ptr[0] | s->song_ptr[1]<<8 | s->song_ptr[2]<<16 | s->song_ptr[3]<<24;
+						rdata = s->song_ptr[4] | s->song_ptr[5]<<8;
 
-						SPUwriteRegister(reg, rdata);
+						SPUwriteRegister(s->cpu, reg, rdata);
 
-						next_tick = song_ptr[6] | song_ptr[7]<<8 | song_ptr[8]<<16 | song_ptr[9]<<24; 
-						song_ptr += 10;
+						s->next_tick = s->song_ptr[6] | s->song_ptr[7]<<8 | s->song_ptr[8]<<16 | s->song_ptr[9]<<24; 
+						s->song_ptr += 10;
 						break;
 
 					case 1:	// read register
-				 		reg = song_ptr[0] | song_ptr[1]<<8 | song_ptr[2]<<16 | song_ptr[3]<<24;
-						SPUreadRegister(reg);
-						next_tick = song_ptr[4] | song_ptr[5]<<8 | song_ptr[6]<<16 | song_ptr[7]<<24; 
-						song_ptr += 8;
+				 		reg = s->song_ptr[0] | s->song_ptr[1]<<8 | s->song_ptr[2]<<16 | s->song_ptr[3]<<24;
+						SPUreadRegister(s->cpu, reg);
+						s->next_tick = s->song_ptr[4] | s->song_ptr[5]<<8 | s->song_ptr[6]<<16 | s->song_ptr[7]<<24; 
+						s->song_ptr += 8;
 						break;
 
 					case 2: // dma write
-						size = song_ptr[0] | song_ptr[1]<<8 | song_ptr[2]<<16 | song_ptr[3]<<24; 
-						song_ptr += (4 + size);
-						next_tick = song_ptr[0] | song_ptr[1]<<8 | song_ptr[2]<<16 | song_ptr[3]<<24; 
-						song_ptr += 4;
+						size = s->song_ptr[0] | s->song_ptr[1]<<8 | s->song_ptr[2]<<16 | s->song_ptr[3]<<24; 
+						s->song_ptr += (4 + size);
+						s->next_tick = s->song_ptr[0] | s->song_ptr[1]<<8 | s->song_ptr[2]<<16 | s->song_ptr[3]<<24; 
+						s->song_ptr += 4;
 						break;
 
 					case 3: // dma read
-						next_tick = song_ptr[4] | song_ptr[5]<<8 | song_ptr[6]<<16 | song_ptr[7]<<24; 
-						song_ptr += 8;
+						s->next_tick = s->song_ptr[4] | s->song_ptr[5]<<8 | s->song_ptr[6]<<16 | s->song_ptr[7]<<24; 
+						s->song_ptr += 8;
 						break;
 
 					case 4: // xa play
-						song_ptr += (32 + 16384);
-						next_tick = song_ptr[0] | song_ptr[1]<<8 | song_ptr[2]<<16 | song_ptr[3]<<24; 
-						song_ptr += 4;
+						s->song_ptr += (32 + 16384);
+						s->next_tick = s->song_ptr[0] | s->song_ptr[1]<<8 | s->song_ptr[2]<<16 | s->song_ptr[3]<<24; 
+						s->song_ptr += 4;
 						break;
 
 					case 5: // cdda play
-						size = song_ptr[0] | song_ptr[1]<<8 | song_ptr[2]<<16 | song_ptr[3]<<24; 
-						song_ptr += (4 + size);
-						next_tick = song_ptr[0] | song_ptr[1]<<8 | song_ptr[2]<<16 | song_ptr[3]<<24; 
-						song_ptr += 4;
+						size = s->song_ptr[0] | s->song_ptr[1]<<8 | s->song_ptr[2]<<16 | s->song_ptr[3]<<24; 
+						s->song_ptr += (4 + size);
+						s->next_tick = s->song_ptr[0] | s->song_ptr[1]<<8 | s->song_ptr[2]<<16 | s->song_ptr[3]<<24; 
+						s->song_ptr += 4;
 						break;
 
 					default:
@@ -222,24 +238,25 @@ static void spu_tick(void)
 		}
 	}
 
-	cur_tick++;
+	s->cur_tick++;
 }
 
-int32 spu_gen(int16 *buffer, uint32 samples)
+int32 spu_gen(void *handle, int16 *buffer, uint32 samples)
 {
+	spu_synth_t *s = handle;
 	int i, run = 1;
 	
 
-	if (old_fmt)
+	if (s->old_fmt)
 	{
-		if (cur_event >= num_events)
+		if (s->cur_event >= s->num_events)
 		{
 			run = 0;
 		}
 	}
 	else
 	{
-		if (cur_tick >= end_tick)
+		if (s->cur_tick >= s->end_tick)
 		{
 			run = 0;
 		}
@@ -249,12 +266,12 @@ int32 spu_gen(int16 *buffer, uint32 samples)
 	{
 		for (i = 0; i < samples; i++)
 		{
-		  	spu_tick();
-			SPUasync(384);
+		  	spu_tick(s);
+			SPUasync(s->cpu, 384);
 		}
 
-		spu_pOutput = (char *)buffer;
-		SPU_flushboot();
+		s->cpu->spu_pOutput = (char *)buffer;
+		SPU_flushboot(s->cpu);
 	}
 	else
 	{
@@ -264,13 +281,28 @@ int32 spu_gen(int16 *buffer, uint32 samples)
 	return AO_SUCCESS;
 }
 
-int32 spu_stop(void)
+int32 spu_stop(void *handle)
 {
+	spu_synth_t *s = handle;
+
+	if (s->cpu)
+	{
+		if (s->cpu->spu)
+		{
+			SPUclose(s->cpu);
+			SPUshutdown(s->cpu);
+		}
+		free(s->cpu);
+	}
+	free(s);
+
 	return AO_SUCCESS;
 }
 
-int32 spu_command(int32 command, int32 parameter)
+int32 spu_command(void *handle, int32 command, int32 parameter)
 {
+	spu_synth_t *s = handle;
+
 	switch (command)
 	{
 		case COMMAND_GET_MIN:
@@ -292,20 +324,20 @@ int32 spu_command(int32 command, int32 parameter)
 		
 		case COMMAND_RESTART:
 		{
-			song_ptr = &start_of_file[0x80200];
+			s->song_ptr = &s->start_of_file[0x80200];
 
-			if (old_fmt)
+			if (s->old_fmt)
 			{
-				num_events = song_ptr[4] | song_ptr[5]<<8 | song_ptr[6]<<16 | song_ptr[7]<<24;
+				s->num_events = s->song_ptr[4] | s->song_ptr[5]<<8 | s->song_ptr[6]<<16 | s->song_ptr[7]<<24;
 			}
 			else
 			{
-				end_tick = song_ptr[0] | song_ptr[1]<<8 | song_ptr[2]<<16 | song_ptr[3]<<24; 
-				cur_tick = song_ptr[4] | song_ptr[5]<<8 | song_ptr[6]<<16 | song_ptr[7]<<24; 
+				s->end_tick = s->song_ptr[0] | s->song_ptr[1]<<8 | s->song_ptr[2]<<16 | s->song_ptr[3]<<24; 
+				s->cur_tick = s->song_ptr[4] | s->song_ptr[5]<<8 | s->song_ptr[6]<<16 | s->song_ptr[7]<<24; 
 			}
 
-			song_ptr += 8;
-			cur_event = 0;
+			s->song_ptr += 8;
+			s->cur_event = 0;
 			return AO_SUCCESS;
 		}
 		break;
@@ -320,14 +352,16 @@ int32 spu_command(int32 command, int32 parameter)
 	return AO_FAIL;
 }
 
-int32 spu_fill_info(ao_display_info *info)
+int32 spu_fill_info(void *handle, ao_display_info *info)
 {
+	spu_synth_t *s = handle;
+
 	strcpy(info->title[1], "Game: ");
-	sprintf(info->info[1], "%.128s", name);
+	sprintf(info->info[1], "%.128s", s->name);
 	strcpy(info->title[2], "Song: ");
-	sprintf(info->info[2], "%.128s", song);
+	sprintf(info->info[2], "%.128s", s->song);
 	strcpy(info->title[3], "Company: ");
-	sprintf(info->info[3], "%.128s", company);
+	sprintf(info->info[3], "%.128s", s->company);
 	
 	info->length_ms=170000;
 	info->fade_ms=10000;
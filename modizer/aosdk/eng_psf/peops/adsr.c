@@ -36,9 +36,11 @@
 // ADSR func
 ////////////////////////////////////////////////////////////////////////
 
+// the rate table is shared by every SPU instance, built once by InitADSR
+static pthread_once_t RateTableBuilt = PTHREAD_ONCE_INIT;
 static u32 RateTable[160];
 
-static void InitADSR(void)                                    // INIT ADSR
+static void BuildRateTable(void)
 {
  u32 r,rs,rd;int i;
 
@@ -59,118 +61,123 @@ static void InitADSR(void)                                    // INIT ADSR
   }
 }
 
+static void InitADSR(void)                                    // INIT ADSR
+{
+ pthread_once(&RateTableBuilt, BuildRateTable);
+}
+
 ////////////////////////////////////////////////////////////////////////
 
-static INLINE void StartADSR(int ch)                          // MIX ADSR
+static INLINE void StartADSR(spu_state_t *spu, int ch)                          // MIX ADSR
 {
- s_chan[ch].ADSRX.lVolume=1;                           // and init some adsr vars
- s_chan[ch].ADSRX.State=0;
- s_chan[ch].ADSRX.EnvelopeVol=0;
+ spu->s_chan[ch].ADSRX.lVolume=1;                           // and init some adsr vars
+ spu->s_chan[ch].ADSRX.State=0;
+ spu->s_chan[ch].ADSRX.EnvelopeVol=0;
 }
 
 ////////////////////////////////////////////////////////////////////////
 
-static INLINE int MixADSR(int ch)                             // MIX ADSR
+static INLINE int MixADSR(spu_state_t *spu, int ch)                             // MIX ADSR
 {    
  static const int sexytable[8]=
 	{0,4,6,8,9,10,11,12};
 
- if(s_chan[ch].bStop)                                  // should be stopped:
+ if(spu->s_chan[ch].bStop)                                  // should be stopped:
   {                                                    // do release
-   if(s_chan[ch].ADSRX.ReleaseModeExp)
+   if(spu->s_chan[ch].ADSRX.ReleaseModeExp)
     {
-     s_chan[ch].ADSRX.EnvelopeVol-=RateTable[(4*(s_chan[ch].ADSRX.ReleaseRate^0x1F))-0x18+32+sexytable[(s_chan[ch].ADSRX.EnvelopeVol>>28)&0x7]];
+     spu->s_chan[ch].ADSRX.EnvelopeVol-=RateTable[(4*(spu->s_chan[ch].ADSRX.ReleaseRate^0x1F))-0x18+32+sexytable[(spu->s_chan[ch].ADSRX.EnvelopeVol>>28)&0x7]];
     }
    else
     {
-     s_chan[ch].ADSRX.EnvelopeVol-=RateTable[(4*(s_chan[ch].ADSRX.ReleaseRate^0x1F))-0x0C + 32];
+     spu->s_chan[ch].ADSRX.EnvelopeVol-=RateTable[(4*(spu->s_chan[ch].ADSRX.ReleaseRate^0x1F))-0x0C + 32];
     }
 
-   if(s_chan[ch].ADSRX.EnvelopeVol<0) 
+   if(spu->s_chan[ch].ADSRX.EnvelopeVol<0) 
     {
-     s_chan[ch].ADSRX.EnvelopeVol=0;
-     s_chan[ch].bOn=0;
-     s_chan[ch].bNoise=0;
+     spu->s_chan[ch].ADSRX.EnvelopeVol=0;
+     spu->s_chan[ch].bOn=0;
+     spu->s_chan[ch].bNoise=0;
     }
 
-   s_chan[ch].ADSRX.lVolume=s_chan[ch].ADSRX.EnvelopeVol>>21;
-   return s_chan[ch].ADSRX.lVolume;
+   spu->s_chan[ch].ADSRX.lVolume=spu->s_chan[ch].ADSRX.EnvelopeVol>>21;
+   return spu->s_chan[ch].ADSRX.lVolume;
   }
  else                                                  // not stopped yet?
   {
-   if(s_chan[ch].ADSRX.State==0)                       // -> attack
+   if(spu->s_chan[ch].ADSRX.State==0)                       // -> attack
     {
-     if(s_chan[ch].ADSRX.AttackModeExp)
+     if(spu->s_chan[ch].ADSRX.AttackModeExp)
       {
-       if(s_chan[ch].ADSRX.EnvelopeVol<0x60000000) 
-        s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(s_chan[ch].ADSRX.AttackRate^0x7F)-0x10 + 32];
+       if(spu->s_chan[ch].ADSRX.EnvelopeVol<0x60000000) 
+        spu->s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(spu->s_chan[ch].ADSRX.AttackRate^0x7F)-0x10 + 32];
        else
-        s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(s_chan[ch].ADSRX.AttackRate^0x7F)-0x18 + 32];
+        spu->s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(spu->s_chan[ch].ADSRX.AttackRate^0x7F)-0x18 + 32];
       }
      else
       {
-       s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(s_chan[ch].ADSRX.AttackRate^0x7F)-0x10 + 32];
+       spu->s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(spu->s_chan[ch].ADSRX.AttackRate^0x7F)-0x10 + 32];
       }
 
-     if(s_chan[ch].ADSRX.EnvelopeVol<0) 
+     if(spu->s_chan[ch].ADSRX.EnvelopeVol<0) 
       {
-       s_chan[ch].ADSRX.EnvelopeVol=0x7FFFFFFF;
-       s_chan[ch].ADSRX.State=1;
+       spu->s_chan[ch].ADSRX.EnvelopeVol=0x7FFFFFFF;
+       spu->s_chan[ch].ADSRX.State=1;
       }
 
-     s_chan[ch].ADSRX.lVolume=s_chan[ch].ADSRX.EnvelopeVol>>21;
-     return s_chan[ch].ADSRX.lVolume;
+     spu->s_chan[ch].ADSRX.lVolume=spu->s_chan[ch].ADSRX.EnvelopeVol>>21;
+     return spu->s_chan[ch].ADSRX.lVolume;
     }
    //--------------------------------------------------//
-   if(s_chan[ch].ADSRX.State==1)                       // -> decay
+   if(spu->s_chan[ch].ADSRX.State==1)                       // -> decay
     {
-     s_chan[ch].ADSRX.EnvelopeVol-=RateTable[(4*(s_chan[ch].ADSRX.DecayRate^0x1F))-0x18+32+sexytable[(s_chan[ch].ADSRX.EnvelopeVol>>28)&0x7]];
+     spu->s_chan[ch].ADSRX.EnvelopeVol-=RateTable[(4*(spu->s_chan[ch].ADSRX.DecayRate^0x1F))-0x18+32+sexytable[(spu->s_chan[ch].ADSRX.EnvelopeVol>>28)&0x7]];
 
-     if(s_chan[ch].ADSRX.EnvelopeVol<0) s_chan[ch].ADSRX.EnvelopeVol=0;
-     if(((s_chan[ch].ADSRX.EnvelopeVol>>27)&0xF) <= s_chan[ch].ADSRX.SustainLevel)
+     if(spu->s_chan[ch].ADSRX.EnvelopeVol<0) spu->s_chan[ch].ADSRX.EnvelopeVol=0;
+     if(((spu->s_chan[ch].ADSRX.EnvelopeVol>>27)&0xF) <= spu->s_chan[ch].ADSRX.SustainLevel)
       {
-       s_chan[ch].ADSRX.State=2;
+       spu->s_chan[ch].ADSRX.State=2;
       }
 
-     s_chan[ch].ADSRX.lVolume=s_chan[ch].ADSRX.EnvelopeVol>>21;
-     return s_chan[ch].ADSRX.lVolume;
+     spu->s_chan[ch].ADSRX.lVolume=spu->s_chan[ch].ADSRX.EnvelopeVol>>21;
+     return spu->s_chan[ch].ADSRX.lVolume;
     }
    //--------------------------------------------------//
-   if(s_chan[ch].ADSRX.State==2)                       // -> sustain
+   if(spu->s_chan[ch].ADSRX.State==2)                       // -> sustain
     {
-     if(s_chan[ch].ADSRX.SustainIncrease)
+     if(spu->s_chan[ch].ADSRX.SustainIncrease)
       {
-       if(s_chan[ch].ADSRX.SustainModeExp)
+       if(spu->s_chan[ch].ADSRX.SustainModeExp)
         {
-         if(s_chan[ch].ADSRX.EnvelopeVol<0x60000000) 
-          s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(s_chan[ch].ADSRX.SustainRate^0x7F)-0x10 + 32];
+         if(spu->s_chan[ch].ADSRX.EnvelopeVol<0x60000000) 
+          spu->s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(spu->s_chan[ch].ADSRX.SustainRate^0x7F)-0x10 + 32];
          else
-          s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(s_chan[ch].ADSRX.SustainRate^0x7F)-0x18 + 32];
+          spu->s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(spu->s_chan[ch].ADSRX.SustainRate^0x7F)-0x18 + 32];
         }
        else
         {
-         s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(s_chan[ch].ADSRX.SustainRate^0x7F)-0x10 + 32];
+         spu->s_chan[ch].ADSRX.EnvelopeVol+=RateTable[(spu->s_chan[ch].ADSRX.SustainRate^0x7F)-0x10 + 32];
         }
 
-       if(s_chan[ch].ADSRX.EnvelopeVol<0) 
+       if(spu->s_chan[ch].ADSRX.EnvelopeVol<0) 
         {
-         s_chan[ch].ADSRX.EnvelopeVol=0x7FFFFFFF;
+         spu->s_chan[ch].ADSRX.EnvelopeVol=0x7FFFFFFF;
         }
       }
      else
       {
-       if(s_chan[ch].ADSRX.SustainModeExp)
-        s_chan[ch].ADSRX.EnvelopeVol-=RateTable[((s_chan[ch].ADSRX.SustainRate^0x7F))-0x1B+32+sexytable[(s_chan[ch].ADSRX.EnvelopeVol>>28)&0x7]];
+       if(spu->s_chan[ch].ADSRX.SustainModeExp)
+        spu->s_chan[ch].ADSRX.EnvelopeVol-=RateTable[((spu->s_chan[ch].ADSRX.SustainRate^0x7F))-0x1B+32+sexytable[(spu->s_chan[ch].ADSRX.EnvelopeVol>>28)&0x7]];
        else
-        s_chan[ch].ADSRX.EnvelopeVol-=RateTable[((s_chan[ch].ADSRX.SustainRate^0x7F))-0x0F + 32];
+        spu->s_chan[ch].ADSRX.EnvelopeVol-=RateTable[((spu->s_chan[ch].ADSRX.SustainRate^0x7F))-0x0F + 32];
 
-       if(s_chan[ch].ADSRX.EnvelopeVol<0) 
+       if(spu->s_chan[ch].ADSRX.EnvelopeVol<0) 
         {
-         s_chan[ch].ADSRX.EnvelopeVol=0;
+         spu->s_chan[ch].ADSRX.EnvelopeVol=0;
         }
       }
-     s_chan[ch].ADSRX.lVolume=s_chan[ch].ADSRX.EnvelopeVol>>21;
-     return s_chan[ch].ADSRX.lVolume;
+     spu->s_chan[ch].ADSRX.lVolume=spu->s_chan[ch].ADSRX.EnvelopeVol>>21;
+     return spu->s_chan[ch].ADSRX.lVolume;
     }
   }
  return 0;
@@ -25,10 +25,10 @@
 //*************************************************************************//
 
 
-static void SoundOn(int start,int end,u16 val);
-static void SoundOff(int start,int end,u16 val);
-static void FModOn(int start,int end,u16 val);
-static void NoiseOn(int start,int end,u16 val);
-static void SetVolumeLR(int right, u8 ch,s16 vol);
-static void SetPitch(int ch,u16 val);
-void SPUwriteRegister(u32 reg, u16 val);
+static void SoundOn(spu_state_t *spu, int start,int end,u16 val);
+static void SoundOff(spu_state_t *spu, int start,int end,u16 val);
+static void FModOn(spu_state_t *spu, int start,int end,u16 val);
+static void NoiseOn(spu_state_t *spu, int start,int end,u16 val);
+static void SetVolumeLR(spu_state_t *spu, int right, u8 ch,s16 vol);
+static void SetPitch(spu_state_t *spu, int ch,u16 val);
+void SPUwriteRegister(mips_cpu_context *cpu, u32 reg, u16 val);
@@ -24,5 +24,5 @@
 //
 //*************************************************************************//
 
-INLINE void StartADSR(int ch);
-INLINE int  MixADSR(int ch);
+INLINE void StartADSR(spu2_state_t *spu, int ch);
+INLINE int  MixADSR(spu2_state_t *spu, int ch);
@@ -24,6 +24,6 @@
 //
 //*************************************************************************//
 
-void InterruptDMA4(void);
-void InterruptDMA7(void); 
+void InterruptDMA4(spu2_state_t *spu);
+void InterruptDMA7(spu2_state_t *spu); 
  
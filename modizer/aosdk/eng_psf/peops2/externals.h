@@ -255,53 +255,72 @@ typedef struct
 // SPU.C globals
 ///////////////////////////////////////////////////////////
 
-#ifndef _IN_SPU
+// per instance state, one per PSX context (cpu->spu2)
 
-// psx buffers / addresses
+typedef struct spu2_state_s
+{
+ // psx buffers / addresses
+ unsigned short  regArea[32*1024];
+ unsigned short  spuMem[1*1024*1024];
+ unsigned char * spuMemC;
+ unsigned char * pSpuIrq[2];
+ unsigned char * pSpuBuffer;
+
+ int             iUseXA;
+ int             iVolume;
+ int             iSPUIRQWait;
+
+ // MAIN infos struct for each channel
+ SPUCHAN         s_chan[MAXCHAN+1];                     // channel + 1 infos (1 is security for fmod handling)
+ REVERBInfo      rvb[2];
+
+ unsigned long   dwNoiseVal;                            // global noise generator
+
+ unsigned short  spuCtrl2[2];                           // some vars to store psx reg infos
+ unsigned short  spuStat2[2];
+ unsigned long   spuIrq2[2];
+ unsigned long   spuAddr2[2];                           // address into spu mem
+ unsigned long   spuRvbAddr2[2];
+ unsigned long   spuRvbAEnd2[2];
+ int             bEndThread;                            // thread handlers
+ int             bThreadEnded;
+ int             bSpuInit;
+ int             bSPUIsOpen;
+
+ unsigned long   dwNewChannel2[2];                      // flags for faster testing, if new channel starts
+ unsigned long   dwEndChannel2[2];
+
+ int             SSumR[NSSIZE];
+ int             SSumL[NSSIZE];
+ int             iCycle;
+ short *         pS;
+
+ int             lastch;                                // last channel processed on spu irq in timer mode
+ int             lastns;                                // last ns pos
+ int             iSecureStart;                          // secure start counter
+ int             iSpuAsyncWait;
+
+ u32             sampcount;
+ u32             decaybegin;
+ u32             decayend;
+
+ // REVERB info and timing vars...
+ int *           sRVBPlay[2];
+ int *           sRVBEnd[2];
+ int *           sRVBStart[2];
+} spu2_state_t;
 
-extern unsigned short  regArea[];                        
-extern unsigned short  spuMem[];
-extern unsigned char * spuMemC;
-extern unsigned char * pSpuIrq[];
-extern unsigned char * pSpuBuffer;
+#ifndef _IN_SPU
 
 // user settings
 
-extern int        iUseXA;
-extern int        iVolume;
 extern int        iXAPitch;
 extern int        iUseTimer;
-extern int        iSPUIRQWait;
 extern int        iDebugMode;
 extern int        iRecordMode;
 extern int        iUseReverb;
 extern int        iUseInterpolation;
 extern int        iDisStereo;
-// MISC
-
-extern SPUCHAN s_chan[];
-extern REVERBInfo rvb[];
-
-extern unsigned long dwNoiseVal;
-extern unsigned short spuCtrl2[];
-extern unsigned short spuStat2[];
-extern unsigned long  spuIrq2[];
-extern unsigned long  spuAddr2[];
-extern unsigned long   spuRvbAddr2[];
-extern unsigned long   spuRvbAEnd2[];
-
-extern int      bEndThread; 
-extern int      bThreadEnded;
-extern int      bSpuInit;
-
-extern int      SSumR[];
-extern int      SSumL[];
-extern int      iCycle;
-extern short *  pS;
-extern unsigned long dwNewChannel2[];
-extern unsigned long dwEndChannel2[];
-
-extern int iSpuAsyncWait;
 
 #ifdef _WINDOWS
 //extern HWND    hWMain;                               // window handle
@@ -370,16 +389,4 @@ extern int           iRightXAVol;
 
 #endif
 
-///////////////////////////////////////////////////////////
-// REVERB.C globals
-///////////////////////////////////////////////////////////
-
-#ifndef _IN_REVERB
-
-extern int *          sRVBPlay[];
-extern int *          sRVBEnd[];
-extern int *          sRVBStart[];
-
-#endif
-
 #endif // PEOPS2_EXTERNALS
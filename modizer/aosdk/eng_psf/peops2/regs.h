@@ -28,16 +28,16 @@
 //*************************************************************************//
 
 
-void SoundOn(int start,int end,unsigned short val);
-void SoundOff(int start,int end,unsigned short val);
-void VolumeOn(int start,int end,unsigned short val,int iRight);
-void FModOn(int start,int end,unsigned short val);
-void NoiseOn(int start,int end,unsigned short val);
-void SetVolumeL(unsigned char ch,short vol);
-void SetVolumeR(unsigned char ch,short vol);
-void SetPitch(int ch,unsigned short val);
-void ReverbOn(int start,int end,unsigned short val,int iRight);
-void SetReverbAddr(int core);
+void SoundOn(spu2_state_t *spu, int start,int end,unsigned short val);
+void SoundOff(spu2_state_t *spu, int start,int end,unsigned short val);
+void VolumeOn(spu2_state_t *spu, int start,int end,unsigned short val,int iRight);
+void FModOn(spu2_state_t *spu, int start,int end,unsigned short val);
+void NoiseOn(spu2_state_t *spu, int start,int end,unsigned short val);
+void SetVolumeL(spu2_state_t *spu, unsigned char ch,short vol);
+void SetVolumeR(spu2_state_t *spu, unsigned char ch,short vol);
+void SetPitch(spu2_state_t *spu, int ch,unsigned short val);
+void ReverbOn(spu2_state_t *spu, int start,int end,unsigned short val,int iRight);
+void SetReverbAddr(spu2_state_t *spu, int core);
 
-EXPORT_GCC void CALLBACK SPU2write(unsigned long reg, unsigned short val);
+EXPORT_GCC void CALLBACK SPU2write(mips_cpu_context *cpu, unsigned long reg, unsigned short val);
 
@@ -28,6 +28,6 @@
 //*************************************************************************//
 
 
-INLINE void StartREVERB(int ch);
-INLINE void StoreREVERB(int ch,int ns);
+INLINE void StartREVERB(spu2_state_t *spu, int ch);
+INLINE void StoreREVERB(spu2_state_t *spu, int ch,int ns);
 
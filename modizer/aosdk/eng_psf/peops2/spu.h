@@ -28,12 +28,13 @@
 //*************************************************************************//
 
 
-void SetupTimer(void);
-void RemoveTimer(void);
+void SetupTimer(spu2_state_t *spu);
+void RemoveTimer(spu2_state_t *spu);
 EXPORT_GCC void CALLBACK SPU2playADPCMchannel(xa_decode_t *xap);
 
-EXPORT_GCC long CALLBACK SPU2init(void);
-EXPORT_GCC long CALLBACK SPU2open(void *pDsp);
-EXPORT_GCC void CALLBACK SPU2async(unsigned long cycle);
-EXPORT_GCC void CALLBACK SPU2close(void);
+EXPORT_GCC long CALLBACK SPU2init(mips_cpu_context *cpu);
+EXPORT_GCC long CALLBACK SPU2open(mips_cpu_context *cpu, void *pDsp);
+EXPORT_GCC void CALLBACK SPU2async(mips_cpu_context *cpu, unsigned long cycle);
+EXPORT_GCC void CALLBACK SPU2close(mips_cpu_context *cpu);
+EXPORT_GCC void CALLBACK SPU2shutdown(mips_cpu_context *cpu);
 
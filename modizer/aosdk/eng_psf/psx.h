@@ -2,12 +2,15 @@
 #define _MIPS_H
 
 #include "ao.h"
+#include "osd_cpu.h"
 //#include "driver.h"
 
+typedef struct mips_cpu_context mips_cpu_context;
+
 typedef void genf(void);
 typedef int offs_t;
 
-#define cpu_readop32(pc) program_read_dword_32le(pc)
+#define cpu_readop32(pc) program_read_dword_32le(cpu, pc)
 #define change_pc(pc)																	\
 
 
@@ -70,15 +73,15 @@ union cpuinfo
 	genf *  f;											/* generic function pointers */
 	char *	s;											/* generic strings */
 
-	void	(*setinfo)(UINT32 state, union cpuinfo *info);/* CPUINFO_PTR_SET_INFO */
-	void	(*getcontext)(void *context);				/* CPUINFO_PTR_GET_CONTEXT */
-	void	(*setcontext)(void *context);				/* CPUINFO_PTR_SET_CONTEXT */
-	void	(*init)(void);								/* CPUINFO_PTR_INIT */
-	void	(*reset)(void *param);						/* CPUINFO_PTR_RESET */
-	void	(*exit)(void);								/* CPUINFO_PTR_EXIT */
-	int		(*execute)(int cycles);						/* CPUINFO_PTR_EXECUTE */
-	void	(*burn)(int cycles);						/* CPUINFO_PTR_BURN */
-	offs_t	(*disassemble)(char *buffer, offs_t pc);	/* CPUINFO_PTR_DISASSEMBLE */
+	void	(*setinfo)(mips_cpu_context *cpu, UINT32 state, union cpuinfo *info);/* CPUINFO_PTR_SET_INFO */
+	void	(*getcontext)(mips_cpu_context *cpu, void *context);	/* CPUINFO_PTR_GET_CONTEXT */
+	void	(*setcontext)(mips_cpu_context *cpu, void *context);	/* CPUINFO_PTR_SET_CONTEXT */
+	void	(*init)(mips_cpu_context *cpu);				/* CPUINFO_PTR_INIT */
+	void	(*reset)(mips_cpu_context *cpu, void *param);	/* CPUINFO_PTR_RESET */
+	void	(*exit)(mips_cpu_context *cpu);				/* CPUINFO_PTR_EXIT */
+	int		(*execute)(mips_cpu_context *cpu, int cycles);	/* CPUINFO_PTR_EXECUTE */
+	void	(*burn)(mips_cpu_context *cpu, int cycles);	/* CPUINFO_PTR_BURN */
+	offs_t	(*disassemble)(mips_cpu_context *cpu, char *buffer, offs_t pc);	/* CPUINFO_PTR_DISASSEMBLE */
 	int		(*irqcallback)(int state);					/* CPUINFO_PTR_IRQCALLBACK */
 	int *	icount;										/* CPUINFO_PTR_INSTRUCTION_COUNTER */
 	construct_map_t internal_map;						/* CPUINFO_PTR_INTERNAL_MEMORY_MAP */
@@ -282,7 +285,164 @@ extern unsigned DasmMIPS(char *buff, unsigned _pc);
 #endif
 
 #if (HAS_PSXCPU)
-extern void psxcpu_get_info(UINT32 state, union cpuinfo *info);
+extern void psxcpu_get_info(mips_cpu_context *cpu, UINT32 state, union cpuinfo *info);
 #endif
 
+/* PSX/IOP machine state : the R3000 core, the hardware glue of psx_hw.c and the
+   PSF2 virtual filesystem. One instance per playing song, nothing is shared. */
+
+#define MAX_FILE_SLOTS	(32)
+#define SEMA_MAX		(64)
+#define MAX_FS			(32)	// maximum # of filesystems (libs and subdirectories)
+
+typedef struct
+{
+	char name[10];
+	uint32 dispatch;
+} ExternLibEntries;
+
+typedef struct
+{
+	uint32 type;
+	uint32 value;
+	uint32 param;
+	int    inUse;
+} EventFlag;
+
+typedef struct
+{
+	uint32 attr;
+	uint32 option;
+	int32 init;
+	int32 current;
+	int32 max;
+	int32 threadsWaiting;
+	int32 inuse;
+} Semaphore;
+
+typedef struct
+{
+	int32  iState;		// state of thread
+
+	uint32 flags;		// flags
+	uint32 routine;		// start of code for the thread
+	uint32 stackloc;	// stack location in IOP RAM
+	uint32 stacksize;	// stack size
+	uint32 refCon;		// user value passed in at CreateThread time
+
+	uint32 waitparm;	// what we're waiting on if in one the TS_WAIT* states
+
+	uint32 save_regs[37];	// CPU registers belonging to this thread
+} Thread;
+
+typedef struct
+{
+	int32  iActive;
+	uint32 count;
+	uint32 target;
+	uint32 source;
+	uint32 prescale;
+	uint32 handler;
+	uint32 hparam;
+	uint32 mode;
+} IOPTimer;
+
+typedef struct
+{
+	uint32 count;
+	uint32 mode;
+	uint32 target;
+	uint32 sysclock;
+	uint32 interrupt;
+} Counter;
+
+typedef struct
+{
+	uint32 desc;
+	int32 status;
+	int32 mode;
+	uint32 fhandler;
+} EvtCtrlBlk[32];
+
+struct mips_cpu_context
+{
+	/* R3000 + GTE */
+	UINT32 op;
+	UINT32 pc;
+	UINT32 prevpc;
+	UINT32 delayv;
+	UINT32 delayr;
+	UINT32 hi;
+	UINT32 lo;
+	UINT32 r[ 32 ];
+	UINT32 cp0r[ 32 ];
+	PAIR cp2cr[ 32 ];
+	PAIR cp2dr[ 32 ];
+	int (*irq_callback)(int irqline);
+	int mips_ICount;
+
+	/* PSX main RAM */
+	uint32 psx_ram[(2*1024*1024)/4];
+	uint32 psx_scratch[0x400];
+	// backup image to restart songs
+	uint32 initial_ram[(2*1024*1024)/4];
+	uint32 initial_scratch[0x400];
+
+	/* psx_hw */
+	volatile int softcall_target;
+	int filestat[MAX_FILE_SLOTS];
+	uint8 *filedata[MAX_FILE_SLOTS];
+	uint32 filesize[MAX_FILE_SLOTS], filepos[MAX_FILE_SLOTS];
+	int intr_susp;
+
+	uint64 sys_time;
+	int timerexp;
+
+	int32 iNumLibs;
+	ExternLibEntries reglibs[32];
+
+	int32 iNumFlags;
+	EventFlag evflags[32];
+
+	int32 iNumSema;
+	Semaphore semaphores[SEMA_MAX];
+
+	int32 iNumThreads, iCurThread;
+	Thread threads[32];
+
+	IOPTimer iop_timers[8];
+	int32 iNumTimers;
+
+	Counter root_cnts[4];	// 4 of the bastards
+
+	EvtCtrlBlk *Event;
+	EvtCtrlBlk *CounterEvent;
+
+	uint32 spu_delay, dma_icr, irq_data, irq_mask, dma_timer, WAI;
+	uint32 dma4_madr, dma4_bcr, dma4_chcr, dma4_delay;
+	uint32 dma7_madr, dma7_bcr, dma7_chcr, dma7_delay;
+	uint32 dma4_cb, dma7_cb, dma4_fval, dma4_flag, dma7_fval, dma7_flag;
+	uint32 irq9_cb, irq9_fval, irq9_flag;
+
+	uint32 gpu_stat;
+	int fcnt;
+	uint32 heap_addr, entry_int;
+	uint32 irq_regs[37];
+	int irq_mutex;
+
+	int psf_refresh;	// 50/60 Hz, -1 if the PSF has no tag
+	int ao_song_done;	// set when the IOP program exits
+
+	/* PSF2 filesystems */
+	uint8 *filesys[MAX_FS];
+	uint32 fssize[MAX_FS];
+	int num_fs;
+	uint32 loadAddr;
+
+	/* sound chips (peops, peops2) and where they render to */
+	struct spu_state_s *spu;
+	struct spu2_state_s *spu2;
+	char *spu_pOutput;
+};
+
 #endif
@@ -51,7 +51,6 @@
 #include "cpuintrf.h"
 #include "psx.h"
 
-extern int ao_song_done;
 
 #define DEBUG_HLE_BIOS	(0)		// debug PS1 HLE BIOS
 #define DEBUG_SPU	(0)		// debug PS1 SPU read/write
@@ -60,82 +59,35 @@ extern int ao_song_done;
 #define DEBUG_UNK_RW	(0)		// debug unknown reads/writes
 #define DEBUG_THREADING (0)		// debug PS2 IOP threading
 
-extern void mips_get_info(UINT32 state, union cpuinfo *info);
-extern void mips_set_info(UINT32 state, union cpuinfo *info);
+extern void mips_get_info(mips_cpu_context *cpu, UINT32 state, union cpuinfo *info);
+extern void mips_set_info(mips_cpu_context *cpu, UINT32 state, union cpuinfo *info);
 extern int psxcpu_verbose;
-extern uint16 SPUreadRegister(uint32 reg);
-extern void SPUwriteRegister(uint32 reg, uint16 val);
-extern void SPUwriteDMAMem(uint32 usPSXMem,int iSize);
-extern void SPUreadDMAMem(uint32 usPSXMem,int iSize);
-extern void mips_shorten_frame(void);
-extern int mips_execute( int cycles );
-extern uint32 psf2_load_file(char *file, uint8 *buf, uint32 buflen);
-extern uint32 psf2_load_elf(uint8 *start, uint32 len);
-void psx_hw_runcounters(void);
-int mips_get_icount(void);
-void mips_set_icount(int count);
+extern uint16 SPUreadRegister(mips_cpu_context *cpu, uint32 reg);
+extern void SPUwriteRegister(mips_cpu_context *cpu, uint32 reg, uint16 val);
+extern void SPUwriteDMAMem(mips_cpu_context *cpu, uint32 usPSXMem,int iSize);
+extern void SPUreadDMAMem(mips_cpu_context *cpu, uint32 usPSXMem,int iSize);
+extern void mips_shorten_frame(mips_cpu_context *cpu);
+extern int mips_execute( mips_cpu_context *cpu, int cycles );
+extern uint32 psf2_load_file(mips_cpu_context *cpu, char *file, uint8 *buf, uint32 buflen);
+extern uint32 psf2_load_elf(mips_cpu_context *cpu, uint8 *start, uint32 len);
+void psx_hw_runcounters(mips_cpu_context *cpu);
+int mips_get_icount(mips_cpu_context *cpu);
+void mips_set_icount(mips_cpu_context *cpu, int count);
 
-extern int psf_refresh;
 
 // SPU2
-extern void SPU2write(unsigned long reg, unsigned short val);
-extern unsigned short SPU2read(unsigned long reg);
-extern void SPU2readDMA4Mem(uint32 usPSXMem,int iSize);
-extern void SPU2writeDMA4Mem(uint32 usPSXMem,int iSize);
-extern void SPU2readDMA7Mem(uint32 usPSXMem,int iSize);
-extern void SPU2writeDMA7Mem(uint32 usPSXMem,int iSize);
-extern void SPU2interruptDMA4(void);
-extern void SPU2interruptDMA7(void);
-
-#define MAX_FILE_SLOTS	(32)
-
-static volatile int softcall_target = 0;
-static int filestat[MAX_FILE_SLOTS];
-static uint8 *filedata[MAX_FILE_SLOTS];
-static uint32 filesize[MAX_FILE_SLOTS], filepos[MAX_FILE_SLOTS];
-uint32 psf2_get_loadaddr(void);
-void psf2_set_loadaddr(uint32 new);
-static void call_irq_routine(uint32 routine, uint32 parameter);
-static int intr_susp = 0;
-
-static uint64 sys_time;
-static int timerexp = 0;
-
-typedef struct
-{
-	char name[10];
-	uint32 dispatch;
-} ExternLibEntries;
-
-static int32 iNumLibs;
-static ExternLibEntries	reglibs[32];
-
-typedef struct
-{
-	uint32 type;
-	uint32 value;
-	uint32 param;
-	int    inUse;
-} EventFlag;
-
-static int32 iNumFlags;
-static EventFlag evflags[32];
-
-typedef struct
-{
-	uint32 attr;
-	uint32 option;
-	int32 init;
-	int32 current;
-	int32 max;
-	int32 threadsWaiting;
-	int32 inuse;
-} Semaphore;
-
-#define SEMA_MAX	(64)
-
-static int32 iNumSema;
-static Semaphore semaphores[SEMA_MAX];
+extern void SPU2write(mips_cpu_context *cpu, unsigned long reg, unsigned short val);
+extern unsigned short SPU2read(mips_cpu_context *cpu, unsigned long reg);
+extern void SPU2readDMA4Mem(mips_cpu_context *cpu, uint32 usPSXMem,int iSize);
+extern void SPU2writeDMA4Mem(mips_cpu_context *cpu, uint32 usPSXMem,int iSize);
+extern void SPU2readDMA7Mem(mips_cpu_context *cpu, uint32 usPSXMem,int iSize);
+extern void SPU2writeDMA7Mem(mips_cpu_context *cpu, uint32 usPSXMem,int iSize);
+extern void SPU2interruptDMA4(mips_cpu_context *cpu);
+extern void SPU2interruptDMA7(mips_cpu_context *cpu);
+
+uint32 psf2_get_loadaddr(mips_cpu_context *cpu);
+void psf2_set_loadaddr(mips_cpu_context *cpu, uint32 new);
+static void call_irq_routine(mips_cpu_context *cpu, uint32 routine, uint32 parameter);
 
 // thread states
 enum
@@ -151,24 +103,6 @@ enum
 	TS_MAXSTATE
 };
 
-typedef struct
-{
-	int32  iState;		// state of thread
-	
-	uint32 flags;		// flags
-	uint32 routine;		// start of code for the thread
-	uint32 stackloc;	// stack location in IOP RAM
-	uint32 stacksize;	// stack size
-	uint32 refCon;		// user value passed in at CreateThread time
-	
-	uint32 waitparm;	// what we're waiting on if in one the TS_WAIT* states
-	
-	uint32 save_regs[37];	// CPU registers belonging to this thread
-} Thread;
-
-static int32 iNumThreads, iCurThread;
-static Thread threads[32];
-
 #if DEBUG_THREADING
 static char *_ThreadStateNames[TS_MAXSTATE] = { "RUNNING", "READY", "WAITEVFLAG", "WAITSEMA", "WAITDELAY", "SLEEPING", "CREATED" };
 #endif
@@ -177,32 +111,6 @@ static char *_ThreadStateNames[TS_MAXSTATE] = { "RUNNING", "READY", "WAITEVFLAG"
 static char *seek_types[3] = { "SEEK_SET", "SEEK_CUR", "SEEK_END" };
 #endif
 
-typedef struct
-{
-	int32  iActive;
-	uint32 count;
-	uint32 target;
-	uint32 source;
-	uint32 prescale;
-	uint32 handler;
-	uint32 hparam;
-	uint32 mode;
-} IOPTimer;
-
-static IOPTimer iop_timers[8];
-static int32 iNumTimers;
-
-typedef struct
-{
-	uint32 count;
-	uint32 mode;
-	uint32 target;
-	uint32 sysclock;
-	uint32 interrupt;
-} Counter;
-
-static Counter root_cnts[4];	// 4 of the bastards
-
 #define CLOCK_DIV	(8)	// 33 MHz / this = what we run the R3000 at to keep the CPU usage not insane
 
 // counter modes
@@ -213,17 +121,6 @@ static Counter root_cnts[4];	// 4 of the bastards
 #define RC_CLC		(0x0100)	// counter uses direct system clock
 #define RC_DIV8		(0x0200)	// (counter 2 only) system clock/8
 
-typedef struct
-{
-	uint32 desc;
-	int32 status;
-	int32 mode;
-	uint32 fhandler;
-} EvtCtrlBlk[32];
-
-static EvtCtrlBlk *Event;
-static EvtCtrlBlk *CounterEvent;
-
 // Sony event states
 #define EvStUNUSED	0x0000
 #define EvStWAIT	0x1000
@@ -234,21 +131,8 @@ static EvtCtrlBlk *CounterEvent;
 #define EvMdINTR	0x1000
 #define EvMdNOINTR	0x2000
 
-// PSX main RAM
-uint32 psx_ram[(2*1024*1024)/4];
-uint32 psx_scratch[0x400];
-// backup image to restart songs
-uint32 initial_ram[(2*1024*1024)/4];
-uint32 initial_scratch[0x400];
-
-static uint32 spu_delay, dma_icr, irq_data, irq_mask, dma_timer, WAI;
-static uint32 dma4_madr, dma4_bcr, dma4_chcr, dma4_delay;
-static uint32 dma7_madr, dma7_bcr, dma7_chcr, dma7_delay;
-static uint32 dma4_cb, dma7_cb, dma4_fval, dma4_flag, dma7_fval, dma7_flag;
-static uint32 irq9_cb, irq9_fval, irq9_flag;
-
 // take a snapshot of the CPU state for a thread
-static void FreezeThread(int32 iThread, int flag)
+static void FreezeThread(mips_cpu_context *cpu, int32 iThread, int flag)
 {
 	int i;
 	union cpuinfo mipsinfo;
@@ -259,65 +143,65 @@ static void FreezeThread(int32 iThread, int flag)
 	
 	for (i = 0; i < 32; i++)
 	{
-		mips_get_info(CPUINFO_INT_REGISTER + MIPS_R0 + i, &mipsinfo);
-		threads[iThread].save_regs[i] = mipsinfo.i;
+		mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R0 + i, &mipsinfo);
+		cpu->threads[iThread].save_regs[i] = mipsinfo.i;
 	}
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
-	threads[iThread].save_regs[32] = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
-	threads[iThread].save_regs[33] = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_DELAYV, &mipsinfo);
-	threads[iThread].save_regs[35] = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_DELAYR, &mipsinfo);
-	threads[iThread].save_regs[36] = mipsinfo.i;
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
+	cpu->threads[iThread].save_regs[32] = mipsinfo.i;
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
+	cpu->threads[iThread].save_regs[33] = mipsinfo.i;
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_DELAYV, &mipsinfo);
+	cpu->threads[iThread].save_regs[35] = mipsinfo.i;
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_DELAYR, &mipsinfo);
+	cpu->threads[iThread].save_regs[36] = mipsinfo.i;
 	
 	
 	// if a thread is freezing itself due to a IOP syscall, we must save the RA as the PC
 	// to come back to or else the syscall will recurse	
 	if (flag)
 	{
-		mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+		mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 	}
 	else
 	{
-		mips_get_info(CPUINFO_INT_PC, &mipsinfo);
+		mips_get_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 	}
-	threads[iThread].save_regs[34] = mipsinfo.i;
+	cpu->threads[iThread].save_regs[34] = mipsinfo.i;
 	
 #if DEBUG_THREADING
 	{
 		char buffer[256];
 		
-		DasmMIPS(buffer, mipsinfo.i, &psx_ram[(mipsinfo.i & 0x7fffffff)/4]);
+		DasmMIPS(buffer, mipsinfo.i, &cpu->psx_ram[(mipsinfo.i & 0x7fffffff)/4]);
 		
-		printf("IOP: FreezeThread(%d) => %08x  [%s]\n", iThread, threads[iThread].save_regs[34], buffer);
+		printf("IOP: FreezeThread(%d) => %08x  [%s]\n", iThread, cpu->threads[iThread].save_regs[34], buffer);
 	}
 #endif
 	
 	// if thread was running, now it's ready
-	if (threads[iThread].iState == TS_RUNNING)
+	if (cpu->threads[iThread].iState == TS_RUNNING)
 	{
-		threads[iThread].iState = TS_READY;
+		cpu->threads[iThread].iState = TS_READY;
 	}
 }
 
 // restore the CPU state from a thread's snapshot
-static void ThawThread(int32 iThread)
+static void ThawThread(mips_cpu_context *cpu, int32 iThread)
 {
 	int i;
 	union cpuinfo mipsinfo;
 	
 	// the first time a thread is put on the CPU,
 	// some special setup is required
-	if (threads[iThread].iState == TS_CREATED)
+	if (cpu->threads[iThread].iState == TS_CREATED)
 	{
 		// PC = starting routine
-		threads[iThread].save_regs[34] = threads[iThread].routine-4;	// compensate for weird delay slot effects
+		cpu->threads[iThread].save_regs[34] = cpu->threads[iThread].routine-4;	// compensate for weird delay slot effects
 		// SP = thread's stack area
-		threads[iThread].save_regs[29] = (threads[iThread].stackloc + threads[iThread].stacksize) - 16;
-		threads[iThread].save_regs[29] |= 0x80000000;
+		cpu->threads[iThread].save_regs[29] = (cpu->threads[iThread].stackloc + cpu->threads[iThread].stacksize) - 16;
+		cpu->threads[iThread].save_regs[29] |= 0x80000000;
 		
-		threads[iThread].save_regs[35] = threads[iThread].save_regs[36] = 0;
+		cpu->threads[iThread].save_regs[35] = cpu->threads[iThread].save_regs[36] = 0;
 		
 #if DEBUG_THREADING
 		//		printf("IOP: Initial setup for thread %d => PC %x SP %x\n", iThread, threads[iThread].save_regs[34]+4, threads[iThread].save_regs[29]);
@@ -328,43 +212,43 @@ static void ThawThread(int32 iThread)
 	{
 		char buffer[256];
 		
-		mips_get_info(CPUINFO_INT_PC, &mipsinfo);
-		DasmMIPS(buffer, mipsinfo.i, &psx_ram[(mipsinfo.i & 0x7fffffff)/4]);
+		mips_get_info(cpu, CPUINFO_INT_PC, &mipsinfo);
+		DasmMIPS(buffer, mipsinfo.i, &cpu->psx_ram[(mipsinfo.i & 0x7fffffff)/4]);
 		
-		printf("IOP: ThawThread(%d) => %08x  [%s] (wake %d)\n", iThread, threads[iThread].save_regs[34], buffer, wakecount);
+		printf("IOP: ThawThread(%d) => %08x  [%s] (wake %d)\n", iThread, cpu->threads[iThread].save_regs[34], buffer, wakecount);
 	}
 #endif
 	
 	for (i = 0; i < 32; i++)
 	{
-		mipsinfo.i = threads[iThread].save_regs[i];
-		mips_set_info(CPUINFO_INT_REGISTER + MIPS_R0 + i, &mipsinfo);
+		mipsinfo.i = cpu->threads[iThread].save_regs[i];
+		mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R0 + i, &mipsinfo);
 	}
 	
-	mipsinfo.i = threads[iThread].save_regs[32];
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
-	mipsinfo.i = threads[iThread].save_regs[33];
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
-	mipsinfo.i = threads[iThread].save_regs[34];
-	mips_set_info(CPUINFO_INT_PC, &mipsinfo);
-	mipsinfo.i = threads[iThread].save_regs[35];
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_DELAYV, &mipsinfo);
-	mipsinfo.i = threads[iThread].save_regs[36];
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_DELAYR, &mipsinfo);
+	mipsinfo.i = cpu->threads[iThread].save_regs[32];
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
+	mipsinfo.i = cpu->threads[iThread].save_regs[33];
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
+	mipsinfo.i = cpu->threads[iThread].save_regs[34];
+	mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
+	mipsinfo.i = cpu->threads[iThread].save_regs[35];
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_DELAYV, &mipsinfo);
+	mipsinfo.i = cpu->threads[iThread].save_regs[36];
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_DELAYR, &mipsinfo);
 	
-	threads[iThread].iState = TS_RUNNING;
+	cpu->threads[iThread].iState = TS_RUNNING;
 }
 
 // find a new thread to run
-static void ps2_reschedule(void)
+static void ps2_reschedule(mips_cpu_context *cpu)
 {
 	int i, starti, iNextThread;
 	
 	iNextThread = -1;
 	
 	// see if any thread other than the current one is ready to run
-	i = iCurThread+1;
-	if (i >= iNumThreads)
+	i = cpu->iCurThread+1;
+	if (i >= cpu->iNumThreads)
 	{
 		i = 0;
 	}
@@ -373,11 +257,11 @@ static void ps2_reschedule(void)
 	
 	// starting with the next thread after this one,
 	// see who wants to run
-	while (i < iNumThreads)
+	while (i < cpu->iNumThreads)
 	{
-		if (i != iCurThread)
+		if (i != cpu->iCurThread)
 		{
-			if (threads[i].iState == TS_READY)
+			if (cpu->threads[i].iState == TS_READY)
 			{
 			  	iNextThread = i;
 				break;
@@ -391,11 +275,11 @@ static void ps2_reschedule(void)
 	// go around and try from zero
 	if ((starti > 0) && (iNextThread == -1))
 	{
-		for (i = 0; i < iNumThreads; i++)
+		for (i = 0; i < cpu->iNumThreads; i++)
 		{
-			if (i != iCurThread)
+			if (i != cpu->iCurThread)
 			{
-				if (threads[i].iState == TS_READY)
+				if (cpu->threads[i].iState == TS_READY)
 				{
 				  	iNextThread = i;
 					break;
@@ -407,87 +291,85 @@ static void ps2_reschedule(void)
 	if (iNextThread != -1)
 	{
 #if DEBUG_THREADING
-		for (i = 0; i < iNumThreads; i++)
+		for (i = 0; i < cpu->iNumThreads; i++)
 		{
-			printf("Thread %02d: %s\n", i, _ThreadStateNames[threads[i].iState]);
+			printf("Thread %02d: %s\n", i, _ThreadStateNames[cpu->threads[i].iState]);
 		}
 #endif
 		
-		if (iCurThread != -1)
+		if (cpu->iCurThread != -1)
 		{
-			FreezeThread(iCurThread, 0);
+			FreezeThread(cpu, cpu->iCurThread, 0);
 		}
-		ThawThread(iNextThread);
-		iCurThread = iNextThread;
-		threads[iCurThread].iState = TS_RUNNING;
+		ThawThread(cpu, iNextThread);
+		cpu->iCurThread = iNextThread;
+		cpu->threads[cpu->iCurThread].iState = TS_RUNNING;
 	}
 	else
 	{
 		// no thread to switch to, is the current one still running?
-		if (iCurThread != -1)
+		if (cpu->iCurThread != -1)
 		{
-			if (threads[iCurThread].iState != TS_RUNNING)
+			if (cpu->threads[cpu->iCurThread].iState != TS_RUNNING)
 			{
 #if DEBUG_THREADING
 				printf("IOP: no threads to run\n");
 				
-				for (i = 0; i < iNumThreads; i++)
+				for (i = 0; i < cpu->iNumThreads; i++)
 				{
-					printf("Thread %02d: %s\n", i, _ThreadStateNames[threads[i].iState]);
+					printf("Thread %02d: %s\n", i, _ThreadStateNames[cpu->threads[i].iState]);
 				}
 #endif
 				
-				mips_shorten_frame();	// kill the CPU
-				iCurThread = -1;	// no threads are active
+				mips_shorten_frame(cpu);	// kill the CPU
+				cpu->iCurThread = -1;	// no threads are active
 			}
 		}
 		else
 		{
-			mips_shorten_frame();	// kill the CPU
-			iCurThread = -1;	// no threads are active
+			mips_shorten_frame(cpu);	// kill the CPU
+			cpu->iCurThread = -1;	// no threads are active
 		}
 	}
 }
 
-static void psx_irq_update(void)
+static void psx_irq_update(mips_cpu_context *cpu)
 {
 	union cpuinfo mipsinfo;
 	
-	if ((irq_data & irq_mask) != 0)
+	if ((cpu->irq_data & cpu->irq_mask) != 0)
 	{	// assert the line
-		WAI = 0;
+		cpu->WAI = 0;
 		mipsinfo.i = ASSERT_LINE;
-		mips_set_info( CPUINFO_INT_INPUT_STATE + MIPS_IRQ0, &mipsinfo );
+		mips_set_info( cpu, CPUINFO_INT_INPUT_STATE + MIPS_IRQ0, &mipsinfo );
 	}
 	else
 	{
 		// clear the line
 		mipsinfo.i = CLEAR_LINE;
-		mips_set_info( CPUINFO_INT_INPUT_STATE + MIPS_IRQ0, &mipsinfo );
+		mips_set_info( cpu, CPUINFO_INT_INPUT_STATE + MIPS_IRQ0, &mipsinfo );
 	}
 }
 
-void psx_irq_set(uint32 irq)
+void psx_irq_set(mips_cpu_context *cpu, uint32 irq)
 {
-	irq_data |= irq;
+	cpu->irq_data |= irq;
 	
-	psx_irq_update();
+	psx_irq_update(cpu);
 }
 
-static uint32 gpu_stat = 0;
-
-uint32 psx_hw_read(offs_t offset, uint32 mem_mask)
+uint32 psx_hw_read(mips_cpu_context *cpu, offs_t offset, uint32 mem_mask)
 {
 	if (offset >= 0x00000000 && offset <= 0x007fffff)
 	{
 		offset &= 0x1fffff;
-		return LE32(psx_ram[offset>>2]);
+		return LE32(cpu->psx_ram[offset>>2]);
 	}
 	
 	if (offset >= 0x80000000 && offset <= 0x807fffff)
 	{
 		offset &= 0x1fffff;
-		return LE32(psx_ram[offset>>2]);
+		return LE32(cpu->psx_ram[offset>>2]);
 	}
 	
 	if (offset == 0xbfc00180 || offset == 0xbfc00184)	// exception vector
@@ -497,18 +379,18 @@ uint32 psx_hw_read(offs_t offset, uint32 mem_mask)
 	
 	if (offset == 0x1f801014)
 	{
-		return spu_delay;
+		return cpu->spu_delay;
 	}
 	
 	if (offset == 0xbf801014)
 	{
-		return spu_delay;
+		return cpu->spu_delay;
 	}
 	
 	if (offset == 0x1f801814)
 	{
-		gpu_stat ^= 0xffffffff;
-		return gpu_stat;
+		cpu->gpu_stat ^= 0xffffffff;
+		return cpu->gpu_stat;
 	}
 	
 	if (offset >= 0x1f801c00 && offset <= 0x1f801dff)
@@ -518,14 +400,14 @@ uint32 psx_hw_read(offs_t offset, uint32 mem_mask)
 #if DEBUG_SPU
 			printf("SPU: readRegister(%x)\n", offset);
 #endif
-			return SPUreadRegister(offset) & ~mem_mask;
+			return SPUreadRegister(cpu, offset) & ~mem_mask;
 		}
 		else if (mem_mask == 0x0000ffff)
 		{
 #if DEBUG_SPU
 			printf("SPU: readRegister(%x)\n", offset);
 #endif
-			return SPUreadRegister(offset)<<16;
+			return SPUreadRegister(cpu, offset)<<16;
 		}
 		else printf("SPU: read unknown mask %08x\n", mem_mask);
 	}
@@ -534,15 +416,15 @@ uint32 psx_hw_read(offs_t offset, uint32 mem_mask)
 	{
 		if ((mem_mask == 0xffff0000) || (mem_mask == 0xffffff00))
 		{
-			return SPU2read(offset) & ~mem_mask;
+			return SPU2read(cpu, offset) & ~mem_mask;
 		}
 		else if (mem_mask == 0x0000ffff)
 		{
-			return SPU2read(offset)<<16;
+			return SPU2read(cpu, offset)<<16;
 		}
 		else if (mem_mask == 0)
 		{
-			return SPU2read(offset) | SPU2read(offset+2)<<16;
+			return SPU2read(cpu, offset) | SPU2read(cpu, offset+2)<<16;
 		}
 		else printf("SPU2: read unknown mask %08x\n", mem_mask);
 	}
@@ -555,15 +437,15 @@ uint32 psx_hw_read(offs_t offset, uint32 mem_mask)
 		{
 			case 0:
 				//				printf("RC: read counter %d count = %x\n", cnt, root_cnts[cnt].count);
-				return root_cnts[cnt].count;
+				return cpu->root_cnts[cnt].count;
 				break;
 			case 4:
 				//				printf("RC: read counter %d mode\n", cnt);
-				return root_cnts[cnt].mode;
+				return cpu->root_cnts[cnt].mode;
 				break;
 			case 8:
 				//				printf("RC: read counter %d target\n", cnt);
-				return root_cnts[cnt].target;
+				return cpu->root_cnts[cnt].target;
 				break;
 		}
 		
@@ -572,16 +454,16 @@ uint32 psx_hw_read(offs_t offset, uint32 mem_mask)
 	
 	if (offset == 0x1f8010f4)
 	{
-		return dma_icr;
+		return cpu->dma_icr;
 	}
 	else if (offset == 0x1f801070)
 	{
 		//		printf("Read IRQ_data %x (mask %08x)\n", irq_data, mem_mask);
-		return irq_data;
+		return cpu->irq_data;
 	}
 	else if (offset == 0x1f801074)
 	{
-		return irq_mask;
+		return cpu->irq_mask;
 	}
 	
 	/*	if (offset == 0xbf801508)
@@ -598,14 +480,14 @@ uint32 psx_hw_read(offs_t offset, uint32 mem_mask)
 	{
 		union cpuinfo mipsinfo;
 		
-		mips_get_info(CPUINFO_INT_PC, &mipsinfo);
+		mips_get_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 		printf("Unknown read: %08x, mask %08x (PC=%x)\n", offset&~3, mem_mask, mipsinfo.i);
 	}
 #endif
 	return 0;
 }
 
-static void psx_dma4(uint32 madr, uint32 bcr, uint32 chcr)
+static void psx_dma4(mips_cpu_context *cpu, uint32 madr, uint32 bcr, uint32 chcr)
 {
 	if (chcr == 0x01000201)	// cpu to SPU
 	{
@@ -613,7 +495,7 @@ static void psx_dma4(uint32 madr, uint32 bcr, uint32 chcr)
 		printf("DMA4: RAM %08x to SPU\n", madr);
 #endif
 		bcr = (bcr>>16) * (bcr & 0xffff) * 2;
-		SPUwriteDMAMem(madr&0x1fffff, bcr);
+		SPUwriteDMAMem(cpu, madr&0x1fffff, bcr);
 	}
 	else
 	{
@@ -621,11 +503,11 @@ static void psx_dma4(uint32 madr, uint32 bcr, uint32 chcr)
 		printf("DMA4: SPU to RAM %08x\n", madr);
 #endif
 		bcr = (bcr>>16) * (bcr & 0xffff) * 2;
-		SPUreadDMAMem(madr&0x1fffff, bcr);
+		SPUreadDMAMem(cpu, madr&0x1fffff, bcr);
 	}
 }
 
-static void ps2_dma4(uint32 madr, uint32 bcr, uint32 chcr)
+static void ps2_dma4(mips_cpu_context *cpu, uint32 madr, uint32 bcr, uint32 chcr)
 {
 	if (chcr == 0x01000201)	// cpu to SPU2
 	{
@@ -633,7 +515,7 @@ static void ps2_dma4(uint32 madr, uint32 bcr, uint32 chcr)
 		printf("DMA4: RAM %08x to SPU2\n", madr);
 #endif
 		bcr = (bcr>>16) * (bcr & 0xffff) * 4;
-		SPU2writeDMA4Mem(madr&0x1fffff, bcr);
+		SPU2writeDMA4Mem(cpu, madr&0x1fffff, bcr);
 	}
 	else
 	{
@@ -641,13 +523,13 @@ static void ps2_dma4(uint32 madr, uint32 bcr, uint32 chcr)
 		printf("DMA4: SPU2 to RAM %08x\n", madr);
 #endif
 		bcr = (bcr>>16) * (bcr & 0xffff) * 4;
-		SPU2readDMA4Mem(madr&0x1fffff, bcr);
+		SPU2readDMA4Mem(cpu, madr&0x1fffff, bcr);
 	}
 	
-	dma4_delay = 80;
+	cpu->dma4_delay = 80;
 }
 
-static void ps2_dma7(uint32 madr, uint32 bcr, uint32 chcr)
+static void ps2_dma7(mips_cpu_context *cpu, uint32 madr, uint32 bcr, uint32 chcr)
 {
 	if ((chcr == 0x01000201) || (chcr == 0x00100010) || (chcr == 0x000f0010) || (chcr == 0x00010010))	// cpu to SPU2
 	{
@@ -655,7 +537,7 @@ static void ps2_dma7(uint32 madr, uint32 bcr, uint32 chcr)
 		printf("DMA7: RAM %08x to SPU2\n", madr);
 #endif
 		bcr = (bcr>>16) * (bcr & 0xffff) * 4;
-		SPU2writeDMA7Mem(madr&0x1fffff, bcr);
+		SPU2writeDMA7Mem(cpu, madr&0x1fffff, bcr);
 	}
 	else
 	{
@@ -666,10 +548,10 @@ static void ps2_dma7(uint32 madr, uint32 bcr, uint32 chcr)
 		//		SPU2readDMA7Mem(madr&0x1fffff, bcr);
 	}
 	
-	dma7_delay = 80;
+	cpu->dma7_delay = 80;
 }
 
-void psx_hw_write(offs_t offset, uint32 data, uint32 mem_mask)
+void psx_hw_write(mips_cpu_context *cpu, offs_t offset, uint32 data, uint32 mem_mask)
 {
 	union cpuinfo mipsinfo;
 	
@@ -678,10 +560,10 @@ void psx_hw_write(offs_t offset, uint32 data, uint32 mem_mask)
 		offset &= 0x1fffff;
 		//		if (offset < 0x10000) printf("Write %x to kernel @ %x\n", data, offset);
 		
-		mips_get_info(CPUINFO_INT_PC, &mipsinfo);
+		mips_get_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 		
-		psx_ram[offset>>2] &= LE32(mem_mask);
-		psx_ram[offset>>2] |= LE32(data);
+		cpu->psx_ram[offset>>2] &= LE32(mem_mask);
+		cpu->psx_ram[offset>>2] |= LE32(data);
 		return;
 	}
 	
@@ -689,16 +571,16 @@ void psx_hw_write(offs_t offset, uint32 data, uint32 mem_mask)
 	{
 		offset &= 0x1fffff;
 		//		if (offset < 0x10000) printf("Write %x to kernel @ %x\n", data, offset);
-		mips_get_info(CPUINFO_INT_PC, &mipsinfo);
-		psx_ram[offset>>2] &= LE32(mem_mask);
-		psx_ram[offset>>2] |= LE32(data);
+		mips_get_info(cpu, CPUINFO_INT_PC, &mipsinfo);
+		cpu->psx_ram[offset>>2] &= LE32(mem_mask);
+		cpu->psx_ram[offset>>2] |= LE32(data);
 		return;
 	}
 	
 	if (offset == 0x1f801014 || offset == 0xbf801014)
 	{
-		spu_delay &= mem_mask;
-		spu_delay |= data;
+		cpu->spu_delay &= mem_mask;
+		cpu->spu_delay |= data;
 		return;
 	}
 	
@@ -706,12 +588,12 @@ void psx_hw_write(offs_t offset, uint32 data, uint32 mem_mask)
 	{
 		if (mem_mask == 0xffff0000)
 		{
-			SPUwriteRegister(offset, data);
+			SPUwriteRegister(cpu, offset, data);
 			return;
 		}
 		else if (mem_mask == 0x0000ffff)
 		{
-			SPUwriteRegister(offset, data>>16);
+			SPUwriteRegister(cpu, offset, data>>16);
 			return;
 		}
 		else printf("SPU: write unknown mask %08x\n", mem_mask);
@@ -721,18 +603,18 @@ void psx_hw_write(offs_t offset, uint32 data, uint32 mem_mask)
 	{
 		if (mem_mask == 0xffff0000)
 		{
-			SPU2write(offset, data);
+			SPU2write(cpu, offset, data);
 			return;
 		}
 		else if (mem_mask == 0x0000ffff)
 		{
-			SPU2write(offset, data>>16);
+			SPU2write(cpu, offset, data>>16);
 			return;
 		}
 		else if (mem_mask == 0)
 		{
-			SPU2write(offset, data & 0xffff);
-			SPU2write(offset+2, data>>16);
+			SPU2write(cpu, offset, data & 0xffff);
+			SPU2write(cpu, offset+2, data>>16);
 			return;
 		}
 		else printf("SPU2: write unknown mask %08x\n", mem_mask);
@@ -745,15 +627,15 @@ void psx_hw_write(offs_t offset, uint32 data, uint32 mem_mask)
 		switch (offset & 0xf)
 		{
 			case 0:
-				root_cnts[cnt].count = data;
+				cpu->root_cnts[cnt].count = data;
 				//				printf("RC: counter %d count = %x\n", cnt, data);
 				break;
 			case 4:
-				root_cnts[cnt].mode = data;
+				cpu->root_cnts[cnt].mode = data;
 				//				printf("RC: counter %d mode = %x\n", cnt, data);
 				break;
 			case 8:
-				root_cnts[cnt].target = data;
+				cpu->root_cnts[cnt].target = data;
 				//				printf("RC: counter %d target = %x\n", cnt, data);
 				break;
 		}
@@ -764,95 +646,95 @@ void psx_hw_write(offs_t offset, uint32 data, uint32 mem_mask)
 	// DMA4
 	if (offset == 0x1f8010c0)
 	{
-		dma4_madr = data;
+		cpu->dma4_madr = data;
 		return;
 	}
 	else if (offset == 0x1f8010c4)
 	{
-		dma4_bcr = data;
+		cpu->dma4_bcr = data;
 		return;
 	}
 	else if (offset == 0x1f8010c8)
 	{
-		dma4_chcr = data;
-		psx_dma4(dma4_madr, dma4_bcr, dma4_chcr);
+		cpu->dma4_chcr = data;
+		psx_dma4(cpu, cpu->dma4_madr, cpu->dma4_bcr, cpu->dma4_chcr);
 		
-		if (dma_icr & (1 << (16+4)))
+		if (cpu->dma_icr & (1 << (16+4)))
 		{
-			dma_timer = 3;
+			cpu->dma_timer = 3;
 		}
 		return;
 	}
 	else if (offset == 0x1f8010f4)
 	{
-		dma_icr = ( dma_icr & mem_mask ) |
-		( ~mem_mask & 0x80000000 & dma_icr) |
-		( ~data & ~mem_mask & 0x7f000000 & dma_icr) |
+		cpu->dma_icr = ( cpu->dma_icr & mem_mask ) |
+		( ~mem_mask & 0x80000000 & cpu->dma_icr) |
+		( ~data & ~mem_mask & 0x7f000000 & cpu->dma_icr) |
 		( data & ~mem_mask & 0x00ffffff);
 		
-		if ((dma_icr & 0x7f000000) != 0)
+		if ((cpu->dma_icr & 0x7f000000) != 0)
 		{
-			dma_icr &= ~0x80000000;
+			cpu->dma_icr &= ~0x80000000;
 		}
 		
 		return;
 	}
 	else if (offset == 0x1f801070)
 	{
-		irq_data = (irq_data & mem_mask) | (irq_data & irq_mask & data);
-		psx_irq_update();
+		cpu->irq_data = (cpu->irq_data & mem_mask) | (cpu->irq_data & cpu->irq_mask & data);
+		psx_irq_update(cpu);
 		return;
 	}
 	else if (offset == 0x1f801074)
 	{
-		irq_mask &= mem_mask;
-		irq_mask |= data;
-		psx_irq_update();
+		cpu->irq_mask &= mem_mask;
+		cpu->irq_mask |= data;
+		psx_irq_update(cpu);
 		return;
 	}
 	
 	// PS2 DMA4
 	if (offset == 0xbf8010c0)
 	{
-		dma4_madr = data;
+		cpu->dma4_madr = data;
 		return;
 	}
 	else if (offset == 0xbf8010c8)
 	{
-		dma4_chcr = data;
-		ps2_dma4(dma4_madr, dma4_bcr, dma4_chcr);
+		cpu->dma4_chcr = data;
+		ps2_dma4(cpu, cpu->dma4_madr, cpu->dma4_bcr, cpu->dma4_chcr);
 		
-		if (dma_icr & (1 << (16+4)))
+		if (cpu->dma_icr & (1 << (16+4)))
 		{
-			dma_timer = 3;
+			cpu->dma_timer = 3;
 		}
 		return;
 	}
 	
 	if (offset == 0xbf8010c4 || offset == 0xbf8010c6)
 	{
-		dma4_bcr &= mem_mask;
-		dma4_bcr |= data;
+		cpu->dma4_bcr &= mem_mask;
+		cpu->dma4_bcr |= data;
 		return;
 	}
 	
 	// PS2 DMA7
 	if (offset == 0xbf801500)
 	{
-		dma7_madr = data;
+		cpu->dma7_madr = data;
 		return;
 	}
 	else if (offset == 0xbf801504)
 	{
-		dma7_chcr = data;
-		ps2_dma7(dma7_madr, dma7_bcr, dma7_chcr);
+		cpu->dma7_chcr = data;
+		ps2_dma7(cpu, cpu->dma7_madr, cpu->dma7_bcr, cpu->dma7_chcr);
 		return;
 	}
 	
 	if (offset == 0xbf801508 || offset == 0xbf80150a)
 	{
-		dma7_bcr &= mem_mask;
-		dma7_bcr |= data;
+		cpu->dma7_bcr &= mem_mask;
+		cpu->dma7_bcr |= data;
 		return;
 	}
 	
@@ -860,83 +742,81 @@ void psx_hw_write(offs_t offset, uint32 data, uint32 mem_mask)
 	{
 		union cpuinfo mipsinfo;
 		
-		mips_get_info(CPUINFO_INT_PC, &mipsinfo);
+		mips_get_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 		printf("Unknown write: %08x to %08x, mask %08x (PC=%x)\n", data, offset&~3, mem_mask, mipsinfo.i);
 	}
 #endif
 }
 
 // called per sample, 1/44100th of a second (768 clock cycles)
-void psx_hw_slice(void)
+void psx_hw_slice(mips_cpu_context *cpu)
 {
-	psx_hw_runcounters();
+	psx_hw_runcounters(cpu);
 	
-	if (!WAI)
-		mips_execute(768/CLOCK_DIV);
+	if (!cpu->WAI)
+		mips_execute(cpu, 768/CLOCK_DIV);
 	
-	if (dma_timer)
+	if (cpu->dma_timer)
 	{
-		dma_timer--;
-		if (dma_timer == 0)
+		cpu->dma_timer--;
+		if (cpu->dma_timer == 0)
 		{
-			dma_icr |= (1 << (24+4));
-			psx_irq_set(0x0008);
+			cpu->dma_icr |= (1 << (24+4));
+			psx_irq_set(cpu, 0x0008);
 		}
 	}
 }
 
-void ps2_hw_slice(void)
+void ps2_hw_slice(mips_cpu_context *cpu)
 {
 	int i = 0;
 	
-	timerexp = 0;
-	psx_hw_runcounters();
+	cpu->timerexp = 0;
+	psx_hw_runcounters(cpu);
 	
-	if (iCurThread != -1)
+	if (cpu->iCurThread != -1)
 	{
-		mips_execute(836/CLOCK_DIV);
+		mips_execute(cpu, 836/CLOCK_DIV);
 	}
 	else	// no thread, don't run CPU, just update counters
 	{
-		if (timerexp)
+		if (cpu->timerexp)
 		{
-			ps2_reschedule();
+			ps2_reschedule(cpu);
 			
-			if (iCurThread != -1)
+			if (cpu->iCurThread != -1)
 			{
-				mips_execute((836/CLOCK_DIV)-i);
+				mips_execute(cpu, (836/CLOCK_DIV)-i);
 				i = (836/CLOCK_DIV);
 			}
 		}
 	}
 }
 
-static int fcnt = 0;
-
-void psx_hw_frame(void)
+void psx_hw_frame(mips_cpu_context *cpu)
 {
-	if (psf_refresh == 50)
+	if (cpu->psf_refresh == 50)
 	{
-		fcnt++;;
+		cpu->fcnt++;;
 		
-		if (fcnt < 6)
+		if (cpu->fcnt < 6)
 		{
-			psx_irq_set(1);
+			psx_irq_set(cpu, 1);
 		}
 		else
 		{
-			fcnt = 0;
+			cpu->fcnt = 0;
 		}
 	}
 	else	// NTSC
 	{
-		psx_irq_set(1);
+		psx_irq_set(cpu, 1);
 	}
 }
 
-void ps2_hw_frame(void)
+void ps2_hw_frame(mips_cpu_context *cpu)
 {
-	ps2_reschedule();
+	ps2_reschedule(cpu);
 }
 
 // BIOS HLE
@@ -950,25 +830,19 @@ enum
 	BLK_BK = 12
 };
 
-static uint32 heap_addr, entry_int = 0;
-
-extern uint32 mips_get_cause(void);
-extern uint32 mips_get_status(void);
-extern void mips_set_status(uint32 status);
-extern uint32 mips_get_ePC(void);
-
-static uint32 irq_regs[37];
-
-static int irq_mutex = 0;
+extern uint32 mips_get_cause(mips_cpu_context *cpu);
+extern uint32 mips_get_status(mips_cpu_context *cpu);
+extern void mips_set_status(mips_cpu_context *cpu, uint32 status);
+extern uint32 mips_get_ePC(mips_cpu_context *cpu);
 
-static void call_irq_routine(uint32 routine, uint32 parameter)
+static void call_irq_routine(mips_cpu_context *cpu, uint32 routine, uint32 parameter)
 {
 	int j, oldICount;
 	union cpuinfo mipsinfo;
 	
-	if (!irq_mutex)
+	if (!cpu->irq_mutex)
 	{
-		irq_mutex = 1;
+		cpu->irq_mutex = 1;
 	}
 	else
 	{
@@ -979,65 +853,65 @@ static void call_irq_routine(uint32 routine, uint32 parameter)
 	// save regs for IRQ
 	for (j = 0; j < 32; j++)
 	{
-		mips_get_info(CPUINFO_INT_REGISTER + MIPS_R0 + j, &mipsinfo);
-		irq_regs[j] = mipsinfo.i;
+		mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R0 + j, &mipsinfo);
+		cpu->irq_regs[j] = mipsinfo.i;
 	}
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
-	irq_regs[32] = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
-	irq_regs[33] = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_PC, &mipsinfo);
-	irq_regs[34] = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_DELAYV, &mipsinfo);
-	irq_regs[35] = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_DELAYR, &mipsinfo);
-	irq_regs[36] = mipsinfo.i;
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
+	cpu->irq_regs[32] = mipsinfo.i;
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
+	cpu->irq_regs[33] = mipsinfo.i;
+	mips_get_info(cpu, CPUINFO_INT_PC, &mipsinfo);
+	cpu->irq_regs[34] = mipsinfo.i;
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_DELAYV, &mipsinfo);
+	cpu->irq_regs[35] = mipsinfo.i;
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_DELAYR, &mipsinfo);
+	cpu->irq_regs[36] = mipsinfo.i;
 	
 	// PC = timer handler routine
 	mipsinfo.i = routine; 
-	mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 	
 	// parameter in a0
 	mipsinfo.i = parameter;
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
 	
 	// RA = a trap address we can set
 	mipsinfo.i = 0x80001000;
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 	
 	// make sure we're set
-	psx_ram[0x1000/4] = LE32(FUNCT_HLECALL);
+	cpu->psx_ram[0x1000/4] = LE32(FUNCT_HLECALL);
 	
-	softcall_target = 0;
-	oldICount = mips_get_icount();
-	while (!softcall_target)
+	cpu->softcall_target = 0;
+	oldICount = mips_get_icount(cpu);
+	while (!cpu->softcall_target)
 	{
-		mips_execute(10);
+		mips_execute(cpu, 10);
 	}
-	mips_set_icount(oldICount);
+	mips_set_icount(cpu, oldICount);
 	
 	// restore IRQ regs
 	for (j = 0; j < 32; j++)
 	{
-		mipsinfo.i = irq_regs[j];
-		mips_set_info(CPUINFO_INT_REGISTER + MIPS_R0 + j, &mipsinfo);
+		mipsinfo.i = cpu->irq_regs[j];
+		mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R0 + j, &mipsinfo);
 	}
 	
-	mipsinfo.i = irq_regs[32];
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
-	mipsinfo.i = irq_regs[33];
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
-	mipsinfo.i = irq_regs[34];
-	mips_set_info(CPUINFO_INT_PC, &mipsinfo);
-	mipsinfo.i = irq_regs[35];
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_DELAYV, &mipsinfo);
-	mipsinfo.i = irq_regs[36];
-	mips_set_info(CPUINFO_INT_REGISTER + MIPS_DELAYR, &mipsinfo);
+	mipsinfo.i = cpu->irq_regs[32];
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
+	mipsinfo.i = cpu->irq_regs[33];
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
+	mipsinfo.i = cpu->irq_regs[34];
+	mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
+	mipsinfo.i = cpu->irq_regs[35];
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_DELAYV, &mipsinfo);
+	mipsinfo.i = cpu->irq_regs[36];
+	mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_DELAYR, &mipsinfo);
 	
-	irq_mutex = 0;
+	cpu->irq_mutex = 0;
 }
 
-void psx_bios_exception(uint32 pc)
+void psx_bios_exception(mips_cpu_context *cpu, uint32 pc)
 {
 	uint32 a0, status;
 	union cpuinfo mipsinfo;
@@ -1046,82 +920,82 @@ void psx_bios_exception(uint32 pc)
 	//	printf("bios_exception: cause %x\n", mips_get_cause() & 0x3c);
 	
 	// get a0
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
 	a0 = mipsinfo.i;
 	
-	switch (mips_get_cause() & 0x3c)
+	switch (mips_get_cause(cpu) & 0x3c)
 	{
 		case 0:	// IRQ
 			//			printf("IRQ: %x, mask %x\n", irq_data, irq_mask);
 			// save all regs
 			for (i = 0; i < 32; i++)
 			{
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R0 + i, &mipsinfo);
-				irq_regs[i] = mipsinfo.i;
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R0 + i, &mipsinfo);
+				cpu->irq_regs[i] = mipsinfo.i;
 			}
-			mips_get_info(CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
-			irq_regs[32] = mipsinfo.i;
-			mips_get_info(CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
-			irq_regs[33] = mipsinfo.i;
+			mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
+			cpu->irq_regs[32] = mipsinfo.i;
+			mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
+			cpu->irq_regs[33] = mipsinfo.i;
 			
 			// check BIOS-driven interrupts
-			if (irq_data & 1)	// VSync
+			if (cpu->irq_data & 1)	// VSync
 			{
-				if (CounterEvent[3][1].status == LE32(EvStACTIVE))
+				if (cpu->CounterEvent[3][1].status == LE32(EvStACTIVE))
 				{
 					// run the handler
-					mipsinfo.i = LE32(CounterEvent[3][1].fhandler);
+					mipsinfo.i = LE32(cpu->CounterEvent[3][1].fhandler);
 					//	       				printf("Cause = %x, ePC = %x\n", mips_get_cause(), mips_get_ePC());
 					//	       				printf("VBL running handler @ %x\n", mipsinfo.i);
-					mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+					mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 					mipsinfo.i = 0x80001000;
-					mips_set_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+					mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 					
 					// make sure we're set
-					psx_ram[0x1000/4] = LE32(FUNCT_HLECALL);
+					cpu->psx_ram[0x1000/4] = LE32(FUNCT_HLECALL);
 					
-					softcall_target = 0;
-					oldICount = mips_get_icount();
-					while (!softcall_target)
+					cpu->softcall_target = 0;
+					oldICount = mips_get_icount(cpu);
+					while (!cpu->softcall_target)
 					{
-						mips_execute(10);
+						mips_execute(cpu, 10);
 					}
-					mips_set_icount(oldICount);
+					mips_set_icount(cpu, oldICount);
 					
 					//	       				printf("Exiting softcall handler\n");
 					
-					irq_data &= ~1;		// clear the VBL IRQ if we handled it
+					cpu->irq_data &= ~1;		// clear the VBL IRQ if we handled it
 				}
 			}
-			else if (irq_data & 0x70)	// root counters
+			else if (cpu->irq_data & 0x70)	// root counters
 			{
 				for (i = 0; i < 4; i++)
 				{
-					if (irq_data & (1 << (i+4)))
+					if (cpu->irq_data & (1 << (i+4)))
 					{
-						if (CounterEvent[i][1].status == LE32(EvStACTIVE))
+						if (cpu->CounterEvent[i][1].status == LE32(EvStACTIVE))
 						{
 							// run the handler
-							mipsinfo.i = LE32(CounterEvent[i][1].fhandler);
+							mipsinfo.i = LE32(cpu->CounterEvent[i][1].fhandler);
 							//							printf("Cause = %x, ePC = %x\n", mips_get_cause(), mips_get_ePC());
 							//							printf("Counter %d running handler @ %x\n", i, mipsinfo.i);
-							mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+							mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 							mipsinfo.i = 0x80001000;
-							mips_set_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+							mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 							
 							// make sure we're set
-							psx_ram[0x1000/4] = LE32(FUNCT_HLECALL);
+							cpu->psx_ram[0x1000/4] = LE32(FUNCT_HLECALL);
 							
-							softcall_target = 0;
-							oldICount = mips_get_icount();
-							while (!softcall_target)
+							cpu->softcall_target = 0;
+							oldICount = mips_get_icount(cpu);
+							while (!cpu->softcall_target)
 							{
-								mips_execute(10);
+								mips_execute(cpu, 10);
 							}
-							mips_set_icount(oldICount);
+							mips_set_icount(cpu, oldICount);
 							
 							//							printf("Exiting softcall handler\n");
-							irq_data &= ~(1 << (i+4));
+							cpu->irq_data &= ~(1 << (i+4));
 						}
 						else
 						{
@@ -1131,67 +1005,67 @@ void psx_bios_exception(uint32 pc)
 				}
 			}
 		 	
-			if (entry_int)
+			if (cpu->entry_int)
 			{
-				psx_hw_write(0x1f801070, 0xffffffff, 0);
+				psx_hw_write(cpu, 0x1f801070, 0xffffffff, 0);
 				
-				a0 = entry_int;
+				a0 = cpu->entry_int;
 				
 				//				printf("taking entry_int\n");
 				
 				// RA (and PC)
-				mipsinfo.i = LE32(psx_ram[((a0&0x1fffff)+0)/4]);
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
-				mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+				mipsinfo.i = LE32(cpu->psx_ram[((a0&0x1fffff)+0)/4]);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 				// SP
-				mipsinfo.i = LE32(psx_ram[((a0&0x1fffff)+4)/4]);
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
+				mipsinfo.i = LE32(cpu->psx_ram[((a0&0x1fffff)+4)/4]);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
 				// FP
-				mipsinfo.i = LE32(psx_ram[((a0&0x1fffff)+8)/4]);
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
+				mipsinfo.i = LE32(cpu->psx_ram[((a0&0x1fffff)+8)/4]);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
 				
 				// S0-S7 are next
 				for (i = 0; i < 8; i++)
 				{
-					mipsinfo.i = LE32(psx_ram[((a0&0x1fffff)+12+(i*4))/4]);
-					mips_set_info(CPUINFO_INT_REGISTER + MIPS_R16 + i, &mipsinfo);
+					mipsinfo.i = LE32(cpu->psx_ram[((a0&0x1fffff)+12+(i*4))/4]);
+					mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R16 + i, &mipsinfo);
 				}
 				
 				// GP
-				mipsinfo.i = LE32(psx_ram[((a0&0x1fffff)+44)/4]);
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R28, &mipsinfo);
+				mipsinfo.i = LE32(cpu->psx_ram[((a0&0x1fffff)+44)/4]);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R28, &mipsinfo);
 				
 				// v0 = 1
 				mipsinfo.i = 1;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 			else
 			{
-				psx_hw_write(0x1f801070, 0, 0xffff0000);
+				psx_hw_write(cpu, 0x1f801070, 0, 0xffff0000);
 				
 				// note: the entry_int won't be bailing us out here, so do it ourselves
 				for (i = 0; i < 32; i++)
 				{
-					mipsinfo.i = irq_regs[i];
-					mips_set_info(CPUINFO_INT_REGISTER + MIPS_R0 + i, &mipsinfo);
+					mipsinfo.i = cpu->irq_regs[i];
+					mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R0 + i, &mipsinfo);
 				}
 				
-				mipsinfo.i = irq_regs[32];
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
-				mipsinfo.i = irq_regs[33];
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
-				mipsinfo.i = mips_get_ePC();
-				mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+				mipsinfo.i = cpu->irq_regs[32];
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
+				mipsinfo.i = cpu->irq_regs[33];
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
+				mipsinfo.i = mips_get_ePC(cpu);
+				mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 				
-				status = mips_get_status();
+				status = mips_get_status(cpu);
 				status = (status & 0xfffffff0) | ((status & 0x3c)>>2);
-				mips_set_status(status);
+				mips_set_status(cpu, status);
 			}
 			break;
 			
 		case 0x20:	// syscall
 			// syscall always farks with the status, so get it now
-			status = mips_get_status();
+			status = mips_get_status(cpu);
 			
 			switch (a0)
 		{
@@ -1217,17 +1091,17 @@ void psx_bios_exception(uint32 pc)
 		}
 			
 			// PC = ePC + 4
-			mipsinfo.i = mips_get_ePC() + 4;
-			mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+			mipsinfo.i = mips_get_ePC(cpu) + 4;
+			mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 			
 			// and update the status accordingly
 			status = (status & 0xfffffff0) | ((status & 0x3c)>>2);
-			mips_set_status(status);
+			mips_set_status(cpu, status);
 			break;
 			
 		default:
 #if DEBUG_HLE_BIOS
-			printf("HLEBIOS: Unknown exception %x\n", mips_get_cause());
+			printf("HLEBIOS: Unknown exception %x\n", mips_get_cause(cpu));
 #endif
 			break;
 	}
@@ -1276,71 +1150,71 @@ static uint32 calc_spec(uint32 a1)
 	return spec;
 }
 
-void psx_hw_init(void)
+void psx_hw_init(mips_cpu_context *cpu)
 {
-	timerexp = 0;
+	cpu->timerexp = 0;
 	
-	memset(filestat, 0, sizeof(filestat));
-	memset(filedata, 0, sizeof(filedata));
+	memset(cpu->filestat, 0, sizeof(cpu->filestat));
+	memset(cpu->filedata, 0, sizeof(cpu->filedata));
 	
-	dma4_cb = dma7_cb = 0;
+	cpu->dma4_cb = cpu->dma7_cb = 0;
 	
-	sys_time = 0;
+	cpu->sys_time = 0;
 	
 	// clear registered libraries table
-	memset(reglibs, 0, sizeof(reglibs));
-	iNumLibs = 0;
+	memset(cpu->reglibs, 0, sizeof(cpu->reglibs));
+	cpu->iNumLibs = 0;
 	
-	memset(evflags, 0, sizeof(evflags));
-	iNumFlags = 0;
+	memset(cpu->evflags, 0, sizeof(cpu->evflags));
+	cpu->iNumFlags = 0;
 	
-	memset(threads, 0, sizeof(threads));
-	iNumThreads = 1;	// we always have at least one thread
+	memset(cpu->threads, 0, sizeof(cpu->threads));
+	cpu->iNumThreads = 1;	// we always have at least one thread
 	
-	memset(semaphores, 0, sizeof(semaphores));
-	iNumSema = 0;
+	memset(cpu->semaphores, 0, sizeof(cpu->semaphores));
+	cpu->iNumSema = 0;
 	
 	// set the initial thread to "RUNNING"
-	threads[0].iState = TS_RUNNING;
-	iCurThread = 0;
+	cpu->threads[0].iState = TS_RUNNING;
+	cpu->iCurThread = 0;
 	
-	memset(iop_timers, 0, sizeof(iop_timers));
-	iNumTimers = 0;
+	memset(cpu->iop_timers, 0, sizeof(cpu->iop_timers));
+	cpu->iNumTimers = 0;
 	
 	// set PS1 BIOS HLE breakpoints
-	psx_ram[0xa0/4] = LE32(FUNCT_HLECALL);
-	psx_ram[0xb0/4] = LE32(FUNCT_HLECALL);
-	psx_ram[0xc0/4] = LE32(FUNCT_HLECALL);
-	
-	Event = (EvtCtrlBlk *)&psx_ram[0x1000/4];
-	CounterEvent = (Event + (32*2));
-	
-	dma_icr = 0;
-	spu_delay = 0;
-	irq_data = 0;
-	irq_mask = 0;
-	softcall_target = 0;
-	gpu_stat = 0;
-	dma4_madr = dma4_bcr = dma4_chcr = 0;
-	heap_addr = 0;
-	entry_int = 0;
-	
-	WAI = 0;
-	
-	root_cnts[0].mode = RC_EN;
-	root_cnts[1].mode = RC_EN;
-	root_cnts[2].mode = RC_EN;
-	root_cnts[0].sysclock = 0;
-	root_cnts[1].sysclock = 0;
-	root_cnts[2].sysclock = 0;
-	
-	root_cnts[3].mode = (RC_RESET | RC_IQ1 | RC_IQ2);
-	root_cnts[3].sysclock = 0;
-	root_cnts[3].target = 1;
-	root_cnts[3].interrupt = 1;
+	cpu->psx_ram[0xa0/4] = LE32(FUNCT_HLECALL);
+	cpu->psx_ram[0xb0/4] = LE32(FUNCT_HLECALL);
+	cpu->psx_ram[0xc0/4] = LE32(FUNCT_HLECALL);
+	
+	cpu->Event = (EvtCtrlBlk *)&cpu->psx_ram[0x1000/4];
+	cpu->CounterEvent = (cpu->Event + (32*2));
+	
+	cpu->dma_icr = 0;
+	cpu->spu_delay = 0;
+	cpu->irq_data = 0;
+	cpu->irq_mask = 0;
+	cpu->softcall_target = 0;
+	cpu->gpu_stat = 0;
+	cpu->dma4_madr = cpu->dma4_bcr = cpu->dma4_chcr = 0;
+	cpu->heap_addr = 0;
+	cpu->entry_int = 0;
+	
+	cpu->WAI = 0;
+	
+	cpu->root_cnts[0].mode = RC_EN;
+	cpu->root_cnts[1].mode = RC_EN;
+	cpu->root_cnts[2].mode = RC_EN;
+	cpu->root_cnts[0].sysclock = 0;
+	cpu->root_cnts[1].sysclock = 0;
+	cpu->root_cnts[2].sysclock = 0;
+	
+	cpu->root_cnts[3].mode = (RC_RESET | RC_IQ1 | RC_IQ2);
+	cpu->root_cnts[3].sysclock = 0;
+	cpu->root_cnts[3].target = 1;
+	cpu->root_cnts[3].interrupt = 1;
 }
 
-void psx_bios_hle(uint32 pc)
+void psx_bios_hle(mips_cpu_context *cpu, uint32 pc)
 {
 	uint32 subcall, status;
 	union cpuinfo mipsinfo;
@@ -1354,36 +1228,36 @@ void psx_bios_hle(uint32 pc)
 #if DEBUG_HLE_IOP
 		printf("IOP 'null' state\n");
 #endif
-		ao_song_done = 1;
-		softcall_target = 1;
+		cpu->ao_song_done = 1;
+		cpu->softcall_target = 1;
 		return;
 	}
 	
 	if (pc == 0xbfc00180 || pc == 0xbfc00184)	// exception, not BIOS call
 	{
-		psx_bios_exception(pc);
+		psx_bios_exception(cpu, pc);
 		return;
 	}
 	
 	if (pc == 0x80001000)
 	{
 		//		printf("hit softcall target\n");
-		softcall_target = 1;
+		cpu->softcall_target = 1;
 		return;
 	}
 	
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R9, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R9, &mipsinfo);
 	
 	subcall = mipsinfo.i & 0xff;
 	
 	// most calls have a0/a1 as parameters, so prefetch them
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
 	a0 = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R5, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R5, &mipsinfo);
 	a1 = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R6, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R6, &mipsinfo);
 	a2 = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R7, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R7, &mipsinfo);
 	a3 = mipsinfo.i;
 	
 	//	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
@@ -1396,32 +1270,32 @@ void psx_bios_hle(uint32 pc)
 		{
 			case 0x13:	// setjmp
 				// RA
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
-				psx_ram[((a0&0x1fffff)+0)/4] = LE32(mipsinfo.i);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				cpu->psx_ram[((a0&0x1fffff)+0)/4] = LE32(mipsinfo.i);
 #if DEBUG_HLE_BIOS
 				printf("HLEBIOS: setjmp(%08x) => PC %08x\n", a0, mipsinfo.i);
 #endif
 				// SP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
-				psx_ram[((a0&0x1fffff)+4)/4] = LE32(mipsinfo.i);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R29, &mipsinfo);
+				cpu->psx_ram[((a0&0x1fffff)+4)/4] = LE32(mipsinfo.i);
 				// FP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
-				psx_ram[((a0&0x1fffff)+8)/4] = LE32(mipsinfo.i);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R30, &mipsinfo);
+				cpu->psx_ram[((a0&0x1fffff)+8)/4] = LE32(mipsinfo.i);
 				
 				// S0-S7 are next
 				for (i = 0; i < 8; i++)
 				{
-					mips_get_info(CPUINFO_INT_REGISTER + MIPS_R16 + i, &mipsinfo);
-					psx_ram[((a0&0x1fffff)+12+(i*4))/4] = LE32(mipsinfo.i);
+					mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R16 + i, &mipsinfo);
+					cpu->psx_ram[((a0&0x1fffff)+12+(i*4))/4] = LE32(mipsinfo.i);
 				}
 				
 				// GP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R28, &mipsinfo);
-				psx_ram[((a0&0x1fffff)+44)/4] = LE32(mipsinfo.i);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R28, &mipsinfo);
+				cpu->psx_ram[((a0&0x1fffff)+44)/4] = LE32(mipsinfo.i);
 				
 				// v0 = 0
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 0x18:	// strncmp
@@ -1432,14 +1306,14 @@ void psx_bios_hle(uint32 pc)
 				printf("HLEBIOS: strncmp(%08x, %08x, %d)\n", a0, a1, a2);
 #endif
 				
-				dst = (uint8 *)psx_ram;
-				src = (uint8 *)psx_ram;
+				dst = (uint8 *)cpu->psx_ram;
+				src = (uint8 *)cpu->psx_ram;
 				dst += (a0 & 0x1fffff);
 				src += (a1 & 0x1fffff);
 				
 				// v0 = result
 				mipsinfo.i = strncmp((char *)dst, (char *)src, a2);
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -1451,8 +1325,8 @@ void psx_bios_hle(uint32 pc)
 				printf("HLEBIOS: strcpy(%08x, %08x)\n", a0, a1);
 #endif
 				
-				dst = (uint8 *)psx_ram;
-				src = (uint8 *)psx_ram;
+				dst = (uint8 *)cpu->psx_ram;
+				src = (uint8 *)cpu->psx_ram;
 				dst += (a0 & 0x1fffff);
 				src += (a1 & 0x1fffff);
 				
@@ -1465,7 +1339,7 @@ void psx_bios_hle(uint32 pc)
 				
 				// v0 = a0
 				mipsinfo.i = a0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -1477,7 +1351,7 @@ void psx_bios_hle(uint32 pc)
 				printf("HLEBIOS: bzero(%08x, %08x)\n", a0, a1);
 #endif
 				
-				dst = (uint8 *)psx_ram;
+				dst = (uint8 *)cpu->psx_ram;
 				dst += (a0 & 0x1fffff);
 				memset(dst, 0, a1);
 			}
@@ -1491,8 +1365,8 @@ void psx_bios_hle(uint32 pc)
 				printf("HLEBIOS: memcpy(%08x, %08x, %08x)\n", a0, a1, a2);
 #endif
 				
-				dst = (uint8 *)psx_ram;
-				src = (uint8 *)psx_ram;
+				dst = (uint8 *)cpu->psx_ram;
+				src = (uint8 *)cpu->psx_ram;
 				dst += (a0 & 0x1fffff);
 				src += (a1 & 0x1fffff);
 				
@@ -1506,7 +1380,7 @@ void psx_bios_hle(uint32 pc)
 				
 				// v0 = a0
 				mipsinfo.i = a0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -1518,7 +1392,7 @@ void psx_bios_hle(uint32 pc)
 				printf("HLEBIOS: memset(%08x, %08x, %08x)\n", a0, a1, a2);
 #endif
 				
-				dst = (uint8 *)psx_ram;
+				dst = (uint8 *)cpu->psx_ram;
 				dst += (a0 & 0x1fffff);
 				
 				while (a2)
@@ -1530,7 +1404,7 @@ void psx_bios_hle(uint32 pc)
 				
 				// v0 = a0
 				mipsinfo.i = a0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -1541,7 +1415,7 @@ void psx_bios_hle(uint32 pc)
 				
 				// v0 = result
 				mipsinfo.i = 1 + (int)(32767.0*rand()/(RAND_MAX+1.0));
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 0x30:	// srand
@@ -1559,32 +1433,32 @@ void psx_bios_hle(uint32 pc)
 				printf("HLEBIOS: malloc(%x)\n", a0);
 #endif
 				
-				chunk = heap_addr;
+				chunk = cpu->heap_addr;
 				
 				// find a free block that's big enough
-				while ((a0 > LE32(psx_ram[(chunk+BLK_SIZE)/4])) ||
-					   (LE32(psx_ram[(chunk+BLK_STAT)/4]) ==  1))
+				while ((a0 > LE32(cpu->psx_ram[(chunk+BLK_SIZE)/4])) ||
+					   (LE32(cpu->psx_ram[(chunk+BLK_STAT)/4]) ==  1))
 				{
-					chunk = LE32(psx_ram[(chunk+BLK_FD)]);
+					chunk = LE32(cpu->psx_ram[(chunk+BLK_FD)]);
 				}
 				
 				// split free block
 				fd = chunk + 16 + a0;	// free block starts after block record and allocation size
-				psx_ram[(fd+BLK_STAT)/4] = psx_ram[(chunk+BLK_STAT)/4];
-				psx_ram[(fd+BLK_SIZE)/4] = LE32(LE32(psx_ram[(chunk+BLK_SIZE)/4]) - a0);
-				psx_ram[(fd+BLK_FD)/4] = psx_ram[(chunk+BLK_FD)/4]; 
-				psx_ram[(fd+BLK_BK)/4] = chunk;
+				cpu->psx_ram[(fd+BLK_STAT)/4] = cpu->psx_ram[(chunk+BLK_STAT)/4];
+				cpu->psx_ram[(fd+BLK_SIZE)/4] = LE32(LE32(cpu->psx_ram[(chunk+BLK_SIZE)/4]) - a0);
+				cpu->psx_ram[(fd+BLK_FD)/4] = cpu->psx_ram[(chunk+BLK_FD)/4]; 
+				cpu->psx_ram[(fd+BLK_BK)/4] = chunk;
 				
-				psx_ram[(chunk+BLK_STAT)/4] = LE32(1);
-				psx_ram[(chunk+BLK_SIZE)/4] = LE32(a0);
-				psx_ram[(chunk+BLK_FD)/4] = LE32(fd);
+				cpu->psx_ram[(chunk+BLK_STAT)/4] = LE32(1);
+				cpu->psx_ram[(chunk+BLK_SIZE)/4] = LE32(a0);
+				cpu->psx_ram[(chunk+BLK_FD)/4] = LE32(fd);
 				
 				mipsinfo.i = chunk + 16;
 				mipsinfo.i |= 0x80000000;
 #if DEBUG_HLE_BIOS
 				printf("== %08x\n", mipsinfo.i);
 #endif
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -1594,26 +1468,26 @@ void psx_bios_hle(uint32 pc)
 				printf("HLEBIOS: InitHeap(%08x, %08x)\n", a0, a1);
 #endif
 				
-				heap_addr = a0 & 0x3fffffff;
+				cpu->heap_addr = a0 & 0x3fffffff;
 				
-				psx_ram[(heap_addr+BLK_STAT)/4] = LE32(0);
-				psx_ram[(heap_addr+BLK_FD)/4] = LE32(0);
-				psx_ram[(heap_addr+BLK_BK)/4] = LE32(0);
+				cpu->psx_ram[(cpu->heap_addr+BLK_STAT)/4] = LE32(0);
+				cpu->psx_ram[(cpu->heap_addr+BLK_FD)/4] = LE32(0);
+				cpu->psx_ram[(cpu->heap_addr+BLK_BK)/4] = LE32(0);
 				
 				// if heap size out of range, clamp it
 				if (((a0 & 0x1fffff) + a1) >= 2*1024*1024)
 				{
-					psx_ram[(heap_addr+BLK_SIZE)/4] = LE32(0x1ffffc - (a0 & 0x1fffff));
+					cpu->psx_ram[(cpu->heap_addr+BLK_SIZE)/4] = LE32(0x1ffffc - (a0 & 0x1fffff));
 				}
 				else
 				{
-					psx_ram[(heap_addr+BLK_SIZE)/4] = LE32(a1);
+					cpu->psx_ram[(cpu->heap_addr+BLK_SIZE)/4] = LE32(a1);
 				}
 				break;
 				
 			case 0x3f:	// printf
 #if DEBUG_HLE_BIOS
-				printf("HLEBIOS: printf(%08x) = %s\n", a0, &psx_ram[(a0&0x1fffff)/4]);
+				printf("HLEBIOS: printf(%08x) = %s\n", a0, &cpu->psx_ram[(a0&0x1fffff)/4]);
 #endif
 				break;
 				
@@ -1646,7 +1520,7 @@ void psx_bios_hle(uint32 pc)
 				printf("HLEBIOS: DeliverEvent(ev %d, spec %d)\n", ev, spec);
 #endif
 				
-				if (Event[ev][spec].status != LE32(EvStACTIVE))
+				if (cpu->Event[ev][spec].status != LE32(EvStACTIVE))
 				{
 #if DEBUG_HLE_BIOS
 					printf("event not active\n");
@@ -1655,15 +1529,15 @@ void psx_bios_hle(uint32 pc)
 				}
 				
 				// if interrupt mode, do the call
-				if (Event[ev][spec].mode == LE32(EvMdINTR))
+				if (cpu->Event[ev][spec].mode == LE32(EvMdINTR))
 				{
 #if DEBUG_HLE_BIOS
-					printf("INTR type, need to call handler %x\n", LE32(Event[ev][spec].fhandler));
+					printf("INTR type, need to call handler %x\n", LE32(cpu->Event[ev][spec].fhandler));
 #endif
 				}
 				else
 				{
-					Event[ev][spec].status = LE32(EvStALREADY);
+					cpu->Event[ev][spec].status = LE32(EvStALREADY);
 				}
 			}
 				break;
@@ -1683,13 +1557,13 @@ void psx_bios_hle(uint32 pc)
 				}
 #endif
 				
-				Event[ev][spec].status = LE32(EvStWAIT);
-				Event[ev][spec].mode = LE32(a2);
-				Event[ev][spec].fhandler = LE32(a3);
+				cpu->Event[ev][spec].status = LE32(EvStWAIT);
+				cpu->Event[ev][spec].mode = LE32(a2);
+				cpu->Event[ev][spec].fhandler = LE32(a3);
 				
 				// v0 = ev | spec<<8;
 				mipsinfo.i = ev | (spec<<8);
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -1700,19 +1574,19 @@ void psx_bios_hle(uint32 pc)
 				ev = a0 & 0xff;
 				spec = (a0 >> 8) & 0xff;
 				
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 #if DEBUG_HLE_BIOS
 				printf("HLEBIOS: WaitEvent(ev %d spec %d) PC=%x\n", ev, spec, mipsinfo.i);
 #endif
 				
-				Event[ev][spec].status = LE32(EvStACTIVE);
+				cpu->Event[ev][spec].status = LE32(EvStACTIVE);
 				
 				// v0 = 1
 				mipsinfo.i = 1;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				
-				WAI = 1;
-				mips_shorten_frame();
+				cpu->WAI = 1;
+				mips_shorten_frame(cpu);
 			}
 				break;
 				
@@ -1728,9 +1602,9 @@ void psx_bios_hle(uint32 pc)
 #endif
 				
 				// v0 = (is event ready?)
-				if (Event[ev][spec].status == LE32(EvStALREADY))
+				if (cpu->Event[ev][spec].status == LE32(EvStALREADY))
 				{
-					Event[ev][spec].status = LE32(EvStACTIVE);
+					cpu->Event[ev][spec].status = LE32(EvStACTIVE);
 					mipsinfo.i = 1;
 				}
 				else
@@ -1738,13 +1612,13 @@ void psx_bios_hle(uint32 pc)
 					mipsinfo.i = 0;
 				}
 				
-				WAI = 1;
+				cpu->WAI = 1;
 				
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				
 				// it looks like this sets v1 to something non-zero too
 				// (code in Crash 2 & 3 actually relies on that behavior)
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R3, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R3, &mipsinfo);
 			}
 				break;
 				
@@ -1759,11 +1633,11 @@ void psx_bios_hle(uint32 pc)
 				printf("HLEBIOS: EnableEvent(ev %d spec %d)\n", ev, spec);
 #endif
 				
-				Event[ev][spec].status = LE32(EvStACTIVE);
+				cpu->Event[ev][spec].status = LE32(EvStACTIVE);
 				
 				// v0 = 1
 				mipsinfo.i = 1;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -1778,33 +1652,33 @@ void psx_bios_hle(uint32 pc)
 				printf("HLEBIOS: DisableEvent(ev %d spec %d)\n", ev, spec);
 #endif
 				
-				Event[ev][spec].status = LE32(EvStWAIT);
+				cpu->Event[ev][spec].status = LE32(EvStWAIT);
 				
 				// v0 = 1
 				mipsinfo.i = 1;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
 			case 0x17:	// ReturnFromException
 				for (i = 0; i < 32; i++)
 				{
-					mipsinfo.i = irq_regs[i];
-					mips_set_info(CPUINFO_INT_REGISTER + MIPS_R0 + i, &mipsinfo);
+					mipsinfo.i = cpu->irq_regs[i];
+					mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R0 + i, &mipsinfo);
 				}
 				
-				mipsinfo.i = irq_regs[32];
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
-				mipsinfo.i = irq_regs[33];
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
-				mipsinfo.i = mips_get_ePC();
+				mipsinfo.i = cpu->irq_regs[32];
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_HI, &mipsinfo);
+				mipsinfo.i = cpu->irq_regs[33];
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_LO, &mipsinfo);
+				mipsinfo.i = mips_get_ePC(cpu);
 				//					printf("ReturnFromException: IRQ state %x\n", irq_data & irq_mask);
 				//					printf("HLEBIOS: ReturnFromException, cause = %08x, PC = %08x\n", mips_get_cause(), mipsinfo.i);
-				mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 				
-				status = mips_get_status();
+				status = mips_get_status(cpu);
 				status = (status & 0xfffffff0) | ((status & 0x3c)>>2);
-				mips_set_status(status);
+				mips_set_status(cpu, status);
 				return;	// force return to avoid PC=RA below
 				break;
 				
@@ -1812,7 +1686,7 @@ void psx_bios_hle(uint32 pc)
 #if DEBUG_HLE_BIOS
 				printf("HLEBIOS: HookEntryInt(%08x)\n", a0);
 #endif
-				entry_int = a0;
+				cpu->entry_int = a0;
 				break;
 				
 			case 0x3f:	// puts
@@ -1842,11 +1716,11 @@ void psx_bios_hle(uint32 pc)
 #endif
 				
 				// v0 = (a0*4)+0x8600
-				mipsinfo.i = LE32(psx_ram[((a0<<2) + 0x8600)/4]);
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mipsinfo.i = LE32(cpu->psx_ram[((a0<<2) + 0x8600)/4]);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				
 				// (a0*4)+0x8600 = a1;
-				psx_ram[((a0<<2) + 0x8600)/4] = LE32(a1);
+				cpu->psx_ram[((a0<<2) + 0x8600)/4] = LE32(a1);
 				break;
 				
 			default:
@@ -1859,83 +1733,83 @@ void psx_bios_hle(uint32 pc)
 	}
 	
 	// PC = RA
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
-	mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+	mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 }
 
 // root counters
 
-void psx_hw_runcounters(void)
+void psx_hw_runcounters(mips_cpu_context *cpu)
 {
 	int i;
 	
 	// don't process any IRQ sources when interrupts are suspended
-	if (!intr_susp)
+	if (!cpu->intr_susp)
 	{
-		if (dma4_delay)
+		if (cpu->dma4_delay)
 		{
-			dma4_delay--;
+			cpu->dma4_delay--;
 			
-			if (dma4_delay == 0)
+			if (cpu->dma4_delay == 0)
 			{
-				SPU2interruptDMA4();
+				SPU2interruptDMA4(cpu);
 				
-				if (dma4_cb)
+				if (cpu->dma4_cb)
 				{
-					call_irq_routine(dma4_cb, dma4_flag);
+					call_irq_routine(cpu, cpu->dma4_cb, cpu->dma4_flag);
 				}
 			}
 		}
 		
-		if (dma7_delay)
+		if (cpu->dma7_delay)
 		{
-			dma7_delay--;
+			cpu->dma7_delay--;
 			
-			if (dma7_delay == 0)
+			if (cpu->dma7_delay == 0)
 			{
-				SPU2interruptDMA7();
+				SPU2interruptDMA7(cpu);
 				
-				if (dma7_cb)
+				if (cpu->dma7_cb)
 				{
-					call_irq_routine(dma7_cb, dma7_flag);
+					call_irq_routine(cpu, cpu->dma7_cb, cpu->dma7_flag);
 				}
 			}
 		}
-		for (i = 0; i < iNumThreads; i++)
+		for (i = 0; i < cpu->iNumThreads; i++)
 		{
-			if (threads[i].iState == TS_WAITDELAY)
+			if (cpu->threads[i].iState == TS_WAITDELAY)
 			{
-				if (threads[i].waitparm > CLOCK_DIV)
+				if (cpu->threads[i].waitparm > CLOCK_DIV)
 				{
-					threads[i].waitparm -= CLOCK_DIV;
+					cpu->threads[i].waitparm -= CLOCK_DIV;
 				}
 				else	// time's up
 				{
-					threads[i].waitparm = 0;
-					threads[i].iState = TS_READY;
+					cpu->threads[i].waitparm = 0;
+					cpu->threads[i].iState = TS_READY;
 					
-					timerexp = 1;
+					cpu->timerexp = 1;
 					
-					ps2_reschedule();
+					ps2_reschedule(cpu);
 				}
 			}
 		}
 		
-		sys_time += 836;
-		if (iNumTimers > 0)
+		cpu->sys_time += 836;
+		if (cpu->iNumTimers > 0)
 		{
-			for (i = 0; i < iNumTimers; i++)
+			for (i = 0; i < cpu->iNumTimers; i++)
 			{
-				if (iop_timers[i].iActive > 0)
+				if (cpu->iop_timers[i].iActive > 0)
 				{
-					iop_timers[i].count += 836;
-					if (iop_timers[i].count >= iop_timers[i].target)
+					cpu->iop_timers[i].count += 836;
+					if (cpu->iop_timers[i].count >= cpu->iop_timers[i].target)
 					{
-						iop_timers[i].count -= iop_timers[i].target;
+						cpu->iop_timers[i].count -= cpu->iop_timers[i].target;
 						
 //											printf("Timer %d: handler = %08x, param = %08x\n", i, iop_timers[i].handler, iop_timers[i].hparam);
-						call_irq_routine(iop_timers[i].handler, iop_timers[i].hparam);
-						timerexp = 1;
+						call_irq_routine(cpu, cpu->iop_timers[i].handler, cpu->iop_timers[i].hparam);
+						cpu->timerexp = 1;
 					} 
 				}
 			}
@@ -1945,29 +1819,29 @@ void psx_hw_runcounters(void)
 	// PS1 root counters
 	for (i = 0; i < 4; i++)
 	{
-		if ((!(root_cnts[i].mode & RC_EN)) && (root_cnts[i].mode != 0))
+		if ((!(cpu->root_cnts[i].mode & RC_EN)) && (cpu->root_cnts[i].mode != 0))
 		{
-			if (root_cnts[i].mode & RC_DIV8)
+			if (cpu->root_cnts[i].mode & RC_DIV8)
 			{
-				root_cnts[i].count += 768/8;
+				cpu->root_cnts[i].count += 768/8;
 			}
 			else
 			{
-				root_cnts[i].count += 768;
+				cpu->root_cnts[i].count += 768;
 			}
 			
-			if (root_cnts[i].count >= root_cnts[i].target)
+			if (cpu->root_cnts[i].count >= cpu->root_cnts[i].target)
 			{
-				if (!(root_cnts[i].mode & RC_RESET))
+				if (!(cpu->root_cnts[i].mode & RC_RESET))
 				{
-					root_cnts[i].mode |= RC_EN;
+					cpu->root_cnts[i].mode |= RC_EN;
 				}
 				else
 				{
-					root_cnts[i].count %= root_cnts[i].target;
+					cpu->root_cnts[i].count %= cpu->root_cnts[i].target;
 				}
 				
-				psx_irq_set(1<<(4+i));
+				psx_irq_set(cpu, 1<<(4+i));
 			}
 		}
 	}
@@ -1976,84 +1850,84 @@ void psx_hw_runcounters(void)
 
 // PEOpS callbacks
 
-void SPUirq(void) 
+void SPUirq(mips_cpu_context *cpu) 
 {
 	//	psx_irq_set(0x200);
 }
 
 // PSXCPU callbacks
 
-uint8 program_read_byte_32le(offs_t address)
+uint8 program_read_byte_32le(mips_cpu_context *cpu, offs_t address)
 {
 	switch (address & 0x3)
 	{
 		case 0:
-			return psx_hw_read(address, 0xffffff00);
+			return psx_hw_read(cpu, address, 0xffffff00);
 			break;
 		case 1:
-			return psx_hw_read(address, 0xffff00ff)>>8;
+			return psx_hw_read(cpu, address, 0xffff00ff)>>8;
 			break;
 		case 2:
-			return psx_hw_read(address, 0xff00ffff)>>16;
+			return psx_hw_read(cpu, address, 0xff00ffff)>>16;
 			break;
 		case 3:
-			return psx_hw_read(address, 0x00ffffff)>>24;
+			return psx_hw_read(cpu, address, 0x00ffffff)>>24;
 			break;
 	}
 	
-	return psx_hw_read(address, 0xffffff00);
+	return psx_hw_read(cpu, address, 0xffffff00);
 }
 
-uint16 program_read_word_32le(offs_t address)
+uint16 program_read_word_32le(mips_cpu_context *cpu, offs_t address)
 {
 	if (address & 2)
-		return psx_hw_read(address, 0x0000ffff)>>16;
+		return psx_hw_read(cpu, address, 0x0000ffff)>>16;
 	
-	return psx_hw_read(address, 0xffff0000);
+	return psx_hw_read(cpu, address, 0xffff0000);
 }
 
-uint32 program_read_dword_32le(offs_t address)
+uint32 program_read_dword_32le(mips_cpu_context *cpu, offs_t address)
 {
-	return psx_hw_read(address, 0);
+	return psx_hw_read(cpu, address, 0);
 }
 
-void program_write_byte_32le(offs_t address, uint8 data)
+void program_write_byte_32le(mips_cpu_context *cpu, offs_t address, uint8 data)
 {
 	switch (address & 0x3)
 	{
 		case 0:
-			psx_hw_write(address, data, 0xffffff00);
+			psx_hw_write(cpu, address, data, 0xffffff00);
 			break;
 		case 1:
-			psx_hw_write(address, data<<8, 0xffff00ff);
+			psx_hw_write(cpu, address, data<<8, 0xffff00ff);
 			break;
 		case 2:
-			psx_hw_write(address, data<<16, 0xff00ffff);
+			psx_hw_write(cpu, address, data<<16, 0xff00ffff);
 			break;
 		case 3:
-			psx_hw_write(address, data<<24, 0x00ffffff);
+			psx_hw_write(cpu, address, data<<24, 0x00ffffff);
 			break;
 	}
 }
 
-void program_write_word_32le(offs_t address, uint16 data)
+void program_write_word_32le(mips_cpu_context *cpu, offs_t address, uint16 data)
 {
 	if (address & 2)
 	{
-		psx_hw_write(address, data<<16, 0x0000ffff);
+		psx_hw_write(cpu, address, data<<16, 0x0000ffff);
 		return;
 	}
 	
-	psx_hw_write(address, data, 0xffff0000);
+	psx_hw_write(cpu, address, data, 0xffff0000);
 }
 
-void program_write_dword_32le(offs_t address, uint32 data)
+void program_write_dword_32le(mips_cpu_context *cpu, offs_t address, uint32 data)
 {
-	psx_hw_write(address, data, 0);
+	psx_hw_write(cpu, address, data, 0);
 }
 
 // sprintf replacement
-static void iop_sprintf(char *out, char *fmt, uint32 pstart)
+static void iop_sprintf(mips_cpu_context *cpu, char *out, char *fmt, uint32 pstart)
 {
 	char temp[64], tfmt[64];
 	char *cf, *pstr;
@@ -2117,17 +1991,17 @@ static void iop_sprintf(char *out, char *fmt, uint32 pstart)
 			
 			if (isnum)
 			{
-				mips_get_info(curparm, &mipsinfo);
+				mips_get_info(cpu, curparm, &mipsinfo);
 				//				printf("parameter %d = %x\n", curparm-pstart, mipsinfo.i);
 				curparm++;
 				sprintf(temp, tfmt, (int32)mipsinfo.i);
 			}
 			else
 			{
-				mips_get_info(curparm, &mipsinfo);
+				mips_get_info(cpu, curparm, &mipsinfo);
 				curparm++;
 				
-				pstr = (char *)psx_ram;
+				pstr = (char *)cpu->psx_ram;
 				pstr += (mipsinfo.i & 0x1fffff);
 				
 				sprintf(temp, tfmt, pstr);
@@ -2149,7 +2023,7 @@ static void iop_sprintf(char *out, char *fmt, uint32 pstart)
 }
 
 // PS2 IOP callbacks
-void psx_iop_call(uint32 pc, uint32 callnum)
+void psx_iop_call(mips_cpu_context *cpu, uint32 pc, uint32 callnum)
 {
 	uint32 scan;
 	char *mname, *str1, name[9], out[512];
@@ -2160,29 +2034,29 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 	//	printf("IOP call @ %08x\n", pc);
 	
 	// prefetch parameters
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
 	a0 = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R5, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R5, &mipsinfo);
 	a1 = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R6, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R6, &mipsinfo);
 	a2 = mipsinfo.i;
-	mips_get_info(CPUINFO_INT_REGISTER + MIPS_R7, &mipsinfo);
+	mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R7, &mipsinfo);
 	a3 = mipsinfo.i;
 	
 	scan = (pc&0x0fffffff)/4;
-	while ((psx_ram[scan] != LE32(0x41e00000)) && (scan >= (0x10000/4)))
+	while ((cpu->psx_ram[scan] != LE32(0x41e00000)) && (scan >= (0x10000/4)))
 	{
 		scan--;
 	}
 	
-	if (psx_ram[scan] != LE32(0x41e00000))
+	if (cpu->psx_ram[scan] != LE32(0x41e00000))
 	{
 		printf("FATAL ERROR: couldn't find IOP link signature\n");
 		return;
 	}
 	
 	scan += 3;	// skip zero and version
-	memcpy(name, &psx_ram[scan], 8);
+	memcpy(name, &cpu->psx_ram[scan], 8);
 	name[8] = '\0';
 	
 	//	printf("IOP: call module [%s] service %d (PC=%08x)\n", name, callnum, pc);
@@ -2192,11 +2066,11 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 		switch (callnum)
 		{
 			case 4:	// printf
-				mname = (char *)psx_ram;
+				mname = (char *)cpu->psx_ram;
 				mname += a0 & 0x1fffff;
 				mname += (a0 & 3);
 				
-				iop_sprintf(out, mname, CPUINFO_INT_REGISTER + MIPS_R5);	// a1 is first parm
+				iop_sprintf(cpu, out, mname, CPUINFO_INT_REGISTER + MIPS_R5);	// a1 is first parm
 				
 				/*	if (out[strlen(out)-1] != '\n')
 				 {
@@ -2223,7 +2097,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 7: // sceSifSetDma
@@ -2232,7 +2106,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				
 				mipsinfo.i = 1;	// nonzero = success
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 8:	// sceSifDmaStat
@@ -2241,7 +2115,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				
 				mipsinfo.i = -1;	// dma completed
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 29: // sceSifCheckInit
@@ -2250,7 +2124,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				
 				mipsinfo.i = 1;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			default:
@@ -2272,28 +2146,28 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				a0 /= 4;
 #if DEBUG_THREADING
 				printf("   : flags %x routine %08x pri %x stacksize %d refCon %08x\n",
-					   psx_ram[a0], psx_ram[a0+1], psx_ram[a0+2], psx_ram[a0+3], psx_ram[a0+4]);
+					   cpu->psx_ram[a0], cpu->psx_ram[a0+1], cpu->psx_ram[a0+2], cpu->psx_ram[a0+3], cpu->psx_ram[a0+4]);
 #endif
 				
-				newAlloc = psf2_get_loadaddr();
+				newAlloc = psf2_get_loadaddr(cpu);
 				// force 16-byte alignment
 				if (newAlloc & 0xf)
 				{
 					newAlloc &= ~0xf;
 					newAlloc += 16;
 				}
-				psf2_set_loadaddr(newAlloc + LE32(psx_ram[a0+3]));
+				psf2_set_loadaddr(cpu, newAlloc + LE32(cpu->psx_ram[a0+3]));
 				
-				threads[iNumThreads].iState = TS_CREATED;
-				threads[iNumThreads].stackloc = newAlloc;
-				threads[iNumThreads].flags = LE32(psx_ram[a0]);
-				threads[iNumThreads].routine = LE32(psx_ram[a0+2]);
-				threads[iNumThreads].stacksize = LE32(psx_ram[a0+3]);
-				threads[iNumThreads].refCon = LE32(psx_ram[a0+4]);
+				cpu->threads[cpu->iNumThreads].iState = TS_CREATED;
+				cpu->threads[cpu->iNumThreads].stackloc = newAlloc;
+				cpu->threads[cpu->iNumThreads].flags = LE32(cpu->psx_ram[a0]);
+				cpu->threads[cpu->iNumThreads].routine = LE32(cpu->psx_ram[a0+2]);
+				cpu->threads[cpu->iNumThreads].stacksize = LE32(cpu->psx_ram[a0+3]);
+				cpu->threads[cpu->iNumThreads].refCon = LE32(cpu->psx_ram[a0+4]);
 				
-				mipsinfo.i = iNumThreads;
-				iNumThreads++;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mipsinfo.i = cpu->iNumThreads;
+				cpu->iNumThreads++;
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 6:	// StartThread
@@ -2301,9 +2175,9 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: StartThread(%d %d)\n", a0, a1);
 #endif
 				
-				FreezeThread(iCurThread, 1);
-				ThawThread(a0);
-				iCurThread = a0;
+				FreezeThread(cpu, cpu->iCurThread, 1);
+				ThawThread(cpu, a0);
+				cpu->iCurThread = a0;
 				break;
 				
 			case 20:// GetThreadID
@@ -2311,21 +2185,21 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: GetThreadId()\n");
 #endif
 				
-				mipsinfo.i = iCurThread;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mipsinfo.i = cpu->iCurThread;
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 24:// SleepThread
 #if DEBUG_THREADING
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
-				printf("IOP: SleepThread() [curThread %d, PC=%x]\n", iCurThread, mipsinfo.i);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				printf("IOP: SleepThread() [curThread %d, PC=%x]\n", cpu->iCurThread, mipsinfo.i);
 #endif
 				
-				FreezeThread(iCurThread, 1);
-				threads[iCurThread].iState = TS_SLEEPING;
-				iCurThread = -1;
+				FreezeThread(cpu, cpu->iCurThread, 1);
+				cpu->threads[cpu->iCurThread].iState = TS_SLEEPING;
+				cpu->iCurThread = -1;
 				
-				ps2_reschedule();
+				ps2_reschedule(cpu);
 				break;
 				
 			case 25:// WakeupThread
@@ -2334,7 +2208,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				
 				// set thread to "ready to go"
-				threads[a0].iState = TS_READY;	
+				cpu->threads[a0].iState = TS_READY;	
 				break;
 				
 			case 26:// iWakeupThread
@@ -2343,9 +2217,9 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				
 				// set thread to "ready to go" if it's not running
-				if (threads[a0].iState != TS_RUNNING)
+				if (cpu->threads[a0].iState != TS_RUNNING)
 				{
-					threads[a0].iState = TS_READY;	
+					cpu->threads[a0].iState = TS_READY;	
 				}
 				break;
 				
@@ -2354,8 +2228,8 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				double dTicks;
 				
 #if DEBUG_THREADING
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
-				printf("IOP: DelayThread(%d) (PC=%x) [curthread = %d]\n", a0, mipsinfo.i, iCurThread);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				printf("IOP: DelayThread(%d) (PC=%x) [curthread = %d]\n", a0, mipsinfo.i, cpu->iCurThread);
 #endif
 				
 				if (a0 < 100)
@@ -2364,14 +2238,14 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				}
 				dTicks = (double)a0;
 				
-				FreezeThread(iCurThread, 1);
-				threads[iCurThread].iState = TS_WAITDELAY;
+				FreezeThread(cpu, cpu->iCurThread, 1);
+				cpu->threads[cpu->iCurThread].iState = TS_WAITDELAY;
 				dTicks /= (double)1000000.0;
 				dTicks *= (double)36864000.0;	// 768*48000 = IOP native-mode clock rate
-				threads[iCurThread].waitparm = (uint32)dTicks;
-				iCurThread = -1;
+				cpu->threads[cpu->iCurThread].waitparm = (uint32)dTicks;
+				cpu->iCurThread = -1;
 				
-				ps2_reschedule();
+				ps2_reschedule(cpu);
 			}
 				break;
 				
@@ -2383,11 +2257,11 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				a0 &= 0x1fffff;
 				a0 /= 4;
 				
-				psx_ram[a0] = LE32(sys_time & 0xffffffff);  	// low
-				psx_ram[a0+1] = LE32(sys_time >> 32);	// high
+				cpu->psx_ram[a0] = LE32(cpu->sys_time & 0xffffffff);  	// low
+				cpu->psx_ram[a0+1] = LE32(cpu->sys_time >> 32);	// high
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 39:// USec2SysClock
@@ -2405,11 +2279,11 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				hi = dTicks>>32;
 				lo = dTicks & 0xffffffff;
 				
-				psx_ram[((a1 & 0x1fffff)/4)] = LE32(lo);
-				psx_ram[((a1 & 0x1fffff)/4)+1] = LE32(hi);
+				cpu->psx_ram[((a1 & 0x1fffff)/4)] = LE32(lo);
+				cpu->psx_ram[((a1 & 0x1fffff)/4)+1] = LE32(hi);
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -2429,8 +2303,8 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				a1 /= 4;
 				a2 /= 4;
 				
-				temp = LE32(psx_ram[a0]);
-				temp |= (uint64)LE32(psx_ram[a0+1])<<32;
+				temp = LE32(cpu->psx_ram[a0]);
+				temp |= (uint64)LE32(cpu->psx_ram[a0+1])<<32;
 				
 				temp *= (uint64)1000000;
 				temp /= (uint64)36864000;
@@ -2439,8 +2313,8 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				seconds = (temp / 1000000) & 0xffffffff;
 				usec = (temp % 1000000) & 0xffffffff;
 				
-				psx_ram[a1] = LE32(seconds);
-				psx_ram[a2] = LE32(usec);
+				cpu->psx_ram[a1] = LE32(seconds);
+				cpu->psx_ram[a2] = LE32(usec);
 			}
 				break;
 				
@@ -2454,7 +2328,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 		switch (callnum)
 		{
 			case 4:	// CreateEventFlag
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 #if DEBUG_HLE_IOP
 				printf("IOP: CreateEventFlag(%08x) (PC=%x)\n", a0, mipsinfo.i);
 #endif
@@ -2462,18 +2336,18 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				a0 &= 0x1fffff;
 				a0 /= 4;
 				
-				evflags[iNumFlags].type = LE32(psx_ram[a0]);
-				evflags[iNumFlags].value = LE32(psx_ram[a0+1]);
-				evflags[iNumFlags].param = LE32(psx_ram[a0+2]);
-				evflags[iNumFlags].inUse = 1;
+				cpu->evflags[cpu->iNumFlags].type = LE32(cpu->psx_ram[a0]);
+				cpu->evflags[cpu->iNumFlags].value = LE32(cpu->psx_ram[a0+1]);
+				cpu->evflags[cpu->iNumFlags].param = LE32(cpu->psx_ram[a0+2]);
+				cpu->evflags[cpu->iNumFlags].inUse = 1;
 				
 #if DEBUG_HLE_IOP
-				printf("     Flag %02d: type %d init %08x param %08x\n", iNumFlags, evflags[iNumFlags].type, evflags[iNumFlags].value, evflags[iNumFlags].param);
+				printf("     Flag %02d: type %d init %08x param %08x\n", cpu->iNumFlags, cpu->evflags[cpu->iNumFlags].type, cpu->evflags[cpu->iNumFlags].value, cpu->evflags[cpu->iNumFlags].param);
 #endif
 				
-				mipsinfo.i = iNumFlags+1;
-				iNumFlags++;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mipsinfo.i = cpu->iNumFlags+1;
+				cpu->iNumFlags++;
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 6: // SetEventFlag
@@ -2482,10 +2356,10 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: SetEventFlag(%d %08x)\n", a0, a1);
 #endif
 				
-				evflags[a0].value |= a1;
+				cpu->evflags[a0].value |= a1;
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 7: // iSetEventFlag
@@ -2494,31 +2368,31 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: iSetEventFlag(%08x %08x)\n", a0, a1);
 #endif
 				
-				evflags[a0].value |= a1;
+				cpu->evflags[a0].value |= a1;
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				
-				for (i=0; i < iNumThreads; i++)
+				for (i=0; i < cpu->iNumThreads; i++)
 				{
-					if ((threads[i].iState == TS_WAITEVFLAG) && (threads[i].waitparm == a0))
+					if ((cpu->threads[i].iState == TS_WAITEVFLAG) && (cpu->threads[i].waitparm == a0))
 					{
-						threads[i].iState = TS_READY;	
+						cpu->threads[i].iState = TS_READY;	
 					}
 				}
 				break;
 				
 			case 8:	// ClearEventFlag
 				a0--;
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 #if DEBUG_HLE_IOP
 				printf("IOP: ClearEventFlag(%d %08x) (PC=%x)\n", a0, a1, mipsinfo.i);
 #endif
 				
-				evflags[a0].value &= a1;
+				cpu->evflags[a0].value &= a1;
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 9: // iClearEventFlag
@@ -2527,33 +2401,33 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: iClearEventFlag(%d %08x)\n", a0, a1);
 #endif
 				
-				evflags[a0].value &= a1;
+				cpu->evflags[a0].value &= a1;
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 10:// WaitEventFlag
 				a0--;
 #if DEBUG_HLE_IOP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 				printf("IOP: WaitEventFlag(%d %08x %d %08x PC=%x)\n", a0, a1, a2, a3, mipsinfo.i);
 #endif
 				
 				// if we're not set, freeze this thread
-				if (!(evflags[a0].value & a1))
+				if (!(cpu->evflags[a0].value & a1))
 				{
-					FreezeThread(iCurThread, 1);
-					threads[iCurThread].iState = TS_WAITEVFLAG;
-					threads[iCurThread].waitparm = a0;
-					iCurThread = -1;
+					FreezeThread(cpu, cpu->iCurThread, 1);
+					cpu->threads[cpu->iCurThread].iState = TS_WAITEVFLAG;
+					cpu->threads[cpu->iCurThread].waitparm = a0;
+					cpu->iCurThread = -1;
 					
-					ps2_reschedule();
+					ps2_reschedule(cpu);
 				}
 				else
 				{
 					mipsinfo.i = 0;
-					mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+					mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				}
 				break;
 				
@@ -2576,7 +2450,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				mipsinfo.i = -1;
 				for (i = 0; i < SEMA_MAX; i++)
 				{
-					if (!semaphores[i].inuse)
+					if (!cpu->semaphores[i].inuse)
 					{
 						mipsinfo.i = i;
 						break;
@@ -2595,31 +2469,31 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				
 				if (mipsinfo.i != -1)
 				{
-					semaphores[mipsinfo.i].attr = LE32(psx_ram[a0]);
-					semaphores[mipsinfo.i].option = LE32(psx_ram[a0+1]);
-					semaphores[mipsinfo.i].init = LE32(psx_ram[a0+2]);
-					semaphores[mipsinfo.i].max = LE32(psx_ram[a0+3]);
+					cpu->semaphores[mipsinfo.i].attr = LE32(cpu->psx_ram[a0]);
+					cpu->semaphores[mipsinfo.i].option = LE32(cpu->psx_ram[a0+1]);
+					cpu->semaphores[mipsinfo.i].init = LE32(cpu->psx_ram[a0+2]);
+					cpu->semaphores[mipsinfo.i].max = LE32(cpu->psx_ram[a0+3]);
 					
-					semaphores[mipsinfo.i].current = semaphores[mipsinfo.i].init;
+					cpu->semaphores[mipsinfo.i].current = cpu->semaphores[mipsinfo.i].init;
 					
-					semaphores[mipsinfo.i].inuse = 1;
+					cpu->semaphores[mipsinfo.i].inuse = 1;
 				}
 				
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 6: // SignalSema
 #if DEBUG_HLE_IOP
-				printf("IOP: SignalSema(%d) (current %d)\n", a0, semaphores[a0].current);
+				printf("IOP: SignalSema(%d) (current %d)\n", a0, cpu->semaphores[a0].current);
 #endif
 				
 				foundthread = 0;
-				for (i=0; i < iNumThreads; i++)
+				for (i=0; i < cpu->iNumThreads; i++)
 				{
-					if ((threads[i].iState == TS_WAITSEMA) && (threads[i].waitparm == a0))
+					if ((cpu->threads[i].iState == TS_WAITSEMA) && (cpu->threads[i].waitparm == a0))
 					{
-						threads[i].iState = TS_READY;	
-						semaphores[a0].threadsWaiting--;
+						cpu->threads[i].iState = TS_READY;	
+						cpu->semaphores[a0].threadsWaiting--;
 						foundthread = 1;
 						break;
 					}
@@ -2629,9 +2503,9 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				
 				if (!foundthread)
 				{
-					if (semaphores[a0].current < semaphores[a0].max)
+					if (cpu->semaphores[a0].current < cpu->semaphores[a0].max)
 					{
-						semaphores[a0].current++;
+						cpu->semaphores[a0].current++;
 					}
 					else
 					{
@@ -2639,7 +2513,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 					}
 				}
 				
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 7: // iSignalSema
@@ -2648,12 +2522,12 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				
 				foundthread = 0;
-				for (i=0; i < iNumThreads; i++)
+				for (i=0; i < cpu->iNumThreads; i++)
 				{
-					if ((threads[i].iState == TS_WAITSEMA) && (threads[i].waitparm == a0))
+					if ((cpu->threads[i].iState == TS_WAITSEMA) && (cpu->threads[i].waitparm == a0))
 					{
-						threads[i].iState = TS_READY;	
-						semaphores[a0].threadsWaiting--;
+						cpu->threads[i].iState = TS_READY;	
+						cpu->semaphores[a0].threadsWaiting--;
 						foundthread = 1;
 						break;
 					}
@@ -2663,9 +2537,9 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				
 				if (!foundthread)
 				{
-					if (semaphores[a0].current < semaphores[a0].max)
+					if (cpu->semaphores[a0].current < cpu->semaphores[a0].max)
 					{
-						semaphores[a0].current++;
+						cpu->semaphores[a0].current++;
 					}
 					else
 					{
@@ -2673,29 +2547,29 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 					}
 				}
 				
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 8: // WaitSema
 #if DEBUG_HLE_IOP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
-				printf("IOP: WaitSema(%d) (cnt %d) (th %d) (PC=%x)\n", a0, iCurThread, semaphores[a0].current, mipsinfo.i);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				printf("IOP: WaitSema(%d) (cnt %d) (th %d) (PC=%x)\n", a0, cpu->iCurThread, cpu->semaphores[a0].current, mipsinfo.i);
 #endif
 				
-				if (semaphores[a0].current > 0)
+				if (cpu->semaphores[a0].current > 0)
 				{
-					semaphores[a0].current--;
+					cpu->semaphores[a0].current--;
 				}
 				else
 				{
-					FreezeThread(iCurThread, 1);
-					threads[iCurThread].iState = TS_WAITSEMA;
-					threads[iCurThread].waitparm = a0;
-					ps2_reschedule();
+					FreezeThread(cpu, cpu->iCurThread, 1);
+					cpu->threads[cpu->iCurThread].iState = TS_WAITSEMA;
+					cpu->threads[cpu->iCurThread].waitparm = a0;
+					ps2_reschedule(cpu);
 				}
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			default:
@@ -2718,12 +2592,12 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 					printf("IOP: AllocHardTimer doesn't support 16-bit timers!\n");
 				}
 				
-				iop_timers[iNumTimers].source = a0;
-				iop_timers[iNumTimers].prescale = a2;
+				cpu->iop_timers[cpu->iNumTimers].source = a0;
+				cpu->iop_timers[cpu->iNumTimers].prescale = a2;
 				
-				mipsinfo.i = iNumTimers+1;
-				iNumTimers++;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mipsinfo.i = cpu->iNumTimers+1;
+				cpu->iNumTimers++;
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 6: // FreeHardTimer
@@ -2731,12 +2605,12 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: FreeHardTimer(%d)\n", a0);
 #endif
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 10:// GetTimerCounter
-				mipsinfo.i = iop_timers[a0-1].count;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mipsinfo.i = cpu->iop_timers[a0-1].count;
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 20: // SetTimerHandler
@@ -2745,12 +2619,12 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				// id, compare, handler, common (last is param for handler)
 				
-				iop_timers[a0-1].target = a1;
-				iop_timers[a0-1].handler = a2;
-				iop_timers[a0-1].hparam = a3;
+				cpu->iop_timers[a0-1].target = a1;
+				cpu->iop_timers[a0-1].handler = a2;
+				cpu->iop_timers[a0-1].hparam = a3;
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 22: // SetupHardTimer
@@ -2759,12 +2633,12 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				// id, source, mode, prescale
 				
-				iop_timers[a0-1].source = a1;
-				iop_timers[a0-1].mode = a2;
-				iop_timers[a0-1].prescale = a3;
+				cpu->iop_timers[a0-1].source = a1;
+				cpu->iop_timers[a0-1].mode = a2;
+				cpu->iop_timers[a0-1].prescale = a3;
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 23: // StartHardTimer
@@ -2772,11 +2646,11 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: StartHardTimer(%d)\n", a0);
 #endif
 				
-				iop_timers[a0-1].iActive = 1;
-				iop_timers[a0-1].count = 0;
+				cpu->iop_timers[a0-1].iActive = 1;
+				cpu->iop_timers[a0-1].count = 0;
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 24: // StopHardTimer
@@ -2784,10 +2658,10 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: StopHardTimer(%d)\n", a0);
 #endif
 				
-				iop_timers[a0-1].iActive = 0;
+				cpu->iop_timers[a0-1].iActive = 0;
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			default:
@@ -2807,8 +2681,8 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: memcpy(%08x, %08x, %d)\n", a0, a1, a2);
 #endif
 				
-				dst = (uint8 *)&psx_ram[(a0&0x1fffff)/4];
-				src = (uint8 *)&psx_ram[(a1&0x1fffff)/4];
+				dst = (uint8 *)&cpu->psx_ram[(a0&0x1fffff)/4];
+				src = (uint8 *)&cpu->psx_ram[(a1&0x1fffff)/4];
 				// get exact byte alignment
 				dst += a0 % 4;
 				src += a1 % 4;
@@ -2823,7 +2697,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				
 				// v0 = a0
 				mipsinfo.i = a0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -2835,8 +2709,8 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: memmove(%08x, %08x, %d)\n", a0, a1, a2);
 #endif
 				
-				dst = (uint8 *)&psx_ram[(a0&0x1fffff)/4];
-				src = (uint8 *)&psx_ram[(a1&0x1fffff)/4];
+				dst = (uint8 *)&cpu->psx_ram[(a0&0x1fffff)/4];
+				src = (uint8 *)&cpu->psx_ram[(a1&0x1fffff)/4];
 				// get exact byte alignment
 				dst += a0 % 4;
 				src += a1 % 4;
@@ -2854,7 +2728,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				
 				// v0 = a0
 				mipsinfo.i = a0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -2863,11 +2737,11 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				uint8 *dst;
 				
 #if DEBUG_HLE_IOP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 				printf("IOP: memset(%08x, %02x, %d) [PC=%x]\n", a0, a1, a2, mipsinfo.i);
 #endif
 				
-				dst = (uint8 *)&psx_ram[(a0&0x1fffff)/4];
+				dst = (uint8 *)&cpu->psx_ram[(a0&0x1fffff)/4];
 				dst += (a0 & 3);
 				
 				memset(dst, a1, a2);
@@ -2882,25 +2756,25 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: bzero(%08x, %08x)\n", a0, a1);
 #endif
 				
-				dst = (uint8 *)&psx_ram[(a0&0x1fffff)/4];
+				dst = (uint8 *)&cpu->psx_ram[(a0&0x1fffff)/4];
 				dst += (a0 & 3);
 				memset(dst, 0, a1);
 			}
 				break;
 				
 			case 19:	// sprintf
-				mname = (char *)psx_ram;
-				str1 = (char *)psx_ram;
+				mname = (char *)cpu->psx_ram;
+				str1 = (char *)cpu->psx_ram;
 				mname += a0 & 0x1fffff;
 				str1 += a1 & 0x1fffff;
 				
 #if DEBUG_HLE_IOP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 				printf("IOP: sprintf(%08x, %s, ...) [PC=%08x]\n", a0, str1, (uint32)mipsinfo.i);
 				printf("%x %x %x %x\n", a0, a1, a2, a3);
 #endif
 				
-				iop_sprintf(mname, str1, CPUINFO_INT_REGISTER + MIPS_R6);	// a2 is first parameter
+				iop_sprintf(cpu, mname, str1, CPUINFO_INT_REGISTER + MIPS_R6);	// a2 is first parameter
 				
 #if DEBUG_HLE_IOP
 				printf("     = [%s]\n", mname);
@@ -2915,8 +2789,8 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: strcpy(%08x, %08x)\n", a0, a1);
 #endif
 				
-				dst = (uint8 *)&psx_ram[(a0&0x1fffff)/4];
-				src = (uint8 *)&psx_ram[(a1&0x1fffff)/4];
+				dst = (uint8 *)&cpu->psx_ram[(a0&0x1fffff)/4];
+				src = (uint8 *)&cpu->psx_ram[(a1&0x1fffff)/4];
 				// get exact byte alignment
 				dst += a0 % 4;
 				src += a1 % 4;
@@ -2931,7 +2805,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				
 				// v0 = a0
 				mipsinfo.i = a0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -2940,14 +2814,14 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				char *dst;
 				
 #if DEBUG_HLE_IOP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 				printf("IOP: strlen(%08x) [PC=%x]\n", a0, mipsinfo.i);
 #endif
 				
-				dst = (char *)&psx_ram[(a0&0x1fffff)/4];
+				dst = (char *)&cpu->psx_ram[(a0&0x1fffff)/4];
 				dst += (a0 & 3);
 				mipsinfo.i = strlen(dst);
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
@@ -2959,8 +2833,8 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: strncpy(%08x, %08x, %d)\n", a0, a1, a2);
 #endif
 				
-				dst = (char *)&psx_ram[(a0&0x1fffff)/4];
-				src = (char *)&psx_ram[(a1&0x1fffff)/4];
+				dst = (char *)&cpu->psx_ram[(a0&0x1fffff)/4];
+				src = (char *)&cpu->psx_ram[(a1&0x1fffff)/4];
 				// get exact byte alignment
 				dst += a0 % 4;
 				src += a1 % 4;
@@ -2976,13 +2850,13 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				
 				// v0 = a0
 				mipsinfo.i = a0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 			}
 				break;
 				
 				
 			case 36:	// strtol
-				mname = (char *)&psx_ram[(a0 & 0x1fffff)/4];
+				mname = (char *)&cpu->psx_ram[(a0 & 0x1fffff)/4];
 				mname += (a0 & 3);
 				
 				if (a1)
@@ -2991,7 +2865,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				}
 				
 				mipsinfo.i = strtol(mname, NULL, a2);
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			default:
@@ -3010,25 +2884,25 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				
 				if (a0 == 9)
 				{
-					irq9_fval = a1;
-					irq9_cb = a2;
-					irq9_flag = a3;
+					cpu->irq9_fval = a1;
+					cpu->irq9_cb = a2;
+					cpu->irq9_flag = a3;
 				}
 				
 				// DMA4?
 				if (a0 == 36)
 				{
-					dma4_fval = a1;
-					dma4_cb = a2;
-					dma4_flag = a3;
+					cpu->dma4_fval = a1;
+					cpu->dma4_cb = a2;
+					cpu->dma4_flag = a3;
 				}
 				
 				// DMA7?
 				if (a0 == 40)
 				{
-					dma7_fval = a1;
-					dma7_cb = a2;
-					dma7_flag = a3;
+					cpu->dma7_fval = a1;
+					cpu->dma7_cb = a2;
+					cpu->dma7_flag = a3;
 				}
 				break;
 				
@@ -3068,7 +2942,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				
 				// if already suspended, return an error code
-				if (intr_susp)
+				if (cpu->intr_susp)
 				{
 					mipsinfo.i = -102;
 				}
@@ -3076,26 +2950,26 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				{
 					mipsinfo.i = 0;
 				}
-				intr_susp = 1;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				cpu->intr_susp = 1;
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 18:	// CpuResumeIntr
 #if DEBUG_HLE_IOP
 				printf("IOP: CpuResumeIntr\n");
 #endif
-				intr_susp = 0;
+				cpu->intr_susp = 0;
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 23:	// QueryIntrContext
 #if DEBUG_HLE_IOP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 				printf("IOP: QueryIntrContext(PC=%x)\n", mipsinfo.i);
 #endif
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			default:
@@ -3116,21 +2990,21 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 			case 6:	// RegisterLibraryEntries
 				a0 &= 0x1fffff;
 #if DEBUG_HLE_IOP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 				printf("IOP: RegisterLibraryEntries(%08x) (PC=%x)\n", a0, mipsinfo.i);
 #endif
 				
-				if (psx_ram[a0/4] == LE32(0x41c00000))
+				if (cpu->psx_ram[a0/4] == LE32(0x41c00000))
 				{
 					a0 += 3*4;
-					memcpy(&reglibs[iNumLibs].name, &psx_ram[a0/4], 8);
-					reglibs[iNumLibs].name[8] = '\0';
+					memcpy(&cpu->reglibs[cpu->iNumLibs].name, &cpu->psx_ram[a0/4], 8);
+					cpu->reglibs[cpu->iNumLibs].name[8] = '\0';
 #if DEBUG_HLE_IOP
-					printf("Lib name [%s]\n", &reglibs[iNumLibs].name);
+					printf("Lib name [%s]\n", &cpu->reglibs[cpu->iNumLibs].name);
 #endif
 					a0 += 2*4;
-					reglibs[iNumLibs].dispatch = a0;
-					iNumLibs++;
+					cpu->reglibs[cpu->iNumLibs].dispatch = a0;
+					cpu->iNumLibs++;
 				}
 				else
 				{
@@ -3139,7 +3013,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				}
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			default:
@@ -3154,7 +3028,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 		switch (callnum)
 		{
 			case 4:	// AllocMemory
-				newAlloc = psf2_get_loadaddr();
+				newAlloc = psf2_get_loadaddr(cpu);
 				// make sure we're 16-byte aligned
 				if (newAlloc & 15)
 				{
@@ -3168,14 +3042,14 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 					a1 += 16;
 				}
 				
-				psf2_set_loadaddr(newAlloc + a1);
+				psf2_set_loadaddr(cpu, newAlloc + a1);
 				
 #if DEBUG_HLE_IOP
 				printf("IOP: AllocMemory(%d, %d, %x) = %08x\n", a0, a1, a2, newAlloc|0x80000000);
 #endif
 				
 				mipsinfo.i = newAlloc; // | 0x80000000;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 5:	// FreeMemory
@@ -3189,8 +3063,8 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: QueryMaxFreeMemSize\n");
 #endif
 				
-				mipsinfo.i = (2*1024*1024) - psf2_get_loadaddr();
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mipsinfo.i = (2*1024*1024) - psf2_get_loadaddr(cpu);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 8:	// QueryTotalFreeMemSize
@@ -3198,16 +3072,16 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				printf("IOP: QueryTotalFreeMemSize\n");
 #endif
 				
-				mipsinfo.i = (2*1024*1024) - psf2_get_loadaddr();
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mipsinfo.i = (2*1024*1024) - psf2_get_loadaddr(cpu);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 14: // Kprintf
-				mname = (char *)psx_ram;
+				mname = (char *)cpu->psx_ram;
 				mname += a0 & 0x1fffff;
 				mname += (a0 & 3);
 				
-				iop_sprintf(out, mname, CPUINFO_INT_REGISTER + MIPS_R5);	// a1 is first parm
+				iop_sprintf(cpu, out, mname, CPUINFO_INT_REGISTER + MIPS_R5);	// a1 is first parm
 				
 				if (out[strlen(out)-1] != '\n')
 				{
@@ -3228,7 +3102,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 			}
 				
 #if DEBUG_HLE_IOP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 				printf("KTTY: %s [PC=%x]\n", out, mipsinfo.i);
 #endif
 				break;
@@ -3246,35 +3120,35 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 		switch (callnum)
 		{
 			case 7:	// LoadStartModule
-				mname = (char *)&psx_ram[(a0 & 0x1fffff)/4];
+				mname = (char *)&cpu->psx_ram[(a0 & 0x1fffff)/4];
 				mname += 8;
-				str1 = (char *)&psx_ram[(a2 & 0x1fffff)/4];
+				str1 = (char *)&cpu->psx_ram[(a2 & 0x1fffff)/4];
 #if DEBUG_HLE_IOP
 				printf("LoadStartModule: %s\n", mname);
 #endif
 				
 				// get 2k for our parameters
-				newAlloc = psf2_get_loadaddr();
+				newAlloc = psf2_get_loadaddr(cpu);
 				// force 16-byte alignment
 				if (newAlloc & 0xf)
 				{
 					newAlloc &= ~0xf;
 					newAlloc += 16;
 				}
-				psf2_set_loadaddr(newAlloc + 2048);
+				psf2_set_loadaddr(cpu, newAlloc + 2048);
 				
 				tempmem = (uint8 *)malloc(2*1024*1024);
-				if (psf2_load_file(mname, tempmem, 2*1024*1024) != 0xffffffff)
+				if (psf2_load_file(cpu, mname, tempmem, 2*1024*1024) != 0xffffffff)
 				{
 					uint32 start;
 					int i;
 					
-					start = psf2_load_elf(tempmem, 2*1024*1024);
+					start = psf2_load_elf(cpu, tempmem, 2*1024*1024);
 					
 					if (start != 0xffffffff)
 					{
 						uint32 args[20], numargs = 1, argofs;
-						uint8 *argwalk = (uint8 *)psx_ram, *argbase;
+						uint8 *argwalk = (uint8 *)cpu->psx_ram, *argbase;
 						
 						argwalk += (a2 & 0x1fffff);
 						argbase = argwalk;
@@ -3306,19 +3180,19 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #if DEBUG_HLE_IOP
 							//							printf("Arg %d: %08x [%s]\n", i, args[i], &argbase[args[i]-a2]); 
 #endif
-							psx_ram[(newAlloc/4)+i] = LE32(args[i]);
+							cpu->psx_ram[(newAlloc/4)+i] = LE32(args[i]);
 						}
 						
 						// set argv and argc
 						mipsinfo.i = numargs;
-						mips_set_info(CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
+						mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R4, &mipsinfo);
 						mipsinfo.i = 0x80000000 | newAlloc;
-						mips_set_info(CPUINFO_INT_REGISTER + MIPS_R5, &mipsinfo);
+						mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R5, &mipsinfo);
 						
 						// leave RA alone, PC = module start
 						// (NOTE: we get called in the delay slot!)
 						mipsinfo.i = start - 4;
-						mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+						mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 					}
 				}
 				free(tempmem);
@@ -3341,7 +3215,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				slot2use = -1;
 				for (i = 0; i < MAX_FILE_SLOTS; i++)
 				{
-					if (filestat[i] == 0)
+					if (cpu->filestat[i] == 0)
 					{
 						slot2use = i;
 						break;
@@ -3352,11 +3226,11 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				{
 					printf("IOP: out of file slots!\n");
 					mipsinfo.i = 0xffffffff;
-					mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+					mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 					return;
 				}
 				
-				mname = (char *)psx_ram;
+				mname = (char *)cpu->psx_ram;
 				mname += (a0 & 0x1fffff);
 				
 				if (!strncmp(mname, "aofile:", 7))
@@ -3372,46 +3246,46 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 					mname += 7;
 				}
 				
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 #if DEBUG_HLE_IOP
 				printf("IOP: open(\"%s\") (PC=%08x)\n", mname, mipsinfo.i);
 #endif
 				
-				filedata[slot2use] = malloc(6*1024*1024);
-				filesize[slot2use] = psf2_load_file(mname, filedata[slot2use], 6*1024*1024);
-				filepos[slot2use] = 0;
-				filestat[slot2use] = 1;
+				cpu->filedata[slot2use] = malloc(6*1024*1024);
+				cpu->filesize[slot2use] = psf2_load_file(cpu, mname, cpu->filedata[slot2use], 6*1024*1024);
+				cpu->filepos[slot2use] = 0;
+				cpu->filestat[slot2use] = 1;
 				
-				if (filesize[slot2use] == 0xffffffff)
+				if (cpu->filesize[slot2use] == 0xffffffff)
 				{
-					mipsinfo.i = filesize[slot2use];
+					mipsinfo.i = cpu->filesize[slot2use];
 				}
 				else
 				{
 					mipsinfo.i = slot2use;
 				}
 			}
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 5:	// close
 #if DEBUG_HLE_IOP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 				printf("IOP: close(%d) (PC=%08x)\n", a0, mipsinfo.i);
 #endif
-				free(filedata[a0]);
-				filedata[a0] = (uint8 *)NULL;
-				filepos[a0] = 0;
-				filesize[a0] = 0;
-				filestat[a0] = 0;
+				free(cpu->filedata[a0]);
+				cpu->filedata[a0] = (uint8 *)NULL;
+				cpu->filepos[a0] = 0;
+				cpu->filesize[a0] = 0;
+				cpu->filestat[a0] = 0;
 				break;
 				
 			case 6:	// read
 #if DEBUG_HLE_IOP
-				printf("IOP: read(%x %x %d) [pos %d size %d]\n", a0, a1, a2, filepos[a0], filesize[a0]);
+				printf("IOP: read(%x %x %d) [pos %d size %d]\n", a0, a1, a2, cpu->filepos[a0], cpu->filesize[a0]);
 #endif
 				
-				if (filepos[a0] >= filesize[a0])
+				if (cpu->filepos[a0] >= cpu->filesize[a0])
 				{
 					mipsinfo.i = 0;
 				}
@@ -3419,48 +3293,48 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 				{
 					uint8 *rp;
 					
-					if ((filepos[a0] + a2) > filesize[a0])
+					if ((cpu->filepos[a0] + a2) > cpu->filesize[a0])
 					{
-						a2 = filesize[a0] - filepos[a0];
+						a2 = cpu->filesize[a0] - cpu->filepos[a0];
 					}
 					
-					rp = (uint8 *)psx_ram;
+					rp = (uint8 *)cpu->psx_ram;
 					rp += (a1 & 0x1fffff);
-					memcpy(rp, &filedata[a0][filepos[a0]], a2);
+					memcpy(rp, &cpu->filedata[a0][cpu->filepos[a0]], a2);
 					
-					filepos[a0] += a2;
+					cpu->filepos[a0] += a2;
 					mipsinfo.i = a2;
 				}
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 8:	// lseek
 #if DEBUG_HLE_IOP
-				mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+				mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 				printf("IOP: lseek(%d, %d, %s) (PC=%08x)\n", a0, a1, seek_types[a2], mipsinfo.i);
 #endif
 				
 				switch (a2)
 			{
 				case 0:	// SEEK_SET
-					if (a1 <= filesize[a0])
+					if (a1 <= cpu->filesize[a0])
 					{
-						filepos[a0] = a1;
+						cpu->filepos[a0] = a1;
 					}
 					break;
 				case 1:	// SEEK_CUR
-					if ((a1 + filepos[a0]) < filesize[a0])
+					if ((a1 + cpu->filepos[a0]) < cpu->filesize[a0])
 					{
-						filepos[a0] += a1;
+						cpu->filepos[a0] += a1;
 					}
 					break;
 				case 2:	// SEEK_END
-					filepos[a0] = filesize[a0] - a1;
+					cpu->filepos[a0] = cpu->filesize[a0] - a1;
 					break;
 			}
 				
-				mipsinfo.i = filepos[a0];
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mipsinfo.i = cpu->filepos[a0];
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 20:	// AddDrv
@@ -3469,7 +3343,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			case 21:	// DelDrv
@@ -3478,7 +3352,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 				
 				mipsinfo.i = 0;
-				mips_set_info(CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
+				mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_R2, &mipsinfo);
 				break;
 				
 			default:
@@ -3489,30 +3363,30 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 	{
 		int lib;
 		
-		if (iNumLibs > 0)
+		if (cpu->iNumLibs > 0)
 		{
-			for (lib = 0; lib < iNumLibs; lib++)
+			for (lib = 0; lib < cpu->iNumLibs; lib++)
 			{
-				if (!strcmp(name, reglibs[lib].name))
+				if (!strcmp(name, cpu->reglibs[lib].name))
 				{
 #if DEBUG_HLE_IOP
 					uint32 PC;
 					
-					mips_get_info(CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
+					mips_get_info(cpu, CPUINFO_INT_REGISTER + MIPS_R31, &mipsinfo);
 					PC = mipsinfo.i;
 #endif
 					
 					// zap the delay slot handling
 					mipsinfo.i = 0;
-					mips_set_info(CPUINFO_INT_REGISTER + MIPS_DELAYV, &mipsinfo);
-					mips_set_info(CPUINFO_INT_REGISTER + MIPS_DELAYR, &mipsinfo);
+					mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_DELAYV, &mipsinfo);
+					mips_set_info(cpu, CPUINFO_INT_REGISTER + MIPS_DELAYR, &mipsinfo);
 					
-					mipsinfo.i = LE32(psx_ram[(reglibs[lib].dispatch/4) + callnum]);
+					mipsinfo.i = LE32(cpu->psx_ram[(cpu->reglibs[lib].dispatch/4) + callnum]);
 					
 					// (NOTE: we get called in the delay slot!)
 #if DEBUG_HLE_IOP
 					printf("IOP: Calling %s (%d) service %d => %08x (parms %08x %08x %08x %08x) (PC=%x)\n",
-						   reglibs[lib].name, 
+						   cpu->reglibs[lib].name, 
 						   lib,
 						   callnum, 
 						   (uint32)mipsinfo.i, 
@@ -3520,7 +3394,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 					
 #if 0
-					if (!strcmp(reglibs[lib].name, "ssd"))
+					if (!strcmp(cpu->reglibs[lib].name, "ssd"))
 					{
 						if (callnum == 37)
 						{
@@ -3530,7 +3404,7 @@ void psx_iop_call(uint32 pc, uint32 callnum)
 #endif
 					
 					mipsinfo.i -= 4;
-					mips_set_info(CPUINFO_INT_PC, &mipsinfo);
+					mips_set_info(cpu, CPUINFO_INT_PC, &mipsinfo);
 					
 					return;
 				}
@@ -61,6 +61,7 @@ that no encryption is used.
 #include <stdlib.h>
 
 #include "ao.h"
+#include "eng_protos.h"
 #include "qsound.h"
 #include "z80.h"
 
@@ -70,28 +71,29 @@ that no encryption is used.
 
 // timer rate is 285 Hz
 static int32 samples_per_tick = 44100/285;
-static int32 samples_to_next_tick = 44100/285;
 
-static corlett_t *c = NULL;
-static char qsfby[256];
-static uint32 skey1, skey2;
-static uint16 akey;
-static uint8  xkey;
-static int32 uses_kabuki = 0;
+typedef struct
+{
+	corlett_t *c;
+	char qsfby[256];
+	int32 samples_to_next_tick;
 
-static char *Z80ROM, *QSamples;
-static char RAM[0x1000], RAM2[0x1000];
-static int32 cur_bank;
+	uint32 skey1, skey2;
+	uint16 akey;
+	uint8  xkey;
+	int32 uses_kabuki;
 
-static struct QSound_interface qsintf = 
-{
-	QSOUND_CLOCK,
-	NULL
-};
+	char *Z80ROM, *QSamples;
+	char RAM[0x1000], RAM2[0x1000];
+	int32 cur_bank;
+
+	Z80_Regs *z80;
+	void *qsound;
+} qsf_synth_t;
 
 extern void cps1_decode(unsigned char *rom, int swap_key1,int swap_key2,int addr_key,int xor_key);
 
-static void qsf_walktags(uint8 *buffer, uint8 *end)
+static void qsf_walktags(qsf_synth_t *s, uint8 *buffer, uint8 *end)
 {
 	uint8 *cbuf = buffer;
 	uint32 offset, length;
@@ -111,18 +113,18 @@ static void qsf_walktags(uint8 *buffer, uint8 *end)
 		switch (cbuf[0])
 		{
 			case 'Z':
-				memcpy(&Z80ROM[offset], &cbuf[11], length);
+				memcpy(&s->Z80ROM[offset], &cbuf[11], length);
 				break;
 
 			case 'S':
-				memcpy(&QSamples[offset], &cbuf[11], length);
+				memcpy(&s->QSamples[offset], &cbuf[11], length);
 				break;
 
 			case 'K':
-				skey1 = cbuf[11]<<24 | cbuf[12]<<16 | cbuf[13]<<8 | cbuf[14];
-				skey2 = cbuf[15]<<24 | cbuf[16]<<16 | cbuf[17]<<8 | cbuf[18];
-				akey = cbuf[19]<<8 | cbuf[20];
-				xkey = cbuf[20];
+				s->skey1 = cbuf[11]<<24 | cbuf[12]<<16 | cbuf[13]<<8 | cbuf[14];
+				s->skey2 = cbuf[15]<<24 | cbuf[16]<<16 | cbuf[17]<<8 | cbuf[18];
+				s->akey = cbuf[19]<<8 | cbuf[20];
+				s->xkey = cbuf[20];
 				break;
 
 			default:
@@ -140,30 +142,39 @@ static int32 qsf_irq_cb(int param)
 	return 0x000000ff;	// RST_38
 }
 
-int32 qsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultlength)
+void *qsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultlength)
 {
+	qsf_synth_t *s;
+	corlett_t *c;
 	uint8 *file, *lib_decoded, *lib_raw_file;
 	uint64 file_len, lib_len, lib_raw_length;
 	corlett_t *lib;
+	struct QSound_interface qsintf;
 
-	z80_init();
-
-	Z80ROM = malloc(512*1024);
-	QSamples = malloc(8*1024*1024);
+	// keys, bank and both RAMs start cleared
+	s = calloc(1, sizeof(qsf_synth_t));
+	if (!s)
+	{
+		return NULL;
+	}
 
-	skey1 = skey2 = 0;
-	akey = 0;
-	xkey = 0;
-	cur_bank = 0;
+	s->z80 = z80_init(s);
+	s->Z80ROM = malloc(512*1024);
+	s->QSamples = malloc(8*1024*1024);
+	s->samples_to_next_tick = samples_per_tick;
+	if (!s->z80 || !s->Z80ROM || !s->QSamples)
+	{
+		qsf_stop(s);
+		return NULL;
+	}
 
-	memset(RAM, 0, 0x1000);
-	memset(RAM2, 0, 0x1000);
-		
 	// Decode the current QSF
-	if (corlett_decode(buffer, length, &file, &file_len, &c) != AO_SUCCESS)
+	if (corlett_decode(buffer, length, &file, &file_len, &s->c) != AO_SUCCESS)
 	{
-		return AO_FAIL;
+		qsf_stop(s);
+		return NULL;
 	}
+	c = s->c;
 
 	// Get the library file
 	if (c->lib[0] != 0)
@@ -175,43 +186,47 @@ int32 qsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 		#endif
 		if (ao_get_lib(c->lib, &lib_raw_file, &tmp_length) != AO_SUCCESS)
 		{
-			return AO_FAIL;
+			free(file);
+			qsf_stop(s);
+			return NULL;
 		}
 		lib_raw_length = tmp_length;
 		
 		if (corlett_decode(lib_raw_file, lib_raw_length, &lib_decoded, &lib_len, &lib) != AO_SUCCESS)
 		{
 			free(lib_raw_file);
-			return AO_FAIL;
+			free(file);
+			qsf_stop(s);
+			return NULL;
 		}
 				
 		// Free up raw file
 		free(lib_raw_file);
 
 		// use the contents
-		qsf_walktags(lib_decoded, lib_decoded+lib_len);
+		qsf_walktags(s, lib_decoded, lib_decoded+lib_len);
 		
 		// Dispose the corlett structure for the lib - we don't use it
 		free(lib);
 	}
 
 	// now patch the file into RAM OVER the libraries
-	qsf_walktags(file, file+file_len);
+	qsf_walktags(s, file, file+file_len);
 
 	free(file);
 
-	if ((skey1 != 0) && (skey2 != 0))
+	if ((s->skey1 != 0) && (s->skey2 != 0))
 	{
 		#if DEBUG_LOADER
-		printf("Decoding Kabuki: skey1 %08x skey2 %08x akey %04x xkey %02x\n", skey1, skey2, akey, xkey);
+		printf("Decoding Kabuki: skey1 %08x skey2 %08x akey %04x xkey %02x\n", s->skey1, s->skey2, s->akey, s->xkey);
 		#endif
 
-		uses_kabuki = 1;
-		cps1_decode((unsigned char *)Z80ROM, skey1, skey2, akey, xkey);
+		s->uses_kabuki = 1;
+		cps1_decode((unsigned char *)s->Z80ROM, s->skey1, s->skey2, s->akey, s->xkey);
 	}
 
 	// set qsfby tag
-	strcpy(qsfby, "n/a");
+	strcpy(s->qsfby, "n/a");
 	if (c)
 	{
 		int i;
@@ -219,27 +234,35 @@ int32 qsf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 		{
 			if (!strcasecmp(c->tag_name[i], "qsfby"))
 			{
-				strcpy(qsfby, c->tag_data[i]);
+				strcpy(s->qsfby, c->tag_data[i]);
 			}
 		}
 	}
 
-	z80_reset(NULL);
-	z80_set_irq_callback(qsf_irq_cb);
-	qsintf.sample_rom = QSamples;
-	qsound_sh_start(&qsintf);
+	z80_reset(s->z80, NULL);
+	z80_set_irq_callback(s->z80, qsf_irq_cb);
+	qsintf.clock = QSOUND_CLOCK;
+	qsintf.sample_rom = s->QSamples;
+	s->qsound = qsound_sh_start(&qsintf);
+	if (!s->qsound)
+	{
+		qsf_stop(s);
+		return NULL;
+	}
 
-	return AO_SUCCESS;
+	return s;
 }
 
-static void timer_tick(void)
+static void timer_tick(qsf_synth_t *s)
 {
-	z80_set_irq_line(0, ASSERT_LINE);
-	z80_set_irq_line(0, CLEAR_LINE);
+	z80_set_irq_line(s->z80, 0, ASSERT_LINE);
+	z80_set_irq_line(s->z80, 0, CLEAR_LINE);
 }
 
-int32 qsf_gen(int16 *buffer, uint32 samples)
+int32 qsf_gen(void *handle, int16 *buffer, uint32 samples)
 {	
+	qsf_synth_t *s = handle;
+	int32 samples_to_next_tick = s->samples_to_next_tick;
 	int16 output[44100/30], output2[44100/30];
 	int16 *stereo[2];
 	int16 *outp = buffer;
@@ -260,17 +283,17 @@ int32 qsf_gen(int16 *buffer, uint32 samples)
 
 	for (i = 0; i < loops; i++)
 	{
-		z80_execute((8000000/44100)*tickinc);
+		z80_execute(s->z80, (8000000/44100)*tickinc);
 		stereo[0] = &output[opos];
 		stereo[1] = &output2[opos];
-		qsound_update(0, stereo, tickinc);
+		qsound_update(s->qsound, stereo, tickinc);
 
 		opos += tickinc;
 		samples_to_next_tick -= tickinc;
 
 		if (samples_to_next_tick <= 0)
 		{
-			timer_tick();
+			timer_tick(s);
 			samples_to_next_tick = samples_per_tick;
 		}
 	}
@@ -278,16 +301,16 @@ int32 qsf_gen(int16 *buffer, uint32 samples)
 	// are there "leftovers"?
 	if (opos < samples)
 	{
-		z80_execute((8000000/44100)*(samples-opos));
+		z80_execute(s->z80, (8000000/44100)*(samples-opos));
 		stereo[0] = &output[opos];
 		stereo[1] = &output2[opos];
-		qsound_update(0, stereo, (samples-opos));
+		qsound_update(s->qsound, stereo, (samples-opos));
 
 		samples_to_next_tick -= (samples-opos);
 
 		if (samples_to_next_tick <= 0)
 		{
-			timer_tick();
+			timer_tick(s);
 			samples_to_next_tick = samples_per_tick;
 		}
 	}
@@ -297,19 +320,29 @@ int32 qsf_gen(int16 *buffer, uint32 samples)
 		*outp++ = output[i];
 		*outp++ = output2[i];
 	}
+	s->samples_to_next_tick = samples_to_next_tick;
 
 	return AO_SUCCESS;
 }
 
-int32 qsf_stop(void)
+int32 qsf_stop(void *handle)
 {
-	free(Z80ROM);
-	free(QSamples);
+	qsf_synth_t *s = handle;
+
+	qsound_sh_stop(s->qsound);
+	if (s->z80)
+	{
+		z80_exit(s->z80);
+	}
+	free(s->Z80ROM);
+	free(s->QSamples);
+	free(s->c);
+	free(s);
 
 	return AO_SUCCESS;
 }
 
-int32 qsf_command(int32 command, int32 parameter)
+int32 qsf_command(void *handle, int32 command, int32 parameter)
 {
 	switch (command)
 	{
@@ -320,8 +353,11 @@ int32 qsf_command(int32 command, int32 parameter)
 	return AO_FAIL;
 }
 
-int32 qsf_fill_info(ao_display_info *info)
+int32 qsf_fill_info(void *handle, ao_display_info *info)
 {
+	qsf_synth_t *s = handle;
+	corlett_t *c = s->c;
+
 	if (c == NULL)
 		return AO_FAIL;
 		
@@ -347,7 +383,7 @@ int32 qsf_fill_info(ao_display_info *info)
 	sprintf(info->info[7], "%s", c->inf_fade);
 
 	strcpy(info->title[8], "Ripper: ");
-	sprintf(info->info[8], "%s", qsfby);
+	sprintf(info->info[8], "%s", s->qsfby);
 	
 	info->length_ms=psfTimeToMS(c->inf_length);
 	info->fade_ms=psfTimeToMS(c->inf_fade);
@@ -355,91 +391,99 @@ int32 qsf_fill_info(ao_display_info *info)
 	return AO_SUCCESS;
 }
 
-uint8 qsf_memory_read(uint16 addr)
+uint8 qsf_memory_read(void *param, uint16 addr)
 {
+	qsf_synth_t *s = param;
+
 	if (addr < 0x8000)
 	{
-		return Z80ROM[addr];
+		return s->Z80ROM[addr];
 	}
 	else if (addr < 0xc000)
 	{
-		return Z80ROM[(addr - 0x8000) + cur_bank];
+		return s->Z80ROM[(addr - 0x8000) + s->cur_bank];
 	}
 	else if (addr <= 0xcfff)
 	{
-		return RAM[addr - 0xc000];
+		return s->RAM[addr - 0xc000];
 	}
 	else if (addr == 0xd007)
 	{
-		return qsound_status_r();
+		return qsound_status_r(s->qsound);
 	}
 	else if (addr >= 0xf000)
 	{
-		return RAM2[addr-0xf000];
+		return s->RAM2[addr-0xf000];
 	}
 }
 
-uint8 qsf_memory_readop(uint16 addr)
+uint8 qsf_memory_readop(void *param, uint16 addr)
 {
-	if (!uses_kabuki)
+	qsf_synth_t *s = param;
+
+	if (!s->uses_kabuki)
 	{
-		return qsf_memory_read(addr);
+		return qsf_memory_read(s, addr);
 	}
 
 	if (addr < 0x8000)
 	{
-		return Z80ROM[addr + (256*1024)];
+		return s->Z80ROM[addr + (256*1024)];
 	}
 
-	return qsf_memory_read(addr);
+	return qsf_memory_read(s, addr);
 }
 
-uint8 qsf_memory_readport(uint16 addr)
+uint8 qsf_memory_readport(void *param, uint16 addr)
 {
-	return Z80ROM[0x11];
+	qsf_synth_t *s = param;
+
+	return s->Z80ROM[0x11];
 }
 
-void qsf_memory_write(uint16 addr, uint8 byte)
+void qsf_memory_write(void *param, uint16 addr, uint8 byte)
 {
+	qsf_synth_t *s = param;
+
 	if (addr >= 0xc000 && addr <= 0xcfff)
 	{
 		
-		RAM[addr-0xc000] = byte;
+		s->RAM[addr-0xc000] = byte;
 		return;
 	}
 	else if (addr == 0xd000)
 	{
-		qsound_data_h_w(byte);
+		qsound_data_h_w(s->qsound, byte);
 		return;
 	}
 	else if (addr == 0xd001)
 	{
-		qsound_data_l_w(byte);
+		qsound_data_l_w(s->qsound, byte);
 		return;
 	}
 	else if (addr == 0xd002)
 	{
-		qsound_cmd_w(byte);
+		qsound_cmd_w(s->qsound, byte);
 		return;
 	}
 	else if (addr == 0xd003)
 	{
-		cur_bank = (0x8000 + (byte & 0xf) * 0x4000);
-		if (cur_bank > (256*1024))
+		s->cur_bank = (0x8000 + (byte & 0xf) * 0x4000);
+		if (s->cur_bank > (256*1024))
 		{
-			cur_bank = 0;
+			s->cur_bank = 0;
 		}
-//		printf("Z80 bank to %x (%x)\n", cur_bank, byte);
+//		printf("Z80 bank to %x (%x)\n", s->cur_bank, byte);
 		return;
 	}
 	else if (addr >= 0xf000)
 	{
-		RAM2[addr-0xf000] = byte;
+		s->RAM2[addr-0xf000] = byte;
 		return;
 	}
 }
 
-void qsf_memory_writeport(uint16 addr, uint8 byte)
+void qsf_memory_writeport(void *param, uint16 addr, uint8 byte)
 {
 	printf("Unk port %x @ %x\n", byte, addr);
 }
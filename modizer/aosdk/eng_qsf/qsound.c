@@ -32,6 +32,7 @@
 ***************************************************************************/
 
 #include <math.h>
+#include <stdlib.h>
 #include "cpuintrf.h"
 #include "qsound.h"
 
@@ -104,53 +105,58 @@ struct QSOUND_CHANNEL
 };
 
 
-/* Private variables */
-static struct QSound_interface *intf;	/* Interface  */
-static int qsound_stream;				/* Audio stream */
-static struct QSOUND_CHANNEL qsound_channel[QSOUND_CHANNELS];
-static int qsound_data;				  /* register latch data */
-QSOUND_SRC_SAMPLE *qsound_sample_rom;	/* Q sound sample ROM */
+/* Chip state, one per qsound_sh_start */
+struct qsound_info
+{
+	int stream;					/* Audio stream */
+	struct QSOUND_CHANNEL channel[QSOUND_CHANNELS];
+	int data;					/* register latch data */
+	QSOUND_SRC_SAMPLE *sample_rom;	/* Q sound sample ROM */
 
 #if QSOUND_DRIVER1
-static int qsound_pan_table[33];		 /* Pan volume table */
-static float qsound_frq_ratio;		   /* Frequency ratio */
+	int pan_table[33];			/* Pan volume table */
+	float frq_ratio;			/* Frequency ratio */
 #endif
 
 #if LOG_WAVE
-static FILE *fpRawDataL;
-static FILE *fpRawDataR;
+	FILE *fpRawDataL;
+	FILE *fpRawDataR;
 #endif
+};
 
 /* Function prototypes */
-void qsound_update( int num, INT16 **buffer, int length );
-void qsound_set_command(int data, int value);
+void qsound_update( void *chip, INT16 **buffer, int length );
+void qsound_set_command(struct qsound_info *chip, int data, int value);
 
 #if QSOUND_DRIVER2
-void setchannel(int channel,signed short *buffer,int length,int vol,int pan);
-void setchloop(int channel,int loops,int loope);
-void stopchan(int channel);
-void calcula_mix(int channel);
+void setchannel(struct qsound_info *chip, int channel,signed short *buffer,int length,int vol,int pan);
+void setchloop(struct qsound_info *chip, int channel,int loops,int loope);
+void stopchan(struct qsound_info *chip, int channel);
+void calcula_mix(struct qsound_info *chip, int channel);
 #endif
 
-int  qsound_sh_start( struct QSound_interface *qsintf )
+void *qsound_sh_start( struct QSound_interface *intf )
 {
+	struct qsound_info *chip;
 	int i;
 
-	intf = qsintf;
-
-	qsound_sample_rom = (QSOUND_SRC_SAMPLE *)intf->sample_rom;
+	chip = (struct qsound_info *)calloc(1, sizeof(struct qsound_info));
+	if (!chip)
+	{
+		return NULL;
+	}
 
-	memset(qsound_channel, 0, sizeof(qsound_channel));
+	chip->sample_rom = (QSOUND_SRC_SAMPLE *)intf->sample_rom;
 
 #if QSOUND_DRIVER1
-	qsound_frq_ratio = ((float)intf->clock / (float)QSOUND_CLOCKDIV) /
+	chip->frq_ratio = ((float)intf->clock / (float)QSOUND_CLOCKDIV) /
 						(float) 44100;
-	qsound_frq_ratio *= 16.0;
+	chip->frq_ratio *= 16.0;
 
 	/* Create pan table */
 	for (i=0; i<33; i++)
 	{
-		qsound_pan_table[i]=(int)((256/sqrt(32)) * sqrt(i));
+		chip->pan_table[i]=(int)((256/sqrt(32)) * sqrt(i));
 	}
 #else
 	i=0;
@@ -159,7 +165,7 @@ int  qsound_sh_start( struct QSound_interface *qsintf )
 #if LOG_QSOUND
 	logerror("Pan table\n");
 	for (i=0; i<33; i++)
-		logerror("%02x ", qsound_pan_table[i]);
+		logerror("%02x ", chip->pan_table[i]);
 #endif
 #if 0
 	{
@@ -174,7 +180,7 @@ int  qsound_sh_start( struct QSound_interface *qsintf )
 		sprintf( buf[1], "%s R", sound_name(msound) );
 		vol[0]=MIXER(intf->mixing_level[0], MIXER_PAN_LEFT);
 		vol[1]=MIXER(intf->mixing_level[1], MIXER_PAN_RIGHT);
-		qsound_stream = stream_init_multi(
+		chip->stream = stream_init_multi(
 			CHANNELS,
 			name,
 			vol,
@@ -184,54 +190,65 @@ int  qsound_sh_start( struct QSound_interface *qsintf )
 	}
 #endif
 #if LOG_WAVE
-	fpRawDataR=fopen("qsoundr.raw", "w+b");
-	fpRawDataL=fopen("qsoundl.raw", "w+b");
-	if (!fpRawDataR || !fpRawDataL)
+	chip->fpRawDataR=fopen("qsoundr.raw", "w+b");
+	chip->fpRawDataL=fopen("qsoundl.raw", "w+b");
+	if (!chip->fpRawDataR || !chip->fpRawDataL)
 	{
-		return 1;
+		qsound_sh_stop(chip);
+		return NULL;
 	}
 #endif
 
-	return 0;
+	return chip;
 }
 
-void qsound_sh_stop (void)
+void qsound_sh_stop (void *param)
 {
+	struct qsound_info *chip = (struct qsound_info *)param;
+
+	if (!chip)
+	{
+		return;
+	}
 #if LOG_WAVE
-	if (fpRawDataR)
+	if (chip->fpRawDataR)
 	{
-		fclose(fpRawDataR);
+		fclose(chip->fpRawDataR);
 	}
-	if (fpRawDataL)
+	if (chip->fpRawDataL)
 	{
-		fclose(fpRawDataL);
+		fclose(chip->fpRawDataL);
 	}
 #endif
+	free(chip);
 }
 
-void qsound_data_h_w(int data)
+void qsound_data_h_w(void *param, int data)
 {
-	qsound_data=(qsound_data&0xff)|(data<<8);
+	struct qsound_info *chip = (struct qsound_info *)param;
+	chip->data=(chip->data&0xff)|(data<<8);
 }
 
-void qsound_data_l_w(int data)
+void qsound_data_l_w(void *param, int data)
 {
-	qsound_data=(qsound_data&0xff00)|data;
+	struct qsound_info *chip = (struct qsound_info *)param;
+	chip->data=(chip->data&0xff00)|data;
 }
 
-void qsound_cmd_w(int data)
+void qsound_cmd_w(void *param, int data)
 {
-//	printf("QS: cmd %x, data %x\n", data, qsound_data);
-	qsound_set_command(data, qsound_data);
+	struct qsound_info *chip = (struct qsound_info *)param;
+//	printf("QS: cmd %x, data %x\n", data, chip->data);
+	qsound_set_command(chip, data, chip->data);
 }
 
-int qsound_status_r(void)
+int qsound_status_r(void *param)
 {
 	/* Port ready bit (0x80 if ready) */
 	return 0x80;
 }
 
-void qsound_set_command(int data, int value)
+void qsound_set_command(struct qsound_info *chip, int data, int value)
 {
 	int ch=0,reg=0;
 	if (data < 0x80)
@@ -266,8 +283,8 @@ void qsound_set_command(int data, int value)
 	{
 		case 0: /* Bank */
 			ch=(ch+1)&0x0f;	/* strange ... */
-			qsound_channel[ch].bank=(value&0x7f)<<16;
-			qsound_channel[ch].bank /= LENGTH_DIV;
+			chip->channel[ch].bank=(value&0x7f)<<16;
+			chip->channel[ch].bank /= LENGTH_DIV;
 #ifdef MAME_DEBUG
 			if (!value & 0x8000)
 			{
@@ -280,16 +297,16 @@ void qsound_set_command(int data, int value)
 			break;
 		case 1: /* start */
 //			printf("QS: key on ch %02d\n", ch);
-			qsound_channel[ch].address=value;
-			qsound_channel[ch].address/=LENGTH_DIV;
+			chip->channel[ch].address=value;
+			chip->channel[ch].address/=LENGTH_DIV;
 			break;
 		case 2: /* pitch */
 #if QSOUND_DRIVER1
-			qsound_channel[ch].pitch=(long)
-					((float)value * qsound_frq_ratio );
-			qsound_channel[ch].pitch/=LENGTH_DIV;
+			chip->channel[ch].pitch=(long)
+					((float)value * chip->frq_ratio );
+			chip->channel[ch].pitch/=LENGTH_DIV;
 #else
-			qsound_channel[ch].factor=((float) (value*(6/LENGTH_DIV)) /
+			chip->channel[ch].factor=((float) (value*(6/LENGTH_DIV)) /
 									  (float) 44100)*256.0;
 
 #endif
@@ -297,11 +314,11 @@ void qsound_set_command(int data, int value)
 			{
 				/* Key off */
 //				printf("QS: key off ch %02d\n", ch);
-				qsound_channel[ch].key=0;
+				chip->channel[ch].key=0;
 			}
 			break;
 		case 3: /* unknown */
-			qsound_channel[ch].reg3=value;
+			chip->channel[ch].reg3=value;
 #ifdef MAME_DEBUG
 			if (value != 0x8000)
 			{
@@ -312,33 +329,33 @@ void qsound_set_command(int data, int value)
 #endif
 			break;
 		case 4: /* loop offset */
-			qsound_channel[ch].loop=value/LENGTH_DIV;
+			chip->channel[ch].loop=value/LENGTH_DIV;
 			break;
 		case 5: /* end */
-			qsound_channel[ch].end=value/LENGTH_DIV;
+			chip->channel[ch].end=value/LENGTH_DIV;
 			break;
 		case 6: /* master volume */
 			if (value==0)
 			{
 				/* Key off */
-				qsound_channel[ch].key=0;
+				chip->channel[ch].key=0;
 			}
-			else if (qsound_channel[ch].key==0)
+			else if (chip->channel[ch].key==0)
 			{
 				/* Key on */
-				qsound_channel[ch].key=1;
+				chip->channel[ch].key=1;
 #if QSOUND_DRIVER1
-				qsound_channel[ch].offset=0;
-				qsound_channel[ch].lastdt=0;
+				chip->channel[ch].offset=0;
+				chip->channel[ch].lastdt=0;
 #else
-				qsound_channel[ch].cursor=qsound_channel[ch].address <<8 ;
-				qsound_channel[ch].buffer=qsound_sample_rom+
-										 qsound_channel[ch].bank;
+				chip->channel[ch].cursor=chip->channel[ch].address <<8 ;
+				chip->channel[ch].buffer=chip->sample_rom+
+										 chip->channel[ch].bank;
 #endif
 			}
-			qsound_channel[ch].vol=value;
+			chip->channel[ch].vol=value;
 #if QSOUND_DRIVER2
-			calcula_mix(ch);
+			calcula_mix(chip, ch);
 #endif
 			break;
 
@@ -360,17 +377,17 @@ void qsound_set_command(int data, int value)
 			   {
 					pandata=32;
 			   }
-			   qsound_channel[ch].rvol=qsound_pan_table[pandata];
-			   qsound_channel[ch].lvol=qsound_pan_table[32-pandata];
+			   chip->channel[ch].rvol=chip->pan_table[pandata];
+			   chip->channel[ch].lvol=chip->pan_table[32-pandata];
 #endif
-			   qsound_channel[ch].pan = value;
+			   chip->channel[ch].pan = value;
 #if QSOUND_DRIVER2
-			   calcula_mix(ch);
+			   calcula_mix(chip, ch);
 #endif
 			}
 			break;
 		 case 9:
-			qsound_channel[ch].reg9=value;
+			chip->channel[ch].reg9=value;
 /*
 #ifdef MAME_DEBUG
 			{
@@ -391,11 +408,12 @@ void qsound_set_command(int data, int value)
 
 /* Driver 1 - based on the Amuse source */
 
-void qsound_update( int num, INT16 **buffer, int length )
+void qsound_update( void *param, INT16 **buffer, int length )
 {
+	struct qsound_info *chip = (struct qsound_info *)param;
 	int i,j;
 	int rvol, lvol, count;
-	struct QSOUND_CHANNEL *pC=&qsound_channel[0];
+	struct QSOUND_CHANNEL *pC=&chip->channel[0];
 	QSOUND_SRC_SAMPLE * pST;
 	QSOUND_SAMPLE  *datap[2];
 
@@ -411,7 +429,7 @@ void qsound_update( int num, INT16 **buffer, int length )
 		{
 			QSOUND_SAMPLE *pOutL=datap[0];
 			QSOUND_SAMPLE *pOutR=datap[1];
-			pST=qsound_sample_rom+pC->bank;
+			pST=chip->sample_rom+pC->bank;
 
 			rvol=(pC->rvol*pC->vol)>>(8*LENGTH_DIV);
 			lvol=(pC->lvol*pC->vol)>>(8*LENGTH_DIV);
@@ -448,8 +466,8 @@ void qsound_update( int num, INT16 **buffer, int length )
 	}
 
 #if LOG_WAVE
-	fwrite(datap[0], length*sizeof(QSOUND_SAMPLE), 1, fpRawDataL);
-	fwrite(datap[1], length*sizeof(QSOUND_SAMPLE), 1, fpRawDataR);
+	fwrite(datap[0], length*sizeof(QSOUND_SAMPLE), 1, chip->fpRawDataL);
+	fwrite(datap[1], length*sizeof(QSOUND_SAMPLE), 1, chip->fpRawDataR);
 #endif
 }
 
@@ -462,10 +480,10 @@ void qsound_update( int num, INT16 **buffer, int length )
  ------------------------------------------------------------------ */
 
 
-void calcula_mix(int channel)
+void calcula_mix(struct qsound_info *chip, int channel)
 {
 	int factl,factr;
-	struct QSOUND_CHANNEL *pC=&qsound_channel[channel];
+	struct QSOUND_CHANNEL *pC=&chip->channel[channel];
 	int vol=pC->vol>>5;
 	int pan=((pC->pan&0xFF)-0x10)<<3;
 	pC->mixl=vol;
@@ -480,11 +498,12 @@ void calcula_mix(int channel)
 #endif
 }
 
-void qsound_update( int num, INT16 **buffer, int length )
+void qsound_update( void *param, INT16 **buffer, int length )
 {
+	struct qsound_info *chip = (struct qsound_info *)param;
 	int i,j;
 	QSOUND_SAMPLE *bufL,*bufR, sample;
-	struct QSOUND_CHANNEL *pC=qsound_channel;
+	struct QSOUND_CHANNEL *pC=chip->channel;
 
 	memset( buffer[0], 0x00, length * sizeof(QSOUND_SAMPLE) );
 	memset( buffer[1], 0x00, length * sizeof(QSOUND_SAMPLE) );
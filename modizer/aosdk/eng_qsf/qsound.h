@@ -15,13 +15,13 @@ struct QSound_interface
 	char *sample_rom;		/* sample data */
 };
 
-int  qsound_sh_start( struct QSound_interface *qsintf );
-void qsound_sh_stop( void );
-
-void qsound_data_h_w(int data);
-void qsound_data_l_w(int data);
-void qsound_cmd_w(int data);
-int qsound_status_r(void);
-void qsound_update( int num, INT16 **buffer, int length );
+void *qsound_sh_start( struct QSound_interface *intf );
+void qsound_sh_stop( void *chip );
+
+void qsound_data_h_w(void *chip, int data);
+void qsound_data_l_w(void *chip, int data);
+void qsound_cmd_w(void *chip, int data);
+int qsound_status_r(void *chip);
+void qsound_update( void *chip, INT16 **buffer, int length );
 
 #endif /* __QSOUND_H__ */
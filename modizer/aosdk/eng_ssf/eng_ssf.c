@@ -80,15 +80,19 @@ int aosdk_ssf_samplecycle_ratio=5;
 
 #define DEBUG_LOADER	(0)
 
-static corlett_t	*c = NULL;
-static char 		psfby[256];
-static uint32		decaybegin, decayend, total_samples;
+typedef struct
+{
+	corlett_t	*c;
+	char 		psfby[256];
+	uint32		decaybegin, decayend, total_samples;
 
-void *scsp_start(const void *config);
-void SCSP_Update(void *param, INT16 **inputs, INT16 **buf, int samples);
+	struct sat_hw	hw;
+} ssf_synth_t;
 
-int32 ssf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultlength)
+void *ssf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultlength)
 {
+	ssf_synth_t *s;
+	corlett_t *c;
 	uint8 *file, *lib_decoded, *lib_raw_file;
 	uint32 offset, plength, lengthMS, fadeMS;
 	uint64 file_len, lib_len, lib_raw_length;
@@ -96,14 +100,20 @@ int32 ssf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 	char *libfile;
 	int i;
 
-	// clear Saturn work RAM before we start scribbling in it
-	memset(sat_ram, 0, 512*1024);
+	// the Saturn work RAM is cleared before we start scribbling in it
+	s = calloc(1, sizeof(ssf_synth_t));
+	if (!s)
+	{
+		return NULL;
+	}
 
 	// Decode the current SSF
-	if (corlett_decode(buffer, length, &file, &file_len, &c) != AO_SUCCESS)
+	if (corlett_decode(buffer, length, &file, &file_len, &s->c) != AO_SUCCESS)
 	{
-		return AO_FAIL;
+		ssf_stop(s);
+		return NULL;
 	}
+	c = s->c;
 
 	#if DEBUG_LOADER
 	printf("%d bytes decoded\n", file_len);
@@ -122,14 +132,18 @@ int32 ssf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 			#endif
 			if (ao_get_lib(libfile, &lib_raw_file, &tmp_length) != AO_SUCCESS)
 			{
-				return AO_FAIL;
+				free(file);
+				ssf_stop(s);
+				return NULL;
 			}
 			lib_raw_length = tmp_length;
 		
 			if (corlett_decode(lib_raw_file, lib_raw_length, &lib_decoded, &lib_len, &lib) != AO_SUCCESS)
 			{
 				free(lib_raw_file);
-				return AO_FAIL;
+				free(file);
+				ssf_stop(s);
+				return NULL;
 			}
 				
 			// Free up raw file
@@ -143,7 +157,7 @@ int32 ssf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 			{
 				lib_len = 0x80000-offset+4;
 			}
-			memcpy(&sat_ram[offset], lib_decoded+4, lib_len-4);
+			memcpy(&s->hw.sat_ram[offset], lib_decoded+4, lib_len-4);
 
 			// Dispose the corlett structure for the lib - we don't use it
 			free(lib);
@@ -159,18 +173,18 @@ int32 ssf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 		file_len = 0x80000-offset+4;
 	}
 
-	memcpy(&sat_ram[offset], file+4, file_len-4);
+	memcpy(&s->hw.sat_ram[offset], file+4, file_len-4);
 
 	free(file);
 	
 	// Finally, set psfby tag
-	strcpy(psfby, "n/a");
+	strcpy(s->psfby, "n/a");
 	if (c)
 	{
 		for (i = 0; i < MAX_UNKNOWN_TAGS; i++)
 		{
 			if (!strcasecmp(c->tag_name[i], "psfby"))
-				strcpy(psfby, c->tag_data[i]);
+				strcpy(s->psfby, c->tag_data[i]);
 		}
 	}
 
@@ -179,7 +193,7 @@ int32 ssf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 		FILE *f;
 
 		f = fopen("satram.bin", "wb");
-		fwrite(sat_ram, 512*1024, 1, f);
+		fwrite(s->hw.sat_ram, 512*1024, 1, f);
 		fclose(f);
 	}
 	#endif
@@ -189,12 +203,17 @@ int32 ssf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 	{
 		uint8 temp;
 
-		temp = sat_ram[i];
-		sat_ram[i] = sat_ram[i+1];
-		sat_ram[i+1] = temp;
+		temp = s->hw.sat_ram[i];
+		s->hw.sat_ram[i] = s->hw.sat_ram[i+1];
+		s->hw.sat_ram[i+1] = temp;
 	}
 
-	sat_hw_init();
+	sat_hw_init(&s->hw);
+	if (!s->hw.scsp)
+	{
+		ssf_stop(s);
+		return NULL;
+	}
 
 	// now figure out the time in samples for the length/fade
 	lengthMS = psfTimeToMS(c->inf_length);
@@ -207,7 +226,7 @@ int32 ssf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
         sprintf(c->inf_fade,"10");
     }
     
-	total_samples = 0;
+	s->total_samples = 0;
 
 	if ((lengthMS == 0)||loop_infinite)
 	{
@@ -216,25 +235,25 @@ int32 ssf_start(uint8 *buffer, uint32 length,int32 loop_infinite,int32 defaultle
 
 	if (lengthMS == ~0)
 	{
-		decaybegin = lengthMS;
+		s->decaybegin = lengthMS;
 	}
 	else
 	{
 		lengthMS = (lengthMS * 441) / 10;
 		fadeMS = (fadeMS * 441) / 10;
 
-		decaybegin = lengthMS;
-		decayend = lengthMS + fadeMS;
+		s->decaybegin = lengthMS;
+		s->decayend = lengthMS + fadeMS;
 	}
 
-	return AO_SUCCESS;
+	return s;
 }
 
-
-int m68k_execute(int num_cycles);
-
-int32 ssf_gen(int16 *buffer, uint32 samples)
+int32 ssf_gen(void *handle, int16 *buffer, uint32 samples)
 {	
+	ssf_synth_t *s = handle;
+	uint32 total_samples = s->total_samples;
+	uint32 decaybegin = s->decaybegin, decayend = s->decayend;
 	int i;
 	int16 output[44100/30], output2[44100/30];
 	int16 *stereo[2];
@@ -246,10 +265,10 @@ int32 ssf_gen(int16 *buffer, uint32 samples)
 	opos = 0;
 	for (i = 0; i < samples; i+=cycle_ratio)
 	{
-		m68k_execute((11300000/60)/735 *cycle_ratio);
+		m68k_execute(s->hw.cpu, (11300000/60)/735 *cycle_ratio);
 		stereo[0] = &output[opos];
 		stereo[1] = &output2[opos];
-		SCSP_Update(NULL, NULL, stereo, 1*cycle_ratio);
+		SCSP_Update(s->hw.scsp, NULL, stereo, 1*cycle_ratio);
 		opos+=cycle_ratio;
 	}
 
@@ -282,16 +301,22 @@ int32 ssf_gen(int16 *buffer, uint32 samples)
 		*outp++ = output[i];
 		*outp++ = output2[i];
 	}
+	s->total_samples = total_samples;
     if (shouldExit) return AO_FAIL;
 	return AO_SUCCESS;
 }
 
-int32 ssf_stop(void)
+int32 ssf_stop(void *handle)
 {
+	ssf_synth_t *s = handle;
+
+	sat_hw_free(&s->hw);
+	free(s->c);
+	free(s);
 	return AO_SUCCESS;
 }
 
-int32 ssf_command(int32 command, int32 parameter)
+int32 ssf_command(void *handle, int32 command, int32 parameter)
 
 {
 	switch (command)
@@ -303,8 +328,11 @@ int32 ssf_command(int32 command, int32 parameter)
 	return AO_FAIL;
 }
 
-int32 ssf_fill_info(ao_display_info *info)
+int32 ssf_fill_info(void *handle, ao_display_info *info)
 {
+	ssf_synth_t *s = handle;
+	corlett_t *c = s->c;
+
 	if (c == NULL)
 		return AO_FAIL;
 		
@@ -330,7 +358,7 @@ int32 ssf_fill_info(ao_display_info *info)
 	sprintf(info->info[7], "%s", c->inf_fade);
 
 	strcpy(info->title[8], "Ripper: ");
-	sprintf(info->info[8], "%s", psfby);
+	sprintf(info->info[8], "%s", s->psfby);
 	
 	info->length_ms=psfTimeToMS(c->inf_length);
 	info->fade_ms=psfTimeToMS(c->inf_fade);
@@ -24,6 +24,17 @@
 
 
 
+/* ======================================================================== */
+/* ============================== CPU CONTEXT ============================= */
+/* ======================================================================== */
+
+/* CPU state.  Every function below works on the core passed as first
+ * argument, so several CPUs can run side by side.
+ * Allocate m68k_context_size() bytes (zeroed) for each of them.
+ */
+typedef struct m68ki_cpu_core m68ki_cpu_core;
+
+
 /* ======================================================================== */
 /* ============================ GENERAL DEFINES =========================== */
 
@@ -141,10 +152,12 @@ typedef enum
  *       USER mode, but it is also slower.
  */
 
+/* param is the value given to m68k_init() for the core doing the access */
+
 /* Read from anywhere */
-unsigned int  m68k_read_memory_8(unsigned int address);
-unsigned int  m68k_read_memory_16(unsigned int address);
-unsigned int  m68k_read_memory_32(unsigned int address);
+unsigned int  m68k_read_memory_8(void *param, unsigned int address);
+unsigned int  m68k_read_memory_16(void *param, unsigned int address);
+unsigned int  m68k_read_memory_32(void *param, unsigned int address);
 
 /* Read data immediately following the PC */
 //INLINE unsigned int  m68k_read_immediate_16(unsigned int address);
@@ -161,9 +174,9 @@ unsigned int m68k_read_disassembler_16 (unsigned int address);
 unsigned int m68k_read_disassembler_32 (unsigned int address);
 
 /* Write to anywhere */
-void m68k_write_memory_8(unsigned int address, unsigned int value);
-void m68k_write_memory_16(unsigned int address, unsigned int value);
-void m68k_write_memory_32(unsigned int address, unsigned int value);
+void m68k_write_memory_8(void *param, unsigned int address, unsigned int value);
+void m68k_write_memory_16(void *param, unsigned int address, unsigned int value);
+void m68k_write_memory_32(void *param, unsigned int address, unsigned int value);
 
 /* Special call to simulate undocumented 68k behavior when move.l with a
  * predecrement destination mode is executed.
@@ -198,7 +211,7 @@ void m68k_write_memory_32(unsigned int address, unsigned int value);
  * services the interrupt.
  * Default behavior: return M68K_INT_ACK_AUTOVECTOR.
  */
-void m68k_set_int_ack_callback(int  (*callback)(int int_level));
+void m68k_set_int_ack_callback(m68ki_cpu_core *m68k, int  (*callback)(m68ki_cpu_core *m68k, int int_level));
 
 
 /* Set the callback for a breakpoint acknowledge (68010+).
@@ -207,7 +220,7 @@ void m68k_set_int_ack_callback(int  (*callback)(int int_level));
  * BKPT instruction for 68020+, or 0 for 68010.
  * Default behavior: do nothing.
  */
-void m68k_set_bkpt_ack_callback(void (*callback)(unsigned int data));
+void m68k_set_bkpt_ack_callback(m68ki_cpu_core *m68k, void (*callback)(m68ki_cpu_core *m68k, unsigned int data));
 
 
 /* Set the callback for the RESET instruction.
@@ -215,7 +228,7 @@ void m68k_set_bkpt_ack_callback(void (*callback)(unsigned int data));
  * The CPU calls this callback every time it encounters a RESET instruction.
  * Default behavior: do nothing.
  */
-void m68k_set_reset_instr_callback(void  (*callback)(void));
+void m68k_set_reset_instr_callback(m68ki_cpu_core *m68k, void  (*callback)(m68ki_cpu_core *m68k));
 
 
 /* Set the callback for informing of a large PC change.
@@ -224,7 +237,7 @@ void m68k_set_reset_instr_callback(void  (*callback)(void));
  * by a large value (currently set for changes by longwords).
  * Default behavior: do nothing.
  */
-void m68k_set_pc_changed_callback(void  (*callback)(unsigned int new_pc));
+void m68k_set_pc_changed_callback(m68ki_cpu_core *m68k, void  (*callback)(m68ki_cpu_core *m68k, unsigned int new_pc));
 
 
 /* Set the callback for CPU function code changes.
@@ -234,7 +247,7 @@ void m68k_set_pc_changed_callback(void  (*callback)(unsigned int new_pc));
  * access it is (supervisor/user, program/data and such).
  * Default behavior: do nothing.
  */
-void m68k_set_fc_callback(void  (*callback)(unsigned int new_fc));
+void m68k_set_fc_callback(m68ki_cpu_core *m68k, void  (*callback)(m68ki_cpu_core *m68k, unsigned int new_fc));
 
 
 /* Set a callback for the instruction cycle of the CPU.
@@ -243,7 +256,7 @@ void m68k_set_fc_callback(void  (*callback)(unsigned int new_fc));
  * instruction cycle.
  * Default behavior: do nothing.
  */
-void m68k_set_instr_hook_callback(void  (*callback)(void));
+void m68k_set_instr_hook_callback(m68ki_cpu_core *m68k, void  (*callback)(m68ki_cpu_core *m68k));
 
 
 
@@ -255,12 +268,13 @@ void m68k_set_instr_hook_callback(void  (*callback)(void));
  * Currently supported types are: M68K_CPU_TYPE_68000, M68K_CPU_TYPE_68010,
  * M68K_CPU_TYPE_EC020, and M68K_CPU_TYPE_68020.
  */
-void m68k_set_cpu_type(unsigned int cpu_type);
+void m68k_set_cpu_type(m68ki_cpu_core *m68k, unsigned int cpu_type);
 
 /* Do whatever initialisations the core requires.  Should be called
  * at least once at init time.
+ * param is handed back to the memory handlers.
  */
-void m68k_init(void);
+void m68k_init(m68ki_cpu_core *m68k, void *param);
 
 /* Pulse the RESET pin on the CPU.
  * You *MUST* reset the CPU at least once to initialize the emulation
@@ -268,30 +282,30 @@ void m68k_init(void);
  *       the CPU for the first time, the CPU will be set to
  *       M68K_CPU_TYPE_68000.
  */
-void m68k_pulse_reset(void);
+void m68k_pulse_reset(m68ki_cpu_core *m68k);
 
 /* execute num_cycles worth of instructions.  returns number of cycles used */
-int m68k_execute(int num_cycles);
+int m68k_execute(m68ki_cpu_core *m68k, int num_cycles);
 
 /* These functions let you read/write/modify the number of cycles left to run
  * while m68k_execute() is running.
  * These are useful if the 68k accesses a memory-mapped port on another device
  * that requires immediate processing by another CPU.
  */
-int m68k_cycles_run(void);              /* Number of cycles run so far */
-int m68k_cycles_remaining(void);        /* Number of cycles left */
-void m68k_modify_timeslice(int cycles); /* Modify cycles left */
-void m68k_end_timeslice(void);          /* End timeslice now */
+int m68k_cycles_run(m68ki_cpu_core *m68k);              /* Number of cycles run so far */
+int m68k_cycles_remaining(m68ki_cpu_core *m68k);        /* Number of cycles left */
+void m68k_modify_timeslice(m68ki_cpu_core *m68k, int cycles); /* Modify cycles left */
+void m68k_end_timeslice(m68ki_cpu_core *m68k);          /* End timeslice now */
 
 /* Set the IPL0-IPL2 pins on the CPU (IRQ).
  * A transition from < 7 to 7 will cause a non-maskable interrupt (NMI).
  * Setting IRQ to 0 will clear an interrupt request.
  */
-void m68k_set_irq(unsigned int int_level);
+void m68k_set_irq(m68ki_cpu_core *m68k, unsigned int int_level);
 
 
 /* Halt the CPU as if you pulsed the HALT pin. */
-void m68k_pulse_halt(void);
+void m68k_pulse_halt(m68ki_cpu_core *m68k);
 
 
 /* Context switching to allow multiple CPUs */
@@ -299,24 +313,21 @@ void m68k_pulse_halt(void);
 /* Get the size of the cpu context in bytes */
 unsigned int m68k_context_size(void);
 
-/* Get a cpu context */
-unsigned int m68k_get_context(void* dst);
+/* Copy a cpu context to dst */
+unsigned int m68k_get_context(m68ki_cpu_core *m68k, void* dst);
 
-/* set the current cpu context */
-void m68k_set_context(void* dst);
+/* Restore a cpu context from src */
+void m68k_set_context(m68ki_cpu_core *m68k, void* src);
 
 /* Register the CPU state information */
 void m68k_state_register(const char *type);
 
 
-/* Peek at the internals of a CPU context.  This can either be a context
- * retrieved using m68k_get_context() or the currently running context.
- * If context is NULL, the currently running CPU context will be used.
- */
-unsigned int m68k_get_reg(void* context, m68k_register_t reg);
+/* Peek at the internals of a CPU context */
+unsigned int m68k_get_reg(m68ki_cpu_core *m68k, m68k_register_t reg);
 
-/* Poke values into the internals of the currently running CPU context */
-void m68k_set_reg(m68k_register_t reg, unsigned int value);
+/* Poke values into the internals of a CPU context */
+void m68k_set_reg(m68ki_cpu_core *m68k, m68k_register_t reg, unsigned int value);
 
 /* Check if an instruction is valid for the specified CPU type */
 unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cpu_type);
@@ -91,6 +91,8 @@ M68KMAKE_PROTOTYPE_HEADER
 #ifndef M68KOPS__HEADER
 #define M68KOPS__HEADER
 
+#include "m68k.h"
+
 /* ======================================================================== */
 /* ============================ OPCODE HANDLERS =========================== */
 /* ======================================================================== */
@@ -104,7 +106,7 @@ M68KMAKE_PROTOTYPE_FOOTER
 /* Build the opcode handler table */
 void m68ki_build_opcode_table(void);
 
-extern void (*m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
+extern void (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *m68k); /* opcode handler jump table */
 extern unsigned char m68ki_cycles[][0x10000];
 
 
@@ -127,13 +129,13 @@ M68KMAKE_TABLE_HEADER
 
 #define NUM_CPU_TYPES 3
 
-void  (*m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
+void  (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *m68k); /* opcode handler jump table */
 unsigned char m68ki_cycles[NUM_CPU_TYPES][0x10000]; /* Cycles used by CPU type */
 
 /* This is used to generate the opcode handler jump table */
 typedef struct
 {
-	void (*opcode_handler)(void);        /* handler function */
+	void (*opcode_handler)(m68ki_cpu_core *m68k); /* handler function */
 	unsigned int  mask;                  /* mask on opcode */
 	unsigned int  match;                 /* what to match after masking */
 	unsigned char cycles[NUM_CPU_TYPES]; /* cycles each cpu type takes */
@@ -875,13 +877,13 @@ M68KMAKE_OPCODE_HANDLER_BODY
 
 M68KMAKE_OP(1010, 0, ., .)
 {
-	m68ki_exception_1010();
+	m68ki_exception_1010(m68k);
 }
 
 
 M68KMAKE_OP(1111, 0, ., .)
 {
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
@@ -913,7 +915,7 @@ M68KMAKE_OP(abcd, 8, rr, .)
 
 M68KMAKE_OP(abcd, 8, mm, ax7)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
@@ -939,7 +941,7 @@ M68KMAKE_OP(abcd, 8, mm, ax7)
 
 M68KMAKE_OP(abcd, 8, mm, ay7)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
@@ -965,7 +967,7 @@ M68KMAKE_OP(abcd, 8, mm, ay7)
 
 M68KMAKE_OP(abcd, 8, mm, axy7)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
@@ -991,7 +993,7 @@ M68KMAKE_OP(abcd, 8, mm, axy7)
 
 M68KMAKE_OP(abcd, 8, mm, .)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
@@ -1504,7 +1506,7 @@ M68KMAKE_OP(addx, 32, rr, .)
 
 M68KMAKE_OP(addx, 8, mm, ax7)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -1522,7 +1524,7 @@ M68KMAKE_OP(addx, 8, mm, ax7)
 
 M68KMAKE_OP(addx, 8, mm, ay7)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -1540,7 +1542,7 @@ M68KMAKE_OP(addx, 8, mm, ay7)
 
 M68KMAKE_OP(addx, 8, mm, axy7)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -1558,7 +1560,7 @@ M68KMAKE_OP(addx, 8, mm, axy7)
 
 M68KMAKE_OP(addx, 8, mm, .)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -1576,7 +1578,7 @@ M68KMAKE_OP(addx, 8, mm, .)
 
 M68KMAKE_OP(addx, 16, mm, .)
 {
-	uint src = OPER_AY_PD_16();
+	uint src = OPER_AY_PD_16(m68k);
 	uint ea  = EA_AX_PD_16();
 	uint dst = m68ki_read_16(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -1594,7 +1596,7 @@ M68KMAKE_OP(addx, 16, mm, .)
 
 M68KMAKE_OP(addx, 32, mm, .)
 {
-	uint src = OPER_AY_PD_32();
+	uint src = OPER_AY_PD_32(m68k);
 	uint ea  = EA_AX_PD_32();
 	uint dst = m68ki_read_32(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -1789,7 +1791,7 @@ M68KMAKE_OP(andi, 32, ., .)
 
 M68KMAKE_OP(andi, 16, toc, .)
 {
-	m68ki_set_ccr(m68ki_get_ccr() & OPER_I_16());
+	m68ki_set_ccr(m68k, m68ki_get_ccr() & OPER_I_16());
 }
 
 
@@ -1799,10 +1801,10 @@ M68KMAKE_OP(andi, 16, tos, .)
 	{
 		uint src = OPER_I_16();
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_set_sr(m68ki_get_sr() & src);
+		m68ki_set_sr(m68k, m68ki_get_sr() & src);
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -2220,7 +2222,7 @@ M68KMAKE_OP(bcc, 8, ., .)
 	if(M68KMAKE_CC)
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
@@ -2234,7 +2236,7 @@ M68KMAKE_OP(bcc, 16, ., .)
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -2251,13 +2253,13 @@ M68KMAKE_OP(bcc, 32, ., .)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2376,7 +2378,7 @@ M68KMAKE_OP(bfchg, 32, ., d)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2430,7 +2432,7 @@ M68KMAKE_OP(bfchg, 32, ., .)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2467,7 +2469,7 @@ M68KMAKE_OP(bfclr, 32, ., d)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2521,7 +2523,7 @@ M68KMAKE_OP(bfclr, 32, ., .)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2555,7 +2557,7 @@ M68KMAKE_OP(bfexts, 32, ., d)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2603,7 +2605,7 @@ M68KMAKE_OP(bfexts, 32, ., .)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2637,7 +2639,7 @@ M68KMAKE_OP(bfextu, 32, ., d)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2684,7 +2686,7 @@ M68KMAKE_OP(bfextu, 32, ., .)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2722,7 +2724,7 @@ M68KMAKE_OP(bfffo, 32, ., d)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2774,7 +2776,7 @@ M68KMAKE_OP(bfffo, 32, ., .)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2816,7 +2818,7 @@ M68KMAKE_OP(bfins, 32, ., d)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2877,7 +2879,7 @@ M68KMAKE_OP(bfins, 32, ., .)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2914,7 +2916,7 @@ M68KMAKE_OP(bfset, 32, ., d)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -2969,7 +2971,7 @@ M68KMAKE_OP(bfset, 32, ., .)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3004,7 +3006,7 @@ M68KMAKE_OP(bftst, 32, ., d)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3055,7 +3057,7 @@ M68KMAKE_OP(bftst, 32, ., .)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3065,14 +3067,14 @@ M68KMAKE_OP(bkpt, 0, ., .)
 	{
 		m68ki_bkpt_ack(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE) ? REG_IR & 7 : 0);	/* auto-disable (see m68kcpu.h) */
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
 M68KMAKE_OP(bra, 8, ., .)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
-	m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+	m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 	if(REG_PC == REG_PPC)
 		USE_ALL_CYCLES();
 }
@@ -3083,7 +3085,7 @@ M68KMAKE_OP(bra, 16, ., .)
 	uint offset = OPER_I_16();
 	REG_PC -= 2;
 	m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-	m68ki_branch_16(offset);
+	m68ki_branch_16(m68k, offset);
 	if(REG_PC == REG_PPC)
 		USE_ALL_CYCLES();
 }
@@ -3096,12 +3098,12 @@ M68KMAKE_OP(bra, 32, ., .)
 		uint offset = OPER_I_32();
 		REG_PC -= 4;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_32(offset);
+		m68ki_branch_32(m68k, offset);
 		if(REG_PC == REG_PPC)
 			USE_ALL_CYCLES();
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3150,8 +3152,8 @@ M68KMAKE_OP(bset, 8, s, .)
 M68KMAKE_OP(bsr, 8, ., .)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(REG_PC);
-	m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+	m68ki_push_32(m68k, REG_PC);
+	m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 }
 
 
@@ -3159,9 +3161,9 @@ M68KMAKE_OP(bsr, 16, ., .)
 {
 	uint offset = OPER_I_16();
 	m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(REG_PC);
+	m68ki_push_32(m68k, REG_PC);
 	REG_PC -= 2;
-	m68ki_branch_16(offset);
+	m68ki_branch_16(m68k, offset);
 }
 
 
@@ -3171,12 +3173,12 @@ M68KMAKE_OP(bsr, 32, ., .)
 	{
 		uint offset = OPER_I_32();
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_push_32(REG_PC);
+		m68ki_push_32(m68k, REG_PC);
 		REG_PC -= 4;
-		m68ki_branch_32(offset);
+		m68ki_branch_32(m68k, offset);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3221,7 +3223,7 @@ M68KMAKE_OP(callm, 32, ., .)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3250,7 +3252,7 @@ M68KMAKE_OP(cas, 8, ., .)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3279,7 +3281,7 @@ M68KMAKE_OP(cas, 16, ., .)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3308,7 +3310,7 @@ M68KMAKE_OP(cas, 32, ., .)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3353,7 +3355,7 @@ M68KMAKE_OP(cas2, 16, ., .)
 		*compare2 = BIT_F(word2) ? MAKE_INT_16(dest2) : MASK_OUT_BELOW_16(*compare2) | dest2;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3398,7 +3400,7 @@ M68KMAKE_OP(cas2, 32, ., .)
 		*compare2 = dest2;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3416,7 +3418,7 @@ M68KMAKE_OP(chk, 16, ., d)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
@@ -3434,7 +3436,7 @@ M68KMAKE_OP(chk, 16, ., .)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
@@ -3455,10 +3457,10 @@ M68KMAKE_OP(chk, 32, ., d)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3480,10 +3482,10 @@ M68KMAKE_OP(chk, 32, ., .)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3505,16 +3507,16 @@ M68KMAKE_OP(chk2cmp2, 8, ., pcdi)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3536,16 +3538,16 @@ M68KMAKE_OP(chk2cmp2, 8, ., pcix)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3567,16 +3569,16 @@ M68KMAKE_OP(chk2cmp2, 8, ., .)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3599,7 +3601,7 @@ M68KMAKE_OP(chk2cmp2, 16, ., pcdi)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
@@ -3609,10 +3611,10 @@ M68KMAKE_OP(chk2cmp2, 16, ., pcdi)
 			FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_16(FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3635,7 +3637,7 @@ M68KMAKE_OP(chk2cmp2, 16, ., pcix)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
@@ -3645,10 +3647,10 @@ M68KMAKE_OP(chk2cmp2, 16, ., pcix)
 			FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_16(FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3672,7 +3674,7 @@ M68KMAKE_OP(chk2cmp2, 16, ., .)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 		if(!BIT_F(word2))
@@ -3682,10 +3684,10 @@ M68KMAKE_OP(chk2cmp2, 16, ., .)
 
 		FLAG_C = CFLAG_16(FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3705,17 +3707,17 @@ M68KMAKE_OP(chk2cmp2, 32, ., pcdi)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3735,17 +3737,17 @@ M68KMAKE_OP(chk2cmp2, 32, ., pcix)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -3765,17 +3767,17 @@ M68KMAKE_OP(chk2cmp2, 32, ., .)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -4058,7 +4060,7 @@ M68KMAKE_OP(cmpi, 8, ., pcdi)
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_8();
-		uint dst = OPER_PCDI_8();
+		uint dst = OPER_PCDI_8(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_8(res);
@@ -4067,7 +4069,7 @@ M68KMAKE_OP(cmpi, 8, ., pcdi)
 		FLAG_C = CFLAG_8(res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -4076,7 +4078,7 @@ M68KMAKE_OP(cmpi, 8, ., pcix)
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_8();
-		uint dst = OPER_PCIX_8();
+		uint dst = OPER_PCIX_8(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_8(res);
@@ -4085,7 +4087,7 @@ M68KMAKE_OP(cmpi, 8, ., pcix)
 		FLAG_C = CFLAG_8(res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -4120,7 +4122,7 @@ M68KMAKE_OP(cmpi, 16, ., pcdi)
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_16();
-		uint dst = OPER_PCDI_16();
+		uint dst = OPER_PCDI_16(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_16(res);
@@ -4129,7 +4131,7 @@ M68KMAKE_OP(cmpi, 16, ., pcdi)
 		FLAG_C = CFLAG_16(res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -4138,7 +4140,7 @@ M68KMAKE_OP(cmpi, 16, ., pcix)
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_16();
-		uint dst = OPER_PCIX_16();
+		uint dst = OPER_PCIX_16(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_16(res);
@@ -4147,7 +4149,7 @@ M68KMAKE_OP(cmpi, 16, ., pcix)
 		FLAG_C = CFLAG_16(res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -4182,7 +4184,7 @@ M68KMAKE_OP(cmpi, 32, ., pcdi)
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_32();
-		uint dst = OPER_PCDI_32();
+		uint dst = OPER_PCDI_32(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_32(res);
@@ -4191,7 +4193,7 @@ M68KMAKE_OP(cmpi, 32, ., pcdi)
 		FLAG_C = CFLAG_SUB_32(src, dst, res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -4200,7 +4202,7 @@ M68KMAKE_OP(cmpi, 32, ., pcix)
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_32();
-		uint dst = OPER_PCIX_32();
+		uint dst = OPER_PCIX_32(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_32(res);
@@ -4209,14 +4211,14 @@ M68KMAKE_OP(cmpi, 32, ., pcix)
 		FLAG_C = CFLAG_SUB_32(src, dst, res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
 M68KMAKE_OP(cmpm, 8, ., ax7)
 {
-	uint src = OPER_AY_PI_8();
-	uint dst = OPER_A7_PI_8();
+	uint src = OPER_AY_PI_8(m68k);
+	uint dst = OPER_A7_PI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -4228,8 +4230,8 @@ M68KMAKE_OP(cmpm, 8, ., ax7)
 
 M68KMAKE_OP(cmpm, 8, ., ay7)
 {
-	uint src = OPER_A7_PI_8();
-	uint dst = OPER_AX_PI_8();
+	uint src = OPER_A7_PI_8(m68k);
+	uint dst = OPER_AX_PI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -4241,8 +4243,8 @@ M68KMAKE_OP(cmpm, 8, ., ay7)
 
 M68KMAKE_OP(cmpm, 8, ., axy7)
 {
-	uint src = OPER_A7_PI_8();
-	uint dst = OPER_A7_PI_8();
+	uint src = OPER_A7_PI_8(m68k);
+	uint dst = OPER_A7_PI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -4254,8 +4256,8 @@ M68KMAKE_OP(cmpm, 8, ., axy7)
 
 M68KMAKE_OP(cmpm, 8, ., .)
 {
-	uint src = OPER_AY_PI_8();
-	uint dst = OPER_AX_PI_8();
+	uint src = OPER_AY_PI_8(m68k);
+	uint dst = OPER_AX_PI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -4267,8 +4269,8 @@ M68KMAKE_OP(cmpm, 8, ., .)
 
 M68KMAKE_OP(cmpm, 16, ., .)
 {
-	uint src = OPER_AY_PI_16();
-	uint dst = OPER_AX_PI_16();
+	uint src = OPER_AY_PI_16(m68k);
+	uint dst = OPER_AX_PI_16(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
@@ -4280,8 +4282,8 @@ M68KMAKE_OP(cmpm, 16, ., .)
 
 M68KMAKE_OP(cmpm, 32, ., .)
 {
-	uint src = OPER_AY_PI_32();
-	uint dst = OPER_AX_PI_32();
+	uint src = OPER_AY_PI_32(m68k);
+	uint dst = OPER_AX_PI_32(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
@@ -4300,7 +4302,7 @@ M68KMAKE_OP(cpbcc, 32, ., .)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
@@ -4313,7 +4315,7 @@ M68KMAKE_OP(cpdbcc, 32, ., .)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
@@ -4326,7 +4328,7 @@ M68KMAKE_OP(cpgen, 32, ., .)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
@@ -4339,7 +4341,7 @@ M68KMAKE_OP(cpscc, 32, ., .)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
@@ -4352,7 +4354,7 @@ M68KMAKE_OP(cptrapcc, 32, ., .)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
@@ -4373,7 +4375,7 @@ M68KMAKE_OP(dbf, 16, ., .)
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4393,7 +4395,7 @@ M68KMAKE_OP(dbcc, 16, ., .)
 			uint offset = OPER_I_16();
 			REG_PC -= 2;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_16(offset);
+			m68ki_branch_16(m68k, offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
 			return;
 		}
@@ -4439,7 +4441,7 @@ M68KMAKE_OP(divs, 16, ., d)
 		FLAG_V = VFLAG_SET;
 		return;
 	}
-	m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+	m68ki_exception_trap(m68k, EXCEPTION_ZERO_DIVIDE);
 }
 
 
@@ -4477,7 +4479,7 @@ M68KMAKE_OP(divs, 16, ., .)
 		FLAG_V = VFLAG_SET;
 		return;
 	}
-	m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+	m68ki_exception_trap(m68k, EXCEPTION_ZERO_DIVIDE);
 }
 
 
@@ -4503,7 +4505,7 @@ M68KMAKE_OP(divu, 16, ., d)
 		FLAG_V = VFLAG_SET;
 		return;
 	}
-	m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+	m68ki_exception_trap(m68k, EXCEPTION_ZERO_DIVIDE);
 }
 
 
@@ -4529,7 +4531,7 @@ M68KMAKE_OP(divu, 16, ., .)
 		FLAG_V = VFLAG_SET;
 		return;
 	}
-	m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+	m68ki_exception_trap(m68k, EXCEPTION_ZERO_DIVIDE);
 }
 
 
@@ -4598,10 +4600,10 @@ M68KMAKE_OP(divl, 32, ., d)
 			FLAG_C = CFLAG_CLEAR;
 			return;
 		}
-		m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+		m68ki_exception_trap(m68k, EXCEPTION_ZERO_DIVIDE);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 
 #else
 
@@ -4735,10 +4737,10 @@ M68KMAKE_OP(divl, 32, ., d)
 			FLAG_C = CFLAG_CLEAR;
 			return;
 		}
-		m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+		m68ki_exception_trap(m68k, EXCEPTION_ZERO_DIVIDE);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 
 #endif
 }
@@ -4809,10 +4811,10 @@ M68KMAKE_OP(divl, 32, ., .)
 			FLAG_C = CFLAG_CLEAR;
 			return;
 		}
-		m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+		m68ki_exception_trap(m68k, EXCEPTION_ZERO_DIVIDE);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 
 #else
 
@@ -4946,10 +4948,10 @@ M68KMAKE_OP(divl, 32, ., .)
 			FLAG_C = CFLAG_CLEAR;
 			return;
 		}
-		m68ki_exception_trap(EXCEPTION_ZERO_DIVIDE);
+		m68ki_exception_trap(m68k, EXCEPTION_ZERO_DIVIDE);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 
 #endif
 }
@@ -5110,7 +5112,7 @@ M68KMAKE_OP(eori, 32, ., .)
 
 M68KMAKE_OP(eori, 16, toc, .)
 {
-	m68ki_set_ccr(m68ki_get_ccr() ^ OPER_I_16());
+	m68ki_set_ccr(m68k, m68ki_get_ccr() ^ OPER_I_16());
 }
 
 
@@ -5120,10 +5122,10 @@ M68KMAKE_OP(eori, 16, tos, .)
 	{
 		uint src = OPER_I_16();
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_set_sr(m68ki_get_sr() ^ src);
+		m68ki_set_sr(m68k, m68ki_get_sr() ^ src);
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -5197,18 +5199,18 @@ M68KMAKE_OP(extb, 32, ., .)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
 M68KMAKE_OP(illegal, 0, ., .)
 {
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 M68KMAKE_OP(jmp, 32, ., .)
 {
-	m68ki_jump(M68KMAKE_GET_EA_AY_32);
+	m68ki_jump(m68k, M68KMAKE_GET_EA_AY_32);
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 	if(REG_PC == REG_PPC)
 		USE_ALL_CYCLES();
@@ -5219,8 +5221,8 @@ M68KMAKE_OP(jsr, 32, ., .)
 {
 	uint ea = M68KMAKE_GET_EA_AY_32;
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(REG_PC);
-	m68ki_jump(ea);
+	m68ki_push_32(m68k, REG_PC);
+	m68ki_jump(m68k, ea);
 }
 
 
@@ -5242,7 +5244,7 @@ M68KMAKE_OP(link, 16, ., .)
 {
 	uint* r_dst = &AY;
 
-	m68ki_push_32(*r_dst);
+	m68ki_push_32(m68k, *r_dst);
 	*r_dst = REG_A[7];
 	REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + MAKE_INT_16(OPER_I_16()));
 }
@@ -5257,7 +5259,7 @@ M68KMAKE_OP(link, 32, ., a7)
 		REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + OPER_I_32());
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -5267,12 +5269,12 @@ M68KMAKE_OP(link, 32, ., .)
 	{
 		uint* r_dst = &AY;
 
-		m68ki_push_32(*r_dst);
+		m68ki_push_32(m68k, *r_dst);
 		*r_dst = REG_A[7];
 		REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + OPER_I_32());
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -6617,7 +6619,7 @@ M68KMAKE_OP(move, 16, frc, d)
 		DY = MASK_OUT_BELOW_16(DY) | m68ki_get_ccr();
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -6628,19 +6630,19 @@ M68KMAKE_OP(move, 16, frc, .)
 		m68ki_write_16(M68KMAKE_GET_EA_AY_16, m68ki_get_ccr());
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
 M68KMAKE_OP(move, 16, toc, d)
 {
-	m68ki_set_ccr(DY);
+	m68ki_set_ccr(m68k, DY);
 }
 
 
 M68KMAKE_OP(move, 16, toc, .)
 {
-	m68ki_set_ccr(M68KMAKE_GET_OPER_AY_16);
+	m68ki_set_ccr(m68k, M68KMAKE_GET_OPER_AY_16);
 }
 
 
@@ -6651,7 +6653,7 @@ M68KMAKE_OP(move, 16, frs, d)
 		DY = MASK_OUT_BELOW_16(DY) | m68ki_get_sr();
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -6663,7 +6665,7 @@ M68KMAKE_OP(move, 16, frs, .)
 		m68ki_write_16(ea, m68ki_get_sr());
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -6671,10 +6673,10 @@ M68KMAKE_OP(move, 16, tos, d)
 {
 	if(FLAG_S)
 	{
-		m68ki_set_sr(DY);
+		m68ki_set_sr(m68k, DY);
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -6684,10 +6686,10 @@ M68KMAKE_OP(move, 16, tos, .)
 	{
 		uint new_sr = M68KMAKE_GET_OPER_AY_16;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_set_sr(new_sr);
+		m68ki_set_sr(m68k, new_sr);
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -6698,7 +6700,7 @@ M68KMAKE_OP(move, 32, fru, .)
 		AY = REG_USP;
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -6710,7 +6712,7 @@ M68KMAKE_OP(move, 32, tou, .)
 		REG_USP = AY;
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -6750,7 +6752,7 @@ M68KMAKE_OP(movec, 32, cr, .)
 					REG_DA[(word2 >> 12) & 15] = REG_CAAR;
 					return;
 				}
-				m68ki_exception_illegal();
+				m68ki_exception_illegal(m68k);
 				break;
 			case 0x803:			   /* MSP */
 				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -6758,7 +6760,7 @@ M68KMAKE_OP(movec, 32, cr, .)
 					REG_DA[(word2 >> 12) & 15] = FLAG_M ? REG_SP : REG_MSP;
 					return;
 				}
-				m68ki_exception_illegal();
+				m68ki_exception_illegal(m68k);
 				return;
 			case 0x804:			   /* ISP */
 				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -6766,17 +6768,17 @@ M68KMAKE_OP(movec, 32, cr, .)
 					REG_DA[(word2 >> 12) & 15] = FLAG_M ? REG_ISP : REG_SP;
 					return;
 				}
-				m68ki_exception_illegal();
+				m68ki_exception_illegal(m68k);
 				return;
 			default:
-				m68ki_exception_illegal();
+				m68ki_exception_illegal(m68k);
 				return;
 			}
 		}
-		m68ki_exception_privilege_violation();
+		m68ki_exception_privilege_violation(m68k);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -6803,7 +6805,7 @@ M68KMAKE_OP(movec, 32, rc, .)
 					REG_CACR = REG_DA[(word2 >> 12) & 15];
 					return;
 				}
-				m68ki_exception_illegal();
+				m68ki_exception_illegal(m68k);
 				return;
 			case 0x800:			   /* USP */
 				REG_USP = REG_DA[(word2 >> 12) & 15];
@@ -6817,7 +6819,7 @@ M68KMAKE_OP(movec, 32, rc, .)
 					REG_CAAR = REG_DA[(word2 >> 12) & 15];
 					return;
 				}
-				m68ki_exception_illegal();
+				m68ki_exception_illegal(m68k);
 				return;
 			case 0x803:			   /* MSP */
 				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -6831,7 +6833,7 @@ M68KMAKE_OP(movec, 32, rc, .)
 					REG_SP = REG_DA[(word2 >> 12) & 15];
 					return;
 				}
-				m68ki_exception_illegal();
+				m68ki_exception_illegal(m68k);
 				return;
 			case 0x804:			   /* ISP */
 				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -6844,17 +6846,17 @@ M68KMAKE_OP(movec, 32, rc, .)
 					REG_ISP = REG_DA[(word2 >> 12) & 15];
 					return;
 				}
-				m68ki_exception_illegal();
+				m68ki_exception_illegal(m68k);
 				return;
 			default:
-				m68ki_exception_illegal();
+				m68ki_exception_illegal(m68k);
 				return;
 			}
 		}
-		m68ki_exception_privilege_violation();
+		m68ki_exception_privilege_violation(m68k);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -7142,26 +7144,26 @@ M68KMAKE_OP(moves, 8, ., .)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			if(BIT_B(word2))		   /* Register to memory */
 			{
-				m68ki_write_8_fc(ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+				m68ki_write_8_fc(m68k, ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
 				return;
 			}
 			if(BIT_F(word2))		   /* Memory to address register */
 			{
-				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(ea, REG_SFC));
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(m68k, ea, REG_SFC));
 				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
 					USE_CYCLES(2);
 				return;
 			}
 			/* Memory to data register */
-			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(ea, REG_SFC);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(m68k, ea, REG_SFC);
 			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
 				USE_CYCLES(2);
 			return;
 		}
-		m68ki_exception_privilege_violation();
+		m68ki_exception_privilege_violation(m68k);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -7177,26 +7179,26 @@ M68KMAKE_OP(moves, 16, ., .)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			if(BIT_B(word2))		   /* Register to memory */
 			{
-				m68ki_write_16_fc(ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+				m68ki_write_16_fc(m68k, ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
 				return;
 			}
 			if(BIT_F(word2))		   /* Memory to address register */
 			{
-				REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(ea, REG_SFC));
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(m68k, ea, REG_SFC));
 				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
 					USE_CYCLES(2);
 				return;
 			}
 			/* Memory to data register */
-			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(ea, REG_SFC);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(m68k, ea, REG_SFC);
 			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
 				USE_CYCLES(2);
 			return;
 		}
-		m68ki_exception_privilege_violation();
+		m68ki_exception_privilege_violation(m68k);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -7212,21 +7214,21 @@ M68KMAKE_OP(moves, 32, ., .)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			if(BIT_B(word2))		   /* Register to memory */
 			{
-				m68ki_write_32_fc(ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+				m68ki_write_32_fc(m68k, ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
 				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
 					USE_CYCLES(2);
 				return;
 			}
 			/* Memory to register */
-			REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(ea, REG_SFC);
+			REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(m68k, ea, REG_SFC);
 			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
 				USE_CYCLES(2);
 			return;
 		}
-		m68ki_exception_privilege_violation();
+		m68ki_exception_privilege_violation(m68k);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -7345,7 +7347,7 @@ M68KMAKE_OP(mull, 32, ., d)
 		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 
 #else
 
@@ -7415,7 +7417,7 @@ M68KMAKE_OP(mull, 32, ., d)
 			FLAG_V = (hi != 0) << 7;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 
 #endif
 }
@@ -7469,7 +7471,7 @@ M68KMAKE_OP(mull, 32, ., .)
 		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 
 #else
 
@@ -7539,7 +7541,7 @@ M68KMAKE_OP(mull, 32, ., .)
 			FLAG_V = (hi != 0) << 7;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 
 #endif
 }
@@ -8073,7 +8075,7 @@ M68KMAKE_OP(ori, 32, ., .)
 
 M68KMAKE_OP(ori, 16, toc, .)
 {
-	m68ki_set_ccr(m68ki_get_ccr() | OPER_I_16());
+	m68ki_set_ccr(m68k, m68ki_get_ccr() | OPER_I_16());
 }
 
 
@@ -8083,10 +8085,10 @@ M68KMAKE_OP(ori, 16, tos, .)
 	{
 		uint src = OPER_I_16();
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_set_sr(m68ki_get_sr() | src);
+		m68ki_set_sr(m68k, m68ki_get_sr() | src);
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -8101,7 +8103,7 @@ M68KMAKE_OP(pack, 16, rr, .)
 		*r_dst = MASK_OUT_BELOW_8(*r_dst) | ((src >> 4) & 0x00f0) | (src & 0x000f);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -8118,7 +8120,7 @@ M68KMAKE_OP(pack, 16, mm, ax7)
 		m68ki_write_8(EA_A7_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -8135,7 +8137,7 @@ M68KMAKE_OP(pack, 16, mm, ay7)
 		m68ki_write_8(EA_AX_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -8151,7 +8153,7 @@ M68KMAKE_OP(pack, 16, mm, axy7)
 		m68ki_write_8(EA_A7_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -8168,7 +8170,7 @@ M68KMAKE_OP(pack, 16, mm, .)
 		m68ki_write_8(EA_AX_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -8176,7 +8178,7 @@ M68KMAKE_OP(pea, 32, ., .)
 {
 	uint ea = M68KMAKE_GET_EA_AY_32;
 
-	m68ki_push_32(ea);
+	m68ki_push_32(m68k, ea);
 }
 
 
@@ -8188,7 +8190,7 @@ M68KMAKE_OP(reset, 0, ., .)
 		USE_CYCLES(CYC_RESET);
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -8928,14 +8930,14 @@ M68KMAKE_OP(rtd, 32, ., .)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
-		uint new_pc = m68ki_pull_32();
+		uint new_pc = m68ki_pull_32(m68k);
 
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + MAKE_INT_16(OPER_I_16()));
-		m68ki_jump(new_pc);
+		m68ki_jump(m68k, new_pc);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -8951,10 +8953,10 @@ M68KMAKE_OP(rte, 32, ., .)
 
 		if(CPU_TYPE_IS_000(CPU_TYPE))
 		{
-			new_sr = m68ki_pull_16();
-			new_pc = m68ki_pull_32();
-			m68ki_jump(new_pc);
-			m68ki_set_sr(new_sr);
+			new_sr = m68ki_pull_16(m68k);
+			new_pc = m68ki_pull_32(m68k);
+			m68ki_jump(m68k, new_pc);
+			m68ki_set_sr(m68k, new_sr);
 			return;
 		}
 
@@ -8963,15 +8965,15 @@ M68KMAKE_OP(rte, 32, ., .)
 			format_word = m68ki_read_16(REG_A[7]+6) >> 12;
 			if(format_word == 0)
 			{
-				new_sr = m68ki_pull_16();
-				new_pc = m68ki_pull_32();
-				m68ki_fake_pull_16();	/* format word */
-				m68ki_jump(new_pc);
-				m68ki_set_sr(new_sr);
+				new_sr = m68ki_pull_16(m68k);
+				new_pc = m68ki_pull_32(m68k);
+				m68ki_fake_pull_16(m68k);	/* format word */
+				m68ki_jump(m68k, new_pc);
+				m68ki_set_sr(m68k, new_sr);
 				return;
 			}
 			/* Not handling bus fault (9) */
-			m68ki_exception_format_error();
+			m68ki_exception_format_error(m68k);
 			return;
 		}
 
@@ -8981,32 +8983,32 @@ rte_loop:
 		switch(format_word)
 		{
 			case 0: /* Normal */
-				new_sr = m68ki_pull_16();
-				new_pc = m68ki_pull_32();
-				m68ki_fake_pull_16();	/* format word */
-				m68ki_jump(new_pc);
-				m68ki_set_sr(new_sr);
+				new_sr = m68ki_pull_16(m68k);
+				new_pc = m68ki_pull_32(m68k);
+				m68ki_fake_pull_16(m68k);	/* format word */
+				m68ki_jump(m68k, new_pc);
+				m68ki_set_sr(m68k, new_sr);
 				return;
 			case 1: /* Throwaway */
-				new_sr = m68ki_pull_16();
-				m68ki_fake_pull_32();	/* program counter */
-				m68ki_fake_pull_16();	/* format word */
-				m68ki_set_sr_noint(new_sr);
+				new_sr = m68ki_pull_16(m68k);
+				m68ki_fake_pull_32(m68k);	/* program counter */
+				m68ki_fake_pull_16(m68k);	/* format word */
+				m68ki_set_sr_noint(m68k, new_sr);
 				goto rte_loop;
 			case 2: /* Trap */
-				new_sr = m68ki_pull_16();
-				new_pc = m68ki_pull_32();
-				m68ki_fake_pull_16();	/* format word */
-				m68ki_fake_pull_32();	/* address */
-				m68ki_jump(new_pc);
-				m68ki_set_sr(new_sr);
+				new_sr = m68ki_pull_16(m68k);
+				new_pc = m68ki_pull_32(m68k);
+				m68ki_fake_pull_16(m68k);	/* format word */
+				m68ki_fake_pull_32(m68k);	/* address */
+				m68ki_jump(m68k, new_pc);
+				m68ki_set_sr(m68k, new_sr);
 				return;
 		}
 		/* Not handling long or short bus fault */
-		m68ki_exception_format_error();
+		m68ki_exception_format_error(m68k);
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -9020,22 +9022,22 @@ M68KMAKE_OP(rtm, 32, ., .)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
 M68KMAKE_OP(rtr, 32, ., .)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
-	m68ki_set_ccr(m68ki_pull_16());
-	m68ki_jump(m68ki_pull_32());
+	m68ki_set_ccr(m68k, m68ki_pull_16(m68k));
+	m68ki_jump(m68k, m68ki_pull_32(m68k));
 }
 
 
 M68KMAKE_OP(rts, 32, ., .)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
-	m68ki_jump(m68ki_pull_32());
+	m68ki_jump(m68k, m68ki_pull_32(m68k));
 }
 
 
@@ -9067,7 +9069,7 @@ M68KMAKE_OP(sbcd, 8, rr, .)
 
 M68KMAKE_OP(sbcd, 8, mm, ax7)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
@@ -9093,7 +9095,7 @@ M68KMAKE_OP(sbcd, 8, mm, ax7)
 
 M68KMAKE_OP(sbcd, 8, mm, ay7)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
@@ -9119,7 +9121,7 @@ M68KMAKE_OP(sbcd, 8, mm, ay7)
 
 M68KMAKE_OP(sbcd, 8, mm, axy7)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
@@ -9145,7 +9147,7 @@ M68KMAKE_OP(sbcd, 8, mm, axy7)
 
 M68KMAKE_OP(sbcd, 8, mm, .)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
@@ -9217,11 +9219,11 @@ M68KMAKE_OP(stop, 0, ., .)
 		uint new_sr = OPER_I_16();
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		CPU_STOPPED |= STOP_LEVEL_STOP;
-		m68ki_set_sr(new_sr);
-		m68ki_remaining_cycles = 0;
+		m68ki_set_sr(m68k, new_sr);
+		m68k->remaining_cycles = 0;
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
@@ -9713,7 +9715,7 @@ M68KMAKE_OP(subx, 32, rr, .)
 
 M68KMAKE_OP(subx, 8, mm, ax7)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = dst - src - XFLAG_AS_1();
@@ -9731,7 +9733,7 @@ M68KMAKE_OP(subx, 8, mm, ax7)
 
 M68KMAKE_OP(subx, 8, mm, ay7)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = dst - src - XFLAG_AS_1();
@@ -9749,7 +9751,7 @@ M68KMAKE_OP(subx, 8, mm, ay7)
 
 M68KMAKE_OP(subx, 8, mm, axy7)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = dst - src - XFLAG_AS_1();
@@ -9767,7 +9769,7 @@ M68KMAKE_OP(subx, 8, mm, axy7)
 
 M68KMAKE_OP(subx, 8, mm, .)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = dst - src - XFLAG_AS_1();
@@ -9785,7 +9787,7 @@ M68KMAKE_OP(subx, 8, mm, .)
 
 M68KMAKE_OP(subx, 16, mm, .)
 {
-	uint src = OPER_AY_PD_16();
+	uint src = OPER_AY_PD_16(m68k);
 	uint ea  = EA_AX_PD_16();
 	uint dst = m68ki_read_16(ea);
 	uint res = dst - src - XFLAG_AS_1();
@@ -9803,7 +9805,7 @@ M68KMAKE_OP(subx, 16, mm, .)
 
 M68KMAKE_OP(subx, 32, mm, .)
 {
-	uint src = OPER_AY_PD_32();
+	uint src = OPER_AY_PD_32(m68k);
 	uint ea  = EA_AX_PD_32();
 	uint dst = m68ki_read_32(ea);
 	uint res = dst - src - XFLAG_AS_1();
@@ -9861,7 +9863,7 @@ M68KMAKE_OP(tas, 8, ., .)
 M68KMAKE_OP(trap, 0, ., .)
 {
 	/* Trap#n stacks exception frame type 0 */
-	m68ki_exception_trapN(EXCEPTION_TRAP_BASE + (REG_IR & 0xf));	/* HJB 990403 */
+	m68ki_exception_trapN(m68k, EXCEPTION_TRAP_BASE + (REG_IR & 0xf));	/* HJB 990403 */
 }
 
 
@@ -9869,10 +9871,10 @@ M68KMAKE_OP(trapt, 0, ., .)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
-		m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+		m68ki_exception_trap(m68k, EXCEPTION_TRAPV);	/* HJB 990403 */
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -9880,10 +9882,10 @@ M68KMAKE_OP(trapt, 16, ., .)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
-		m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+		m68ki_exception_trap(m68k, EXCEPTION_TRAPV);	/* HJB 990403 */
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -9891,10 +9893,10 @@ M68KMAKE_OP(trapt, 32, ., .)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
-		m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+		m68ki_exception_trap(m68k, EXCEPTION_TRAPV);	/* HJB 990403 */
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -9904,7 +9906,7 @@ M68KMAKE_OP(trapf, 0, ., .)
 	{
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -9915,7 +9917,7 @@ M68KMAKE_OP(trapf, 16, ., .)
 		REG_PC += 2;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -9926,7 +9928,7 @@ M68KMAKE_OP(trapf, 32, ., .)
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -9935,10 +9937,10 @@ M68KMAKE_OP(trapcc, 0, ., .)
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(M68KMAKE_CC)
-			m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+			m68ki_exception_trap(m68k, EXCEPTION_TRAPV);	/* HJB 990403 */
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -9948,13 +9950,13 @@ M68KMAKE_OP(trapcc, 16, ., .)
 	{
 		if(M68KMAKE_CC)
 		{
-			m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+			m68ki_exception_trap(m68k, EXCEPTION_TRAPV);	/* HJB 990403 */
 			return;
 		}
 		REG_PC += 2;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -9964,13 +9966,13 @@ M68KMAKE_OP(trapcc, 32, ., .)
 	{
 		if(M68KMAKE_CC)
 		{
-			m68ki_exception_trap(EXCEPTION_TRAPV);	/* HJB 990403 */
+			m68ki_exception_trap(m68k, EXCEPTION_TRAPV);	/* HJB 990403 */
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -9980,7 +9982,7 @@ M68KMAKE_OP(trapv, 0, ., .)
 	{
 		return;
 	}
-	m68ki_exception_trap(EXCEPTION_TRAPV);  /* HJB 990403 */
+	m68ki_exception_trap(m68k, EXCEPTION_TRAPV);  /* HJB 990403 */
 }
 
 
@@ -10010,7 +10012,7 @@ M68KMAKE_OP(tst, 8, ., pcdi)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
-		uint res = OPER_PCDI_8();
+		uint res = OPER_PCDI_8(m68k);
 
 		FLAG_N = NFLAG_8(res);
 		FLAG_Z = res;
@@ -10018,7 +10020,7 @@ M68KMAKE_OP(tst, 8, ., pcdi)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10026,7 +10028,7 @@ M68KMAKE_OP(tst, 8, ., pcix)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
-		uint res = OPER_PCIX_8();
+		uint res = OPER_PCIX_8(m68k);
 
 		FLAG_N = NFLAG_8(res);
 		FLAG_Z = res;
@@ -10034,7 +10036,7 @@ M68KMAKE_OP(tst, 8, ., pcix)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10050,7 +10052,7 @@ M68KMAKE_OP(tst, 8, ., i)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10077,7 +10079,7 @@ M68KMAKE_OP(tst, 16, ., a)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10096,7 +10098,7 @@ M68KMAKE_OP(tst, 16, ., pcdi)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
-		uint res = OPER_PCDI_16();
+		uint res = OPER_PCDI_16(m68k);
 
 		FLAG_N = NFLAG_16(res);
 		FLAG_Z = res;
@@ -10104,7 +10106,7 @@ M68KMAKE_OP(tst, 16, ., pcdi)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10112,7 +10114,7 @@ M68KMAKE_OP(tst, 16, ., pcix)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
-		uint res = OPER_PCIX_16();
+		uint res = OPER_PCIX_16(m68k);
 
 		FLAG_N = NFLAG_16(res);
 		FLAG_Z = res;
@@ -10120,7 +10122,7 @@ M68KMAKE_OP(tst, 16, ., pcix)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10136,7 +10138,7 @@ M68KMAKE_OP(tst, 16, ., i)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10163,7 +10165,7 @@ M68KMAKE_OP(tst, 32, ., a)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10182,7 +10184,7 @@ M68KMAKE_OP(tst, 32, ., pcdi)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
-		uint res = OPER_PCDI_32();
+		uint res = OPER_PCDI_32(m68k);
 
 		FLAG_N = NFLAG_32(res);
 		FLAG_Z = res;
@@ -10190,7 +10192,7 @@ M68KMAKE_OP(tst, 32, ., pcdi)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10198,7 +10200,7 @@ M68KMAKE_OP(tst, 32, ., pcix)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
-		uint res = OPER_PCIX_32();
+		uint res = OPER_PCIX_32(m68k);
 
 		FLAG_N = NFLAG_32(res);
 		FLAG_Z = res;
@@ -10206,7 +10208,7 @@ M68KMAKE_OP(tst, 32, ., pcix)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10222,7 +10224,7 @@ M68KMAKE_OP(tst, 32, ., i)
 		FLAG_C = CFLAG_CLEAR;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10237,7 +10239,7 @@ M68KMAKE_OP(unlk, 32, ., .)
 	uint* r_dst = &AY;
 
 	REG_A[7] = *r_dst;
-	*r_dst = m68ki_pull_32();
+	*r_dst = m68ki_pull_32(m68k);
 }
 
 
@@ -10252,7 +10254,7 @@ M68KMAKE_OP(unpk, 16, rr, .)
 		*r_dst = MASK_OUT_BELOW_16(*r_dst) | (((((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16()) & 0xffff);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10261,7 +10263,7 @@ M68KMAKE_OP(unpk, 16, mm, ax7)
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		/* Note: AX and AY are reversed in Motorola's docs */
-		uint src = OPER_AY_PD_8();
+		uint src = OPER_AY_PD_8(m68k);
 		uint ea_dst;
 
 		src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16();
@@ -10271,7 +10273,7 @@ M68KMAKE_OP(unpk, 16, mm, ax7)
 		m68ki_write_8(ea_dst, src & 0xff);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10280,7 +10282,7 @@ M68KMAKE_OP(unpk, 16, mm, ay7)
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		/* Note: AX and AY are reversed in Motorola's docs */
-		uint src = OPER_A7_PD_8();
+		uint src = OPER_A7_PD_8(m68k);
 		uint ea_dst;
 
 		src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16();
@@ -10290,7 +10292,7 @@ M68KMAKE_OP(unpk, 16, mm, ay7)
 		m68ki_write_8(ea_dst, src & 0xff);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10298,7 +10300,7 @@ M68KMAKE_OP(unpk, 16, mm, axy7)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
-		uint src = OPER_A7_PD_8();
+		uint src = OPER_A7_PD_8(m68k);
 		uint ea_dst;
 
 		src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16();
@@ -10308,7 +10310,7 @@ M68KMAKE_OP(unpk, 16, mm, axy7)
 		m68ki_write_8(ea_dst, src & 0xff);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
@@ -10317,7 +10319,7 @@ M68KMAKE_OP(unpk, 16, mm, .)
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		/* Note: AX and AY are reversed in Motorola's docs */
-		uint src = OPER_AY_PD_8();
+		uint src = OPER_AY_PD_8(m68k);
 		uint ea_dst;
 
 		src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16();
@@ -10327,7 +10329,7 @@ M68KMAKE_OP(unpk, 16, mm, .)
 		m68ki_write_8(ea_dst, src & 0xff);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
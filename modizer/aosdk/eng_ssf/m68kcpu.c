@@ -32,6 +32,7 @@ static const char* copyright_notice =
 /* ================================ INCLUDES ============================== */
 /* ======================================================================== */
 
+#include <pthread.h>
 #include "m68kops.h"
 #include "m68kcpu.h"
 
@@ -39,10 +40,6 @@ static const char* copyright_notice =
 /* ================================= DATA ================================= */
 /* ======================================================================== */
 
-int  m68ki_initial_cycles;
-int  m68ki_remaining_cycles = 0;                     /* Number of clocks remaining */
-uint m68ki_tracing = 0;
-uint m68ki_address_space;
 
 #ifdef M68K_LOG_ENABLE
 char* m68ki_cpu_names[9] =
@@ -60,16 +57,6 @@ char* m68ki_cpu_names[9] =
 #endif /* M68K_LOG_ENABLE */
 
 /* The CPU core */
-m68ki_cpu_core m68ki_cpu = {0};
-
-#if M68K_EMULATE_ADDRESS_ERROR
-jmp_buf m68ki_aerr_trap;
-#endif /* M68K_EMULATE_ADDRESS_ERROR */
-
-uint    m68ki_aerr_address;
-uint    m68ki_aerr_write_mode;
-uint    m68ki_aerr_fc;
-
 /* Used by shift & rotate instructions */
 uint8 m68ki_shift_8_table[65] =
 {
@@ -364,60 +351,46 @@ uint8 m68ki_ea_idx_cycle_table[64] =
  */
 
 /* Interrupt acknowledge */
-static int default_int_ack_callback_data;
-static int default_int_ack_callback(int int_level)
+static int default_int_ack_callback(m68ki_cpu_core *m68k, int int_level)
 {
-	default_int_ack_callback_data = int_level;
 	CPU_INT_LEVEL = 0;
 	return M68K_INT_ACK_AUTOVECTOR;
 }
 
 /* Breakpoint acknowledge */
-static unsigned int default_bkpt_ack_callback_data;
-static void default_bkpt_ack_callback(unsigned int data)
+static void default_bkpt_ack_callback(m68ki_cpu_core *m68k, unsigned int data)
 {
-	default_bkpt_ack_callback_data = data;
 }
 
 /* Called when a reset instruction is executed */
-static void default_reset_instr_callback(void)
+static void default_reset_instr_callback(m68ki_cpu_core *m68k)
 {
 }
 
 /* Called when the program counter changed by a large value */
-static unsigned int default_pc_changed_callback_data;
-static void default_pc_changed_callback(unsigned int new_pc)
+static void default_pc_changed_callback(m68ki_cpu_core *m68k, unsigned int new_pc)
 {
-	default_pc_changed_callback_data = new_pc;
 }
 
 /* Called every time there's bus activity (read/write to/from memory */
-static unsigned int default_set_fc_callback_data;
-static void default_set_fc_callback(unsigned int new_fc)
+static void default_set_fc_callback(m68ki_cpu_core *m68k, unsigned int new_fc)
 {
-	default_set_fc_callback_data = new_fc;
 }
 
 /* Called every instruction cycle prior to execution */
-static void default_instr_hook_callback(void)
+static void default_instr_hook_callback(m68ki_cpu_core *m68k)
 {
 }
 
 
-#if M68K_EMULATE_ADDRESS_ERROR
-	#include <setjmp.h>
-	jmp_buf m68ki_aerr_trap;
-#endif /* M68K_EMULATE_ADDRESS_ERROR */
-
-
 /* ======================================================================== */
 /* ================================= API ================================== */
 /* ======================================================================== */
 
 /* Access the internals of the CPU */
-unsigned int m68k_get_reg(void* context, m68k_register_t regnum)
+unsigned int m68k_get_reg(m68ki_cpu_core *m68k, m68k_register_t regnum)
 {
-	m68ki_cpu_core* cpu = context != NULL ?(m68ki_cpu_core*)context : &m68ki_cpu;
+	m68ki_cpu_core* cpu = m68k;
 
 	switch(regnum)
 	{
@@ -475,7 +448,7 @@ unsigned int m68k_get_reg(void* context, m68k_register_t regnum)
 	return 0;
 }
 
-void m68k_set_reg(m68k_register_t regnum, unsigned int value)
+void m68k_set_reg(m68ki_cpu_core *m68k, m68k_register_t regnum, unsigned int value)
 {
 	switch(regnum)
 	{
@@ -495,8 +468,8 @@ void m68k_set_reg(m68k_register_t regnum, unsigned int value)
 		case M68K_REG_A5:	REG_A[5] = MASK_OUT_ABOVE_32(value); return;
 		case M68K_REG_A6:	REG_A[6] = MASK_OUT_ABOVE_32(value); return;
 		case M68K_REG_A7:	REG_A[7] = MASK_OUT_ABOVE_32(value); return;
-		case M68K_REG_PC:	m68ki_jump(MASK_OUT_ABOVE_32(value)); return;
-		case M68K_REG_SR:	m68ki_set_sr(value); return;
+		case M68K_REG_PC:	m68ki_jump(m68k, MASK_OUT_ABOVE_32(value)); return;
+		case M68K_REG_SR:	m68ki_set_sr(m68k, value); return;
 		case M68K_REG_SP:	REG_SP = MASK_OUT_ABOVE_32(value); return;
 		case M68K_REG_USP:	if(FLAG_S)
 								REG_USP = MASK_OUT_ABOVE_32(value);
@@ -520,45 +493,45 @@ void m68k_set_reg(m68k_register_t regnum, unsigned int value)
 		case M68K_REG_CAAR:	REG_CAAR = MASK_OUT_ABOVE_32(value); return;
 		case M68K_REG_PPC:	REG_PPC = MASK_OUT_ABOVE_32(value); return;
 		case M68K_REG_IR:	REG_IR = MASK_OUT_ABOVE_16(value); return;
-		case M68K_REG_CPU_TYPE: m68k_set_cpu_type(value); return;
+		case M68K_REG_CPU_TYPE: m68k_set_cpu_type(m68k, value); return;
 		default:			return;
 	}
 }
 
 /* Set the callbacks */
-void m68k_set_int_ack_callback(int  (*callback)(int int_level))
+void m68k_set_int_ack_callback(m68ki_cpu_core *m68k, int  (*callback)(m68ki_cpu_core *m68k, int int_level))
 {
 	CALLBACK_INT_ACK = callback ? callback : default_int_ack_callback;
 }
 
-void m68k_set_bkpt_ack_callback(void  (*callback)(unsigned int data))
+void m68k_set_bkpt_ack_callback(m68ki_cpu_core *m68k, void  (*callback)(m68ki_cpu_core *m68k, unsigned int data))
 {
 	CALLBACK_BKPT_ACK = callback ? callback : default_bkpt_ack_callback;
 }
 
-void m68k_set_reset_instr_callback(void  (*callback)(void))
+void m68k_set_reset_instr_callback(m68ki_cpu_core *m68k, void  (*callback)(m68ki_cpu_core *m68k))
 {
 	CALLBACK_RESET_INSTR = callback ? callback : default_reset_instr_callback;
 }
 
-void m68k_set_pc_changed_callback(void  (*callback)(unsigned int new_pc))
+void m68k_set_pc_changed_callback(m68ki_cpu_core *m68k, void  (*callback)(m68ki_cpu_core *m68k, unsigned int new_pc))
 {
 	CALLBACK_PC_CHANGED = callback ? callback : default_pc_changed_callback;
 }
 
-void m68k_set_fc_callback(void  (*callback)(unsigned int new_fc))
+void m68k_set_fc_callback(m68ki_cpu_core *m68k, void  (*callback)(m68ki_cpu_core *m68k, unsigned int new_fc))
 {
 	CALLBACK_SET_FC = callback ? callback : default_set_fc_callback;
 }
 
-void m68k_set_instr_hook_callback(void  (*callback)(void))
+void m68k_set_instr_hook_callback(m68ki_cpu_core *m68k, void  (*callback)(m68ki_cpu_core *m68k))
 {
 	CALLBACK_INSTR_HOOK = callback ? callback : default_instr_hook_callback;
 }
 
 #include <stdio.h>
 /* Set the CPU type. */
-void m68k_set_cpu_type(unsigned int cpu_type)
+void m68k_set_cpu_type(m68ki_cpu_core *m68k, unsigned int cpu_type)
 {
 	switch(cpu_type)
 	{
@@ -633,14 +606,14 @@ int m68k_trap0;
 
 /* Execute some instructions until we use up num_cycles clock cycles */
 /* ASG: removed per-instruction interrupt checks */
-int m68k_execute(int num_cycles)
+int m68k_execute(m68ki_cpu_core *m68k, int num_cycles)
 {
 	/* Make sure we're not stopped */
 	if(!CPU_STOPPED)
 	{
 		/* Set our pool of clock cycles available */
 		SET_CYCLES(num_cycles);
-		m68ki_initial_cycles = num_cycles;
+		m68k->initial_cycles = num_cycles;
 
 		/* ASG: update cycles */
 		USE_CYCLES(CPU_INT_CYCLES);
@@ -667,8 +640,8 @@ int m68k_execute(int num_cycles)
 			REG_PPC = REG_PC;
 
 			/* Read an instruction and call its handler */
-			REG_IR = m68ki_read_imm_16();
-			m68ki_instruction_jump_table[REG_IR]();
+			REG_IR = m68ki_read_imm_16(m68k);
+			m68ki_instruction_jump_table[REG_IR](m68k);
 			USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
 
 			/* Trace m68k_exception, if necessary */
@@ -683,7 +656,7 @@ int m68k_execute(int num_cycles)
 		CPU_INT_CYCLES = 0;
 
 		/* return how many clocks we used */
-		return m68ki_initial_cycles - GET_CYCLES();
+		return m68k->initial_cycles - GET_CYCLES();
 	}
 
 	/* We get here if the CPU is stopped or halted */
@@ -694,27 +667,27 @@ int m68k_execute(int num_cycles)
 }
 
 
-int m68k_cycles_run(void)
+int m68k_cycles_run(m68ki_cpu_core *m68k)
 {
-	return m68ki_initial_cycles - GET_CYCLES();
+	return m68k->initial_cycles - GET_CYCLES();
 }
 
-int m68k_cycles_remaining(void)
+int m68k_cycles_remaining(m68ki_cpu_core *m68k)
 {
 	return GET_CYCLES();
 }
 
 /* Change the timeslice */
-void m68k_modify_timeslice(int cycles)
+void m68k_modify_timeslice(m68ki_cpu_core *m68k, int cycles)
 {
-	m68ki_initial_cycles += cycles;
+	m68k->initial_cycles += cycles;
 	ADD_CYCLES(cycles);
 }
 
 
-void m68k_end_timeslice(void)
+void m68k_end_timeslice(m68ki_cpu_core *m68k)
 {
-	m68ki_initial_cycles = GET_CYCLES();
+	m68k->initial_cycles = GET_CYCLES();
 	SET_CYCLES(0);
 }
 
@@ -723,7 +696,7 @@ void m68k_end_timeslice(void)
 /* KS: Modified so that IPL* bits match with mask positions in the SR
  *     and cleaned out remenants of the interrupt controller.
  */
-void m68k_set_irq(unsigned int int_level)
+void m68k_set_irq(m68ki_cpu_core *m68k, unsigned int int_level)
 {
 	uint old_level = CPU_INT_LEVEL;
 	CPU_INT_LEVEL = int_level << 8;
@@ -731,32 +704,32 @@ void m68k_set_irq(unsigned int int_level)
 	/* A transition from < 7 to 7 always interrupts (NMI) */
 	/* Note: Level 7 can also level trigger like a normal IRQ */
 	if(old_level != 0x0700 && CPU_INT_LEVEL == 0x0700)
-		m68ki_exception_interrupt(7); /* Edge triggered level 7 (NMI) */
+		m68ki_exception_interrupt(m68k, 7); /* Edge triggered level 7 (NMI) */
 	else
-		m68ki_check_interrupts(); /* Level triggered (IRQ) */
+		m68ki_check_interrupts(m68k); /* Level triggered (IRQ) */
 }
 
-void m68k_init(void)
+void m68k_init(m68ki_cpu_core *m68k, void *param)
 {
-	static uint emulation_initialized = 0;
+	static pthread_once_t emulation_initialized = PTHREAD_ONCE_INIT;
 
-	/* The first call to this function initializes the opcode handler jump table */
-	if(!emulation_initialized)
-		{
-		m68ki_build_opcode_table();
-		emulation_initialized = 1;
-	}
+	/* The first call to this function initializes the opcode handler jump table,
+	 * the table is shared by all the cores (possibly running on other threads)
+	 */
+	pthread_once(&emulation_initialized, m68ki_build_opcode_table);
+
+	m68k_set_int_ack_callback(m68k, NULL);
+	m68k_set_bkpt_ack_callback(m68k, NULL);
+	m68k_set_reset_instr_callback(m68k, NULL);
+	m68k_set_pc_changed_callback(m68k, NULL);
+	m68k_set_fc_callback(m68k, NULL);
+	m68k_set_instr_hook_callback(m68k, NULL);
 
-	m68k_set_int_ack_callback(NULL);
-	m68k_set_bkpt_ack_callback(NULL);
-	m68k_set_reset_instr_callback(NULL);
-	m68k_set_pc_changed_callback(NULL);
-	m68k_set_fc_callback(NULL);
-	m68k_set_instr_hook_callback(NULL);
+	m68k->mem_param = param;
 }
 
 /* Pulse the RESET line on the CPU */
-void m68k_pulse_reset(void)
+void m68k_pulse_reset(m68ki_cpu_core *m68k)
 {
 	/* Clear all stop levels and eat up all remaining cycles */
 	CPU_STOPPED = 0;
@@ -772,7 +745,7 @@ void m68k_pulse_reset(void)
 	/* Reset VBR */
 	REG_VBR = 0;
 	/* Go to supervisor mode */
-	m68ki_set_sm_flag(SFLAG_SET | MFLAG_CLEAR);
+	m68ki_set_sm_flag(m68k, SFLAG_SET | MFLAG_CLEAR);
 
 	/* Invalidate the prefetch queue */
 #if M68K_EMULATE_PREFETCH
@@ -781,37 +754,36 @@ void m68k_pulse_reset(void)
 #endif /* M68K_EMULATE_PREFETCH */
 
 	/* Read the initial stack pointer and program counter */
-	m68ki_jump(0);
-	REG_SP = m68ki_read_imm_32();
-	REG_PC = m68ki_read_imm_32();
-	m68ki_jump(REG_PC);
+	m68ki_jump(m68k, 0);
+	REG_SP = m68ki_read_imm_32(m68k);
+	REG_PC = m68ki_read_imm_32(m68k);
+	m68ki_jump(m68k, REG_PC);
 
 	CPU_RUN_MODE = RUN_MODE_NORMAL;
 }
 
 /* Pulse the HALT line on the CPU */
-void m68k_pulse_halt(void)
+void m68k_pulse_halt(m68ki_cpu_core *m68k)
 {
 	CPU_STOPPED |= STOP_LEVEL_HALT;
 }
 
 
-/* Get and set the current CPU context */
-/* This is to allow for multiple CPUs */
+/* Save and restore a CPU context */
 unsigned int m68k_context_size()
 {
 	return sizeof(m68ki_cpu_core);
 }
 
-unsigned int m68k_get_context(void* dst)
+unsigned int m68k_get_context(m68ki_cpu_core *m68k, void* dst)
 {
-	if(dst) *(m68ki_cpu_core*)dst = m68ki_cpu;
+	if(dst) *(m68ki_cpu_core*)dst = *m68k;
 	return sizeof(m68ki_cpu_core);
 }
 
-void m68k_set_context(void* src)
+void m68k_set_context(m68ki_cpu_core *m68k, void* src)
 {
-	if(src) m68ki_cpu = *(m68ki_cpu_core*)src;
+	if(src) *m68k = *(m68ki_cpu_core*)src;
 }
 
 
@@ -839,10 +811,10 @@ static void m68k_prepare_substate(void)
 
 static void m68k_post_load(void)
 {
-	m68ki_set_sr_noint_nosp(m68k_substate.sr);
+	m68ki_set_sr_noint_nosp(m68k, m68k_substate.sr);
 	CPU_STOPPED = m68k_substate.stopped ? STOP_LEVEL_STOP : 0
 		        | m68k_substate.halted  ? STOP_LEVEL_HALT : 0;
-	m68ki_jump(REG_PC);
+	m68ki_jump(m68k, REG_PC);
 }
 
 void m68k_state_register(const char *type)
@@ -5,19 +5,19 @@
 /* ======================================================================== */
 
 
-void m68k_op_1010(void)
+void m68k_op_1010(m68ki_cpu_core *m68k)
 {
-	m68ki_exception_1010();
+	m68ki_exception_1010(m68k);
 }
 
 
-void m68k_op_1111(void)
+void m68k_op_1111(m68ki_cpu_core *m68k)
 {
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
-void m68k_op_abcd_8_rr(void)
+void m68k_op_abcd_8_rr(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = DY;
@@ -43,9 +43,9 @@ void m68k_op_abcd_8_rr(void)
 }
 
 
-void m68k_op_abcd_8_mm_ax7(void)
+void m68k_op_abcd_8_mm_ax7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
@@ -69,9 +69,9 @@ void m68k_op_abcd_8_mm_ax7(void)
 }
 
 
-void m68k_op_abcd_8_mm_ay7(void)
+void m68k_op_abcd_8_mm_ay7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
@@ -95,9 +95,9 @@ void m68k_op_abcd_8_mm_ay7(void)
 }
 
 
-void m68k_op_abcd_8_mm_axy7(void)
+void m68k_op_abcd_8_mm_axy7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
@@ -121,9 +121,9 @@ void m68k_op_abcd_8_mm_axy7(void)
 }
 
 
-void m68k_op_abcd_8_mm(void)
+void m68k_op_abcd_8_mm(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
@@ -147,7 +147,7 @@ void m68k_op_abcd_8_mm(void)
 }
 
 
-void m68k_op_add_8_er_d(void)
+void m68k_op_add_8_er_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_8(DY);
@@ -163,10 +163,10 @@ void m68k_op_add_8_er_d(void)
 }
 
 
-void m68k_op_add_8_er_ai(void)
+void m68k_op_add_8_er_ai(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_AI_8();
+	uint src = OPER_AY_AI_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -179,10 +179,10 @@ void m68k_op_add_8_er_ai(void)
 }
 
 
-void m68k_op_add_8_er_pi(void)
+void m68k_op_add_8_er_pi(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_PI_8();
+	uint src = OPER_AY_PI_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -195,10 +195,10 @@ void m68k_op_add_8_er_pi(void)
 }
 
 
-void m68k_op_add_8_er_pi7(void)
+void m68k_op_add_8_er_pi7(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_A7_PI_8();
+	uint src = OPER_A7_PI_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -211,10 +211,10 @@ void m68k_op_add_8_er_pi7(void)
 }
 
 
-void m68k_op_add_8_er_pd(void)
+void m68k_op_add_8_er_pd(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -227,10 +227,10 @@ void m68k_op_add_8_er_pd(void)
 }
 
 
-void m68k_op_add_8_er_pd7(void)
+void m68k_op_add_8_er_pd7(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -243,10 +243,10 @@ void m68k_op_add_8_er_pd7(void)
 }
 
 
-void m68k_op_add_8_er_di(void)
+void m68k_op_add_8_er_di(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_DI_8();
+	uint src = OPER_AY_DI_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -259,10 +259,10 @@ void m68k_op_add_8_er_di(void)
 }
 
 
-void m68k_op_add_8_er_ix(void)
+void m68k_op_add_8_er_ix(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_IX_8();
+	uint src = OPER_AY_IX_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -275,10 +275,10 @@ void m68k_op_add_8_er_ix(void)
 }
 
 
-void m68k_op_add_8_er_aw(void)
+void m68k_op_add_8_er_aw(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AW_8();
+	uint src = OPER_AW_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -291,10 +291,10 @@ void m68k_op_add_8_er_aw(void)
 }
 
 
-void m68k_op_add_8_er_al(void)
+void m68k_op_add_8_er_al(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AL_8();
+	uint src = OPER_AL_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -307,10 +307,10 @@ void m68k_op_add_8_er_al(void)
 }
 
 
-void m68k_op_add_8_er_pcdi(void)
+void m68k_op_add_8_er_pcdi(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_PCDI_8();
+	uint src = OPER_PCDI_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -323,10 +323,10 @@ void m68k_op_add_8_er_pcdi(void)
 }
 
 
-void m68k_op_add_8_er_pcix(void)
+void m68k_op_add_8_er_pcix(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_PCIX_8();
+	uint src = OPER_PCIX_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
 	uint res = src + dst;
 
@@ -339,7 +339,7 @@ void m68k_op_add_8_er_pcix(void)
 }
 
 
-void m68k_op_add_8_er_i(void)
+void m68k_op_add_8_er_i(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_I_8();
@@ -355,7 +355,7 @@ void m68k_op_add_8_er_i(void)
 }
 
 
-void m68k_op_add_16_er_d(void)
+void m68k_op_add_16_er_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(DY);
@@ -371,7 +371,7 @@ void m68k_op_add_16_er_d(void)
 }
 
 
-void m68k_op_add_16_er_a(void)
+void m68k_op_add_16_er_a(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(AY);
@@ -387,10 +387,10 @@ void m68k_op_add_16_er_a(void)
 }
 
 
-void m68k_op_add_16_er_ai(void)
+void m68k_op_add_16_er_ai(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_AI_16();
+	uint src = OPER_AY_AI_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
@@ -403,10 +403,10 @@ void m68k_op_add_16_er_ai(void)
 }
 
 
-void m68k_op_add_16_er_pi(void)
+void m68k_op_add_16_er_pi(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_PI_16();
+	uint src = OPER_AY_PI_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
@@ -419,10 +419,10 @@ void m68k_op_add_16_er_pi(void)
 }
 
 
-void m68k_op_add_16_er_pd(void)
+void m68k_op_add_16_er_pd(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_PD_16();
+	uint src = OPER_AY_PD_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
@@ -435,10 +435,10 @@ void m68k_op_add_16_er_pd(void)
 }
 
 
-void m68k_op_add_16_er_di(void)
+void m68k_op_add_16_er_di(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_DI_16();
+	uint src = OPER_AY_DI_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
@@ -451,10 +451,10 @@ void m68k_op_add_16_er_di(void)
 }
 
 
-void m68k_op_add_16_er_ix(void)
+void m68k_op_add_16_er_ix(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_IX_16();
+	uint src = OPER_AY_IX_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
@@ -467,10 +467,10 @@ void m68k_op_add_16_er_ix(void)
 }
 
 
-void m68k_op_add_16_er_aw(void)
+void m68k_op_add_16_er_aw(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AW_16();
+	uint src = OPER_AW_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
@@ -483,10 +483,10 @@ void m68k_op_add_16_er_aw(void)
 }
 
 
-void m68k_op_add_16_er_al(void)
+void m68k_op_add_16_er_al(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AL_16();
+	uint src = OPER_AL_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
@@ -499,10 +499,10 @@ void m68k_op_add_16_er_al(void)
 }
 
 
-void m68k_op_add_16_er_pcdi(void)
+void m68k_op_add_16_er_pcdi(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_PCDI_16();
+	uint src = OPER_PCDI_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
@@ -515,10 +515,10 @@ void m68k_op_add_16_er_pcdi(void)
 }
 
 
-void m68k_op_add_16_er_pcix(void)
+void m68k_op_add_16_er_pcix(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_PCIX_16();
+	uint src = OPER_PCIX_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
 	uint res = src + dst;
 
@@ -531,7 +531,7 @@ void m68k_op_add_16_er_pcix(void)
 }
 
 
-void m68k_op_add_16_er_i(void)
+void m68k_op_add_16_er_i(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_I_16();
@@ -547,7 +547,7 @@ void m68k_op_add_16_er_i(void)
 }
 
 
-void m68k_op_add_32_er_d(void)
+void m68k_op_add_32_er_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = DY;
@@ -563,7 +563,7 @@ void m68k_op_add_32_er_d(void)
 }
 
 
-void m68k_op_add_32_er_a(void)
+void m68k_op_add_32_er_a(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = AY;
@@ -579,10 +579,10 @@ void m68k_op_add_32_er_a(void)
 }
 
 
-void m68k_op_add_32_er_ai(void)
+void m68k_op_add_32_er_ai(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_AI_32();
+	uint src = OPER_AY_AI_32(m68k);
 	uint dst = *r_dst;
 	uint res = src + dst;
 
@@ -595,10 +595,10 @@ void m68k_op_add_32_er_ai(void)
 }
 
 
-void m68k_op_add_32_er_pi(void)
+void m68k_op_add_32_er_pi(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_PI_32();
+	uint src = OPER_AY_PI_32(m68k);
 	uint dst = *r_dst;
 	uint res = src + dst;
 
@@ -611,10 +611,10 @@ void m68k_op_add_32_er_pi(void)
 }
 
 
-void m68k_op_add_32_er_pd(void)
+void m68k_op_add_32_er_pd(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_PD_32();
+	uint src = OPER_AY_PD_32(m68k);
 	uint dst = *r_dst;
 	uint res = src + dst;
 
@@ -627,10 +627,10 @@ void m68k_op_add_32_er_pd(void)
 }
 
 
-void m68k_op_add_32_er_di(void)
+void m68k_op_add_32_er_di(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_DI_32();
+	uint src = OPER_AY_DI_32(m68k);
 	uint dst = *r_dst;
 	uint res = src + dst;
 
@@ -643,10 +643,10 @@ void m68k_op_add_32_er_di(void)
 }
 
 
-void m68k_op_add_32_er_ix(void)
+void m68k_op_add_32_er_ix(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AY_IX_32();
+	uint src = OPER_AY_IX_32(m68k);
 	uint dst = *r_dst;
 	uint res = src + dst;
 
@@ -659,10 +659,10 @@ void m68k_op_add_32_er_ix(void)
 }
 
 
-void m68k_op_add_32_er_aw(void)
+void m68k_op_add_32_er_aw(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AW_32();
+	uint src = OPER_AW_32(m68k);
 	uint dst = *r_dst;
 	uint res = src + dst;
 
@@ -675,10 +675,10 @@ void m68k_op_add_32_er_aw(void)
 }
 
 
-void m68k_op_add_32_er_al(void)
+void m68k_op_add_32_er_al(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_AL_32();
+	uint src = OPER_AL_32(m68k);
 	uint dst = *r_dst;
 	uint res = src + dst;
 
@@ -691,10 +691,10 @@ void m68k_op_add_32_er_al(void)
 }
 
 
-void m68k_op_add_32_er_pcdi(void)
+void m68k_op_add_32_er_pcdi(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_PCDI_32();
+	uint src = OPER_PCDI_32(m68k);
 	uint dst = *r_dst;
 	uint res = src + dst;
 
@@ -707,10 +707,10 @@ void m68k_op_add_32_er_pcdi(void)
 }
 
 
-void m68k_op_add_32_er_pcix(void)
+void m68k_op_add_32_er_pcix(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
-	uint src = OPER_PCIX_32();
+	uint src = OPER_PCIX_32(m68k);
 	uint dst = *r_dst;
 	uint res = src + dst;
 
@@ -723,7 +723,7 @@ void m68k_op_add_32_er_pcix(void)
 }
 
 
-void m68k_op_add_32_er_i(void)
+void m68k_op_add_32_er_i(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_I_32();
@@ -739,7 +739,7 @@ void m68k_op_add_32_er_i(void)
 }
 
 
-void m68k_op_add_8_re_ai(void)
+void m68k_op_add_8_re_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -755,7 +755,7 @@ void m68k_op_add_8_re_ai(void)
 }
 
 
-void m68k_op_add_8_re_pi(void)
+void m68k_op_add_8_re_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -771,7 +771,7 @@ void m68k_op_add_8_re_pi(void)
 }
 
 
-void m68k_op_add_8_re_pi7(void)
+void m68k_op_add_8_re_pi7(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -787,7 +787,7 @@ void m68k_op_add_8_re_pi7(void)
 }
 
 
-void m68k_op_add_8_re_pd(void)
+void m68k_op_add_8_re_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -803,7 +803,7 @@ void m68k_op_add_8_re_pd(void)
 }
 
 
-void m68k_op_add_8_re_pd7(void)
+void m68k_op_add_8_re_pd7(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -819,7 +819,7 @@ void m68k_op_add_8_re_pd7(void)
 }
 
 
-void m68k_op_add_8_re_di(void)
+void m68k_op_add_8_re_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -835,7 +835,7 @@ void m68k_op_add_8_re_di(void)
 }
 
 
-void m68k_op_add_8_re_ix(void)
+void m68k_op_add_8_re_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -851,7 +851,7 @@ void m68k_op_add_8_re_ix(void)
 }
 
 
-void m68k_op_add_8_re_aw(void)
+void m68k_op_add_8_re_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -867,7 +867,7 @@ void m68k_op_add_8_re_aw(void)
 }
 
 
-void m68k_op_add_8_re_al(void)
+void m68k_op_add_8_re_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -883,7 +883,7 @@ void m68k_op_add_8_re_al(void)
 }
 
 
-void m68k_op_add_16_re_ai(void)
+void m68k_op_add_16_re_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -899,7 +899,7 @@ void m68k_op_add_16_re_ai(void)
 }
 
 
-void m68k_op_add_16_re_pi(void)
+void m68k_op_add_16_re_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -915,7 +915,7 @@ void m68k_op_add_16_re_pi(void)
 }
 
 
-void m68k_op_add_16_re_pd(void)
+void m68k_op_add_16_re_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -931,7 +931,7 @@ void m68k_op_add_16_re_pd(void)
 }
 
 
-void m68k_op_add_16_re_di(void)
+void m68k_op_add_16_re_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -947,7 +947,7 @@ void m68k_op_add_16_re_di(void)
 }
 
 
-void m68k_op_add_16_re_ix(void)
+void m68k_op_add_16_re_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -963,7 +963,7 @@ void m68k_op_add_16_re_ix(void)
 }
 
 
-void m68k_op_add_16_re_aw(void)
+void m68k_op_add_16_re_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -979,7 +979,7 @@ void m68k_op_add_16_re_aw(void)
 }
 
 
-void m68k_op_add_16_re_al(void)
+void m68k_op_add_16_re_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -995,7 +995,7 @@ void m68k_op_add_16_re_al(void)
 }
 
 
-void m68k_op_add_32_re_ai(void)
+void m68k_op_add_32_re_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_32();
 	uint src = DX;
@@ -1011,7 +1011,7 @@ void m68k_op_add_32_re_ai(void)
 }
 
 
-void m68k_op_add_32_re_pi(void)
+void m68k_op_add_32_re_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_32();
 	uint src = DX;
@@ -1027,7 +1027,7 @@ void m68k_op_add_32_re_pi(void)
 }
 
 
-void m68k_op_add_32_re_pd(void)
+void m68k_op_add_32_re_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_32();
 	uint src = DX;
@@ -1043,7 +1043,7 @@ void m68k_op_add_32_re_pd(void)
 }
 
 
-void m68k_op_add_32_re_di(void)
+void m68k_op_add_32_re_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_32();
 	uint src = DX;
@@ -1059,7 +1059,7 @@ void m68k_op_add_32_re_di(void)
 }
 
 
-void m68k_op_add_32_re_ix(void)
+void m68k_op_add_32_re_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_32();
 	uint src = DX;
@@ -1075,7 +1075,7 @@ void m68k_op_add_32_re_ix(void)
 }
 
 
-void m68k_op_add_32_re_aw(void)
+void m68k_op_add_32_re_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_32();
 	uint src = DX;
@@ -1091,7 +1091,7 @@ void m68k_op_add_32_re_aw(void)
 }
 
 
-void m68k_op_add_32_re_al(void)
+void m68k_op_add_32_re_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_32();
 	uint src = DX;
@@ -1107,7 +1107,7 @@ void m68k_op_add_32_re_al(void)
 }
 
 
-void m68k_op_adda_16_d(void)
+void m68k_op_adda_16_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
@@ -1115,7 +1115,7 @@ void m68k_op_adda_16_d(void)
 }
 
 
-void m68k_op_adda_16_a(void)
+void m68k_op_adda_16_a(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
@@ -1123,79 +1123,79 @@ void m68k_op_adda_16_a(void)
 }
 
 
-void m68k_op_adda_16_ai(void)
+void m68k_op_adda_16_ai(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AY_AI_16()));
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AY_AI_16(m68k)));
 }
 
 
-void m68k_op_adda_16_pi(void)
+void m68k_op_adda_16_pi(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AY_PI_16()));
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AY_PI_16(m68k)));
 }
 
 
-void m68k_op_adda_16_pd(void)
+void m68k_op_adda_16_pd(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AY_PD_16()));
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AY_PD_16(m68k)));
 }
 
 
-void m68k_op_adda_16_di(void)
+void m68k_op_adda_16_di(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AY_DI_16()));
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AY_DI_16(m68k)));
 }
 
 
-void m68k_op_adda_16_ix(void)
+void m68k_op_adda_16_ix(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AY_IX_16()));
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AY_IX_16(m68k)));
 }
 
 
-void m68k_op_adda_16_aw(void)
+void m68k_op_adda_16_aw(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AW_16()));
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AW_16(m68k)));
 }
 
 
-void m68k_op_adda_16_al(void)
+void m68k_op_adda_16_al(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AL_16()));
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_AL_16(m68k)));
 }
 
 
-void m68k_op_adda_16_pcdi(void)
+void m68k_op_adda_16_pcdi(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_PCDI_16()));
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_PCDI_16(m68k)));
 }
 
 
-void m68k_op_adda_16_pcix(void)
+void m68k_op_adda_16_pcix(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_PCIX_16()));
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(OPER_PCIX_16(m68k)));
 }
 
 
-void m68k_op_adda_16_i(void)
+void m68k_op_adda_16_i(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
@@ -1203,7 +1203,7 @@ void m68k_op_adda_16_i(void)
 }
 
 
-void m68k_op_adda_32_d(void)
+void m68k_op_adda_32_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
@@ -1211,7 +1211,7 @@ void m68k_op_adda_32_d(void)
 }
 
 
-void m68k_op_adda_32_a(void)
+void m68k_op_adda_32_a(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
@@ -1219,79 +1219,79 @@ void m68k_op_adda_32_a(void)
 }
 
 
-void m68k_op_adda_32_ai(void)
+void m68k_op_adda_32_ai(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AY_AI_32());
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AY_AI_32(m68k));
 }
 
 
-void m68k_op_adda_32_pi(void)
+void m68k_op_adda_32_pi(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AY_PI_32());
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AY_PI_32(m68k));
 }
 
 
-void m68k_op_adda_32_pd(void)
+void m68k_op_adda_32_pd(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AY_PD_32());
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AY_PD_32(m68k));
 }
 
 
-void m68k_op_adda_32_di(void)
+void m68k_op_adda_32_di(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AY_DI_32());
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AY_DI_32(m68k));
 }
 
 
-void m68k_op_adda_32_ix(void)
+void m68k_op_adda_32_ix(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AY_IX_32());
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AY_IX_32(m68k));
 }
 
 
-void m68k_op_adda_32_aw(void)
+void m68k_op_adda_32_aw(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AW_32());
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AW_32(m68k));
 }
 
 
-void m68k_op_adda_32_al(void)
+void m68k_op_adda_32_al(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AL_32());
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_AL_32(m68k));
 }
 
 
-void m68k_op_adda_32_pcdi(void)
+void m68k_op_adda_32_pcdi(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_PCDI_32());
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_PCDI_32(m68k));
 }
 
 
-void m68k_op_adda_32_pcix(void)
+void m68k_op_adda_32_pcix(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
-	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_PCIX_32());
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + OPER_PCIX_32(m68k));
 }
 
 
-void m68k_op_adda_32_i(void)
+void m68k_op_adda_32_i(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AX;
 
@@ -1299,7 +1299,7 @@ void m68k_op_adda_32_i(void)
 }
 
 
-void m68k_op_addi_8_d(void)
+void m68k_op_addi_8_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint src = OPER_I_8();
@@ -1315,7 +1315,7 @@ void m68k_op_addi_8_d(void)
 }
 
 
-void m68k_op_addi_8_ai(void)
+void m68k_op_addi_8_ai(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_AI_8();
@@ -1331,7 +1331,7 @@ void m68k_op_addi_8_ai(void)
 }
 
 
-void m68k_op_addi_8_pi(void)
+void m68k_op_addi_8_pi(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PI_8();
@@ -1347,7 +1347,7 @@ void m68k_op_addi_8_pi(void)
 }
 
 
-void m68k_op_addi_8_pi7(void)
+void m68k_op_addi_8_pi7(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PI_8();
@@ -1363,7 +1363,7 @@ void m68k_op_addi_8_pi7(void)
 }
 
 
-void m68k_op_addi_8_pd(void)
+void m68k_op_addi_8_pd(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PD_8();
@@ -1379,7 +1379,7 @@ void m68k_op_addi_8_pd(void)
 }
 
 
-void m68k_op_addi_8_pd7(void)
+void m68k_op_addi_8_pd7(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PD_8();
@@ -1395,7 +1395,7 @@ void m68k_op_addi_8_pd7(void)
 }
 
 
-void m68k_op_addi_8_di(void)
+void m68k_op_addi_8_di(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_DI_8();
@@ -1411,7 +1411,7 @@ void m68k_op_addi_8_di(void)
 }
 
 
-void m68k_op_addi_8_ix(void)
+void m68k_op_addi_8_ix(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_IX_8();
@@ -1427,7 +1427,7 @@ void m68k_op_addi_8_ix(void)
 }
 
 
-void m68k_op_addi_8_aw(void)
+void m68k_op_addi_8_aw(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AW_8();
@@ -1443,7 +1443,7 @@ void m68k_op_addi_8_aw(void)
 }
 
 
-void m68k_op_addi_8_al(void)
+void m68k_op_addi_8_al(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AL_8();
@@ -1459,7 +1459,7 @@ void m68k_op_addi_8_al(void)
 }
 
 
-void m68k_op_addi_16_d(void)
+void m68k_op_addi_16_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint src = OPER_I_16();
@@ -1475,7 +1475,7 @@ void m68k_op_addi_16_d(void)
 }
 
 
-void m68k_op_addi_16_ai(void)
+void m68k_op_addi_16_ai(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_AI_16();
@@ -1491,7 +1491,7 @@ void m68k_op_addi_16_ai(void)
 }
 
 
-void m68k_op_addi_16_pi(void)
+void m68k_op_addi_16_pi(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PI_16();
@@ -1507,7 +1507,7 @@ void m68k_op_addi_16_pi(void)
 }
 
 
-void m68k_op_addi_16_pd(void)
+void m68k_op_addi_16_pd(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PD_16();
@@ -1523,7 +1523,7 @@ void m68k_op_addi_16_pd(void)
 }
 
 
-void m68k_op_addi_16_di(void)
+void m68k_op_addi_16_di(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_DI_16();
@@ -1539,7 +1539,7 @@ void m68k_op_addi_16_di(void)
 }
 
 
-void m68k_op_addi_16_ix(void)
+void m68k_op_addi_16_ix(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_IX_16();
@@ -1555,7 +1555,7 @@ void m68k_op_addi_16_ix(void)
 }
 
 
-void m68k_op_addi_16_aw(void)
+void m68k_op_addi_16_aw(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AW_16();
@@ -1571,7 +1571,7 @@ void m68k_op_addi_16_aw(void)
 }
 
 
-void m68k_op_addi_16_al(void)
+void m68k_op_addi_16_al(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AL_16();
@@ -1587,7 +1587,7 @@ void m68k_op_addi_16_al(void)
 }
 
 
-void m68k_op_addi_32_d(void)
+void m68k_op_addi_32_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint src = OPER_I_32();
@@ -1603,7 +1603,7 @@ void m68k_op_addi_32_d(void)
 }
 
 
-void m68k_op_addi_32_ai(void)
+void m68k_op_addi_32_ai(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_AI_32();
@@ -1619,7 +1619,7 @@ void m68k_op_addi_32_ai(void)
 }
 
 
-void m68k_op_addi_32_pi(void)
+void m68k_op_addi_32_pi(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PI_32();
@@ -1635,7 +1635,7 @@ void m68k_op_addi_32_pi(void)
 }
 
 
-void m68k_op_addi_32_pd(void)
+void m68k_op_addi_32_pd(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PD_32();
@@ -1651,7 +1651,7 @@ void m68k_op_addi_32_pd(void)
 }
 
 
-void m68k_op_addi_32_di(void)
+void m68k_op_addi_32_di(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_DI_32();
@@ -1667,7 +1667,7 @@ void m68k_op_addi_32_di(void)
 }
 
 
-void m68k_op_addi_32_ix(void)
+void m68k_op_addi_32_ix(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_IX_32();
@@ -1683,7 +1683,7 @@ void m68k_op_addi_32_ix(void)
 }
 
 
-void m68k_op_addi_32_aw(void)
+void m68k_op_addi_32_aw(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AW_32();
@@ -1699,7 +1699,7 @@ void m68k_op_addi_32_aw(void)
 }
 
 
-void m68k_op_addi_32_al(void)
+void m68k_op_addi_32_al(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AL_32();
@@ -1715,7 +1715,7 @@ void m68k_op_addi_32_al(void)
 }
 
 
-void m68k_op_addq_8_d(void)
+void m68k_op_addq_8_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -1731,7 +1731,7 @@ void m68k_op_addq_8_d(void)
 }
 
 
-void m68k_op_addq_8_ai(void)
+void m68k_op_addq_8_ai(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_AI_8();
@@ -1747,7 +1747,7 @@ void m68k_op_addq_8_ai(void)
 }
 
 
-void m68k_op_addq_8_pi(void)
+void m68k_op_addq_8_pi(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PI_8();
@@ -1763,7 +1763,7 @@ void m68k_op_addq_8_pi(void)
 }
 
 
-void m68k_op_addq_8_pi7(void)
+void m68k_op_addq_8_pi7(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_A7_PI_8();
@@ -1779,7 +1779,7 @@ void m68k_op_addq_8_pi7(void)
 }
 
 
-void m68k_op_addq_8_pd(void)
+void m68k_op_addq_8_pd(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PD_8();
@@ -1795,7 +1795,7 @@ void m68k_op_addq_8_pd(void)
 }
 
 
-void m68k_op_addq_8_pd7(void)
+void m68k_op_addq_8_pd7(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_A7_PD_8();
@@ -1811,7 +1811,7 @@ void m68k_op_addq_8_pd7(void)
 }
 
 
-void m68k_op_addq_8_di(void)
+void m68k_op_addq_8_di(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_DI_8();
@@ -1827,7 +1827,7 @@ void m68k_op_addq_8_di(void)
 }
 
 
-void m68k_op_addq_8_ix(void)
+void m68k_op_addq_8_ix(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_IX_8();
@@ -1843,7 +1843,7 @@ void m68k_op_addq_8_ix(void)
 }
 
 
-void m68k_op_addq_8_aw(void)
+void m68k_op_addq_8_aw(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AW_8();
@@ -1859,7 +1859,7 @@ void m68k_op_addq_8_aw(void)
 }
 
 
-void m68k_op_addq_8_al(void)
+void m68k_op_addq_8_al(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AL_8();
@@ -1875,7 +1875,7 @@ void m68k_op_addq_8_al(void)
 }
 
 
-void m68k_op_addq_16_d(void)
+void m68k_op_addq_16_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -1891,7 +1891,7 @@ void m68k_op_addq_16_d(void)
 }
 
 
-void m68k_op_addq_16_a(void)
+void m68k_op_addq_16_a(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AY;
 
@@ -1899,7 +1899,7 @@ void m68k_op_addq_16_a(void)
 }
 
 
-void m68k_op_addq_16_ai(void)
+void m68k_op_addq_16_ai(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_AI_16();
@@ -1915,7 +1915,7 @@ void m68k_op_addq_16_ai(void)
 }
 
 
-void m68k_op_addq_16_pi(void)
+void m68k_op_addq_16_pi(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PI_16();
@@ -1931,7 +1931,7 @@ void m68k_op_addq_16_pi(void)
 }
 
 
-void m68k_op_addq_16_pd(void)
+void m68k_op_addq_16_pd(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PD_16();
@@ -1947,7 +1947,7 @@ void m68k_op_addq_16_pd(void)
 }
 
 
-void m68k_op_addq_16_di(void)
+void m68k_op_addq_16_di(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_DI_16();
@@ -1963,7 +1963,7 @@ void m68k_op_addq_16_di(void)
 }
 
 
-void m68k_op_addq_16_ix(void)
+void m68k_op_addq_16_ix(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_IX_16();
@@ -1979,7 +1979,7 @@ void m68k_op_addq_16_ix(void)
 }
 
 
-void m68k_op_addq_16_aw(void)
+void m68k_op_addq_16_aw(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AW_16();
@@ -1995,7 +1995,7 @@ void m68k_op_addq_16_aw(void)
 }
 
 
-void m68k_op_addq_16_al(void)
+void m68k_op_addq_16_al(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AL_16();
@@ -2011,7 +2011,7 @@ void m68k_op_addq_16_al(void)
 }
 
 
-void m68k_op_addq_32_d(void)
+void m68k_op_addq_32_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -2027,7 +2027,7 @@ void m68k_op_addq_32_d(void)
 }
 
 
-void m68k_op_addq_32_a(void)
+void m68k_op_addq_32_a(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &AY;
 
@@ -2035,7 +2035,7 @@ void m68k_op_addq_32_a(void)
 }
 
 
-void m68k_op_addq_32_ai(void)
+void m68k_op_addq_32_ai(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_AI_32();
@@ -2052,7 +2052,7 @@ void m68k_op_addq_32_ai(void)
 }
 
 
-void m68k_op_addq_32_pi(void)
+void m68k_op_addq_32_pi(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PI_32();
@@ -2069,7 +2069,7 @@ void m68k_op_addq_32_pi(void)
 }
 
 
-void m68k_op_addq_32_pd(void)
+void m68k_op_addq_32_pd(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PD_32();
@@ -2086,7 +2086,7 @@ void m68k_op_addq_32_pd(void)
 }
 
 
-void m68k_op_addq_32_di(void)
+void m68k_op_addq_32_di(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_DI_32();
@@ -2103,7 +2103,7 @@ void m68k_op_addq_32_di(void)
 }
 
 
-void m68k_op_addq_32_ix(void)
+void m68k_op_addq_32_ix(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_IX_32();
@@ -2120,7 +2120,7 @@ void m68k_op_addq_32_ix(void)
 }
 
 
-void m68k_op_addq_32_aw(void)
+void m68k_op_addq_32_aw(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AW_32();
@@ -2137,7 +2137,7 @@ void m68k_op_addq_32_aw(void)
 }
 
 
-void m68k_op_addq_32_al(void)
+void m68k_op_addq_32_al(m68ki_cpu_core *m68k)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AL_32();
@@ -2154,7 +2154,7 @@ void m68k_op_addq_32_al(void)
 }
 
 
-void m68k_op_addx_8_rr(void)
+void m68k_op_addx_8_rr(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_8(DY);
@@ -2172,7 +2172,7 @@ void m68k_op_addx_8_rr(void)
 }
 
 
-void m68k_op_addx_16_rr(void)
+void m68k_op_addx_16_rr(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(DY);
@@ -2190,7 +2190,7 @@ void m68k_op_addx_16_rr(void)
 }
 
 
-void m68k_op_addx_32_rr(void)
+void m68k_op_addx_32_rr(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DX;
 	uint src = DY;
@@ -2208,9 +2208,9 @@ void m68k_op_addx_32_rr(void)
 }
 
 
-void m68k_op_addx_8_mm_ax7(void)
+void m68k_op_addx_8_mm_ax7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -2226,9 +2226,9 @@ void m68k_op_addx_8_mm_ax7(void)
 }
 
 
-void m68k_op_addx_8_mm_ay7(void)
+void m68k_op_addx_8_mm_ay7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -2244,9 +2244,9 @@ void m68k_op_addx_8_mm_ay7(void)
 }
 
 
-void m68k_op_addx_8_mm_axy7(void)
+void m68k_op_addx_8_mm_axy7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -2262,9 +2262,9 @@ void m68k_op_addx_8_mm_axy7(void)
 }
 
 
-void m68k_op_addx_8_mm(void)
+void m68k_op_addx_8_mm(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -2280,9 +2280,9 @@ void m68k_op_addx_8_mm(void)
 }
 
 
-void m68k_op_addx_16_mm(void)
+void m68k_op_addx_16_mm(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PD_16();
+	uint src = OPER_AY_PD_16(m68k);
 	uint ea  = EA_AX_PD_16();
 	uint dst = m68ki_read_16(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -2298,9 +2298,9 @@ void m68k_op_addx_16_mm(void)
 }
 
 
-void m68k_op_addx_32_mm(void)
+void m68k_op_addx_32_mm(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PD_32();
+	uint src = OPER_AY_PD_32(m68k);
 	uint ea  = EA_AX_PD_32();
 	uint dst = m68ki_read_32(ea);
 	uint res = src + dst + XFLAG_AS_1();
@@ -2316,7 +2316,7 @@ void m68k_op_addx_32_mm(void)
 }
 
 
-void m68k_op_and_8_er_d(void)
+void m68k_op_and_8_er_d(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (DY | 0xffffff00));
 
@@ -2326,9 +2326,9 @@ void m68k_op_and_8_er_d(void)
 }
 
 
-void m68k_op_and_8_er_ai(void)
+void m68k_op_and_8_er_ai(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_AI_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_AI_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2336,9 +2336,9 @@ void m68k_op_and_8_er_ai(void)
 }
 
 
-void m68k_op_and_8_er_pi(void)
+void m68k_op_and_8_er_pi(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PI_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PI_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2346,9 +2346,9 @@ void m68k_op_and_8_er_pi(void)
 }
 
 
-void m68k_op_and_8_er_pi7(void)
+void m68k_op_and_8_er_pi7(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PI_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PI_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2356,9 +2356,9 @@ void m68k_op_and_8_er_pi7(void)
 }
 
 
-void m68k_op_and_8_er_pd(void)
+void m68k_op_and_8_er_pd(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PD_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PD_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2366,9 +2366,9 @@ void m68k_op_and_8_er_pd(void)
 }
 
 
-void m68k_op_and_8_er_pd7(void)
+void m68k_op_and_8_er_pd7(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PD_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PD_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2376,9 +2376,9 @@ void m68k_op_and_8_er_pd7(void)
 }
 
 
-void m68k_op_and_8_er_di(void)
+void m68k_op_and_8_er_di(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_DI_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_DI_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2386,9 +2386,9 @@ void m68k_op_and_8_er_di(void)
 }
 
 
-void m68k_op_and_8_er_ix(void)
+void m68k_op_and_8_er_ix(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_IX_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_IX_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2396,9 +2396,9 @@ void m68k_op_and_8_er_ix(void)
 }
 
 
-void m68k_op_and_8_er_aw(void)
+void m68k_op_and_8_er_aw(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AW_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AW_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2406,9 +2406,9 @@ void m68k_op_and_8_er_aw(void)
 }
 
 
-void m68k_op_and_8_er_al(void)
+void m68k_op_and_8_er_al(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AL_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AL_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2416,9 +2416,9 @@ void m68k_op_and_8_er_al(void)
 }
 
 
-void m68k_op_and_8_er_pcdi(void)
+void m68k_op_and_8_er_pcdi(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCDI_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCDI_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2426,9 +2426,9 @@ void m68k_op_and_8_er_pcdi(void)
 }
 
 
-void m68k_op_and_8_er_pcix(void)
+void m68k_op_and_8_er_pcix(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCIX_8() | 0xffffff00));
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCIX_8(m68k) | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2436,7 +2436,7 @@ void m68k_op_and_8_er_pcix(void)
 }
 
 
-void m68k_op_and_8_er_i(void)
+void m68k_op_and_8_er_i(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_I_8() | 0xffffff00));
 
@@ -2446,7 +2446,7 @@ void m68k_op_and_8_er_i(void)
 }
 
 
-void m68k_op_and_16_er_d(void)
+void m68k_op_and_16_er_d(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (DY | 0xffff0000));
 
@@ -2456,9 +2456,9 @@ void m68k_op_and_16_er_d(void)
 }
 
 
-void m68k_op_and_16_er_ai(void)
+void m68k_op_and_16_er_ai(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_AI_16() | 0xffff0000));
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_AI_16(m68k) | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2466,9 +2466,9 @@ void m68k_op_and_16_er_ai(void)
 }
 
 
-void m68k_op_and_16_er_pi(void)
+void m68k_op_and_16_er_pi(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PI_16() | 0xffff0000));
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PI_16(m68k) | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2476,9 +2476,9 @@ void m68k_op_and_16_er_pi(void)
 }
 
 
-void m68k_op_and_16_er_pd(void)
+void m68k_op_and_16_er_pd(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PD_16() | 0xffff0000));
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PD_16(m68k) | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2486,9 +2486,9 @@ void m68k_op_and_16_er_pd(void)
 }
 
 
-void m68k_op_and_16_er_di(void)
+void m68k_op_and_16_er_di(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_DI_16() | 0xffff0000));
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_DI_16(m68k) | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2496,9 +2496,9 @@ void m68k_op_and_16_er_di(void)
 }
 
 
-void m68k_op_and_16_er_ix(void)
+void m68k_op_and_16_er_ix(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_IX_16() | 0xffff0000));
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_IX_16(m68k) | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2506,9 +2506,9 @@ void m68k_op_and_16_er_ix(void)
 }
 
 
-void m68k_op_and_16_er_aw(void)
+void m68k_op_and_16_er_aw(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AW_16() | 0xffff0000));
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AW_16(m68k) | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2516,9 +2516,9 @@ void m68k_op_and_16_er_aw(void)
 }
 
 
-void m68k_op_and_16_er_al(void)
+void m68k_op_and_16_er_al(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AL_16() | 0xffff0000));
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AL_16(m68k) | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2526,9 +2526,9 @@ void m68k_op_and_16_er_al(void)
 }
 
 
-void m68k_op_and_16_er_pcdi(void)
+void m68k_op_and_16_er_pcdi(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCDI_16() | 0xffff0000));
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCDI_16(m68k) | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2536,9 +2536,9 @@ void m68k_op_and_16_er_pcdi(void)
 }
 
 
-void m68k_op_and_16_er_pcix(void)
+void m68k_op_and_16_er_pcix(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCIX_16() | 0xffff0000));
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCIX_16(m68k) | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2546,7 +2546,7 @@ void m68k_op_and_16_er_pcix(void)
 }
 
 
-void m68k_op_and_16_er_i(void)
+void m68k_op_and_16_er_i(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_I_16() | 0xffff0000));
 
@@ -2556,7 +2556,7 @@ void m68k_op_and_16_er_i(void)
 }
 
 
-void m68k_op_and_32_er_d(void)
+void m68k_op_and_32_er_d(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = DX &= DY;
 
@@ -2566,9 +2566,9 @@ void m68k_op_and_32_er_d(void)
 }
 
 
-void m68k_op_and_32_er_ai(void)
+void m68k_op_and_32_er_ai(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = DX &= OPER_AY_AI_32();
+	FLAG_Z = DX &= OPER_AY_AI_32(m68k);
 
 	FLAG_N = NFLAG_32(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2576,9 +2576,9 @@ void m68k_op_and_32_er_ai(void)
 }
 
 
-void m68k_op_and_32_er_pi(void)
+void m68k_op_and_32_er_pi(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = DX &= OPER_AY_PI_32();
+	FLAG_Z = DX &= OPER_AY_PI_32(m68k);
 
 	FLAG_N = NFLAG_32(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2586,9 +2586,9 @@ void m68k_op_and_32_er_pi(void)
 }
 
 
-void m68k_op_and_32_er_pd(void)
+void m68k_op_and_32_er_pd(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = DX &= OPER_AY_PD_32();
+	FLAG_Z = DX &= OPER_AY_PD_32(m68k);
 
 	FLAG_N = NFLAG_32(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2596,9 +2596,9 @@ void m68k_op_and_32_er_pd(void)
 }
 
 
-void m68k_op_and_32_er_di(void)
+void m68k_op_and_32_er_di(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = DX &= OPER_AY_DI_32();
+	FLAG_Z = DX &= OPER_AY_DI_32(m68k);
 
 	FLAG_N = NFLAG_32(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2606,9 +2606,9 @@ void m68k_op_and_32_er_di(void)
 }
 
 
-void m68k_op_and_32_er_ix(void)
+void m68k_op_and_32_er_ix(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = DX &= OPER_AY_IX_32();
+	FLAG_Z = DX &= OPER_AY_IX_32(m68k);
 
 	FLAG_N = NFLAG_32(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2616,9 +2616,9 @@ void m68k_op_and_32_er_ix(void)
 }
 
 
-void m68k_op_and_32_er_aw(void)
+void m68k_op_and_32_er_aw(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = DX &= OPER_AW_32();
+	FLAG_Z = DX &= OPER_AW_32(m68k);
 
 	FLAG_N = NFLAG_32(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2626,9 +2626,9 @@ void m68k_op_and_32_er_aw(void)
 }
 
 
-void m68k_op_and_32_er_al(void)
+void m68k_op_and_32_er_al(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = DX &= OPER_AL_32();
+	FLAG_Z = DX &= OPER_AL_32(m68k);
 
 	FLAG_N = NFLAG_32(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2636,9 +2636,9 @@ void m68k_op_and_32_er_al(void)
 }
 
 
-void m68k_op_and_32_er_pcdi(void)
+void m68k_op_and_32_er_pcdi(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = DX &= OPER_PCDI_32();
+	FLAG_Z = DX &= OPER_PCDI_32(m68k);
 
 	FLAG_N = NFLAG_32(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2646,9 +2646,9 @@ void m68k_op_and_32_er_pcdi(void)
 }
 
 
-void m68k_op_and_32_er_pcix(void)
+void m68k_op_and_32_er_pcix(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = DX &= OPER_PCIX_32();
+	FLAG_Z = DX &= OPER_PCIX_32(m68k);
 
 	FLAG_N = NFLAG_32(FLAG_Z);
 	FLAG_C = CFLAG_CLEAR;
@@ -2656,7 +2656,7 @@ void m68k_op_and_32_er_pcix(void)
 }
 
 
-void m68k_op_and_32_er_i(void)
+void m68k_op_and_32_er_i(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = DX &= OPER_I_32();
 
@@ -2666,7 +2666,7 @@ void m68k_op_and_32_er_i(void)
 }
 
 
-void m68k_op_and_8_re_ai(void)
+void m68k_op_and_8_re_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2680,7 +2680,7 @@ void m68k_op_and_8_re_ai(void)
 }
 
 
-void m68k_op_and_8_re_pi(void)
+void m68k_op_and_8_re_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2694,7 +2694,7 @@ void m68k_op_and_8_re_pi(void)
 }
 
 
-void m68k_op_and_8_re_pi7(void)
+void m68k_op_and_8_re_pi7(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_A7_PI_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2708,7 +2708,7 @@ void m68k_op_and_8_re_pi7(void)
 }
 
 
-void m68k_op_and_8_re_pd(void)
+void m68k_op_and_8_re_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2722,7 +2722,7 @@ void m68k_op_and_8_re_pd(void)
 }
 
 
-void m68k_op_and_8_re_pd7(void)
+void m68k_op_and_8_re_pd7(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_A7_PD_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2736,7 +2736,7 @@ void m68k_op_and_8_re_pd7(void)
 }
 
 
-void m68k_op_and_8_re_di(void)
+void m68k_op_and_8_re_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2750,7 +2750,7 @@ void m68k_op_and_8_re_di(void)
 }
 
 
-void m68k_op_and_8_re_ix(void)
+void m68k_op_and_8_re_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2764,7 +2764,7 @@ void m68k_op_and_8_re_ix(void)
 }
 
 
-void m68k_op_and_8_re_aw(void)
+void m68k_op_and_8_re_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2778,7 +2778,7 @@ void m68k_op_and_8_re_aw(void)
 }
 
 
-void m68k_op_and_8_re_al(void)
+void m68k_op_and_8_re_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2792,7 +2792,7 @@ void m68k_op_and_8_re_al(void)
 }
 
 
-void m68k_op_and_16_re_ai(void)
+void m68k_op_and_16_re_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2806,7 +2806,7 @@ void m68k_op_and_16_re_ai(void)
 }
 
 
-void m68k_op_and_16_re_pi(void)
+void m68k_op_and_16_re_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2820,7 +2820,7 @@ void m68k_op_and_16_re_pi(void)
 }
 
 
-void m68k_op_and_16_re_pd(void)
+void m68k_op_and_16_re_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2834,7 +2834,7 @@ void m68k_op_and_16_re_pd(void)
 }
 
 
-void m68k_op_and_16_re_di(void)
+void m68k_op_and_16_re_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2848,7 +2848,7 @@ void m68k_op_and_16_re_di(void)
 }
 
 
-void m68k_op_and_16_re_ix(void)
+void m68k_op_and_16_re_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2862,7 +2862,7 @@ void m68k_op_and_16_re_ix(void)
 }
 
 
-void m68k_op_and_16_re_aw(void)
+void m68k_op_and_16_re_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2876,7 +2876,7 @@ void m68k_op_and_16_re_aw(void)
 }
 
 
-void m68k_op_and_16_re_al(void)
+void m68k_op_and_16_re_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2890,7 +2890,7 @@ void m68k_op_and_16_re_al(void)
 }
 
 
-void m68k_op_and_32_re_ai(void)
+void m68k_op_and_32_re_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2904,7 +2904,7 @@ void m68k_op_and_32_re_ai(void)
 }
 
 
-void m68k_op_and_32_re_pi(void)
+void m68k_op_and_32_re_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2918,7 +2918,7 @@ void m68k_op_and_32_re_pi(void)
 }
 
 
-void m68k_op_and_32_re_pd(void)
+void m68k_op_and_32_re_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2932,7 +2932,7 @@ void m68k_op_and_32_re_pd(void)
 }
 
 
-void m68k_op_and_32_re_di(void)
+void m68k_op_and_32_re_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2946,7 +2946,7 @@ void m68k_op_and_32_re_di(void)
 }
 
 
-void m68k_op_and_32_re_ix(void)
+void m68k_op_and_32_re_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2960,7 +2960,7 @@ void m68k_op_and_32_re_ix(void)
 }
 
 
-void m68k_op_and_32_re_aw(void)
+void m68k_op_and_32_re_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2974,7 +2974,7 @@ void m68k_op_and_32_re_aw(void)
 }
 
 
-void m68k_op_and_32_re_al(void)
+void m68k_op_and_32_re_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2988,7 +2988,7 @@ void m68k_op_and_32_re_al(void)
 }
 
 
-void m68k_op_andi_8_d(void)
+void m68k_op_andi_8_d(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DY &= (OPER_I_8() | 0xffffff00));
 
@@ -2998,7 +2998,7 @@ void m68k_op_andi_8_d(void)
 }
 
 
-void m68k_op_andi_8_ai(void)
+void m68k_op_andi_8_ai(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_AI_8();
@@ -3013,7 +3013,7 @@ void m68k_op_andi_8_ai(void)
 }
 
 
-void m68k_op_andi_8_pi(void)
+void m68k_op_andi_8_pi(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PI_8();
@@ -3028,7 +3028,7 @@ void m68k_op_andi_8_pi(void)
 }
 
 
-void m68k_op_andi_8_pi7(void)
+void m68k_op_andi_8_pi7(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PI_8();
@@ -3043,7 +3043,7 @@ void m68k_op_andi_8_pi7(void)
 }
 
 
-void m68k_op_andi_8_pd(void)
+void m68k_op_andi_8_pd(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PD_8();
@@ -3058,7 +3058,7 @@ void m68k_op_andi_8_pd(void)
 }
 
 
-void m68k_op_andi_8_pd7(void)
+void m68k_op_andi_8_pd7(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PD_8();
@@ -3073,7 +3073,7 @@ void m68k_op_andi_8_pd7(void)
 }
 
 
-void m68k_op_andi_8_di(void)
+void m68k_op_andi_8_di(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_DI_8();
@@ -3088,7 +3088,7 @@ void m68k_op_andi_8_di(void)
 }
 
 
-void m68k_op_andi_8_ix(void)
+void m68k_op_andi_8_ix(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_IX_8();
@@ -3103,7 +3103,7 @@ void m68k_op_andi_8_ix(void)
 }
 
 
-void m68k_op_andi_8_aw(void)
+void m68k_op_andi_8_aw(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AW_8();
@@ -3118,7 +3118,7 @@ void m68k_op_andi_8_aw(void)
 }
 
 
-void m68k_op_andi_8_al(void)
+void m68k_op_andi_8_al(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AL_8();
@@ -3133,7 +3133,7 @@ void m68k_op_andi_8_al(void)
 }
 
 
-void m68k_op_andi_16_d(void)
+void m68k_op_andi_16_d(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DY &= (OPER_I_16() | 0xffff0000));
 
@@ -3143,7 +3143,7 @@ void m68k_op_andi_16_d(void)
 }
 
 
-void m68k_op_andi_16_ai(void)
+void m68k_op_andi_16_ai(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_AI_16();
@@ -3158,7 +3158,7 @@ void m68k_op_andi_16_ai(void)
 }
 
 
-void m68k_op_andi_16_pi(void)
+void m68k_op_andi_16_pi(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PI_16();
@@ -3173,7 +3173,7 @@ void m68k_op_andi_16_pi(void)
 }
 
 
-void m68k_op_andi_16_pd(void)
+void m68k_op_andi_16_pd(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PD_16();
@@ -3188,7 +3188,7 @@ void m68k_op_andi_16_pd(void)
 }
 
 
-void m68k_op_andi_16_di(void)
+void m68k_op_andi_16_di(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_DI_16();
@@ -3203,7 +3203,7 @@ void m68k_op_andi_16_di(void)
 }
 
 
-void m68k_op_andi_16_ix(void)
+void m68k_op_andi_16_ix(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_IX_16();
@@ -3218,7 +3218,7 @@ void m68k_op_andi_16_ix(void)
 }
 
 
-void m68k_op_andi_16_aw(void)
+void m68k_op_andi_16_aw(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AW_16();
@@ -3233,7 +3233,7 @@ void m68k_op_andi_16_aw(void)
 }
 
 
-void m68k_op_andi_16_al(void)
+void m68k_op_andi_16_al(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AL_16();
@@ -3248,7 +3248,7 @@ void m68k_op_andi_16_al(void)
 }
 
 
-void m68k_op_andi_32_d(void)
+void m68k_op_andi_32_d(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = DY &= (OPER_I_32());
 
@@ -3258,7 +3258,7 @@ void m68k_op_andi_32_d(void)
 }
 
 
-void m68k_op_andi_32_ai(void)
+void m68k_op_andi_32_ai(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_AI_32();
@@ -3273,7 +3273,7 @@ void m68k_op_andi_32_ai(void)
 }
 
 
-void m68k_op_andi_32_pi(void)
+void m68k_op_andi_32_pi(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PI_32();
@@ -3288,7 +3288,7 @@ void m68k_op_andi_32_pi(void)
 }
 
 
-void m68k_op_andi_32_pd(void)
+void m68k_op_andi_32_pd(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PD_32();
@@ -3303,7 +3303,7 @@ void m68k_op_andi_32_pd(void)
 }
 
 
-void m68k_op_andi_32_di(void)
+void m68k_op_andi_32_di(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_DI_32();
@@ -3318,7 +3318,7 @@ void m68k_op_andi_32_di(void)
 }
 
 
-void m68k_op_andi_32_ix(void)
+void m68k_op_andi_32_ix(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_IX_32();
@@ -3333,7 +3333,7 @@ void m68k_op_andi_32_ix(void)
 }
 
 
-void m68k_op_andi_32_aw(void)
+void m68k_op_andi_32_aw(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AW_32();
@@ -3348,7 +3348,7 @@ void m68k_op_andi_32_aw(void)
 }
 
 
-void m68k_op_andi_32_al(void)
+void m68k_op_andi_32_al(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AL_32();
@@ -3363,26 +3363,26 @@ void m68k_op_andi_32_al(void)
 }
 
 
-void m68k_op_andi_16_toc(void)
+void m68k_op_andi_16_toc(m68ki_cpu_core *m68k)
 {
-	m68ki_set_ccr(m68ki_get_ccr() & OPER_I_16());
+	m68ki_set_ccr(m68k, m68ki_get_ccr() & OPER_I_16());
 }
 
 
-void m68k_op_andi_16_tos(void)
+void m68k_op_andi_16_tos(m68ki_cpu_core *m68k)
 {
 	if(FLAG_S)
 	{
 		uint src = OPER_I_16();
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_set_sr(m68ki_get_sr() & src);
+		m68ki_set_sr(m68k, m68ki_get_sr() & src);
 		return;
 	}
-	m68ki_exception_privilege_violation();
+	m68ki_exception_privilege_violation(m68k);
 }
 
 
-void m68k_op_asr_8_s(void)
+void m68k_op_asr_8_s(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3401,7 +3401,7 @@ void m68k_op_asr_8_s(void)
 }
 
 
-void m68k_op_asr_16_s(void)
+void m68k_op_asr_16_s(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3420,7 +3420,7 @@ void m68k_op_asr_16_s(void)
 }
 
 
-void m68k_op_asr_32_s(void)
+void m68k_op_asr_32_s(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3439,7 +3439,7 @@ void m68k_op_asr_32_s(void)
 }
 
 
-void m68k_op_asr_8_r(void)
+void m68k_op_asr_8_r(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3491,7 +3491,7 @@ void m68k_op_asr_8_r(void)
 }
 
 
-void m68k_op_asr_16_r(void)
+void m68k_op_asr_16_r(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3543,7 +3543,7 @@ void m68k_op_asr_16_r(void)
 }
 
 
-void m68k_op_asr_32_r(void)
+void m68k_op_asr_32_r(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3595,7 +3595,7 @@ void m68k_op_asr_32_r(void)
 }
 
 
-void m68k_op_asr_16_ai(void)
+void m68k_op_asr_16_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -3613,7 +3613,7 @@ void m68k_op_asr_16_ai(void)
 }
 
 
-void m68k_op_asr_16_pi(void)
+void m68k_op_asr_16_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -3631,7 +3631,7 @@ void m68k_op_asr_16_pi(void)
 }
 
 
-void m68k_op_asr_16_pd(void)
+void m68k_op_asr_16_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -3649,7 +3649,7 @@ void m68k_op_asr_16_pd(void)
 }
 
 
-void m68k_op_asr_16_di(void)
+void m68k_op_asr_16_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -3667,7 +3667,7 @@ void m68k_op_asr_16_di(void)
 }
 
 
-void m68k_op_asr_16_ix(void)
+void m68k_op_asr_16_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -3685,7 +3685,7 @@ void m68k_op_asr_16_ix(void)
 }
 
 
-void m68k_op_asr_16_aw(void)
+void m68k_op_asr_16_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -3703,7 +3703,7 @@ void m68k_op_asr_16_aw(void)
 }
 
 
-void m68k_op_asr_16_al(void)
+void m68k_op_asr_16_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -3721,7 +3721,7 @@ void m68k_op_asr_16_al(void)
 }
 
 
-void m68k_op_asl_8_s(void)
+void m68k_op_asl_8_s(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3738,7 +3738,7 @@ void m68k_op_asl_8_s(void)
 }
 
 
-void m68k_op_asl_16_s(void)
+void m68k_op_asl_16_s(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3755,7 +3755,7 @@ void m68k_op_asl_16_s(void)
 }
 
 
-void m68k_op_asl_32_s(void)
+void m68k_op_asl_32_s(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3772,7 +3772,7 @@ void m68k_op_asl_32_s(void)
 }
 
 
-void m68k_op_asl_8_r(void)
+void m68k_op_asl_8_r(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3809,7 +3809,7 @@ void m68k_op_asl_8_r(void)
 }
 
 
-void m68k_op_asl_16_r(void)
+void m68k_op_asl_16_r(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3846,7 +3846,7 @@ void m68k_op_asl_16_r(void)
 }
 
 
-void m68k_op_asl_32_r(void)
+void m68k_op_asl_32_r(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3883,7 +3883,7 @@ void m68k_op_asl_32_r(void)
 }
 
 
-void m68k_op_asl_16_ai(void)
+void m68k_op_asl_16_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -3899,7 +3899,7 @@ void m68k_op_asl_16_ai(void)
 }
 
 
-void m68k_op_asl_16_pi(void)
+void m68k_op_asl_16_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -3915,7 +3915,7 @@ void m68k_op_asl_16_pi(void)
 }
 
 
-void m68k_op_asl_16_pd(void)
+void m68k_op_asl_16_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -3931,7 +3931,7 @@ void m68k_op_asl_16_pd(void)
 }
 
 
-void m68k_op_asl_16_di(void)
+void m68k_op_asl_16_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -3947,7 +3947,7 @@ void m68k_op_asl_16_di(void)
 }
 
 
-void m68k_op_asl_16_ix(void)
+void m68k_op_asl_16_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -3963,7 +3963,7 @@ void m68k_op_asl_16_ix(void)
 }
 
 
-void m68k_op_asl_16_aw(void)
+void m68k_op_asl_16_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -3979,7 +3979,7 @@ void m68k_op_asl_16_aw(void)
 }
 
 
-void m68k_op_asl_16_al(void)
+void m68k_op_asl_16_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -3995,182 +3995,182 @@ void m68k_op_asl_16_al(void)
 }
 
 
-void m68k_op_bhi_8(void)
+void m68k_op_bhi_8(m68ki_cpu_core *m68k)
 {
 	if(COND_HI())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bls_8(void)
+void m68k_op_bls_8(m68ki_cpu_core *m68k)
 {
 	if(COND_LS())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bcc_8(void)
+void m68k_op_bcc_8(m68ki_cpu_core *m68k)
 {
 	if(COND_CC())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bcs_8(void)
+void m68k_op_bcs_8(m68ki_cpu_core *m68k)
 {
 	if(COND_CS())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bne_8(void)
+void m68k_op_bne_8(m68ki_cpu_core *m68k)
 {
 	if(COND_NE())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_beq_8(void)
+void m68k_op_beq_8(m68ki_cpu_core *m68k)
 {
 	if(COND_EQ())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bvc_8(void)
+void m68k_op_bvc_8(m68ki_cpu_core *m68k)
 {
 	if(COND_VC())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bvs_8(void)
+void m68k_op_bvs_8(m68ki_cpu_core *m68k)
 {
 	if(COND_VS())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bpl_8(void)
+void m68k_op_bpl_8(m68ki_cpu_core *m68k)
 {
 	if(COND_PL())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bmi_8(void)
+void m68k_op_bmi_8(m68ki_cpu_core *m68k)
 {
 	if(COND_MI())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bge_8(void)
+void m68k_op_bge_8(m68ki_cpu_core *m68k)
 {
 	if(COND_GE())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_blt_8(void)
+void m68k_op_blt_8(m68ki_cpu_core *m68k)
 {
 	if(COND_LT())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bgt_8(void)
+void m68k_op_bgt_8(m68ki_cpu_core *m68k)
 {
 	if(COND_GT())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_ble_8(void)
+void m68k_op_ble_8(m68ki_cpu_core *m68k)
 {
 	if(COND_LE())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
 }
 
 
-void m68k_op_bhi_16(void)
+void m68k_op_bhi_16(m68ki_cpu_core *m68k)
 {
 	if(COND_HI())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4178,14 +4178,14 @@ void m68k_op_bhi_16(void)
 }
 
 
-void m68k_op_bls_16(void)
+void m68k_op_bls_16(m68ki_cpu_core *m68k)
 {
 	if(COND_LS())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4193,14 +4193,14 @@ void m68k_op_bls_16(void)
 }
 
 
-void m68k_op_bcc_16(void)
+void m68k_op_bcc_16(m68ki_cpu_core *m68k)
 {
 	if(COND_CC())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4208,14 +4208,14 @@ void m68k_op_bcc_16(void)
 }
 
 
-void m68k_op_bcs_16(void)
+void m68k_op_bcs_16(m68ki_cpu_core *m68k)
 {
 	if(COND_CS())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4223,14 +4223,14 @@ void m68k_op_bcs_16(void)
 }
 
 
-void m68k_op_bne_16(void)
+void m68k_op_bne_16(m68ki_cpu_core *m68k)
 {
 	if(COND_NE())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4238,14 +4238,14 @@ void m68k_op_bne_16(void)
 }
 
 
-void m68k_op_beq_16(void)
+void m68k_op_beq_16(m68ki_cpu_core *m68k)
 {
 	if(COND_EQ())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4253,14 +4253,14 @@ void m68k_op_beq_16(void)
 }
 
 
-void m68k_op_bvc_16(void)
+void m68k_op_bvc_16(m68ki_cpu_core *m68k)
 {
 	if(COND_VC())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4268,14 +4268,14 @@ void m68k_op_bvc_16(void)
 }
 
 
-void m68k_op_bvs_16(void)
+void m68k_op_bvs_16(m68ki_cpu_core *m68k)
 {
 	if(COND_VS())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4283,14 +4283,14 @@ void m68k_op_bvs_16(void)
 }
 
 
-void m68k_op_bpl_16(void)
+void m68k_op_bpl_16(m68ki_cpu_core *m68k)
 {
 	if(COND_PL())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4298,14 +4298,14 @@ void m68k_op_bpl_16(void)
 }
 
 
-void m68k_op_bmi_16(void)
+void m68k_op_bmi_16(m68ki_cpu_core *m68k)
 {
 	if(COND_MI())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4313,14 +4313,14 @@ void m68k_op_bmi_16(void)
 }
 
 
-void m68k_op_bge_16(void)
+void m68k_op_bge_16(m68ki_cpu_core *m68k)
 {
 	if(COND_GE())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4328,14 +4328,14 @@ void m68k_op_bge_16(void)
 }
 
 
-void m68k_op_blt_16(void)
+void m68k_op_blt_16(m68ki_cpu_core *m68k)
 {
 	if(COND_LT())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4343,14 +4343,14 @@ void m68k_op_blt_16(void)
 }
 
 
-void m68k_op_bgt_16(void)
+void m68k_op_bgt_16(m68ki_cpu_core *m68k)
 {
 	if(COND_GT())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4358,14 +4358,14 @@ void m68k_op_bgt_16(void)
 }
 
 
-void m68k_op_ble_16(void)
+void m68k_op_ble_16(m68ki_cpu_core *m68k)
 {
 	if(COND_LE())
 	{
 		uint offset = OPER_I_16();
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_16(offset);
+		m68ki_branch_16(m68k, offset);
 		return;
 	}
 	REG_PC += 2;
@@ -4373,7 +4373,7 @@ void m68k_op_ble_16(void)
 }
 
 
-void m68k_op_bhi_32(void)
+void m68k_op_bhi_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4382,17 +4382,17 @@ void m68k_op_bhi_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bls_32(void)
+void m68k_op_bls_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4401,17 +4401,17 @@ void m68k_op_bls_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bcc_32(void)
+void m68k_op_bcc_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4420,17 +4420,17 @@ void m68k_op_bcc_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bcs_32(void)
+void m68k_op_bcs_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4439,17 +4439,17 @@ void m68k_op_bcs_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bne_32(void)
+void m68k_op_bne_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4458,17 +4458,17 @@ void m68k_op_bne_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_beq_32(void)
+void m68k_op_beq_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4477,17 +4477,17 @@ void m68k_op_beq_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bvc_32(void)
+void m68k_op_bvc_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4496,17 +4496,17 @@ void m68k_op_bvc_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bvs_32(void)
+void m68k_op_bvs_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4515,17 +4515,17 @@ void m68k_op_bvs_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bpl_32(void)
+void m68k_op_bpl_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4534,17 +4534,17 @@ void m68k_op_bpl_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bmi_32(void)
+void m68k_op_bmi_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4553,17 +4553,17 @@ void m68k_op_bmi_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bge_32(void)
+void m68k_op_bge_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4572,17 +4572,17 @@ void m68k_op_bge_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_blt_32(void)
+void m68k_op_blt_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4591,17 +4591,17 @@ void m68k_op_blt_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bgt_32(void)
+void m68k_op_bgt_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4610,17 +4610,17 @@ void m68k_op_bgt_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_ble_32(void)
+void m68k_op_ble_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4629,17 +4629,17 @@ void m68k_op_ble_32(void)
 			uint offset = OPER_I_32();
 			REG_PC -= 4;
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-			m68ki_branch_32(offset);
+			m68ki_branch_32(m68k, offset);
 			return;
 		}
 		REG_PC += 4;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bchg_32_r_d(void)
+void m68k_op_bchg_32_r_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (DX & 0x1f);
@@ -4649,7 +4649,7 @@ void m68k_op_bchg_32_r_d(void)
 }
 
 
-void m68k_op_bchg_8_r_ai(void)
+void m68k_op_bchg_8_r_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = m68ki_read_8(ea);
@@ -4660,7 +4660,7 @@ void m68k_op_bchg_8_r_ai(void)
 }
 
 
-void m68k_op_bchg_8_r_pi(void)
+void m68k_op_bchg_8_r_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -4671,7 +4671,7 @@ void m68k_op_bchg_8_r_pi(void)
 }
 
 
-void m68k_op_bchg_8_r_pi7(void)
+void m68k_op_bchg_8_r_pi7(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -4682,7 +4682,7 @@ void m68k_op_bchg_8_r_pi7(void)
 }
 
 
-void m68k_op_bchg_8_r_pd(void)
+void m68k_op_bchg_8_r_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -4693,7 +4693,7 @@ void m68k_op_bchg_8_r_pd(void)
 }
 
 
-void m68k_op_bchg_8_r_pd7(void)
+void m68k_op_bchg_8_r_pd7(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -4704,7 +4704,7 @@ void m68k_op_bchg_8_r_pd7(void)
 }
 
 
-void m68k_op_bchg_8_r_di(void)
+void m68k_op_bchg_8_r_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = m68ki_read_8(ea);
@@ -4715,7 +4715,7 @@ void m68k_op_bchg_8_r_di(void)
 }
 
 
-void m68k_op_bchg_8_r_ix(void)
+void m68k_op_bchg_8_r_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = m68ki_read_8(ea);
@@ -4726,7 +4726,7 @@ void m68k_op_bchg_8_r_ix(void)
 }
 
 
-void m68k_op_bchg_8_r_aw(void)
+void m68k_op_bchg_8_r_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_8();
 	uint src = m68ki_read_8(ea);
@@ -4737,7 +4737,7 @@ void m68k_op_bchg_8_r_aw(void)
 }
 
 
-void m68k_op_bchg_8_r_al(void)
+void m68k_op_bchg_8_r_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_8();
 	uint src = m68ki_read_8(ea);
@@ -4748,7 +4748,7 @@ void m68k_op_bchg_8_r_al(void)
 }
 
 
-void m68k_op_bchg_32_s_d(void)
+void m68k_op_bchg_32_s_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (OPER_I_8() & 0x1f);
@@ -4758,7 +4758,7 @@ void m68k_op_bchg_32_s_d(void)
 }
 
 
-void m68k_op_bchg_8_s_ai(void)
+void m68k_op_bchg_8_s_ai(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_AI_8();
@@ -4769,7 +4769,7 @@ void m68k_op_bchg_8_s_ai(void)
 }
 
 
-void m68k_op_bchg_8_s_pi(void)
+void m68k_op_bchg_8_s_pi(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PI_8();
@@ -4780,7 +4780,7 @@ void m68k_op_bchg_8_s_pi(void)
 }
 
 
-void m68k_op_bchg_8_s_pi7(void)
+void m68k_op_bchg_8_s_pi7(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PI_8();
@@ -4791,7 +4791,7 @@ void m68k_op_bchg_8_s_pi7(void)
 }
 
 
-void m68k_op_bchg_8_s_pd(void)
+void m68k_op_bchg_8_s_pd(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PD_8();
@@ -4802,7 +4802,7 @@ void m68k_op_bchg_8_s_pd(void)
 }
 
 
-void m68k_op_bchg_8_s_pd7(void)
+void m68k_op_bchg_8_s_pd7(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PD_8();
@@ -4813,7 +4813,7 @@ void m68k_op_bchg_8_s_pd7(void)
 }
 
 
-void m68k_op_bchg_8_s_di(void)
+void m68k_op_bchg_8_s_di(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_DI_8();
@@ -4824,7 +4824,7 @@ void m68k_op_bchg_8_s_di(void)
 }
 
 
-void m68k_op_bchg_8_s_ix(void)
+void m68k_op_bchg_8_s_ix(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_IX_8();
@@ -4835,7 +4835,7 @@ void m68k_op_bchg_8_s_ix(void)
 }
 
 
-void m68k_op_bchg_8_s_aw(void)
+void m68k_op_bchg_8_s_aw(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AW_8();
@@ -4846,7 +4846,7 @@ void m68k_op_bchg_8_s_aw(void)
 }
 
 
-void m68k_op_bchg_8_s_al(void)
+void m68k_op_bchg_8_s_al(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AL_8();
@@ -4857,7 +4857,7 @@ void m68k_op_bchg_8_s_al(void)
 }
 
 
-void m68k_op_bclr_32_r_d(void)
+void m68k_op_bclr_32_r_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (DX & 0x1f);
@@ -4867,7 +4867,7 @@ void m68k_op_bclr_32_r_d(void)
 }
 
 
-void m68k_op_bclr_8_r_ai(void)
+void m68k_op_bclr_8_r_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = m68ki_read_8(ea);
@@ -4878,7 +4878,7 @@ void m68k_op_bclr_8_r_ai(void)
 }
 
 
-void m68k_op_bclr_8_r_pi(void)
+void m68k_op_bclr_8_r_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -4889,7 +4889,7 @@ void m68k_op_bclr_8_r_pi(void)
 }
 
 
-void m68k_op_bclr_8_r_pi7(void)
+void m68k_op_bclr_8_r_pi7(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -4900,7 +4900,7 @@ void m68k_op_bclr_8_r_pi7(void)
 }
 
 
-void m68k_op_bclr_8_r_pd(void)
+void m68k_op_bclr_8_r_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -4911,7 +4911,7 @@ void m68k_op_bclr_8_r_pd(void)
 }
 
 
-void m68k_op_bclr_8_r_pd7(void)
+void m68k_op_bclr_8_r_pd7(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -4922,7 +4922,7 @@ void m68k_op_bclr_8_r_pd7(void)
 }
 
 
-void m68k_op_bclr_8_r_di(void)
+void m68k_op_bclr_8_r_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = m68ki_read_8(ea);
@@ -4933,7 +4933,7 @@ void m68k_op_bclr_8_r_di(void)
 }
 
 
-void m68k_op_bclr_8_r_ix(void)
+void m68k_op_bclr_8_r_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = m68ki_read_8(ea);
@@ -4944,7 +4944,7 @@ void m68k_op_bclr_8_r_ix(void)
 }
 
 
-void m68k_op_bclr_8_r_aw(void)
+void m68k_op_bclr_8_r_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_8();
 	uint src = m68ki_read_8(ea);
@@ -4955,7 +4955,7 @@ void m68k_op_bclr_8_r_aw(void)
 }
 
 
-void m68k_op_bclr_8_r_al(void)
+void m68k_op_bclr_8_r_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_8();
 	uint src = m68ki_read_8(ea);
@@ -4966,7 +4966,7 @@ void m68k_op_bclr_8_r_al(void)
 }
 
 
-void m68k_op_bclr_32_s_d(void)
+void m68k_op_bclr_32_s_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (OPER_I_8() & 0x1f);
@@ -4976,7 +4976,7 @@ void m68k_op_bclr_32_s_d(void)
 }
 
 
-void m68k_op_bclr_8_s_ai(void)
+void m68k_op_bclr_8_s_ai(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_AI_8();
@@ -4987,7 +4987,7 @@ void m68k_op_bclr_8_s_ai(void)
 }
 
 
-void m68k_op_bclr_8_s_pi(void)
+void m68k_op_bclr_8_s_pi(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PI_8();
@@ -4998,7 +4998,7 @@ void m68k_op_bclr_8_s_pi(void)
 }
 
 
-void m68k_op_bclr_8_s_pi7(void)
+void m68k_op_bclr_8_s_pi7(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PI_8();
@@ -5009,7 +5009,7 @@ void m68k_op_bclr_8_s_pi7(void)
 }
 
 
-void m68k_op_bclr_8_s_pd(void)
+void m68k_op_bclr_8_s_pd(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PD_8();
@@ -5020,7 +5020,7 @@ void m68k_op_bclr_8_s_pd(void)
 }
 
 
-void m68k_op_bclr_8_s_pd7(void)
+void m68k_op_bclr_8_s_pd7(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PD_8();
@@ -5031,7 +5031,7 @@ void m68k_op_bclr_8_s_pd7(void)
 }
 
 
-void m68k_op_bclr_8_s_di(void)
+void m68k_op_bclr_8_s_di(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_DI_8();
@@ -5042,7 +5042,7 @@ void m68k_op_bclr_8_s_di(void)
 }
 
 
-void m68k_op_bclr_8_s_ix(void)
+void m68k_op_bclr_8_s_ix(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_IX_8();
@@ -5053,7 +5053,7 @@ void m68k_op_bclr_8_s_ix(void)
 }
 
 
-void m68k_op_bclr_8_s_aw(void)
+void m68k_op_bclr_8_s_aw(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AW_8();
@@ -5064,7 +5064,7 @@ void m68k_op_bclr_8_s_aw(void)
 }
 
 
-void m68k_op_bclr_8_s_al(void)
+void m68k_op_bclr_8_s_al(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AL_8();
@@ -5075,7 +5075,7 @@ void m68k_op_bclr_8_s_al(void)
 }
 
 
-void m68k_op_bfchg_32_d(void)
+void m68k_op_bfchg_32_d(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5106,11 +5106,11 @@ void m68k_op_bfchg_32_d(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfchg_32_ai(void)
+void m68k_op_bfchg_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5160,11 +5160,11 @@ void m68k_op_bfchg_32_ai(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfchg_32_di(void)
+void m68k_op_bfchg_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5214,11 +5214,11 @@ void m68k_op_bfchg_32_di(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfchg_32_ix(void)
+void m68k_op_bfchg_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5268,11 +5268,11 @@ void m68k_op_bfchg_32_ix(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfchg_32_aw(void)
+void m68k_op_bfchg_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5322,11 +5322,11 @@ void m68k_op_bfchg_32_aw(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfchg_32_al(void)
+void m68k_op_bfchg_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5376,11 +5376,11 @@ void m68k_op_bfchg_32_al(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfclr_32_d(void)
+void m68k_op_bfclr_32_d(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5413,11 +5413,11 @@ void m68k_op_bfclr_32_d(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfclr_32_ai(void)
+void m68k_op_bfclr_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5467,11 +5467,11 @@ void m68k_op_bfclr_32_ai(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfclr_32_di(void)
+void m68k_op_bfclr_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5521,11 +5521,11 @@ void m68k_op_bfclr_32_di(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfclr_32_ix(void)
+void m68k_op_bfclr_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5575,11 +5575,11 @@ void m68k_op_bfclr_32_ix(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfclr_32_aw(void)
+void m68k_op_bfclr_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5629,11 +5629,11 @@ void m68k_op_bfclr_32_aw(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfclr_32_al(void)
+void m68k_op_bfclr_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5683,11 +5683,11 @@ void m68k_op_bfclr_32_al(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfexts_32_d(void)
+void m68k_op_bfexts_32_d(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5717,11 +5717,11 @@ void m68k_op_bfexts_32_d(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfexts_32_ai(void)
+void m68k_op_bfexts_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5765,11 +5765,11 @@ void m68k_op_bfexts_32_ai(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfexts_32_di(void)
+void m68k_op_bfexts_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5813,11 +5813,11 @@ void m68k_op_bfexts_32_di(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfexts_32_ix(void)
+void m68k_op_bfexts_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5861,11 +5861,11 @@ void m68k_op_bfexts_32_ix(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfexts_32_aw(void)
+void m68k_op_bfexts_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5909,11 +5909,11 @@ void m68k_op_bfexts_32_aw(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfexts_32_al(void)
+void m68k_op_bfexts_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5957,11 +5957,11 @@ void m68k_op_bfexts_32_al(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfexts_32_pcdi(void)
+void m68k_op_bfexts_32_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6005,11 +6005,11 @@ void m68k_op_bfexts_32_pcdi(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfexts_32_pcix(void)
+void m68k_op_bfexts_32_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6053,11 +6053,11 @@ void m68k_op_bfexts_32_pcix(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfextu_32_d(void)
+void m68k_op_bfextu_32_d(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6087,11 +6087,11 @@ void m68k_op_bfextu_32_d(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfextu_32_ai(void)
+void m68k_op_bfextu_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6134,11 +6134,11 @@ void m68k_op_bfextu_32_ai(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfextu_32_di(void)
+void m68k_op_bfextu_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6181,11 +6181,11 @@ void m68k_op_bfextu_32_di(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfextu_32_ix(void)
+void m68k_op_bfextu_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6228,11 +6228,11 @@ void m68k_op_bfextu_32_ix(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfextu_32_aw(void)
+void m68k_op_bfextu_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6275,11 +6275,11 @@ void m68k_op_bfextu_32_aw(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfextu_32_al(void)
+void m68k_op_bfextu_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6322,11 +6322,11 @@ void m68k_op_bfextu_32_al(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfextu_32_pcdi(void)
+void m68k_op_bfextu_32_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6369,11 +6369,11 @@ void m68k_op_bfextu_32_pcdi(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfextu_32_pcix(void)
+void m68k_op_bfextu_32_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6416,11 +6416,11 @@ void m68k_op_bfextu_32_pcix(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfffo_32_d(void)
+void m68k_op_bfffo_32_d(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6454,11 +6454,11 @@ void m68k_op_bfffo_32_d(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfffo_32_ai(void)
+void m68k_op_bfffo_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6506,11 +6506,11 @@ void m68k_op_bfffo_32_ai(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfffo_32_di(void)
+void m68k_op_bfffo_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6558,11 +6558,11 @@ void m68k_op_bfffo_32_di(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfffo_32_ix(void)
+void m68k_op_bfffo_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6610,11 +6610,11 @@ void m68k_op_bfffo_32_ix(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfffo_32_aw(void)
+void m68k_op_bfffo_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6662,11 +6662,11 @@ void m68k_op_bfffo_32_aw(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfffo_32_al(void)
+void m68k_op_bfffo_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6714,11 +6714,11 @@ void m68k_op_bfffo_32_al(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfffo_32_pcdi(void)
+void m68k_op_bfffo_32_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6766,11 +6766,11 @@ void m68k_op_bfffo_32_pcdi(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfffo_32_pcix(void)
+void m68k_op_bfffo_32_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6818,11 +6818,11 @@ void m68k_op_bfffo_32_pcix(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfins_32_d(void)
+void m68k_op_bfins_32_d(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6860,11 +6860,11 @@ void m68k_op_bfins_32_d(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfins_32_ai(void)
+void m68k_op_bfins_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6921,11 +6921,11 @@ void m68k_op_bfins_32_ai(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfins_32_di(void)
+void m68k_op_bfins_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6982,11 +6982,11 @@ void m68k_op_bfins_32_di(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfins_32_ix(void)
+void m68k_op_bfins_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7043,11 +7043,11 @@ void m68k_op_bfins_32_ix(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfins_32_aw(void)
+void m68k_op_bfins_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7104,11 +7104,11 @@ void m68k_op_bfins_32_aw(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfins_32_al(void)
+void m68k_op_bfins_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7165,11 +7165,11 @@ void m68k_op_bfins_32_al(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfset_32_d(void)
+void m68k_op_bfset_32_d(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7202,11 +7202,11 @@ void m68k_op_bfset_32_d(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfset_32_ai(void)
+void m68k_op_bfset_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7257,11 +7257,11 @@ void m68k_op_bfset_32_ai(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfset_32_di(void)
+void m68k_op_bfset_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7312,11 +7312,11 @@ void m68k_op_bfset_32_di(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfset_32_ix(void)
+void m68k_op_bfset_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7367,11 +7367,11 @@ void m68k_op_bfset_32_ix(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfset_32_aw(void)
+void m68k_op_bfset_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7422,11 +7422,11 @@ void m68k_op_bfset_32_aw(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bfset_32_al(void)
+void m68k_op_bfset_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7477,11 +7477,11 @@ void m68k_op_bfset_32_al(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bftst_32_d(void)
+void m68k_op_bftst_32_d(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7512,11 +7512,11 @@ void m68k_op_bftst_32_d(void)
 
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bftst_32_ai(void)
+void m68k_op_bftst_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7563,11 +7563,11 @@ void m68k_op_bftst_32_ai(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bftst_32_di(void)
+void m68k_op_bftst_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7614,11 +7614,11 @@ void m68k_op_bftst_32_di(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bftst_32_ix(void)
+void m68k_op_bftst_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7665,11 +7665,11 @@ void m68k_op_bftst_32_ix(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bftst_32_aw(void)
+void m68k_op_bftst_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7716,11 +7716,11 @@ void m68k_op_bftst_32_aw(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bftst_32_al(void)
+void m68k_op_bftst_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7767,11 +7767,11 @@ void m68k_op_bftst_32_al(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bftst_32_pcdi(void)
+void m68k_op_bftst_32_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7818,11 +7818,11 @@ void m68k_op_bftst_32_pcdi(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bftst_32_pcix(void)
+void m68k_op_bftst_32_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7869,57 +7869,57 @@ void m68k_op_bftst_32_pcix(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bkpt(void)
+void m68k_op_bkpt(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
 		m68ki_bkpt_ack(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE) ? REG_IR & 7 : 0);	/* auto-disable (see m68kcpu.h) */
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bra_8(void)
+void m68k_op_bra_8(m68ki_cpu_core *m68k)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
-	m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+	m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 	if(REG_PC == REG_PPC)
 		USE_ALL_CYCLES();
 }
 
 
-void m68k_op_bra_16(void)
+void m68k_op_bra_16(m68ki_cpu_core *m68k)
 {
 	uint offset = OPER_I_16();
 	REG_PC -= 2;
 	m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-	m68ki_branch_16(offset);
+	m68ki_branch_16(m68k, offset);
 	if(REG_PC == REG_PPC)
 		USE_ALL_CYCLES();
 }
 
 
-void m68k_op_bra_32(void)
+void m68k_op_bra_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint offset = OPER_I_32();
 		REG_PC -= 4;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_branch_32(offset);
+		m68ki_branch_32(m68k, offset);
 		if(REG_PC == REG_PPC)
 			USE_ALL_CYCLES();
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_bset_32_r_d(void)
+void m68k_op_bset_32_r_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (DX & 0x1f);
@@ -7929,7 +7929,7 @@ void m68k_op_bset_32_r_d(void)
 }
 
 
-void m68k_op_bset_8_r_ai(void)
+void m68k_op_bset_8_r_ai(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = m68ki_read_8(ea);
@@ -7940,7 +7940,7 @@ void m68k_op_bset_8_r_ai(void)
 }
 
 
-void m68k_op_bset_8_r_pi(void)
+void m68k_op_bset_8_r_pi(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -7951,7 +7951,7 @@ void m68k_op_bset_8_r_pi(void)
 }
 
 
-void m68k_op_bset_8_r_pi7(void)
+void m68k_op_bset_8_r_pi7(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -7962,7 +7962,7 @@ void m68k_op_bset_8_r_pi7(void)
 }
 
 
-void m68k_op_bset_8_r_pd(void)
+void m68k_op_bset_8_r_pd(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -7973,7 +7973,7 @@ void m68k_op_bset_8_r_pd(void)
 }
 
 
-void m68k_op_bset_8_r_pd7(void)
+void m68k_op_bset_8_r_pd7(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -7984,7 +7984,7 @@ void m68k_op_bset_8_r_pd7(void)
 }
 
 
-void m68k_op_bset_8_r_di(void)
+void m68k_op_bset_8_r_di(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = m68ki_read_8(ea);
@@ -7995,7 +7995,7 @@ void m68k_op_bset_8_r_di(void)
 }
 
 
-void m68k_op_bset_8_r_ix(void)
+void m68k_op_bset_8_r_ix(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = m68ki_read_8(ea);
@@ -8006,7 +8006,7 @@ void m68k_op_bset_8_r_ix(void)
 }
 
 
-void m68k_op_bset_8_r_aw(void)
+void m68k_op_bset_8_r_aw(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AW_8();
 	uint src = m68ki_read_8(ea);
@@ -8017,7 +8017,7 @@ void m68k_op_bset_8_r_aw(void)
 }
 
 
-void m68k_op_bset_8_r_al(void)
+void m68k_op_bset_8_r_al(m68ki_cpu_core *m68k)
 {
 	uint ea = EA_AL_8();
 	uint src = m68ki_read_8(ea);
@@ -8028,7 +8028,7 @@ void m68k_op_bset_8_r_al(void)
 }
 
 
-void m68k_op_bset_32_s_d(void)
+void m68k_op_bset_32_s_d(m68ki_cpu_core *m68k)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (OPER_I_8() & 0x1f);
@@ -8038,7 +8038,7 @@ void m68k_op_bset_32_s_d(void)
 }
 
 
-void m68k_op_bset_8_s_ai(void)
+void m68k_op_bset_8_s_ai(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_AI_8();
@@ -8049,7 +8049,7 @@ void m68k_op_bset_8_s_ai(void)
 }
 
 
-void m68k_op_bset_8_s_pi(void)
+void m68k_op_bset_8_s_pi(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PI_8();
@@ -8060,7 +8060,7 @@ void m68k_op_bset_8_s_pi(void)
 }
 
 
-void m68k_op_bset_8_s_pi7(void)
+void m68k_op_bset_8_s_pi7(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PI_8();
@@ -8071,7 +8071,7 @@ void m68k_op_bset_8_s_pi7(void)
 }
 
 
-void m68k_op_bset_8_s_pd(void)
+void m68k_op_bset_8_s_pd(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PD_8();
@@ -8082,7 +8082,7 @@ void m68k_op_bset_8_s_pd(void)
 }
 
 
-void m68k_op_bset_8_s_pd7(void)
+void m68k_op_bset_8_s_pd7(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PD_8();
@@ -8093,7 +8093,7 @@ void m68k_op_bset_8_s_pd7(void)
 }
 
 
-void m68k_op_bset_8_s_di(void)
+void m68k_op_bset_8_s_di(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_DI_8();
@@ -8104,7 +8104,7 @@ void m68k_op_bset_8_s_di(void)
 }
 
 
-void m68k_op_bset_8_s_ix(void)
+void m68k_op_bset_8_s_ix(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_IX_8();
@@ -8115,7 +8115,7 @@ void m68k_op_bset_8_s_ix(void)
 }
 
 
-void m68k_op_bset_8_s_aw(void)
+void m68k_op_bset_8_s_aw(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AW_8();
@@ -8126,7 +8126,7 @@ void m68k_op_bset_8_s_aw(void)
 }
 
 
-void m68k_op_bset_8_s_al(void)
+void m68k_op_bset_8_s_al(m68ki_cpu_core *m68k)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AL_8();
@@ -8137,212 +8137,212 @@ void m68k_op_bset_8_s_al(void)
 }
 
 
-void m68k_op_bsr_8(void)
+void m68k_op_bsr_8(m68ki_cpu_core *m68k)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(REG_PC);
-	m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+	m68ki_push_32(m68k, REG_PC);
+	m68ki_branch_8(m68k, MASK_OUT_ABOVE_8(REG_IR));
 }
 
 
-void m68k_op_bsr_16(void)
+void m68k_op_bsr_16(m68ki_cpu_core *m68k)
 {
 	uint offset = OPER_I_16();
 	m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-	m68ki_push_32(REG_PC);
+	m68ki_push_32(m68k, REG_PC);
 	REG_PC -= 2;
-	m68ki_branch_16(offset);
+	m68ki_branch_16(m68k, offset);
 }
 
 
-void m68k_op_bsr_32(void)
+void m68k_op_bsr_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint offset = OPER_I_32();
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		m68ki_push_32(REG_PC);
+		m68ki_push_32(m68k, REG_PC);
 		REG_PC -= 4;
-		m68ki_branch_32(offset);
+		m68ki_branch_32(m68k, offset);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_btst_32_r_d(void)
+void m68k_op_btst_32_r_d(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = DY & (1 << (DX & 0x1f));
 }
 
 
-void m68k_op_btst_8_r_ai(void)
+void m68k_op_btst_8_r_ai(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_AY_AI_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_AY_AI_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pi(void)
+void m68k_op_btst_8_r_pi(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_AY_PI_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_AY_PI_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pi7(void)
+void m68k_op_btst_8_r_pi7(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_A7_PI_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_A7_PI_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pd(void)
+void m68k_op_btst_8_r_pd(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_AY_PD_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_AY_PD_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pd7(void)
+void m68k_op_btst_8_r_pd7(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_A7_PD_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_A7_PD_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_di(void)
+void m68k_op_btst_8_r_di(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_AY_DI_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_AY_DI_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_ix(void)
+void m68k_op_btst_8_r_ix(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_AY_IX_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_AY_IX_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_aw(void)
+void m68k_op_btst_8_r_aw(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_AW_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_AW_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_al(void)
+void m68k_op_btst_8_r_al(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_AL_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_AL_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pcdi(void)
+void m68k_op_btst_8_r_pcdi(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_PCDI_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_PCDI_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pcix(void)
+void m68k_op_btst_8_r_pcix(m68ki_cpu_core *m68k)
 {
-	FLAG_Z = OPER_PCIX_8() & (1 << (DX & 7));
+	FLAG_Z = OPER_PCIX_8(m68k) & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_i(void)
+void m68k_op_btst_8_r_i(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = OPER_I_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_32_s_d(void)
+void m68k_op_btst_32_s_d(m68ki_cpu_core *m68k)
 {
 	FLAG_Z = DY & (1 << (OPER_I_8() & 0x1f));
 }
 
 
-void m68k_op_btst_8_s_ai(void)
+void m68k_op_btst_8_s_ai(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_AY_AI_8() & (1 << bit);
+	FLAG_Z = OPER_AY_AI_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_btst_8_s_pi(void)
+void m68k_op_btst_8_s_pi(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_AY_PI_8() & (1 << bit);
+	FLAG_Z = OPER_AY_PI_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_btst_8_s_pi7(void)
+void m68k_op_btst_8_s_pi7(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_A7_PI_8() & (1 << bit);
+	FLAG_Z = OPER_A7_PI_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_btst_8_s_pd(void)
+void m68k_op_btst_8_s_pd(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_AY_PD_8() & (1 << bit);
+	FLAG_Z = OPER_AY_PD_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_btst_8_s_pd7(void)
+void m68k_op_btst_8_s_pd7(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_A7_PD_8() & (1 << bit);
+	FLAG_Z = OPER_A7_PD_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_btst_8_s_di(void)
+void m68k_op_btst_8_s_di(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_AY_DI_8() & (1 << bit);
+	FLAG_Z = OPER_AY_DI_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_btst_8_s_ix(void)
+void m68k_op_btst_8_s_ix(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_AY_IX_8() & (1 << bit);
+	FLAG_Z = OPER_AY_IX_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_btst_8_s_aw(void)
+void m68k_op_btst_8_s_aw(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_AW_8() & (1 << bit);
+	FLAG_Z = OPER_AW_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_btst_8_s_al(void)
+void m68k_op_btst_8_s_al(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_AL_8() & (1 << bit);
+	FLAG_Z = OPER_AL_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_btst_8_s_pcdi(void)
+void m68k_op_btst_8_s_pcdi(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_PCDI_8() & (1 << bit);
+	FLAG_Z = OPER_PCDI_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_btst_8_s_pcix(void)
+void m68k_op_btst_8_s_pcix(m68ki_cpu_core *m68k)
 {
 	uint bit = OPER_I_8() & 7;
 
-	FLAG_Z = OPER_PCIX_8() & (1 << bit);
+	FLAG_Z = OPER_PCIX_8(m68k) & (1 << bit);
 }
 
 
-void m68k_op_callm_32_ai(void)
+void m68k_op_callm_32_ai(m68ki_cpu_core *m68k)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8357,11 +8357,11 @@ void m68k_op_callm_32_ai(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_callm_32_di(void)
+void m68k_op_callm_32_di(m68ki_cpu_core *m68k)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8376,11 +8376,11 @@ void m68k_op_callm_32_di(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_callm_32_ix(void)
+void m68k_op_callm_32_ix(m68ki_cpu_core *m68k)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8395,11 +8395,11 @@ void m68k_op_callm_32_ix(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_callm_32_aw(void)
+void m68k_op_callm_32_aw(m68ki_cpu_core *m68k)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8414,11 +8414,11 @@ void m68k_op_callm_32_aw(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_callm_32_al(void)
+void m68k_op_callm_32_al(m68ki_cpu_core *m68k)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8433,11 +8433,11 @@ void m68k_op_callm_32_al(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_callm_32_pcdi(void)
+void m68k_op_callm_32_pcdi(m68ki_cpu_core *m68k)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8452,11 +8452,11 @@ void m68k_op_callm_32_pcdi(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_callm_32_pcix(void)
+void m68k_op_callm_32_pcix(m68ki_cpu_core *m68k)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8471,11 +8471,11 @@ void m68k_op_callm_32_pcix(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_8_ai(void)
+void m68k_op_cas_8_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8500,11 +8500,11 @@ void m68k_op_cas_8_ai(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_8_pi(void)
+void m68k_op_cas_8_pi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8529,11 +8529,11 @@ void m68k_op_cas_8_pi(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_8_pi7(void)
+void m68k_op_cas_8_pi7(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8558,11 +8558,11 @@ void m68k_op_cas_8_pi7(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_8_pd(void)
+void m68k_op_cas_8_pd(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8587,11 +8587,11 @@ void m68k_op_cas_8_pd(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_8_pd7(void)
+void m68k_op_cas_8_pd7(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8616,11 +8616,11 @@ void m68k_op_cas_8_pd7(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_8_di(void)
+void m68k_op_cas_8_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8645,11 +8645,11 @@ void m68k_op_cas_8_di(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_8_ix(void)
+void m68k_op_cas_8_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8674,11 +8674,11 @@ void m68k_op_cas_8_ix(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_8_aw(void)
+void m68k_op_cas_8_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8703,11 +8703,11 @@ void m68k_op_cas_8_aw(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_8_al(void)
+void m68k_op_cas_8_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8732,11 +8732,11 @@ void m68k_op_cas_8_al(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_16_ai(void)
+void m68k_op_cas_16_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8761,11 +8761,11 @@ void m68k_op_cas_16_ai(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_16_pi(void)
+void m68k_op_cas_16_pi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8790,11 +8790,11 @@ void m68k_op_cas_16_pi(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_16_pd(void)
+void m68k_op_cas_16_pd(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8819,11 +8819,11 @@ void m68k_op_cas_16_pd(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_16_di(void)
+void m68k_op_cas_16_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8848,11 +8848,11 @@ void m68k_op_cas_16_di(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_16_ix(void)
+void m68k_op_cas_16_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8877,11 +8877,11 @@ void m68k_op_cas_16_ix(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_16_aw(void)
+void m68k_op_cas_16_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8906,11 +8906,11 @@ void m68k_op_cas_16_aw(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_16_al(void)
+void m68k_op_cas_16_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8935,11 +8935,11 @@ void m68k_op_cas_16_al(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_32_ai(void)
+void m68k_op_cas_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8964,11 +8964,11 @@ void m68k_op_cas_32_ai(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_32_pi(void)
+void m68k_op_cas_32_pi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8993,11 +8993,11 @@ void m68k_op_cas_32_pi(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_32_pd(void)
+void m68k_op_cas_32_pd(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9022,11 +9022,11 @@ void m68k_op_cas_32_pd(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_32_di(void)
+void m68k_op_cas_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9051,11 +9051,11 @@ void m68k_op_cas_32_di(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_32_ix(void)
+void m68k_op_cas_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9080,11 +9080,11 @@ void m68k_op_cas_32_ix(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_32_aw(void)
+void m68k_op_cas_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9109,11 +9109,11 @@ void m68k_op_cas_32_aw(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas_32_al(void)
+void m68k_op_cas_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9138,11 +9138,11 @@ void m68k_op_cas_32_al(void)
 		}
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas2_16(void)
+void m68k_op_cas2_16(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9183,11 +9183,11 @@ void m68k_op_cas2_16(void)
 		*compare2 = BIT_F(word2) ? MAKE_INT_16(dest2) : MASK_OUT_BELOW_16(*compare2) | dest2;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cas2_32(void)
+void m68k_op_cas2_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9228,11 +9228,11 @@ void m68k_op_cas2_32(void)
 		*compare2 = dest2;
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_16_d(void)
+void m68k_op_chk_16_d(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(DY);
@@ -9246,14 +9246,14 @@ void m68k_op_chk_16_d(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_16_ai(void)
+void m68k_op_chk_16_ai(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
-	sint bound = MAKE_INT_16(OPER_AY_AI_16());
+	sint bound = MAKE_INT_16(OPER_AY_AI_16(m68k));
 
 	FLAG_Z = ZFLAG_16(src); /* Undocumented */
 	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9264,14 +9264,14 @@ void m68k_op_chk_16_ai(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_16_pi(void)
+void m68k_op_chk_16_pi(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
-	sint bound = MAKE_INT_16(OPER_AY_PI_16());
+	sint bound = MAKE_INT_16(OPER_AY_PI_16(m68k));
 
 	FLAG_Z = ZFLAG_16(src); /* Undocumented */
 	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9282,14 +9282,14 @@ void m68k_op_chk_16_pi(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_16_pd(void)
+void m68k_op_chk_16_pd(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
-	sint bound = MAKE_INT_16(OPER_AY_PD_16());
+	sint bound = MAKE_INT_16(OPER_AY_PD_16(m68k));
 
 	FLAG_Z = ZFLAG_16(src); /* Undocumented */
 	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9300,14 +9300,14 @@ void m68k_op_chk_16_pd(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_16_di(void)
+void m68k_op_chk_16_di(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
-	sint bound = MAKE_INT_16(OPER_AY_DI_16());
+	sint bound = MAKE_INT_16(OPER_AY_DI_16(m68k));
 
 	FLAG_Z = ZFLAG_16(src); /* Undocumented */
 	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9318,14 +9318,14 @@ void m68k_op_chk_16_di(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_16_ix(void)
+void m68k_op_chk_16_ix(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
-	sint bound = MAKE_INT_16(OPER_AY_IX_16());
+	sint bound = MAKE_INT_16(OPER_AY_IX_16(m68k));
 
 	FLAG_Z = ZFLAG_16(src); /* Undocumented */
 	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9336,14 +9336,14 @@ void m68k_op_chk_16_ix(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_16_aw(void)
+void m68k_op_chk_16_aw(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
-	sint bound = MAKE_INT_16(OPER_AW_16());
+	sint bound = MAKE_INT_16(OPER_AW_16(m68k));
 
 	FLAG_Z = ZFLAG_16(src); /* Undocumented */
 	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9354,14 +9354,14 @@ void m68k_op_chk_16_aw(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_16_al(void)
+void m68k_op_chk_16_al(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
-	sint bound = MAKE_INT_16(OPER_AL_16());
+	sint bound = MAKE_INT_16(OPER_AL_16(m68k));
 
 	FLAG_Z = ZFLAG_16(src); /* Undocumented */
 	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9372,14 +9372,14 @@ void m68k_op_chk_16_al(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_16_pcdi(void)
+void m68k_op_chk_16_pcdi(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
-	sint bound = MAKE_INT_16(OPER_PCDI_16());
+	sint bound = MAKE_INT_16(OPER_PCDI_16(m68k));
 
 	FLAG_Z = ZFLAG_16(src); /* Undocumented */
 	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9390,14 +9390,14 @@ void m68k_op_chk_16_pcdi(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_16_pcix(void)
+void m68k_op_chk_16_pcix(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
-	sint bound = MAKE_INT_16(OPER_PCIX_16());
+	sint bound = MAKE_INT_16(OPER_PCIX_16(m68k));
 
 	FLAG_Z = ZFLAG_16(src); /* Undocumented */
 	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9408,11 +9408,11 @@ void m68k_op_chk_16_pcix(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_16_i(void)
+void m68k_op_chk_16_i(m68ki_cpu_core *m68k)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_I_16());
@@ -9426,11 +9426,11 @@ void m68k_op_chk_16_i(void)
 		return;
 	}
 	FLAG_N = (src < 0)<<7;
-	m68ki_exception_trap(EXCEPTION_CHK);
+	m68ki_exception_trap(m68k, EXCEPTION_CHK);
 }
 
 
-void m68k_op_chk_32_d(void)
+void m68k_op_chk_32_d(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9446,19 +9446,19 @@ void m68k_op_chk_32_d(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_32_ai(void)
+void m68k_op_chk_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
-		sint bound = MAKE_INT_32(OPER_AY_AI_32());
+		sint bound = MAKE_INT_32(OPER_AY_AI_32(m68k));
 
 		FLAG_Z = ZFLAG_32(src); /* Undocumented */
 		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9469,19 +9469,19 @@ void m68k_op_chk_32_ai(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_32_pi(void)
+void m68k_op_chk_32_pi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
-		sint bound = MAKE_INT_32(OPER_AY_PI_32());
+		sint bound = MAKE_INT_32(OPER_AY_PI_32(m68k));
 
 		FLAG_Z = ZFLAG_32(src); /* Undocumented */
 		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9492,19 +9492,19 @@ void m68k_op_chk_32_pi(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_32_pd(void)
+void m68k_op_chk_32_pd(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
-		sint bound = MAKE_INT_32(OPER_AY_PD_32());
+		sint bound = MAKE_INT_32(OPER_AY_PD_32(m68k));
 
 		FLAG_Z = ZFLAG_32(src); /* Undocumented */
 		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9515,19 +9515,19 @@ void m68k_op_chk_32_pd(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_32_di(void)
+void m68k_op_chk_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
-		sint bound = MAKE_INT_32(OPER_AY_DI_32());
+		sint bound = MAKE_INT_32(OPER_AY_DI_32(m68k));
 
 		FLAG_Z = ZFLAG_32(src); /* Undocumented */
 		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9538,19 +9538,19 @@ void m68k_op_chk_32_di(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_32_ix(void)
+void m68k_op_chk_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
-		sint bound = MAKE_INT_32(OPER_AY_IX_32());
+		sint bound = MAKE_INT_32(OPER_AY_IX_32(m68k));
 
 		FLAG_Z = ZFLAG_32(src); /* Undocumented */
 		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9561,19 +9561,19 @@ void m68k_op_chk_32_ix(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_32_aw(void)
+void m68k_op_chk_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
-		sint bound = MAKE_INT_32(OPER_AW_32());
+		sint bound = MAKE_INT_32(OPER_AW_32(m68k));
 
 		FLAG_Z = ZFLAG_32(src); /* Undocumented */
 		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9584,19 +9584,19 @@ void m68k_op_chk_32_aw(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_32_al(void)
+void m68k_op_chk_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
-		sint bound = MAKE_INT_32(OPER_AL_32());
+		sint bound = MAKE_INT_32(OPER_AL_32(m68k));
 
 		FLAG_Z = ZFLAG_32(src); /* Undocumented */
 		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9607,19 +9607,19 @@ void m68k_op_chk_32_al(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_32_pcdi(void)
+void m68k_op_chk_32_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
-		sint bound = MAKE_INT_32(OPER_PCDI_32());
+		sint bound = MAKE_INT_32(OPER_PCDI_32(m68k));
 
 		FLAG_Z = ZFLAG_32(src); /* Undocumented */
 		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9630,19 +9630,19 @@ void m68k_op_chk_32_pcdi(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_32_pcix(void)
+void m68k_op_chk_32_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
-		sint bound = MAKE_INT_32(OPER_PCIX_32());
+		sint bound = MAKE_INT_32(OPER_PCIX_32(m68k));
 
 		FLAG_Z = ZFLAG_32(src); /* Undocumented */
 		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
@@ -9653,14 +9653,14 @@ void m68k_op_chk_32_pcix(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk_32_i(void)
+void m68k_op_chk_32_i(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9676,14 +9676,14 @@ void m68k_op_chk_32_i(void)
 			return;
 		}
 		FLAG_N = (src < 0)<<7;
-		m68ki_exception_trap(EXCEPTION_CHK);
+		m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_8_pcdi(void)
+void m68k_op_chk2cmp2_8_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9701,20 +9701,20 @@ void m68k_op_chk2cmp2_8_pcdi(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_8_pcix(void)
+void m68k_op_chk2cmp2_8_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9732,20 +9732,20 @@ void m68k_op_chk2cmp2_8_pcix(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_8_ai(void)
+void m68k_op_chk2cmp2_8_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9763,20 +9763,20 @@ void m68k_op_chk2cmp2_8_ai(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_8_di(void)
+void m68k_op_chk2cmp2_8_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9794,20 +9794,20 @@ void m68k_op_chk2cmp2_8_di(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_8_ix(void)
+void m68k_op_chk2cmp2_8_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9825,20 +9825,20 @@ void m68k_op_chk2cmp2_8_ix(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_8_aw(void)
+void m68k_op_chk2cmp2_8_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9856,20 +9856,20 @@ void m68k_op_chk2cmp2_8_aw(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_8_al(void)
+void m68k_op_chk2cmp2_8_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9887,20 +9887,20 @@ void m68k_op_chk2cmp2_8_al(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_16_pcdi(void)
+void m68k_op_chk2cmp2_16_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9919,7 +9919,7 @@ void m68k_op_chk2cmp2_16_pcdi(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
@@ -9929,14 +9929,14 @@ void m68k_op_chk2cmp2_16_pcdi(void)
 			FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_16(FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_16_pcix(void)
+void m68k_op_chk2cmp2_16_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9955,7 +9955,7 @@ void m68k_op_chk2cmp2_16_pcix(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
@@ -9965,14 +9965,14 @@ void m68k_op_chk2cmp2_16_pcix(void)
 			FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_16(FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_16_ai(void)
+void m68k_op_chk2cmp2_16_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9992,7 +9992,7 @@ void m68k_op_chk2cmp2_16_ai(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 		if(!BIT_F(word2))
@@ -10002,14 +10002,14 @@ void m68k_op_chk2cmp2_16_ai(void)
 
 		FLAG_C = CFLAG_16(FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_16_di(void)
+void m68k_op_chk2cmp2_16_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10029,7 +10029,7 @@ void m68k_op_chk2cmp2_16_di(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 		if(!BIT_F(word2))
@@ -10039,14 +10039,14 @@ void m68k_op_chk2cmp2_16_di(void)
 
 		FLAG_C = CFLAG_16(FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_16_ix(void)
+void m68k_op_chk2cmp2_16_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10066,7 +10066,7 @@ void m68k_op_chk2cmp2_16_ix(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 		if(!BIT_F(word2))
@@ -10076,14 +10076,14 @@ void m68k_op_chk2cmp2_16_ix(void)
 
 		FLAG_C = CFLAG_16(FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_16_aw(void)
+void m68k_op_chk2cmp2_16_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10103,7 +10103,7 @@ void m68k_op_chk2cmp2_16_aw(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 		if(!BIT_F(word2))
@@ -10113,14 +10113,14 @@ void m68k_op_chk2cmp2_16_aw(void)
 
 		FLAG_C = CFLAG_16(FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_16_al(void)
+void m68k_op_chk2cmp2_16_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10140,7 +10140,7 @@ void m68k_op_chk2cmp2_16_al(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 		if(!BIT_F(word2))
@@ -10150,14 +10150,14 @@ void m68k_op_chk2cmp2_16_al(void)
 
 		FLAG_C = CFLAG_16(FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_32_pcdi(void)
+void m68k_op_chk2cmp2_32_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10173,21 +10173,21 @@ void m68k_op_chk2cmp2_32_pcdi(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_32_pcix(void)
+void m68k_op_chk2cmp2_32_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10203,21 +10203,21 @@ void m68k_op_chk2cmp2_32_pcix(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_32_ai(void)
+void m68k_op_chk2cmp2_32_ai(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10233,21 +10233,21 @@ void m68k_op_chk2cmp2_32_ai(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_32_di(void)
+void m68k_op_chk2cmp2_32_di(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10263,21 +10263,21 @@ void m68k_op_chk2cmp2_32_di(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_32_ix(void)
+void m68k_op_chk2cmp2_32_ix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10293,21 +10293,21 @@ void m68k_op_chk2cmp2_32_ix(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_32_aw(void)
+void m68k_op_chk2cmp2_32_aw(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10323,21 +10323,21 @@ void m68k_op_chk2cmp2_32_aw(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_chk2cmp2_32_al(void)
+void m68k_op_chk2cmp2_32_al(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10353,21 +10353,21 @@ void m68k_op_chk2cmp2_32_al(void)
 		if(COND_CS())
 		{
 			if(BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 			return;
 		}
 
 		FLAG_C = upper_bound - compare;
 		FLAG_C = CFLAG_SUB_32(compare, upper_bound, FLAG_C);
 		if(COND_CS() && BIT_B(word2))
-				m68ki_exception_trap(EXCEPTION_CHK);
+				m68ki_exception_trap(m68k, EXCEPTION_CHK);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_clr_8_d(void)
+void m68k_op_clr_8_d(m68ki_cpu_core *m68k)
 {
 	DY &= 0xffffff00;
 
@@ -10378,7 +10378,7 @@ void m68k_op_clr_8_d(void)
 }
 
 
-void m68k_op_clr_8_ai(void)
+void m68k_op_clr_8_ai(m68ki_cpu_core *m68k)
 {
 	m68ki_write_8(EA_AY_AI_8(), 0);
 
@@ -10389,7 +10389,7 @@ void m68k_op_clr_8_ai(void)
 }
 
 
-void m68k_op_clr_8_pi(void)
+void m68k_op_clr_8_pi(m68ki_cpu_core *m68k)
 {
 	m68ki_write_8(EA_AY_PI_8(), 0);
 
@@ -10400,7 +10400,7 @@ void m68k_op_clr_8_pi(void)
 }
 
 
-void m68k_op_clr_8_pi7(void)
+void m68k_op_clr_8_pi7(m68ki_cpu_core *m68k)
 {
 	m68ki_write_8(EA_A7_PI_8(), 0);
 
@@ -10411,7 +10411,7 @@ void m68k_op_clr_8_pi7(void)
 }
 
 
-void m68k_op_clr_8_pd(void)
+void m68k_op_clr_8_pd(m68ki_cpu_core *m68k)
 {
 	m68ki_write_8(EA_AY_PD_8(), 0);
 
@@ -10422,7 +10422,7 @@ void m68k_op_clr_8_pd(void)
 }
 
 
-void m68k_op_clr_8_pd7(void)
+void m68k_op_clr_8_pd7(m68ki_cpu_core *m68k)
 {
 	m68ki_write_8(EA_A7_PD_8(), 0);
 
@@ -10433,7 +10433,7 @@ void m68k_op_clr_8_pd7(void)
 }
 
 
-void m68k_op_clr_8_di(void)
+void m68k_op_clr_8_di(m68ki_cpu_core *m68k)
 {
 	m68ki_write_8(EA_AY_DI_8(), 0);
 
@@ -10444,7 +10444,7 @@ void m68k_op_clr_8_di(void)
 }
 
 
-void m68k_op_clr_8_ix(void)
+void m68k_op_clr_8_ix(m68ki_cpu_core *m68k)
 {
 	m68ki_write_8(EA_AY_IX_8(), 0);
 
@@ -10455,7 +10455,7 @@ void m68k_op_clr_8_ix(void)
 }
 
 
-void m68k_op_clr_8_aw(void)
+void m68k_op_clr_8_aw(m68ki_cpu_core *m68k)
 {
 	m68ki_write_8(EA_AW_8(), 0);
 
@@ -10466,7 +10466,7 @@ void m68k_op_clr_8_aw(void)
 }
 
 
-void m68k_op_clr_8_al(void)
+void m68k_op_clr_8_al(m68ki_cpu_core *m68k)
 {
 	m68ki_write_8(EA_AL_8(), 0);
 
@@ -10477,7 +10477,7 @@ void m68k_op_clr_8_al(void)
 }
 
 
-void m68k_op_clr_16_d(void)
+void m68k_op_clr_16_d(m68ki_cpu_core *m68k)
 {
 	DY &= 0xffff0000;
 
@@ -10488,7 +10488,7 @@ void m68k_op_clr_16_d(void)
 }
 
 
-void m68k_op_clr_16_ai(void)
+void m68k_op_clr_16_ai(m68ki_cpu_core *m68k)
 {
 	m68ki_write_16(EA_AY_AI_16(), 0);
 
@@ -10499,7 +10499,7 @@ void m68k_op_clr_16_ai(void)
 }
 
 
-void m68k_op_clr_16_pi(void)
+void m68k_op_clr_16_pi(m68ki_cpu_core *m68k)
 {
 	m68ki_write_16(EA_AY_PI_16(), 0);
 
@@ -10510,7 +10510,7 @@ void m68k_op_clr_16_pi(void)
 }
 
 
-void m68k_op_clr_16_pd(void)
+void m68k_op_clr_16_pd(m68ki_cpu_core *m68k)
 {
 	m68ki_write_16(EA_AY_PD_16(), 0);
 
@@ -10521,7 +10521,7 @@ void m68k_op_clr_16_pd(void)
 }
 
 
-void m68k_op_clr_16_di(void)
+void m68k_op_clr_16_di(m68ki_cpu_core *m68k)
 {
 	m68ki_write_16(EA_AY_DI_16(), 0);
 
@@ -10532,7 +10532,7 @@ void m68k_op_clr_16_di(void)
 }
 
 
-void m68k_op_clr_16_ix(void)
+void m68k_op_clr_16_ix(m68ki_cpu_core *m68k)
 {
 	m68ki_write_16(EA_AY_IX_16(), 0);
 
@@ -10543,7 +10543,7 @@ void m68k_op_clr_16_ix(void)
 }
 
 
-void m68k_op_clr_16_aw(void)
+void m68k_op_clr_16_aw(m68ki_cpu_core *m68k)
 {
 	m68ki_write_16(EA_AW_16(), 0);
 
@@ -10554,7 +10554,7 @@ void m68k_op_clr_16_aw(void)
 }
 
 
-void m68k_op_clr_16_al(void)
+void m68k_op_clr_16_al(m68ki_cpu_core *m68k)
 {
 	m68ki_write_16(EA_AL_16(), 0);
 
@@ -10565,7 +10565,7 @@ void m68k_op_clr_16_al(void)
 }
 
 
-void m68k_op_clr_32_d(void)
+void m68k_op_clr_32_d(m68ki_cpu_core *m68k)
 {
 	DY = 0;
 
@@ -10576,7 +10576,7 @@ void m68k_op_clr_32_d(void)
 }
 
 
-void m68k_op_clr_32_ai(void)
+void m68k_op_clr_32_ai(m68ki_cpu_core *m68k)
 {
 	m68ki_write_32(EA_AY_AI_32(), 0);
 
@@ -10587,7 +10587,7 @@ void m68k_op_clr_32_ai(void)
 }
 
 
-void m68k_op_clr_32_pi(void)
+void m68k_op_clr_32_pi(m68ki_cpu_core *m68k)
 {
 	m68ki_write_32(EA_AY_PI_32(), 0);
 
@@ -10598,7 +10598,7 @@ void m68k_op_clr_32_pi(void)
 }
 
 
-void m68k_op_clr_32_pd(void)
+void m68k_op_clr_32_pd(m68ki_cpu_core *m68k)
 {
 	m68ki_write_32(EA_AY_PD_32(), 0);
 
@@ -10609,7 +10609,7 @@ void m68k_op_clr_32_pd(void)
 }
 
 
-void m68k_op_clr_32_di(void)
+void m68k_op_clr_32_di(m68ki_cpu_core *m68k)
 {
 	m68ki_write_32(EA_AY_DI_32(), 0);
 
@@ -10620,7 +10620,7 @@ void m68k_op_clr_32_di(void)
 }
 
 
-void m68k_op_clr_32_ix(void)
+void m68k_op_clr_32_ix(m68ki_cpu_core *m68k)
 {
 	m68ki_write_32(EA_AY_IX_32(), 0);
 
@@ -10631,7 +10631,7 @@ void m68k_op_clr_32_ix(void)
 }
 
 
-void m68k_op_clr_32_aw(void)
+void m68k_op_clr_32_aw(m68ki_cpu_core *m68k)
 {
 	m68ki_write_32(EA_AW_32(), 0);
 
@@ -10642,7 +10642,7 @@ void m68k_op_clr_32_aw(void)
 }
 
 
-void m68k_op_clr_32_al(void)
+void m68k_op_clr_32_al(m68ki_cpu_core *m68k)
 {
 	m68ki_write_32(EA_AL_32(), 0);
 
@@ -10653,7 +10653,7 @@ void m68k_op_clr_32_al(void)
 }
 
 
-void m68k_op_cmp_8_d(void)
+void m68k_op_cmp_8_d(m68ki_cpu_core *m68k)
 {
 	uint src = MASK_OUT_ABOVE_8(DY);
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10666,9 +10666,9 @@ void m68k_op_cmp_8_d(void)
 }
 
 
-void m68k_op_cmp_8_ai(void)
+void m68k_op_cmp_8_ai(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_AI_8();
+	uint src = OPER_AY_AI_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10679,9 +10679,9 @@ void m68k_op_cmp_8_ai(void)
 }
 
 
-void m68k_op_cmp_8_pi(void)
+void m68k_op_cmp_8_pi(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PI_8();
+	uint src = OPER_AY_PI_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10692,9 +10692,9 @@ void m68k_op_cmp_8_pi(void)
 }
 
 
-void m68k_op_cmp_8_pi7(void)
+void m68k_op_cmp_8_pi7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_A7_PI_8();
+	uint src = OPER_A7_PI_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10705,9 +10705,9 @@ void m68k_op_cmp_8_pi7(void)
 }
 
 
-void m68k_op_cmp_8_pd(void)
+void m68k_op_cmp_8_pd(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PD_8();
+	uint src = OPER_AY_PD_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10718,9 +10718,9 @@ void m68k_op_cmp_8_pd(void)
 }
 
 
-void m68k_op_cmp_8_pd7(void)
+void m68k_op_cmp_8_pd7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_A7_PD_8();
+	uint src = OPER_A7_PD_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10731,9 +10731,9 @@ void m68k_op_cmp_8_pd7(void)
 }
 
 
-void m68k_op_cmp_8_di(void)
+void m68k_op_cmp_8_di(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_DI_8();
+	uint src = OPER_AY_DI_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10744,9 +10744,9 @@ void m68k_op_cmp_8_di(void)
 }
 
 
-void m68k_op_cmp_8_ix(void)
+void m68k_op_cmp_8_ix(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_IX_8();
+	uint src = OPER_AY_IX_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10757,9 +10757,9 @@ void m68k_op_cmp_8_ix(void)
 }
 
 
-void m68k_op_cmp_8_aw(void)
+void m68k_op_cmp_8_aw(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AW_8();
+	uint src = OPER_AW_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10770,9 +10770,9 @@ void m68k_op_cmp_8_aw(void)
 }
 
 
-void m68k_op_cmp_8_al(void)
+void m68k_op_cmp_8_al(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AL_8();
+	uint src = OPER_AL_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10783,9 +10783,9 @@ void m68k_op_cmp_8_al(void)
 }
 
 
-void m68k_op_cmp_8_pcdi(void)
+void m68k_op_cmp_8_pcdi(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_PCDI_8();
+	uint src = OPER_PCDI_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10796,9 +10796,9 @@ void m68k_op_cmp_8_pcdi(void)
 }
 
 
-void m68k_op_cmp_8_pcix(void)
+void m68k_op_cmp_8_pcix(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_PCIX_8();
+	uint src = OPER_PCIX_8(m68k);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
 
@@ -10809,7 +10809,7 @@ void m68k_op_cmp_8_pcix(void)
 }
 
 
-void m68k_op_cmp_8_i(void)
+void m68k_op_cmp_8_i(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10822,7 +10822,7 @@ void m68k_op_cmp_8_i(void)
 }
 
 
-void m68k_op_cmp_16_d(void)
+void m68k_op_cmp_16_d(m68ki_cpu_core *m68k)
 {
 	uint src = MASK_OUT_ABOVE_16(DY);
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10835,7 +10835,7 @@ void m68k_op_cmp_16_d(void)
 }
 
 
-void m68k_op_cmp_16_a(void)
+void m68k_op_cmp_16_a(m68ki_cpu_core *m68k)
 {
 	uint src = MASK_OUT_ABOVE_16(AY);
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10848,9 +10848,9 @@ void m68k_op_cmp_16_a(void)
 }
 
 
-void m68k_op_cmp_16_ai(void)
+void m68k_op_cmp_16_ai(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_AI_16();
+	uint src = OPER_AY_AI_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
@@ -10861,9 +10861,9 @@ void m68k_op_cmp_16_ai(void)
 }
 
 
-void m68k_op_cmp_16_pi(void)
+void m68k_op_cmp_16_pi(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PI_16();
+	uint src = OPER_AY_PI_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
@@ -10874,9 +10874,9 @@ void m68k_op_cmp_16_pi(void)
 }
 
 
-void m68k_op_cmp_16_pd(void)
+void m68k_op_cmp_16_pd(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PD_16();
+	uint src = OPER_AY_PD_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
@@ -10887,9 +10887,9 @@ void m68k_op_cmp_16_pd(void)
 }
 
 
-void m68k_op_cmp_16_di(void)
+void m68k_op_cmp_16_di(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_DI_16();
+	uint src = OPER_AY_DI_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
@@ -10900,9 +10900,9 @@ void m68k_op_cmp_16_di(void)
 }
 
 
-void m68k_op_cmp_16_ix(void)
+void m68k_op_cmp_16_ix(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_IX_16();
+	uint src = OPER_AY_IX_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
@@ -10913,9 +10913,9 @@ void m68k_op_cmp_16_ix(void)
 }
 
 
-void m68k_op_cmp_16_aw(void)
+void m68k_op_cmp_16_aw(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AW_16();
+	uint src = OPER_AW_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
@@ -10926,9 +10926,9 @@ void m68k_op_cmp_16_aw(void)
 }
 
 
-void m68k_op_cmp_16_al(void)
+void m68k_op_cmp_16_al(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AL_16();
+	uint src = OPER_AL_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
@@ -10939,9 +10939,9 @@ void m68k_op_cmp_16_al(void)
 }
 
 
-void m68k_op_cmp_16_pcdi(void)
+void m68k_op_cmp_16_pcdi(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_PCDI_16();
+	uint src = OPER_PCDI_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
@@ -10952,9 +10952,9 @@ void m68k_op_cmp_16_pcdi(void)
 }
 
 
-void m68k_op_cmp_16_pcix(void)
+void m68k_op_cmp_16_pcix(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_PCIX_16();
+	uint src = OPER_PCIX_16(m68k);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
 
@@ -10965,7 +10965,7 @@ void m68k_op_cmp_16_pcix(void)
 }
 
 
-void m68k_op_cmp_16_i(void)
+void m68k_op_cmp_16_i(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10978,7 +10978,7 @@ void m68k_op_cmp_16_i(void)
 }
 
 
-void m68k_op_cmp_32_d(void)
+void m68k_op_cmp_32_d(m68ki_cpu_core *m68k)
 {
 	uint src = DY;
 	uint dst = DX;
@@ -10991,7 +10991,7 @@ void m68k_op_cmp_32_d(void)
 }
 
 
-void m68k_op_cmp_32_a(void)
+void m68k_op_cmp_32_a(m68ki_cpu_core *m68k)
 {
 	uint src = AY;
 	uint dst = DX;
@@ -11004,9 +11004,9 @@ void m68k_op_cmp_32_a(void)
 }
 
 
-void m68k_op_cmp_32_ai(void)
+void m68k_op_cmp_32_ai(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_AI_32();
+	uint src = OPER_AY_AI_32(m68k);
 	uint dst = DX;
 	uint res = dst - src;
 
@@ -11017,9 +11017,9 @@ void m68k_op_cmp_32_ai(void)
 }
 
 
-void m68k_op_cmp_32_pi(void)
+void m68k_op_cmp_32_pi(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PI_32();
+	uint src = OPER_AY_PI_32(m68k);
 	uint dst = DX;
 	uint res = dst - src;
 
@@ -11030,9 +11030,9 @@ void m68k_op_cmp_32_pi(void)
 }
 
 
-void m68k_op_cmp_32_pd(void)
+void m68k_op_cmp_32_pd(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PD_32();
+	uint src = OPER_AY_PD_32(m68k);
 	uint dst = DX;
 	uint res = dst - src;
 
@@ -11043,9 +11043,9 @@ void m68k_op_cmp_32_pd(void)
 }
 
 
-void m68k_op_cmp_32_di(void)
+void m68k_op_cmp_32_di(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_DI_32();
+	uint src = OPER_AY_DI_32(m68k);
 	uint dst = DX;
 	uint res = dst - src;
 
@@ -11056,9 +11056,9 @@ void m68k_op_cmp_32_di(void)
 }
 
 
-void m68k_op_cmp_32_ix(void)
+void m68k_op_cmp_32_ix(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_IX_32();
+	uint src = OPER_AY_IX_32(m68k);
 	uint dst = DX;
 	uint res = dst - src;
 
@@ -11069,9 +11069,9 @@ void m68k_op_cmp_32_ix(void)
 }
 
 
-void m68k_op_cmp_32_aw(void)
+void m68k_op_cmp_32_aw(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AW_32();
+	uint src = OPER_AW_32(m68k);
 	uint dst = DX;
 	uint res = dst - src;
 
@@ -11082,9 +11082,9 @@ void m68k_op_cmp_32_aw(void)
 }
 
 
-void m68k_op_cmp_32_al(void)
+void m68k_op_cmp_32_al(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AL_32();
+	uint src = OPER_AL_32(m68k);
 	uint dst = DX;
 	uint res = dst - src;
 
@@ -11095,9 +11095,9 @@ void m68k_op_cmp_32_al(void)
 }
 
 
-void m68k_op_cmp_32_pcdi(void)
+void m68k_op_cmp_32_pcdi(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_PCDI_32();
+	uint src = OPER_PCDI_32(m68k);
 	uint dst = DX;
 	uint res = dst - src;
 
@@ -11108,9 +11108,9 @@ void m68k_op_cmp_32_pcdi(void)
 }
 
 
-void m68k_op_cmp_32_pcix(void)
+void m68k_op_cmp_32_pcix(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_PCIX_32();
+	uint src = OPER_PCIX_32(m68k);
 	uint dst = DX;
 	uint res = dst - src;
 
@@ -11121,7 +11121,7 @@ void m68k_op_cmp_32_pcix(void)
 }
 
 
-void m68k_op_cmp_32_i(void)
+void m68k_op_cmp_32_i(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint dst = DX;
@@ -11134,7 +11134,7 @@ void m68k_op_cmp_32_i(void)
 }
 
 
-void m68k_op_cmpa_16_d(void)
+void m68k_op_cmpa_16_d(m68ki_cpu_core *m68k)
 {
 	uint src = MAKE_INT_16(DY);
 	uint dst = AX;
@@ -11147,7 +11147,7 @@ void m68k_op_cmpa_16_d(void)
 }
 
 
-void m68k_op_cmpa_16_a(void)
+void m68k_op_cmpa_16_a(m68ki_cpu_core *m68k)
 {
 	uint src = MAKE_INT_16(AY);
 	uint dst = AX;
@@ -11160,9 +11160,9 @@ void m68k_op_cmpa_16_a(void)
 }
 
 
-void m68k_op_cmpa_16_ai(void)
+void m68k_op_cmpa_16_ai(m68ki_cpu_core *m68k)
 {
-	uint src = MAKE_INT_16(OPER_AY_AI_16());
+	uint src = MAKE_INT_16(OPER_AY_AI_16(m68k));
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11173,9 +11173,9 @@ void m68k_op_cmpa_16_ai(void)
 }
 
 
-void m68k_op_cmpa_16_pi(void)
+void m68k_op_cmpa_16_pi(m68ki_cpu_core *m68k)
 {
-	uint src = MAKE_INT_16(OPER_AY_PI_16());
+	uint src = MAKE_INT_16(OPER_AY_PI_16(m68k));
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11186,9 +11186,9 @@ void m68k_op_cmpa_16_pi(void)
 }
 
 
-void m68k_op_cmpa_16_pd(void)
+void m68k_op_cmpa_16_pd(m68ki_cpu_core *m68k)
 {
-	uint src = MAKE_INT_16(OPER_AY_PD_16());
+	uint src = MAKE_INT_16(OPER_AY_PD_16(m68k));
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11199,9 +11199,9 @@ void m68k_op_cmpa_16_pd(void)
 }
 
 
-void m68k_op_cmpa_16_di(void)
+void m68k_op_cmpa_16_di(m68ki_cpu_core *m68k)
 {
-	uint src = MAKE_INT_16(OPER_AY_DI_16());
+	uint src = MAKE_INT_16(OPER_AY_DI_16(m68k));
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11212,9 +11212,9 @@ void m68k_op_cmpa_16_di(void)
 }
 
 
-void m68k_op_cmpa_16_ix(void)
+void m68k_op_cmpa_16_ix(m68ki_cpu_core *m68k)
 {
-	uint src = MAKE_INT_16(OPER_AY_IX_16());
+	uint src = MAKE_INT_16(OPER_AY_IX_16(m68k));
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11225,9 +11225,9 @@ void m68k_op_cmpa_16_ix(void)
 }
 
 
-void m68k_op_cmpa_16_aw(void)
+void m68k_op_cmpa_16_aw(m68ki_cpu_core *m68k)
 {
-	uint src = MAKE_INT_16(OPER_AW_16());
+	uint src = MAKE_INT_16(OPER_AW_16(m68k));
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11238,9 +11238,9 @@ void m68k_op_cmpa_16_aw(void)
 }
 
 
-void m68k_op_cmpa_16_al(void)
+void m68k_op_cmpa_16_al(m68ki_cpu_core *m68k)
 {
-	uint src = MAKE_INT_16(OPER_AL_16());
+	uint src = MAKE_INT_16(OPER_AL_16(m68k));
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11251,9 +11251,9 @@ void m68k_op_cmpa_16_al(void)
 }
 
 
-void m68k_op_cmpa_16_pcdi(void)
+void m68k_op_cmpa_16_pcdi(m68ki_cpu_core *m68k)
 {
-	uint src = MAKE_INT_16(OPER_PCDI_16());
+	uint src = MAKE_INT_16(OPER_PCDI_16(m68k));
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11264,9 +11264,9 @@ void m68k_op_cmpa_16_pcdi(void)
 }
 
 
-void m68k_op_cmpa_16_pcix(void)
+void m68k_op_cmpa_16_pcix(m68ki_cpu_core *m68k)
 {
-	uint src = MAKE_INT_16(OPER_PCIX_16());
+	uint src = MAKE_INT_16(OPER_PCIX_16(m68k));
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11277,7 +11277,7 @@ void m68k_op_cmpa_16_pcix(void)
 }
 
 
-void m68k_op_cmpa_16_i(void)
+void m68k_op_cmpa_16_i(m68ki_cpu_core *m68k)
 {
 	uint src = MAKE_INT_16(OPER_I_16());
 	uint dst = AX;
@@ -11290,7 +11290,7 @@ void m68k_op_cmpa_16_i(void)
 }
 
 
-void m68k_op_cmpa_32_d(void)
+void m68k_op_cmpa_32_d(m68ki_cpu_core *m68k)
 {
 	uint src = DY;
 	uint dst = AX;
@@ -11303,7 +11303,7 @@ void m68k_op_cmpa_32_d(void)
 }
 
 
-void m68k_op_cmpa_32_a(void)
+void m68k_op_cmpa_32_a(m68ki_cpu_core *m68k)
 {
 	uint src = AY;
 	uint dst = AX;
@@ -11316,9 +11316,9 @@ void m68k_op_cmpa_32_a(void)
 }
 
 
-void m68k_op_cmpa_32_ai(void)
+void m68k_op_cmpa_32_ai(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_AI_32();
+	uint src = OPER_AY_AI_32(m68k);
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11329,9 +11329,9 @@ void m68k_op_cmpa_32_ai(void)
 }
 
 
-void m68k_op_cmpa_32_pi(void)
+void m68k_op_cmpa_32_pi(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PI_32();
+	uint src = OPER_AY_PI_32(m68k);
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11342,9 +11342,9 @@ void m68k_op_cmpa_32_pi(void)
 }
 
 
-void m68k_op_cmpa_32_pd(void)
+void m68k_op_cmpa_32_pd(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PD_32();
+	uint src = OPER_AY_PD_32(m68k);
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11355,9 +11355,9 @@ void m68k_op_cmpa_32_pd(void)
 }
 
 
-void m68k_op_cmpa_32_di(void)
+void m68k_op_cmpa_32_di(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_DI_32();
+	uint src = OPER_AY_DI_32(m68k);
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11368,9 +11368,9 @@ void m68k_op_cmpa_32_di(void)
 }
 
 
-void m68k_op_cmpa_32_ix(void)
+void m68k_op_cmpa_32_ix(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_IX_32();
+	uint src = OPER_AY_IX_32(m68k);
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11381,9 +11381,9 @@ void m68k_op_cmpa_32_ix(void)
 }
 
 
-void m68k_op_cmpa_32_aw(void)
+void m68k_op_cmpa_32_aw(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AW_32();
+	uint src = OPER_AW_32(m68k);
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11394,9 +11394,9 @@ void m68k_op_cmpa_32_aw(void)
 }
 
 
-void m68k_op_cmpa_32_al(void)
+void m68k_op_cmpa_32_al(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AL_32();
+	uint src = OPER_AL_32(m68k);
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11407,9 +11407,9 @@ void m68k_op_cmpa_32_al(void)
 }
 
 
-void m68k_op_cmpa_32_pcdi(void)
+void m68k_op_cmpa_32_pcdi(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_PCDI_32();
+	uint src = OPER_PCDI_32(m68k);
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11420,9 +11420,9 @@ void m68k_op_cmpa_32_pcdi(void)
 }
 
 
-void m68k_op_cmpa_32_pcix(void)
+void m68k_op_cmpa_32_pcix(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_PCIX_32();
+	uint src = OPER_PCIX_32(m68k);
 	uint dst = AX;
 	uint res = dst - src;
 
@@ -11433,7 +11433,7 @@ void m68k_op_cmpa_32_pcix(void)
 }
 
 
-void m68k_op_cmpa_32_i(void)
+void m68k_op_cmpa_32_i(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint dst = AX;
@@ -11446,7 +11446,7 @@ void m68k_op_cmpa_32_i(void)
 }
 
 
-void m68k_op_cmpi_8_d(void)
+void m68k_op_cmpi_8_d(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
 	uint dst = MASK_OUT_ABOVE_8(DY);
@@ -11459,10 +11459,10 @@ void m68k_op_cmpi_8_d(void)
 }
 
 
-void m68k_op_cmpi_8_ai(void)
+void m68k_op_cmpi_8_ai(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
-	uint dst = OPER_AY_AI_8();
+	uint dst = OPER_AY_AI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11472,10 +11472,10 @@ void m68k_op_cmpi_8_ai(void)
 }
 
 
-void m68k_op_cmpi_8_pi(void)
+void m68k_op_cmpi_8_pi(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
-	uint dst = OPER_AY_PI_8();
+	uint dst = OPER_AY_PI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11485,10 +11485,10 @@ void m68k_op_cmpi_8_pi(void)
 }
 
 
-void m68k_op_cmpi_8_pi7(void)
+void m68k_op_cmpi_8_pi7(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
-	uint dst = OPER_A7_PI_8();
+	uint dst = OPER_A7_PI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11498,10 +11498,10 @@ void m68k_op_cmpi_8_pi7(void)
 }
 
 
-void m68k_op_cmpi_8_pd(void)
+void m68k_op_cmpi_8_pd(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
-	uint dst = OPER_AY_PD_8();
+	uint dst = OPER_AY_PD_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11511,10 +11511,10 @@ void m68k_op_cmpi_8_pd(void)
 }
 
 
-void m68k_op_cmpi_8_pd7(void)
+void m68k_op_cmpi_8_pd7(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
-	uint dst = OPER_A7_PD_8();
+	uint dst = OPER_A7_PD_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11524,10 +11524,10 @@ void m68k_op_cmpi_8_pd7(void)
 }
 
 
-void m68k_op_cmpi_8_di(void)
+void m68k_op_cmpi_8_di(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
-	uint dst = OPER_AY_DI_8();
+	uint dst = OPER_AY_DI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11537,10 +11537,10 @@ void m68k_op_cmpi_8_di(void)
 }
 
 
-void m68k_op_cmpi_8_ix(void)
+void m68k_op_cmpi_8_ix(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
-	uint dst = OPER_AY_IX_8();
+	uint dst = OPER_AY_IX_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11550,10 +11550,10 @@ void m68k_op_cmpi_8_ix(void)
 }
 
 
-void m68k_op_cmpi_8_aw(void)
+void m68k_op_cmpi_8_aw(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
-	uint dst = OPER_AW_8();
+	uint dst = OPER_AW_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11563,10 +11563,10 @@ void m68k_op_cmpi_8_aw(void)
 }
 
 
-void m68k_op_cmpi_8_al(void)
+void m68k_op_cmpi_8_al(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_8();
-	uint dst = OPER_AL_8();
+	uint dst = OPER_AL_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11576,12 +11576,12 @@ void m68k_op_cmpi_8_al(void)
 }
 
 
-void m68k_op_cmpi_8_pcdi(void)
+void m68k_op_cmpi_8_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_8();
-		uint dst = OPER_PCDI_8();
+		uint dst = OPER_PCDI_8(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_8(res);
@@ -11590,16 +11590,16 @@ void m68k_op_cmpi_8_pcdi(void)
 		FLAG_C = CFLAG_8(res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cmpi_8_pcix(void)
+void m68k_op_cmpi_8_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_8();
-		uint dst = OPER_PCIX_8();
+		uint dst = OPER_PCIX_8(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_8(res);
@@ -11608,11 +11608,11 @@ void m68k_op_cmpi_8_pcix(void)
 		FLAG_C = CFLAG_8(res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cmpi_16_d(void)
+void m68k_op_cmpi_16_d(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
 	uint dst = MASK_OUT_ABOVE_16(DY);
@@ -11625,10 +11625,10 @@ void m68k_op_cmpi_16_d(void)
 }
 
 
-void m68k_op_cmpi_16_ai(void)
+void m68k_op_cmpi_16_ai(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
-	uint dst = OPER_AY_AI_16();
+	uint dst = OPER_AY_AI_16(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
@@ -11638,10 +11638,10 @@ void m68k_op_cmpi_16_ai(void)
 }
 
 
-void m68k_op_cmpi_16_pi(void)
+void m68k_op_cmpi_16_pi(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
-	uint dst = OPER_AY_PI_16();
+	uint dst = OPER_AY_PI_16(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
@@ -11651,10 +11651,10 @@ void m68k_op_cmpi_16_pi(void)
 }
 
 
-void m68k_op_cmpi_16_pd(void)
+void m68k_op_cmpi_16_pd(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
-	uint dst = OPER_AY_PD_16();
+	uint dst = OPER_AY_PD_16(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
@@ -11664,10 +11664,10 @@ void m68k_op_cmpi_16_pd(void)
 }
 
 
-void m68k_op_cmpi_16_di(void)
+void m68k_op_cmpi_16_di(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
-	uint dst = OPER_AY_DI_16();
+	uint dst = OPER_AY_DI_16(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
@@ -11677,10 +11677,10 @@ void m68k_op_cmpi_16_di(void)
 }
 
 
-void m68k_op_cmpi_16_ix(void)
+void m68k_op_cmpi_16_ix(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
-	uint dst = OPER_AY_IX_16();
+	uint dst = OPER_AY_IX_16(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
@@ -11690,10 +11690,10 @@ void m68k_op_cmpi_16_ix(void)
 }
 
 
-void m68k_op_cmpi_16_aw(void)
+void m68k_op_cmpi_16_aw(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
-	uint dst = OPER_AW_16();
+	uint dst = OPER_AW_16(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
@@ -11703,10 +11703,10 @@ void m68k_op_cmpi_16_aw(void)
 }
 
 
-void m68k_op_cmpi_16_al(void)
+void m68k_op_cmpi_16_al(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_16();
-	uint dst = OPER_AL_16();
+	uint dst = OPER_AL_16(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
@@ -11716,12 +11716,12 @@ void m68k_op_cmpi_16_al(void)
 }
 
 
-void m68k_op_cmpi_16_pcdi(void)
+void m68k_op_cmpi_16_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_16();
-		uint dst = OPER_PCDI_16();
+		uint dst = OPER_PCDI_16(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_16(res);
@@ -11730,16 +11730,16 @@ void m68k_op_cmpi_16_pcdi(void)
 		FLAG_C = CFLAG_16(res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cmpi_16_pcix(void)
+void m68k_op_cmpi_16_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_16();
-		uint dst = OPER_PCIX_16();
+		uint dst = OPER_PCIX_16(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_16(res);
@@ -11748,11 +11748,11 @@ void m68k_op_cmpi_16_pcix(void)
 		FLAG_C = CFLAG_16(res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cmpi_32_d(void)
+void m68k_op_cmpi_32_d(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
 	uint dst = DY;
@@ -11765,10 +11765,10 @@ void m68k_op_cmpi_32_d(void)
 }
 
 
-void m68k_op_cmpi_32_ai(void)
+void m68k_op_cmpi_32_ai(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
-	uint dst = OPER_AY_AI_32();
+	uint dst = OPER_AY_AI_32(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
@@ -11778,10 +11778,10 @@ void m68k_op_cmpi_32_ai(void)
 }
 
 
-void m68k_op_cmpi_32_pi(void)
+void m68k_op_cmpi_32_pi(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
-	uint dst = OPER_AY_PI_32();
+	uint dst = OPER_AY_PI_32(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
@@ -11791,10 +11791,10 @@ void m68k_op_cmpi_32_pi(void)
 }
 
 
-void m68k_op_cmpi_32_pd(void)
+void m68k_op_cmpi_32_pd(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
-	uint dst = OPER_AY_PD_32();
+	uint dst = OPER_AY_PD_32(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
@@ -11804,10 +11804,10 @@ void m68k_op_cmpi_32_pd(void)
 }
 
 
-void m68k_op_cmpi_32_di(void)
+void m68k_op_cmpi_32_di(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
-	uint dst = OPER_AY_DI_32();
+	uint dst = OPER_AY_DI_32(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
@@ -11817,10 +11817,10 @@ void m68k_op_cmpi_32_di(void)
 }
 
 
-void m68k_op_cmpi_32_ix(void)
+void m68k_op_cmpi_32_ix(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
-	uint dst = OPER_AY_IX_32();
+	uint dst = OPER_AY_IX_32(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
@@ -11830,10 +11830,10 @@ void m68k_op_cmpi_32_ix(void)
 }
 
 
-void m68k_op_cmpi_32_aw(void)
+void m68k_op_cmpi_32_aw(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
-	uint dst = OPER_AW_32();
+	uint dst = OPER_AW_32(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
@@ -11843,10 +11843,10 @@ void m68k_op_cmpi_32_aw(void)
 }
 
 
-void m68k_op_cmpi_32_al(void)
+void m68k_op_cmpi_32_al(m68ki_cpu_core *m68k)
 {
 	uint src = OPER_I_32();
-	uint dst = OPER_AL_32();
+	uint dst = OPER_AL_32(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
@@ -11856,12 +11856,12 @@ void m68k_op_cmpi_32_al(void)
 }
 
 
-void m68k_op_cmpi_32_pcdi(void)
+void m68k_op_cmpi_32_pcdi(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_32();
-		uint dst = OPER_PCDI_32();
+		uint dst = OPER_PCDI_32(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_32(res);
@@ -11870,16 +11870,16 @@ void m68k_op_cmpi_32_pcdi(void)
 		FLAG_C = CFLAG_SUB_32(src, dst, res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cmpi_32_pcix(void)
+void m68k_op_cmpi_32_pcix(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_32();
-		uint dst = OPER_PCIX_32();
+		uint dst = OPER_PCIX_32(m68k);
 		uint res = dst - src;
 
 		FLAG_N = NFLAG_32(res);
@@ -11888,14 +11888,14 @@ void m68k_op_cmpi_32_pcix(void)
 		FLAG_C = CFLAG_SUB_32(src, dst, res);
 		return;
 	}
-	m68ki_exception_illegal();
+	m68ki_exception_illegal(m68k);
 }
 
 
-void m68k_op_cmpm_8_ax7(void)
+void m68k_op_cmpm_8_ax7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PI_8();
-	uint dst = OPER_A7_PI_8();
+	uint src = OPER_AY_PI_8(m68k);
+	uint dst = OPER_A7_PI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11905,10 +11905,10 @@ void m68k_op_cmpm_8_ax7(void)
 }
 
 
-void m68k_op_cmpm_8_ay7(void)
+void m68k_op_cmpm_8_ay7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_A7_PI_8();
-	uint dst = OPER_AX_PI_8();
+	uint src = OPER_A7_PI_8(m68k);
+	uint dst = OPER_AX_PI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11918,10 +11918,10 @@ void m68k_op_cmpm_8_ay7(void)
 }
 
 
-void m68k_op_cmpm_8_axy7(void)
+void m68k_op_cmpm_8_axy7(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_A7_PI_8();
-	uint dst = OPER_A7_PI_8();
+	uint src = OPER_A7_PI_8(m68k);
+	uint dst = OPER_A7_PI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11931,10 +11931,10 @@ void m68k_op_cmpm_8_axy7(void)
 }
 
 
-void m68k_op_cmpm_8(void)
+void m68k_op_cmpm_8(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PI_8();
-	uint dst = OPER_AX_PI_8();
+	uint src = OPER_AY_PI_8(m68k);
+	uint dst = OPER_AX_PI_8(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
@@ -11944,10 +11944,10 @@ void m68k_op_cmpm_8(void)
 }
 
 
-void m68k_op_cmpm_16(void)
+void m68k_op_cmpm_16(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PI_16();
-	uint dst = OPER_AX_PI_16();
+	uint src = OPER_AY_PI_16(m68k);
+	uint dst = OPER_AX_PI_16(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
@@ -11957,10 +11957,10 @@ void m68k_op_cmpm_16(void)
 }
 
 
-void m68k_op_cmpm_32(void)
+void m68k_op_cmpm_32(m68ki_cpu_core *m68k)
 {
-	uint src = OPER_AY_PI_32();
-	uint dst = OPER_AX_PI_32();
+	uint src = OPER_AY_PI_32(m68k);
+	uint dst = OPER_AX_PI_32(m68k);
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
@@ -11970,7 +11970,7 @@ void m68k_op_cmpm_32(void)
 }
 
 
-void m68k_op_cpbcc_32(void)
+void m68k_op_cpbcc_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11979,11 +11979,11 @@ void m68k_op_cpbcc_32(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
-void m68k_op_cpdbcc_32(void)
+void m68k_op_cpdbcc_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11992,11 +11992,11 @@ void m68k_op_cpdbcc_32(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
-void m68k_op_cpgen_32(void)
+void m68k_op_cpgen_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -12005,11 +12005,11 @@ void m68k_op_cpgen_32(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
-void m68k_op_cpscc_32(void)
+void m68k_op_cpscc_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -12018,11 +12018,11 @@ void m68k_op_cpscc_32(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
-void m68k_op_cptrapcc_32(void)
+void m68k_op_cptrapcc_32(m68ki_cpu_core *m68k)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -12031,7 +12031,7 @@ void m68k_op_cptrapcc_32(void)
 					 m68k_disassemble_quick(ADDRESS_68K(REG_PC - 2))));
 		return;
 	}
-	m68ki_exception_1111();
+	m68ki_exception_1111(m68k);
 }
 
 
@@ -1,9 +1,18 @@
 #ifndef _SAT_HW_H_
 #define _SAT_HW_H_
 
-extern uint8 sat_ram[512*1024];
+#include "m68k.h"
 
-void sat_hw_init(void);
+// Saturn sound board: the 68000, the SCSP and the RAM they share
+struct sat_hw
+{
+	uint8 sat_ram[512*1024];
+	m68ki_cpu_core *cpu;
+	void *scsp;
+};
+
+void sat_hw_init(struct sat_hw *hw);
+void sat_hw_free(struct sat_hw *hw);
 
 #if !LSB_FIRST
 static unsigned short INLINE mem_readword_swap(unsigned short *addr)
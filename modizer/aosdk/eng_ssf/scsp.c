@@ -107,8 +107,6 @@ static const t_double DRTimes[64]={100000/*infinity*/,100000/*infinity*/,118200.
 					14800.0,12700.0,11100.0,8900.0,7400.0,6300.0,5500.0,4400.0,3700.0,3200.0,2800.0,2200.0,1800.0,1600.0,1400.0,1100.0,
 					920.0,790.0,690.0,550.0,460.0,390.0,340.0,270.0,230.0,200.0,170.0,140.0,110.0,98.0,85.0,68.0,57.0,49.0,43.0,34.0,
 					28.0,25.0,22.0,18.0,14.0,12.0,11.0,8.5,7.1,6.1,5.4,4.3,3.6,3.1};
-static UINT32 FNS_Table[0x400];
-static INT32 EG_TABLE[0x400];
 
 typedef enum {ATTACK,DECAY1,DECAY2,RELEASE} _STATE;
 struct _EG
@@ -191,7 +189,8 @@ struct _SCSP
 	unsigned char *SCSPRAM;
 	UINT32 SCSPRAM_LENGTH;
 	char Master;
-	void (*Int68kCB)(int irq);
+	void (*Int68kCB)(void *param, int irq);
+	void *Int68kCBParam;
 
 	INT32 *buffertmpl, *buffertmpr;
 
@@ -216,11 +215,16 @@ struct _SCSP
 
 	int ARTABLE[64], DRTABLE[64];
 
+	UINT32 FNS_Table[0x400];
+	INT32 EG_TABLE[0x400];
+	struct _LFOTABLES LFOTABLES;
+
+	INT16 *bufferl, *bufferr;
+	signed short *RBUFDST;	//this points to where the sample will be stored in the RingBuf
+
 	struct _SCSPDSP DSP;
 };
 
-static struct _SCSP *AllocedSCSP;
-
 static void dma_scsp(struct _SCSP *SCSP); 		/*SCSP DMA transfer function*/
 #define	scsp_dgate		scsp_regs[0x16/2] & 0x4000
 #define	scsp_ddir		scsp_regs[0x16/2] & 0x2000
@@ -229,13 +233,6 @@ static void dma_scsp(struct _SCSP *SCSP); 		/*SCSP DMA transfer function*/
 
 static const float SDLT[8]={-1000000.0,-36.0,-30.0,-24.0,-18.0,-12.0,-6.0,0.0};
 
-static INT16 *bufferl;
-static INT16 *bufferr;
-
-static int length;
-
-static signed short *RBUFDST;	//this points to where the sample will be stored in the RingBuf
-
 static unsigned char DecodeSCI(struct _SCSP *SCSP,unsigned char irq)
 {
 	unsigned char SCI=0;
@@ -253,9 +250,9 @@ static void ResetInterrupts(struct _SCSP *SCSP)
 {
 	UINT32 reset = SCSP->udata.data[0x22/2];
 	if (reset & 0x40)
-		SCSP->Int68kCB(-SCSP->IrqTimA);
+		SCSP->Int68kCB(SCSP->Int68kCBParam, -SCSP->IrqTimA);
 	if (reset & 0x180)
-		SCSP->Int68kCB(-SCSP->IrqTimBC);
+		SCSP->Int68kCB(SCSP->Int68kCBParam, -SCSP->IrqTimBC);
 }
 
 static void CheckPendingIRQ(struct _SCSP *SCSP)
@@ -264,7 +261,7 @@ static void CheckPendingIRQ(struct _SCSP *SCSP)
 	UINT32 en=SCSP->udata.data[0x1e/2];
 	if(SCSP->MidiW!=SCSP->MidiR)
 	{
-		SCSP->Int68kCB(SCSP->IrqMidi);
+		SCSP->Int68kCB(SCSP->Int68kCBParam, SCSP->IrqMidi);
 		return;
 	}
 	if(!pend)
@@ -272,23 +269,23 @@ static void CheckPendingIRQ(struct _SCSP *SCSP)
 	if(pend&0x40)
 		if(en&0x40)
 		{
-			SCSP->Int68kCB(SCSP->IrqTimA);
+			SCSP->Int68kCB(SCSP->Int68kCBParam, SCSP->IrqTimA);
 			return;
 		}
 	if(pend&0x80)
 		if(en&0x80)
 		{
-			SCSP->Int68kCB(SCSP->IrqTimBC);
+			SCSP->Int68kCB(SCSP->Int68kCBParam, SCSP->IrqTimBC);
 			return;
 		}
 	if(pend&0x100)
 		if(en&0x100)
 		{
-			SCSP->Int68kCB(SCSP->IrqTimBC);
+			SCSP->Int68kCB(SCSP->Int68kCBParam, SCSP->IrqTimBC);
 			return;
 		}
 
-	SCSP->Int68kCB(0);
+	SCSP->Int68kCB(SCSP->Int68kCBParam, 0);
 }
 
 static int Get_AR(struct _SCSP *SCSP,int base,int R)
@@ -386,12 +383,12 @@ static int EG_Update(struct _SLOT *slot)
 	return (slot->EG.volume>>EG_SHIFT)<<(SHIFT-10);
 }
 
-static UINT32 SCSP_Step(struct _SLOT *slot)
+static UINT32 SCSP_Step(struct _SCSP *SCSP, struct _SLOT *slot)
 {
 	int octave=OCT(slot);
 	UINT64 Fn;
 
-	Fn=(FNS_Table[FNS(slot)]);	//24.8
+	Fn=(SCSP->FNS_Table[FNS(slot)]);	//24.8
 	if(octave&8)
 		Fn>>=(16-octave);
 	else
@@ -401,12 +398,12 @@ static UINT32 SCSP_Step(struct _SLOT *slot)
 }
 
 
-static void Compute_LFO(struct _SLOT *slot)
+static void Compute_LFO(struct _SCSP *SCSP, struct _SLOT *slot)
 {
 	if(PLFOS(slot)!=0)
-		LFO_ComputeStep(&(slot->PLFO),LFOF(slot),PLFOWS(slot),PLFOS(slot),0);
+		LFO_ComputeStep(&SCSP->LFOTABLES,&(slot->PLFO),LFOF(slot),PLFOWS(slot),PLFOS(slot),0);
 	if(ALFOS(slot)!=0)
-		LFO_ComputeStep(&(slot->ALFO),LFOF(slot),ALFOWS(slot),ALFOS(slot),1);
+		LFO_ComputeStep(&SCSP->LFOTABLES,&(slot->ALFO),LFOF(slot),ALFOWS(slot),ALFOS(slot),1);
 }
 
 static void SCSP_StartSlot(struct _SCSP *SCSP, struct _SLOT *slot)
@@ -417,12 +414,12 @@ static void SCSP_StartSlot(struct _SCSP *SCSP, struct _SLOT *slot)
 	slot->cur_addr=0; slot->nxt_addr=1<<SHIFT;
 	start_offset = PCM8B(slot) ? SA(slot) : SA(slot) & 0x7FFFE;
 	slot->base=SCSP->SCSPRAM + start_offset;
-	slot->step=SCSP_Step(slot);
+	slot->step=SCSP_Step(SCSP, slot);
 	Compute_EG(SCSP,slot);
 	slot->EG.state=ATTACK;
 	slot->EG.volume=0x17F<<EG_SHIFT;
 	slot->Prev=0;
-	Compute_LFO(slot);
+	Compute_LFO(SCSP, slot);
 
 //	printf("StartSlot: SA %x PCM8B %x LPCTL %x ALFOS %x STWINH %x TL %x EFSDL %x\n", SA(slot), PCM8B(slot), LPCTL(slot), ALFOS(slot), STWINH(slot), TL(slot), EFSDL(slot));
 //	printf("           AR %x D1R %x D2R %x RR %x DL %x KRS %x EGHOLD %x LPSLNK %x\n", AR(slot), D1R(slot), D2R(slot), RR(slot), DL(slot), KRS(slot), EGHOLD(slot), LPSLNK(slot));
@@ -466,7 +463,7 @@ static void SCSP_Init(struct _SCSP *SCSP, const struct SCSPinterface *intf)
 
 		if (intf->region)
 		{
-			SCSP->SCSPRAM = &sat_ram[0]; //(unsigned char *)intf->region;
+			SCSP->SCSPRAM = intf->region[0];
 			SCSP->SCSPRAM_LENGTH = 512*1024;
 			SCSP->DSP.SCSPRAM = (UINT16 *)SCSP->SCSPRAM;
 			SCSP->DSP.SCSPRAM_LENGTH =  (512*1024)/2;
@@ -478,14 +475,14 @@ static void SCSP_Init(struct _SCSP *SCSP, const struct SCSPinterface *intf)
 	{
 		float fcent=(t_double) 1200.0*log_base_2((t_double)(((t_double) 1024.0+(t_double)i)/(t_double)1024.0));
 		fcent=(t_double) 44100.0*pow(2.0,fcent/1200.0);
-		FNS_Table[i]=(float) (1<<SHIFT) *fcent;
+		SCSP->FNS_Table[i]=(float) (1<<SHIFT) *fcent;
 	}
 	
 	for(i=0;i<0x400;++i)
 	{
 		float envDB=((float)(3*(i-0x3ff)))/32.0;
 		float scale=(float)(1<<SHIFT);
-		EG_TABLE[i]=(INT32)(pow(10.0,envDB/20.0)*scale);
+		SCSP->EG_TABLE[i]=(INT32)(pow(10.0,envDB/20.0)*scale);
 	}
 
 	for(i=0;i<0x10000;++i)
@@ -568,7 +565,7 @@ static void SCSP_Init(struct _SCSP *SCSP, const struct SCSPinterface *intf)
 		SCSP->Slots[i].base=NULL;
 	}
 
-	LFO_Init();
+	LFO_Init(&SCSP->LFOTABLES);
 	SCSP->buffertmpl=(signed int*) malloc(44100*sizeof(signed int));
 	SCSP->buffertmpr=(signed int*) malloc(44100*sizeof(signed int));
 	memset(SCSP->buffertmpl,0,44100*sizeof(signed int));
@@ -611,7 +608,7 @@ static void SCSP_UpdateSlotReg(struct _SCSP *SCSP,int s,int r)
 			break;
 		case 0x10:
 		case 0x11:
-			slot->step=SCSP_Step(slot);
+			slot->step=SCSP_Step(SCSP, slot);
 			break;
 		case 0xA:
 		case 0xB:
@@ -620,7 +617,7 @@ static void SCSP_UpdateSlotReg(struct _SCSP *SCSP,int s,int r)
 			break;
 		case 0x12:
 		case 0x13:
-			Compute_LFO(slot);
+			Compute_LFO(SCSP, slot);
 			break;
 	}
 }
@@ -646,7 +643,7 @@ static void SCSP_UpdateReg(struct _SCSP *SCSP, int reg)
 			break;
 		case 0x6:
 		case 0x7:
-			SCSP_MidiIn(0, SCSP->udata.data[0x6/2]&0xff, 0);
+			SCSP_MidiIn(SCSP, 0, SCSP->udata.data[0x6/2]&0xff, 0);
 			break;
 		case 0x12:
 		case 0x13:
@@ -734,7 +731,7 @@ static void SCSP_UpdateRegR(struct _SCSP *SCSP, int reg)
 				unsigned short v=SCSP->udata.data[0x5/2];
 				v&=0xff00;
 				v|=SCSP->MidiStack[SCSP->MidiR];
-				SCSP->Int68kCB(0);	// cancel the IRQ
+				SCSP->Int68kCB(SCSP->Int68kCBParam, 0);	// cancel the IRQ
 				if(SCSP->MidiR!=SCSP->MidiW)
 				{
 					++SCSP->MidiR;
@@ -997,12 +994,12 @@ static INLINE INT32 SCSP_UpdateSlot(struct _SCSP *SCSP, struct _SLOT *slot)
 	if(slot->EG.state==ATTACK)
 		sample=(sample*EG_Update(slot))>>SHIFT;
 	else
-		sample=(sample*EG_TABLE[EG_Update(slot)>>(SHIFT-10)])>>SHIFT;
+		sample=(sample*SCSP->EG_TABLE[EG_Update(slot)>>(SHIFT-10)])>>SHIFT;
 
 	if(!STWINH(slot))
 	{
 		unsigned short Enc=((TL(slot))<<0x0)|(0x7<<0xd);
-		*RBUFDST=(sample*SCSP->LPANTABLE[Enc])>>(SHIFT+1);
+		*SCSP->RBUFDST=(sample*SCSP->LPANTABLE[Enc])>>(SHIFT+1);
 	}
 		
 	return sample;
@@ -1013,8 +1010,8 @@ static void SCSP_DoMasterSamples(struct _SCSP *SCSP, int nsamples)
 	INT16 *bufr,*bufl;
 	int sl, s, i;
 
-	bufr=bufferr;
-	bufl=bufferl;
+	bufr=SCSP->bufferr;
+	bufl=SCSP->bufferl;
 
 	for(s=0;s<nsamples;++s)
 	{
@@ -1025,9 +1022,9 @@ static void SCSP_DoMasterSamples(struct _SCSP *SCSP, int nsamples)
 		for(sl=0;sl<32;++sl)
 		{
 #if FM_DELAY
-			RBUFDST=SCSP->DELAYBUF+SCSP->DELAYPTR;
+			SCSP->RBUFDST=SCSP->DELAYBUF+SCSP->DELAYPTR;
 #else
-			RBUFDST=SCSP->RINGBUF+SCSP->BUFPTR;
+			SCSP->RBUFDST=SCSP->RINGBUF+SCSP->BUFPTR;
 #endif
 			if(SCSP->Slots[sl].active)
 			{
@@ -1084,7 +1081,7 @@ static void SCSP_DoMasterSamples(struct _SCSP *SCSP, int nsamples)
 
 static void dma_scsp(struct _SCSP *SCSP)
 {
-	static UINT16 tmp_dma[3], *scsp_regs;
+	UINT16 tmp_dma[3], *scsp_regs;
 
 	scsp_regs = (UINT16 *)SCSP->udata.datab;
 
@@ -1141,10 +1138,9 @@ int SCSP_IRQCB(void *param)
 
 void SCSP_Update(void *param, INT16 **inputs, INT16 **buf, int samples)
 {
-	struct _SCSP *SCSP = AllocedSCSP;
-	bufferl = buf[0];
-	bufferr = buf[1];
-	length = samples;
+	struct _SCSP *SCSP = param;
+	SCSP->bufferl = buf[0];
+	SCSP->bufferr = buf[1];
 	SCSP_DoMasterSamples(SCSP, samples);
 }
 
@@ -1165,19 +1161,26 @@ void *scsp_start(const void *config)
 	// set up the IRQ callbacks
 	{
 		SCSP->Int68kCB = intf->irq_callback[0];
+		SCSP->Int68kCBParam = intf->irq_param[0];
 
 //		SCSP->stream = stream_create(0, 2, 44100, SCSP, SCSP_Update);
 	}
 
-	AllocedSCSP = SCSP;
-
 	return SCSP;
 }
 
+void scsp_stop(void *chip)
+{
+	struct _SCSP *SCSP = chip;
+
+	free(SCSP->buffertmpl);
+	free(SCSP->buffertmpr);
+	free(SCSP);
+}
 
-void SCSP_set_ram_base(int which, void *base)
+void SCSP_set_ram_base(void *chip, int which, void *base)
 {
-	struct _SCSP *SCSP = AllocedSCSP;
+	struct _SCSP *SCSP = chip;
 	if (SCSP)
 	{
 		SCSP->SCSPRAM = base;
@@ -1188,7 +1191,7 @@ void SCSP_set_ram_base(int which, void *base)
 
 READ16_HANDLER( SCSP_0_r )
 {
-	struct _SCSP *SCSP = AllocedSCSP;
+	struct _SCSP *SCSP = chip;
 
 	return SCSP_r16(SCSP, offset*2);
 }
@@ -1197,7 +1200,7 @@ extern UINT32* stv_scu;
 
 WRITE16_HANDLER( SCSP_0_w )
 {
-	struct _SCSP *SCSP = AllocedSCSP;
+	struct _SCSP *SCSP = chip;
 	UINT16 tmp, *scsp_regs;
 
 	tmp = SCSP_r16(SCSP, offset*2);
@@ -1256,14 +1259,14 @@ WRITE16_HANDLER( SCSP_0_w )
 
 WRITE16_HANDLER( SCSP_MidiIn )
 {
-	struct _SCSP *SCSP = AllocedSCSP; 
+	struct _SCSP *SCSP = chip;
 	SCSP->MidiStack[SCSP->MidiW++]=data;
 	SCSP->MidiW &= 15;
 }
 
 READ16_HANDLER( SCSP_MidiOutR )
 {
-	struct _SCSP *SCSP = AllocedSCSP; 
+	struct _SCSP *SCSP = chip;
 	unsigned char val;
 
 	val=SCSP->MidiStack[SCSP->MidiR++];
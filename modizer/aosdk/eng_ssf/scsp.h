@@ -20,15 +20,17 @@ struct SCSPinterface
 {
 	int num;
 	void *region[MAX_SCSP];
-	int mixing_level[MAX_SCSP];			/* volume */
-	void (*irq_callback[MAX_SCSP])(int state);	/* irq callback */
+	int mixing_level[MAX_SCSP];			/* volume */
+	void (*irq_callback[MAX_SCSP])(void *param, int state);	/* irq callback */
+	void *irq_param[MAX_SCSP];			/* handed back to irq_callback */
 };
 
 void *scsp_start(const void *config);
+void scsp_stop(void *chip);
 void SCSP_Update(void *param, INT16 **inputs, INT16 **buf, int samples);
 
-#define READ16_HANDLER(name)	data16_t name(offs_t offset, data16_t mem_mask)
-#define WRITE16_HANDLER(name)	void     name(offs_t offset, data16_t data, data16_t mem_mask)
+#define READ16_HANDLER(name)	data16_t name(void *chip, offs_t offset, data16_t mem_mask)
+#define WRITE16_HANDLER(name)	void     name(void *chip, offs_t offset, data16_t data, data16_t mem_mask)
 
 // SCSP register access
 READ16_HANDLER( SCSP_0_r );
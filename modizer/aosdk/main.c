@@ -33,17 +33,18 @@
 
 /* file types */
 static uint32 type;
+static void *handle;
 
 static struct 
 { 
 	uint32 sig; 
 	char *name; 
-	int32 (*start)(uint8 *, uint32); 
-	int32 (*gen)(int16 *, uint32); 
-	int32 (*stop)(void); 
-	int32 (*command)(int32, int32); 
+	void *(*start)(uint8 *, uint32, int32, int32); 
+	int32 (*gen)(void *, int16 *, uint32); 
+	int32 (*stop)(void *); 
+	int32 (*command)(void *, int32, int32); 
 	uint32 rate; 
-	int32 (*fillinfo)(ao_display_info *); 
+	int32 (*fillinfo)(void *, ao_display_info *); 
 } types[] = {
 	{ 0x50534601, "Sony PlayStation (.psf)", psf_start, psf_gen, psf_stop, psf_command, 60, psf_fill_info },
 	{ 0x53505500, "Sony PlayStation (.spu)", spu_start, spu_gen, spu_stop, spu_command, 60, spu_fill_info },
@@ -119,7 +120,7 @@ int ao_get_lib(char *filename, uint8 **buffer, uint64 *length)
 
 static void do_frame(uint32 size, int16 *buffer)
 {
-	(*types[type].gen)(buffer, size);
+	(*types[type].gen)(handle, buffer, size);
 }
 
 /*int main(int argv, char *argc[])
@@ -191,7 +192,7 @@ static void do_frame(uint32 size, int16 *buffer)
 		return -1;
 	}
 
-	if ((*types[type].start)(buffer, size) != AO_SUCCESS)
+	if ((handle = (*types[type].start)(buffer, size, 0, 0)) == NULL)
 	{
 		free(buffer);
 		printf("ERROR: Engine rejected file!\n");
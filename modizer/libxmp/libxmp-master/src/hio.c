@@ -323,7 +323,7 @@ HIO_HANDLE *hio_open(const void *path, const char *mode)
 	return NULL;
 }
 
-HIO_HANDLE *hio_open_mem(const void *ptr, long size)
+HIO_HANDLE *hio_open_mem(const void *ptr, long size, int free_after_use)
 {
 	HIO_HANDLE *h;
 
@@ -333,7 +333,11 @@ HIO_HANDLE *hio_open_mem(const void *ptr, long size)
 	
 	h->error = 0;
 	h->type = HIO_HANDLE_TYPE_MEMORY;
-	h->handle.mem = mopen(ptr, size);
+	h->handle.mem = mopen(ptr, size, free_after_use);
+	if (h->handle.mem == NULL) {
+		free(h);
+		return NULL;
+	}
 	h->size = size;
 
 	return h;
@@ -34,7 +34,7 @@ long	hio_tell	(HIO_HANDLE *);
 int	hio_eof		(HIO_HANDLE *);
 int	hio_error	(HIO_HANDLE *);
 HIO_HANDLE *hio_open	(const void *, const char *);
-HIO_HANDLE *hio_open_mem  (const void *, long);
+HIO_HANDLE *hio_open_mem  (const void *, long, int);
 HIO_HANDLE *hio_open_file (FILE *);
 int	hio_close	(HIO_HANDLE *);
 long	hio_size	(HIO_HANDLE *);
@@ -132,6 +132,8 @@ static int decrunch(HIO_HANDLE **h, const char *filename, char **temp)
 	unsigned char b[1024];
 	const char *cmd;
 	FILE *f, *t;
+	struct mem_file out;
+	HIO_HANDLE *mem;
 	int res;
 	int headersize;
 	int i;
@@ -192,8 +194,11 @@ static int decrunch(HIO_HANDLE **h, const char *filename, char **temp)
 
 	D_(D_WARN "Depacking file... ");
 
-	if ((t = make_temp_file(temp)) == NULL) {
-		goto err;
+	/* Depack straight to memory, temporary file only as a fallback */
+	if ((t = make_mem_file(&out)) == NULL) {
+		if ((t = make_temp_file(temp)) == NULL) {
+			goto err;
+		}
 	}
 
 	/* Depack file */
@@ -213,6 +218,21 @@ static int decrunch(HIO_HANDLE **h, const char *filename, char **temp)
 
 	D_(D_INFO "done");
 
+	if (*temp == NULL) {
+		/* The stream keeps no data of its own, flush it into the buffer */
+		if (fclose(t) != 0) {
+			D_(D_CRIT "flush error");
+			goto err3;
+		}
+		if ((mem = hio_open_mem(out.data, out.size, 1)) == NULL) {
+			goto err3;
+		}
+		hio_close(*h);
+		*h = mem;
+
+		return res;
+	}
+
 	if (fseek(t, 0, SEEK_SET) < 0) {
 		D_(D_CRIT "fseek error");
 		goto err2;
@@ -225,10 +245,57 @@ static int decrunch(HIO_HANDLE **h, const char *filename, char **temp)
 
     err2:
 	fclose(t);
+    err3:
+	free(out.data);
     err:
 	return -1;
 }
 
+/* A few loaders (ALM, MFP) read companion files next to the module and
+ * only accept file handles. When no loader takes a module depacked to
+ * memory, it is written to a temporary file and tested again. */
+static int test_loaders(HIO_HANDLE *h)
+{
+	int i;
+
+	for (i = 0; format_loader[i] != NULL; i++) {
+		hio_seek(h, 0, SEEK_SET);
+		if (format_loader[i]->test(h, NULL, 0) == 0) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int spill_to_temp_file(HIO_HANDLE **h, char **temp)
+{
+	MFILE *mem;
+	FILE *t;
+
+	if (HIO_HANDLE_TYPE(*h) != HIO_HANDLE_TYPE_MEMORY) {
+		return -1;
+	}
+	mem = (*h)->handle.mem;
+
+	if ((t = make_temp_file(temp)) == NULL) {
+		return -1;
+	}
+
+	if (fwrite(mem->start, 1, mem->size, t) != (size_t)mem->size ||
+	    fseek(t, 0, SEEK_SET) < 0) {
+		fclose(t);
+		unlink_temp_file(*temp);
+		*temp = NULL;
+		return -1;
+	}
+
+	hio_close(*h);
+	*h = hio_open_file(t);
+
+	return 0;
+}
+
 static void set_md5sum(HIO_HANDLE *f, unsigned char *digest)
 {
 	unsigned char buf[BUFLEN];
@@ -312,6 +379,10 @@ int xmp_test_module(char *path, struct xmp_test_info *info)
 		goto err;
 	}
 
+	if (HIO_HANDLE_TYPE(h) == HIO_HANDLE_TYPE_MEMORY && test_loaders(h) < 0) {
+		spill_to_temp_file(&h, &temp);
+	}
+
 	/* get size after decrunch */
 	if (hio_size(h) < 256) {	/* set minimum valid module size */
 		ret = -XMP_ERROR_FORMAT;
@@ -337,7 +408,7 @@ int xmp_test_module(char *path, struct xmp_test_info *info)
 			}
 #endif
 
-			fclose(h->handle.file);
+			hio_close(h);
 
 #ifndef LIBXMP_CORE_PLAYER
 			unlink_temp_file(temp);
@@ -500,6 +571,10 @@ int xmp_load_module(xmp_context opaque, char *path)
 		goto err;
 	}
 
+	if (HIO_HANDLE_TYPE(h) == HIO_HANDLE_TYPE_MEMORY && test_loaders(h) < 0) {
+		spill_to_temp_file(&h, &temp_name);
+	}
+
 	size = hio_size(h);
 	if (size < 256) {		/* get size after decrunch */
 		ret = -XMP_ERROR_FORMAT;
@@ -555,7 +630,7 @@ int xmp_load_module_from_memory(xmp_context opaque, void *mem, long size)
 	if (size == 0)
 		size--;
 
-	if ((h = hio_open_mem(mem, size)) == NULL)
+	if ((h = hio_open_mem(mem, size, 0)) == NULL)
 		return -XMP_ERROR_SYSTEM;
 
 	if (ctx->state > XMP_STATE_UNLOADED)
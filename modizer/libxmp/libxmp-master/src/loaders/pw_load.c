@@ -92,14 +92,17 @@ static int pw_load(struct module_data *m, HIO_HANDLE *h, const int start)
 	uint8 mod_event[4];
 	HIO_HANDLE *f;
 	FILE *temp;
+	struct mem_file out;
 	const char *name;
-	char *temp_name;
+	char *temp_name = NULL;
 	int i, j;
 
-	/* Prowizard depacking */
+	/* Prowizard depacking, to memory unless custom streams are missing */
 
-	if ((temp = make_temp_file(&temp_name)) == NULL) {
-		goto err;
+	if ((temp = make_mem_file(&out)) == NULL) {
+		if ((temp = make_temp_file(&temp_name)) == NULL) {
+			goto err;
+		}
 	}
 
 	if (pw_wizardry(h, temp, &name) < 0) {
@@ -109,7 +112,17 @@ static int pw_load(struct module_data *m, HIO_HANDLE *h, const int start)
 	
 	/* Module loading */
 
-	if ((f = hio_open_file(temp)) == NULL) {
+	if (temp_name == NULL) {
+		/* The stream keeps no data of its own, flush it into the buffer */
+		if (fclose(temp) != 0) {
+			goto err2;
+		}
+		if ((f = hio_open_mem(out.data, out.size, 1)) == NULL) {
+			goto err2;
+		}
+		/* Now owned by the handle */
+		out.data = NULL;
+	} else if ((f = hio_open_file(temp)) == NULL) {
 		goto err2;
 	}
 
@@ -221,6 +234,7 @@ static int pw_load(struct module_data *m, HIO_HANDLE *h, const int start)
     err3:
 	hio_close(f);
     err2:
+	free(out.data);
 	unlink_temp_file(temp_name);
     err:
 	return -1;
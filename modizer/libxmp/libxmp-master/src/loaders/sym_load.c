@@ -38,10 +38,6 @@ static int sym_test(HIO_HANDLE *f, char *t, const int start)
 	uint32 a, b;
 	int i, ver;
 
-	/* Load from memory not supported until we handle sample depacking */
-	if (HIO_HANDLE_TYPE(f) != HIO_HANDLE_TYPE_FILE)
-		return -1;
-
 	a = hio_read32b(f);
 	b = hio_read32b(f);
 
@@ -322,7 +318,7 @@ static int sym_load(struct module_data *m, HIO_HANDLE *f, const int start)
 		return -1;
 
 	if (a) {
-		unsigned char *x = libxmp_read_lzw_dynamic(f->handle.file, buf,
+		unsigned char *x = libxmp_read_lzw_dynamic(f, buf,
 					13, 0, size, size, XMP_LZW_QUIRK_DSYM);
 		if (x == NULL) {
 			free(buf);
@@ -376,7 +372,7 @@ static int sym_load(struct module_data *m, HIO_HANDLE *f, const int start)
 		return -1;
 
 	if (a) {
-		unsigned char *x = libxmp_read_lzw_dynamic(f->handle.file, buf,
+		unsigned char *x = libxmp_read_lzw_dynamic(f, buf,
 					13, 0, size, size, XMP_LZW_QUIRK_DSYM);
 		if (x == NULL) {
 			free(buf);
@@ -467,7 +463,7 @@ static int sym_load(struct module_data *m, HIO_HANDLE *f, const int start)
 
 		if (a == 1) {
 			uint8 *b = malloc(mod->xxs[i].len);
-			libxmp_read_lzw_dynamic(f->handle.file, b, 13, 0,
+			libxmp_read_lzw_dynamic(f, b, 13, 0,
 					mod->xxs[i].len, mod->xxs[i].len,
 					XMP_LZW_QUIRK_DSYM);
 			ret = libxmp_load_sample(m, NULL,
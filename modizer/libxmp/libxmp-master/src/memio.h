@@ -7,13 +7,14 @@ typedef struct {
 	const unsigned char *start;
 	ptrdiff_t pos;
 	ptrdiff_t size;
+	int free_after_use;
 } MFILE;
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-MFILE  *mopen(const void *, long);
+MFILE  *mopen(const void *, long, int);
 int     mgetc(MFILE *stream);
 size_t  mread(void *, size_t, size_t, MFILE *);
 int     mseek(MFILE *, long, int);
@@ -26,6 +26,10 @@
 
 #ifndef LIBXMP_CORE_PLAYER
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE		/* fopencookie() */
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -160,4 +164,165 @@ void unlink_temp_file(char *temp)
 	}
 }
 
+/*
+ * Memory backed depacking target: a read/write/seek stdio stream over a
+ * growable buffer, so the depackers can keep using FILE * while the result
+ * is handed to the loaders as a memory HIO_HANDLE. The buffer belongs to
+ * the caller and is kept when the stream is closed.
+ */
+#if defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || \
+    defined(__OpenBSD__) || defined(__DragonFly__) || defined(__GLIBC__)
+
+#define MEM_FILE_MIN_ALLOC	0x10000
+
+static long mem_file_read(struct mem_file *m, char *buf, long size)
+{
+	if (m->pos >= m->size)
+		return 0;
+	if (size > m->size - m->pos)
+		size = m->size - m->pos;
+
+	memcpy(buf, m->data + m->pos, size);
+	m->pos += size;
+
+	return size;
+}
+
+static long mem_file_write(struct mem_file *m, const char *buf, long size)
+{
+	long end = m->pos + size;
+
+	if (end > m->alloc) {
+		long alloc = m->alloc ? m->alloc : MEM_FILE_MIN_ALLOC;
+		unsigned char *data;
+
+		while (alloc < end)
+			alloc *= 2;
+		if ((data = realloc(m->data, alloc)) == NULL)
+			return -1;
+		m->data = data;
+		m->alloc = alloc;
+	}
+
+	/* zero the gap left by a seek past the end */
+	if (m->pos > m->size)
+		memset(m->data + m->size, 0, m->pos - m->size);
+
+	memcpy(m->data + m->pos, buf, size);
+	m->pos = end;
+	if (end > m->size)
+		m->size = end;
+
+	return size;
+}
+
+static long mem_file_seek(struct mem_file *m, long offset, int whence)
+{
+	switch (whence) {
+	case SEEK_SET:
+		break;
+	case SEEK_CUR:
+		offset += m->pos;
+		break;
+	case SEEK_END:
+		offset += m->size;
+		break;
+	default:
+		return -1;
+	}
+
+	if (offset < 0)
+		return -1;
+
+	m->pos = offset;
+
+	return offset;
+}
+
+#ifdef __GLIBC__
+
+static ssize_t mem_cookie_read(void *c, char *buf, size_t size)
+{
+	return mem_file_read(c, buf, size);
+}
+
+static ssize_t mem_cookie_write(void *c, const char *buf, size_t size)
+{
+	/* fopencookie wants 0 on error */
+	long ret = mem_file_write(c, buf, size);
+	return ret < 0 ? 0 : ret;
+}
+
+static int mem_cookie_seek(void *c, off64_t *offset, int whence)
+{
+	long ret = mem_file_seek(c, *offset, whence);
+
+	if (ret < 0)
+		return -1;
+
+	*offset = ret;
+	return 0;
+}
+
+static int mem_cookie_close(void *c)
+{
+	return 0;
+}
+
+FILE *make_mem_file(struct mem_file *m)
+{
+	cookie_io_functions_t io = {
+		mem_cookie_read, mem_cookie_write,
+		mem_cookie_seek, mem_cookie_close
+	};
+
+	memset(m, 0, sizeof (struct mem_file));
+
+	return fopencookie(m, "w+b", io);
+}
+
+#else
+
+static int mem_fun_read(void *c, char *buf, int size)
+{
+	return mem_file_read(c, buf, size);
+}
+
+static int mem_fun_write(void *c, const char *buf, int size)
+{
+	return mem_file_write(c, buf, size);
+}
+
+static fpos_t mem_fun_seek(void *c, fpos_t offset, int whence)
+{
+	return mem_file_seek(c, offset, whence);
+}
+
+static int mem_fun_close(void *c)
+{
+	return 0;
+}
+
+FILE *make_mem_file(struct mem_file *m)
+{
+	memset(m, 0, sizeof (struct mem_file));
+
+	return funopen(m, mem_fun_read, mem_fun_write, mem_fun_seek,
+							mem_fun_close);
+}
+
+#endif
+
+#else
+
+/* No custom stdio streams, depack to a temporary file instead */
+FILE *make_mem_file(struct mem_file *m)
+{
+	memset(m, 0, sizeof (struct mem_file));
+
+	return NULL;
+}
+
+#endif
+
 #endif
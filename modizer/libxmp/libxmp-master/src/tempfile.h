@@ -1,7 +1,15 @@
 #ifndef XMP_PLATFORM_H
 #define XMP_PLATFORM_H
 
+struct mem_file {
+	unsigned char *data;
+	long size;
+	long alloc;
+	long pos;
+};
+
 FILE *make_temp_file(char **);
 void unlink_temp_file(char *);
+FILE *make_mem_file(struct mem_file *);
 
 #endif
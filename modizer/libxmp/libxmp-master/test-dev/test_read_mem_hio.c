@@ -14,7 +14,7 @@ TEST(test_read_mem_hio)
 	for (i = 0; i < 100; i++)
 		mem[i] = i;
 
-	h = hio_open_mem(mem, 100);
+	h = hio_open_mem(mem, 100, 0);
 	fail_unless(h != NULL, "hio_open");
 
 	x = hio_size(h);
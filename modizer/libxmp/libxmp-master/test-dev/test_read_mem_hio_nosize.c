@@ -13,7 +13,7 @@ TEST(test_read_mem_hio_nosize)
 	for (i = 0; i < 100; i++)
 		mem[i] = i;
 
-	h = hio_open_mem(mem, -1);
+	h = hio_open_mem(mem, -1, 0);
 	fail_unless(h != NULL, "hio_open");
 
 	x = hio_size(h);
@@ -56,26 +56,30 @@ static void events_schedule (void)
 }
 
 static void do_cycles_slow (unsigned long cycles_to_add) {
-  if ((nextevent - cycles) <= cycles_to_add) {
-    for (; cycles_to_add != 0; cycles_to_add--) {
-      if (++cycles == nextevent) {
-	/* HSYNC */
-	if(eventtab[ev_hsync].active && eventtab[ev_hsync].evtime == cycles) {
-	  (*eventtab[ev_hsync].handler)();
-	}
-	/* AUDIO */
+  /* jump from one event to the next instead of counting cycles one by one,
+     events fire at the same cycles as before: only when nextevent lies in
+     ]cycles, cycles+cycles_to_add] */
+  while (cycles_to_add != 0) {
+    unsigned long int eventdelta = nextevent - cycles;
+    if (eventdelta == 0 || eventdelta > cycles_to_add)
+      break;
+    cycles = nextevent;
+    cycles_to_add -= eventdelta;
+    /* HSYNC */
+    if(eventtab[ev_hsync].active && eventtab[ev_hsync].evtime == cycles) {
+      (*eventtab[ev_hsync].handler)();
+    }
+    /* AUDIO */
 #if 0
-	if(eventtab[ev_audio].active && eventtab[ev_audio].evtime == cycles) {
-	  (*eventtab[ev_audio].handler)();
-	}
+    if(eventtab[ev_audio].active && eventtab[ev_audio].evtime == cycles) {
+      (*eventtab[ev_audio].handler)();
+    }
 #endif
-	/* CIA */
-	if(eventtab[ev_cia].active && eventtab[ev_cia].evtime == cycles) {
-	  (*eventtab[ev_cia].handler)();
-	}
-	events_schedule();
-      }
+    /* CIA */
+    if(eventtab[ev_cia].active && eventtab[ev_cia].evtime == cycles) {
+      (*eventtab[ev_cia].handler)();
     }
+    events_schedule();
   }
   cycles += cycles_to_add;
 }
@@ -146,28 +146,48 @@ extern void byteput(uaecptr addr, uae_u32 b);
 
 #endif
 
+/* chip RAM is where replayers run and keep their data: access it directly,
+   the other banks go through their handlers */
 static inline uae_u32 get_long(uaecptr addr)
 {
+    if (addr < allocated_chipmem)
+	return do_get_mem_long((uae_u32 *)(chipmemory + addr));
     return longget_1(addr);
 }
 static inline uae_u32 get_word(uaecptr addr)
 {
+    if (addr < allocated_chipmem)
+	return do_get_mem_word((uae_u16 *)(chipmemory + addr));
     return wordget_1(addr);
 }
 static inline uae_u32 get_byte(uaecptr addr)
 {
+    if (addr < allocated_chipmem)
+	return chipmemory[addr];
     return byteget_1(addr);
 }
 static inline void put_long(uaecptr addr, uae_u32 l)
 {
+    if (addr < allocated_chipmem) {
+	do_put_mem_long((uae_u32 *)(chipmemory + addr), l);
+	return;
+    }
     longput_1(addr, l);
 }
 static inline void put_word(uaecptr addr, uae_u32 w)
 {
+    if (addr < allocated_chipmem) {
+	do_put_mem_word((uae_u16 *)(chipmemory + addr), w);
+	return;
+    }
     wordput_1(addr, w);
 }
 static inline void put_byte(uaecptr addr, uae_u32 b)
 {
+    if (addr < allocated_chipmem) {
+	chipmemory[addr] = b;
+	return;
+    }
     byteput_1(addr, b);
 }
 
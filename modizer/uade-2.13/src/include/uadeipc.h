@@ -72,6 +72,7 @@ int uade_receive_string(char *s, enum uade_msgtype msgtype, size_t maxlen, struc
 int uade_send_message(struct uade_msg *um, struct uade_ipc *ipc);
 int uade_send_short_message(enum uade_msgtype msgtype, struct uade_ipc *ipc);
 int uade_send_string(enum uade_msgtype msgtype, const char *str, struct uade_ipc *ipc);
+int uade_send_data(enum uade_msgtype msgtype, const void *data, uint32_t size, struct uade_ipc *ipc);
 int uade_send_u32(enum uade_msgtype com, uint32_t u, struct uade_ipc *ipc);
 int uade_send_two_u32s(enum uade_msgtype com, uint32_t u1, uint32_t u2, struct uade_ipc *ipc);
 void uade_set_peer(struct uade_ipc *ipc, int peer_is_client, const char *input, const char *output);
@@ -199,9 +199,6 @@ static int uade_calc_reloc_size(uae_u32 *src, uae_u32 *end)
 /* last part of the audio system pipeline */
 void uade_check_sound_buffers(int bytes)
 {
-  uint8_t uade_message_space[UADE_MAX_MESSAGE_SIZE];
-  struct uade_msg *um = (struct uade_msg *) uade_message_space;
-
 //YOYO optimization : no swap since I'm using no network but only buffers
 	
   /* transmit in big endian format, so swap if little endian */
@@ -215,10 +212,7 @@ void uade_check_sound_buffers(int bytes)
     uade_send_debug("LED is %s", gui_ledstate ? "ON" : "OFF");
   }
 
-  um->msgtype = UADE_REPLY_DATA;
-  um->size = bytes;
-  memcpy(um->data, sndbuffer, bytes);
-  if (uade_send_message(um, &uadeipc)) {
+  if (uade_send_data(UADE_REPLY_DATA, sndbuffer, bytes, &uadeipc)) {
     fprintf(stderr, "uadecore: Could not send sample data.\n");
     exit(-1);
   }
@@ -70,6 +70,19 @@ static void copy_from_inputbuffer(void *dst, int bytes, struct uade_ipc *ipc)
 }
 
 
+/* The in-process transport always returns full reads, so when nothing is
+   buffered read straight into the destination instead of the input buffer. */
+static int read_exactly(void *dst, size_t bytes, struct uade_ipc *ipc)
+{
+  if (ipc->inputbytes == 0)
+    return (uade_ipc_read(ipc->input, dst, bytes) == (ssize_t) bytes) ? 0 : -1;
+  if (get_more(bytes, ipc))
+    return -1;
+  copy_from_inputbuffer(dst, bytes, ipc);
+  return 0;
+}
+
+
 int uade_parse_u32_message(uint32_t *u1, struct uade_msg *um)
 {
   if (um->size != 4)
@@ -102,12 +115,8 @@ int uade_receive_message(struct uade_msg *um, size_t maxbytes,
     return -1;
   }
 
-  if (ipc->inputbytes < sizeof(*um)) {
-    if (get_more(sizeof(*um), ipc))
-      return 0;
-  }
-
-  copy_from_inputbuffer(um, sizeof(*um), ipc);
+  if (read_exactly(um, sizeof(*um), ipc))
+    return 0;
 
   um->msgtype = ntohl(um->msgtype);
   um->size = ntohl(um->size);
@@ -120,11 +129,8 @@ int uade_receive_message(struct uade_msg *um, size_t maxbytes,
     fprintf(stderr, "too big a command: %zu\n", fullsize);
     return -1;
   }
-  if (ipc->inputbytes < um->size) {
-    if (get_more(um->size, ipc))
-      return -1;
-  }
-  copy_from_inputbuffer(&um->data, um->size, ipc);
+  if (um->size && read_exactly(&um->data, um->size, ipc))
+    return -1;
 
   if (um->msgtype == UADE_COMMAND_TOKEN)
     ipc->state = UADE_S_STATE;
@@ -239,6 +245,30 @@ int uade_send_string(enum uade_msgtype com, const char *str, struct uade_ipc *ip
 }
 
 
+/* Sends header and payload separately, so that the caller's buffer (sample
+   data) does not have to be copied into a message first. */
+int uade_send_data(enum uade_msgtype com, const void *data, uint32_t size, struct uade_ipc *ipc)
+{
+  struct uade_msg um = {.msgtype = ntohl(com), .size = ntohl(size)};
+
+  if (ipc->state == UADE_INITIAL_STATE) {
+    ipc->state = UADE_S_STATE;
+  } else if (ipc->state == UADE_R_STATE) {
+    fprintf(stderr, "protocol error: sending in R state is forbidden\n");
+    return -1;
+  }
+
+  if ((sizeof(um) + size) > UADE_MAX_MESSAGE_SIZE)
+    return -1;
+  if (uade_ipc_write(ipc->output, &um, sizeof(um)) < 0)
+    return -1;
+  if (size && uade_ipc_write(ipc->output, data, size) < 0)
+    return -1;
+
+  return 0;
+}
+
+
 int uade_send_u32(enum uade_msgtype com, uint32_t u, struct uade_ipc *ipc)
 {
   uint8_t space[UADE_MAX_MESSAGE_SIZE];
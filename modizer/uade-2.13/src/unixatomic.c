@@ -8,14 +8,22 @@
 
 #include "uadeipc.h"
 
-#include <pthread.h>
-
-extern pthread_mutex_t uade_mutex;
-
-volatile char ipc_buffer[2][UADE_MAX_MESSAGE_SIZE];
-volatile int ipc_buffer_index[2]={0,0};
-volatile int read_write_in_progress[2]={0,0};
-extern void uade_dummy_wait();
+/* In-process transport between uadecore (fd 0) and the frontend (fd 1).
+   Each direction is a single producer / single consumer byte ring: the writer
+   only moves head, the reader only moves tail, so no lock is needed. A reader
+   waits for data and a writer for space with uade_ipc_wait(); the other side
+   signals it with uade_ipc_signal() (both provided by the frontend). Each
+   direction has separate data and space signals, so a side never consumes
+   the wakeup meant for its peer. */
+#define IPC_RING_SIZE (4*UADE_MAX_MESSAGE_SIZE)  /* power of 2 */
+
+static char ipc_ring[2][IPC_RING_SIZE];
+static unsigned int ipc_ring_head[2]={0,0};
+static unsigned int ipc_ring_tail[2]={0,0};
+#define IPC_DATA  0
+#define IPC_SPACE 1
+extern void uade_ipc_wait(int fd, int space);
+extern void uade_ipc_signal(int fd, int space);
 
 int atomic_close(int fd)
 {
@@ -113,7 +121,7 @@ void *atomic_read_file(size_t *fs, const char *filename)
 
 
 ssize_t atomic_read(int fd, const void *buf, size_t count) {
-//	int wait_counter=0;
+	unsigned int head,tail,ofs,part;
 	if ((fd<0)||(fd>1)) {
 		printf("**********************************|:");
 		return 0;
@@ -123,25 +131,19 @@ ssize_t atomic_read(int fd, const void *buf, size_t count) {
 		printf("WARNING READING TOO MUCH %d\n",(int)count);
 		count=UADE_MAX_MESSAGE_SIZE;
 	}
-	while (ipc_buffer_index[fd]<count) {
-		uade_dummy_wait();  //wait 1ms
-		/*wait_counter++;
-		if (wait_counter>=5000) {
-			printf("break atomic_read : fd%d %d / %d\n",fd,ipc_buffer_index[fd],(int)count);
-			break;  //5s
-		}*/
+	tail=ipc_ring_tail[fd];
+	while (((head=__atomic_load_n(&ipc_ring_head[fd],__ATOMIC_ACQUIRE))-tail)<count) {
+		uade_ipc_wait(fd, IPC_DATA);
 	}
 	
+	ofs=tail&(IPC_RING_SIZE-1);
+	part=IPC_RING_SIZE-ofs;
+	if (part>count) part=count;
+	memcpy((char*)buf,&ipc_ring[fd][ofs],part);
+	if (part<count) memcpy((char*)buf+part,&ipc_ring[fd][0],count-part);
 	
-	pthread_mutex_lock(&uade_mutex);
-	
-	read_write_in_progress[fd]++;
-	memcpy((char*)buf,(char*)ipc_buffer[fd],count);
-	ipc_buffer_index[fd]-=count;
-	if (ipc_buffer_index[fd]) memmove((char*)(ipc_buffer[fd]),(char*)&(ipc_buffer[fd][count]),ipc_buffer_index[fd]);
-	
-	read_write_in_progress[fd]--;
-	pthread_mutex_unlock(&uade_mutex);
+	__atomic_store_n(&ipc_ring_tail[fd],tail+count,__ATOMIC_RELEASE);
+	uade_ipc_signal(fd, IPC_SPACE);
 	
 	return count;
 }
@@ -149,7 +151,7 @@ ssize_t atomic_read(int fd, const void *buf, size_t count) {
 
 
 ssize_t atomic_write(int fd, const void *buf, size_t count) {
-//	int wait_counter=0;
+	unsigned int head,ofs,part;
 	if ((fd<0)||(fd>1)) {
 		printf("**********************************|:");
 		return 0;
@@ -160,22 +162,18 @@ ssize_t atomic_write(int fd, const void *buf, size_t count) {
 		printf("WARNING WRITING TOO MUCH %d\n",(int)count);
 		count=UADE_MAX_MESSAGE_SIZE;
 	}
-	while ((ipc_buffer_index[fd]+count)>UADE_MAX_MESSAGE_SIZE) {
-		uade_dummy_wait();
-		/*wait_counter++;
-		if (wait_counter>=5000) {
-			printf("break atomic_write : fd%d %d / %d\n",fd,ipc_buffer_index[fd],(int)count);
-			break;  //5s
-		}*/
+	head=ipc_ring_head[fd];
+	while ((head-__atomic_load_n(&ipc_ring_tail[fd],__ATOMIC_ACQUIRE))+count>IPC_RING_SIZE) {
+		uade_ipc_wait(fd, IPC_SPACE);
 	}
 	
-	pthread_mutex_lock(&uade_mutex);
-	
-	read_write_in_progress[fd]++;
-	memcpy((char*)&(ipc_buffer[fd][ipc_buffer_index[fd]]),(char*)buf,count);
-	ipc_buffer_index[fd]+=count;
-	read_write_in_progress[fd]--;
+	ofs=head&(IPC_RING_SIZE-1);
+	part=IPC_RING_SIZE-ofs;
+	if (part>count) part=count;
+	memcpy(&ipc_ring[fd][ofs],(const char*)buf,part);
+	if (part<count) memcpy(&ipc_ring[fd][0],(const char*)buf+part,count-part);
 	
-	pthread_mutex_unlock(&uade_mutex);
+	__atomic_store_n(&ipc_ring_head[fd],head+count,__ATOMIC_RELEASE);
+	uade_ipc_signal(fd, IPC_DATA);
 	return count;
 }
@@ -246,6 +246,11 @@ static UINT16 GetChipVolume(VGM_HEADER* FileHead, UINT8 ChipID, UINT8 ChipNum, U
 
 static void RestartPlaying(void);
 static void Chips_GeneralActions(UINT8 Mode);
+static void FreeCheckpoints(void);
+static bool CheckChipStateSupport(void);
+static void SaveCheckpoint(void);
+static UINT32 FindCheckpoint(INT32 SmplPlayed);
+static void LoadCheckpoint(UINT32 ChkPntID);
 
 INLINE INT32 SampleVGM2Pbk_I(INT32 SampleVal);	// inline functions
 INLINE INT32 SamplePbk2VGM_I(INT32 SampleVal);
@@ -278,6 +283,8 @@ INLINE INT16 Limit2Short(INT32 Value);
 static void null_update(UINT8 ChipID, stream_sample_t **outputs, int samples);
 static void dual_opl2_stereo(UINT8 ChipID, stream_sample_t **outputs, int samples);
 static void ResampleChipStream(CA_LIST* CLst, WAVE_32BS* RetSample, UINT32 Length);
+static UINT32 GetIdleSampleCount(UINT32 MaxCount);
+static UINT32 GetChipBlockLimit(UINT32 MaxCount);
 static INT32 RecalcFadeVolume(void);
 //UINT32 VGMFillBuffer(WAVE_16BS* Buffer, UINT32 BufferSize)
 
@@ -373,6 +380,8 @@ CA_LIST* CurChipList;	// pointer to Pause or All [Opt]
 
 #define SMPL_BUFSIZE	0x100
 static INT32* StreamBufs[0x02];
+#define MIXBUF_SIZE		0x100	// maximum number of samples rendered as one block
+static WAVE_32BS* MixBuf;
 
 #ifdef MIXER_MUTING
 
@@ -424,6 +433,52 @@ UINT16 Last95Drum;	// for optvgm debugging
 UINT16 Last95Max;	// for optvgm debugging
 UINT32 Last95Freq;	// for optvgm debugging
 
+// Seek Checkpoints
+// The sound chips register the memory that holds their state with chip_state_add.
+// While playing, VGMFillBuffer saves a copy of that memory and of the interpreter
+// state every few seconds, so that SeekVGM doesn't need to restart the song.
+typedef struct chip_state_region
+{
+	void* Ptr;
+	UINT32 Size;
+} STATE_RGN;
+typedef struct resampler_state
+{
+	UINT32 SmpP;
+	UINT32 SmpLast;
+	UINT32 SmpNext;
+	WAVE_32BS LSmpl;
+	WAVE_32BS NSmpl;
+} RSMPL_STATE;
+typedef struct vgm_checkpoint
+{
+	INT32 SmplPlayed;
+	INT32 SmplPos;
+	UINT32 FilePos;
+	UINT16 Last95Drum;
+	UINT16 Last95Max;
+	UINT32 Last95Freq;
+	UINT32 BnkPos[PCM_BANK_COUNT];
+	UINT32 DataPos[PCM_BANK_COUNT];
+	UINT8 DacCtrlUsed;
+	UINT8 DacCtrlUsg[0xFF];
+	DACCTRL_DATA DacCtrl[0xFF];
+	RSMPL_STATE Resmpl[0x02][CHIP_COUNT];
+	UINT8* StateData;
+} VGM_CHKPNT;
+
+#define STATE_RGN_MAX	0x80
+static STATE_RGN StateRgns[STATE_RGN_MAX];
+static UINT32 StateRgnCount;
+static UINT32 StateSize;
+static bool StateRgnError;
+#define CHKPNT_MAX		0x20
+static VGM_CHKPNT ChkPnts[CHKPNT_MAX];
+static UINT32 ChkPntCount;
+static UINT32 ChkPntStep;	// distance between two checkpoints (in playback samples)
+static INT32 ChkPntNext;
+static bool ChkPntEnable;
+
 void VGMPlay_Init(void)
 {
 	UINT8 CurChip;
@@ -586,6 +641,7 @@ void VGMPlay_Init2(void)
 	
 	StreamBufs[0x00] = (INT32*)malloc(SMPL_BUFSIZE * sizeof(INT32));
 	StreamBufs[0x01] = (INT32*)malloc(SMPL_BUFSIZE * sizeof(INT32));
+	MixBuf = (WAVE_32BS*)malloc(MIXBUF_SIZE * sizeof(WAVE_32BS));
 	
 	if (CHIP_SAMPLE_RATE <= 0)
 		CHIP_SAMPLE_RATE = SampleRate;
@@ -613,6 +669,7 @@ void VGMPlay_Deinit(void)
 	
 	free(StreamBufs[0x00]);	StreamBufs[0x00] = NULL;
 	free(StreamBufs[0x01]);	StreamBufs[0x01] = NULL;
+	free(MixBuf);	MixBuf = NULL;
 	
 	for (CurCSet = 0x00; CurCSet < 0x02; CurCSet ++)
 	{
@@ -1058,6 +1115,10 @@ void PlayVGM(void)
 	InterpretFile(0);
 	IsVGMInit = false;
 	
+	ChkPntStep = SampleRate * 5;
+	ChkPntNext = ChkPntStep;
+	ChkPntEnable = CheckChipStateSupport();
+	
 	PauseThread = false;
 	AutoStopSkip = true;
 	ForceVGMExec = false;
@@ -1102,6 +1163,12 @@ void StopVGM(void)
 		close_real_fm();
 	PlayingMode = 0xFF;
 	
+	FreeCheckpoints();
+	ChkPntEnable = false;
+	StateRgnCount = 0;
+	StateSize = 0;
+	StateRgnError = false;
+	
 	return;
 }
 
@@ -1162,6 +1229,7 @@ void SeekVGM(bool Relative, INT32 PlayBkSamples)
 {
 	INT32 Samples;
 	UINT32 LoopSmpls;
+	UINT32 ChkPntID;
 	
 	if (PlayingMode == 0xFF || (Relative && ! PlayBkSamples))
 		return;
@@ -1176,7 +1244,15 @@ void SeekVGM(bool Relative, INT32 PlayBkSamples)
 	PauseThread = true;
 	if (UseFM)
 		StartSkipping();
-	if (Samples < 0)
+	// jump to the last checkpoint before the target position, if it saves time
+	ChkPntID = FindCheckpoint(LoopSmpls + VGMSmplPlayed + Samples);
+	if (ChkPntID < ChkPntCount &&
+		(Samples < 0 || ChkPnts[ChkPntID].SmplPlayed > (INT32)(LoopSmpls + VGMSmplPlayed)))
+	{
+		Samples = LoopSmpls + VGMSmplPlayed + Samples - ChkPnts[ChkPntID].SmplPlayed;
+		LoadCheckpoint(ChkPntID);
+	}
+	else if (Samples < 0)
 	{
 		Samples = LoopSmpls + VGMSmplPlayed + Samples;
 		if (Samples < 0)
@@ -2588,6 +2664,248 @@ static void RestartPlaying(void)
 	return;
 }
 
+void chip_state_add(void* Ptr, UINT32 Size)
+{
+	UINT32 CurRgn;
+	
+	for (CurRgn = 0; CurRgn < StateRgnCount; CurRgn ++)
+	{
+		if (StateRgns[CurRgn].Ptr == Ptr)
+			return;	// already registered (chip was restarted)
+	}
+	
+	// the existing checkpoints don't contain the new region
+	FreeCheckpoints();
+	if (StateRgnCount >= STATE_RGN_MAX)
+	{
+		StateRgnError = true;
+		return;
+	}
+	StateRgns[StateRgnCount].Ptr = Ptr;
+	StateRgns[StateRgnCount].Size = Size;
+	StateRgnCount ++;
+	StateSize += Size;
+	
+	return;
+}
+
+static void FreeCheckpoints(void)
+{
+	UINT32 CurPnt;
+	
+	for (CurPnt = 0; CurPnt < ChkPntCount; CurPnt ++)
+	{
+		free(ChkPnts[CurPnt].StateData);
+		ChkPnts[CurPnt].StateData = NULL;
+	}
+	ChkPntCount = 0;
+	
+	return;
+}
+
+static bool CheckChipStateSupport(void)
+{
+	// Bit Mask of the emulation cores that register their complete state
+	const UINT8 SUPPORTED_CORES[CHIP_COUNT] =
+	{	0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,	// SN76496 .. YM2608
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// YM2610 .. YMZ280B
+		0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,	// RF5C164 .. OKIM6258
+		0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,	// OKIM6295 .. QSound
+	};
+	CAUD_ATTR* CAA;
+	CHIP_OPTS* COpt;
+	UINT8 CurCSet;
+	UINT8 CurChip;
+	
+	if (FileMode || UseFM || StateRgnError || ! StateRgnCount)
+		return false;
+	
+	for (CurCSet = 0x00; CurCSet < 0x02; CurCSet ++)
+	{
+		CAA = (CAUD_ATTR*)&ChipAudio[CurCSet];
+		for (CurChip = 0x00; CurChip < CHIP_COUNT; CurChip ++, CAA ++)
+		{
+			if (CAA->ChipType == 0xFF)
+				continue;
+			if (CAA->Paired != NULL || CAA->ChipType >= CHIP_COUNT)
+				return false;
+			
+			COpt = (CHIP_OPTS*)&ChipOpts[CurCSet] + CAA->ChipType;
+			if (COpt->EmuCore >= 0x08 || ! (SUPPORTED_CORES[CAA->ChipType] & (1 << COpt->EmuCore)))
+				return false;
+		}
+	}
+	
+	return true;
+}
+
+static void SaveCheckpoint(void)
+{
+	VGM_CHKPNT* ChkPnt;
+	UINT32 CurPnt;
+	UINT32 CurRgn;
+	UINT8* DstPtr;
+	CAUD_ATTR* CAA;
+	RSMPL_STATE* RState;
+	UINT8 CurCSet;
+	UINT8 CurChip;
+	
+	if (ChkPntCount >= CHKPNT_MAX)
+	{
+		// keep every 2nd checkpoint and double the distance
+		for (CurPnt = 0; CurPnt < ChkPntCount; CurPnt ++)
+		{
+			if (! (CurPnt & 0x01))
+				free(ChkPnts[CurPnt].StateData);
+			else
+				ChkPnts[CurPnt / 2] = ChkPnts[CurPnt];
+		}
+		ChkPntCount /= 2;
+		ChkPntStep *= 2;
+	}
+	
+	ChkPnt = &ChkPnts[ChkPntCount];
+	ChkPnt->StateData = (UINT8*)malloc(StateSize);
+	if (ChkPnt->StateData == NULL)
+	{
+		ChkPntEnable = false;
+		return;
+	}
+	DstPtr = ChkPnt->StateData;
+	for (CurRgn = 0; CurRgn < StateRgnCount; CurRgn ++)
+	{
+		memcpy(DstPtr, StateRgns[CurRgn].Ptr, StateRgns[CurRgn].Size);
+		DstPtr += StateRgns[CurRgn].Size;
+	}
+	
+	ChkPnt->SmplPlayed = VGMSmplPlayed;
+	ChkPnt->SmplPos = VGMSmplPos;
+	ChkPnt->FilePos = VGMPos;
+	ChkPnt->Last95Drum = Last95Drum;
+	ChkPnt->Last95Max = Last95Max;
+	ChkPnt->Last95Freq = Last95Freq;
+	for (CurPnt = 0; CurPnt < PCM_BANK_COUNT; CurPnt ++)
+	{
+		ChkPnt->BnkPos[CurPnt] = PCMBank[CurPnt].BnkPos;
+		ChkPnt->DataPos[CurPnt] = PCMBank[CurPnt].DataPos;
+	}
+	ChkPnt->DacCtrlUsed = DacCtrlUsed;
+	memcpy(ChkPnt->DacCtrlUsg, DacCtrlUsg, sizeof(DacCtrlUsg));
+	memcpy(ChkPnt->DacCtrl, DacCtrl, sizeof(DacCtrl));
+	for (CurCSet = 0x00; CurCSet < 0x02; CurCSet ++)
+	{
+		CAA = (CAUD_ATTR*)&ChipAudio[CurCSet];
+		RState = ChkPnt->Resmpl[CurCSet];
+		for (CurChip = 0x00; CurChip < CHIP_COUNT; CurChip ++, CAA ++, RState ++)
+		{
+			RState->SmpP = CAA->SmpP;
+			RState->SmpLast = CAA->SmpLast;
+			RState->SmpNext = CAA->SmpNext;
+			RState->LSmpl = CAA->LSmpl;
+			RState->NSmpl = CAA->NSmpl;
+		}
+	}
+	ChkPntCount ++;
+	
+	ChkPntNext = VGMSmplPlayed + ChkPntStep;
+	
+	return;
+}
+
+static UINT32 FindCheckpoint(INT32 SmplPlayed)
+{
+	UINT32 CurPnt;
+	
+	// returns ChkPntCount if there is no checkpoint before SmplPlayed
+	for (CurPnt = ChkPntCount; CurPnt > 0; CurPnt --)
+	{
+		if (ChkPnts[CurPnt - 1].SmplPlayed <= SmplPlayed)
+			return CurPnt - 1;
+	}
+	
+	return ChkPntCount;
+}
+
+static void LoadCheckpoint(UINT32 ChkPntID)
+{
+	const VGM_CHKPNT* ChkPnt;
+	bool OldPThread;
+	UINT32 CurRgn;
+	UINT32 CurBnk;
+	const UINT8* SrcPtr;
+	CAUD_ATTR* CAA;
+	const RSMPL_STATE* RState;
+	UINT8 CurCSet;
+	UINT8 CurChip;
+	
+	ChkPnt = &ChkPnts[ChkPntID];
+	OldPThread = PauseThread;
+	if (ThreadPauseEnable)
+	{
+		ThreadNoWait = false;
+		ThreadPauseConfrm = false;
+		PauseThread = true;
+		while(! ThreadPauseConfrm)
+			Sleep(1);	// Wait until the Thread is finished
+	}
+	Interpreting = true;	// Avoid any Thread-Call
+	
+	SrcPtr = ChkPnt->StateData;
+	for (CurRgn = 0; CurRgn < StateRgnCount; CurRgn ++)
+	{
+		memcpy(StateRgns[CurRgn].Ptr, SrcPtr, StateRgns[CurRgn].Size);
+		SrcPtr += StateRgns[CurRgn].Size;
+	}
+	
+	VGMPos = ChkPnt->FilePos;
+	VGMSmplPos = ChkPnt->SmplPos;
+	VGMSmplPlayed = ChkPnt->SmplPlayed;
+	VGMEnd = false;
+	EndPlay = false;
+	VGMCurLoop = 0x00;
+	PauseSmpls = (PauseTime * SampleRate + 500) / 1000;
+	Last95Drum = ChkPnt->Last95Drum;
+	Last95Max = ChkPnt->Last95Max;
+	Last95Freq = ChkPnt->Last95Freq;
+	for (CurBnk = 0; CurBnk < PCM_BANK_COUNT; CurBnk ++)
+	{
+		PCMBank[CurBnk].BnkPos = ChkPnt->BnkPos[CurBnk];
+		PCMBank[CurBnk].DataPos = ChkPnt->DataPos[CurBnk];
+	}
+	DacCtrlUsed = ChkPnt->DacCtrlUsed;
+	memcpy(DacCtrlUsg, ChkPnt->DacCtrlUsg, sizeof(DacCtrlUsg));
+	memcpy(DacCtrl, ChkPnt->DacCtrl, sizeof(DacCtrl));
+	for (CurCSet = 0x00; CurCSet < 0x02; CurCSet ++)
+	{
+		CAA = (CAUD_ATTR*)&ChipAudio[CurCSet];
+		RState = ChkPnt->Resmpl[CurCSet];
+		for (CurChip = 0x00; CurChip < CHIP_COUNT; CurChip ++, CAA ++, RState ++)
+		{
+			CAA->SmpP = RState->SmpP;
+			CAA->SmpLast = RState->SmpLast;
+			CAA->SmpNext = RState->SmpNext;
+			CAA->LSmpl = RState->LSmpl;
+			CAA->NSmpl = RState->NSmpl;
+		}
+	}
+	
+	// the saved state contains the muting mask and panning from back then
+	Chips_GeneralActions(0x10);	// Set Muting Mask
+	Chips_GeneralActions(0x20);	// Set Panning
+	
+	Interpreting = false;
+#ifndef CONSOLE_MODE
+	FadePlay = false;
+	MasterVol = 1.0f;
+	FadeStart = 0;
+	FinalVol = VolumeLevelM;
+	PlayingTime = VGMSmplPlayed;
+#endif
+	PauseThread = OldPThread;
+	
+	return;
+}
+
 static void Chips_GeneralActions(UINT8 Mode)
 {
 	UINT32 AbsVol;
@@ -4242,6 +4560,7 @@ static void AddPCMData(UINT8 Type, UINT32 DataSize, const UINT8* Data)
 	TempPCM->BnkPos ++;
 	if (TempPCM->BnkPos <= TempPCM->BankCount)
 		return;	// Speed hack for restarting playback (skip already loaded blocks)
+	FreeCheckpoints();	// the chips of older checkpoints point to the old data
 	CurBnk = TempPCM->BankCount;
 	TempPCM->BankCount ++;
 	if (Last95Max != 0xFFFF)
@@ -4974,6 +5293,9 @@ static void InterpretVGM(UINT32 SampleCount)
 				case 0x80:	// ROM/RAM Dump
 					if (VGMCurLoop)
 						break;
+					// checkpoints from before this block would get the new ROM data
+					if (ChkPntCount && ChkPnts[0x00].SmplPos <= VGMSmplPos)
+						FreeCheckpoints();
 					
 					ROMSize = ReadLE32(&VGMPnt[0x07]);
 					DataStart = ReadLE32(&VGMPnt[0x0B]);
@@ -6155,9 +6477,65 @@ static INT32 RecalcFadeVolume(void)
 	return (INT32)(0x100 * FinalVol + 0.5f);
 }
 
+static UINT32 GetIdleSampleCount(UINT32 MaxCount)
+{
+	// returns the number of samples that can be played after the current one
+	// without a VGM command becoming due
+	INT64 LastIdle;
+	
+	// DAC Stream Control and the additional formats need to be interpreted
+	// every sample, fading recalculates the volume every sample
+	if (FileMode || DacCtrlUsed || FadePlay)
+		return 0x00;
+	if (VGMEnd || (PausePlay && ! ForceVGMExec))
+		return MaxCount;
+	if (VGMSmplPos <= 0)
+		return 0x00;
+	
+	// last playback sample that is still before VGMSmplPos (inverse of SamplePbk2VGM_I)
+	LastIdle = ((INT64)VGMSmplPos * VGMSmplRateMul - 1) / VGMSmplRateDiv - VGMSmplPlayed;
+	if (LastIdle <= 0)
+		return 0x00;
+	else if (LastIdle < MaxCount)
+		return (UINT32)LastIdle;
+	else
+		return MaxCount;
+}
+
+static UINT32 GetChipBlockLimit(UINT32 MaxCount)
+{
+	// limits the block size, so that no chip needs more samples than StreamBufs can hold
+	CA_LIST* CurCLst;
+	CAUD_ATTR* CAA;
+	UINT32 MaxSmpRate;
+	UINT32 BlkLimit;
+	
+	MaxSmpRate = SampleRate;
+	for (CurCLst = CurChipList; CurCLst != NULL; CurCLst = CurCLst->next)
+	{
+		for (CAA = CurCLst->CAud; CAA != NULL; CAA = CAA->Paired)
+		{
+			// the old resampler can output only one sample per call
+			if (CAA->Resampler == 0x00)
+				return 1;
+			if (CAA->Resampler != 0xFF && CAA->SmpRate > MaxSmpRate)
+				MaxSmpRate = CAA->SmpRate;
+		}
+	}
+	
+	// keep a few samples for the resampler's history and rounding
+	BlkLimit = (UINT32)((UINT64)(SMPL_BUFSIZE - 0x04) * SampleRate / MaxSmpRate);
+	if (! BlkLimit)
+		BlkLimit = 1;
+	return (BlkLimit < MaxCount) ? BlkLimit : MaxCount;
+}
+
 UINT32 VGMFillBuffer(WAVE_16BS* Buffer, UINT32 BufferSize)
 {
 	UINT32 CurSmpl;
+	UINT32 BlkSmpl;
+	UINT32 BlkLen;
+	UINT32 IdleSmpls;
 	WAVE_32BS TempBuf;
 	INT32 CurMstVol;
 	UINT32 RecalcStep;
@@ -6201,10 +6579,24 @@ UINT32 VGMFillBuffer(WAVE_16BS* Buffer, UINT32 BufferSize)
 	
 	CurChipList = (VGMEnd || PausePlay) ? ChipListPause : ChipListAll;
 	
-	for (CurSmpl = 0x00; CurSmpl < BufferSize; CurSmpl ++)
+	CurSmpl = 0x00;
+	while(CurSmpl < BufferSize)
 	{
+		if (ChkPntEnable && VGMSmplPlayed >= ChkPntNext && ! VGMCurLoop && ! VGMEnd)
+			SaveCheckpoint();
 		InterpretFile(1);
 		
+		// The chip states change only with VGM commands, so all samples until
+		// the next command can be rendered as one block.
+		BlkLen = BufferSize - CurSmpl;
+		if (BlkLen > MIXBUF_SIZE)
+			BlkLen = MIXBUF_SIZE;
+		BlkLen = GetChipBlockLimit(BlkLen);
+		IdleSmpls = GetIdleSampleCount(BlkLen - 1);
+		if (IdleSmpls)
+			InterpretFile(IdleSmpls);
+		BlkLen = 1 + IdleSmpls;
+		
 		// Sample Structures
 		//	00 - SN76496
 		//	01 - YM2413
@@ -6247,48 +6639,50 @@ UINT32 VGMFillBuffer(WAVE_16BS* Buffer, UINT32 BufferSize)
 		//	26 - X1-010
 		//	27 - C352
 		//	28 - GA20
-		TempBuf.Left = 0x00;
-		TempBuf.Right = 0x00;
+		memset(MixBuf, 0x00, sizeof(WAVE_32BS) * BlkLen);
 		CurCLst = CurChipList;
 		while(CurCLst != NULL)
 		{
 			if (! CurCLst->COpts->Disabled)
 			{
-				ResampleChipStream(CurCLst, &TempBuf, 1);
+				ResampleChipStream(CurCLst, MixBuf, BlkLen);
 			}
 			CurCLst = CurCLst->next;
 		}
 		
-		// ChipData << 9 [ChipVol] >> 5 << 8 [MstVol] >> 11  ->  9-5+8-11 = <<1
-		TempBuf.Left = ((TempBuf.Left >> 5) * CurMstVol) >> 11;
-		TempBuf.Right = ((TempBuf.Right >> 5) * CurMstVol) >> 11;
-		if (SurroundSound)
-			TempBuf.Right *= -1;
-		Buffer[CurSmpl].Left = Limit2Short(TempBuf.Left);
-		Buffer[CurSmpl].Right = Limit2Short(TempBuf.Right);
-		
-		if (FadePlay && ! FadeStart)
+		for (BlkSmpl = 0x00; BlkSmpl < BlkLen; BlkSmpl ++, CurSmpl ++)
 		{
-			FadeStart = PlayingTime;
-			RecalcStep = FadePlay ? SampleRate / 100 : 0;
-		}
-		if (RecalcStep && ! (CurSmpl % RecalcStep))
-			CurMstVol = RecalcFadeVolume();
-		
-		if (VGMEnd)
-		{
-			if (! PauseSmpls)
+			// ChipData << 9 [ChipVol] >> 5 << 8 [MstVol] >> 11  ->  9-5+8-11 = <<1
+			TempBuf.Left = ((MixBuf[BlkSmpl].Left >> 5) * CurMstVol) >> 11;
+			TempBuf.Right = ((MixBuf[BlkSmpl].Right >> 5) * CurMstVol) >> 11;
+			if (SurroundSound)
+				TempBuf.Right *= -1;
+			Buffer[CurSmpl].Left = Limit2Short(TempBuf.Left);
+			Buffer[CurSmpl].Right = Limit2Short(TempBuf.Right);
+			
+			if (FadePlay && ! FadeStart)
 			{
-				//if (! FullBufFill)
-				if (! EndPlay)
-				{
-					EndPlay = true;
-					break;
-				}
+				FadeStart = PlayingTime;
+				RecalcStep = FadePlay ? SampleRate / 100 : 0;
 			}
-			else //if (PauseSmpls)
+			if (RecalcStep && ! (CurSmpl % RecalcStep))
+				CurMstVol = RecalcFadeVolume();
+			
+			if (VGMEnd)
 			{
-				PauseSmpls --;
+				if (! PauseSmpls)
+				{
+					//if (! FullBufFill)
+					if (! EndPlay)
+					{
+						EndPlay = true;
+						return CurSmpl;
+					}
+				}
+				else //if (PauseSmpls)
+				{
+					PauseSmpls --;
+				}
 			}
 		}
 	}
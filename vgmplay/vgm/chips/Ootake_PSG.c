@@ -710,6 +710,7 @@ PSG_Init(
 	info = (huc6280_state*)malloc(sizeof(huc6280_state));
 	if (info == NULL)
 		return NULL;
+	chip_state_add(info, sizeof(huc6280_state));
 	
 	info->PSG_FRQ = clock & 0x7FFFFFFF;
 	PSG_SetHoneyInTheSky(info, (clock >> 31) & 0x01);
@@ -82,6 +82,7 @@ int device_start_ayxx(UINT8 ChipID, int clock, UINT8 chip_type, UINT8 Flags)
 		info->chip = PSG_new(clock, rate);
 		if (info->chip == NULL)
 			return 0;
+		chip_state_add(info->chip, sizeof(PSG));
 		PSG_setVolumeMode((PSG*)info->chip, (chip_type & 0x10) ? 1 : 2);
 		PSG_setFlags((PSG*)info->chip, Flags & ~YM2149_PIN26_LOW);
 		break;
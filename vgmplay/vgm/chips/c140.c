@@ -505,6 +505,7 @@ int device_start_c140(UINT8 ChipID, int clock, int banking_type)
 		return 0;
 	
 	info = &C140Data[ChipID];
+	chip_state_add(info, sizeof(c140_state));
 	
 	//info->sample_rate=info->baserate=device->clock();
 	if (clock < 1000000)
@@ -287,6 +287,7 @@ UINT8 device_start_daccontrol(UINT8 ChipID)
 		return 0;
 	
 	chip = &DACData[ChipID];
+	chip_state_add(chip, sizeof(dac_control));
 	
 	chip->DstChipType = 0xFF;
 	chip->DstChipID = 0x00;
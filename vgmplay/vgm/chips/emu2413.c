@@ -1002,6 +1002,7 @@ OPLL_new (e_uint32 clk, e_uint32 rate)
   opll = (OPLL *) calloc (sizeof (OPLL), 1);
   if (opll == NULL)
     return NULL;
+  chip_state_add(opll, sizeof(OPLL));
 
   opll->vrc7_mode = 0x00;
 
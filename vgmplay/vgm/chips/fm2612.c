@@ -2498,6 +2498,7 @@ void * ym2612_init(void *param, int clock, int rate,
 	if (F2612 == NULL)
 		return NULL;
 	memset(F2612, 0x00, sizeof(YM2612));
+	chip_state_add(F2612, sizeof(YM2612));
 	/* allocate total level table (128kb space) */
 	init_tables();
 
@@ -1192,6 +1192,7 @@ int device_start_gameboy_sound(UINT8 ChipID, int clock)
 	
 	gb = &GBSoundData[ChipID];
 	memset(gb, 0x00, sizeof(gb_sound_t));
+	chip_state_add(gb, sizeof(gb_sound_t));
 
 	gb->rate = (clock & 0x7FFFFFFF) / 64;
 	if (((CHIP_SAMPLING_MODE & 0x01) && gb->rate < CHIP_SAMPLE_RATE) ||
@@ -156,6 +156,7 @@ int device_start_k051649(UINT8 ChipID, int clock)
 		return 0;
 	
 	info = &SCC1Data[ChipID];
+	chip_state_add(info, sizeof(k051649_state));
 	/* get stream channels */
 	//info->rate = device->clock()/16;
 	//info->stream = stream_create(device, 0, 1, info->rate, info, k051649_update);
@@ -63,4 +63,8 @@ extern stream_sample_t* DUMMYBUF[];
 
 typedef void (*SRATE_CALLBACK)(void*, UINT32);
 
+// registers memory that holds the state of a sound chip
+// (used by VGMPlay to save seek checkpoints)
+void chip_state_add(void* Ptr, UINT32 Size);
+
 #endif	// __MAMEDEF_H__
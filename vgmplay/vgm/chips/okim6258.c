@@ -301,6 +301,7 @@ int device_start_okim6258(UINT8 ChipID, int clock, int divider, int adpcm_type,
 		return 0;
 	
 	info = &OKIM6258Data[ChipID];
+	chip_state_add(info, sizeof(okim6258_state));
 	
 	compute_tables();
 
@@ -429,6 +429,7 @@ int device_start_okim6295(UINT8 ChipID, int clock)
 		return 0;
 	
 	info = &OKIM6295Data[ChipID];
+	chip_state_add(info, sizeof(okim6295_state));
 	
 	compute_tables();
 
@@ -363,6 +363,7 @@ int device_start_pwm(UINT8 ChipID, int clock)
 		CHIP_SAMPLING_MODE == 0x02)
 		rate = CHIP_SAMPLE_RATE;
 	chip->clock = clock;
+	chip_state_add(chip, sizeof(pwm_chip));
 	
 	PWM_Init(chip);
 	/* allocate the stream */
@@ -141,6 +141,7 @@ int device_start_qsound_ctr(UINT8 ChipID, int clock)
 	struct qsound_chip* chip = &QSoundData[ChipID];
 	
 	memset(chip,0,sizeof(*chip));
+	chip_state_add(chip, sizeof(*chip));
 	
 	chip->romData = NULL;
 	chip->romSize = 0x00;
@@ -238,6 +238,8 @@ int device_start_rf5c68(UINT8 ChipID, int clock)
 	
 	chip->datasize = 0x10000;
 	chip->data = (UINT8*)malloc(chip->datasize);
+	chip_state_add(chip, sizeof(rf5c68_state));
+	chip_state_add(chip->data, chip->datasize);
 	
 	/* allocate the stream */
 	//chip->stream = stream_create(device, 0, 2, device->clock / 384, chip, rf5c68_update);
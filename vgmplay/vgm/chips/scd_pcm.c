@@ -72,6 +72,8 @@ int PCM_Init(UINT8 ChipID, int Rate)
 	
 	chip->RAMSize = 64 * 1024;
 	chip->RAM = (unsigned char*)malloc(chip->RAMSize);
+	chip_state_add(chip, sizeof(struct pcm_chip_));
+	chip_state_add(chip->RAM, chip->RAMSize);
 	PCM_Reset(ChipID);
 	PCM_Set_Rate(ChipID, Rate);
 	
@@ -227,6 +227,8 @@ int device_start_segapcm(UINT8 ChipID, int clock, int intf_bank)
 	spcm->romusage = malloc(STD_ROM_SIZE);
 #endif
 	spcm->ram = (UINT8*)malloc(0x800);
+	chip_state_add(spcm, sizeof(segapcm_state));
+	chip_state_add(spcm->ram, 0x800);
 	
 #ifndef _DEBUG
 	//memset(spcm->rom, 0xFF, STD_ROM_SIZE);
@@ -50,6 +50,7 @@ SN76489_Context* SN76489_Init( int PSGClockValue, int SamplingRate)
 	SN76489_Context* chip = (SN76489_Context*)malloc(sizeof(SN76489_Context));
 	if(chip)
 	{
+		chip_state_add(chip, sizeof(SN76489_Context));
 		chip->dClock=(float)(PSGClockValue & 0x7FFFFFF)/16/SamplingRate;
 		
 		SN76489_SetMute(chip, MUTE_ALLON);
@@ -651,6 +651,7 @@ unsigned long int sn76496_start(void **chip, int clock, int shiftregwidth, int n
 	if (sn_chip == NULL)
 		return 0;
 	memset(sn_chip, 0x00, sizeof(sn76496_state));
+	chip_state_add(sn_chip, sizeof(sn76496_state));
 	*chip = sn_chip;
 	
 	// extract single noise tap bits
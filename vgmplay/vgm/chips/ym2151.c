@@ -1528,6 +1528,7 @@ void * ym2151_init(int clock, int rate)
 		return NULL;
 
 	memset(PSG, 0, sizeof(YM2151));
+	chip_state_add(PSG, sizeof(YM2151));
 
 	//ym2151_state_save_register( PSG, device );
 
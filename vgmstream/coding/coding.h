@@ -3,6 +3,26 @@
 
 #include "../vgmstream.h"
 
+/* For decoders that walk through a channel's bytes: gives a pointer to size
+ * bytes at offset+index, fetched a chunk at a time up to offset+end (or
+ * straight from the file when it is mapped in memory). */
+typedef struct {
+    uint8_t buf[0x200];
+    const uint8_t * data;
+    off_t start, end;
+} decode_span;
+
+static inline const uint8_t * get_decode_span(decode_span * span, STREAMFILE * streamfile, off_t offset, off_t index, size_t size, off_t end) {
+    if (!span->data || index < span->start || index+(off_t)size > span->end) {
+        span->start = index;
+        span->end = end;
+        if (span->end > span->start+(off_t)sizeof(span->buf)) span->end = span->start+sizeof(span->buf);
+        if (span->end < index+(off_t)size) span->end = index+size;
+        span->data = read_streamfile_span(span->buf,offset+span->start,span->end-span->start,streamfile);
+    }
+    return span->data+(index-span->start);
+}
+
 void decode_adx(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do);
 void decode_adx_enc(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do);
 
@@ -34,7 +54,7 @@ void decode_ms_ima(VGMSTREAM * vgmstream,VGMSTREAMCHANNEL * stream, sample * out
 void decode_ngc_afc(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do);
 
 void decode_ngc_dsp(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do);
-void decode_ngc_dsp_mem(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do, uint8_t * mem);
+void decode_ngc_dsp_frame(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do, const uint8_t * frame);
 
 int32_t dsp_nibbles_to_samples(int32_t nibbles);
 
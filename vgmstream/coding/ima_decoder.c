@@ -32,15 +32,19 @@ void decode_nds_ima(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspaci
     int32_t sample_count;
     int32_t hist1 = stream->adpcm_history1_16;
     int step_index = stream->adpcm_step_index;
+    decode_span span;
+    off_t end = 4+(first_sample+samples_to_do+1)/2;
 
+    span.data = NULL;
     if (first_sample==0) {
-        hist1 = read_16bitLE(stream->offset,stream->streamfile);
-        step_index = read_16bitLE(stream->offset+2,stream->streamfile);
+        const uint8_t * header = get_decode_span(&span,stream->streamfile,stream->offset,0,4,end);
+        hist1 = (int16_t)get_16bitLE(header);
+        step_index = (int16_t)get_16bitLE(header+2);
     }
 
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
         int sample_nibble = 
-                (read_8bit(stream->offset+4+i/2,stream->streamfile) >> (i&1?4:0))&0xf;
+                (*get_decode_span(&span,stream->streamfile,stream->offset,4+i/2,1,end) >> (i&1?4:0))&0xf;
         int delta;
         int step = ADPCMTable[step_index];
 
@@ -427,7 +431,10 @@ void decode_dvi_ima(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspaci
     int32_t sample_count=0;
     int32_t hist1=stream->adpcm_history1_32;
     int step_index = stream->adpcm_step_index;
+    decode_span span;
+    off_t end = (first_sample+samples_to_do+1)/2;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
         int step = ADPCMTable[step_index];
         uint8_t sample_byte;
@@ -435,7 +442,7 @@ void decode_dvi_ima(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspaci
         int sample_decoded;
         int delta;
 
-        sample_byte = read_8bit(stream->offset+i/2,stream->streamfile);
+        sample_byte = *get_decode_span(&span,stream->streamfile,stream->offset,i/2,1,end);
         /* old-style DVI takes high nibble first */
         sample_nibble = (sample_byte >> (i&1?0:4))&0xf;
 
@@ -515,7 +522,10 @@ void decode_ima(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing,
     int32_t sample_count=0;
     int32_t hist1=stream->adpcm_history1_32;
     int step_index = stream->adpcm_step_index;
+    decode_span span;
+    off_t end = (first_sample+samples_to_do+1)/2;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
         int step = ADPCMTable[step_index];
         uint8_t sample_byte;
@@ -523,7 +533,7 @@ void decode_ima(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing,
         int sample_decoded;
         int delta;
 
-        sample_byte = read_8bit(stream->offset+i/2,stream->streamfile);
+        sample_byte = *get_decode_span(&span,stream->streamfile,stream->offset,i/2,1,end);
         sample_nibble = (sample_byte >> (i&1?4:0))&0xf;
 
         sample_decoded = hist1;
@@ -4,45 +4,60 @@
 void decode_pcm16LE(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do) {
     int i;
     int32_t sample_count;
+    decode_span span;
+    off_t end = (first_sample+samples_to_do)*2;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
-        outbuf[sample_count]=read_16bitLE(stream->offset+i*2,stream->streamfile);
+        outbuf[sample_count]=get_16bitLE(get_decode_span(&span,stream->streamfile,stream->offset,i*2,2,end));
     }
 }
 
 void decode_pcm16BE(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do) {
     int i;
     int32_t sample_count;
+    decode_span span;
+    off_t end = (first_sample+samples_to_do)*2;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
-        outbuf[sample_count]=read_16bitBE(stream->offset+i*2,stream->streamfile);
+        outbuf[sample_count]=get_16bitBE(get_decode_span(&span,stream->streamfile,stream->offset,i*2,2,end));
     }
 }
 
 void decode_pcm8(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do) {
     int i;
     int32_t sample_count;
+    decode_span span;
+    off_t end = first_sample+samples_to_do;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
-        outbuf[sample_count]=read_8bit(stream->offset+i,stream->streamfile)*0x100;
+        outbuf[sample_count]=(int8_t)*get_decode_span(&span,stream->streamfile,stream->offset,i,1,end)*0x100;
     }
 }
 
 void decode_pcm8_int(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do) {
     int i;
     int32_t sample_count;
+    decode_span span;
+    off_t end = (first_sample+samples_to_do-1)*channelspacing+1;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
-        outbuf[sample_count]=read_8bit(stream->offset+i*channelspacing,stream->streamfile)*0x100;
+        outbuf[sample_count]=(int8_t)*get_decode_span(&span,stream->streamfile,stream->offset,i*channelspacing,1,end)*0x100;
     }
 }
 
 void decode_pcm8_sb_int(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do) {
     int i;
     int32_t sample_count;
+    decode_span span;
+    off_t end = (first_sample+samples_to_do-1)*channelspacing+1;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
-        int16_t v = (uint8_t)read_8bit(stream->offset+i*channelspacing,stream->streamfile);
+        int16_t v = *get_decode_span(&span,stream->streamfile,stream->offset,i*channelspacing,1,end);
         if (v&0x80) v = 0-(v&0x7f);
         outbuf[sample_count] = v*0x100;
     }
@@ -51,9 +66,12 @@ void decode_pcm8_sb_int(VGMSTREAMCHANNEL * stream, sample * outbuf, int channels
 void decode_pcm8_unsigned_int(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do) {
     int i;
     int32_t sample_count;
+    decode_span span;
+    off_t end = (first_sample+samples_to_do-1)*channelspacing+1;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
-        int16_t v = (uint8_t)read_8bit(stream->offset+i*channelspacing,stream->streamfile);
+        int16_t v = *get_decode_span(&span,stream->streamfile,stream->offset,i*channelspacing,1,end);
         outbuf[sample_count] = v*0x100 - 0x8000;
     }
 }
@@ -61,9 +79,12 @@ void decode_pcm8_unsigned_int(VGMSTREAMCHANNEL * stream, sample * outbuf, int ch
 void decode_pcm8_unsigned(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do) {
     int i;
     int32_t sample_count;
+    decode_span span;
+    off_t end = first_sample+samples_to_do;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
-        int16_t v = (uint8_t)read_8bit(stream->offset+i,stream->streamfile);
+        int16_t v = *get_decode_span(&span,stream->streamfile,stream->offset,i,1,end);
         outbuf[sample_count] = v*0x100 - 0x8000;
     }
 }
@@ -71,17 +92,23 @@ void decode_pcm8_unsigned(VGMSTREAMCHANNEL * stream, sample * outbuf, int channe
 void decode_pcm16LE_int(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do) {
     int i;
     int32_t sample_count;
+    decode_span span;
+    off_t end = (first_sample+samples_to_do-1)*2*channelspacing+2;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
-        outbuf[sample_count]=read_16bitLE(stream->offset+i*2*channelspacing,stream->streamfile);
+        outbuf[sample_count]=get_16bitLE(get_decode_span(&span,stream->streamfile,stream->offset,i*2*channelspacing,2,end));
     }
 }
 
 void decode_pcm16LE_XOR_int(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing, int32_t first_sample, int32_t samples_to_do) {
     int i;
     int32_t sample_count;
+    decode_span span;
+    off_t end = (first_sample+samples_to_do-1)*2*channelspacing+2;
 
+    span.data = NULL;
     for (i=first_sample,sample_count=0; i<first_sample+samples_to_do; i++,sample_count+=channelspacing) {
-        outbuf[sample_count]=read_16bitLE(stream->offset+i*2*channelspacing,stream->streamfile)^stream->key_xor;
+        outbuf[sample_count]=get_16bitLE(get_decode_span(&span,stream->streamfile,stream->offset,i*2*channelspacing,2,end))^stream->key_xor;
     }
 }
@@ -26,9 +26,12 @@ void decode_psx(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing,
 
 	int framesin = first_sample/28;
 
-	predict_nr = read_8bit(stream->offset+framesin*16,stream->streamfile) >> 4;
-	shift_factor = read_8bit(stream->offset+framesin*16,stream->streamfile) & 0xf;
-	flag = read_8bit(stream->offset+framesin*16+1,stream->streamfile);
+	uint8_t frame_buf[16];
+	const uint8_t * frame = read_streamfile_span(frame_buf,stream->offset+framesin*16,16,stream->streamfile);
+
+	predict_nr = (int8_t)frame[0] >> 4;
+	shift_factor = frame[0] & 0xf;
+	flag = frame[1];
 
 	first_sample = first_sample % 28;
 	
@@ -38,7 +41,7 @@ void decode_psx(VGMSTREAMCHANNEL * stream, sample * outbuf, int channelspacing,
 
 		if(flag<0x07) {
 		
-			short sample_byte = (short)read_8bit(stream->offset+(framesin*16)+2+i/2,stream->streamfile);
+			short sample_byte = (short)(int8_t)frame[2+i/2];
 
 			scale = ((i&1 ?
 				     sample_byte >> 4 :
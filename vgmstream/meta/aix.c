@@ -400,6 +400,7 @@ static STREAMFILE *open_aix_with_STREAMFILE(STREAMFILE *file,off_t start_offset,
   streamfile->sf.get_realname = (void*)get_name_aix;
   streamfile->sf.open = (void*)open_aix_impl;
   streamfile->sf.close = (void*)close_aix;
+  streamfile->sf.get_data = NULL;
 #ifdef PROFILE_STREAMFILE
   streamfile->sf.get_bytes_read = NULL;
   streamfile->sf.get_error_count = NULL;
@@ -171,6 +171,7 @@ STREAMFILE *wrap_bar_STREAMFILE(STREAMFILE *file)
     streamfile->sf.get_realname = (void*)get_realname_bar;
     streamfile->sf.open = (void*)open_bar;
     streamfile->sf.close = (void*)close_bar;
+    streamfile->sf.get_data = NULL;
 #ifdef PROFILE_STREAMFILE
     streamfile->sf.get_bytes_read = get_bytes_read_bar;
     streamfile->sf.get_error_count = get_error_count_bar;
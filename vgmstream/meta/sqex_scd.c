@@ -414,6 +414,7 @@ static STREAMFILE *open_scdint_with_STREAMFILE(STREAMFILE *file, const char * fi
     scd->sf.get_realname = (void*)get_name_scdint;
     scd->sf.open = (void*)open_scdint_impl;
     scd->sf.close = (void*)close_scdint;
+    scd->sf.get_data = NULL;
 
     scd->real_file = file;
     scd->filename = filename;
@@ -1,5 +1,8 @@
 #ifndef _MSC_VER
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 #include "streamfile.h"
 #include "util.h"
@@ -186,6 +189,7 @@ static STREAMFILE * open_stdio_streamfile_buffer_by_FILE(FILE *infile,const char
     streamfile->sf.get_realname = (void*)get_name_stdio;
     streamfile->sf.open = (void*)open_stdio;
     streamfile->sf.close = (void*)close_stdio;
+    streamfile->sf.get_data = NULL;
 #ifdef PROFILE_STREAMFILE
     streamfile->sf.get_bytes_read = (void*)get_bytes_read_stdio;
     streamfile->sf.get_error_count = (void*)get_error_count_stdio;
@@ -216,6 +220,108 @@ STREAMFILE * open_stdio_streamfile_buffer(const char * const filename, size_t bu
     return streamFile;
 }
 
+#ifndef _MSC_VER
+typedef struct {
+    STREAMFILE sf;
+    const uint8_t * data;
+    size_t size;
+    off_t offset; /* of the last read, like the stdio buffer offset */
+    char name[1024];
+} MMAPSTREAMFILE;
+
+static size_t read_mmap(MMAPSTREAMFILE *streamfile,uint8_t * dest, off_t offset, size_t length) {
+    if (!streamfile || !dest || length<=0 || offset<0) return 0;
+
+    streamfile->offset = offset;
+    if (offset >= streamfile->size) return 0;
+    if (length > streamfile->size-offset) length = streamfile->size-offset;
+
+    memcpy(dest,streamfile->data+offset,length);
+    return length;
+}
+
+static const uint8_t * get_data_mmap(MMAPSTREAMFILE *streamfile, off_t offset, size_t length) {
+    if (offset<0 || offset > streamfile->size || length > streamfile->size-offset) return NULL;
+    return streamfile->data+offset;
+}
+
+static void close_mmap(MMAPSTREAMFILE * streamfile) {
+    munmap((void*)streamfile->data,streamfile->size);
+    free(streamfile);
+}
+
+static size_t get_size_mmap(MMAPSTREAMFILE * streamfile) {
+    return streamfile->size;
+}
+
+static off_t get_offset_mmap(MMAPSTREAMFILE *streamFile) {
+    return streamFile->offset;
+}
+
+static void get_name_mmap(MMAPSTREAMFILE *streamfile,char *buffer,size_t length) {
+    strncpy(buffer,streamfile->name,length);
+    buffer[length-1]='\0';
+}
+
+static STREAMFILE *open_mmap(MMAPSTREAMFILE *streamFile,const char * const filename,size_t buffersize) {
+    if (!filename)
+        return NULL;
+
+    return open_mmap_streamfile(filename);
+}
+
+STREAMFILE * open_mmap_streamfile(const char * const filename) {
+    int fd;
+    struct stat st;
+    void * data;
+    MMAPSTREAMFILE * streamfile;
+
+    fd = open(filename,O_RDONLY);
+    if (fd < 0) return NULL;
+
+    /* empty or special files can't be mapped, read them the normal way */
+    if (fstat(fd,&st) || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+        close(fd);
+        return open_stdio_streamfile(filename);
+    }
+
+    data = mmap(NULL,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+    close(fd);
+    if (data == MAP_FAILED) return open_stdio_streamfile(filename);
+
+    streamfile = calloc(1,sizeof(MMAPSTREAMFILE));
+    if (!streamfile) {
+        munmap(data,st.st_size);
+        return NULL;
+    }
+
+    streamfile->sf.read = (void*)read_mmap;
+    streamfile->sf.get_size = (void*)get_size_mmap;
+    streamfile->sf.get_offset = (void*)get_offset_mmap;
+    streamfile->sf.get_name = (void*)get_name_mmap;
+    streamfile->sf.get_realname = (void*)get_name_mmap;
+    streamfile->sf.open = (void*)open_mmap;
+    streamfile->sf.close = (void*)close_mmap;
+    streamfile->sf.get_data = (void*)get_data_mmap;
+#ifdef PROFILE_STREAMFILE
+    streamfile->sf.get_bytes_read = NULL;
+    streamfile->sf.get_error_count = NULL;
+#endif
+
+    streamfile->data = data;
+    streamfile->size = st.st_size;
+
+    strncpy(streamfile->name,filename,sizeof(streamfile->name));
+    streamfile->name[sizeof(streamfile->name)-1] = '\0';
+
+    return &streamfile->sf;
+}
+#else
+STREAMFILE * open_mmap_streamfile(const char * const filename) {
+    return open_stdio_streamfile(filename);
+}
+#endif
+
 /* Read a line into dst. The source files are MS-DOS style,
  * separated (not terminated) by CRLF. Return 1 if the full line was
  * retrieved (if it could fit in dst), 0 otherwise. In any case the result
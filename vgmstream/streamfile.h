@@ -46,6 +46,9 @@ typedef struct _STREAMFILE {
     struct _STREAMFILE * (*open)(struct _STREAMFILE *,const char * const filename,size_t buffersize);
 
     void (*close)(struct _STREAMFILE *);
+    // for streamfiles that hold the whole file in memory, NULL otherwise:
+    // pointer to length bytes at offset, or NULL if out of bounds
+    const uint8_t * (*get_data)(struct _STREAMFILE *,off_t offset,size_t length);
 #ifdef PROFILE_STREAMFILE
     size_t (*get_bytes_read)(struct _STREAMFILE *);
     int (*get_error_count)(struct _STREAMFILE *);
@@ -71,6 +74,25 @@ static inline size_t get_streamfile_size(STREAMFILE * streamfile) {
     return streamfile->get_size(streamfile);
 }
 
+/* get length bytes at offset as a pointer, for decoding straight from memory
+*
+* Streamfiles that have the file mapped give a pointer into the mapping,
+* others read into buf, which must hold length bytes. Bytes past the end of
+* the file come out as 0xff, the same as read_8bit failing.
+*/
+static inline const uint8_t * read_streamfile_span(uint8_t * buf, off_t offset, size_t length, STREAMFILE * streamfile) {
+    size_t length_read;
+
+    if (streamfile->get_data) {
+        const uint8_t * data = streamfile->get_data(streamfile,offset,length);
+        if (data) return data;
+    }
+
+    length_read = read_streamfile(buf,offset,length,streamfile);
+    if (length_read < length) memset(buf+length_read,0xff,length-length_read);
+    return buf;
+}
+
 #ifdef PROFILE_STREAMFILE
 /* return how many bytes we read into buffers */
 static inline size_t get_streamfile_bytes_read(STREAMFILE * streamfile) {
@@ -138,6 +160,13 @@ static inline STREAMFILE * open_stdio_streamfile(const char * const filename) {
     return open_stdio_streamfile_buffer(filename,STREAMFILE_DEFAULT_BUFFER_SIZE);
 }
 
+/* open file mapped in memory, so decoders can read it without copying,
+* falls back to open_stdio_streamfile if the file can't be mapped
+*
+* Returns pointer to new STREAMFILE or NULL if open failed
+*/
+STREAMFILE * open_mmap_streamfile(const char * const filename);
+
 size_t get_streamfile_dos_line(int dst_length, char * dst, off_t offset,
                 STREAMFILE * infile, int *line_done_ptr);
 
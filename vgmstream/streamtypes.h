@@ -10,6 +10,7 @@
 #include <pstdint.h>
 #define inline _inline
 #define strcasecmp _stricmp
+#define strncasecmp _strnicmp
 #define snprintf _snprintf
 #else
 #include <stdint.h>
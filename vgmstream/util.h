@@ -9,21 +9,21 @@
 
 /* host endian independent multi-byte integer reading */
 
-static inline unsigned short get_16bitBE(uint8_t * p) {
+static inline unsigned short get_16bitBE(const uint8_t * p) {
     return ((p[0] & 0xff)<<8) | (p[1] & 0xff);
 }
 
-static inline unsigned short get_16bitLE(uint8_t * p) {
+static inline unsigned short get_16bitLE(const uint8_t * p) {
     return (p[0] & 0xff) | ((p[1] & 0xff)<<8);
 }
 
-static inline unsigned int get_32bitBE(uint8_t * p) {
+static inline unsigned int get_32bitBE(const uint8_t * p) {
 
     //return (p[0]<<24) | (p[1]<<16) | (p[2]<<8) | (p[3]);
 	return ((p[0] & 0xff)<<24) | ((p[1] & 0xff)<<16) | ((p[2] & 0xff)<<8) | (p[3] & 0xff);
 }
 
-static inline unsigned int get_32bitLE(uint8_t * p) {
+static inline unsigned int get_32bitLE(const uint8_t * p) {
     return (p[0] & 0xff) | ((p[1] & 0xff)<<8) | ((p[2] & 0xff)<<16) | ((p[3] & 0xff)<<24);
 }
 
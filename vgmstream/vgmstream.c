@@ -12,330 +12,364 @@
 
 /*
  * List of functions that will recognize files. These should correspond pretty
- * directly to the metadata types
+ * directly to the metadata types.
+ * Next to each function are the extensions it checks for before looking at the
+ * header (NULL if it only checks the header), so detection only has to call
+ * the functions that can accept the file. Keep them in sync with the checks.
  */
-VGMSTREAM * (*init_vgmstream_fcns[])(STREAMFILE *streamFile) = {
-    init_vgmstream_adx,
-    init_vgmstream_brstm,
-    init_vgmstream_nds_strm,
-    init_vgmstream_agsc,
-    init_vgmstream_ngc_adpdtk,
-    init_vgmstream_rsf,
-    init_vgmstream_afc,
-    init_vgmstream_ast,
-    init_vgmstream_halpst,
-    init_vgmstream_rs03,
-    init_vgmstream_ngc_dsp_std,
-    init_vgmstream_Cstr,
-    init_vgmstream_gcsw,
-    init_vgmstream_ps2_ads,
-    init_vgmstream_ps2_npsf,
-    init_vgmstream_rwsd,
-    init_vgmstream_cdxa,
-    init_vgmstream_ps2_rxw,
-    init_vgmstream_ps2_int,
-    init_vgmstream_ngc_dsp_stm,
-    init_vgmstream_ps2_exst,
-    init_vgmstream_ps2_svag,
-    init_vgmstream_ps2_mib,
-    init_vgmstream_ngc_mpdsp,
-    init_vgmstream_ps2_mic,
-    init_vgmstream_ngc_dsp_std_int,
-    init_vgmstream_raw,
-    init_vgmstream_ps2_vag,
-    init_vgmstream_psx_gms,
-    init_vgmstream_ps2_str,
-    init_vgmstream_ps2_ild,
-    init_vgmstream_ps2_pnb,
-    init_vgmstream_xbox_wavm,
-    init_vgmstream_xbox_xwav,
-    init_vgmstream_ngc_str,
-    init_vgmstream_ea,
-    init_vgmstream_caf,
-    init_vgmstream_ps2_vpk,
-    init_vgmstream_genh,
+typedef struct {
+    VGMSTREAM * (*init)(STREAMFILE *streamFile);
+    const char * extensions; /* comma separated, lowercase */
+} init_vgmstream_fcn;
+
+static const init_vgmstream_fcn init_vgmstream_fcns[] = {
+    {init_vgmstream_adx, "adx"},
+    {init_vgmstream_brstm, "brstm,brstmspm"},
+    {init_vgmstream_nds_strm, "strm"},
+    {init_vgmstream_agsc, "agsc"},
+    {init_vgmstream_ngc_adpdtk, "adp,dtk"},
+    {init_vgmstream_rsf, "rsf"},
+    {init_vgmstream_afc, "afc"},
+    {init_vgmstream_ast, "ast"},
+    {init_vgmstream_halpst, "hps"},
+    {init_vgmstream_rs03, "dsp"},
+    {init_vgmstream_ngc_dsp_std, "dsp"},
+    {init_vgmstream_Cstr, "dsp"},
+    {init_vgmstream_gcsw, "gcw"},
+    {init_vgmstream_ps2_ads, "ads,ss2"},
+    {init_vgmstream_ps2_npsf, "npsf"},
+    {init_vgmstream_rwsd, "rwsd,rwar,rwav,bcwav,bms"},
+    {init_vgmstream_cdxa, "xa"},
+    {init_vgmstream_ps2_rxw, "rxw"},
+    {init_vgmstream_ps2_int, "int,wp2"},
+    {init_vgmstream_ngc_dsp_stm, "stm,dsp"},
+    {init_vgmstream_ps2_exst, "sts"},
+    {init_vgmstream_ps2_svag, "svag"},
+    {init_vgmstream_ps2_mib, "mib,mi4,vb,xag"},
+    {init_vgmstream_ngc_mpdsp, "mpdsp"},
+    {init_vgmstream_ps2_mic, "mic"},
+    {init_vgmstream_ngc_dsp_std_int, "dsp,mss,gcm"},
+    {init_vgmstream_raw, "raw"},
+    {init_vgmstream_ps2_vag, "vag"},
+    {init_vgmstream_psx_gms, "gms"},
+    {init_vgmstream_ps2_str, "str"},
+    {init_vgmstream_ps2_ild, "ild"},
+    {init_vgmstream_ps2_pnb, "pnb"},
+    {init_vgmstream_xbox_wavm, "wavm"},
+    {init_vgmstream_xbox_xwav, "xwav"},
+    {init_vgmstream_ngc_str, "str"},
+    {init_vgmstream_ea, "strm,xa,sng,asf,str,xsf,eam"},
+    {init_vgmstream_caf, "cfn"},
+    {init_vgmstream_ps2_vpk, "vpk"},
+    {init_vgmstream_genh, "genh"},
 #ifdef VGM_USE_VORBIS
-    init_vgmstream_ogg_vorbis,
-    init_vgmstream_sli_ogg,
-    init_vgmstream_sfl,
+    {init_vgmstream_ogg_vorbis, "logg,ogg,um3,kovs"},
+    {init_vgmstream_sli_ogg, "sli"},
+    {init_vgmstream_sfl, "sfl"},
 #endif
-    init_vgmstream_sadb,
-    init_vgmstream_ps2_bmdx,
-    init_vgmstream_wsi,
-    init_vgmstream_aifc,
-    init_vgmstream_str_snds,
-    init_vgmstream_ws_aud,
+    {init_vgmstream_sadb, "sad"},
+    {init_vgmstream_ps2_bmdx, "bmdx"},
+    {init_vgmstream_wsi, "wsi"},
+    {init_vgmstream_aifc, "aifc,afc,aifcl,cbd2,aiff,aif,aiffl"},
+    {init_vgmstream_str_snds, "str"},
+    {init_vgmstream_ws_aud, "aud"},
 #ifdef VGM_USE_MPEG
-    init_vgmstream_ahx,
+    {init_vgmstream_ahx, "ahx"},
 #endif
-    init_vgmstream_ivb,
-    init_vgmstream_amts,
-    init_vgmstream_svs,
-    init_vgmstream_riff,
-    init_vgmstream_rifx,
-    init_vgmstream_pos,
-    init_vgmstream_nwa,
-    init_vgmstream_eacs,
-    init_vgmstream_xss,
-    init_vgmstream_sl3,
-    init_vgmstream_hgc1,
-    init_vgmstream_aus,
-    init_vgmstream_rws,
-    init_vgmstream_fsb1,
+    {init_vgmstream_ivb, "ivb"},
+    {init_vgmstream_amts, "amts"},
+    {init_vgmstream_svs, "svs"},
+    {init_vgmstream_riff, "wav,lwav,mwv,sns"},
+    {init_vgmstream_rifx, "wav,lwav"},
+    {init_vgmstream_pos, "pos"},
+    {init_vgmstream_nwa, "nwa"},
+    {init_vgmstream_eacs, "cnk,as4,asf"},
+    {init_vgmstream_xss, "xss"},
+    {init_vgmstream_sl3, "sl3"},
+    {init_vgmstream_hgc1, "hgc1"},
+    {init_vgmstream_aus, "aus"},
+    {init_vgmstream_rws, "rws"},
+    {init_vgmstream_fsb1, "fsb"},
     // init_vgmstream_fsb2,
-    init_vgmstream_fsb3,
-    init_vgmstream_fsb4,
-    init_vgmstream_fsb4_wav,
-    init_vgmstream_rwx,
-    init_vgmstream_xwb,
-    init_vgmstream_xwb2,
-    init_vgmstream_xa30,
-    init_vgmstream_musc,
-    init_vgmstream_musx_v004,
-    init_vgmstream_musx_v005,
-    init_vgmstream_musx_v006,
-    init_vgmstream_musx_v010,
-    init_vgmstream_musx_v201,
-    init_vgmstream_leg,
-    init_vgmstream_filp,
-    init_vgmstream_ikm,
-    init_vgmstream_sfs,
-    init_vgmstream_bg00,
-    init_vgmstream_dvi,
-    init_vgmstream_kcey,
-    init_vgmstream_ps2_rstm,
-    init_vgmstream_acm,
-    init_vgmstream_mus_acm,
-    init_vgmstream_ps2_kces,
-    init_vgmstream_ps2_dxh,
-    init_vgmstream_ps2_psh,
-    init_vgmstream_pcm_scd,
-	  init_vgmstream_pcm_ps2,
-    init_vgmstream_ps2_rkv,
-    init_vgmstream_ps2_psw,
-    init_vgmstream_ps2_vas,
-    init_vgmstream_ps2_tec,
-    init_vgmstream_ps2_enth,
-    init_vgmstream_sdt,
-    init_vgmstream_aix,
-    init_vgmstream_ngc_tydsp,
-    init_vgmstream_ngc_swd,
-    init_vgmstream_capdsp,
-    init_vgmstream_xbox_wvs,
-    init_vgmstream_ngc_wvs,
-    init_vgmstream_dc_str,
-    init_vgmstream_dc_str_v2,
-    init_vgmstream_xbox_stma,
-    init_vgmstream_xbox_matx,
-    init_vgmstream_de2,
-    init_vgmstream_vs,
-    init_vgmstream_dc_str,
-    init_vgmstream_dc_str_v2,
-    init_vgmstream_xbox_xmu,
-    init_vgmstream_xbox_xvas,
-    init_vgmstream_ngc_bh2pcm,
-    init_vgmstream_sat_sap,
-    init_vgmstream_dc_idvi,
-    init_vgmstream_ps2_rnd,
-    init_vgmstream_wii_idsp,
-    init_vgmstream_kraw,
-    init_vgmstream_ps2_omu,
-    init_vgmstream_ps2_xa2,
+    {init_vgmstream_fsb3, "fsb"},
+    {init_vgmstream_fsb4, "fsb,wii"},
+    {init_vgmstream_fsb4_wav, "fsb"},
+    {init_vgmstream_rwx, "rwx"},
+    {init_vgmstream_xwb, "xwb"},
+    {init_vgmstream_xwb2, "xwb"},
+    {init_vgmstream_xa30, "xa30"},
+    {init_vgmstream_musc, "mus,musc"},
+    {init_vgmstream_musx_v004, "musx"},
+    {init_vgmstream_musx_v005, "musx"},
+    {init_vgmstream_musx_v006, "musx"},
+    {init_vgmstream_musx_v010, "musx"},
+    {init_vgmstream_musx_v201, "musx"},
+    {init_vgmstream_leg, "leg"},
+    {init_vgmstream_filp, "filp"},
+    {init_vgmstream_ikm, "ikm"},
+    {init_vgmstream_sfs, "sfs"},
+    {init_vgmstream_bg00, "bg00"},
+    {init_vgmstream_dvi, "dvi"},
+    {init_vgmstream_kcey, "kcey"},
+    {init_vgmstream_ps2_rstm, "rstm"},
+    {init_vgmstream_acm, "acm"},
+    {init_vgmstream_mus_acm, "mus"},
+    {init_vgmstream_ps2_kces, "kces,vig"},
+    {init_vgmstream_ps2_dxh, "dxh"},
+    {init_vgmstream_ps2_psh, "psh"},
+    {init_vgmstream_pcm_scd, "pcm"},
+	  {init_vgmstream_pcm_ps2, "pcm"},
+    {init_vgmstream_ps2_rkv, "rkv"},
+    {init_vgmstream_ps2_psw, "psw"},
+    {init_vgmstream_ps2_vas, "vas"},
+    {init_vgmstream_ps2_tec, "tec"},
+    {init_vgmstream_ps2_enth, "enth"},
+    {init_vgmstream_sdt, "sdt"},
+    {init_vgmstream_aix, "aix"},
+    {init_vgmstream_ngc_tydsp, "tydsp"},
+    {init_vgmstream_ngc_swd, "swd"},
+    {init_vgmstream_capdsp, "capdsp"},
+    {init_vgmstream_xbox_wvs, "wvs"},
+    {init_vgmstream_ngc_wvs, "wvs"},
+    {init_vgmstream_dc_str, "str"},
+    {init_vgmstream_dc_str_v2, "str"},
+    {init_vgmstream_xbox_stma, "stma"},
+    {init_vgmstream_xbox_matx, "matx"},
+    {init_vgmstream_de2, "de2"},
+    {init_vgmstream_vs, "vs"},
+    {init_vgmstream_dc_str, "str"},
+    {init_vgmstream_dc_str_v2, "str"},
+    {init_vgmstream_xbox_xmu, "xmu"},
+    {init_vgmstream_xbox_xvas, "xvas"},
+    {init_vgmstream_ngc_bh2pcm, "bh2pcm"},
+    {init_vgmstream_sat_sap, "sap"},
+    {init_vgmstream_dc_idvi, "idvi"},
+    {init_vgmstream_ps2_rnd, "rnd"},
+    {init_vgmstream_wii_idsp, "gcm,idsp"},
+    {init_vgmstream_kraw, "kraw"},
+    {init_vgmstream_ps2_omu, "omu"},
+    {init_vgmstream_ps2_xa2, "xa2"},
     //init_vgmstream_idsp,
-    init_vgmstream_idsp2,
-    init_vgmstream_idsp3,
-    init_vgmstream_idsp4,
-    init_vgmstream_ngc_ymf,
-    init_vgmstream_sadl,
-    init_vgmstream_ps2_ccc,
-    init_vgmstream_psx_fag,
-    init_vgmstream_ps2_mihb,
-    init_vgmstream_ngc_pdt,
-    init_vgmstream_wii_mus,
-    init_vgmstream_dc_asd,
-    init_vgmstream_naomi_spsd,
-
-    init_vgmstream_rsd2vag,
-    init_vgmstream_rsd2pcmb,
-    init_vgmstream_rsd2xadp,
-	init_vgmstream_rsd3vag,
-	init_vgmstream_rsd3gadp,
-    init_vgmstream_rsd3pcm,
-	init_vgmstream_rsd3pcmb,
-    init_vgmstream_rsd4pcmb,
-    init_vgmstream_rsd4pcm,
-	init_vgmstream_rsd4radp,
-    init_vgmstream_rsd4vag,
-    init_vgmstream_rsd6vag,
-    init_vgmstream_rsd6wadp,
-    init_vgmstream_rsd6xadp,
-    init_vgmstream_rsd6radp,
-    init_vgmstream_bgw,
-    init_vgmstream_spw,
-    init_vgmstream_ps2_ass,
-    init_vgmstream_waa_wac_wad_wam,
-    init_vgmstream_seg,
-    init_vgmstream_nds_strm_ffta2,
-    init_vgmstream_str_asr,
-    init_vgmstream_zwdsp,
-    init_vgmstream_gca,
-    init_vgmstream_spt_spd,
-    init_vgmstream_ish_isd,
-    init_vgmstream_gsp_gsb,
-    init_vgmstream_ydsp,
-    init_vgmstream_msvp,
-    init_vgmstream_ngc_ssm,
-    init_vgmstream_ps2_joe,
-    init_vgmstream_vgs,
-    init_vgmstream_dc_dcsw_dcs,
-    init_vgmstream_wii_smp,
-    init_vgmstream_emff_ps2,
-    init_vgmstream_emff_ngc,
-    init_vgmstream_ss_stream,
-    init_vgmstream_thp,
-    init_vgmstream_wii_sts,
-    init_vgmstream_ps2_p2bt,
-    init_vgmstream_ps2_gbts,
-    init_vgmstream_wii_sng,
-    init_vgmstream_ngc_dsp_iadp,
-    init_vgmstream_aax,
-    init_vgmstream_utf_dsp,
-    init_vgmstream_ngc_ffcc_str,
-    init_vgmstream_sat_baka,
-    init_vgmstream_nds_swav,
-    init_vgmstream_ps2_vsf,
-    init_vgmstream_nds_rrds,
-    init_vgmstream_ps2_tk5,
-    init_vgmstream_ps2_vsf_tta,
-    init_vgmstream_ads,
-    init_vgmstream_wii_str,
-    init_vgmstream_ps2_mcg,
-    init_vgmstream_zsd,
-    init_vgmstream_ps2_vgs,
-    init_vgmstream_RedSpark,
-    init_vgmstream_ivaud,
-    init_vgmstream_wii_wsd,
-    init_vgmstream_wii_ndp,
-    init_vgmstream_ps2_sps,
-    init_vgmstream_ps2_xa2_rrp,
-    init_vgmstream_nds_hwas,
-	  init_vgmstream_ngc_lps,
-    init_vgmstream_ps2_snd,
-    init_vgmstream_naomi_adpcm,
-	  init_vgmstream_sd9,
-	  init_vgmstream_2dx9,
-	  init_vgmstream_dsp_ygo,
-    init_vgmstream_ps2_vgv,
-    init_vgmstream_ngc_gcub,
-    init_vgmstream_maxis_xa,
-    init_vgmstream_ngc_sck_dsp,
-    init_vgmstream_apple_caff,
-	  init_vgmstream_pc_mxst,
-	  init_vgmstream_sab,
-    init_vgmstream_exakt_sc,
-    init_vgmstream_wii_bns,
-    init_vgmstream_wii_was,
-    init_vgmstream_pona_3do,
-    init_vgmstream_pona_psx,
-    init_vgmstream_xbox_hlwav,
-    init_vgmstream_stx,
-    init_vgmstream_ps2_stm,
-    init_vgmstream_myspd,
-    init_vgmstream_his,
-	  init_vgmstream_ps2_ast,
-	  init_vgmstream_dmsg,
-    init_vgmstream_ngc_dsp_aaap,
-    init_vgmstream_ngc_dsp_konami,
-    init_vgmstream_ps2_ster,
-    init_vgmstream_ps2_wb,
-    init_vgmstream_bnsf,
+    {init_vgmstream_idsp2, "idsp"},
+    {init_vgmstream_idsp3, "idsp"},
+    {init_vgmstream_idsp4, "idsp"},
+    {init_vgmstream_ngc_ymf, "ymf"},
+    {init_vgmstream_sadl, "sad"},
+    {init_vgmstream_ps2_ccc, "ccc"},
+    {init_vgmstream_psx_fag, "fag"},
+    {init_vgmstream_ps2_mihb, "mihb"},
+    {init_vgmstream_ngc_pdt, "pdt"},
+    {init_vgmstream_wii_mus, "mus"},
+    {init_vgmstream_dc_asd, "asd"},
+    {init_vgmstream_naomi_spsd, "spsd"},
+
+    {init_vgmstream_rsd2vag, "rsd"},
+    {init_vgmstream_rsd2pcmb, "rsd"},
+    {init_vgmstream_rsd2xadp, "rsd"},
+	{init_vgmstream_rsd3vag, "rsd"},
+	{init_vgmstream_rsd3gadp, "rsd"},
+    {init_vgmstream_rsd3pcm, "rsd"},
+	{init_vgmstream_rsd3pcmb, "rsd"},
+    {init_vgmstream_rsd4pcmb, "rsd"},
+    {init_vgmstream_rsd4pcm, "rsd"},
+	{init_vgmstream_rsd4radp, "rsd"},
+    {init_vgmstream_rsd4vag, "rsd"},
+    {init_vgmstream_rsd6vag, "rsd"},
+    {init_vgmstream_rsd6wadp, "rsd"},
+    {init_vgmstream_rsd6xadp, "rsd"},
+    {init_vgmstream_rsd6radp, "rsd"},
+    {init_vgmstream_bgw, "bgw"},
+    {init_vgmstream_spw, "spw"},
+    {init_vgmstream_ps2_ass, "ass"},
+    {init_vgmstream_waa_wac_wad_wam, "waa,wac,wad,wam"},
+    {init_vgmstream_seg, "seg"},
+    {init_vgmstream_nds_strm_ffta2, "strm"},
+    {init_vgmstream_str_asr, "str,asr"},
+    {init_vgmstream_zwdsp, "zwdsp"},
+    {init_vgmstream_gca, "gca"},
+    {init_vgmstream_spt_spd, "spd"},
+    {init_vgmstream_ish_isd, "isd"},
+    {init_vgmstream_gsp_gsb, "gsb"},
+    {init_vgmstream_ydsp, "ydsp"},
+    {init_vgmstream_msvp, "msvp"},
+    {init_vgmstream_ngc_ssm, "ssm"},
+    {init_vgmstream_ps2_joe, "joe"},
+    {init_vgmstream_vgs, "vgs"},
+    {init_vgmstream_dc_dcsw_dcs, "dcs"},
+    {init_vgmstream_wii_smp, "smp"},
+    {init_vgmstream_emff_ps2, "emff"},
+    {init_vgmstream_emff_ngc, "emff"},
+    {init_vgmstream_ss_stream, "ss3,ss7"},
+    {init_vgmstream_thp, "thp,dsp"},
+    {init_vgmstream_wii_sts, "sts"},
+    {init_vgmstream_ps2_p2bt, "p2bt"},
+    {init_vgmstream_ps2_gbts, "gbts"},
+    {init_vgmstream_wii_sng, "sng"},
+    {init_vgmstream_ngc_dsp_iadp, "iadp"},
+    {init_vgmstream_aax, "aax"},
+    {init_vgmstream_utf_dsp, NULL},
+    {init_vgmstream_ngc_ffcc_str, "str"},
+    {init_vgmstream_sat_baka, "baka"},
+    {init_vgmstream_nds_swav, "swav"},
+    {init_vgmstream_ps2_vsf, "vsf"},
+    {init_vgmstream_nds_rrds, "rrds"},
+    {init_vgmstream_ps2_tk5, "tk5"},
+    {init_vgmstream_ps2_vsf_tta, "vsf"},
+    {init_vgmstream_ads, "ads"},
+    {init_vgmstream_wii_str, "str"},
+    {init_vgmstream_ps2_mcg, "mcg"},
+    {init_vgmstream_zsd, "zsd"},
+    {init_vgmstream_ps2_vgs, "vgs"},
+    {init_vgmstream_RedSpark, "rsd"},
+    {init_vgmstream_ivaud, "ivaud"},
+    {init_vgmstream_wii_wsd, "wsd"},
+    {init_vgmstream_wii_ndp, "ndp"},
+    {init_vgmstream_ps2_sps, "sps"},
+    {init_vgmstream_ps2_xa2_rrp, "xa2"},
+    {init_vgmstream_nds_hwas, "hwas"},
+	  {init_vgmstream_ngc_lps, "lps"},
+    {init_vgmstream_ps2_snd, "snd"},
+    {init_vgmstream_naomi_adpcm, "adpcm"},
+	  {init_vgmstream_sd9, "sd9"},
+	  {init_vgmstream_2dx9, "2dx9"},
+	  {init_vgmstream_dsp_ygo, "dsp"},
+    {init_vgmstream_ps2_vgv, "vgv"},
+    {init_vgmstream_ngc_gcub, "gcub"},
+    {init_vgmstream_maxis_xa, "xa"},
+    {init_vgmstream_ngc_sck_dsp, "sck"},
+    {init_vgmstream_apple_caff, "caf"},
+	  {init_vgmstream_pc_mxst, "mxst"},
+	  {init_vgmstream_sab, "sab"},
+    {init_vgmstream_exakt_sc, "sc"},
+    {init_vgmstream_wii_bns, "bns"},
+    {init_vgmstream_wii_was, "dsp,isws,was"},
+    {init_vgmstream_pona_3do, "pona"},
+    {init_vgmstream_pona_psx, "pona"},
+    {init_vgmstream_xbox_hlwav, "hlwav"},
+    {init_vgmstream_stx, "stx"},
+    {init_vgmstream_ps2_stm, "ps2stm"},
+    {init_vgmstream_myspd, "myspd"},
+    {init_vgmstream_his, "his"},
+	  {init_vgmstream_ps2_ast, "ast"},
+	  {init_vgmstream_dmsg, "dmsg"},
+    {init_vgmstream_ngc_dsp_aaap, "dsp"},
+    {init_vgmstream_ngc_dsp_konami, "dsp"},
+    {init_vgmstream_ps2_ster, "ster"},
+    {init_vgmstream_ps2_wb, "wb"},
+    {init_vgmstream_bnsf, "bnsf"},
 #ifdef VGM_USE_G7221
-    init_vgmstream_s14_sss,
+    {init_vgmstream_s14_sss, "sss,s14"},
 #endif
-    init_vgmstream_ps2_gcm,
-    init_vgmstream_ps2_smpl,
-    init_vgmstream_ps2_msa,
-    init_vgmstream_ps2_voi,
-    init_vgmstream_ps2_khv,
-    init_vgmstream_pc_smp,
-    init_vgmstream_ngc_bo2,
-    init_vgmstream_dsp_ddsp,
-    init_vgmstream_p3d,
-	init_vgmstream_ps2_tk1,
-	init_vgmstream_ps2_adsc,
-    init_vgmstream_ngc_dsp_mpds,
-    init_vgmstream_dsp_str_ig,
-    init_vgmstream_psx_mgav,
-    init_vgmstream_ngc_dsp_sth_str1,
-    init_vgmstream_ngc_dsp_sth_str2,
-    init_vgmstream_ngc_dsp_sth_str3,
-    init_vgmstream_ps2_b1s,
-    init_vgmstream_ps2_wad,
-    init_vgmstream_dsp_xiii,
-    init_vgmstream_dsp_cabelas,
-    init_vgmstream_ps2_adm,
-	  init_vgmstream_ps2_lpcm,
-    init_vgmstream_dsp_bdsp,
-	  init_vgmstream_ps2_vms,
-	  init_vgmstream_ps2_xau,
-    init_vgmstream_gh3_bar,
-    init_vgmstream_ffw,
-    init_vgmstream_dsp_dspw,
-    init_vgmstream_ps2_jstm,
-    init_vgmstream_ps3_xvag,
-	  init_vgmstream_ps3_cps,
-    init_vgmstream_sqex_scd,
-    init_vgmstream_ngc_nst_dsp,
-    init_vgmstream_baf,
-    init_vgmstream_ps3_msf,
-    init_vgmstream_fsb_mpeg,
-	init_vgmstream_nub_vag,
-	init_vgmstream_ps3_past,
-    init_vgmstream_ps3_sgh_sgb,
-	init_vgmstream_ngca,
-	init_vgmstream_wii_ras,
-	init_vgmstream_ps2_spm,
-	init_vgmstream_x360_tra,
-	init_vgmstream_ps2_iab,
-	init_vgmstream_ps2_strlr,
-    init_vgmstream_lsf_n1nj4n,
-	init_vgmstream_ps3_vawx,
-    init_vgmstream_pc_snds,
-	init_vgmstream_ps2_wmus,
-	init_vgmstream_hyperscan_kvag,
-	init_vgmstream_ios_psnd,
-    init_vgmstream_bos_adp,
-    init_vgmstream_eb_sfx,
-    init_vgmstream_eb_sf0,
-	init_vgmstream_ps3_klbs,
-	init_vgmstream_ps3_sgx,
-    init_vgmstream_ps2_mtaf,
-	init_vgmstream_tun,
-	init_vgmstream_wpd,
-	init_vgmstream_ps3_sgd,
-	init_vgmstream_mn_str,
-	init_vgmstream_ps2_mss,
-	init_vgmstream_ps2_hsf,
-	init_vgmstream_ps3_ivag,
-	init_vgmstream_ps2_2pfs,
-    init_vgmstream_xnbm,
-	init_vgmstream_rsd6oogv,
-	init_vgmstream_ubi_ckd,
-	init_vgmstream_ps2_vbk,
+    {init_vgmstream_ps2_gcm, "gcm"},
+    {init_vgmstream_ps2_smpl, "smpl"},
+    {init_vgmstream_ps2_msa, "msa"},
+    {init_vgmstream_ps2_voi, "voi"},
+    {init_vgmstream_ps2_khv, "khv"},
+    {init_vgmstream_pc_smp, "smp"},
+    {init_vgmstream_ngc_bo2, "bo2"},
+    {init_vgmstream_dsp_ddsp, "ddsp"},
+    {init_vgmstream_p3d, "p3d"},
+	{init_vgmstream_ps2_tk1, "tk1"},
+	{init_vgmstream_ps2_adsc, "ads"},
+    {init_vgmstream_ngc_dsp_mpds, "dsp"},
+    {init_vgmstream_dsp_str_ig, "str"},
+    {init_vgmstream_psx_mgav, "str"},
+    {init_vgmstream_ngc_dsp_sth_str1, "sth"},
+    {init_vgmstream_ngc_dsp_sth_str2, "sth"},
+    {init_vgmstream_ngc_dsp_sth_str3, "sth"},
+    {init_vgmstream_ps2_b1s, "b1s"},
+    {init_vgmstream_ps2_wad, "wad"},
+    {init_vgmstream_dsp_xiii, "dsp"},
+    {init_vgmstream_dsp_cabelas, "dsp"},
+    {init_vgmstream_ps2_adm, "adm"},
+	  {init_vgmstream_ps2_lpcm, "lpcm"},
+    {init_vgmstream_dsp_bdsp, "bdsp"},
+	  {init_vgmstream_ps2_vms, "vms"},
+	  {init_vgmstream_ps2_xau, "xau"},
+    {init_vgmstream_gh3_bar, "bar"},
+    {init_vgmstream_ffw, "ffw"},
+    {init_vgmstream_dsp_dspw, "dspw"},
+    {init_vgmstream_ps2_jstm, "stm,jstm"},
+    {init_vgmstream_ps3_xvag, "xvag"},
+	  {init_vgmstream_ps3_cps, "cps"},
+    {init_vgmstream_sqex_scd, "scd"},
+    {init_vgmstream_ngc_nst_dsp, "dsp"},
+    {init_vgmstream_baf, "baf"},
+    {init_vgmstream_ps3_msf, "msf"},
+    {init_vgmstream_fsb_mpeg, "fsb"},
+	{init_vgmstream_nub_vag, "vag"},
+	{init_vgmstream_ps3_past, "past"},
+    {init_vgmstream_ps3_sgh_sgb, "sgb"},
+	{init_vgmstream_ngca, "ngca"},
+	{init_vgmstream_wii_ras, "ras"},
+	{init_vgmstream_ps2_spm, "spm"},
+	{init_vgmstream_x360_tra, "tra"},
+	{init_vgmstream_ps2_iab, "iab"},
+	{init_vgmstream_ps2_strlr, "str"},
+    {init_vgmstream_lsf_n1nj4n, "lsf"},
+	{init_vgmstream_ps3_vawx, "vawx"},
+    {init_vgmstream_pc_snds, "snds"},
+	{init_vgmstream_ps2_wmus, "wmus"},
+	{init_vgmstream_hyperscan_kvag, "bvg"},
+	{init_vgmstream_ios_psnd, "psnd"},
+    {init_vgmstream_bos_adp, "adp"},
+    {init_vgmstream_eb_sfx, "sfx,sf0"},
+    {init_vgmstream_eb_sf0, "sf0"},
+	{init_vgmstream_ps3_klbs, "bnk"},
+	{init_vgmstream_ps3_sgx, "sgx"},
+    {init_vgmstream_ps2_mtaf, "mtaf"},
+	{init_vgmstream_tun, "tun"},
+	{init_vgmstream_wpd, "wpd"},
+	{init_vgmstream_ps3_sgd, "sgd"},
+	{init_vgmstream_mn_str, "mnstr"},
+	{init_vgmstream_ps2_mss, "mss"},
+	{init_vgmstream_ps2_hsf, "hsf"},
+	{init_vgmstream_ps3_ivag, "ivag"},
+	{init_vgmstream_ps2_2pfs, "2pfs"},
+    {init_vgmstream_xnbm, "xnb"},
+	{init_vgmstream_rsd6oogv, "rsd"},
+	{init_vgmstream_ubi_ckd, "ckd"},
+	{init_vgmstream_ps2_vbk, "vbk"},
 };
 
 #define INIT_VGMSTREAM_FCNS (sizeof(init_vgmstream_fcns)/sizeof(init_vgmstream_fcns[0]))
 
+/* check if an extension is in a comma separated list, case insensitive */
+static int extension_in_list(const char * ext, const char * list) {
+    size_t ext_len = strlen(ext);
+
+    while (*list) {
+        size_t len = strcspn(list,",");
+        if (len==ext_len && !strncasecmp(ext,list,len))
+            return 1;
+        list += len;
+        if (*list) list++;
+    }
+
+    return 0;
+}
+
 /* internal version with all parameters */
 VGMSTREAM * init_vgmstream_internal(STREAMFILE *streamFile, int do_dfs) {
     int i;
+    char filename[1024];
+    const char * ext;
     
     if (!streamFile)
         return NULL;
 
+    streamFile->get_name(streamFile,filename,sizeof(filename));
+    ext = filename_extension(filename);
+
     /* try a series of formats, see which works */
     for (i=0;i<INIT_VGMSTREAM_FCNS;i++) {
-        VGMSTREAM * vgmstream = (init_vgmstream_fcns[i])(streamFile);
+        VGMSTREAM * vgmstream;
+
+        /* skip the formats that would reject the extension anyway */
+        if (init_vgmstream_fcns[i].extensions && !extension_in_list(ext,init_vgmstream_fcns[i].extensions))
+            continue;
+
+        vgmstream = (init_vgmstream_fcns[i].init)(streamFile);
         if (vgmstream) {
             /* these are little hacky checks */
 
@@ -381,7 +415,7 @@ VGMSTREAM * init_vgmstream_internal(STREAMFILE *streamFile, int do_dfs) {
 /* format detection and VGMSTREAM setup, uses default parameters */
 VGMSTREAM * init_vgmstream(const char * const filename) {
     VGMSTREAM *vgmstream = NULL;
-    STREAMFILE *streamFile = open_stdio_streamfile(filename);
+    STREAMFILE *streamFile = open_mmap_streamfile(filename);
     if (streamFile) {
         vgmstream = init_vgmstream_from_STREAMFILE(streamFile);
         close_streamfile(streamFile);
@@ -1040,7 +1074,7 @@ void decode_vgmstream_mem(VGMSTREAM * vgmstream, int samples_written, int sample
 
     switch (vgmstream->coding_type) {
         case coding_NGC_DSP:
-            decode_ngc_dsp_mem(&vgmstream->ch[channel],
+            decode_ngc_dsp_frame(&vgmstream->ch[channel],
                     buffer+samples_written*vgmstream->channels+channel,
                     vgmstream->channels,vgmstream->samples_into_block,
                     samples_to_do, data);